@@ -24,10 +24,13 @@
  * include files
  */
 #include <stdlib.h>
+#ifndef DEC_SMALL
 #include <stdio.h>
+#endif
 #include <memory.h>
 #include "typedef.h"
 #include "sp_dec.h"
+#include "interf_dec.h"
 #include "interf_rom.h"
 #include "rom_dec.h"
 
@@ -35,6 +38,8 @@
  * definition of constants
  */
 #define EHF_MASK 0x0008 /* encoder homing frame pattern */
+#define DEC_GROUP 16 /* streams Decoder_Interface_Decode_group_float unpacks at a time */
+#define DEC_PIPE 16 /* frames Decoder_Interface_DecodeN unpacks at a time */
 typedef
 
 struct
@@ -45,11 +50,78 @@ struct
    enum RXFrameType prev_ft;   /* previous frame type */
    enum Mode prev_mode;   /* previous mode */
    void *decoder_State;   /* Points decoder state */
+   int own_mem;   /* state block was allocated by Decoder_Interface_init */
+   int homing;   /* homing frames are detected */
+   int format;   /* DEC_FORMAT_* of octet frames */
+   float gain;   /* of floating point output, see Decoder_Interface_set_gain */
 
 
 }dec_interface_State;
 
-#ifdef ETSI
+/*
+ * format of octet frames right after init, as in builds before it
+ * could be set
+ */
+#ifdef IF2
+#define DEC_FORMAT_DEFAULT DEC_FORMAT_IF2
+#else
+#define DEC_FORMAT_DEFAULT DEC_FORMAT_MMS
+#endif
+
+/*
+ * Small profile, see sp_dec.c: only storage format and RTP payload
+ * frames are decoded, ETSI serial frames and IF2 are left out, and
+ * errors are not printed
+ */
+#ifdef DEC_SMALL
+#if defined( ETSI ) || defined( IF2 )
+#error DEC_SMALL builds decode neither ETSI serial frames nor IF2
+#endif
+#define DEC_ERROR( msg ) ( ( void )0 )
+#else
+#define DEC_ERROR( msg ) fprintf( stderr, msg )
+#endif
+
+/*
+ * Frame types of storage format header and RTP payload table of
+ * contents, and what their frames hold; types past MRDTX hold no
+ * parameters
+ */
+typedef struct
+{
+   Word16 bits;   /* speech bits */
+   Word16 prmno;   /* parameters */
+   Word16 homing_first;   /* parameters of the first subframe, see
+                             Decoder_Interface_homing_first */
+   const Word16 *order;   /* parameter and weight of each bit */
+   const Word16 *bitno;   /* bits of each parameter in ETSI serial frames */
+   const Word16 *homing;   /* decoder homing frame, NULL if none */
+} Frame_desc;
+
+static const Frame_desc frame_desc[16] =
+{
+   { 95, PRMNO_MR475, 7, order_MR475, bitno_MR475, dhf_MR475 },
+   { 103, PRMNO_MR515, 7, order_MR515, bitno_MR515, dhf_MR515 },
+   { 118, PRMNO_MR59, 7, order_MR59, bitno_MR59, dhf_MR59 },
+   { 134, PRMNO_MR67, 7, order_MR67, bitno_MR67, dhf_MR67 },
+   { 148, PRMNO_MR74, 7, order_MR74, bitno_MR74, dhf_MR74 },
+   { 159, PRMNO_MR795, 8, order_MR795, bitno_MR795, dhf_MR795 },
+   { 204, PRMNO_MR102, 12, order_MR102, bitno_MR102, dhf_MR102 },
+   { 244, PRMNO_MR122, 18, order_MR122, bitno_MR122, dhf_MR122 },
+   { 35, PRMNO_MRDTX, 0, order_MRDTX, bitno_MRDTX, NULL }
+};
+
+/*
+ * speech bits and, for SID frames, SID type bit and speech mode
+ * indicator, in whole octets
+ */
+const short Decoder_Interface_block_size[16] =
+{
+   12, 13, 15, 17, 19, 20, 26, 31, 5, 0, 0, 0, 0, 0, 0, 0
+};
+
+
+#ifndef DEC_SMALL
 
 
 /*
@@ -102,257 +174,282 @@ static Word16 Bin2Int( Word16 no_of_bits, Word16 *bitstream )
  */
 static void Bits2Prm( enum Mode mode, Word16 bits[], Word16 prm[] )
 {
-   Word32 i;
+   const Word16 *bitno;
+   Word32 i, n;
 
 
-   switch ( mode ) {
-      case MR122:
-         for ( i = 0; i < PRMNO_MR122; i++ ) {
-            prm[i] = Bin2Int( bitno_MR122[i], bits );
-            bits += bitno_MR122[i];
-         }
-         break;
+   if ( mode < MR475 || mode > MRDTX )
+      return;
+   bitno = frame_desc[mode].bitno;
+   n = frame_desc[mode].prmno;
 
-      case MR102:
-         for ( i = 0; i < PRMNO_MR102; i++ ) {
-            prm[i] = Bin2Int( bitno_MR102[i], bits );
-            bits += bitno_MR102[i];
-         }
-         break;
+   for ( i = 0; i < n; i++ ) {
+      prm[i] = Bin2Int( bitno[i], bits );
+      bits += bitno[i];
+   }
+}
 
-      case MR795:
-         for ( i = 0; i < PRMNO_MR795; i++ ) {
-            prm[i] = Bin2Int( bitno_MR795[i], bits );
-            bits += bitno_MR795[i];
-         }
-         break;
 
-      case MR74:
-         for ( i = 0; i < PRMNO_MR74; i++ ) {
-            prm[i] = Bin2Int( bitno_MR74[i], bits );
-            bits += bitno_MR74[i];
-         }
-         break;
+/*
+ * DecoderETSI
+ *
+ *
+ * Parameters:
+ *    param             O: AMR parameters
+ *    serial            I: ETSI serial frame, frame type, 244 bits and mode
+ *    frame_type        O: frame type
+ *    speech_mode       O: speech mode in DTX
+ *
+ * Function:
+ *    Unpacks frame of ETSI test vector format
+ *
+ * Returns:
+ *    mode              used mode
+ */
+static enum Mode DecoderETSI( Word16 *param, Word16 *serial, enum RXFrameType
+                              *frame_type, enum Mode *speech_mode )
+{
+   enum Mode mode;
 
-      case MR67:
-         for ( i = 0; i < PRMNO_MR67; i++ ) {
-            prm[i] = Bin2Int( bitno_MR67[i], bits );
-            bits += bitno_MR67[i];
-         }
-         break;
 
-      case MR59:
-         for ( i = 0; i < PRMNO_MR59; i++ ) {
-            prm[i] = Bin2Int( bitno_MR59[i], bits );
-            bits += bitno_MR59[i];
-         }
+   memset( param, 0, PRMNO_MR122 * sizeof( Word16 ) );
+   mode = ( enum Mode )serial[245];
+
+   switch ( serial[0] ) {
+      case 0:
+         *frame_type = RX_SPEECH_GOOD;
+         Bits2Prm( mode, &serial[1], param );
          break;
 
-      case MR515:
-         for ( i = 0; i < PRMNO_MR515; i++ ) {
-            prm[i] = Bin2Int( bitno_MR515[i], bits );
-            bits += bitno_MR515[i];
-         }
+      case 1:
+         *frame_type = RX_SID_FIRST;
+         *speech_mode = mode;
+         mode = MRDTX;
          break;
 
-      case MR475:
-         for ( i = 0; i < PRMNO_MR475; i++ ) {
-            prm[i] = Bin2Int( bitno_MR475[i], bits );
-            bits += bitno_MR475[i];
-         }
+      case 2:
+         *frame_type = RX_SID_UPDATE;
+         *speech_mode = mode;
+         mode = MRDTX;
+         Bits2Prm( MRDTX, &serial[1], param );
          break;
 
-      case MRDTX:
-         for ( i = 0; i < PRMNO_MRDTX; i++ ) {
-            prm[i] = Bin2Int( bitno_MRDTX[i], bits );
-            bits += bitno_MRDTX[i];
-         }
+      default:
+         *frame_type = RX_NO_DATA;
          break;
    }
-   return;
+   return mode;
 }
 
-#else
 
-#ifndef IF2
+#endif
+
 
+#ifndef DEC_SMALL
 /*
- * DecoderMMS
+ * Storage format frames are unpacked a nibble at a time, by the tables
+ * mms_nibbles and mms_first of interf_rom.h: for each nibble of a frame
+ * of each mode there are the parameters its bits belong to and what
+ * each of the 16 nibble values adds to them, so a frame takes a lookup
+ * per nibble instead of an add per bit. Tables are constant, so
+ * decoders created on several threads at once share them safely.
+ * DEC_SMALL builds have no room for them and unpack bit by bit.
+ */
+
+
+/*
+ * Unpack_MMS
  *
  *
  * Parameters:
- *    param             O: AMR parameters
- *    stream            I: input bitstream
- *    frame_type        O: frame type
- *    speech_mode       O: speech mode in DTX
+ *    param             B: AMR parameters
+ *    stream            I: octets of the frame, after the header
+ *    mode              I: mode of the frame
  *
  * Function:
- *    AMR file storage format frame to decoder parameters
+ *    Adds weight of each set bit to its parameter, a nibble at a time,
+ *    from mms_nibbles. Number of parameters of a nibble
+ *    only depends on its position, so branching on it is predicted
+ *    well.
  *
  * Returns:
- *    mode              used mode
+ *    the octet following the last unpacked bit, shifted so that the
+ *    next bit is MSB
  */
-enum Mode DecoderMMS( Word16 *param, UWord8 *stream, enum RXFrameType
-                      *frame_type, enum Mode *speech_mode, Word16 *q_bit )
+static UWord8 Unpack_MMS( Word16 *param, UWord8 *stream, enum Mode mode )
 {
-   enum Mode mode;
-   Word32 j;
-   Word16 *mask;
-
+   const MMS_nibble *t = &mms_nibbles[mms_first[mode]];
+   const Word16 *add;
+   Word32 i, bits = frame_desc[mode].bits;
+
+
+   for ( i = 0; i < bits; i += 4, t++ ) {
+      add = t->add[( stream[i >> 3] >> ( ~i & 4 ) ) & 15];
+
+      switch ( t->count ) {
+         case 4:
+            param[t->param[3]] = ( Word16 )( param[t->param[3]] + add[3] );
+            /* fall through */
+         case 3:
+            param[t->param[2]] = ( Word16 )( param[t->param[2]] + add[2] );
+            /* fall through */
+         case 2:
+            param[t->param[1]] = ( Word16 )( param[t->param[1]] + add[1] );
+            /* fall through */
+         default:
+            param[t->param[0]] = ( Word16 )( param[t->param[0]] + add[0] );
+      }
+   }
+   return( UWord8 )( stream[bits >> 3] << ( bits & 7 ) );
+}
 
-   memset( param, 0, PRMNO_MR122 <<1 );
-   *q_bit = 0x01 & (*stream >> 2);
-   mode = 0x0F & (*stream >> 3);
-   stream++;
 
-   if ( mode == MRDTX ) {
-      mask = order_MRDTX;
+/*
+ * G.711 output is coded from 16-bit output by lookup in g711_codes of
+ * interf_rom.h: decoder output is 13-bit, so a table of 8192 codes per
+ * law, 16 kB for both, indexed by the sample shifted down by 3, codes
+ * every sample there is. Tables are constant, so they need no decoder
+ * created first
+ */
 
-      for ( j = 1; j < 36; j++ ) {
-         if ( *stream & 0x80 )
-            param[ * mask] = ( short )( param[ * mask] + *( mask + 1 ) );
-         mask += 2;
 
-         if ( j % 8 )
-            *stream <<= 1;
-         else
-            stream++;
-      }
+/*
+ * Encode_G711
+ *
+ *
+ * Parameters:
+ *    synth             I: synthesized speech of a frame
+ *    out               O: G.711 code of each sample
+ *    law               I: DEC_G711_ALAW or DEC_G711_ULAW
+ *
+ * Function:
+ *    Codes 160 samples by g711_codes
+ *
+ * Returns:
+ *    void
+ */
+static void Encode_G711( Word16 *synth, UWord8 *out, int law )
+{
+   const UWord8 *codes = g711_codes[law != DEC_G711_ALAW];
+   Word32 i;
 
-      /* get SID type bit */
 
-      *frame_type = RX_SID_FIRST;
-      if (*stream & 0x80)
-         *frame_type = RX_SID_UPDATE;
+   for ( i = 0; i < 160; i++ )
+      out[i] = codes[( synth[i] >> 3 ) + 4096];
+}
+#endif
 
-      /* since there is update, use it */
-      /* *frame_type = RX_SID_UPDATE; */
 
-      /* speech mode indicator */
-	  *speech_mode = (*stream >> 4) && 0x07;
+/*
+ * Unpack_bits
+ *
+ *
+ * Parameters:
+ *    param             B: AMR parameters
+ *    stream            I: octets the frame is in
+ *    offset            I: bit of stream the frame starts at, from MSB
+ *    mask              I: ordering table, parameter and weight of each bit
+ *    bits              I: number of bits to unpack
+ *    tail              I: number of bits to get after them, up to 8
+ *
+ * Function:
+ *    Same as Unpack_MMS, for frames not starting at an octet, as in
+ *    bandwidth-efficient RTP payload, and for all frames in DEC_SMALL
+ *    builds. No octet past the tail bits is read
+ *
+ * Returns:
+ *    the tail bits, first one as MSB
+ */
+static UWord8 Unpack_bits( Word16 *param, UWord8 *stream, Word32 offset,
+                           const Word16 *mask, Word32 bits, Word32 tail )
+{
+   Word32 i, bit, next;
 
-   }
-   else if ( mode == 15 ) {
-      *frame_type = RX_NO_DATA;
-   }
-   else if ( mode == MR475 ) {
-      mask = order_MR475;
 
-      for ( j = 1; j < 96; j++ ) {
-         if ( *stream & 0x80 )
-            param[ * mask] = ( short )( param[ * mask] + *( mask + 1 ) );
-         mask += 2;
+   stream += offset >> 3;
+   offset &= 7;
 
-         if ( j % 8 )
-            *stream <<= 1;
-         else
-            stream++;
-      }
-      *frame_type = RX_SPEECH_GOOD;
+   for ( i = offset; i < offset + bits; i++ ) {
+      bit = ( stream[i >> 3] >> ( 7 - ( i & 7 ) ) ) & 1;
+      param[ * mask] = ( short )( param[ * mask] + ( *( mask + 1 ) & -bit ) );
+      mask += 2;
    }
-   else if ( mode == MR515 ) {
-      mask = order_MR515;
-
-      for ( j = 1; j < 104; j++ ) {
-         if ( *stream & 0x80 )
-            param[ * mask] = ( short )( param[ * mask] + *( mask + 1 ) );
-         mask += 2;
+   next = 0;
 
-         if ( j % 8 )
-            *stream <<= 1;
-         else
-            stream++;
-      }
-      *frame_type = RX_SPEECH_GOOD;
+   for ( ; i < offset + bits + tail; i++ ) {
+      next = ( next << 1 ) | ( ( stream[i >> 3] >> ( 7 - ( i & 7 ) ) ) & 1 );
    }
-   else if ( mode == MR59 ) {
-      mask = order_MR59;
+   return( UWord8 )( next << ( 8 - tail ) );
+}
 
-      for ( j = 1; j < 119; j++ ) {
-         if ( *stream & 0x80 )
-            param[ * mask] = ( short )( param[ * mask] + *( mask + 1 ) );
-         mask += 2;
 
-         if ( j % 8 )
-            *stream <<= 1;
-         else
-            stream++;
-      }
-      *frame_type = RX_SPEECH_GOOD;
-   }
-   else if ( mode == MR67 ) {
-      mask = order_MR67;
+/*
+ * Decoder_bits
+ *
+ *
+ * Parameters:
+ *    param             O: AMR parameters
+ *    header            I: frame type and Q bit, in storage format header
+ *                         bit positions
+ *    stream            I: speech bits of the frame
+ *    offset            I: bit of stream they start at, from MSB
+ *    frame_type        O: frame type
+ *    speech_mode       O: speech mode in DTX
+ *    q_bit             O: frame quality bit
+ *
+ * Function:
+ *    Frame bits to decoder parameters, whether they follow storage
+ *    format header or RTP payload table of contents
+ *
+ * Returns:
+ *    mode              used mode
+ */
+static enum Mode Decoder_bits( Word16 *param, UWord8 header, UWord8 *stream,
+                               Word32 offset, enum RXFrameType *frame_type,
+                               enum Mode *speech_mode, Word16 *q_bit )
+{
+   enum Mode mode;
+   UWord8 next;
 
-      for ( j = 1; j < 135; j++ ) {
-         if ( *stream & 0x80 )
-            param[ * mask] = ( short )( param[ * mask] + *( mask + 1 ) );
-         mask += 2;
 
-         if ( j % 8 )
-            *stream <<= 1;
-         else
-            stream++;
-      }
-      *frame_type = RX_SPEECH_GOOD;
-   }
-   else if ( mode == MR74 ) {
-      mask = order_MR74;
+   memset( param, 0, PRMNO_MR122 * sizeof( Word16 ) );
+   *q_bit = 0x01 & (header >> 2);
+   mode = 0x0F & (header >> 3);
 
-      for ( j = 1; j < 149; j++ ) {
-         if ( *stream & 0x80 )
-            param[ * mask] = ( short )( param[ * mask] + *( mask + 1 ) );
-         mask += 2;
+   if ( mode == MRDTX ) {
+      /* SID type bit and speech mode indicator follow */
+#ifndef DEC_SMALL
+      if ( offset == 0 )
+         next = Unpack_MMS( param, stream, MRDTX );
+      else
+#endif
+         next = Unpack_bits( param, stream, offset, order_MRDTX,
+               frame_desc[MRDTX].bits, 4 );
 
-         if ( j % 8 )
-            *stream <<= 1;
-         else
-            stream++;
-      }
-      *frame_type = RX_SPEECH_GOOD;
-   }
-   else if ( mode == MR795 ) {
-      mask = order_MR795;
+      /* get SID type bit */
 
-      for ( j = 1; j < 160; j++ ) {
-         if ( *stream & 0x80 )
-            param[ * mask] = ( short )( param[ * mask] + *( mask + 1 ) );
-         mask += 2;
+      *frame_type = RX_SID_FIRST;
+      if (next & 0x80)
+         *frame_type = RX_SID_UPDATE;
 
-         if ( j % 8 )
-            *stream <<= 1;
-         else
-            stream++;
-      }
-      *frame_type = RX_SPEECH_GOOD;
-   }
-   else if ( mode == MR102 ) {
-      mask = order_MR102;
+      /* since there is update, use it */
+      /* *frame_type = RX_SID_UPDATE; */
 
-      for ( j = 1; j < 205; j++ ) {
-         if ( *stream & 0x80 )
-            param[ * mask] = ( short )( param[ * mask] + *( mask + 1 ) );
-         mask += 2;
+      /* speech mode indicator */
+	  *speech_mode = (next >> 4) && 0x07;
 
-         if ( j % 8 )
-            *stream <<= 1;
-         else
-            stream++;
-      }
-      *frame_type = RX_SPEECH_GOOD;
    }
-   else if ( mode == MR122 ) {
-      mask = order_MR122;
-
-      for ( j = 1; j < 245; j++ ) {
-         if ( *stream & 0x80 )
-            param[ * mask] = ( short )( param[ * mask] + *( mask + 1 ) );
-         mask += 2;
-
-         if ( j % 8 )
-            *stream <<= 1;
-         else
-            stream++;
-      }
+   else if ( mode == 15 ) {
+      *frame_type = RX_NO_DATA;
+   }
+   else if ( mode < MRDTX ) {
+#ifndef DEC_SMALL
+      if ( offset == 0 )
+         Unpack_MMS( param, stream, mode );
+      else
+#endif
+         Unpack_bits( param, stream, offset, frame_desc[mode].order,
+               frame_desc[mode].bits, 0 );
       *frame_type = RX_SPEECH_GOOD;
    }
    else
@@ -360,8 +457,32 @@ enum Mode DecoderMMS( Word16 *param, UWord8 *stream, enum RXFrameType
    return mode;
 }
 
-#else
 
+/*
+ * DecoderMMS
+ *
+ *
+ * Parameters:
+ *    param             O: AMR parameters
+ *    stream            I: input bitstream
+ *    frame_type        O: frame type
+ *    speech_mode       O: speech mode in DTX
+ *
+ * Function:
+ *    AMR file storage format frame to decoder parameters
+ *
+ * Returns:
+ *    mode              used mode
+ */
+enum Mode DecoderMMS( Word16 *param, UWord8 *stream, enum RXFrameType
+                      *frame_type, enum Mode *speech_mode, Word16 *q_bit )
+{
+   return Decoder_bits( param, *stream, stream + 1, 0, frame_type,
+         speech_mode, q_bit );
+}
+
+
+#ifndef DEC_SMALL
 /*
  * Decoder3GPP
  *
@@ -378,22 +499,23 @@ enum Mode DecoderMMS( Word16 *param, UWord8 *stream, enum RXFrameType
  * Returns:
  *    mode              used mode
  */
-enum Mode Decoder3GPP( Word16 *param, UWord8 *stream, enum RXFrameType
-                      *frame_type, enum Mode *speech_mode )
+static enum Mode Decoder3GPP( Word16 *param, UWord8 *stream, enum
+                             RXFrameType *frame_type, enum Mode *speech_mode )
 {
    enum Mode mode;
-   Word32 j;
-   Word16 *mask;
+   Word32 j, n;
+   const Word16 *mask;
 
 
-   memset( param, 0, PRMNO_MR122 <<1 );
+   memset( param, 0, PRMNO_MR122 * sizeof( Word16 ) );
    mode = 0xF & *stream;
    *stream >>= 4;
 
-   if ( mode == MRDTX ) {
-      mask = order_MRDTX;
+   if ( mode <= MRDTX ) {
+      mask = frame_desc[mode].order;
+      n = 5 + frame_desc[mode].bits;
 
-      for ( j = 5; j < 40; j++ ) {
+      for ( j = 5; j < n; j++ ) {
          if ( *stream & 0x1 )
             param[ * mask] = ( short )( param[ * mask] + *( mask + 1 ) );
          mask += 2;
@@ -403,7 +525,9 @@ enum Mode Decoder3GPP( Word16 *param, UWord8 *stream, enum RXFrameType
          else
             stream++;
       }
+   }
 
+   if ( mode == MRDTX ) {
       /* get SID type bit */
 
       *frame_type = RX_SID_FIRST;
@@ -420,461 +544,1601 @@ enum Mode Decoder3GPP( Word16 *param, UWord8 *stream, enum RXFrameType
    else if ( mode == 15 ) {
       *frame_type = RX_NO_DATA;
    }
-   else if ( mode == MR475 ) {
-      mask = order_MR475;
-
-      for ( j = 5; j < 100; j++ ) {
-         if ( *stream & 0x1 )
-            param[ * mask] = ( short )( param[ * mask] + *( mask + 1 ) );
-         mask += 2;
-
-         if ( j % 8 )
-            *stream >>= 1;
-         else
-            stream++;
-      }
+   else if ( mode < MRDTX ) {
       *frame_type = RX_SPEECH_GOOD;
    }
-   else if ( mode == MR515 ) {
-      mask = order_MR515;
-
-      for ( j = 5; j < 108; j++ ) {
-         if ( *stream & 0x1 )
-            param[ * mask] = ( short )( param[ * mask] + *( mask + 1 ) );
-         mask += 2;
+   else
+      *frame_type = RX_SPEECH_BAD;
+   return mode;
+}
+#endif
+
+/*
+ * Decoder_Interface_reset
+ *
+ *
+ * Parameters:
+ *    state             B: state struct
+ *
+ * Function:
+ *    Reset homing frame counter and speech decoder, so the instance
+ *    behaves as if it was just initialized
+ *
+ * Returns:
+ *    void
+ */
+void Decoder_Interface_reset( void *state )
+{
+   dec_interface_State * st;
+   st = ( dec_interface_State * )state;
+
+   st->reset_flag_old = 1;
+   st->prev_ft = RX_SPEECH_GOOD;
+   st->prev_mode = MR475;   /* minimum bitrate */
+   Speech_Decode_Frame_reset( st->decoder_State );
+}
+
+
+/*
+ * Decoder_Interface_set_homing
+ *
+ *
+ * Parameters:
+ *    state             B: state structure
+ *    enable            I: 0 to decode homing frames as any other frame
+ *
+ * Function:
+ *    Turns detecting of decoder homing frames on or off. Homing frames
+ *    are for codec testing and do not occur in files in practice, so
+ *    players can skip comparing every frame with them. The setting is
+ *    kept over Decoder_Interface_reset
+ *
+ * Returns:
+ *    void
+ */
+void Decoder_Interface_set_homing( void *state, int enable )
+{
+   ( ( dec_interface_State * )state )->homing = enable != 0;
+}
+
+
+/*
+ * Decoder_Interface_set_format
+ *
+ *
+ * Parameters:
+ *    state             B: state structure
+ *    format            I: DEC_FORMAT_MMS or DEC_FORMAT_IF2
+ *
+ * Function:
+ *    Selects how octet frames given to Decoder_Interface_Decode,
+ *    Decoder_Interface_DecodeN and Decoder_Interface_EstimateN are
+ *    unpacked: storage format (RFC 4867 section 5) or IF2. ETSI serial
+ *    frames have entry points of their own. The setting is kept over
+ *    Decoder_Interface_reset and Decoder_Interface_restore. DEC_SMALL
+ *    builds have no IF2 and stay with storage format
+ *
+ * Returns:
+ *    void
+ */
+void Decoder_Interface_set_format( void *state, int format )
+{
+#ifndef DEC_SMALL
+   ( ( dec_interface_State * )state )->format = format == DEC_FORMAT_IF2 ?
+         DEC_FORMAT_IF2 : DEC_FORMAT_MMS;
+#else
+   ( void )state;
+   ( void )format;
+#endif
+}
+
+
+/*
+ * Decoder_Interface_set_engine
+ *
+ *
+ * Parameters:
+ *    state             B: state structure
+ *    engine            I: DEC_ENGINE_FIXED, DEC_ENGINE_FLOAT or
+ *                         DEC_ENGINE_BYPASS
+ *
+ * Function:
+ *    Selects fixed or floating point post filtering of this instance, or
+ *    none, see Speech_Decode_Frame_set_engine. The setting is kept over
+ *    Decoder_Interface_reset and Decoder_Interface_restore
+ *
+ * Returns:
+ *    void
+ */
+void Decoder_Interface_set_engine( void *state, int engine )
+{
+   Speech_Decode_Frame_set_engine( ( ( dec_interface_State * )state )->
+         decoder_State, engine == DEC_ENGINE_FLOAT ? SP_DEC_ENGINE_FLOAT :
+         engine == DEC_ENGINE_BYPASS ? SP_DEC_ENGINE_BYPASS :
+         SP_DEC_ENGINE_FIXED );
+}
+
+
+/*
+ * Decoder_Interface_set_gain
+ *
+ *
+ * Parameters:
+ *    state             B: state structure
+ *    gain              I: linear gain, 1 for none
+ *
+ * Function:
+ *    Multiplies floating point output of this instance by gain as it is
+ *    written, see Speech_Decode_Frame_set_gain. The setting is kept over
+ *    Decoder_Interface_reset and Decoder_Interface_restore
+ *
+ * Returns:
+ *    void
+ */
+void Decoder_Interface_set_gain( void *state, float gain )
+{
+   dec_interface_State * s;
+
+   s = ( dec_interface_State * )state;
+   s->gain = gain;
+   Speech_Decode_Frame_set_gain( s->decoder_State, gain );
+}
+
+
+/*
+ * Decoder_Interface_pitch_lag
+ *
+ *
+ * Parameters:
+ *    state             I: state structure
+ *
+ * Function:
+ *    Pitch lag of the frame decoded last, see
+ *    Speech_Decode_Frame_pitch_lag
+ *
+ * Returns:
+ *    lag in samples at 8 kHz, 0 if there was no speech
+ */
+int Decoder_Interface_pitch_lag( void *state )
+{
+   return Speech_Decode_Frame_pitch_lag( ( ( dec_interface_State * )state )->
+         decoder_State );
+}
+
+
+/*
+ * Decoder_Interface_features
+ *
+ *
+ * Parameters:
+ *    state             I: state structure
+ *    out               O: parameters of the frame
+ *
+ * Function:
+ *    Parameters of the frame decoded last, see
+ *    Speech_Decode_Frame_features
+ *
+ * Returns:
+ *    void
+ */
+void Decoder_Interface_features( void *state, struct Dec_features *out )
+{
+   out->mode = ( unsigned char )Speech_Decode_Frame_features( ( (
+         dec_interface_State * )state )->decoder_State, &out->lsp[0][0], out->
+         lag, out->lag_frac, out->gain_pit, out->gain_code );
+}
+
+
+/*
+ * Decoder_Interface_select_kernels
+ *
+ *
+ * Parameters:
+ *    cpu_features      I: DEC_CPU_* flags of the CPU, 0 for plain C
+ *
+ * Function:
+ *    Picks decoder kernels for all instances, see
+ *    Speech_Decode_Frame_select_kernels
+ *
+ * Returns:
+ *    void
+ */
+void Decoder_Interface_select_kernels( int cpu_features )
+{
+   Speech_Decode_Frame_select_kernels( ( ( cpu_features & DEC_CPU_SSE2 ) ?
+         SP_DEC_CPU_SSE2 : 0 ) | ( ( cpu_features & DEC_CPU_NEON ) ?
+         SP_DEC_CPU_NEON : 0 ) );
+}
+
+
+/*
+ * Decoder_Interface_reference_kernels
+ *
+ *
+ * Parameters:
+ *    enable            I: nonzero for plain C kernels, 0 for picked ones
+ *
+ * Function:
+ *    Plain C kernels for decoders the calling thread runs, see
+ *    Speech_Decode_Frame_reference_kernels
+ *
+ * Returns:
+ *    void
+ */
+void Decoder_Interface_reference_kernels( int enable )
+{
+   Speech_Decode_Frame_reference_kernels( enable );
+}
+
+
+/*
+ * Decoder_Interface_mem_size
+ *
+ *
+ * Parameters:
+ *    void
+ *
+ * Function:
+ *    Size of memory block needed by Decoder_Interface_init_mem
+ *
+ * Returns:
+ *    size in bytes
+ */
+int Decoder_Interface_mem_size( void )
+{
+   return sizeof( dec_interface_State ) + Speech_Decode_Frame_mem_size( );
+}
+
+
+/*
+ * Decoder_Interface_init_mem
+ *
+ *
+ * Parameters:
+ *    mem               I: Decoder_Interface_mem_size() bytes of memory,
+ *                         aligned as if returned by malloc
+ *
+ * Function:
+ *    Initializes state memory in given block. The block is not freed
+ *    by Decoder_Interface_exit, it stays owned by the caller.
+ *
+ * Returns:
+ *    success           : pointer to structure
+ *    failure           : NULL
+ */
+void * Decoder_Interface_init_mem( void *mem )
+{
+   dec_interface_State * s;
+
+   if ( mem == NULL ) {
+      DEC_ERROR( "Decoder_Interface_init_mem: invalid parameter\n" );
+      return NULL;
+   }
+   s = ( dec_interface_State * )mem;
+   s->decoder_State = Speech_Decode_Frame_init_mem( s + 1 );
+   s->own_mem = 0;
+   s->homing = 1;
+   s->format = DEC_FORMAT_DEFAULT;
+   s->gain = 1.0F;
+   Decoder_Interface_reset( s );
+   return s;
+}
+
+
+/*
+ * Decoder_Interface_snapshot_size
+ *
+ *
+ * Parameters:
+ *    void
+ *
+ * Function:
+ *    Size of buffer needed by Decoder_Interface_snapshot
+ *
+ * Returns:
+ *    size in bytes
+ */
+int Decoder_Interface_snapshot_size( void )
+{
+   return sizeof( dec_interface_State ) + Speech_Decode_Frame_snapshot_size( );
+}
+
+
+/*
+ * Decoder_Interface_snapshot
+ *
+ *
+ * Parameters:
+ *    state             I: state structure
+ *    buf               O: Decoder_Interface_snapshot_size() bytes,
+ *                         aligned as if returned by malloc
+ *
+ * Function:
+ *    Copies state to buf, so it can be compared to one of another
+ *    instance. Instances with snapshots of the same bytes decode any
+ *    frames that follow to the same output. See
+ *    Speech_Decode_Frame_snapshot.
+ *
+ * Returns:
+ *    void
+ */
+void Decoder_Interface_snapshot( void *state, void *buf )
+{
+   dec_interface_State * s, * b;
+
+   s = ( dec_interface_State * )state;
+   b = ( dec_interface_State * )buf;
+   memset( b, 0, sizeof( dec_interface_State ) );
+   b->reset_flag_old = s->reset_flag_old;
+   b->prev_ft = s->prev_ft;
+   b->prev_mode = s->prev_mode;
+   Speech_Decode_Frame_snapshot( s->decoder_State, b + 1 );
+}
+
+
+/*
+ * Decoder_Interface_restore
+ *
+ *
+ * Parameters:
+ *    state             B: state structure
+ *    buf               I: snapshot by Decoder_Interface_snapshot
+ *
+ * Function:
+ *    Brings decoder to the state snapshot was taken in, so frames
+ *    that followed the snapshot decode bit-exactly as they did. See
+ *    Speech_Decode_Frame_restore.
+ *
+ * Returns:
+ *    void
+ */
+void Decoder_Interface_restore( void *state, const void *buf )
+{
+   dec_interface_State * s;
+   const dec_interface_State * b;
+
+   s = ( dec_interface_State * )state;
+   b = ( const dec_interface_State * )buf;
+   s->reset_flag_old = b->reset_flag_old;
+   s->prev_ft = b->prev_ft;
+   s->prev_mode = b->prev_mode;
+   Speech_Decode_Frame_restore( s->decoder_State, b + 1 );
+}
+#ifdef DEC_PROFILE
+
+
+/*
+ * Decoder_Interface_profile
+ *
+ *
+ * Parameters:
+ *    state             B: state structure
+ *    out               O: counters
+ *
+ * Function:
+ *    Copies counters of instrumentation build to out and clears them,
+ *    so the next call returns what was decoded after this one
+ *
+ * Returns:
+ *    void
+ */
+void Decoder_Interface_profile( void *state, struct Dec_profile *out )
+{
+   struct Dec_profile * p;
+
+   p = Speech_Decode_Frame_profile( ( ( dec_interface_State * )state )->
+         decoder_State );
+   memcpy( out, p, sizeof( struct Dec_profile ) );
+   memset( p, 0, sizeof( struct Dec_profile ) );
+}
+
+
+/*
+ * Decoder_Interface_cycles
+ *
+ *
+ * Parameters:
+ *    void
+ *
+ * Function:
+ *    Reads the counter stages are timed with, for callers timing
+ *    their own stages
+ *
+ * Returns:
+ *    counter value
+ */
+unsigned long long Decoder_Interface_cycles( void )
+{
+   return Speech_Decode_Frame_cycles( );
+}
+#endif
+
+
+/*
+ * Decoder_Interface_init
+ *
+ *
+ * Parameters:
+ *    void
+ *
+ * Function:
+ *    Allocates state memory and initializes state memory
+ *
+ * Returns:
+ *    success           : pointer to structure
+ *    failure           : NULL
+ */
+void * Decoder_Interface_init( void )
+{
+   void * mem;
+   dec_interface_State * s;
+
+   /* allocate memory, for this and speech decoder states at once */
+   if ( ( mem = malloc( Decoder_Interface_mem_size( ) ) ) == NULL ) {
+      DEC_ERROR( "Decoder_Interface_init: "
+            "can not malloc state structure\n" );
+      return NULL;
+   }
+   s = ( dec_interface_State * )Decoder_Interface_init_mem( mem );
+   s->own_mem = 1;
+   return s;
+}
+
+
+/*
+ * Decoder_Interface_exit
+ *
+ *
+ * Parameters:
+ *    state                I: state structure
+ *
+ * Function:
+ *    The memory used for state memory is freed
+ *
+ * Returns:
+ *    Void
+ */
+void Decoder_Interface_exit( void *state )
+{
+   dec_interface_State * s;
+   s = ( dec_interface_State * )state;
+
+   /* free memory */
+   Speech_Decode_Frame_exit(s->decoder_State );
+
+   if ( s->own_mem )
+      free( s );
+   s = NULL;
+   state = NULL;
+}
+
+
+/*
+ * Homing_test
+ *
+ *
+ * Parameters:
+ *    prm               I: AMR parameters
+ *    mode              I: AMR mode
+ *    first             I: compare parameters of the first subframe only
+ *
+ * Function:
+ *    Compare parameters with decoder homing frame of the mode. Speech
+ *    frames hardly ever start like homing frame, so the first parameter
+ *    decides nearly always
+ *
+ * Returns:
+ *    0 if parameters match homing frame, nonzero otherwise
+ */
+static Word32 Homing_test( Word16 *prm, enum Mode mode, Word32 first )
+{
+   const Word16 *homing;   /* pointer to homing frame */
+   Word32 i, n;
+
+
+   if ( mode >= MRDTX )
+      return 1;
+   homing = frame_desc[mode].homing;
+
+   if ( prm[0] != homing[0] )
+      return 1;
+   n = first ? frame_desc[mode].homing_first : frame_desc[mode].prmno;
+
+   for ( i = 1; i < n; i++ ) {
+      if ( prm[i] != homing[i] )
+         return 1;
+   }
+   return 0;
+}
+
+
+/*
+ * Decoder_Interface_parse
+ *
+ *
+ * Parameters:
+ *    format            I: DEC_FORMAT_* of octet frames
+ *    bits              I: bit stream
+ *    serial            I: ETSI serial frame, or NULL to decode bits
+ *    toc               I: frame type and Q bit of RTP payload frame, as in
+ *                         storage format header, or -1 for octet frame
+ *    offset            I: bit of bits RTP payload frame starts at
+ *    prm               O: AMR parameters
+ *    frame_type        O: frame type
+ *    speech_mode       O: speech mode of SID frame
+ *    q_bit             O: frame quality indicator
+ *
+ * Function:
+ *    Frame to parameters, as the frame has them. Depends on no state,
+ *    see Decoder_Interface_frame_type for what does
+ *
+ * Returns:
+ *    AMR mode
+ */
+static enum Mode Decoder_Interface_parse( Word32 format, UWord8 *bits, Word16
+      *serial, int toc, Word32 offset, Word16 *prm, enum RXFrameType
+      *frame_type, enum Mode *speech_mode, Word16 *q_bit )
+{
+   *speech_mode = MR475;
+
+   /*
+    * extract mode information and frametype,
+    * octets to parameters
+    */
+   *q_bit = 1;
+
+#ifndef DEC_SMALL
+   if ( serial != NULL )
+      return DecoderETSI( prm, serial, frame_type, speech_mode );
+   if ( toc < 0 && format == DEC_FORMAT_IF2 )
+      return Decoder3GPP( prm, bits, frame_type, speech_mode );
+#else
+   ( void )format;
+   ( void )serial;
+#endif
+   if ( toc >= 0 )
+      return Decoder_bits( prm, ( UWord8 )toc, bits, offset, frame_type,
+            speech_mode, q_bit );
+   return DecoderMMS( prm, bits, frame_type, speech_mode, q_bit );
+}
+
+
+/*
+ * Decoder_Interface_frame_type
+ *
+ *
+ * Parameters:
+ *    s                 I: state structure
+ *    mode              I: AMR mode of the frame
+ *    speech_mode       I: speech mode of SID frame
+ *    q_bit             I: frame quality indicator
+ *    bfi               I: bad frame indicator
+ *    frame_type        B: frame type
+ *
+ * Function:
+ *    Mode and frame type the decoder is to take, for a frame parsed by
+ *    Decoder_Interface_parse: bad frames, and frames without mode,
+ *    take them from the previous frame
+ *
+ * Returns:
+ *    AMR mode
+ */
+static enum Mode Decoder_Interface_frame_type( dec_interface_State *s, enum
+      Mode mode, enum Mode speech_mode, Word16 q_bit, int bfi, enum
+      RXFrameType *frame_type )
+{
+   if (!bfi)	bfi = 1 - q_bit;
+
+   if ( bfi == 1 ) {
+      if ( mode <= MR122 ) {
+         *frame_type = RX_SPEECH_BAD;
+      }
+      else if ( *frame_type != RX_NO_DATA ) {
+         *frame_type = RX_SID_BAD;
+         mode = s->prev_mode;
+      }
+   } else {
+       if ( *frame_type == RX_SID_FIRST || *frame_type == RX_SID_UPDATE) {
+           mode = speech_mode;
+       }
+       else if ( *frame_type == RX_NO_DATA ) {
+           mode = s->prev_mode;
+       }
+       /*
+        * if no mode information
+        * guess one from the previous frame
+        */
+       if ( *frame_type == RX_SPEECH_BAD ) {
+          mode = s->prev_mode;
+          if ( s->prev_ft >= RX_SID_FIRST ) {
+             *frame_type = RX_SID_BAD;
+          }
+       }
+   }
+   return mode;
+}
+
+
+/*
+ * Decoder_Interface_unpack
+ *
+ *
+ * Parameters:
+ *    s                 B: state structure
+ *    bits              I: bit stream
+ *    serial            I: ETSI serial frame, or NULL to decode bits
+ *    toc               I: frame type and Q bit of RTP payload frame, as in
+ *                         storage format header, or -1 for octet frame
+ *    offset            I: bit of bits RTP payload frame starts at
+ *    bfi               I: bad frame indicator
+ *    prm               O: AMR parameters
+ *    frame_type        O: frame type
+ *
+ * Function:
+ *    Frame to parameters, with mode and frame type the decoder is to
+ *    take, see Decoder_Interface_Decode_any
+ *
+ * Returns:
+ *    AMR mode
+ */
+static enum Mode Decoder_Interface_unpack( dec_interface_State *s, UWord8
+      *bits, Word16 *serial, int toc, Word32 offset, int bfi, Word16 *prm,
+      enum RXFrameType *frame_type )
+{
+   enum Mode mode;   /* AMR mode */
+   enum Mode speech_mode;   /* speech mode */
+   Word16 q_bit;
+
+#ifdef DEC_PROFILE
+   unsigned long long t0;
+
+
+   t0 = Speech_Decode_Frame_cycles( );
+#endif
+   DEC_TRACE_BEGIN( "Unpack" );
+   mode = Decoder_Interface_parse( s->format, bits, serial, toc, offset, prm,
+         frame_type, &speech_mode, &q_bit );
+   mode = Decoder_Interface_frame_type( s, mode, speech_mode, q_bit, bfi,
+         frame_type );
+   DEC_TRACE_END( "Unpack" );
+#ifdef DEC_PROFILE
+   Speech_Decode_Frame_profile( s->decoder_State )->cycles[DEC_PROFILE_MODE(
+         mode )][*frame_type][STAGE_UNPACK] += Speech_Decode_Frame_cycles( ) -
+         t0;
+#endif
+   return mode;
+}
+
+
+/*
+ * Decoder_Interface_homing_first
+ *
+ *
+ * Parameters:
+ *    s                 I: state structure
+ *    prm               I: AMR parameters
+ *    mode              I: AMR mode
+ *
+ * Function:
+ *    Test for homing frame after a homing frame, which is output as
+ *    such instead of decoded
+ *
+ * Returns:
+ *    0 if frame is output as homing frame, 1 otherwise
+ */
+static Word32 Decoder_Interface_homing_first( dec_interface_State *s, Word16
+      *prm, enum Mode mode )
+{
+   if ( ( s->reset_flag_old == 1 ) & ( s->homing != 0 ) )
+      return Homing_test( prm, mode, 1 ) != 0;
+   return 1;
+}
+
+
+/*
+ * Decoder_Interface_homing_last
+ *
+ *
+ * Parameters:
+ *    s                 B: state structure
+ *    prm               I: AMR parameters
+ *    mode              I: AMR mode
+ *    frame_type        I: frame type
+ *    resetFlag         I: result of Decoder_Interface_homing_first
+ *
+ * Function:
+ *    Test for homing frame after a decoded frame, reset of decoder on
+ *    homing frames, and state of the frame for the next one
+ *
+ * Returns:
+ *    Void
+ */
+static void Decoder_Interface_homing_last( dec_interface_State *s, Word16
+      *prm, enum Mode mode, enum RXFrameType frame_type, Word32 resetFlag )
+{
+   if ( ( s->reset_flag_old == 0 ) & ( s->homing != 0 ) ) {
+      /* check whole frame */
+      resetFlag = Homing_test( prm, mode, 0 );
+   }
+
+   /* reset decoder if current frame is a homing frame */
+   if ( resetFlag == 0 ) {
+      Speech_Decode_Frame_reset( s->decoder_State );
+   }
+   s->reset_flag_old = !resetFlag;
+   s->prev_ft = frame_type;
+   s->prev_mode = mode;
+}
+
+
+/*
+ * Decoder_Interface_synth
+ *
+ *
+ * Parameters:
+ *    s                 B: state structure
+ *    prm               I: AMR parameters
+ *    mode              I: AMR mode
+ *    frame_type        I: frame type
+ *    synth             O: synthesized speech, or NULL
+ *    synth_float       O: synthesized speech as floating point, or NULL
+ *    stride            I: distance of floating point output samples
+ *
+ * Function:
+ *    Decode parameters of a frame to synthesized speech, to whichever of
+ *    the output buffers is given, minding homing frames. With neither,
+ *    frame is decoded only for the state it leaves, see
+ *    Speech_Decode_Frame_warmup
+ *
+ * Returns:
+ *    Void
+ */
+static void Decoder_Interface_synth( dec_interface_State *s, Word16 *prm,
+      enum Mode mode, enum RXFrameType frame_type, Word16 *synth, Float32
+      *synth_float, int stride )
+{
+   Word32 i;   /* counter */
+   Word32 resetFlag;   /* homing frame */
 
-         if ( j % 8 )
-            *stream >>= 1;
-         else
-            stream++;
-      }
-      *frame_type = RX_SPEECH_GOOD;
-   }
-   else if ( mode == MR59 ) {
-      mask = order_MR59;
 
-      for ( j = 5; j < 123; j++ ) {
-         if ( *stream & 0x1 )
-            param[ * mask] = ( short )( param[ * mask] + *( mask + 1 ) );
-         mask += 2;
+   /* test for homing frame */
+   resetFlag = Decoder_Interface_homing_first( s, prm, mode );
 
-         if ( j % 8 )
-            *stream >>= 1;
-         else
-            stream++;
+   if ( ( resetFlag == 0 ) && ( s->reset_flag_old != 0 ) ) {
+      if ( synth_float != NULL ) {
+         for ( i = 0; i < 160; i++ ) {
+            synth_float[i * stride] = EHF_MASK * ( 1.0F / 32768.0F ) * s->gain;
+         }
+      }
+      else if ( synth != NULL ) {
+         for ( i = 0; i < 160; i++ ) {
+            synth[i] = EHF_MASK;
+         }
       }
-      *frame_type = RX_SPEECH_GOOD;
    }
-   else if ( mode == MR67 ) {
-      mask = order_MR67;
+   else if ( synth_float != NULL && stride != 1 )
+      Speech_Decode_Frame_float_stride( s->decoder_State, mode, prm,
+            frame_type, synth_float, stride );
+   else if ( synth_float != NULL )
+      Speech_Decode_Frame_float( s->decoder_State, mode, prm, frame_type, synth_float );
+   else if ( synth != NULL )
+      Speech_Decode_Frame( s->decoder_State, mode, prm, frame_type, synth );
+   else
+      Speech_Decode_Frame_warmup( s->decoder_State, mode, prm, frame_type );
+   Decoder_Interface_homing_last( s, prm, mode, frame_type, resetFlag );
+}
 
-      for ( j = 5; j < 139; j++ ) {
-         if ( *stream & 0x1 )
-            param[ * mask] = ( short )( param[ * mask] + *( mask + 1 ) );
-         mask += 2;
 
-         if ( j % 8 )
-            *stream >>= 1;
-         else
-            stream++;
-      }
-      *frame_type = RX_SPEECH_GOOD;
-   }
-   else if ( mode == MR74 ) {
-      mask = order_MR74;
+/*
+ * Decoder_Interface_Decode_any
+ *
+ *
+ * Parameters:
+ *    st                B: state structure
+ *    bits              I: bit stream
+ *    serial            I: ETSI serial frame, or NULL to decode bits
+ *    toc               I: frame type and Q bit of RTP payload frame, as in
+ *                         storage format header, or -1 for octet frame
+ *    offset            I: bit of bits RTP payload frame starts at
+ *    synth             O: synthesized speech, or NULL
+ *    synth_float       O: synthesized speech as floating point, or NULL
+ *    stride            I: distance of floating point output samples
+ *    bfi               I: bad frame indicator
+ *
+ * Function:
+ *    Decode bit stream to synthesized speech, to whichever of the
+ *    output buffers is given. Frame is octet frame of the format set by
+ *    Decoder_Interface_set_format, with its header, unless toc is given
+ *
+ * Returns:
+ *    Void
+ */
+static void Decoder_Interface_Decode_any( void *st, UWord8 *bits,
+      Word16 *serial, int toc, Word32 offset, Word16 *synth, Float32
+      *synth_float, int stride, int bfi)
+{
+   enum Mode mode;   /* AMR mode */
 
-      for ( j = 5; j < 153; j++ ) {
-         if ( *stream & 0x1 )
-            param[ * mask] = ( short )( param[ * mask] + *( mask + 1 ) );
-         mask += 2;
+   Word16 prm[PRMNO_MR122];   /* AMR parameters */
 
-         if ( j % 8 )
-            *stream >>= 1;
-         else
-            stream++;
-      }
-      *frame_type = RX_SPEECH_GOOD;
-   }
-   else if ( mode == MR795 ) {
-      mask = order_MR795;
+   enum RXFrameType frame_type;   /* frame type */
+   dec_interface_State * s;   /* pointer to structure */
 
-      for ( j = 5; j < 164; j++ ) {
-         if ( *stream & 0x1 )
-            param[ * mask] = ( short )( param[ * mask] + *( mask + 1 ) );
-         mask += 2;
 
-         if ( j % 8 )
-            *stream >>= 1;
-         else
-            stream++;
-      }
-      *frame_type = RX_SPEECH_GOOD;
-   }
-   else if ( mode == MR102 ) {
-      mask = order_MR102;
+   s = ( dec_interface_State * )st;
+   mode = Decoder_Interface_unpack( s, bits, serial, toc, offset, bfi, prm,
+         &frame_type );
+   Speech_Decode_Frame_prefetch( mode, prm, frame_type );
+   Decoder_Interface_synth( s, prm, mode, frame_type, synth, synth_float,
+         stride );
+}
 
-      for ( j = 5; j < 209; j++ ) {
-         if ( *stream & 0x1 )
-            param[ * mask] = ( short )( param[ * mask] + *( mask + 1 ) );
-         mask += 2;
 
-         if ( j % 8 )
-            *stream >>= 1;
-         else
-            stream++;
+/*
+ * Decoder_Interface_Decode
+ *
+ *
+ * Parameters:
+ *    st                B: state structure
+ *    bits              I: bit stream
+ *    synth             O: synthesized speech
+ *    bfi               I: bad frame indicator
+ *
+ * Function:
+ *    Decode bit stream to synthesized speech. ETSI builds take serial
+ *    frame, as Decoder_Interface_Decode_serial does
+ *
+ * Returns:
+ *    Void
+ */
+void Decoder_Interface_Decode( void *st,
+
+#ifndef ETSI
+      UWord8 *bits,
+
+#else
+      Word16 *bits,
+#endif
+
+      Word16 *synth, int bfi)
+{
+#ifndef ETSI
+   Decoder_Interface_Decode_any( st, bits, NULL, -1, 0, synth, NULL, 1, bfi );
+#else
+   Decoder_Interface_Decode_any( st, NULL, bits, -1, 0, synth, NULL, 1, 0 );
+#endif
+}
+
+
+/*
+ * Decoder_Interface_Decode_float
+ *
+ *
+ * Parameters:
+ *    st                B: state structure
+ *    bits              I: bit stream
+ *    synth             O: synthesized speech, scaled to [-1, 1)
+ *    bfi               I: bad frame indicator
+ *
+ * Function:
+ *    Decode bit stream to synthesized speech in floating point,
+ *    without going through 16-bit integer output buffer
+ *
+ * Returns:
+ *    Void
+ */
+void Decoder_Interface_Decode_float( void *st,
+
+#ifndef ETSI
+      UWord8 *bits,
+
+#else
+      Word16 *bits,
+#endif
+
+      Float32 *synth, int bfi)
+{
+#ifndef ETSI
+   Decoder_Interface_Decode_any( st, bits, NULL, -1, 0, NULL, synth, 1, bfi );
+#else
+   Decoder_Interface_Decode_any( st, NULL, bits, -1, 0, NULL, synth, 1, 0 );
+#endif
+}
+
+
+/*
+ * Decoder_Interface_Decode_float_stride
+ *
+ *
+ * Parameters:
+ *    st                B: state structure
+ *    bits              I: bit stream
+ *    synth             O: synthesized speech, scaled to [-1, 1)
+ *    stride            I: distance of output samples in synth
+ *    bfi               I: bad frame indicator
+ *
+ * Function:
+ *    Same as Decoder_Interface_Decode_float, storing every stride-th
+ *    sample, so that decoders of several channels write interleaved
+ *    output without going through a buffer of each channel
+ *
+ * Returns:
+ *    Void
+ */
+void Decoder_Interface_Decode_float_stride( void *st, UWord8 *bits,
+      Float32 *synth, int stride, int bfi )
+{
+   Decoder_Interface_Decode_any( st, bits, NULL, -1, 0, NULL, synth, stride,
+         bfi );
+}
+
+
+/*
+ * Decoder_Interface_Decode_group_float
+ *
+ *
+ * Parameters:
+ *    st                B: state structures, one per stream
+ *    count             I: streams
+ *    bits              I: bit stream of each
+ *    synth             O: synthesized speech of each, scaled to [-1, 1)
+ *    stride            I: distance of output samples in synth
+ *    bfi               I: bad frame indicator
+ *
+ * Function:
+ *    Same as Decoder_Interface_Decode_float_stride of each stream in
+ *    turn, such as channels of one file. Streams are independent, and
+ *    go through Speech_Decode_Frame_group_float together, a few at a
+ *    time
+ *
+ * Returns:
+ *    Void
+ */
+void Decoder_Interface_Decode_group_float( void *st[], int count, UWord8
+      *bits[], Float32 *synth[], int stride, int bfi )
+{
+   Word16 prm[DEC_GROUP][PRMNO_MR122];   /* AMR parameters */
+   enum Mode mode[DEC_GROUP];
+   enum RXFrameType frame_type[DEC_GROUP];
+   Word32 resetFlag[DEC_GROUP];
+
+   /* streams decoded, the others output homing frame */
+   void *decoder[DEC_GROUP];
+   Word16 *parm[DEC_GROUP];
+   enum Mode dec_mode[DEC_GROUP];
+   enum RXFrameType dec_frame_type[DEC_GROUP];
+   Float32 *out[DEC_GROUP];
+   dec_interface_State * s;
+   Word32 i, j, k, n, first;
+
+
+   for ( first = 0; first < count; first += DEC_GROUP ) {
+      n = count - first < DEC_GROUP ? count - first : DEC_GROUP;
+
+      for ( j = 0, k = 0; j < n; j++ ) {
+         s = ( dec_interface_State * )st[first + j];
+         mode[j] = Decoder_Interface_unpack( s, bits[first + j], NULL, -1, 0,
+               bfi, prm[j], &frame_type[j] );
+         Speech_Decode_Frame_prefetch( mode[j], prm[j], frame_type[j] );
+         resetFlag[j] = Decoder_Interface_homing_first( s, prm[j], mode[j] );
+
+         if ( ( resetFlag[j] == 0 ) && ( s->reset_flag_old != 0 ) ) {
+            for ( i = 0; i < 160; i++ )
+               synth[first + j][i * stride] = EHF_MASK * ( 1.0F / 32768.0F ) *
+                     s->gain;
+            continue;
+         }
+
+         decoder[k] = s->decoder_State;
+         parm[k] = prm[j];
+         dec_mode[k] = mode[j];
+         dec_frame_type[k] = frame_type[j];
+         out[k++] = synth[first + j];
       }
-      *frame_type = RX_SPEECH_GOOD;
+      Speech_Decode_Frame_group_float( decoder, k, dec_mode, parm,
+            dec_frame_type, out, stride );
+
+      for ( j = 0; j < n; j++ )
+         Decoder_Interface_homing_last( ( dec_interface_State * )st[first + j],
+               prm[j], mode[j], frame_type[j], resetFlag[j] );
    }
-   else if ( mode == MR122 ) {
-      mask = order_MR122;
+}
+
+
+/*
+ * Decoder_Interface_Warmup
+ *
+ *
+ * Parameters:
+ *    st                B: state structure
+ *    bits              I: bit stream
+ *    bfi               I: bad frame indicator
+ *
+ * Function:
+ *    Decode bit stream for the state it leaves, with no output, see
+ *    Speech_Decode_Frame_warmup
+ *
+ * Returns:
+ *    Void
+ */
+void Decoder_Interface_Warmup( void *st, UWord8 *bits, int bfi )
+{
+   Decoder_Interface_Decode_any( st, bits, NULL, -1, 0, NULL, NULL, 1, bfi );
+}
+
+
+#ifndef DEC_SMALL
+/*
+ * Decoder_Interface_Decode_serial
+ *
+ *
+ * Parameters:
+ *    st                B: state structure
+ *    serial            I: ETSI serial frame, frame type, 244 bits, one
+ *                         per word, and mode
+ *    synth             O: synthesized speech
+ *
+ * Function:
+ *    Decode frame of ETSI test vector format to synthesized speech
+ *
+ * Returns:
+ *    Void
+ */
+void Decoder_Interface_Decode_serial( void *st, Word16 *serial, Word16 *synth )
+{
+   Decoder_Interface_Decode_any( st, NULL, serial, -1, 0, synth, NULL, 1, 0 );
+}
+
+
+/*
+ * Decoder_Interface_Decode_serial_float
+ *
+ *
+ * Parameters:
+ *    st                B: state structure
+ *    serial            I: ETSI serial frame, frame type, 244 bits, one
+ *                         per word, and mode
+ *    synth             O: synthesized speech, scaled to [-1, 1)
+ *
+ * Function:
+ *    Same as Decoder_Interface_Decode_serial, for floating point output
+ *
+ * Returns:
+ *    Void
+ */
+void Decoder_Interface_Decode_serial_float( void *st, Word16 *serial,
+      Float32 *synth )
+{
+   Decoder_Interface_Decode_any( st, NULL, serial, -1, 0, NULL, synth, 1, 0 );
+}
+#endif
+
+
+/*
+ * Octet frame length of each frame type in format of st, frame type
+ * reserved for future use has just the header
+ */
+static Word32 Frame_length( const dec_interface_State *st, UWord8 header )
+{
+#ifndef DEC_SMALL
+   if ( st->format == DEC_FORMAT_IF2 )
+      return block_size_if2[header & 0x0F];
+#else
+   ( void )st;
+#endif
+   return 1 + Decoder_Interface_block_size[( header >> 3 ) & 0x0F];
+}
+
+
+/*
+ * Decoder_Interface_UnpackN
+ *
+ *
+ * Parameters:
+ *    st                I: state structure, only its format is read
+ *    bits              I: consecutive frames of bit stream
+ *    size              I: number of bytes in bits
+ *    out               O: unpacked frames
+ *    frames            I: maximum number of frames to unpack
+ *    used              O: number of bytes unpacked, or NULL
+ *
+ * Function:
+ *    First stage of Decoder_Interface_DecodeN: frames one after another,
+ *    as long as whole frame is left in bits, to parameters as the frames
+ *    have them. Nothing of decoder state goes into that, so frames can
+ *    be unpacked well ahead of decoding, on any thread
+ *
+ * Returns:
+ *    number of frames unpacked
+ */
+int Decoder_Interface_UnpackN( const void *st, UWord8 *bits, int size, struct
+      Dec_frame *out, int frames, int *used )
+{
+   const dec_interface_State *s = ( const dec_interface_State * )st;
+   enum Mode mode, speech_mode;
+   enum RXFrameType frame_type;
+   Word16 q_bit;
+   int n, pos, length;   /* frames and bytes unpacked, frame size */
+#ifdef DEC_PROFILE
+   unsigned long long t0;
+#endif
+
+
+   pos = 0;
+   DEC_TRACE_BEGIN( "UnpackN" );
+
+   for ( n = 0; n < frames; n++ ) {
+      if ( pos >= size )
+         break;
+      length = Frame_length( s, bits[pos] );
 
-      for ( j = 5; j < 249; j++ ) {
-         if ( *stream & 0x1 )
-            param[ * mask] = ( short )( param[ * mask] + *( mask + 1 ) );
-         mask += 2;
+      /* reserved frame types have just the header */
+      if ( length == 0 )
+         length = 1;
 
-         if ( j % 8 )
-            *stream >>= 1;
-         else
-            stream++;
-      }
-      *frame_type = RX_SPEECH_GOOD;
+      if ( length > size - pos )
+         break;
+#ifdef DEC_PROFILE
+      t0 = Speech_Decode_Frame_cycles( );
+#endif
+      mode = Decoder_Interface_parse( s->format, bits + pos, NULL, -1, 0,
+            out[n].prm, &frame_type, &speech_mode, &q_bit );
+      out[n].mode = ( UWord8 )mode;
+      out[n].speech_mode = ( UWord8 )speech_mode;
+      out[n].frame_type = ( UWord8 )frame_type;
+      out[n].q_bit = ( UWord8 )q_bit;
+#ifdef DEC_PROFILE
+      out[n].cycles = Speech_Decode_Frame_cycles( ) - t0;
+#endif
+      pos += length;
    }
-   else
-      *frame_type = RX_SPEECH_BAD;
-   return mode;
+   DEC_TRACE_END( "UnpackN" );
+
+   if ( used != NULL )
+      *used = pos;
+   return n;
 }
+
+
+/*
+ * Decoder_Interface_SynthN_any
+ *
+ *
+ * Parameters:
+ *    st                B: state structure
+ *    in                I: frames unpacked by Decoder_Interface_UnpackN;
+ *                         parameters are changed
+ *    frames            I: number of frames
+ *    synth             O: synthesized speech, or NULL
+ *    synth_float       O: synthesized speech as floating point, or NULL
+ *
+ * Function:
+ *    Second stage of Decoder_Interface_DecodeN: decode unpacked frames
+ *    to whichever of the output buffers is given
+ *
+ * Returns:
+ *    Void
+ */
+static void Decoder_Interface_SynthN_any( void *st, struct Dec_frame *in, int
+      frames, Word16 *synth, Float32 *synth_float )
+{
+   dec_interface_State *s = ( dec_interface_State * )st;
+   enum Mode mode;
+   enum RXFrameType frame_type;
+   Word32 n;
+
+
+   if ( frames > 0 )
+      Speech_Decode_Frame_prefetch( ( enum Mode )in[0].mode, in[0].prm, (
+            enum RXFrameType )in[0].frame_type );
+
+   for ( n = 0; n < frames; n++ ) {
+      /* tables of the next frame come in while this one is synthesized */
+      if ( n + 1 < frames )
+         Speech_Decode_Frame_prefetch( ( enum Mode )in[n + 1].mode, in[n + 1].
+               prm, ( enum RXFrameType )in[n + 1].frame_type );
+      frame_type = ( enum RXFrameType )in[n].frame_type;
+      mode = Decoder_Interface_frame_type( s, ( enum Mode )in[n].mode, ( enum
+            Mode )in[n].speech_mode, in[n].q_bit, 0, &frame_type );
+#ifdef DEC_PROFILE
+      Speech_Decode_Frame_profile( s->decoder_State )->cycles[
+            DEC_PROFILE_MODE( mode )][frame_type][STAGE_UNPACK] += in[n].cycles;
 #endif
-#endif
+      Decoder_Interface_synth( s, in[n].prm, mode, frame_type, synth == NULL ?
+            NULL : synth + n * 160, synth_float == NULL ? NULL : synth_float +
+            n * 160, 1 );
+   }
+}
+
 
 /*
- * Decoder_Interface_reset
+ * Decoder_Interface_SynthN
  *
  *
  * Parameters:
- *    st                O: state struct
+ *    st                B: state structure
+ *    in                I: frames unpacked by Decoder_Interface_UnpackN
+ *    frames            I: number of frames
+ *    synth             O: synthesized speech, 160 samples per frame
  *
  * Function:
- *    Reset homing frame counter
+ *    Second stage of Decoder_Interface_DecodeN
  *
  * Returns:
- *    void
+ *    Void
  */
-void Decoder_Interface_reset( dec_interface_State *st )
+void Decoder_Interface_SynthN( void *st, struct Dec_frame *in, int frames,
+      Word16 *synth )
 {
-   st->reset_flag_old = 1;
-   st->prev_ft = RX_SPEECH_GOOD;
-   st->prev_mode = MR475;   /* minimum bitrate */
+   Decoder_Interface_SynthN_any( st, in, frames, synth, NULL );
 }
 
 
 /*
- * Decoder_Interface_init
+ * Decoder_Interface_SynthN_float
  *
  *
  * Parameters:
- *    void
+ *    st                B: state structure
+ *    in                I: frames unpacked by Decoder_Interface_UnpackN
+ *    frames            I: number of frames
+ *    synth             O: synthesized speech, scaled to [-1, 1),
+ *                         160 samples per frame
  *
  * Function:
- *    Allocates state memory and initializes state memory
+ *    Same as Decoder_Interface_SynthN, for floating point output
  *
  * Returns:
- *    success           : pointer to structure
- *    failure           : NULL
+ *    Void
  */
-void * Decoder_Interface_init( void )
+void Decoder_Interface_SynthN_float( void *st, struct Dec_frame *in, int
+      frames, Float32 *synth )
 {
-   dec_interface_State * s;
+   Decoder_Interface_SynthN_any( st, in, frames, NULL, synth );
+}
 
-   /* allocate memory */
-   if ( ( s = ( dec_interface_State * ) malloc( sizeof( dec_interface_State ) ) ) ==
-         NULL ) {
-      fprintf( stderr, "Decoder_Interface_init: "
-            "can not malloc state structure\n" );
-      return NULL;
-   }
-   s->decoder_State = Speech_Decode_Frame_init( );
 
-   if ( s->decoder_State == NULL ) {
-      free( s );
-      return NULL;
+/*
+ * Decoder_Interface_DecodeN_any
+ *
+ *
+ * Parameters:
+ *    st                B: state structure
+ *    bits              I: consecutive frames of bit stream
+ *    size              I: number of bytes in bits
+ *    synth             O: synthesized speech, or NULL
+ *    synth_float       O: synthesized speech as floating point, or NULL
+ *    frames            I: maximum number of frames to decode
+ *    used              O: number of bytes decoded, or NULL
+ *
+ * Function:
+ *    Decode frames one after another, as long as whole frame is left in
+ *    bits, to whichever of the output buffers is given. Frames are
+ *    unpacked DEC_PIPE at a time, then decoded, so that unpacking runs
+ *    in a loop of its own
+ *
+ * Returns:
+ *    number of frames decoded
+ */
+static int Decoder_Interface_DecodeN_any( void *st, UWord8 *bits, int size,
+      Word16 *synth, Float32 *synth_float, int frames, int *used )
+{
+   struct Dec_frame in[DEC_PIPE];
+   int n, k, chunk, pos, length;   /* frames and bytes decoded */
+
+
+   n = 0;
+   pos = 0;
+
+   while ( n < frames ) {
+      chunk = frames - n < DEC_PIPE ? frames - n : DEC_PIPE;
+      k = Decoder_Interface_UnpackN( st, bits + pos, size - pos, in, chunk,
+            &length );
+      Decoder_Interface_SynthN_any( st, in, k, synth == NULL ? NULL : synth + n
+            * 160, synth_float == NULL ? NULL : synth_float + n * 160 );
+      n += k;
+      pos += length;
+
+      if ( k < chunk )
+         break;
    }
-   Decoder_Interface_reset( s );
-   return s;
+
+   if ( used != NULL )
+      *used = pos;
+   return n;
 }
 
 
 /*
- * Decoder_Interface_exit
+ * Decoder_Interface_DecodeN
  *
  *
  * Parameters:
- *    state                I: state structure
+ *    st                B: state structure
+ *    bits              I: consecutive frames of bit stream
+ *    size              I: number of bytes in bits
+ *    synth             O: synthesized speech, 160 samples per frame
+ *    frames            I: maximum number of frames to decode
+ *    used              O: number of bytes decoded, or NULL
  *
  * Function:
- *    The memory used for state memory is freed
+ *    Decode up to frames frames of bit stream to synthesized speech;
+ *    frame cut off by the end of bits is left alone
  *
  * Returns:
- *    Void
+ *    number of frames decoded
  */
-void Decoder_Interface_exit( void *state )
+int Decoder_Interface_DecodeN( void *st, UWord8 *bits, int size, Word16 *synth,
+      int frames, int *used )
 {
-   dec_interface_State * s;
-   s = ( dec_interface_State * )state;
+   return Decoder_Interface_DecodeN_any( st, bits, size, synth, NULL, frames,
+         used );
+}
 
-   /* free memory */
-   Speech_Decode_Frame_exit(s->decoder_State );
-   free( s );
-   s = NULL;
-   state = NULL;
+
+/*
+ * Decoder_Interface_DecodeN_float
+ *
+ *
+ * Parameters:
+ *    st                B: state structure
+ *    bits              I: consecutive frames of bit stream
+ *    size              I: number of bytes in bits
+ *    synth             O: synthesized speech, scaled to [-1, 1),
+ *                         160 samples per frame
+ *    frames            I: maximum number of frames to decode
+ *    used              O: number of bytes decoded, or NULL
+ *
+ * Function:
+ *    Same as Decoder_Interface_DecodeN, for floating point output
+ *
+ * Returns:
+ *    number of frames decoded
+ */
+int Decoder_Interface_DecodeN_float( void *st, UWord8 *bits, int size,
+      Float32 *synth, int frames, int *used )
+{
+   return Decoder_Interface_DecodeN_any( st, bits, size, NULL, synth, frames,
+         used );
 }
+#ifndef DEC_SMALL
 
 
 /*
- * Decoder_Interface_Decode
+ * Decoder_Interface_Decode_g711
  *
  *
  * Parameters:
  *    st                B: state structure
  *    bits              I: bit stream
- *    synth             O: synthesized speech
+ *    out               O: G.711 code of each synthesized sample
+ *    law               I: DEC_G711_ALAW or DEC_G711_ULAW
  *    bfi               I: bad frame indicator
  *
  * Function:
- *    Decode bit stream to synthesized speech
+ *    Decode bit stream to synthesized speech, and code it by g711_codes
+ *    while it's in cache. Gain of Decoder_Interface_set_gain
+ *    does not apply, as to other 16-bit output
  *
  * Returns:
  *    Void
  */
-void Decoder_Interface_Decode( void *st,
+void Decoder_Interface_Decode_g711( void *st, UWord8 *bits, UWord8 *out,
+      int law, int bfi )
+{
+   Word16 synth[160];
 
-#ifndef ETSI
-      UWord8 *bits,
 
-#else
-      Word16 *bits,
-#endif
+   Decoder_Interface_Decode_any( st, bits, NULL, -1, 0, synth, NULL, 1, bfi );
+   Encode_G711( synth, out, law );
+}
 
-      Word16 *synth, int bfi)
+
+/*
+ * Decoder_Interface_DecodeN_g711
+ *
+ *
+ * Parameters:
+ *    st                B: state structure
+ *    bits              I: consecutive frames of bit stream
+ *    size              I: number of bytes in bits
+ *    out               O: G.711 code of each synthesized sample,
+ *                         160 per frame
+ *    law               I: DEC_G711_ALAW or DEC_G711_ULAW
+ *    frames            I: maximum number of frames to decode
+ *    used              O: number of bytes decoded, or NULL
+ *
+ * Function:
+ *    Same as Decoder_Interface_DecodeN, for G.711 output. Frames are
+ *    unpacked DEC_PIPE at a time, and each is coded right after it's
+ *    synthesized to a buffer of one frame
+ *
+ * Returns:
+ *    number of frames decoded
+ */
+int Decoder_Interface_DecodeN_g711( void *st, UWord8 *bits, int size,
+      UWord8 *out, int law, int frames, int *used )
 {
-   enum Mode mode;   /* AMR mode */
+   struct Dec_frame in[DEC_PIPE];
+   Word16 synth[160];
+   int n, j, k, chunk, pos, length;   /* frames and bytes decoded */
 
-#ifndef ETSI
-   enum Mode speech_mode = MR475;   /* speech mode */
-#endif
 
-   Word16 prm[PRMNO_MR122];   /* AMR parameters */
+   n = 0;
+   pos = 0;
 
-   enum RXFrameType frame_type;   /* frame type */
-   dec_interface_State * s;   /* pointer to structure */
+   while ( n < frames ) {
+      chunk = frames - n < DEC_PIPE ? frames - n : DEC_PIPE;
+      k = Decoder_Interface_UnpackN( st, bits + pos, size - pos, in, chunk,
+            &length );
 
-   const Word16 *homing;   /* pointer to homing frame */
-   Word16 homingSize;   /* frame size for homing frame */
-   Word32 i;   /* counter */
-   Word32 resetFlag = 1;   /* homing frame */
+      for ( j = 0; j < k; j++ ) {
+         Decoder_Interface_SynthN_any( st, in + j, 1, synth, NULL );
+         Encode_G711( synth, out + ( n + j ) * 160, law );
+      }
+      n += k;
+      pos += length;
 
-#ifndef ETSI
-#ifndef IF2
-   Word16 q_bit;
-#endif
-#endif
+      if ( k < chunk )
+         break;
+   }
 
-   s = ( dec_interface_State * )st;
+   if ( used != NULL )
+      *used = pos;
+   return n;
+}
 
-#ifndef ETSI
 
-   /*
-    * extract mode information and frametype,
-    * octets to parameters
-    */
-#ifdef IF2
-   mode = Decoder3GPP( prm, bits, &frame_type, &speech_mode );
-#else
-   mode = DecoderMMS( prm, bits, &frame_type, &speech_mode, &q_bit );
-   if (!bfi)	bfi = 1 - q_bit;
-#endif
+/*
+ * Decoder_Interface_Code_g711
+ *
+ *
+ * Parameters:
+ *    synth             I: 16-bit samples, as decoders output them
+ *    out               O: G.711 code of each sample
+ *    samples           I: number of samples
+ *    law               I: DEC_G711_ALAW or DEC_G711_ULAW
+ *
+ * Function:
+ *    Codes samples decoded before by g711_codes, so output decoded once
+ *    can be had in more than one format. Tables are constant, so it can
+ *    be called before any decoder is created
+ *
+ * Returns:
+ *    Void
+ */
+void Decoder_Interface_Code_g711( const short *synth, unsigned char *out,
+      int samples, int law )
+{
+   const UWord8 *codes = g711_codes[law != DEC_G711_ALAW];
+   int i;
 
-   if ( bfi == 1 ) {
-      if ( mode <= MR122 ) {
-         frame_type = RX_SPEECH_BAD;
-      }
-      else if ( frame_type != RX_NO_DATA ) {
-         frame_type = RX_SID_BAD;
-         mode = s->prev_mode;
-      }
-   } else {
-       if ( frame_type == RX_SID_FIRST || frame_type == RX_SID_UPDATE) {
-           mode = speech_mode;
-       }
-       else if ( frame_type == RX_NO_DATA ) {
-           mode = s->prev_mode;
-       }
-       /*
-        * if no mode information
-        * guess one from the previous frame
-        */
-       if ( frame_type == RX_SPEECH_BAD ) {
-          mode = s->prev_mode;
-          if ( s->prev_ft >= RX_SID_FIRST ) {
-             frame_type = RX_SID_BAD;
-          }
-       }
-   }
-#else
-   bfi = 0;
-   frame_type = bits[0];
 
-   switch ( frame_type ) {
-      case 0:
-         frame_type = RX_SPEECH_GOOD;
-         mode = bits[245];
-         Bits2Prm( mode, &bits[1], prm );
-         break;
+   for ( i = 0; i < samples; i++ )
+      out[i] = codes[( synth[i] >> 3 ) + 4096];
+}
+#endif
 
-      case 1:
-         frame_type = RX_SID_FIRST;
-         mode = bits[245];
-         break;
+/*
+ * Decoder_Interface_DecodeRTP
+ *
+ *
+ * Parameters:
+ *    st                B: state structure
+ *    toc               I: table of contents entry of the frame, frame type
+ *                         and Q bit where storage format header has them
+ *    bits              I: RTP payload, or part of it
+ *    offset            I: bit of bits the frame starts at, from MSB of
+ *                         the first octet
+ *    synth             O: synthesized speech
+ *
+ * Function:
+ *    Decode frame of RTP payload (RFC 4867) in place, octet-aligned or
+ *    bandwidth-efficient, without repacking it to storage format
+ *
+ * Returns:
+ *    Void
+ */
+void Decoder_Interface_DecodeRTP( void *st, int toc, UWord8 *bits,
+      int offset, Word16 *synth )
+{
+   Decoder_Interface_Decode_any( st, bits, NULL, toc & 0xFF, offset, synth,
+         NULL, 1, 0 );
+}
 
-      case 2:
-         frame_type = RX_SID_UPDATE;
-         mode = bits[245];
-         Bits2Prm( MRDTX, &bits[1], prm );
-         break;
 
-      case 3:
-         frame_type = RX_NO_DATA;
-         mode = s->prev_mode;
-         break;
-   }
-#endif
+/*
+ * Decoder_Interface_DecodeRTP_float
+ *
+ *
+ * Parameters:
+ *    st                B: state structure
+ *    toc               I: table of contents entry of the frame, frame type
+ *                         and Q bit where storage format header has them
+ *    bits              I: RTP payload, or part of it
+ *    offset            I: bit of bits the frame starts at, from MSB of
+ *                         the first octet
+ *    synth             O: synthesized speech, scaled to [-1, 1)
+ *
+ * Function:
+ *    Same as Decoder_Interface_DecodeRTP, for floating point output
+ *
+ * Returns:
+ *    Void
+ */
+void Decoder_Interface_DecodeRTP_float( void *st, int toc, UWord8 *bits,
+      int offset, Float32 *synth )
+{
+   Decoder_Interface_Decode_any( st, bits, NULL, toc & 0xFF, offset, NULL,
+         synth, 1, 0 );
+}
 
-   /* test for homing frame */
-   if ( s->reset_flag_old == 1 ) {
-      switch ( mode ) {
-         case MR122:
-            homing = dhf_MR122;
-            homingSize = 18;
-            break;
-
-         case MR102:
-            homing = dhf_MR102;
-            homingSize = 12;
-            break;
-
-         case MR795:
-            homing = dhf_MR795;
-            homingSize = 8;
-            break;
-
-         case MR74:
-            homing = dhf_MR74;
-            homingSize = 7;
-            break;
-
-         case MR67:
-            homing = dhf_MR67;
-            homingSize = 7;
-            break;
-
-         case MR59:
-            homing = dhf_MR59;
-            homingSize = 7;
-            break;
-
-         case MR515:
-            homing = dhf_MR515;
-            homingSize = 7;
-            break;
-
-         case MR475:
-            homing = dhf_MR475;
-            homingSize = 7;
-            break;
 
-         default:
-            homing = NULL;
-            homingSize = 0;
-            break;
-      }
+/*
+ * Decoder_Interface_EstimateN
+ *
+ *
+ * Parameters:
+ *    st                B: state structure
+ *    bits              I: consecutive frames of bit stream
+ *    size              I: number of bytes in bits
+ *    energy            O: mean square of each frame, scaled to [-1, 1)
+ *    frames            I: maximum number of frames to estimate
+ *    used              O: number of bytes estimated, or NULL
+ *
+ * Function:
+ *    Rough energy of frames from their parameters, without decoding
+ *    them, see Speech_Decode_Frame_estimate. Frames other than good
+ *    speech, with Q bit set, are taken for silence. Homing frames are
+ *    not detected. State is left fit only for further estimates, it
+ *    is to be reset before decoding
+ *
+ * Returns:
+ *    number of frames estimated
+ */
+int Decoder_Interface_EstimateN( void *st, UWord8 *bits, int size,
+      Float32 *energy, int frames, int *used )
+{
+   enum Mode mode, speech_mode;
+   enum RXFrameType frame_type;
+   Word16 prm[PRMNO_MR122];
+   Word32 n, pos, length;
+   Word16 q_bit;
+   dec_interface_State * s;
 
-      for ( i = 0; i < homingSize; i++ ) {
-         resetFlag = prm[i] ^ homing[i];
 
-         if ( resetFlag )
-            break;
-      }
-   }
+   s = ( dec_interface_State * )st;
+   pos = 0;
 
-   if ( ( resetFlag == 0 ) && ( s->reset_flag_old != 0 ) ) {
-      for ( i = 0; i < 160; i++ ) {
-         synth[i] = EHF_MASK;
-      }
-   }
-   else
-      Speech_Decode_Frame( s->decoder_State, mode, prm, frame_type, synth );
+   for ( n = 0; n < frames; n++ ) {
+      if ( pos >= size )
+         break;
+      length = Frame_length( s, bits[pos] );
 
-   if ( s->reset_flag_old == 0 ) {
-      /* check whole frame */
-      switch ( mode ) {
-         case MR122:
-            homing = dhf_MR122;
-            homingSize = PRMNO_MR122;
-            break;
-
-         case MR102:
-            homing = dhf_MR102;
-            homingSize = PRMNO_MR102;
-            break;
-
-         case MR795:
-            homing = dhf_MR795;
-            homingSize = PRMNO_MR795;
-            break;
-
-         case MR74:
-            homing = dhf_MR74;
-            homingSize = PRMNO_MR74;
-            break;
-
-         case MR67:
-            homing = dhf_MR67;
-            homingSize = PRMNO_MR67;
-            break;
-
-         case MR59:
-            homing = dhf_MR59;
-            homingSize = PRMNO_MR59;
-            break;
-
-         case MR515:
-            homing = dhf_MR515;
-            homingSize = PRMNO_MR515;
-            break;
-
-         case MR475:
-            homing = dhf_MR475;
-            homingSize = PRMNO_MR475;
-            break;
+      if ( length == 0 )
+         length = 1;
 
-         default:
-            homing = NULL;
-            homingSize = 0;
-      }
+      if ( length > size - pos )
+         break;
 
-      for ( i = 0; i < homingSize; i++ ) {
-         resetFlag = prm[i] ^ homing[i];
+#ifndef DEC_SMALL
+      if ( s->format == DEC_FORMAT_IF2 )
+         mode = Decoder3GPP( prm, bits + pos, &frame_type, &speech_mode );
+      else
+#endif
+      {
+         mode = DecoderMMS( prm, bits + pos, &frame_type, &speech_mode,
+               &q_bit );
 
-         if ( resetFlag )
-            break;
+         if ( q_bit == 0 )
+            frame_type = RX_SPEECH_BAD;
       }
+      energy[n] = Speech_Decode_Frame_estimate( s->decoder_State, mode, prm,
+            frame_type );
+      pos += length;
    }
 
-   /* reset decoder if current frame is a homing frame */
-   if ( resetFlag == 0 ) {
-      Speech_Decode_Frame_reset( s->decoder_State );
-   }
-   s->reset_flag_old = !resetFlag;
-   s->prev_ft = frame_type;
-   s->prev_mode = mode;
+   if ( used != NULL )
+      *used = pos;
+   return n;
 }
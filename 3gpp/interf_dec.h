@@ -24,8 +24,19 @@
 #ifndef _interf_dec_h_
 #define _interf_dec_h_
 
+/*
+ * Octets of storage format frame of each frame type, after the header
+ * octet; 0 for NO_DATA and frame types reserved for future use, which
+ * are the header alone. Frame length of the decoder, for players and
+ * tools walking files
+ */
+extern const short Decoder_Interface_block_size[16];
+
 /*
  * Function prototypes
+ *
+ * Instances share no mutable state, so each one can be used on its own
+ * thread; only Decoder_Interface_select_kernels affects all of them
  */
 /*
  * Conversion from packed bitstream to endoded parameters
@@ -42,11 +53,313 @@ void Decoder_Interface_Decode( void *st,
 
       short *synth, int bfi );
 
+/*
+ * Same as Decoder_Interface_Decode, but output is floating point,
+ * scaled to [-1, 1)
+ */
+void Decoder_Interface_Decode_float( void *st,
+
+#ifndef ETSI
+      unsigned char *bits,
+
+#else
+      short *bits,
+#endif
+
+      float *synth, int bfi );
+
+/*
+ * Same as Decoder_Interface_Decode_float, but to every stride-th sample
+ * of synth, for interleaving channels of several instances in place
+ */
+void Decoder_Interface_Decode_float_stride( void *st, unsigned char *bits,
+      float *synth, int stride, int bfi );
+
+/*
+ * Same as Decoder_Interface_Decode_float_stride of count instances, one
+ * frame each, decoded side by side where they can be
+ */
+void Decoder_Interface_Decode_group_float( void *st[], int count,
+      unsigned char *bits[], float *synth[], int stride, int bfi );
+
+/*
+ * Same as Decoder_Interface_Decode, but with no output, for frames
+ * decoded only to bring decoder to a state, such as before seek target;
+ * post filtering is skipped, so the next frame or two decoded in full
+ * differ slightly from what decoding of all frames gives
+ */
+void Decoder_Interface_Warmup( void *st, unsigned char *bits, int bfi );
+
+#ifndef DEC_SMALL
+/*
+ * Decoding of ETSI serial frame, as in test vectors: frame type, 244
+ * bits one per word and mode, 250 words in all. ETSI builds take these
+ * in Decoder_Interface_Decode too
+ */
+void Decoder_Interface_Decode_serial( void *st, short *serial, short *synth );
+
+/*
+ * Same as Decoder_Interface_Decode_serial, but output is floating point,
+ * scaled to [-1, 1)
+ */
+void Decoder_Interface_Decode_serial_float( void *st, short *serial,
+      float *synth );
+#endif
+
+/*
+ * Decoding of up to frames consecutive frames, size bytes in all, to
+ * 160 samples each; stops early at a frame cut off by the end of bits.
+ * Returns number of frames decoded, bytes they took go to *used unless
+ * it's NULL. Bad frame indicator is 0 for all of them
+ */
+int Decoder_Interface_DecodeN( void *st, unsigned char *bits, int size,
+      short *synth, int frames, int *used );
+
+/*
+ * Same as Decoder_Interface_DecodeN, but output is floating point,
+ * scaled to [-1, 1)
+ */
+int Decoder_Interface_DecodeN_float( void *st, unsigned char *bits, int size,
+      float *synth, int frames, int *used );
+
+#ifndef DEC_SMALL
+/*
+ * Laws of G.711 output, as telephone systems take it
+ */
+#define DEC_G711_ALAW 0
+#define DEC_G711_ULAW 1
+
+/*
+ * Same as Decoder_Interface_Decode, but output is G.711 of given law,
+ * a byte per sample, coded from 16-bit output by table
+ */
+void Decoder_Interface_Decode_g711( void *st, unsigned char *bits,
+      unsigned char *out, int law, int bfi );
+
+/*
+ * Same as Decoder_Interface_DecodeN, but output is G.711 of given law,
+ * 160 bytes per frame
+ */
+int Decoder_Interface_DecodeN_g711( void *st, unsigned char *bits, int size,
+      unsigned char *out, int law, int frames, int *used );
+
+/*
+ * Codes 16-bit samples decoded before to G.711 of given law, by the same
+ * table, so output decoded once can be written in more than one format
+ */
+void Decoder_Interface_Code_g711( const short *synth, unsigned char *out,
+      int samples, int law );
+#endif
+
+/*
+ * Frame unpacked to its parameters by Decoder_Interface_UnpackN, ready
+ * for Decoder_Interface_SynthN; fields are for the decoder alone
+ */
+#define DEC_FRAME_PARAMS 57
+struct Dec_frame {
+   short prm[DEC_FRAME_PARAMS];
+   unsigned char mode, speech_mode, frame_type, q_bit;
+#ifdef DEC_PROFILE
+   unsigned long long cycles;
+#endif
+};
+
+/*
+ * First stage of Decoder_Interface_DecodeN, split off so frames can be
+ * unpacked ahead, on another thread even: up to frames frames, size
+ * bytes in all, unpacked to out, as Decoder_Interface_DecodeN reads
+ * them. Instance is only read for its format. Returns number of frames
+ * unpacked, bytes they took go to *used unless it's NULL
+ */
+int Decoder_Interface_UnpackN( const void *st, unsigned char *bits, int size,
+      struct Dec_frame *out, int frames, int *used );
+
+/*
+ * Second stage of Decoder_Interface_DecodeN: decoding of frames unpacked
+ * by Decoder_Interface_UnpackN, in order, to 160 samples each; frames
+ * are changed. Same output as Decoder_Interface_DecodeN of their bits
+ */
+void Decoder_Interface_SynthN( void *st, struct Dec_frame *in, int frames,
+      short *synth );
+
+/*
+ * Same as Decoder_Interface_SynthN, but output is floating point,
+ * scaled to [-1, 1)
+ */
+void Decoder_Interface_SynthN_float( void *st, struct Dec_frame *in,
+      int frames, float *synth );
+
+/*
+ * Decoding of one frame of RTP payload (RFC 4867), octet-aligned or
+ * bandwidth-efficient, where it is: toc is its table of contents entry,
+ * frame type and Q bit where storage format header has them, and the
+ * frame starts offset bits from MSB of bits, whatever format is set
+ */
+void Decoder_Interface_DecodeRTP( void *st, int toc, unsigned char *bits,
+      int offset, short *synth );
+
+/*
+ * Same as Decoder_Interface_DecodeRTP, but output is floating point,
+ * scaled to [-1, 1)
+ */
+void Decoder_Interface_DecodeRTP_float( void *st, int toc,
+      unsigned char *bits, int offset, float *synth );
+
+/*
+ * Rough mean square of each of up to frames frames, scaled to [-1, 1),
+ * from frame parameters alone; an order of magnitude faster than
+ * decoding, for loudness scans. Frames other than good speech count as
+ * silence. Instance is fit only for further estimates after, reset it
+ * before decoding again
+ */
+int Decoder_Interface_EstimateN( void *st, unsigned char *bits, int size,
+      float *energy, int frames, int *used );
+
 /*
  * Reserve and init. memory
  */
 void *Decoder_Interface_init( void );
 
+/*
+ * Size of memory needed by Decoder_Interface_init_mem
+ */
+int Decoder_Interface_mem_size( void );
+
+/*
+ * Init. in memory provided by caller, which is not freed on exit
+ */
+void *Decoder_Interface_init_mem( void *mem );
+
+/*
+ * Reset to state right after init., without reallocating memory
+ */
+void Decoder_Interface_reset( void *state );
+
+/*
+ * Detect decoder homing frames, which reset the decoder, or not; on by
+ * default, kept over reset
+ */
+void Decoder_Interface_set_homing( void *state, int enable );
+
+/*
+ * Formats of octet frames: storage format (RFC 4867 section 5, MMS),
+ * the default, and IF2 (TS 26.101 annex A), the default of IF2 builds;
+ * DEC_SMALL builds take storage format only
+ */
+#define DEC_FORMAT_MMS 0
+#define DEC_FORMAT_IF2 1
+
+/*
+ * Format of octet frames of Decoder_Interface_Decode,
+ * Decoder_Interface_DecodeN and Decoder_Interface_EstimateN; kept over
+ * reset and restore
+ */
+void Decoder_Interface_set_format( void *state, int format );
+
+/*
+ * Engines of post filtering: fixed point, bit-exact with the reference
+ * decoder, the default, single precision floating point, faster but not
+ * bit-exact, and none at all, fastest, for output analysed by machines
+ * rather than listened to; synthesis is fixed point with any of them
+ */
+#define DEC_ENGINE_FIXED 0
+#define DEC_ENGINE_FLOAT 1
+#define DEC_ENGINE_BYPASS 2
+
+/*
+ * Engine of post filtering of this instance; can be changed between any
+ * two frames, kept over reset. Snapshots restore into either engine
+ */
+void Decoder_Interface_set_engine( void *state, int engine );
+
+/*
+ * Gain of floating point output of this instance, applied as samples are
+ * written rather than in a pass after, for loudness normalization; 1, the
+ * default, leaves output as it is. 16-bit output is not affected. Can be
+ * changed between any two frames, kept over reset and restore
+ */
+void Decoder_Interface_set_gain( void *state, float gain );
+
+/*
+ * Pitch lag of the last subframe of the frame decoded last, in samples
+ * at 8 kHz, as the decoder got it from the frame; 0 if the frame was
+ * comfort noise or no data. Lets output be time scaled pitch
+ * synchronously without detecting pitch again
+ */
+int Decoder_Interface_pitch_lag( void *state );
+
+/*
+ * Parameters the frame decoded last was synthesized from, for speech
+ * analysis without analysing the output again: LSPs of each subframe,
+ * interpolated as the synthesis filter had them, cosine domain in Q15;
+ * pitch lag, its fraction in sixths for MR122 and thirds otherwise,
+ * pitch gain in Q14 and codebook gain in Q1 of each subframe. Comfort
+ * noise has its LSPs in every subframe, and no lags or gains
+ */
+#define DEC_SUBFRAMES 4
+#define DEC_LP_ORDER 10
+#define DEC_MODE_NONE 8
+struct Dec_features {
+   short lsp[DEC_SUBFRAMES][DEC_LP_ORDER];
+   short lag[DEC_SUBFRAMES];
+   short lag_frac[DEC_SUBFRAMES];
+   short gain_pit[DEC_SUBFRAMES];
+   short gain_code[DEC_SUBFRAMES];
+   unsigned char mode;   /* 0 to 7 as in the frame header, DEC_MODE_NONE if no speech */
+};
+void Decoder_Interface_features( void *state, struct Dec_features *out );
+
+/*
+ * Size of buffer needed by Decoder_Interface_snapshot
+ */
+int Decoder_Interface_snapshot_size( void );
+
+/*
+ * Copy of state; instances with equal snapshots decode the same from
+ * now on
+ */
+void Decoder_Interface_snapshot( void *state, void *buf );
+
+/*
+ * Bring to state of a snapshot of this or another instance; it then
+ * decodes the same as that instance did after the snapshot was taken.
+ * Homing detection setting is kept
+ */
+void Decoder_Interface_restore( void *state, const void *buf );
+
+/*
+ * CPU features for Decoder_Interface_select_kernels
+ */
+#define DEC_CPU_SSE2 0x1
+#define DEC_CPU_NEON 0x2
+
+/*
+ * Pick kernels for given CPU features, 0 forces plain C ones. Applies
+ * to all instances, call before the first one is initialized
+ */
+void Decoder_Interface_select_kernels( int cpu_features );
+
+/*
+ * Plain C kernels for instances the calling thread runs, whatever
+ * Decoder_Interface_select_kernels picked, while enable is nonzero; to
+ * check output of the others against. Other threads are not affected
+ */
+void Decoder_Interface_reference_kernels( int enable );
+
+#ifdef DEC_PROFILE
+/*
+ * Counters of instrumentation build since the previous call, see
+ * struct Dec_profile in sp_dec.h; they are cleared
+ */
+struct Dec_profile;
+void Decoder_Interface_profile( void *state, struct Dec_profile *out );
+
+/*
+ * Current value of the counter the stages are timed with
+ */
+unsigned long long Decoder_Interface_cycles( void );
+#endif
+
 /*
  * Exit and free memory
  */
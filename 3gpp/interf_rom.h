@@ -19,6 +19,8 @@
  * Contains:
  *    Tables:           Subjective importance
  *                      Homing frames
+ *                      Nibble tables of storage format frames
+ *                      G.711 codes
  *
  *
  */
@@ -47,24 +49,33 @@
 #define PRMNO_MRDTX 5
 
 /*
- * tables
+ * bit order tables are walked bit by bit in every frame; like the
+ * codebooks of rom_dec.h, they start at a cache line
  */
-#ifndef IF2
-#ifndef ETSI
-static const UWord8 block_size[16]={ 13, 14, 16, 18, 20, 21, 27, 32,
-                                    6 , 0 , 0 , 0 , 0 , 0 , 0 , 1  };
+#ifndef ROM_ALIGN
+#if defined( _MSC_VER )
+#define ROM_ALIGN __declspec( align( 64 ) )
+#elif defined( __GNUC__ )
+#define ROM_ALIGN __attribute__( ( aligned( 64 ) ) )
+#else
+#define ROM_ALIGN
+#endif
+#endif
 
+/*
+ * tables
+ */
 static const UWord8 toc_byte[16]={0x04, 0x0C, 0x14, 0x1C, 0x24, 0x2C, 0x34, 0x3C,
 								  0x44, 0x4C, 0x54, 0x5C, 0x64, 0x6C, 0x74, 0x7C};
-#endif
-#else
-/* One encoded frame (bytes) */
-static const UWord8 block_size[16]={ 13, 14, 16, 18, 19, 21, 26, 31,
-                                    5 , 0 , 0 , 0 , 0 , 0 , 0 , 1  };
+
+#ifndef DEC_SMALL
+/* One encoded IF2 frame (bytes) */
+static const UWord8 block_size_if2[16]={ 13, 14, 16, 18, 19, 21, 26, 31,
+                                        5 , 0 , 0 , 0 , 0 , 0 , 0 , 1  };
 #endif
 
 /* Subjective importance of the speech encoded bits */
-static Word16 order_MR475[] =
+ROM_ALIGN static const Word16 order_MR475[] =
 {
    0, 0x80,
    0, 0x40,
@@ -162,7 +173,7 @@ static Word16 order_MR475[] =
    11, 0x40,
    15, 0x40
 };
-static Word16 order_MR515[] =
+ROM_ALIGN static const Word16 order_MR515[] =
 {
    0, 0x1,
    0, 0x2,
@@ -268,7 +279,7 @@ static Word16 order_MR515[] =
    12, 0x8,
    16, 0x8
 };
-static Word16 order_MR59[] =
+ROM_ALIGN static const Word16 order_MR59[] =
 {
    0, 0x80,
    0, 0x40,
@@ -389,7 +400,7 @@ static Word16 order_MR59[] =
    12, 0x20,
    16, 0x20
 };
-static Word16 order_MR67[] =
+ROM_ALIGN static const Word16 order_MR67[] =
 {
    0, 0x80,
    0, 0x40,
@@ -526,7 +537,7 @@ static Word16 order_MR67[] =
    12, 0x100,
    16, 0x100
 };
-static Word16 order_MR74[] =
+ROM_ALIGN static const Word16 order_MR74[] =
 {
    0, 0x80,
    0, 0x40,
@@ -677,7 +688,7 @@ static Word16 order_MR74[] =
    12, 0x40,
    16, 0x40
 };
-static Word16 order_MR795[] =
+ROM_ALIGN static const Word16 order_MR795[] =
 {
    0, 0x1,
    0, 0x2,
@@ -998,7 +1009,7 @@ static Word16 order_MR795[] =
    14, 0x200,
    19, 0x200
 };
-static Word16 order_MR102[] =
+ROM_ALIGN static const Word16 order_MR102[] =
 {
    0, 0x1,
    0, 0x2,
@@ -1205,7 +1216,7 @@ static Word16 order_MR102[] =
    9, 0x4,
    9, 0x2
 };
-static Word16 order_MR122[] =
+ROM_ALIGN static const Word16 order_MR122[] =
 {
    0, 0x40,
    0, 0x20,
@@ -1452,7 +1463,7 @@ static Word16 order_MR122[] =
    18, 0x1,
    44, 0x1
 };
-static Word16 order_MRDTX[] =
+ROM_ALIGN static const Word16 order_MRDTX[] =
 {
    0, 0x4,
    0, 0x2,
@@ -1729,7 +1740,6 @@ static const Word16 dhf_MR122[PRMNO_MR122] =
    0x0000
 };
 
-
 /* parameter sizes (# of bits), one table per mode */
 static const Word16 bitno_MR475[PRMNO_MR475] =
 {
@@ -1800,4 +1810,1392 @@ static const Word16 bitno_MRDTX[PRMNO_MRDTX] =
    3, 8, 9, 9, 6
 };
 
+#ifndef DEC_SMALL
+/*
+ * Nibble tables of storage format frames, see Unpack_MMS: for each mode
+ * the frame's bits, in the order of frame_desc, are taken 4 at a time;
+ * a nibble's entry has the distinct parameters its bits belong to, and
+ * for each of the 16 nibble values the sum of the weights of its set
+ * bits, from MSB, added to each of them. Bits past the end of the frame,
+ * the last nibble may have, add nothing. mms_first is the first nibble
+ * of each mode. Generated from the ordering tables, about 40 kB
+ */
+#define MMS_NIBBLES 312   /* ( bits + 3 ) / 4 of all modes, see frame_desc */
+
+typedef struct
+{
+   UWord8 count;   /* parameters the bits belong to, 1 to 4 */
+   UWord8 param[4];   /* the parameters */
+   Word16 add[16][4];   /* added to each of them, by value of the nibble */
+} MMS_nibble;
+
+static const Word16 mms_first[N_MODES] =
+{
+   0, 24, 50, 80, 114, 151, 191, 242, 303
+};
+static const MMS_nibble mms_nibbles[MMS_NIBBLES] =
+{
+   /* MR475 */
+   { 1, { 0, 0, 0, 0 }, { { 0, 0, 0, 0 }, { 16, 0, 0, 0 }, { 32, 0, 0, 0 }, { 48, 0, 0, 0 }, { 64, 0, 0, 0 }, { 80, 0, 0, 0 }, { 96, 0, 0, 0 }, { 112, 0, 0, 0 }, { 128, 0, 0, 0 }, { 144, 0, 0, 0 }, { 160, 0, 0, 0 }, { 176, 0, 0, 0 }, { 192, 0, 0, 0 }, { 208, 0, 0, 0 }, { 224, 0, 0, 0 }, { 240, 0, 0, 0 } } },
+   { 1, { 0, 0, 0, 0 }, { { 0, 0, 0, 0 }, { 1, 0, 0, 0 }, { 2, 0, 0, 0 }, { 3, 0, 0, 0 }, { 4, 0, 0, 0 }, { 5, 0, 0, 0 }, { 6, 0, 0, 0 }, { 7, 0, 0, 0 }, { 8, 0, 0, 0 }, { 9, 0, 0, 0 }, { 10, 0, 0, 0 }, { 11, 0, 0, 0 }, { 12, 0, 0, 0 }, { 13, 0, 0, 0 }, { 14, 0, 0, 0 }, { 15, 0, 0, 0 } } },
+   { 1, { 1, 0, 0, 0 }, { { 0, 0, 0, 0 }, { 16, 0, 0, 0 }, { 32, 0, 0, 0 }, { 48, 0, 0, 0 }, { 64, 0, 0, 0 }, { 80, 0, 0, 0 }, { 96, 0, 0, 0 }, { 112, 0, 0, 0 }, { 128, 0, 0, 0 }, { 144, 0, 0, 0 }, { 160, 0, 0, 0 }, { 176, 0, 0, 0 }, { 192, 0, 0, 0 }, { 208, 0, 0, 0 }, { 224, 0, 0, 0 }, { 240, 0, 0, 0 } } },
+   { 1, { 1, 0, 0, 0 }, { { 0, 0, 0, 0 }, { 1, 0, 0, 0 }, { 2, 0, 0, 0 }, { 3, 0, 0, 0 }, { 4, 0, 0, 0 }, { 5, 0, 0, 0 }, { 6, 0, 0, 0 }, { 7, 0, 0, 0 }, { 8, 0, 0, 0 }, { 9, 0, 0, 0 }, { 10, 0, 0, 0 }, { 11, 0, 0, 0 }, { 12, 0, 0, 0 }, { 13, 0, 0, 0 }, { 14, 0, 0, 0 }, { 15, 0, 0, 0 } } },
+   { 1, { 3, 0, 0, 0 }, { { 0, 0, 0, 0 }, { 16, 0, 0, 0 }, { 32, 0, 0, 0 }, { 48, 0, 0, 0 }, { 64, 0, 0, 0 }, { 80, 0, 0, 0 }, { 96, 0, 0, 0 }, { 112, 0, 0, 0 }, { 128, 0, 0, 0 }, { 144, 0, 0, 0 }, { 160, 0, 0, 0 }, { 176, 0, 0, 0 }, { 192, 0, 0, 0 }, { 208, 0, 0, 0 }, { 224, 0, 0, 0 }, { 240, 0, 0, 0 } } },
+   { 2, { 3, 7, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 4, 0, 0 }, { 0, 8, 0, 0 }, { 0, 12, 0, 0 }, { 4, 0, 0, 0 }, { 4, 4, 0, 0 }, { 4, 8, 0, 0 }, { 4, 12, 0, 0 }, { 8, 0, 0, 0 }, { 8, 4, 0, 0 }, { 8, 8, 0, 0 }, { 8, 12, 0, 0 }, { 12, 0, 0, 0 }, { 12, 4, 0, 0 }, { 12, 8, 0, 0 }, { 12, 12, 0, 0 } } },
+   { 2, { 10, 14, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 4, 0, 0 }, { 0, 8, 0, 0 }, { 0, 12, 0, 0 }, { 4, 0, 0, 0 }, { 4, 4, 0, 0 }, { 4, 8, 0, 0 }, { 4, 12, 0, 0 }, { 8, 0, 0, 0 }, { 8, 4, 0, 0 }, { 8, 8, 0, 0 }, { 8, 12, 0, 0 }, { 12, 0, 0, 0 }, { 12, 4, 0, 0 }, { 12, 8, 0, 0 }, { 12, 12, 0, 0 } } },
+   { 1, { 6, 0, 0, 0 }, { { 0, 0, 0, 0 }, { 8, 0, 0, 0 }, { 4, 0, 0, 0 }, { 12, 0, 0, 0 }, { 2, 0, 0, 0 }, { 10, 0, 0, 0 }, { 6, 0, 0, 0 }, { 14, 0, 0, 0 }, { 1, 0, 0, 0 }, { 9, 0, 0, 0 }, { 5, 0, 0, 0 }, { 13, 0, 0, 0 }, { 3, 0, 0, 0 }, { 11, 0, 0, 0 }, { 7, 0, 0, 0 }, { 15, 0, 0, 0 } } },
+   { 1, { 13, 0, 0, 0 }, { { 0, 0, 0, 0 }, { 8, 0, 0, 0 }, { 4, 0, 0, 0 }, { 12, 0, 0, 0 }, { 2, 0, 0, 0 }, { 10, 0, 0, 0 }, { 6, 0, 0, 0 }, { 14, 0, 0, 0 }, { 1, 0, 0, 0 }, { 9, 0, 0, 0 }, { 5, 0, 0, 0 }, { 13, 0, 0, 0 }, { 3, 0, 0, 0 }, { 11, 0, 0, 0 }, { 7, 0, 0, 0 }, { 15, 0, 0, 0 } } },
+   { 1, { 2, 0, 0, 0 }, { { 0, 0, 0, 0 }, { 1, 0, 0, 0 }, { 4, 0, 0, 0 }, { 5, 0, 0, 0 }, { 16, 0, 0, 0 }, { 17, 0, 0, 0 }, { 20, 0, 0, 0 }, { 21, 0, 0, 0 }, { 32, 0, 0, 0 }, { 33, 0, 0, 0 }, { 36, 0, 0, 0 }, { 37, 0, 0, 0 }, { 48, 0, 0, 0 }, { 49, 0, 0, 0 }, { 52, 0, 0, 0 }, { 53, 0, 0, 0 } } },
+   { 1, { 13, 0, 0, 0 }, { { 0, 0, 0, 0 }, { 128, 0, 0, 0 }, { 64, 0, 0, 0 }, { 192, 0, 0, 0 }, { 32, 0, 0, 0 }, { 160, 0, 0, 0 }, { 96, 0, 0, 0 }, { 224, 0, 0, 0 }, { 16, 0, 0, 0 }, { 144, 0, 0, 0 }, { 80, 0, 0, 0 }, { 208, 0, 0, 0 }, { 48, 0, 0, 0 }, { 176, 0, 0, 0 }, { 112, 0, 0, 0 }, { 240, 0, 0, 0 } } },
+   { 2, { 3, 6, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 32, 0, 0 }, { 0, 16, 0, 0 }, { 0, 48, 0, 0 }, { 1, 0, 0, 0 }, { 1, 32, 0, 0 }, { 1, 16, 0, 0 }, { 1, 48, 0, 0 }, { 2, 0, 0, 0 }, { 2, 32, 0, 0 }, { 2, 16, 0, 0 }, { 2, 48, 0, 0 }, { 3, 0, 0, 0 }, { 3, 32, 0, 0 }, { 3, 16, 0, 0 }, { 3, 48, 0, 0 } } },
+   { 2, { 6, 5, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 1, 0, 0 }, { 0, 2, 0, 0 }, { 0, 3, 0, 0 }, { 128, 0, 0, 0 }, { 128, 1, 0, 0 }, { 128, 2, 0, 0 }, { 128, 3, 0, 0 }, { 64, 0, 0, 0 }, { 64, 1, 0, 0 }, { 64, 2, 0, 0 }, { 64, 3, 0, 0 }, { 192, 0, 0, 0 }, { 192, 1, 0, 0 }, { 192, 2, 0, 0 }, { 192, 3, 0, 0 } } },
+   { 2, { 2, 7, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 2, 0, 0 }, { 2, 0, 0, 0 }, { 2, 2, 0, 0 }, { 8, 0, 0, 0 }, { 8, 2, 0, 0 }, { 10, 0, 0, 0 }, { 10, 2, 0, 0 }, { 64, 0, 0, 0 }, { 64, 2, 0, 0 }, { 66, 0, 0, 0 }, { 66, 2, 0, 0 }, { 72, 0, 0, 0 }, { 72, 2, 0, 0 }, { 74, 0, 0, 0 }, { 74, 2, 0, 0 } } },
+   { 3, { 7, 9, 10, 0 }, { { 0, 0, 0, 0 }, { 0, 0, 2, 0 }, { 0, 1, 0, 0 }, { 0, 1, 2, 0 }, { 0, 2, 0, 0 }, { 0, 2, 2, 0 }, { 0, 3, 0, 0 }, { 0, 3, 2, 0 }, { 1, 0, 0, 0 }, { 1, 0, 2, 0 }, { 1, 1, 0, 0 }, { 1, 1, 2, 0 }, { 1, 2, 0, 0 }, { 1, 2, 2, 0 }, { 1, 3, 0, 0 }, { 1, 3, 2, 0 } } },
+   { 3, { 10, 12, 14, 0 }, { { 0, 0, 0, 0 }, { 0, 0, 2, 0 }, { 0, 1, 0, 0 }, { 0, 1, 2, 0 }, { 0, 2, 0, 0 }, { 0, 2, 2, 0 }, { 0, 3, 0, 0 }, { 0, 3, 2, 0 }, { 1, 0, 0, 0 }, { 1, 0, 2, 0 }, { 1, 1, 0, 0 }, { 1, 1, 2, 0 }, { 1, 2, 0, 0 }, { 1, 2, 2, 0 }, { 1, 3, 0, 0 }, { 1, 3, 2, 0 } } },
+   { 3, { 14, 16, 4, 0 }, { { 0, 0, 0, 0 }, { 0, 0, 32, 0 }, { 0, 1, 0, 0 }, { 0, 1, 32, 0 }, { 0, 2, 0, 0 }, { 0, 2, 32, 0 }, { 0, 3, 0, 0 }, { 0, 3, 32, 0 }, { 1, 0, 0, 0 }, { 1, 0, 32, 0 }, { 1, 1, 0, 0 }, { 1, 1, 32, 0 }, { 1, 2, 0, 0 }, { 1, 2, 32, 0 }, { 1, 3, 0, 0 }, { 1, 3, 32, 0 } } },
+   { 2, { 4, 8, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 32, 0, 0 }, { 2, 0, 0, 0 }, { 2, 32, 0, 0 }, { 4, 0, 0, 0 }, { 4, 32, 0, 0 }, { 6, 0, 0, 0 }, { 6, 32, 0, 0 }, { 16, 0, 0, 0 }, { 16, 32, 0, 0 }, { 18, 0, 0, 0 }, { 18, 32, 0, 0 }, { 20, 0, 0, 0 }, { 20, 32, 0, 0 }, { 22, 0, 0, 0 }, { 22, 32, 0, 0 } } },
+   { 2, { 8, 11, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 32, 0, 0 }, { 2, 0, 0, 0 }, { 2, 32, 0, 0 }, { 4, 0, 0, 0 }, { 4, 32, 0, 0 }, { 6, 0, 0, 0 }, { 6, 32, 0, 0 }, { 16, 0, 0, 0 }, { 16, 32, 0, 0 }, { 18, 0, 0, 0 }, { 18, 32, 0, 0 }, { 20, 0, 0, 0 }, { 20, 32, 0, 0 }, { 22, 0, 0, 0 }, { 22, 32, 0, 0 } } },
+   { 2, { 11, 15, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 32, 0, 0 }, { 2, 0, 0, 0 }, { 2, 32, 0, 0 }, { 4, 0, 0, 0 }, { 4, 32, 0, 0 }, { 6, 0, 0, 0 }, { 6, 32, 0, 0 }, { 16, 0, 0, 0 }, { 16, 32, 0, 0 }, { 18, 0, 0, 0 }, { 18, 32, 0, 0 }, { 20, 0, 0, 0 }, { 20, 32, 0, 0 }, { 22, 0, 0, 0 }, { 22, 32, 0, 0 } } },
+   { 2, { 15, 4, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 8, 0, 0 }, { 2, 0, 0, 0 }, { 2, 8, 0, 0 }, { 4, 0, 0, 0 }, { 4, 8, 0, 0 }, { 6, 0, 0, 0 }, { 6, 8, 0, 0 }, { 16, 0, 0, 0 }, { 16, 8, 0, 0 }, { 18, 0, 0, 0 }, { 18, 8, 0, 0 }, { 20, 0, 0, 0 }, { 20, 8, 0, 0 }, { 22, 0, 0, 0 }, { 22, 8, 0, 0 } } },
+   { 4, { 8, 11, 15, 4 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 1 }, { 0, 0, 8, 0 }, { 0, 0, 8, 1 }, { 0, 8, 0, 0 }, { 0, 8, 0, 1 }, { 0, 8, 8, 0 }, { 0, 8, 8, 1 }, { 8, 0, 0, 0 }, { 8, 0, 0, 1 }, { 8, 0, 8, 0 }, { 8, 0, 8, 1 }, { 8, 8, 0, 0 }, { 8, 8, 0, 1 }, { 8, 8, 8, 0 }, { 8, 8, 8, 1 } } },
+   { 4, { 8, 11, 15, 4 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 64 }, { 0, 0, 1, 0 }, { 0, 0, 1, 64 }, { 0, 1, 0, 0 }, { 0, 1, 0, 64 }, { 0, 1, 1, 0 }, { 0, 1, 1, 64 }, { 1, 0, 0, 0 }, { 1, 0, 0, 64 }, { 1, 0, 1, 0 }, { 1, 0, 1, 64 }, { 1, 1, 0, 0 }, { 1, 1, 0, 64 }, { 1, 1, 1, 0 }, { 1, 1, 1, 64 } } },
+   { 3, { 8, 11, 15, 0 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 0 }, { 0, 0, 64, 0 }, { 0, 0, 64, 0 }, { 0, 64, 0, 0 }, { 0, 64, 0, 0 }, { 0, 64, 64, 0 }, { 0, 64, 64, 0 }, { 64, 0, 0, 0 }, { 64, 0, 0, 0 }, { 64, 0, 64, 0 }, { 64, 0, 64, 0 }, { 64, 64, 0, 0 }, { 64, 64, 0, 0 }, { 64, 64, 64, 0 }, { 64, 64, 64, 0 } } },
+   /* MR515 */
+   { 1, { 0, 0, 0, 0 }, { { 0, 0, 0, 0 }, { 8, 0, 0, 0 }, { 4, 0, 0, 0 }, { 12, 0, 0, 0 }, { 2, 0, 0, 0 }, { 10, 0, 0, 0 }, { 6, 0, 0, 0 }, { 14, 0, 0, 0 }, { 1, 0, 0, 0 }, { 9, 0, 0, 0 }, { 5, 0, 0, 0 }, { 13, 0, 0, 0 }, { 3, 0, 0, 0 }, { 11, 0, 0, 0 }, { 7, 0, 0, 0 }, { 15, 0, 0, 0 } } },
+   { 1, { 0, 0, 0, 0 }, { { 0, 0, 0, 0 }, { 128, 0, 0, 0 }, { 64, 0, 0, 0 }, { 192, 0, 0, 0 }, { 32, 0, 0, 0 }, { 160, 0, 0, 0 }, { 96, 0, 0, 0 }, { 224, 0, 0, 0 }, { 16, 0, 0, 0 }, { 144, 0, 0, 0 }, { 80, 0, 0, 0 }, { 208, 0, 0, 0 }, { 48, 0, 0, 0 }, { 176, 0, 0, 0 }, { 112, 0, 0, 0 }, { 240, 0, 0, 0 } } },
+   { 1, { 1, 0, 0, 0 }, { { 0, 0, 0, 0 }, { 8, 0, 0, 0 }, { 4, 0, 0, 0 }, { 12, 0, 0, 0 }, { 2, 0, 0, 0 }, { 10, 0, 0, 0 }, { 6, 0, 0, 0 }, { 14, 0, 0, 0 }, { 1, 0, 0, 0 }, { 9, 0, 0, 0 }, { 5, 0, 0, 0 }, { 13, 0, 0, 0 }, { 3, 0, 0, 0 }, { 11, 0, 0, 0 }, { 7, 0, 0, 0 }, { 15, 0, 0, 0 } } },
+   { 1, { 1, 0, 0, 0 }, { { 0, 0, 0, 0 }, { 128, 0, 0, 0 }, { 64, 0, 0, 0 }, { 192, 0, 0, 0 }, { 32, 0, 0, 0 }, { 160, 0, 0, 0 }, { 96, 0, 0, 0 }, { 224, 0, 0, 0 }, { 16, 0, 0, 0 }, { 144, 0, 0, 0 }, { 80, 0, 0, 0 }, { 208, 0, 0, 0 }, { 48, 0, 0, 0 }, { 176, 0, 0, 0 }, { 112, 0, 0, 0 }, { 240, 0, 0, 0 } } },
+   { 1, { 3, 0, 0, 0 }, { { 0, 0, 0, 0 }, { 16, 0, 0, 0 }, { 32, 0, 0, 0 }, { 48, 0, 0, 0 }, { 64, 0, 0, 0 }, { 80, 0, 0, 0 }, { 96, 0, 0, 0 }, { 112, 0, 0, 0 }, { 128, 0, 0, 0 }, { 144, 0, 0, 0 }, { 160, 0, 0, 0 }, { 176, 0, 0, 0 }, { 192, 0, 0, 0 }, { 208, 0, 0, 0 }, { 224, 0, 0, 0 }, { 240, 0, 0, 0 } } },
+   { 4, { 3, 7, 11, 15 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 8 }, { 0, 0, 8, 0 }, { 0, 0, 8, 8 }, { 0, 8, 0, 0 }, { 0, 8, 0, 8 }, { 0, 8, 8, 0 }, { 0, 8, 8, 8 }, { 8, 0, 0, 0 }, { 8, 0, 0, 8 }, { 8, 0, 8, 0 }, { 8, 0, 8, 8 }, { 8, 8, 0, 0 }, { 8, 8, 0, 8 }, { 8, 8, 8, 0 }, { 8, 8, 8, 8 } } },
+   { 2, { 6, 10, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 1, 0, 0 }, { 4, 0, 0, 0 }, { 4, 1, 0, 0 }, { 2, 0, 0, 0 }, { 2, 1, 0, 0 }, { 6, 0, 0, 0 }, { 6, 1, 0, 0 }, { 1, 0, 0, 0 }, { 1, 1, 0, 0 }, { 5, 0, 0, 0 }, { 5, 1, 0, 0 }, { 3, 0, 0, 0 }, { 3, 1, 0, 0 }, { 7, 0, 0, 0 }, { 7, 1, 0, 0 } } },
+   { 2, { 10, 14, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 2, 0, 0 }, { 0, 1, 0, 0 }, { 0, 3, 0, 0 }, { 4, 0, 0, 0 }, { 4, 2, 0, 0 }, { 4, 1, 0, 0 }, { 4, 3, 0, 0 }, { 2, 0, 0, 0 }, { 2, 2, 0, 0 }, { 2, 1, 0, 0 }, { 2, 3, 0, 0 }, { 6, 0, 0, 0 }, { 6, 2, 0, 0 }, { 6, 1, 0, 0 }, { 6, 3, 0, 0 } } },
+   { 2, { 14, 18, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 4, 0, 0 }, { 0, 2, 0, 0 }, { 0, 6, 0, 0 }, { 0, 1, 0, 0 }, { 0, 5, 0, 0 }, { 0, 3, 0, 0 }, { 0, 7, 0, 0 }, { 4, 0, 0, 0 }, { 4, 4, 0, 0 }, { 4, 2, 0, 0 }, { 4, 6, 0, 0 }, { 4, 1, 0, 0 }, { 4, 5, 0, 0 }, { 4, 3, 0, 0 }, { 4, 7, 0, 0 } } },
+   { 4, { 6, 10, 14, 18 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 8 }, { 0, 0, 8, 0 }, { 0, 0, 8, 8 }, { 0, 8, 0, 0 }, { 0, 8, 0, 8 }, { 0, 8, 8, 0 }, { 0, 8, 8, 8 }, { 8, 0, 0, 0 }, { 8, 0, 0, 8 }, { 8, 0, 8, 0 }, { 8, 0, 8, 8 }, { 8, 8, 0, 0 }, { 8, 8, 0, 8 }, { 8, 8, 8, 0 }, { 8, 8, 8, 8 } } },
+   { 4, { 3, 7, 11, 15 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 4 }, { 0, 0, 4, 0 }, { 0, 0, 4, 4 }, { 0, 4, 0, 0 }, { 0, 4, 0, 4 }, { 0, 4, 4, 0 }, { 0, 4, 4, 4 }, { 4, 0, 0, 0 }, { 4, 0, 0, 4 }, { 4, 0, 4, 0 }, { 4, 0, 4, 4 }, { 4, 4, 0, 0 }, { 4, 4, 0, 4 }, { 4, 4, 4, 0 }, { 4, 4, 4, 4 } } },
+   { 4, { 2, 6, 10, 14 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 16 }, { 0, 0, 16, 0 }, { 0, 0, 16, 16 }, { 0, 16, 0, 0 }, { 0, 16, 0, 16 }, { 0, 16, 16, 0 }, { 0, 16, 16, 16 }, { 16, 0, 0, 0 }, { 16, 0, 0, 16 }, { 16, 0, 16, 0 }, { 16, 0, 16, 16 }, { 16, 16, 0, 0 }, { 16, 16, 0, 16 }, { 16, 16, 16, 0 }, { 16, 16, 16, 16 } } },
+   { 4, { 18, 3, 7, 11 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 2 }, { 0, 0, 2, 0 }, { 0, 0, 2, 2 }, { 0, 2, 0, 0 }, { 0, 2, 0, 2 }, { 0, 2, 2, 0 }, { 0, 2, 2, 2 }, { 16, 0, 0, 0 }, { 16, 0, 0, 2 }, { 16, 0, 2, 0 }, { 16, 0, 2, 2 }, { 16, 2, 0, 0 }, { 16, 2, 0, 2 }, { 16, 2, 2, 0 }, { 16, 2, 2, 2 } } },
+   { 2, { 2, 6, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 32, 0, 0 }, { 1, 0, 0, 0 }, { 1, 32, 0, 0 }, { 4, 0, 0, 0 }, { 4, 32, 0, 0 }, { 5, 0, 0, 0 }, { 5, 32, 0, 0 }, { 32, 0, 0, 0 }, { 32, 32, 0, 0 }, { 33, 0, 0, 0 }, { 33, 32, 0, 0 }, { 36, 0, 0, 0 }, { 36, 32, 0, 0 }, { 37, 0, 0, 0 }, { 37, 32, 0, 0 } } },
+   { 4, { 10, 14, 18, 2 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 2 }, { 0, 0, 32, 0 }, { 0, 0, 32, 2 }, { 0, 32, 0, 0 }, { 0, 32, 0, 2 }, { 0, 32, 32, 0 }, { 0, 32, 32, 2 }, { 32, 0, 0, 0 }, { 32, 0, 0, 2 }, { 32, 0, 32, 0 }, { 32, 0, 32, 2 }, { 32, 32, 0, 0 }, { 32, 32, 0, 2 }, { 32, 32, 32, 0 }, { 32, 32, 32, 2 } } },
+   { 4, { 3, 7, 11, 15 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 2 }, { 0, 0, 1, 0 }, { 0, 0, 1, 2 }, { 0, 1, 0, 0 }, { 0, 1, 0, 2 }, { 0, 1, 1, 0 }, { 0, 1, 1, 2 }, { 1, 0, 0, 0 }, { 1, 0, 0, 2 }, { 1, 0, 1, 0 }, { 1, 0, 1, 2 }, { 1, 1, 0, 0 }, { 1, 1, 0, 2 }, { 1, 1, 1, 0 }, { 1, 1, 1, 2 } } },
+   { 3, { 2, 15, 5, 0 }, { { 0, 0, 0, 0 }, { 0, 0, 1, 0 }, { 0, 1, 0, 0 }, { 0, 1, 1, 0 }, { 64, 0, 0, 0 }, { 64, 0, 1, 0 }, { 64, 1, 0, 0 }, { 64, 1, 1, 0 }, { 8, 0, 0, 0 }, { 8, 0, 1, 0 }, { 8, 1, 0, 0 }, { 8, 1, 1, 0 }, { 72, 0, 0, 0 }, { 72, 0, 1, 0 }, { 72, 1, 0, 0 }, { 72, 1, 1, 0 } } },
+   { 3, { 5, 9, 13, 0 }, { { 0, 0, 0, 0 }, { 0, 0, 1, 0 }, { 0, 2, 0, 0 }, { 0, 2, 1, 0 }, { 0, 1, 0, 0 }, { 0, 1, 1, 0 }, { 0, 3, 0, 0 }, { 0, 3, 1, 0 }, { 2, 0, 0, 0 }, { 2, 0, 1, 0 }, { 2, 2, 0, 0 }, { 2, 2, 1, 0 }, { 2, 1, 0, 0 }, { 2, 1, 1, 0 }, { 2, 3, 0, 0 }, { 2, 3, 1, 0 } } },
+   { 4, { 4, 8, 12, 16 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 4 }, { 0, 0, 4, 0 }, { 0, 0, 4, 4 }, { 0, 4, 0, 0 }, { 0, 4, 0, 4 }, { 0, 4, 4, 0 }, { 0, 4, 4, 4 }, { 4, 0, 0, 0 }, { 4, 0, 0, 4 }, { 4, 0, 4, 0 }, { 4, 0, 4, 4 }, { 4, 4, 0, 0 }, { 4, 4, 0, 4 }, { 4, 4, 4, 0 }, { 4, 4, 4, 4 } } },
+   { 3, { 13, 17, 4, 0 }, { { 0, 0, 0, 0 }, { 0, 0, 2, 0 }, { 0, 2, 0, 0 }, { 0, 2, 2, 0 }, { 0, 1, 0, 0 }, { 0, 1, 2, 0 }, { 0, 3, 0, 0 }, { 0, 3, 2, 0 }, { 2, 0, 0, 0 }, { 2, 0, 2, 0 }, { 2, 2, 0, 0 }, { 2, 2, 2, 0 }, { 2, 1, 0, 0 }, { 2, 1, 2, 0 }, { 2, 3, 0, 0 }, { 2, 3, 2, 0 } } },
+   { 4, { 8, 12, 16, 4 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 32 }, { 0, 0, 2, 0 }, { 0, 0, 2, 32 }, { 0, 2, 0, 0 }, { 0, 2, 0, 32 }, { 0, 2, 2, 0 }, { 0, 2, 2, 32 }, { 2, 0, 0, 0 }, { 2, 0, 0, 32 }, { 2, 0, 2, 0 }, { 2, 0, 2, 32 }, { 2, 2, 0, 0 }, { 2, 2, 0, 32 }, { 2, 2, 2, 0 }, { 2, 2, 2, 32 } } },
+   { 3, { 8, 4, 12, 0 }, { { 0, 0, 0, 0 }, { 0, 0, 32, 0 }, { 16, 0, 0, 0 }, { 16, 0, 32, 0 }, { 0, 16, 0, 0 }, { 0, 16, 32, 0 }, { 16, 16, 0, 0 }, { 16, 16, 32, 0 }, { 32, 0, 0, 0 }, { 32, 0, 32, 0 }, { 48, 0, 0, 0 }, { 48, 0, 32, 0 }, { 32, 16, 0, 0 }, { 32, 16, 32, 0 }, { 48, 16, 0, 0 }, { 48, 16, 32, 0 } } },
+   { 3, { 12, 16, 4, 0 }, { { 0, 0, 0, 0 }, { 0, 0, 64, 0 }, { 0, 16, 0, 0 }, { 0, 16, 64, 0 }, { 0, 32, 0, 0 }, { 0, 32, 64, 0 }, { 0, 48, 0, 0 }, { 0, 48, 64, 0 }, { 16, 0, 0, 0 }, { 16, 0, 64, 0 }, { 16, 16, 0, 0 }, { 16, 16, 64, 0 }, { 16, 32, 0, 0 }, { 16, 32, 64, 0 }, { 16, 48, 0, 0 }, { 16, 48, 64, 0 } } },
+   { 4, { 8, 12, 16, 4 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 1 }, { 0, 0, 64, 0 }, { 0, 0, 64, 1 }, { 0, 64, 0, 0 }, { 0, 64, 0, 1 }, { 0, 64, 64, 0 }, { 0, 64, 64, 1 }, { 64, 0, 0, 0 }, { 64, 0, 0, 1 }, { 64, 0, 64, 0 }, { 64, 0, 64, 1 }, { 64, 64, 0, 0 }, { 64, 64, 0, 1 }, { 64, 64, 64, 0 }, { 64, 64, 64, 1 } } },
+   { 4, { 8, 12, 16, 4 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 8 }, { 0, 0, 1, 0 }, { 0, 0, 1, 8 }, { 0, 1, 0, 0 }, { 0, 1, 0, 8 }, { 0, 1, 1, 0 }, { 0, 1, 1, 8 }, { 1, 0, 0, 0 }, { 1, 0, 0, 8 }, { 1, 0, 1, 0 }, { 1, 0, 1, 8 }, { 1, 1, 0, 0 }, { 1, 1, 0, 8 }, { 1, 1, 1, 0 }, { 1, 1, 1, 8 } } },
+   { 3, { 8, 12, 16, 0 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 0 }, { 0, 0, 8, 0 }, { 0, 0, 8, 0 }, { 0, 8, 0, 0 }, { 0, 8, 0, 0 }, { 0, 8, 8, 0 }, { 0, 8, 8, 0 }, { 8, 0, 0, 0 }, { 8, 0, 0, 0 }, { 8, 0, 8, 0 }, { 8, 0, 8, 0 }, { 8, 8, 0, 0 }, { 8, 8, 0, 0 }, { 8, 8, 8, 0 }, { 8, 8, 8, 0 } } },
+   /* MR59 */
+   { 1, { 0, 0, 0, 0 }, { { 0, 0, 0, 0 }, { 4, 0, 0, 0 }, { 8, 0, 0, 0 }, { 12, 0, 0, 0 }, { 64, 0, 0, 0 }, { 68, 0, 0, 0 }, { 72, 0, 0, 0 }, { 76, 0, 0, 0 }, { 128, 0, 0, 0 }, { 132, 0, 0, 0 }, { 136, 0, 0, 0 }, { 140, 0, 0, 0 }, { 192, 0, 0, 0 }, { 196, 0, 0, 0 }, { 200, 0, 0, 0 }, { 204, 0, 0, 0 } } },
+   { 1, { 0, 0, 0, 0 }, { { 0, 0, 0, 0 }, { 32, 0, 0, 0 }, { 1, 0, 0, 0 }, { 33, 0, 0, 0 }, { 2, 0, 0, 0 }, { 34, 0, 0, 0 }, { 3, 0, 0, 0 }, { 35, 0, 0, 0 }, { 16, 0, 0, 0 }, { 48, 0, 0, 0 }, { 17, 0, 0, 0 }, { 49, 0, 0, 0 }, { 18, 0, 0, 0 }, { 50, 0, 0, 0 }, { 19, 0, 0, 0 }, { 51, 0, 0, 0 } } },
+   { 1, { 1, 0, 0, 0 }, { { 0, 0, 0, 0 }, { 128, 0, 0, 0 }, { 256, 0, 0, 0 }, { 384, 0, 0, 0 }, { 2, 0, 0, 0 }, { 130, 0, 0, 0 }, { 258, 0, 0, 0 }, { 386, 0, 0, 0 }, { 8, 0, 0, 0 }, { 136, 0, 0, 0 }, { 264, 0, 0, 0 }, { 392, 0, 0, 0 }, { 10, 0, 0, 0 }, { 138, 0, 0, 0 }, { 266, 0, 0, 0 }, { 394, 0, 0, 0 } } },
+   { 1, { 1, 0, 0, 0 }, { { 0, 0, 0, 0 }, { 64, 0, 0, 0 }, { 4, 0, 0, 0 }, { 68, 0, 0, 0 }, { 16, 0, 0, 0 }, { 80, 0, 0, 0 }, { 20, 0, 0, 0 }, { 84, 0, 0, 0 }, { 32, 0, 0, 0 }, { 96, 0, 0, 0 }, { 36, 0, 0, 0 }, { 100, 0, 0, 0 }, { 48, 0, 0, 0 }, { 112, 0, 0, 0 }, { 52, 0, 0, 0 }, { 116, 0, 0, 0 } } },
+   { 3, { 1, 3, 11, 0 }, { { 0, 0, 0, 0 }, { 0, 16, 0, 0 }, { 0, 0, 32, 0 }, { 0, 16, 32, 0 }, { 0, 32, 0, 0 }, { 0, 48, 0, 0 }, { 0, 32, 32, 0 }, { 0, 48, 32, 0 }, { 1, 0, 0, 0 }, { 1, 16, 0, 0 }, { 1, 0, 32, 0 }, { 1, 16, 32, 0 }, { 1, 32, 0, 0 }, { 1, 48, 0, 0 }, { 1, 32, 32, 0 }, { 1, 48, 32, 0 } } },
+   { 2, { 11, 3, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 128, 0, 0 }, { 64, 0, 0, 0 }, { 64, 128, 0, 0 }, { 0, 64, 0, 0 }, { 0, 192, 0, 0 }, { 64, 64, 0, 0 }, { 64, 192, 0, 0 }, { 16, 0, 0, 0 }, { 16, 128, 0, 0 }, { 80, 0, 0, 0 }, { 80, 128, 0, 0 }, { 16, 64, 0, 0 }, { 16, 192, 0, 0 }, { 80, 64, 0, 0 }, { 80, 192, 0, 0 } } },
+   { 3, { 11, 3, 7, 0 }, { { 0, 0, 0, 0 }, { 0, 0, 8, 0 }, { 8, 0, 0, 0 }, { 8, 0, 8, 0 }, { 0, 8, 0, 0 }, { 0, 8, 8, 0 }, { 8, 8, 0, 0 }, { 8, 8, 8, 0 }, { 128, 0, 0, 0 }, { 128, 0, 8, 0 }, { 136, 0, 0, 0 }, { 136, 0, 8, 0 }, { 128, 8, 0, 0 }, { 128, 8, 8, 0 }, { 136, 8, 0, 0 }, { 136, 8, 8, 0 } } },
+   { 4, { 15, 6, 10, 14 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 1 }, { 0, 0, 1, 0 }, { 0, 0, 1, 1 }, { 0, 1, 0, 0 }, { 0, 1, 0, 1 }, { 0, 1, 1, 0 }, { 0, 1, 1, 1 }, { 8, 0, 0, 0 }, { 8, 0, 0, 1 }, { 8, 0, 1, 0 }, { 8, 0, 1, 1 }, { 8, 1, 0, 0 }, { 8, 1, 0, 1 }, { 8, 1, 1, 0 }, { 8, 1, 1, 1 } } },
+   { 4, { 18, 3, 11, 7 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 4 }, { 0, 0, 4, 0 }, { 0, 0, 4, 4 }, { 0, 4, 0, 0 }, { 0, 4, 0, 4 }, { 0, 4, 4, 0 }, { 0, 4, 4, 4 }, { 1, 0, 0, 0 }, { 1, 0, 0, 4 }, { 1, 0, 4, 0 }, { 1, 0, 4, 4 }, { 1, 4, 0, 0 }, { 1, 4, 0, 4 }, { 1, 4, 4, 0 }, { 1, 4, 4, 4 } } },
+   { 4, { 15, 6, 10, 14 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 2 }, { 0, 0, 2, 0 }, { 0, 0, 2, 2 }, { 0, 2, 0, 0 }, { 0, 2, 0, 2 }, { 0, 2, 2, 0 }, { 0, 2, 2, 2 }, { 4, 0, 0, 0 }, { 4, 0, 0, 2 }, { 4, 0, 2, 0 }, { 4, 0, 2, 2 }, { 4, 2, 0, 0 }, { 4, 2, 0, 2 }, { 4, 2, 2, 0 }, { 4, 2, 2, 2 } } },
+   { 4, { 18, 7, 15, 3 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 2 }, { 0, 0, 2, 0 }, { 0, 0, 2, 2 }, { 0, 2, 0, 0 }, { 0, 2, 0, 2 }, { 0, 2, 2, 0 }, { 0, 2, 2, 2 }, { 2, 0, 0, 0 }, { 2, 0, 0, 2 }, { 2, 0, 2, 0 }, { 2, 0, 2, 2 }, { 2, 2, 0, 0 }, { 2, 2, 0, 2 }, { 2, 2, 2, 0 }, { 2, 2, 2, 2 } } },
+   { 3, { 11, 3, 6, 0 }, { { 0, 0, 0, 0 }, { 0, 0, 4, 0 }, { 1, 0, 0, 0 }, { 1, 0, 4, 0 }, { 0, 1, 0, 0 }, { 0, 1, 4, 0 }, { 1, 1, 0, 0 }, { 1, 1, 4, 0 }, { 2, 0, 0, 0 }, { 2, 0, 4, 0 }, { 3, 0, 0, 0 }, { 3, 0, 4, 0 }, { 2, 1, 0, 0 }, { 2, 1, 4, 0 }, { 3, 1, 0, 0 }, { 3, 1, 4, 0 } } },
+   { 4, { 10, 14, 18, 6 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 8 }, { 0, 0, 4, 0 }, { 0, 0, 4, 8 }, { 0, 4, 0, 0 }, { 0, 4, 0, 8 }, { 0, 4, 4, 0 }, { 0, 4, 4, 8 }, { 4, 0, 0, 0 }, { 4, 0, 0, 8 }, { 4, 0, 4, 0 }, { 4, 0, 4, 8 }, { 4, 4, 0, 0 }, { 4, 4, 0, 8 }, { 4, 4, 4, 0 }, { 4, 4, 4, 8 } } },
+   { 4, { 10, 14, 18, 6 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 16 }, { 0, 0, 8, 0 }, { 0, 0, 8, 16 }, { 0, 8, 0, 0 }, { 0, 8, 0, 16 }, { 0, 8, 8, 0 }, { 0, 8, 8, 16 }, { 8, 0, 0, 0 }, { 8, 0, 0, 16 }, { 8, 0, 8, 0 }, { 8, 0, 8, 16 }, { 8, 8, 0, 0 }, { 8, 8, 0, 16 }, { 8, 8, 8, 0 }, { 8, 8, 8, 16 } } },
+   { 4, { 10, 14, 18, 2 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 64 }, { 0, 0, 16, 0 }, { 0, 0, 16, 64 }, { 0, 16, 0, 0 }, { 0, 16, 0, 64 }, { 0, 16, 16, 0 }, { 0, 16, 16, 64 }, { 16, 0, 0, 0 }, { 16, 0, 0, 64 }, { 16, 0, 16, 0 }, { 16, 0, 16, 64 }, { 16, 16, 0, 0 }, { 16, 16, 0, 64 }, { 16, 16, 16, 0 }, { 16, 16, 16, 64 } } },
+   { 1, { 2, 0, 0, 0 }, { { 0, 0, 0, 0 }, { 128, 0, 0, 0 }, { 8, 0, 0, 0 }, { 136, 0, 0, 0 }, { 4, 0, 0, 0 }, { 132, 0, 0, 0 }, { 12, 0, 0, 0 }, { 140, 0, 0, 0 }, { 16, 0, 0, 0 }, { 144, 0, 0, 0 }, { 24, 0, 0, 0 }, { 152, 0, 0, 0 }, { 20, 0, 0, 0 }, { 148, 0, 0, 0 }, { 28, 0, 0, 0 }, { 156, 0, 0, 0 } } },
+   { 2, { 2, 17, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 1, 0, 0 }, { 2, 0, 0, 0 }, { 2, 1, 0, 0 }, { 32, 0, 0, 0 }, { 32, 1, 0, 0 }, { 34, 0, 0, 0 }, { 34, 1, 0, 0 }, { 256, 0, 0, 0 }, { 256, 1, 0, 0 }, { 258, 0, 0, 0 }, { 258, 1, 0, 0 }, { 288, 0, 0, 0 }, { 288, 1, 0, 0 }, { 290, 0, 0, 0 }, { 290, 1, 0, 0 } } },
+   { 4, { 5, 13, 17, 9 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 2 }, { 0, 0, 2, 0 }, { 0, 0, 2, 2 }, { 0, 2, 0, 0 }, { 0, 2, 0, 2 }, { 0, 2, 2, 0 }, { 0, 2, 2, 2 }, { 2, 0, 0, 0 }, { 2, 0, 0, 2 }, { 2, 0, 2, 0 }, { 2, 0, 2, 2 }, { 2, 2, 0, 0 }, { 2, 2, 0, 2 }, { 2, 2, 2, 0 }, { 2, 2, 2, 2 } } },
+   { 4, { 9, 5, 13, 2 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 1 }, { 0, 0, 1, 0 }, { 0, 0, 1, 1 }, { 0, 1, 0, 0 }, { 0, 1, 0, 1 }, { 0, 1, 1, 0 }, { 0, 1, 1, 1 }, { 1, 0, 0, 0 }, { 1, 0, 0, 1 }, { 1, 0, 1, 0 }, { 1, 0, 1, 1 }, { 1, 1, 0, 0 }, { 1, 1, 0, 1 }, { 1, 1, 1, 0 }, { 1, 1, 1, 1 } } },
+   { 4, { 6, 10, 14, 18 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 32 }, { 0, 0, 32, 0 }, { 0, 0, 32, 32 }, { 0, 32, 0, 0 }, { 0, 32, 0, 32 }, { 0, 32, 32, 0 }, { 0, 32, 32, 32 }, { 32, 0, 0, 0 }, { 32, 0, 0, 32 }, { 32, 0, 32, 0 }, { 32, 0, 32, 32 }, { 32, 32, 0, 0 }, { 32, 32, 0, 32 }, { 32, 32, 32, 0 }, { 32, 32, 32, 32 } } },
+   { 4, { 7, 15, 4, 8 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 4 }, { 0, 0, 4, 0 }, { 0, 0, 4, 4 }, { 0, 1, 0, 0 }, { 0, 1, 0, 4 }, { 0, 1, 4, 0 }, { 0, 1, 4, 4 }, { 1, 0, 0, 0 }, { 1, 0, 0, 4 }, { 1, 0, 4, 0 }, { 1, 0, 4, 4 }, { 1, 1, 0, 0 }, { 1, 1, 0, 4 }, { 1, 1, 4, 0 }, { 1, 1, 4, 4 } } },
+   { 4, { 12, 16, 4, 8 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 8 }, { 0, 0, 8, 0 }, { 0, 0, 8, 8 }, { 0, 4, 0, 0 }, { 0, 4, 0, 8 }, { 0, 4, 8, 0 }, { 0, 4, 8, 8 }, { 4, 0, 0, 0 }, { 4, 0, 0, 8 }, { 4, 0, 8, 0 }, { 4, 0, 8, 8 }, { 4, 4, 0, 0 }, { 4, 4, 0, 8 }, { 4, 4, 8, 0 }, { 4, 4, 8, 8 } } },
+   { 4, { 12, 16, 4, 8 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 64 }, { 0, 0, 64, 0 }, { 0, 0, 64, 64 }, { 0, 8, 0, 0 }, { 0, 8, 0, 64 }, { 0, 8, 64, 0 }, { 0, 8, 64, 64 }, { 8, 0, 0, 0 }, { 8, 0, 0, 64 }, { 8, 0, 64, 0 }, { 8, 0, 64, 64 }, { 8, 8, 0, 0 }, { 8, 8, 0, 64 }, { 8, 8, 64, 0 }, { 8, 8, 64, 64 } } },
+   { 4, { 12, 16, 4, 8 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 128 }, { 0, 0, 128, 0 }, { 0, 0, 128, 128 }, { 0, 64, 0, 0 }, { 0, 64, 0, 128 }, { 0, 64, 128, 0 }, { 0, 64, 128, 128 }, { 64, 0, 0, 0 }, { 64, 0, 0, 128 }, { 64, 0, 128, 0 }, { 64, 0, 128, 128 }, { 64, 64, 0, 0 }, { 64, 64, 0, 128 }, { 64, 64, 128, 0 }, { 64, 64, 128, 128 } } },
+   { 4, { 12, 16, 4, 8 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 256 }, { 0, 0, 256, 0 }, { 0, 0, 256, 256 }, { 0, 128, 0, 0 }, { 0, 128, 0, 256 }, { 0, 128, 256, 0 }, { 0, 128, 256, 256 }, { 128, 0, 0, 0 }, { 128, 0, 0, 256 }, { 128, 0, 256, 0 }, { 128, 0, 256, 256 }, { 128, 128, 0, 0 }, { 128, 128, 0, 256 }, { 128, 128, 256, 0 }, { 128, 128, 256, 256 } } },
+   { 4, { 12, 16, 4, 8 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 1 }, { 0, 0, 1, 0 }, { 0, 0, 1, 1 }, { 0, 256, 0, 0 }, { 0, 256, 0, 1 }, { 0, 256, 1, 0 }, { 0, 256, 1, 1 }, { 256, 0, 0, 0 }, { 256, 0, 0, 1 }, { 256, 0, 1, 0 }, { 256, 0, 1, 1 }, { 256, 256, 0, 0 }, { 256, 256, 0, 1 }, { 256, 256, 1, 0 }, { 256, 256, 1, 1 } } },
+   { 4, { 12, 16, 4, 8 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 2 }, { 0, 0, 2, 0 }, { 0, 0, 2, 2 }, { 0, 1, 0, 0 }, { 0, 1, 0, 2 }, { 0, 1, 2, 0 }, { 0, 1, 2, 2 }, { 1, 0, 0, 0 }, { 1, 0, 0, 2 }, { 1, 0, 2, 0 }, { 1, 0, 2, 2 }, { 1, 1, 0, 0 }, { 1, 1, 0, 2 }, { 1, 1, 2, 0 }, { 1, 1, 2, 2 } } },
+   { 4, { 12, 16, 4, 8 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 16 }, { 0, 0, 16, 0 }, { 0, 0, 16, 16 }, { 0, 2, 0, 0 }, { 0, 2, 0, 16 }, { 0, 2, 16, 0 }, { 0, 2, 16, 16 }, { 2, 0, 0, 0 }, { 2, 0, 0, 16 }, { 2, 0, 16, 0 }, { 2, 0, 16, 16 }, { 2, 2, 0, 0 }, { 2, 2, 0, 16 }, { 2, 2, 16, 0 }, { 2, 2, 16, 16 } } },
+   { 4, { 12, 16, 4, 8 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 32 }, { 0, 0, 32, 0 }, { 0, 0, 32, 32 }, { 0, 16, 0, 0 }, { 0, 16, 0, 32 }, { 0, 16, 32, 0 }, { 0, 16, 32, 32 }, { 16, 0, 0, 0 }, { 16, 0, 0, 32 }, { 16, 0, 32, 0 }, { 16, 0, 32, 32 }, { 16, 16, 0, 0 }, { 16, 16, 0, 32 }, { 16, 16, 32, 0 }, { 16, 16, 32, 32 } } },
+   { 2, { 12, 16, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 0 }, { 0, 0, 0, 0 }, { 0, 0, 0, 0 }, { 0, 32, 0, 0 }, { 0, 32, 0, 0 }, { 0, 32, 0, 0 }, { 0, 32, 0, 0 }, { 32, 0, 0, 0 }, { 32, 0, 0, 0 }, { 32, 0, 0, 0 }, { 32, 0, 0, 0 }, { 32, 32, 0, 0 }, { 32, 32, 0, 0 }, { 32, 32, 0, 0 }, { 32, 32, 0, 0 } } },
+   /* MR67 */
+   { 1, { 0, 0, 0, 0 }, { { 0, 0, 0, 0 }, { 16, 0, 0, 0 }, { 8, 0, 0, 0 }, { 24, 0, 0, 0 }, { 64, 0, 0, 0 }, { 80, 0, 0, 0 }, { 72, 0, 0, 0 }, { 88, 0, 0, 0 }, { 128, 0, 0, 0 }, { 144, 0, 0, 0 }, { 136, 0, 0, 0 }, { 152, 0, 0, 0 }, { 192, 0, 0, 0 }, { 208, 0, 0, 0 }, { 200, 0, 0, 0 }, { 216, 0, 0, 0 } } },
+   { 2, { 0, 1, 0, 0 }, { { 0, 0, 0, 0 }, { 1, 0, 0, 0 }, { 0, 8, 0, 0 }, { 1, 8, 0, 0 }, { 2, 0, 0, 0 }, { 3, 0, 0, 0 }, { 2, 8, 0, 0 }, { 3, 8, 0, 0 }, { 4, 0, 0, 0 }, { 5, 0, 0, 0 }, { 4, 8, 0, 0 }, { 5, 8, 0, 0 }, { 6, 0, 0, 0 }, { 7, 0, 0, 0 }, { 6, 8, 0, 0 }, { 7, 8, 0, 0 } } },
+   { 2, { 0, 1, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 32, 0, 0 }, { 0, 128, 0, 0 }, { 0, 160, 0, 0 }, { 0, 256, 0, 0 }, { 0, 288, 0, 0 }, { 0, 384, 0, 0 }, { 0, 416, 0, 0 }, { 32, 0, 0, 0 }, { 32, 32, 0, 0 }, { 32, 128, 0, 0 }, { 32, 160, 0, 0 }, { 32, 256, 0, 0 }, { 32, 288, 0, 0 }, { 32, 384, 0, 0 }, { 32, 416, 0, 0 } } },
+   { 1, { 1, 0, 0, 0 }, { { 0, 0, 0, 0 }, { 64, 0, 0, 0 }, { 4, 0, 0, 0 }, { 68, 0, 0, 0 }, { 16, 0, 0, 0 }, { 80, 0, 0, 0 }, { 20, 0, 0, 0 }, { 84, 0, 0, 0 }, { 2, 0, 0, 0 }, { 66, 0, 0, 0 }, { 6, 0, 0, 0 }, { 70, 0, 0, 0 }, { 18, 0, 0, 0 }, { 82, 0, 0, 0 }, { 22, 0, 0, 0 }, { 86, 0, 0, 0 } } },
+   { 2, { 3, 11, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 16, 0, 0 }, { 16, 0, 0, 0 }, { 16, 16, 0, 0 }, { 0, 32, 0, 0 }, { 0, 48, 0, 0 }, { 16, 32, 0, 0 }, { 16, 48, 0, 0 }, { 32, 0, 0, 0 }, { 32, 16, 0, 0 }, { 48, 0, 0, 0 }, { 48, 16, 0, 0 }, { 32, 32, 0, 0 }, { 32, 48, 0, 0 }, { 48, 32, 0, 0 }, { 48, 48, 0, 0 } } },
+   { 2, { 3, 11, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 128, 0, 0 }, { 128, 0, 0, 0 }, { 128, 128, 0, 0 }, { 0, 64, 0, 0 }, { 0, 192, 0, 0 }, { 128, 64, 0, 0 }, { 128, 192, 0, 0 }, { 64, 0, 0, 0 }, { 64, 128, 0, 0 }, { 192, 0, 0, 0 }, { 192, 128, 0, 0 }, { 64, 64, 0, 0 }, { 64, 192, 0, 0 }, { 192, 64, 0, 0 }, { 192, 192, 0, 0 } } },
+   { 4, { 3, 11, 1, 7 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 8 }, { 0, 0, 1, 0 }, { 0, 0, 1, 8 }, { 0, 8, 0, 0 }, { 0, 8, 0, 8 }, { 0, 8, 1, 0 }, { 0, 8, 1, 8 }, { 8, 0, 0, 0 }, { 8, 0, 0, 8 }, { 8, 0, 1, 0 }, { 8, 0, 1, 8 }, { 8, 8, 0, 0 }, { 8, 8, 0, 8 }, { 8, 8, 1, 0 }, { 8, 8, 1, 8 } } },
+   { 3, { 15, 7, 3, 0 }, { { 0, 0, 0, 0 }, { 0, 0, 4, 0 }, { 4, 0, 0, 0 }, { 4, 0, 4, 0 }, { 0, 4, 0, 0 }, { 0, 4, 4, 0 }, { 4, 4, 0, 0 }, { 4, 4, 4, 0 }, { 8, 0, 0, 0 }, { 8, 0, 4, 0 }, { 12, 0, 0, 0 }, { 12, 0, 4, 0 }, { 8, 4, 0, 0 }, { 8, 4, 4, 0 }, { 12, 4, 0, 0 }, { 12, 4, 4, 0 } } },
+   { 4, { 11, 7, 15, 6 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 64 }, { 0, 0, 2, 0 }, { 0, 0, 2, 64 }, { 0, 2, 0, 0 }, { 0, 2, 0, 64 }, { 0, 2, 2, 0 }, { 0, 2, 2, 64 }, { 4, 0, 0, 0 }, { 4, 0, 0, 64 }, { 4, 0, 2, 0 }, { 4, 0, 2, 64 }, { 4, 2, 0, 0 }, { 4, 2, 0, 64 }, { 4, 2, 2, 0 }, { 4, 2, 2, 64 } } },
+   { 4, { 10, 14, 18, 3 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 2 }, { 0, 0, 64, 0 }, { 0, 0, 64, 2 }, { 0, 64, 0, 0 }, { 0, 64, 0, 2 }, { 0, 64, 64, 0 }, { 0, 64, 64, 2 }, { 64, 0, 0, 0 }, { 64, 0, 0, 2 }, { 64, 0, 64, 0 }, { 64, 0, 64, 2 }, { 64, 64, 0, 0 }, { 64, 64, 0, 2 }, { 64, 64, 64, 0 }, { 64, 64, 64, 2 } } },
+   { 4, { 11, 6, 10, 14 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 8 }, { 0, 0, 8, 0 }, { 0, 0, 8, 8 }, { 0, 8, 0, 0 }, { 0, 8, 0, 8 }, { 0, 8, 8, 0 }, { 0, 8, 8, 8 }, { 2, 0, 0, 0 }, { 2, 0, 0, 8 }, { 2, 0, 8, 0 }, { 2, 0, 8, 8 }, { 2, 8, 0, 0 }, { 2, 8, 0, 8 }, { 2, 8, 8, 0 }, { 2, 8, 8, 8 } } },
+   { 4, { 18, 6, 10, 14 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 4 }, { 0, 0, 4, 0 }, { 0, 0, 4, 4 }, { 0, 4, 0, 0 }, { 0, 4, 0, 4 }, { 0, 4, 4, 0 }, { 0, 4, 4, 4 }, { 8, 0, 0, 0 }, { 8, 0, 0, 4 }, { 8, 0, 4, 0 }, { 8, 0, 4, 4 }, { 8, 4, 0, 0 }, { 8, 4, 0, 4 }, { 8, 4, 4, 0 }, { 8, 4, 4, 4 } } },
+   { 4, { 18, 7, 15, 3 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 1 }, { 0, 0, 1, 0 }, { 0, 0, 1, 1 }, { 0, 1, 0, 0 }, { 0, 1, 0, 1 }, { 0, 1, 1, 0 }, { 0, 1, 1, 1 }, { 4, 0, 0, 0 }, { 4, 0, 0, 1 }, { 4, 0, 1, 0 }, { 4, 0, 1, 1 }, { 4, 1, 0, 0 }, { 4, 1, 0, 1 }, { 4, 1, 1, 0 }, { 4, 1, 1, 1 } } },
+   { 3, { 11, 2, 6, 0 }, { { 0, 0, 0, 0 }, { 0, 0, 2, 0 }, { 0, 4, 0, 0 }, { 0, 4, 2, 0 }, { 0, 64, 0, 0 }, { 0, 64, 2, 0 }, { 0, 68, 0, 0 }, { 0, 68, 2, 0 }, { 1, 0, 0, 0 }, { 1, 0, 2, 0 }, { 1, 4, 0, 0 }, { 1, 4, 2, 0 }, { 1, 64, 0, 0 }, { 1, 64, 2, 0 }, { 1, 68, 0, 0 }, { 1, 68, 2, 0 } } },
+   { 4, { 10, 14, 18, 2 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 16 }, { 0, 0, 2, 0 }, { 0, 0, 2, 16 }, { 0, 2, 0, 0 }, { 0, 2, 0, 16 }, { 0, 2, 2, 0 }, { 0, 2, 2, 16 }, { 2, 0, 0, 0 }, { 2, 0, 0, 16 }, { 2, 0, 2, 0 }, { 2, 0, 2, 16 }, { 2, 2, 0, 0 }, { 2, 2, 0, 16 }, { 2, 2, 2, 0 }, { 2, 2, 2, 16 } } },
+   { 1, { 2, 0, 0, 0 }, { { 0, 0, 0, 0 }, { 32, 0, 0, 0 }, { 256, 0, 0, 0 }, { 288, 0, 0, 0 }, { 128, 0, 0, 0 }, { 160, 0, 0, 0 }, { 384, 0, 0, 0 }, { 416, 0, 0, 0 }, { 8, 0, 0, 0 }, { 40, 0, 0, 0 }, { 264, 0, 0, 0 }, { 296, 0, 0, 0 }, { 136, 0, 0, 0 }, { 168, 0, 0, 0 }, { 392, 0, 0, 0 }, { 424, 0, 0, 0 } } },
+   { 3, { 2, 6, 10, 0 }, { { 0, 0, 0, 0 }, { 0, 0, 16, 0 }, { 0, 16, 0, 0 }, { 0, 16, 16, 0 }, { 1, 0, 0, 0 }, { 1, 0, 16, 0 }, { 1, 16, 0, 0 }, { 1, 16, 16, 0 }, { 2, 0, 0, 0 }, { 2, 0, 16, 0 }, { 2, 16, 0, 0 }, { 2, 16, 16, 0 }, { 3, 0, 0, 0 }, { 3, 0, 16, 0 }, { 3, 16, 0, 0 }, { 3, 16, 16, 0 } } },
+   { 4, { 14, 18, 5, 9 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 1 }, { 0, 0, 1, 0 }, { 0, 0, 1, 1 }, { 0, 16, 0, 0 }, { 0, 16, 0, 1 }, { 0, 16, 1, 0 }, { 0, 16, 1, 1 }, { 16, 0, 0, 0 }, { 16, 0, 0, 1 }, { 16, 0, 1, 0 }, { 16, 0, 1, 1 }, { 16, 16, 0, 0 }, { 16, 16, 0, 1 }, { 16, 16, 1, 0 }, { 16, 16, 1, 1 } } },
+   { 4, { 13, 17, 6, 10 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 1 }, { 0, 0, 1, 0 }, { 0, 0, 1, 1 }, { 0, 1, 0, 0 }, { 0, 1, 0, 1 }, { 0, 1, 1, 0 }, { 0, 1, 1, 1 }, { 1, 0, 0, 0 }, { 1, 0, 0, 1 }, { 1, 0, 1, 0 }, { 1, 0, 1, 1 }, { 1, 1, 0, 0 }, { 1, 1, 0, 1 }, { 1, 1, 1, 0 }, { 1, 1, 1, 1 } } },
+   { 4, { 14, 18, 5, 9 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 2 }, { 0, 0, 2, 0 }, { 0, 0, 2, 2 }, { 0, 1, 0, 0 }, { 0, 1, 0, 2 }, { 0, 1, 2, 0 }, { 0, 1, 2, 2 }, { 1, 0, 0, 0 }, { 1, 0, 0, 2 }, { 1, 0, 2, 0 }, { 1, 0, 2, 2 }, { 1, 1, 0, 0 }, { 1, 1, 0, 2 }, { 1, 1, 2, 0 }, { 1, 1, 2, 2 } } },
+   { 4, { 13, 17, 18, 14 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 32 }, { 0, 0, 32, 0 }, { 0, 0, 32, 32 }, { 0, 2, 0, 0 }, { 0, 2, 0, 32 }, { 0, 2, 32, 0 }, { 0, 2, 32, 32 }, { 2, 0, 0, 0 }, { 2, 0, 0, 32 }, { 2, 0, 32, 0 }, { 2, 0, 32, 32 }, { 2, 2, 0, 0 }, { 2, 2, 0, 32 }, { 2, 2, 32, 0 }, { 2, 2, 32, 32 } } },
+   { 4, { 10, 6, 5, 9 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 4 }, { 0, 0, 4, 0 }, { 0, 0, 4, 4 }, { 0, 32, 0, 0 }, { 0, 32, 0, 4 }, { 0, 32, 4, 0 }, { 0, 32, 4, 4 }, { 32, 0, 0, 0 }, { 32, 0, 0, 4 }, { 32, 0, 4, 0 }, { 32, 0, 4, 4 }, { 32, 32, 0, 0 }, { 32, 32, 0, 4 }, { 32, 32, 4, 0 }, { 32, 32, 4, 4 } } },
+   { 4, { 13, 17, 4, 8 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 4 }, { 0, 0, 4, 0 }, { 0, 0, 4, 4 }, { 0, 4, 0, 0 }, { 0, 4, 0, 4 }, { 0, 4, 4, 0 }, { 0, 4, 4, 4 }, { 4, 0, 0, 0 }, { 4, 0, 0, 4 }, { 4, 0, 4, 0 }, { 4, 0, 4, 4 }, { 4, 4, 0, 0 }, { 4, 4, 0, 4 }, { 4, 4, 4, 0 }, { 4, 4, 4, 4 } } },
+   { 4, { 12, 16, 4, 8 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 32 }, { 0, 0, 32, 0 }, { 0, 0, 32, 32 }, { 0, 4, 0, 0 }, { 0, 4, 0, 32 }, { 0, 4, 32, 0 }, { 0, 4, 32, 32 }, { 4, 0, 0, 0 }, { 4, 0, 0, 32 }, { 4, 0, 32, 0 }, { 4, 0, 32, 32 }, { 4, 4, 0, 0 }, { 4, 4, 0, 32 }, { 4, 4, 32, 0 }, { 4, 4, 32, 32 } } },
+   { 4, { 12, 16, 4, 8 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 64 }, { 0, 0, 64, 0 }, { 0, 0, 64, 64 }, { 0, 32, 0, 0 }, { 0, 32, 0, 64 }, { 0, 32, 64, 0 }, { 0, 32, 64, 64 }, { 32, 0, 0, 0 }, { 32, 0, 0, 64 }, { 32, 0, 64, 0 }, { 32, 0, 64, 64 }, { 32, 32, 0, 0 }, { 32, 32, 0, 64 }, { 32, 32, 64, 0 }, { 32, 32, 64, 64 } } },
+   { 4, { 12, 16, 4, 8 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 512 }, { 0, 0, 512, 0 }, { 0, 0, 512, 512 }, { 0, 64, 0, 0 }, { 0, 64, 0, 512 }, { 0, 64, 512, 0 }, { 0, 64, 512, 512 }, { 64, 0, 0, 0 }, { 64, 0, 0, 512 }, { 64, 0, 512, 0 }, { 64, 0, 512, 512 }, { 64, 64, 0, 0 }, { 64, 64, 0, 512 }, { 64, 64, 512, 0 }, { 64, 64, 512, 512 } } },
+   { 4, { 12, 16, 4, 8 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 1024 }, { 0, 0, 1024, 0 }, { 0, 0, 1024, 1024 }, { 0, 512, 0, 0 }, { 0, 512, 0, 1024 }, { 0, 512, 1024, 0 }, { 0, 512, 1024, 1024 }, { 512, 0, 0, 0 }, { 512, 0, 0, 1024 }, { 512, 0, 1024, 0 }, { 512, 0, 1024, 1024 }, { 512, 512, 0, 0 }, { 512, 512, 0, 1024 }, { 512, 512, 1024, 0 }, { 512, 512, 1024, 1024 } } },
+   { 4, { 12, 16, 4, 8 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 1 }, { 0, 0, 1, 0 }, { 0, 0, 1, 1 }, { 0, 1024, 0, 0 }, { 0, 1024, 0, 1 }, { 0, 1024, 1, 0 }, { 0, 1024, 1, 1 }, { 1024, 0, 0, 0 }, { 1024, 0, 0, 1 }, { 1024, 0, 1, 0 }, { 1024, 0, 1, 1 }, { 1024, 1024, 0, 0 }, { 1024, 1024, 0, 1 }, { 1024, 1024, 1, 0 }, { 1024, 1024, 1, 1 } } },
+   { 4, { 12, 16, 4, 8 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 2 }, { 0, 0, 2, 0 }, { 0, 0, 2, 2 }, { 0, 1, 0, 0 }, { 0, 1, 0, 2 }, { 0, 1, 2, 0 }, { 0, 1, 2, 2 }, { 1, 0, 0, 0 }, { 1, 0, 0, 2 }, { 1, 0, 2, 0 }, { 1, 0, 2, 2 }, { 1, 1, 0, 0 }, { 1, 1, 0, 2 }, { 1, 1, 2, 0 }, { 1, 1, 2, 2 } } },
+   { 4, { 12, 16, 4, 8 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 8 }, { 0, 0, 8, 0 }, { 0, 0, 8, 8 }, { 0, 2, 0, 0 }, { 0, 2, 0, 8 }, { 0, 2, 8, 0 }, { 0, 2, 8, 8 }, { 2, 0, 0, 0 }, { 2, 0, 0, 8 }, { 2, 0, 8, 0 }, { 2, 0, 8, 8 }, { 2, 2, 0, 0 }, { 2, 2, 0, 8 }, { 2, 2, 8, 0 }, { 2, 2, 8, 8 } } },
+   { 4, { 12, 16, 4, 8 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 16 }, { 0, 0, 16, 0 }, { 0, 0, 16, 16 }, { 0, 8, 0, 0 }, { 0, 8, 0, 16 }, { 0, 8, 16, 0 }, { 0, 8, 16, 16 }, { 8, 0, 0, 0 }, { 8, 0, 0, 16 }, { 8, 0, 16, 0 }, { 8, 0, 16, 16 }, { 8, 8, 0, 0 }, { 8, 8, 0, 16 }, { 8, 8, 16, 0 }, { 8, 8, 16, 16 } } },
+   { 4, { 12, 16, 4, 8 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 128 }, { 0, 0, 128, 0 }, { 0, 0, 128, 128 }, { 0, 16, 0, 0 }, { 0, 16, 0, 128 }, { 0, 16, 128, 0 }, { 0, 16, 128, 128 }, { 16, 0, 0, 0 }, { 16, 0, 0, 128 }, { 16, 0, 128, 0 }, { 16, 0, 128, 128 }, { 16, 16, 0, 0 }, { 16, 16, 0, 128 }, { 16, 16, 128, 0 }, { 16, 16, 128, 128 } } },
+   { 4, { 12, 16, 4, 8 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 256 }, { 0, 0, 256, 0 }, { 0, 0, 256, 256 }, { 0, 128, 0, 0 }, { 0, 128, 0, 256 }, { 0, 128, 256, 0 }, { 0, 128, 256, 256 }, { 128, 0, 0, 0 }, { 128, 0, 0, 256 }, { 128, 0, 256, 0 }, { 128, 0, 256, 256 }, { 128, 128, 0, 0 }, { 128, 128, 0, 256 }, { 128, 128, 256, 0 }, { 128, 128, 256, 256 } } },
+   { 2, { 12, 16, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 0 }, { 0, 0, 0, 0 }, { 0, 0, 0, 0 }, { 0, 256, 0, 0 }, { 0, 256, 0, 0 }, { 0, 256, 0, 0 }, { 0, 256, 0, 0 }, { 256, 0, 0, 0 }, { 256, 0, 0, 0 }, { 256, 0, 0, 0 }, { 256, 0, 0, 0 }, { 256, 256, 0, 0 }, { 256, 256, 0, 0 }, { 256, 256, 0, 0 }, { 256, 256, 0, 0 } } },
+   /* MR74 */
+   { 1, { 0, 0, 0, 0 }, { { 0, 0, 0, 0 }, { 16, 0, 0, 0 }, { 32, 0, 0, 0 }, { 48, 0, 0, 0 }, { 64, 0, 0, 0 }, { 80, 0, 0, 0 }, { 96, 0, 0, 0 }, { 112, 0, 0, 0 }, { 128, 0, 0, 0 }, { 144, 0, 0, 0 }, { 160, 0, 0, 0 }, { 176, 0, 0, 0 }, { 192, 0, 0, 0 }, { 208, 0, 0, 0 }, { 224, 0, 0, 0 }, { 240, 0, 0, 0 } } },
+   { 1, { 0, 0, 0, 0 }, { { 0, 0, 0, 0 }, { 1, 0, 0, 0 }, { 2, 0, 0, 0 }, { 3, 0, 0, 0 }, { 4, 0, 0, 0 }, { 5, 0, 0, 0 }, { 6, 0, 0, 0 }, { 7, 0, 0, 0 }, { 8, 0, 0, 0 }, { 9, 0, 0, 0 }, { 10, 0, 0, 0 }, { 11, 0, 0, 0 }, { 12, 0, 0, 0 }, { 13, 0, 0, 0 }, { 14, 0, 0, 0 }, { 15, 0, 0, 0 } } },
+   { 1, { 1, 0, 0, 0 }, { { 0, 0, 0, 0 }, { 32, 0, 0, 0 }, { 64, 0, 0, 0 }, { 96, 0, 0, 0 }, { 128, 0, 0, 0 }, { 160, 0, 0, 0 }, { 192, 0, 0, 0 }, { 224, 0, 0, 0 }, { 256, 0, 0, 0 }, { 288, 0, 0, 0 }, { 320, 0, 0, 0 }, { 352, 0, 0, 0 }, { 384, 0, 0, 0 }, { 416, 0, 0, 0 }, { 448, 0, 0, 0 }, { 480, 0, 0, 0 } } },
+   { 1, { 1, 0, 0, 0 }, { { 0, 0, 0, 0 }, { 2, 0, 0, 0 }, { 4, 0, 0, 0 }, { 6, 0, 0, 0 }, { 8, 0, 0, 0 }, { 10, 0, 0, 0 }, { 12, 0, 0, 0 }, { 14, 0, 0, 0 }, { 16, 0, 0, 0 }, { 18, 0, 0, 0 }, { 20, 0, 0, 0 }, { 22, 0, 0, 0 }, { 24, 0, 0, 0 }, { 26, 0, 0, 0 }, { 28, 0, 0, 0 }, { 30, 0, 0, 0 } } },
+   { 3, { 1, 3, 11, 0 }, { { 0, 0, 0, 0 }, { 0, 64, 0, 0 }, { 0, 0, 128, 0 }, { 0, 64, 128, 0 }, { 0, 128, 0, 0 }, { 0, 192, 0, 0 }, { 0, 128, 128, 0 }, { 0, 192, 128, 0 }, { 1, 0, 0, 0 }, { 1, 64, 0, 0 }, { 1, 0, 128, 0 }, { 1, 64, 128, 0 }, { 1, 128, 0, 0 }, { 1, 192, 0, 0 }, { 1, 128, 128, 0 }, { 1, 192, 128, 0 } } },
+   { 2, { 11, 3, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 16, 0, 0 }, { 32, 0, 0, 0 }, { 32, 16, 0, 0 }, { 0, 32, 0, 0 }, { 0, 48, 0, 0 }, { 32, 32, 0, 0 }, { 32, 48, 0, 0 }, { 64, 0, 0, 0 }, { 64, 16, 0, 0 }, { 96, 0, 0, 0 }, { 96, 16, 0, 0 }, { 64, 32, 0, 0 }, { 64, 48, 0, 0 }, { 96, 32, 0, 0 }, { 96, 48, 0, 0 } } },
+   { 3, { 11, 3, 6, 0 }, { { 0, 0, 0, 0 }, { 0, 0, 64, 0 }, { 8, 0, 0, 0 }, { 8, 0, 64, 0 }, { 0, 8, 0, 0 }, { 0, 8, 64, 0 }, { 8, 8, 0, 0 }, { 8, 8, 64, 0 }, { 16, 0, 0, 0 }, { 16, 0, 64, 0 }, { 24, 0, 0, 0 }, { 24, 0, 64, 0 }, { 16, 8, 0, 0 }, { 16, 8, 64, 0 }, { 24, 8, 0, 0 }, { 24, 8, 64, 0 } } },
+   { 4, { 10, 14, 18, 6 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 32 }, { 0, 0, 64, 0 }, { 0, 0, 64, 32 }, { 0, 64, 0, 0 }, { 0, 64, 0, 32 }, { 0, 64, 64, 0 }, { 0, 64, 64, 32 }, { 64, 0, 0, 0 }, { 64, 0, 0, 32 }, { 64, 0, 64, 0 }, { 64, 0, 64, 32 }, { 64, 64, 0, 0 }, { 64, 64, 0, 32 }, { 64, 64, 64, 0 }, { 64, 64, 64, 32 } } },
+   { 4, { 10, 14, 18, 6 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 8 }, { 0, 0, 32, 0 }, { 0, 0, 32, 8 }, { 0, 32, 0, 0 }, { 0, 32, 0, 8 }, { 0, 32, 32, 0 }, { 0, 32, 32, 8 }, { 32, 0, 0, 0 }, { 32, 0, 0, 8 }, { 32, 0, 32, 0 }, { 32, 0, 32, 8 }, { 32, 32, 0, 0 }, { 32, 32, 0, 8 }, { 32, 32, 32, 0 }, { 32, 32, 32, 8 } } },
+   { 4, { 10, 14, 18, 6 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 4 }, { 0, 0, 8, 0 }, { 0, 0, 8, 4 }, { 0, 8, 0, 0 }, { 0, 8, 0, 4 }, { 0, 8, 8, 0 }, { 0, 8, 8, 4 }, { 8, 0, 0, 0 }, { 8, 0, 0, 4 }, { 8, 0, 8, 0 }, { 8, 0, 8, 4 }, { 8, 8, 0, 0 }, { 8, 8, 0, 4 }, { 8, 8, 8, 0 }, { 8, 8, 8, 4 } } },
+   { 4, { 10, 14, 18, 7 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 16 }, { 0, 0, 4, 0 }, { 0, 0, 4, 16 }, { 0, 4, 0, 0 }, { 0, 4, 0, 16 }, { 0, 4, 4, 0 }, { 0, 4, 4, 16 }, { 4, 0, 0, 0 }, { 4, 0, 0, 16 }, { 4, 0, 4, 0 }, { 4, 0, 4, 16 }, { 4, 4, 0, 0 }, { 4, 4, 0, 16 }, { 4, 4, 4, 0 }, { 4, 4, 4, 16 } } },
+   { 3, { 15, 7, 2, 0 }, { { 0, 0, 0, 0 }, { 0, 0, 16, 0 }, { 8, 0, 0, 0 }, { 8, 0, 16, 0 }, { 0, 8, 0, 0 }, { 0, 8, 16, 0 }, { 8, 8, 0, 0 }, { 8, 8, 16, 0 }, { 16, 0, 0, 0 }, { 16, 0, 16, 0 }, { 24, 0, 0, 0 }, { 24, 0, 16, 0 }, { 16, 8, 0, 0 }, { 16, 8, 16, 0 }, { 24, 8, 0, 0 }, { 24, 8, 16, 0 } } },
+   { 1, { 2, 0, 0, 0 }, { { 0, 0, 0, 0 }, { 128, 0, 0, 0 }, { 256, 0, 0, 0 }, { 384, 0, 0, 0 }, { 4, 0, 0, 0 }, { 132, 0, 0, 0 }, { 260, 0, 0, 0 }, { 388, 0, 0, 0 }, { 8, 0, 0, 0 }, { 136, 0, 0, 0 }, { 264, 0, 0, 0 }, { 392, 0, 0, 0 }, { 12, 0, 0, 0 }, { 140, 0, 0, 0 }, { 268, 0, 0, 0 }, { 396, 0, 0, 0 } } },
+   { 4, { 2, 3, 7, 11 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 4 }, { 0, 0, 4, 0 }, { 0, 0, 4, 4 }, { 0, 4, 0, 0 }, { 0, 4, 0, 4 }, { 0, 4, 4, 0 }, { 0, 4, 4, 4 }, { 64, 0, 0, 0 }, { 64, 0, 0, 4 }, { 64, 0, 4, 0 }, { 64, 0, 4, 4 }, { 64, 4, 0, 0 }, { 64, 4, 0, 4 }, { 64, 4, 4, 0 }, { 64, 4, 4, 4 } } },
+   { 4, { 15, 6, 10, 14 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 2 }, { 0, 0, 2, 0 }, { 0, 0, 2, 2 }, { 0, 2, 0, 0 }, { 0, 2, 0, 2 }, { 0, 2, 2, 0 }, { 0, 2, 2, 2 }, { 4, 0, 0, 0 }, { 4, 0, 0, 2 }, { 4, 0, 2, 0 }, { 4, 0, 2, 2 }, { 4, 2, 0, 0 }, { 4, 2, 0, 2 }, { 4, 2, 2, 0 }, { 4, 2, 2, 2 } } },
+   { 2, { 18, 2, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 1, 0, 0 }, { 0, 2, 0, 0 }, { 0, 3, 0, 0 }, { 0, 32, 0, 0 }, { 0, 33, 0, 0 }, { 0, 34, 0, 0 }, { 0, 35, 0, 0 }, { 2, 0, 0, 0 }, { 2, 1, 0, 0 }, { 2, 2, 0, 0 }, { 2, 3, 0, 0 }, { 2, 32, 0, 0 }, { 2, 33, 0, 0 }, { 2, 34, 0, 0 }, { 2, 35, 0, 0 } } },
+   { 4, { 5, 9, 13, 17 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 1 }, { 0, 0, 1, 0 }, { 0, 0, 1, 1 }, { 0, 1, 0, 0 }, { 0, 1, 0, 1 }, { 0, 1, 1, 0 }, { 0, 1, 1, 1 }, { 1, 0, 0, 0 }, { 1, 0, 0, 1 }, { 1, 0, 1, 0 }, { 1, 0, 1, 1 }, { 1, 1, 0, 0 }, { 1, 1, 0, 1 }, { 1, 1, 1, 0 }, { 1, 1, 1, 1 } } },
+   { 4, { 6, 10, 14, 18 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 1 }, { 0, 0, 1, 0 }, { 0, 0, 1, 1 }, { 0, 1, 0, 0 }, { 0, 1, 0, 1 }, { 0, 1, 1, 0 }, { 0, 1, 1, 1 }, { 1, 0, 0, 0 }, { 1, 0, 0, 1 }, { 1, 0, 1, 0 }, { 1, 0, 1, 1 }, { 1, 1, 0, 0 }, { 1, 1, 0, 1 }, { 1, 1, 1, 0 }, { 1, 1, 1, 1 } } },
+   { 4, { 5, 9, 13, 17 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 2 }, { 0, 0, 2, 0 }, { 0, 0, 2, 2 }, { 0, 2, 0, 0 }, { 0, 2, 0, 2 }, { 0, 2, 2, 0 }, { 0, 2, 2, 2 }, { 2, 0, 0, 0 }, { 2, 0, 0, 2 }, { 2, 0, 2, 0 }, { 2, 0, 2, 2 }, { 2, 2, 0, 0 }, { 2, 2, 0, 2 }, { 2, 2, 2, 0 }, { 2, 2, 2, 2 } } },
+   { 4, { 5, 9, 6, 10 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 16 }, { 0, 0, 16, 0 }, { 0, 0, 16, 16 }, { 0, 4, 0, 0 }, { 0, 4, 0, 16 }, { 0, 4, 16, 0 }, { 0, 4, 16, 16 }, { 4, 0, 0, 0 }, { 4, 0, 0, 16 }, { 4, 0, 16, 0 }, { 4, 0, 16, 16 }, { 4, 4, 0, 0 }, { 4, 4, 0, 16 }, { 4, 4, 16, 0 }, { 4, 4, 16, 16 } } },
+   { 4, { 14, 18, 13, 17 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 4 }, { 0, 0, 4, 0 }, { 0, 0, 4, 4 }, { 0, 16, 0, 0 }, { 0, 16, 0, 4 }, { 0, 16, 4, 0 }, { 0, 16, 4, 4 }, { 16, 0, 0, 0 }, { 16, 0, 0, 4 }, { 16, 0, 4, 0 }, { 16, 0, 4, 4 }, { 16, 16, 0, 0 }, { 16, 16, 0, 4 }, { 16, 16, 4, 0 }, { 16, 16, 4, 4 } } },
+   { 4, { 5, 9, 13, 17 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 8 }, { 0, 0, 8, 0 }, { 0, 0, 8, 8 }, { 0, 8, 0, 0 }, { 0, 8, 0, 8 }, { 0, 8, 8, 0 }, { 0, 8, 8, 8 }, { 8, 0, 0, 0 }, { 8, 0, 0, 8 }, { 8, 0, 8, 0 }, { 8, 0, 8, 8 }, { 8, 8, 0, 0 }, { 8, 8, 0, 8 }, { 8, 8, 8, 0 }, { 8, 8, 8, 8 } } },
+   { 2, { 3, 7, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 1, 0, 0 }, { 0, 2, 0, 0 }, { 0, 3, 0, 0 }, { 1, 0, 0, 0 }, { 1, 1, 0, 0 }, { 1, 2, 0, 0 }, { 1, 3, 0, 0 }, { 2, 0, 0, 0 }, { 2, 1, 0, 0 }, { 2, 2, 0, 0 }, { 2, 3, 0, 0 }, { 3, 0, 0, 0 }, { 3, 1, 0, 0 }, { 3, 2, 0, 0 }, { 3, 3, 0, 0 } } },
+   { 2, { 11, 15, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 1, 0, 0 }, { 0, 2, 0, 0 }, { 0, 3, 0, 0 }, { 1, 0, 0, 0 }, { 1, 1, 0, 0 }, { 1, 2, 0, 0 }, { 1, 3, 0, 0 }, { 2, 0, 0, 0 }, { 2, 1, 0, 0 }, { 2, 2, 0, 0 }, { 2, 3, 0, 0 }, { 3, 0, 0, 0 }, { 3, 1, 0, 0 }, { 3, 2, 0, 0 }, { 3, 3, 0, 0 } } },
+   { 1, { 4, 0, 0, 0 }, { { 0, 0, 0, 0 }, { 4, 0, 0, 0 }, { 8, 0, 0, 0 }, { 12, 0, 0, 0 }, { 16, 0, 0, 0 }, { 20, 0, 0, 0 }, { 24, 0, 0, 0 }, { 28, 0, 0, 0 }, { 32, 0, 0, 0 }, { 36, 0, 0, 0 }, { 40, 0, 0, 0 }, { 44, 0, 0, 0 }, { 48, 0, 0, 0 }, { 52, 0, 0, 0 }, { 56, 0, 0, 0 }, { 60, 0, 0, 0 } } },
+   { 2, { 4, 8, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 16, 0, 0 }, { 0, 32, 0, 0 }, { 0, 48, 0, 0 }, { 1, 0, 0, 0 }, { 1, 16, 0, 0 }, { 1, 32, 0, 0 }, { 1, 48, 0, 0 }, { 2, 0, 0, 0 }, { 2, 16, 0, 0 }, { 2, 32, 0, 0 }, { 2, 48, 0, 0 }, { 3, 0, 0, 0 }, { 3, 16, 0, 0 }, { 3, 32, 0, 0 }, { 3, 48, 0, 0 } } },
+   { 1, { 8, 0, 0, 0 }, { { 0, 0, 0, 0 }, { 1, 0, 0, 0 }, { 2, 0, 0, 0 }, { 3, 0, 0, 0 }, { 4, 0, 0, 0 }, { 5, 0, 0, 0 }, { 6, 0, 0, 0 }, { 7, 0, 0, 0 }, { 8, 0, 0, 0 }, { 9, 0, 0, 0 }, { 10, 0, 0, 0 }, { 11, 0, 0, 0 }, { 12, 0, 0, 0 }, { 13, 0, 0, 0 }, { 14, 0, 0, 0 }, { 15, 0, 0, 0 } } },
+   { 1, { 12, 0, 0, 0 }, { { 0, 0, 0, 0 }, { 4, 0, 0, 0 }, { 8, 0, 0, 0 }, { 12, 0, 0, 0 }, { 16, 0, 0, 0 }, { 20, 0, 0, 0 }, { 24, 0, 0, 0 }, { 28, 0, 0, 0 }, { 32, 0, 0, 0 }, { 36, 0, 0, 0 }, { 40, 0, 0, 0 }, { 44, 0, 0, 0 }, { 48, 0, 0, 0 }, { 52, 0, 0, 0 }, { 56, 0, 0, 0 }, { 60, 0, 0, 0 } } },
+   { 2, { 12, 16, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 16, 0, 0 }, { 0, 32, 0, 0 }, { 0, 48, 0, 0 }, { 1, 0, 0, 0 }, { 1, 16, 0, 0 }, { 1, 32, 0, 0 }, { 1, 48, 0, 0 }, { 2, 0, 0, 0 }, { 2, 16, 0, 0 }, { 2, 32, 0, 0 }, { 2, 48, 0, 0 }, { 3, 0, 0, 0 }, { 3, 16, 0, 0 }, { 3, 32, 0, 0 }, { 3, 48, 0, 0 } } },
+   { 1, { 16, 0, 0, 0 }, { { 0, 0, 0, 0 }, { 1, 0, 0, 0 }, { 2, 0, 0, 0 }, { 3, 0, 0, 0 }, { 4, 0, 0, 0 }, { 5, 0, 0, 0 }, { 6, 0, 0, 0 }, { 7, 0, 0, 0 }, { 8, 0, 0, 0 }, { 9, 0, 0, 0 }, { 10, 0, 0, 0 }, { 11, 0, 0, 0 }, { 12, 0, 0, 0 }, { 13, 0, 0, 0 }, { 14, 0, 0, 0 }, { 15, 0, 0, 0 } } },
+   { 4, { 4, 8, 12, 16 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 4096 }, { 0, 0, 4096, 0 }, { 0, 0, 4096, 4096 }, { 0, 4096, 0, 0 }, { 0, 4096, 0, 4096 }, { 0, 4096, 4096, 0 }, { 0, 4096, 4096, 4096 }, { 4096, 0, 0, 0 }, { 4096, 0, 0, 4096 }, { 4096, 0, 4096, 0 }, { 4096, 0, 4096, 4096 }, { 4096, 4096, 0, 0 }, { 4096, 4096, 0, 4096 }, { 4096, 4096, 4096, 0 }, { 4096, 4096, 4096, 4096 } } },
+   { 4, { 4, 8, 12, 16 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 2048 }, { 0, 0, 2048, 0 }, { 0, 0, 2048, 2048 }, { 0, 2048, 0, 0 }, { 0, 2048, 0, 2048 }, { 0, 2048, 2048, 0 }, { 0, 2048, 2048, 2048 }, { 2048, 0, 0, 0 }, { 2048, 0, 0, 2048 }, { 2048, 0, 2048, 0 }, { 2048, 0, 2048, 2048 }, { 2048, 2048, 0, 0 }, { 2048, 2048, 0, 2048 }, { 2048, 2048, 2048, 0 }, { 2048, 2048, 2048, 2048 } } },
+   { 4, { 4, 8, 12, 16 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 1024 }, { 0, 0, 1024, 0 }, { 0, 0, 1024, 1024 }, { 0, 1024, 0, 0 }, { 0, 1024, 0, 1024 }, { 0, 1024, 1024, 0 }, { 0, 1024, 1024, 1024 }, { 1024, 0, 0, 0 }, { 1024, 0, 0, 1024 }, { 1024, 0, 1024, 0 }, { 1024, 0, 1024, 1024 }, { 1024, 1024, 0, 0 }, { 1024, 1024, 0, 1024 }, { 1024, 1024, 1024, 0 }, { 1024, 1024, 1024, 1024 } } },
+   { 4, { 4, 8, 12, 16 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 512 }, { 0, 0, 512, 0 }, { 0, 0, 512, 512 }, { 0, 512, 0, 0 }, { 0, 512, 0, 512 }, { 0, 512, 512, 0 }, { 0, 512, 512, 512 }, { 512, 0, 0, 0 }, { 512, 0, 0, 512 }, { 512, 0, 512, 0 }, { 512, 0, 512, 512 }, { 512, 512, 0, 0 }, { 512, 512, 0, 512 }, { 512, 512, 512, 0 }, { 512, 512, 512, 512 } } },
+   { 4, { 4, 8, 12, 16 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 256 }, { 0, 0, 256, 0 }, { 0, 0, 256, 256 }, { 0, 256, 0, 0 }, { 0, 256, 0, 256 }, { 0, 256, 256, 0 }, { 0, 256, 256, 256 }, { 256, 0, 0, 0 }, { 256, 0, 0, 256 }, { 256, 0, 256, 0 }, { 256, 0, 256, 256 }, { 256, 256, 0, 0 }, { 256, 256, 0, 256 }, { 256, 256, 256, 0 }, { 256, 256, 256, 256 } } },
+   { 4, { 4, 8, 12, 16 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 128 }, { 0, 0, 128, 0 }, { 0, 0, 128, 128 }, { 0, 128, 0, 0 }, { 0, 128, 0, 128 }, { 0, 128, 128, 0 }, { 0, 128, 128, 128 }, { 128, 0, 0, 0 }, { 128, 0, 0, 128 }, { 128, 0, 128, 0 }, { 128, 0, 128, 128 }, { 128, 128, 0, 0 }, { 128, 128, 0, 128 }, { 128, 128, 128, 0 }, { 128, 128, 128, 128 } } },
+   { 4, { 4, 8, 12, 16 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 64 }, { 0, 0, 64, 0 }, { 0, 0, 64, 64 }, { 0, 64, 0, 0 }, { 0, 64, 0, 64 }, { 0, 64, 64, 0 }, { 0, 64, 64, 64 }, { 64, 0, 0, 0 }, { 64, 0, 0, 64 }, { 64, 0, 64, 0 }, { 64, 0, 64, 64 }, { 64, 64, 0, 0 }, { 64, 64, 0, 64 }, { 64, 64, 64, 0 }, { 64, 64, 64, 64 } } },
+   /* MR795 */
+   { 1, { 0, 0, 0, 0 }, { { 0, 0, 0, 0 }, { 8, 0, 0, 0 }, { 4, 0, 0, 0 }, { 12, 0, 0, 0 }, { 2, 0, 0, 0 }, { 10, 0, 0, 0 }, { 6, 0, 0, 0 }, { 14, 0, 0, 0 }, { 1, 0, 0, 0 }, { 9, 0, 0, 0 }, { 5, 0, 0, 0 }, { 13, 0, 0, 0 }, { 3, 0, 0, 0 }, { 11, 0, 0, 0 }, { 7, 0, 0, 0 }, { 15, 0, 0, 0 } } },
+   { 2, { 0, 1, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 8, 0, 0 }, { 64, 0, 0, 0 }, { 64, 8, 0, 0 }, { 32, 0, 0, 0 }, { 32, 8, 0, 0 }, { 96, 0, 0, 0 }, { 96, 8, 0, 0 }, { 16, 0, 0, 0 }, { 16, 8, 0, 0 }, { 80, 0, 0, 0 }, { 80, 8, 0, 0 }, { 48, 0, 0, 0 }, { 48, 8, 0, 0 }, { 112, 0, 0, 0 }, { 112, 8, 0, 0 } } },
+   { 1, { 1, 0, 0, 0 }, { { 0, 0, 0, 0 }, { 32, 0, 0, 0 }, { 128, 0, 0, 0 }, { 160, 0, 0, 0 }, { 256, 0, 0, 0 }, { 288, 0, 0, 0 }, { 384, 0, 0, 0 }, { 416, 0, 0, 0 }, { 2, 0, 0, 0 }, { 34, 0, 0, 0 }, { 130, 0, 0, 0 }, { 162, 0, 0, 0 }, { 258, 0, 0, 0 }, { 290, 0, 0, 0 }, { 386, 0, 0, 0 }, { 418, 0, 0, 0 } } },
+   { 1, { 1, 0, 0, 0 }, { { 0, 0, 0, 0 }, { 1, 0, 0, 0 }, { 64, 0, 0, 0 }, { 65, 0, 0, 0 }, { 4, 0, 0, 0 }, { 5, 0, 0, 0 }, { 68, 0, 0, 0 }, { 69, 0, 0, 0 }, { 16, 0, 0, 0 }, { 17, 0, 0, 0 }, { 80, 0, 0, 0 }, { 81, 0, 0, 0 }, { 20, 0, 0, 0 }, { 21, 0, 0, 0 }, { 84, 0, 0, 0 }, { 85, 0, 0, 0 } } },
+   { 1, { 2, 0, 0, 0 }, { { 0, 0, 0, 0 }, { 8, 0, 0, 0 }, { 4, 0, 0, 0 }, { 12, 0, 0, 0 }, { 16, 0, 0, 0 }, { 24, 0, 0, 0 }, { 20, 0, 0, 0 }, { 28, 0, 0, 0 }, { 64, 0, 0, 0 }, { 72, 0, 0, 0 }, { 68, 0, 0, 0 }, { 76, 0, 0, 0 }, { 80, 0, 0, 0 }, { 88, 0, 0, 0 }, { 84, 0, 0, 0 }, { 92, 0, 0, 0 } } },
+   { 2, { 2, 7, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 16, 0, 0 }, { 32, 0, 0, 0 }, { 32, 16, 0, 0 }, { 256, 0, 0, 0 }, { 256, 16, 0, 0 }, { 288, 0, 0, 0 }, { 288, 16, 0, 0 }, { 128, 0, 0, 0 }, { 128, 16, 0, 0 }, { 160, 0, 0, 0 }, { 160, 16, 0, 0 }, { 384, 0, 0, 0 }, { 384, 16, 0, 0 }, { 416, 0, 0, 0 }, { 416, 16, 0, 0 } } },
+   { 4, { 12, 17, 22, 7 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 8 }, { 0, 0, 16, 0 }, { 0, 0, 16, 8 }, { 0, 16, 0, 0 }, { 0, 16, 0, 8 }, { 0, 16, 16, 0 }, { 0, 16, 16, 8 }, { 16, 0, 0, 0 }, { 16, 0, 0, 8 }, { 16, 0, 16, 0 }, { 16, 0, 16, 8 }, { 16, 16, 0, 0 }, { 16, 16, 0, 8 }, { 16, 16, 16, 0 }, { 16, 16, 16, 8 } } },
+   { 4, { 12, 17, 22, 7 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 4 }, { 0, 0, 8, 0 }, { 0, 0, 8, 4 }, { 0, 8, 0, 0 }, { 0, 8, 0, 4 }, { 0, 8, 8, 0 }, { 0, 8, 8, 4 }, { 8, 0, 0, 0 }, { 8, 0, 0, 4 }, { 8, 0, 8, 0 }, { 8, 0, 8, 4 }, { 8, 8, 0, 0 }, { 8, 8, 0, 4 }, { 8, 8, 8, 0 }, { 8, 8, 8, 4 } } },
+   { 4, { 12, 17, 22, 6 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 8 }, { 0, 0, 4, 0 }, { 0, 0, 4, 8 }, { 0, 4, 0, 0 }, { 0, 4, 0, 8 }, { 0, 4, 4, 0 }, { 0, 4, 4, 8 }, { 4, 0, 0, 0 }, { 4, 0, 0, 8 }, { 4, 0, 4, 0 }, { 4, 0, 4, 8 }, { 4, 4, 0, 0 }, { 4, 4, 0, 8 }, { 4, 4, 4, 0 }, { 4, 4, 4, 8 } } },
+   { 4, { 11, 16, 21, 6 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 4 }, { 0, 0, 8, 0 }, { 0, 0, 8, 4 }, { 0, 8, 0, 0 }, { 0, 8, 0, 4 }, { 0, 8, 8, 0 }, { 0, 8, 8, 4 }, { 8, 0, 0, 0 }, { 8, 0, 0, 4 }, { 8, 0, 8, 0 }, { 8, 0, 8, 4 }, { 8, 8, 0, 0 }, { 8, 8, 0, 4 }, { 8, 8, 8, 0 }, { 8, 8, 8, 4 } } },
+   { 4, { 11, 16, 21, 3 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 128 }, { 0, 0, 4, 0 }, { 0, 0, 4, 128 }, { 0, 4, 0, 0 }, { 0, 4, 0, 128 }, { 0, 4, 4, 0 }, { 0, 4, 4, 128 }, { 4, 0, 0, 0 }, { 4, 0, 0, 128 }, { 4, 0, 4, 0 }, { 4, 0, 4, 128 }, { 4, 4, 0, 0 }, { 4, 4, 0, 128 }, { 4, 4, 4, 0 }, { 4, 4, 4, 128 } } },
+   { 2, { 13, 3, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 32, 0, 0 }, { 64, 0, 0, 0 }, { 64, 32, 0, 0 }, { 0, 64, 0, 0 }, { 0, 96, 0, 0 }, { 64, 64, 0, 0 }, { 64, 96, 0, 0 }, { 128, 0, 0, 0 }, { 128, 32, 0, 0 }, { 192, 0, 0, 0 }, { 192, 32, 0, 0 }, { 128, 64, 0, 0 }, { 128, 96, 0, 0 }, { 192, 64, 0, 0 }, { 192, 96, 0, 0 } } },
+   { 2, { 13, 3, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 8, 0, 0 }, { 16, 0, 0, 0 }, { 16, 8, 0, 0 }, { 0, 16, 0, 0 }, { 0, 24, 0, 0 }, { 16, 16, 0, 0 }, { 16, 24, 0, 0 }, { 32, 0, 0, 0 }, { 32, 8, 0, 0 }, { 48, 0, 0, 0 }, { 48, 8, 0, 0 }, { 32, 16, 0, 0 }, { 32, 24, 0, 0 }, { 48, 16, 0, 0 }, { 48, 24, 0, 0 } } },
+   { 3, { 13, 8, 18, 0 }, { { 0, 0, 0, 0 }, { 0, 16, 0, 0 }, { 0, 0, 32, 0 }, { 0, 16, 32, 0 }, { 0, 32, 0, 0 }, { 0, 48, 0, 0 }, { 0, 32, 32, 0 }, { 0, 48, 32, 0 }, { 8, 0, 0, 0 }, { 8, 16, 0, 0 }, { 8, 0, 32, 0 }, { 8, 16, 32, 0 }, { 8, 32, 0, 0 }, { 8, 48, 0, 0 }, { 8, 32, 32, 0 }, { 8, 48, 32, 0 } } },
+   { 3, { 18, 8, 7, 0 }, { { 0, 0, 0, 0 }, { 0, 0, 2, 0 }, { 8, 0, 0, 0 }, { 8, 0, 2, 0 }, { 0, 8, 0, 0 }, { 0, 8, 2, 0 }, { 8, 8, 0, 0 }, { 8, 8, 2, 0 }, { 16, 0, 0, 0 }, { 16, 0, 2, 0 }, { 24, 0, 0, 0 }, { 24, 0, 2, 0 }, { 16, 8, 0, 0 }, { 16, 8, 2, 0 }, { 24, 8, 0, 0 }, { 24, 8, 2, 0 } } },
+   { 4, { 12, 17, 22, 3 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 4 }, { 0, 0, 2, 0 }, { 0, 0, 2, 4 }, { 0, 2, 0, 0 }, { 0, 2, 0, 4 }, { 0, 2, 2, 0 }, { 0, 2, 2, 4 }, { 2, 0, 0, 0 }, { 2, 0, 0, 4 }, { 2, 0, 2, 0 }, { 2, 0, 2, 4 }, { 2, 2, 0, 0 }, { 2, 2, 0, 4 }, { 2, 2, 2, 0 }, { 2, 2, 2, 4 } } },
+   { 4, { 13, 8, 18, 0 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 128 }, { 0, 0, 4, 0 }, { 0, 0, 4, 128 }, { 0, 4, 0, 0 }, { 0, 4, 0, 128 }, { 0, 4, 4, 0 }, { 0, 4, 4, 128 }, { 4, 0, 0, 0 }, { 4, 0, 0, 128 }, { 4, 0, 4, 0 }, { 4, 0, 4, 128 }, { 4, 4, 0, 0 }, { 4, 4, 0, 128 }, { 4, 4, 4, 0 }, { 4, 4, 4, 128 } } },
+   { 3, { 0, 2, 3, 0 }, { { 0, 0, 0, 0 }, { 0, 0, 2, 0 }, { 0, 1, 0, 0 }, { 0, 1, 2, 0 }, { 0, 2, 0, 0 }, { 0, 2, 2, 0 }, { 0, 3, 0, 0 }, { 0, 3, 2, 0 }, { 256, 0, 0, 0 }, { 256, 0, 2, 0 }, { 256, 1, 0, 0 }, { 256, 1, 2, 0 }, { 256, 2, 0, 0 }, { 256, 2, 2, 0 }, { 256, 3, 0, 0 }, { 256, 3, 2, 0 } } },
+   { 3, { 13, 3, 8, 0 }, { { 0, 0, 0, 0 }, { 0, 0, 2, 0 }, { 1, 0, 0, 0 }, { 1, 0, 2, 0 }, { 0, 1, 0, 0 }, { 0, 1, 2, 0 }, { 1, 1, 0, 0 }, { 1, 1, 2, 0 }, { 2, 0, 0, 0 }, { 2, 0, 2, 0 }, { 3, 0, 0, 0 }, { 3, 0, 2, 0 }, { 2, 1, 0, 0 }, { 2, 1, 2, 0 }, { 3, 1, 0, 0 }, { 3, 1, 2, 0 } } },
+   { 3, { 18, 8, 6, 0 }, { { 0, 0, 0, 0 }, { 0, 0, 2, 0 }, { 1, 0, 0, 0 }, { 1, 0, 2, 0 }, { 0, 1, 0, 0 }, { 0, 1, 2, 0 }, { 1, 1, 0, 0 }, { 1, 1, 2, 0 }, { 2, 0, 0, 0 }, { 2, 0, 2, 0 }, { 3, 0, 0, 0 }, { 3, 0, 2, 0 }, { 2, 1, 0, 0 }, { 2, 1, 2, 0 }, { 3, 1, 0, 0 }, { 3, 1, 2, 0 } } },
+   { 4, { 11, 16, 21, 7 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 1 }, { 0, 0, 2, 0 }, { 0, 0, 2, 1 }, { 0, 2, 0, 0 }, { 0, 2, 0, 1 }, { 0, 2, 2, 0 }, { 0, 2, 2, 1 }, { 2, 0, 0, 0 }, { 2, 0, 0, 1 }, { 2, 0, 2, 0 }, { 2, 0, 2, 1 }, { 2, 2, 0, 0 }, { 2, 2, 0, 1 }, { 2, 2, 2, 0 }, { 2, 2, 2, 1 } } },
+   { 4, { 12, 17, 22, 6 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 1 }, { 0, 0, 1, 0 }, { 0, 0, 1, 1 }, { 0, 1, 0, 0 }, { 0, 1, 0, 1 }, { 0, 1, 1, 0 }, { 0, 1, 1, 1 }, { 1, 0, 0, 0 }, { 1, 0, 0, 1 }, { 1, 0, 1, 0 }, { 1, 0, 1, 1 }, { 1, 1, 0, 0 }, { 1, 1, 0, 1 }, { 1, 1, 1, 0 }, { 1, 1, 1, 1 } } },
+   { 4, { 11, 16, 21, 15 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 1 }, { 0, 0, 1, 0 }, { 0, 0, 1, 1 }, { 0, 1, 0, 0 }, { 0, 1, 0, 1 }, { 0, 1, 1, 0 }, { 0, 1, 1, 1 }, { 1, 0, 0, 0 }, { 1, 0, 0, 1 }, { 1, 0, 1, 0 }, { 1, 0, 1, 1 }, { 1, 1, 0, 0 }, { 1, 1, 0, 1 }, { 1, 1, 1, 0 }, { 1, 1, 1, 1 } } },
+   { 3, { 15, 4, 9, 0 }, { { 0, 0, 0, 0 }, { 0, 0, 2, 0 }, { 0, 2, 0, 0 }, { 0, 2, 2, 0 }, { 4, 0, 0, 0 }, { 4, 0, 2, 0 }, { 4, 2, 0, 0 }, { 4, 2, 2, 0 }, { 2, 0, 0, 0 }, { 2, 0, 2, 0 }, { 2, 2, 0, 0 }, { 2, 2, 2, 0 }, { 6, 0, 0, 0 }, { 6, 0, 2, 0 }, { 6, 2, 0, 0 }, { 6, 2, 2, 0 } } },
+   { 4, { 14, 19, 4, 9 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 16 }, { 0, 0, 16, 0 }, { 0, 0, 16, 16 }, { 0, 2, 0, 0 }, { 0, 2, 0, 16 }, { 0, 2, 16, 0 }, { 0, 2, 16, 16 }, { 2, 0, 0, 0 }, { 2, 0, 0, 16 }, { 2, 0, 16, 0 }, { 2, 0, 16, 16 }, { 2, 2, 0, 0 }, { 2, 2, 0, 16 }, { 2, 2, 16, 0 }, { 2, 2, 16, 16 } } },
+   { 4, { 14, 19, 4, 9 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 128 }, { 0, 0, 128, 0 }, { 0, 0, 128, 128 }, { 0, 16, 0, 0 }, { 0, 16, 0, 128 }, { 0, 16, 128, 0 }, { 0, 16, 128, 128 }, { 16, 0, 0, 0 }, { 16, 0, 0, 128 }, { 16, 0, 128, 0 }, { 16, 0, 128, 128 }, { 16, 16, 0, 0 }, { 16, 16, 0, 128 }, { 16, 16, 128, 0 }, { 16, 16, 128, 128 } } },
+   { 4, { 14, 19, 4, 9 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 2048 }, { 0, 0, 2048, 0 }, { 0, 0, 2048, 2048 }, { 0, 128, 0, 0 }, { 0, 128, 0, 2048 }, { 0, 128, 2048, 0 }, { 0, 128, 2048, 2048 }, { 128, 0, 0, 0 }, { 128, 0, 0, 2048 }, { 128, 0, 2048, 0 }, { 128, 0, 2048, 2048 }, { 128, 128, 0, 0 }, { 128, 128, 0, 2048 }, { 128, 128, 2048, 0 }, { 128, 128, 2048, 2048 } } },
+   { 4, { 14, 19, 15, 20 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 1 }, { 0, 0, 8, 0 }, { 0, 0, 8, 1 }, { 0, 2048, 0, 0 }, { 0, 2048, 0, 1 }, { 0, 2048, 8, 0 }, { 0, 2048, 8, 1 }, { 2048, 0, 0, 0 }, { 2048, 0, 0, 1 }, { 2048, 0, 8, 0 }, { 2048, 0, 8, 1 }, { 2048, 2048, 0, 0 }, { 2048, 2048, 0, 1 }, { 2048, 2048, 8, 0 }, { 2048, 2048, 8, 1 } } },
+   { 2, { 20, 10, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 1, 0, 0 }, { 8, 0, 0, 0 }, { 8, 1, 0, 0 }, { 4, 0, 0, 0 }, { 4, 1, 0, 0 }, { 12, 0, 0, 0 }, { 12, 1, 0, 0 }, { 2, 0, 0, 0 }, { 2, 1, 0, 0 }, { 10, 0, 0, 0 }, { 10, 1, 0, 0 }, { 6, 0, 0, 0 }, { 6, 1, 0, 0 }, { 14, 0, 0, 0 }, { 14, 1, 0, 0 } } },
+   { 2, { 10, 5, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 1, 0, 0 }, { 8, 0, 0, 0 }, { 8, 1, 0, 0 }, { 4, 0, 0, 0 }, { 4, 1, 0, 0 }, { 12, 0, 0, 0 }, { 12, 1, 0, 0 }, { 2, 0, 0, 0 }, { 2, 1, 0, 0 }, { 10, 0, 0, 0 }, { 10, 1, 0, 0 }, { 6, 0, 0, 0 }, { 6, 1, 0, 0 }, { 14, 0, 0, 0 }, { 14, 1, 0, 0 } } },
+   { 2, { 5, 4, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 1, 0, 0 }, { 8, 0, 0, 0 }, { 8, 1, 0, 0 }, { 4, 0, 0, 0 }, { 4, 1, 0, 0 }, { 12, 0, 0, 0 }, { 12, 1, 0, 0 }, { 2, 0, 0, 0 }, { 2, 1, 0, 0 }, { 10, 0, 0, 0 }, { 10, 1, 0, 0 }, { 6, 0, 0, 0 }, { 6, 1, 0, 0 }, { 14, 0, 0, 0 }, { 14, 1, 0, 0 } } },
+   { 1, { 4, 0, 0, 0 }, { { 0, 0, 0, 0 }, { 256, 0, 0, 0 }, { 32, 0, 0, 0 }, { 288, 0, 0, 0 }, { 8, 0, 0, 0 }, { 264, 0, 0, 0 }, { 40, 0, 0, 0 }, { 296, 0, 0, 0 }, { 4, 0, 0, 0 }, { 260, 0, 0, 0 }, { 36, 0, 0, 0 }, { 292, 0, 0, 0 }, { 12, 0, 0, 0 }, { 268, 0, 0, 0 }, { 44, 0, 0, 0 }, { 300, 0, 0, 0 } } },
+   { 2, { 4, 9, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 8, 0, 0 }, { 0, 4, 0, 0 }, { 0, 12, 0, 0 }, { 0, 1, 0, 0 }, { 0, 9, 0, 0 }, { 0, 5, 0, 0 }, { 0, 13, 0, 0 }, { 4096, 0, 0, 0 }, { 4096, 8, 0, 0 }, { 4096, 4, 0, 0 }, { 4096, 12, 0, 0 }, { 4096, 1, 0, 0 }, { 4096, 9, 0, 0 }, { 4096, 5, 0, 0 }, { 4096, 13, 0, 0 } } },
+   { 2, { 9, 14, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 1, 0, 0 }, { 4096, 0, 0, 0 }, { 4096, 1, 0, 0 }, { 256, 0, 0, 0 }, { 256, 1, 0, 0 }, { 4352, 0, 0, 0 }, { 4352, 1, 0, 0 }, { 32, 0, 0, 0 }, { 32, 1, 0, 0 }, { 4128, 0, 0, 0 }, { 4128, 1, 0, 0 }, { 288, 0, 0, 0 }, { 288, 1, 0, 0 }, { 4384, 0, 0, 0 }, { 4384, 1, 0, 0 } } },
+   { 1, { 14, 0, 0, 0 }, { { 0, 0, 0, 0 }, { 256, 0, 0, 0 }, { 32, 0, 0, 0 }, { 288, 0, 0, 0 }, { 8, 0, 0, 0 }, { 264, 0, 0, 0 }, { 40, 0, 0, 0 }, { 296, 0, 0, 0 }, { 4, 0, 0, 0 }, { 260, 0, 0, 0 }, { 36, 0, 0, 0 }, { 292, 0, 0, 0 }, { 12, 0, 0, 0 }, { 268, 0, 0, 0 }, { 44, 0, 0, 0 }, { 300, 0, 0, 0 } } },
+   { 2, { 14, 19, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 8, 0, 0 }, { 0, 4, 0, 0 }, { 0, 12, 0, 0 }, { 0, 1, 0, 0 }, { 0, 9, 0, 0 }, { 0, 5, 0, 0 }, { 0, 13, 0, 0 }, { 4096, 0, 0, 0 }, { 4096, 8, 0, 0 }, { 4096, 4, 0, 0 }, { 4096, 12, 0, 0 }, { 4096, 1, 0, 0 }, { 4096, 9, 0, 0 }, { 4096, 5, 0, 0 }, { 4096, 13, 0, 0 } } },
+   { 2, { 19, 4, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 64, 0, 0 }, { 4096, 0, 0, 0 }, { 4096, 64, 0, 0 }, { 256, 0, 0, 0 }, { 256, 64, 0, 0 }, { 4352, 0, 0, 0 }, { 4352, 64, 0, 0 }, { 32, 0, 0, 0 }, { 32, 64, 0, 0 }, { 4128, 0, 0, 0 }, { 4128, 64, 0, 0 }, { 288, 0, 0, 0 }, { 288, 64, 0, 0 }, { 4384, 0, 0, 0 }, { 4384, 64, 0, 0 } } },
+   { 4, { 9, 14, 19, 4 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 1024 }, { 0, 0, 64, 0 }, { 0, 0, 64, 1024 }, { 0, 64, 0, 0 }, { 0, 64, 0, 1024 }, { 0, 64, 64, 0 }, { 0, 64, 64, 1024 }, { 64, 0, 0, 0 }, { 64, 0, 0, 1024 }, { 64, 0, 64, 0 }, { 64, 0, 64, 1024 }, { 64, 64, 0, 0 }, { 64, 64, 0, 1024 }, { 64, 64, 64, 0 }, { 64, 64, 64, 1024 } } },
+   { 4, { 9, 14, 19, 4 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 512 }, { 0, 0, 1024, 0 }, { 0, 0, 1024, 512 }, { 0, 1024, 0, 0 }, { 0, 1024, 0, 512 }, { 0, 1024, 1024, 0 }, { 0, 1024, 1024, 512 }, { 1024, 0, 0, 0 }, { 1024, 0, 0, 512 }, { 1024, 0, 1024, 0 }, { 1024, 0, 1024, 512 }, { 1024, 1024, 0, 0 }, { 1024, 1024, 0, 512 }, { 1024, 1024, 1024, 0 }, { 1024, 1024, 1024, 512 } } },
+   { 3, { 9, 14, 19, 0 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 0 }, { 0, 0, 512, 0 }, { 0, 0, 512, 0 }, { 0, 512, 0, 0 }, { 0, 512, 0, 0 }, { 0, 512, 512, 0 }, { 0, 512, 512, 0 }, { 512, 0, 0, 0 }, { 512, 0, 0, 0 }, { 512, 0, 512, 0 }, { 512, 0, 512, 0 }, { 512, 512, 0, 0 }, { 512, 512, 0, 0 }, { 512, 512, 512, 0 }, { 512, 512, 512, 0 } } },
+   /* MR102 */
+   { 1, { 0, 0, 0, 0 }, { { 0, 0, 0, 0 }, { 8, 0, 0, 0 }, { 4, 0, 0, 0 }, { 12, 0, 0, 0 }, { 2, 0, 0, 0 }, { 10, 0, 0, 0 }, { 6, 0, 0, 0 }, { 14, 0, 0, 0 }, { 1, 0, 0, 0 }, { 9, 0, 0, 0 }, { 5, 0, 0, 0 }, { 13, 0, 0, 0 }, { 3, 0, 0, 0 }, { 11, 0, 0, 0 }, { 7, 0, 0, 0 }, { 15, 0, 0, 0 } } },
+   { 1, { 0, 0, 0, 0 }, { { 0, 0, 0, 0 }, { 128, 0, 0, 0 }, { 64, 0, 0, 0 }, { 192, 0, 0, 0 }, { 32, 0, 0, 0 }, { 160, 0, 0, 0 }, { 96, 0, 0, 0 }, { 224, 0, 0, 0 }, { 16, 0, 0, 0 }, { 144, 0, 0, 0 }, { 80, 0, 0, 0 }, { 208, 0, 0, 0 }, { 48, 0, 0, 0 }, { 176, 0, 0, 0 }, { 112, 0, 0, 0 }, { 240, 0, 0, 0 } } },
+   { 1, { 1, 0, 0, 0 }, { { 0, 0, 0, 0 }, { 8, 0, 0, 0 }, { 4, 0, 0, 0 }, { 12, 0, 0, 0 }, { 2, 0, 0, 0 }, { 10, 0, 0, 0 }, { 6, 0, 0, 0 }, { 14, 0, 0, 0 }, { 1, 0, 0, 0 }, { 9, 0, 0, 0 }, { 5, 0, 0, 0 }, { 13, 0, 0, 0 }, { 3, 0, 0, 0 }, { 11, 0, 0, 0 }, { 7, 0, 0, 0 }, { 15, 0, 0, 0 } } },
+   { 1, { 1, 0, 0, 0 }, { { 0, 0, 0, 0 }, { 128, 0, 0, 0 }, { 64, 0, 0, 0 }, { 192, 0, 0, 0 }, { 32, 0, 0, 0 }, { 160, 0, 0, 0 }, { 96, 0, 0, 0 }, { 224, 0, 0, 0 }, { 16, 0, 0, 0 }, { 144, 0, 0, 0 }, { 80, 0, 0, 0 }, { 208, 0, 0, 0 }, { 48, 0, 0, 0 }, { 176, 0, 0, 0 }, { 112, 0, 0, 0 }, { 240, 0, 0, 0 } } },
+   { 2, { 1, 3, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 32, 0, 0 }, { 0, 64, 0, 0 }, { 0, 96, 0, 0 }, { 0, 128, 0, 0 }, { 0, 160, 0, 0 }, { 0, 192, 0, 0 }, { 0, 224, 0, 0 }, { 256, 0, 0, 0 }, { 256, 32, 0, 0 }, { 256, 64, 0, 0 }, { 256, 96, 0, 0 }, { 256, 128, 0, 0 }, { 256, 160, 0, 0 }, { 256, 192, 0, 0 }, { 256, 224, 0, 0 } } },
+   { 2, { 3, 21, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 128, 0, 0 }, { 4, 0, 0, 0 }, { 4, 128, 0, 0 }, { 8, 0, 0, 0 }, { 8, 128, 0, 0 }, { 12, 0, 0, 0 }, { 12, 128, 0, 0 }, { 16, 0, 0, 0 }, { 16, 128, 0, 0 }, { 20, 0, 0, 0 }, { 20, 128, 0, 0 }, { 24, 0, 0, 0 }, { 24, 128, 0, 0 }, { 28, 0, 0, 0 }, { 28, 128, 0, 0 } } },
+   { 1, { 21, 0, 0, 0 }, { { 0, 0, 0, 0 }, { 8, 0, 0, 0 }, { 16, 0, 0, 0 }, { 24, 0, 0, 0 }, { 32, 0, 0, 0 }, { 40, 0, 0, 0 }, { 48, 0, 0, 0 }, { 56, 0, 0, 0 }, { 64, 0, 0, 0 }, { 72, 0, 0, 0 }, { 80, 0, 0, 0 }, { 88, 0, 0, 0 }, { 96, 0, 0, 0 }, { 104, 0, 0, 0 }, { 112, 0, 0, 0 }, { 120, 0, 0, 0 } } },
+   { 3, { 21, 12, 30, 0 }, { { 0, 0, 0, 0 }, { 0, 0, 16, 0 }, { 0, 8, 0, 0 }, { 0, 8, 16, 0 }, { 0, 16, 0, 0 }, { 0, 16, 16, 0 }, { 0, 24, 0, 0 }, { 0, 24, 16, 0 }, { 4, 0, 0, 0 }, { 4, 0, 16, 0 }, { 4, 8, 0, 0 }, { 4, 8, 16, 0 }, { 4, 16, 0, 0 }, { 4, 16, 16, 0 }, { 4, 24, 0, 0 }, { 4, 24, 16, 0 } } },
+   { 2, { 30, 11, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 4, 0, 0 }, { 0, 8, 0, 0 }, { 0, 12, 0, 0 }, { 0, 64, 0, 0 }, { 0, 68, 0, 0 }, { 0, 72, 0, 0 }, { 0, 76, 0, 0 }, { 8, 0, 0, 0 }, { 8, 4, 0, 0 }, { 8, 8, 0, 0 }, { 8, 12, 0, 0 }, { 8, 64, 0, 0 }, { 8, 68, 0, 0 }, { 8, 72, 0, 0 }, { 8, 76, 0, 0 } } },
+   { 2, { 20, 29, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 64, 0, 0 }, { 4, 0, 0, 0 }, { 4, 64, 0, 0 }, { 8, 0, 0, 0 }, { 8, 64, 0, 0 }, { 12, 0, 0, 0 }, { 12, 64, 0, 0 }, { 64, 0, 0, 0 }, { 64, 64, 0, 0 }, { 68, 0, 0, 0 }, { 68, 64, 0, 0 }, { 72, 0, 0, 0 }, { 72, 64, 0, 0 }, { 76, 0, 0, 0 }, { 76, 64, 0, 0 } } },
+   { 2, { 29, 38, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 8, 0, 0 }, { 0, 64, 0, 0 }, { 0, 72, 0, 0 }, { 4, 0, 0, 0 }, { 4, 8, 0, 0 }, { 4, 64, 0, 0 }, { 4, 72, 0, 0 }, { 8, 0, 0, 0 }, { 8, 8, 0, 0 }, { 8, 64, 0, 0 }, { 8, 72, 0, 0 }, { 12, 0, 0, 0 }, { 12, 8, 0, 0 }, { 12, 64, 0, 0 }, { 12, 72, 0, 0 } } },
+   { 3, { 38, 3, 21, 0 }, { { 0, 0, 0, 0 }, { 0, 0, 2, 0 }, { 0, 1, 0, 0 }, { 0, 1, 2, 0 }, { 0, 2, 0, 0 }, { 0, 2, 2, 0 }, { 0, 3, 0, 0 }, { 0, 3, 2, 0 }, { 4, 0, 0, 0 }, { 4, 0, 2, 0 }, { 4, 1, 0, 0 }, { 4, 1, 2, 0 }, { 4, 2, 0, 0 }, { 4, 2, 2, 0 }, { 4, 3, 0, 0 }, { 4, 3, 2, 0 } } },
+   { 3, { 21, 12, 30, 0 }, { { 0, 0, 0, 0 }, { 0, 0, 4, 0 }, { 0, 2, 0, 0 }, { 0, 2, 4, 0 }, { 0, 4, 0, 0 }, { 0, 4, 4, 0 }, { 0, 6, 0, 0 }, { 0, 6, 4, 0 }, { 1, 0, 0, 0 }, { 1, 0, 4, 0 }, { 1, 2, 0, 0 }, { 1, 2, 4, 0 }, { 1, 4, 0, 0 }, { 1, 4, 4, 0 }, { 1, 6, 0, 0 }, { 1, 6, 4, 0 } } },
+   { 4, { 30, 11, 20, 29 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 32 }, { 0, 0, 32, 0 }, { 0, 0, 32, 32 }, { 0, 32, 0, 0 }, { 0, 32, 0, 32 }, { 0, 32, 32, 0 }, { 0, 32, 32, 32 }, { 2, 0, 0, 0 }, { 2, 0, 0, 32 }, { 2, 0, 32, 0 }, { 2, 0, 32, 32 }, { 2, 32, 0, 0 }, { 2, 32, 0, 32 }, { 2, 32, 32, 0 }, { 2, 32, 32, 32 } } },
+   { 2, { 38, 2, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 16, 0, 0 }, { 0, 4, 0, 0 }, { 0, 20, 0, 0 }, { 0, 64, 0, 0 }, { 0, 80, 0, 0 }, { 0, 68, 0, 0 }, { 0, 84, 0, 0 }, { 32, 0, 0, 0 }, { 32, 16, 0, 0 }, { 32, 4, 0, 0 }, { 32, 20, 0, 0 }, { 32, 64, 0, 0 }, { 32, 80, 0, 0 }, { 32, 68, 0, 0 }, { 32, 84, 0, 0 } } },
+   { 1, { 2, 0, 0, 0 }, { { 0, 0, 0, 0 }, { 32, 0, 0, 0 }, { 256, 0, 0, 0 }, { 288, 0, 0, 0 }, { 128, 0, 0, 0 }, { 160, 0, 0, 0 }, { 384, 0, 0, 0 }, { 416, 0, 0, 0 }, { 8, 0, 0, 0 }, { 40, 0, 0, 0 }, { 264, 0, 0, 0 }, { 296, 0, 0, 0 }, { 136, 0, 0, 0 }, { 168, 0, 0, 0 }, { 392, 0, 0, 0 }, { 424, 0, 0, 0 } } },
+   { 3, { 2, 7, 6, 0 }, { { 0, 0, 0, 0 }, { 0, 0, 1, 0 }, { 0, 1, 0, 0 }, { 0, 1, 1, 0 }, { 1, 0, 0, 0 }, { 1, 0, 1, 0 }, { 1, 1, 0, 0 }, { 1, 1, 1, 0 }, { 2, 0, 0, 0 }, { 2, 0, 1, 0 }, { 2, 1, 0, 0 }, { 2, 1, 1, 0 }, { 3, 0, 0, 0 }, { 3, 0, 1, 0 }, { 3, 1, 0, 0 }, { 3, 1, 1, 0 } } },
+   { 4, { 5, 4, 16, 15 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 1 }, { 0, 0, 1, 0 }, { 0, 0, 1, 1 }, { 0, 1, 0, 0 }, { 0, 1, 0, 1 }, { 0, 1, 1, 0 }, { 0, 1, 1, 1 }, { 1, 0, 0, 0 }, { 1, 0, 0, 1 }, { 1, 0, 1, 0 }, { 1, 0, 1, 1 }, { 1, 1, 0, 0 }, { 1, 1, 0, 1 }, { 1, 1, 1, 0 }, { 1, 1, 1, 1 } } },
+   { 4, { 14, 13, 25, 24 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 1 }, { 0, 0, 1, 0 }, { 0, 0, 1, 1 }, { 0, 1, 0, 0 }, { 0, 1, 0, 1 }, { 0, 1, 1, 0 }, { 0, 1, 1, 1 }, { 1, 0, 0, 0 }, { 1, 0, 0, 1 }, { 1, 0, 1, 0 }, { 1, 0, 1, 1 }, { 1, 1, 0, 0 }, { 1, 1, 0, 1 }, { 1, 1, 1, 0 }, { 1, 1, 1, 1 } } },
+   { 4, { 23, 22, 34, 33 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 1 }, { 0, 0, 1, 0 }, { 0, 0, 1, 1 }, { 0, 1, 0, 0 }, { 0, 1, 0, 1 }, { 0, 1, 1, 0 }, { 0, 1, 1, 1 }, { 1, 0, 0, 0 }, { 1, 0, 0, 1 }, { 1, 0, 1, 0 }, { 1, 0, 1, 1 }, { 1, 1, 0, 0 }, { 1, 1, 0, 1 }, { 1, 1, 1, 0 }, { 1, 1, 1, 1 } } },
+   { 3, { 32, 31, 11, 0 }, { { 0, 0, 0, 0 }, { 0, 0, 16, 0 }, { 0, 0, 2, 0 }, { 0, 0, 18, 0 }, { 0, 1, 0, 0 }, { 0, 1, 16, 0 }, { 0, 1, 2, 0 }, { 0, 1, 18, 0 }, { 1, 0, 0, 0 }, { 1, 0, 16, 0 }, { 1, 0, 2, 0 }, { 1, 0, 18, 0 }, { 1, 1, 0, 0 }, { 1, 1, 16, 0 }, { 1, 1, 2, 0 }, { 1, 1, 18, 0 } } },
+   { 2, { 11, 20, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 1, 0, 0 }, { 0, 16, 0, 0 }, { 0, 17, 0, 0 }, { 0, 2, 0, 0 }, { 0, 3, 0, 0 }, { 0, 18, 0, 0 }, { 0, 19, 0, 0 }, { 1, 0, 0, 0 }, { 1, 1, 0, 0 }, { 1, 16, 0, 0 }, { 1, 17, 0, 0 }, { 1, 2, 0, 0 }, { 1, 3, 0, 0 }, { 1, 18, 0, 0 }, { 1, 19, 0, 0 } } },
+   { 2, { 29, 38, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 2, 0, 0 }, { 1, 0, 0, 0 }, { 1, 2, 0, 0 }, { 16, 0, 0, 0 }, { 16, 2, 0, 0 }, { 17, 0, 0, 0 }, { 17, 2, 0, 0 }, { 2, 0, 0, 0 }, { 2, 2, 0, 0 }, { 3, 0, 0, 0 }, { 3, 2, 0, 0 }, { 18, 0, 0, 0 }, { 18, 2, 0, 0 }, { 19, 0, 0, 0 }, { 19, 2, 0, 0 } } },
+   { 3, { 38, 12, 30, 0 }, { { 0, 0, 0, 0 }, { 0, 0, 1, 0 }, { 0, 1, 0, 0 }, { 0, 1, 1, 0 }, { 1, 0, 0, 0 }, { 1, 0, 1, 0 }, { 1, 1, 0, 0 }, { 1, 1, 1, 0 }, { 16, 0, 0, 0 }, { 16, 0, 1, 0 }, { 16, 1, 0, 0 }, { 16, 1, 1, 0 }, { 17, 0, 0, 0 }, { 17, 0, 1, 0 }, { 17, 1, 0, 0 }, { 17, 1, 1, 0 } } },
+   { 2, { 17, 18, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 512, 0, 0 }, { 0, 256, 0, 0 }, { 0, 768, 0, 0 }, { 256, 0, 0, 0 }, { 256, 512, 0, 0 }, { 256, 256, 0, 0 }, { 256, 768, 0, 0 }, { 512, 0, 0, 0 }, { 512, 512, 0, 0 }, { 512, 256, 0, 0 }, { 512, 768, 0, 0 }, { 768, 0, 0, 0 }, { 768, 512, 0, 0 }, { 768, 256, 0, 0 }, { 768, 768, 0, 0 } } },
+   { 2, { 18, 17, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 32, 0, 0 }, { 32, 0, 0, 0 }, { 32, 32, 0, 0 }, { 0, 128, 0, 0 }, { 0, 160, 0, 0 }, { 32, 128, 0, 0 }, { 32, 160, 0, 0 }, { 128, 0, 0, 0 }, { 128, 32, 0, 0 }, { 160, 0, 0, 0 }, { 160, 32, 0, 0 }, { 128, 128, 0, 0 }, { 128, 160, 0, 0 }, { 160, 128, 0, 0 }, { 160, 160, 0, 0 } } },
+   { 3, { 17, 18, 19, 0 }, { { 0, 0, 0, 0 }, { 0, 0, 32, 0 }, { 0, 0, 64, 0 }, { 0, 0, 96, 0 }, { 0, 64, 0, 0 }, { 0, 64, 32, 0 }, { 0, 64, 64, 0 }, { 0, 64, 96, 0 }, { 64, 0, 0, 0 }, { 64, 0, 32, 0 }, { 64, 0, 64, 0 }, { 64, 0, 96, 0 }, { 64, 64, 0, 0 }, { 64, 64, 32, 0 }, { 64, 64, 64, 0 }, { 64, 64, 96, 0 } } },
+   { 3, { 18, 19, 17, 0 }, { { 0, 0, 0, 0 }, { 0, 16, 0, 0 }, { 0, 0, 16, 0 }, { 0, 16, 16, 0 }, { 0, 8, 0, 0 }, { 0, 24, 0, 0 }, { 0, 8, 16, 0 }, { 0, 24, 16, 0 }, { 16, 0, 0, 0 }, { 16, 16, 0, 0 }, { 16, 0, 16, 0 }, { 16, 16, 16, 0 }, { 16, 8, 0, 0 }, { 16, 24, 0, 0 }, { 16, 8, 16, 0 }, { 16, 24, 16, 0 } } },
+   { 3, { 17, 18, 26, 0 }, { { 0, 0, 0, 0 }, { 0, 0, 256, 0 }, { 0, 0, 512, 0 }, { 0, 0, 768, 0 }, { 0, 8, 0, 0 }, { 0, 8, 256, 0 }, { 0, 8, 512, 0 }, { 0, 8, 768, 0 }, { 8, 0, 0, 0 }, { 8, 0, 256, 0 }, { 8, 0, 512, 0 }, { 8, 0, 768, 0 }, { 8, 8, 0, 0 }, { 8, 8, 256, 0 }, { 8, 8, 512, 0 }, { 8, 8, 768, 0 } } },
+   { 2, { 27, 26, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 128, 0, 0 }, { 128, 0, 0, 0 }, { 128, 128, 0, 0 }, { 512, 0, 0, 0 }, { 512, 128, 0, 0 }, { 640, 0, 0, 0 }, { 640, 128, 0, 0 }, { 256, 0, 0, 0 }, { 256, 128, 0, 0 }, { 384, 0, 0, 0 }, { 384, 128, 0, 0 }, { 768, 0, 0, 0 }, { 768, 128, 0, 0 }, { 896, 0, 0, 0 }, { 896, 128, 0, 0 } } },
+   { 2, { 27, 26, 0, 0 }, { { 0, 0, 0, 0 }, { 64, 0, 0, 0 }, { 0, 64, 0, 0 }, { 64, 64, 0, 0 }, { 0, 32, 0, 0 }, { 64, 32, 0, 0 }, { 0, 96, 0, 0 }, { 64, 96, 0, 0 }, { 32, 0, 0, 0 }, { 96, 0, 0, 0 }, { 32, 64, 0, 0 }, { 96, 64, 0, 0 }, { 32, 32, 0, 0 }, { 96, 32, 0, 0 }, { 32, 96, 0, 0 }, { 96, 96, 0, 0 } } },
+   { 2, { 28, 27, 0, 0 }, { { 0, 0, 0, 0 }, { 8, 0, 0, 0 }, { 0, 16, 0, 0 }, { 8, 16, 0, 0 }, { 32, 0, 0, 0 }, { 40, 0, 0, 0 }, { 32, 16, 0, 0 }, { 40, 16, 0, 0 }, { 64, 0, 0, 0 }, { 72, 0, 0, 0 }, { 64, 16, 0, 0 }, { 72, 16, 0, 0 }, { 96, 0, 0, 0 }, { 104, 0, 0, 0 }, { 96, 16, 0, 0 }, { 104, 16, 0, 0 } } },
+   { 3, { 26, 28, 27, 0 }, { { 0, 0, 0, 0 }, { 0, 0, 8, 0 }, { 8, 0, 0, 0 }, { 8, 0, 8, 0 }, { 0, 16, 0, 0 }, { 0, 16, 8, 0 }, { 8, 16, 0, 0 }, { 8, 16, 8, 0 }, { 16, 0, 0, 0 }, { 16, 0, 8, 0 }, { 24, 0, 0, 0 }, { 24, 0, 8, 0 }, { 16, 16, 0, 0 }, { 16, 16, 8, 0 }, { 24, 16, 0, 0 }, { 24, 16, 8, 0 } } },
+   { 2, { 35, 36, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 512, 0, 0 }, { 0, 256, 0, 0 }, { 0, 768, 0, 0 }, { 256, 0, 0, 0 }, { 256, 512, 0, 0 }, { 256, 256, 0, 0 }, { 256, 768, 0, 0 }, { 512, 0, 0, 0 }, { 512, 512, 0, 0 }, { 512, 256, 0, 0 }, { 512, 768, 0, 0 }, { 768, 0, 0, 0 }, { 768, 512, 0, 0 }, { 768, 256, 0, 0 }, { 768, 768, 0, 0 } } },
+   { 2, { 36, 35, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 32, 0, 0 }, { 32, 0, 0, 0 }, { 32, 32, 0, 0 }, { 0, 128, 0, 0 }, { 0, 160, 0, 0 }, { 32, 128, 0, 0 }, { 32, 160, 0, 0 }, { 128, 0, 0, 0 }, { 128, 32, 0, 0 }, { 160, 0, 0, 0 }, { 160, 32, 0, 0 }, { 128, 128, 0, 0 }, { 128, 160, 0, 0 }, { 160, 128, 0, 0 }, { 160, 160, 0, 0 } } },
+   { 3, { 35, 36, 37, 0 }, { { 0, 0, 0, 0 }, { 0, 0, 32, 0 }, { 0, 0, 64, 0 }, { 0, 0, 96, 0 }, { 0, 64, 0, 0 }, { 0, 64, 32, 0 }, { 0, 64, 64, 0 }, { 0, 64, 96, 0 }, { 64, 0, 0, 0 }, { 64, 0, 32, 0 }, { 64, 0, 64, 0 }, { 64, 0, 96, 0 }, { 64, 64, 0, 0 }, { 64, 64, 32, 0 }, { 64, 64, 64, 0 }, { 64, 64, 96, 0 } } },
+   { 3, { 36, 37, 35, 0 }, { { 0, 0, 0, 0 }, { 0, 16, 0, 0 }, { 0, 0, 16, 0 }, { 0, 16, 16, 0 }, { 0, 8, 0, 0 }, { 0, 24, 0, 0 }, { 0, 8, 16, 0 }, { 0, 24, 16, 0 }, { 16, 0, 0, 0 }, { 16, 16, 0, 0 }, { 16, 0, 16, 0 }, { 16, 16, 16, 0 }, { 16, 8, 0, 0 }, { 16, 24, 0, 0 }, { 16, 8, 16, 0 }, { 16, 24, 16, 0 } } },
+   { 3, { 35, 36, 8, 0 }, { { 0, 0, 0, 0 }, { 0, 0, 256, 0 }, { 0, 0, 512, 0 }, { 0, 0, 768, 0 }, { 0, 8, 0, 0 }, { 0, 8, 256, 0 }, { 0, 8, 512, 0 }, { 0, 8, 768, 0 }, { 8, 0, 0, 0 }, { 8, 0, 256, 0 }, { 8, 0, 512, 0 }, { 8, 0, 768, 0 }, { 8, 8, 0, 0 }, { 8, 8, 256, 0 }, { 8, 8, 512, 0 }, { 8, 8, 768, 0 } } },
+   { 2, { 9, 8, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 128, 0, 0 }, { 128, 0, 0, 0 }, { 128, 128, 0, 0 }, { 512, 0, 0, 0 }, { 512, 128, 0, 0 }, { 640, 0, 0, 0 }, { 640, 128, 0, 0 }, { 256, 0, 0, 0 }, { 256, 128, 0, 0 }, { 384, 0, 0, 0 }, { 384, 128, 0, 0 }, { 768, 0, 0, 0 }, { 768, 128, 0, 0 }, { 896, 0, 0, 0 }, { 896, 128, 0, 0 } } },
+   { 2, { 9, 8, 0, 0 }, { { 0, 0, 0, 0 }, { 64, 0, 0, 0 }, { 0, 64, 0, 0 }, { 64, 64, 0, 0 }, { 0, 32, 0, 0 }, { 64, 32, 0, 0 }, { 0, 96, 0, 0 }, { 64, 96, 0, 0 }, { 32, 0, 0, 0 }, { 96, 0, 0, 0 }, { 32, 64, 0, 0 }, { 96, 64, 0, 0 }, { 32, 32, 0, 0 }, { 96, 32, 0, 0 }, { 32, 96, 0, 0 }, { 96, 96, 0, 0 } } },
+   { 2, { 10, 9, 0, 0 }, { { 0, 0, 0, 0 }, { 8, 0, 0, 0 }, { 0, 16, 0, 0 }, { 8, 16, 0, 0 }, { 32, 0, 0, 0 }, { 40, 0, 0, 0 }, { 32, 16, 0, 0 }, { 40, 16, 0, 0 }, { 64, 0, 0, 0 }, { 72, 0, 0, 0 }, { 64, 16, 0, 0 }, { 72, 16, 0, 0 }, { 96, 0, 0, 0 }, { 104, 0, 0, 0 }, { 96, 16, 0, 0 }, { 104, 16, 0, 0 } } },
+   { 3, { 8, 10, 9, 0 }, { { 0, 0, 0, 0 }, { 0, 0, 8, 0 }, { 8, 0, 0, 0 }, { 8, 0, 8, 0 }, { 0, 16, 0, 0 }, { 0, 16, 8, 0 }, { 8, 16, 0, 0 }, { 8, 16, 8, 0 }, { 16, 0, 0, 0 }, { 16, 0, 8, 0 }, { 24, 0, 0, 0 }, { 24, 0, 8, 0 }, { 16, 16, 0, 0 }, { 16, 16, 8, 0 }, { 24, 16, 0, 0 }, { 24, 16, 8, 0 } } },
+   { 3, { 37, 35, 36, 0 }, { { 0, 0, 0, 0 }, { 1, 0, 0, 0 }, { 0, 0, 1, 0 }, { 1, 0, 1, 0 }, { 0, 1, 0, 0 }, { 1, 1, 0, 0 }, { 0, 1, 1, 0 }, { 1, 1, 1, 0 }, { 4, 0, 0, 0 }, { 5, 0, 0, 0 }, { 4, 0, 1, 0 }, { 5, 0, 1, 0 }, { 4, 1, 0, 0 }, { 5, 1, 0, 0 }, { 4, 1, 1, 0 }, { 5, 1, 1, 0 } } },
+   { 3, { 35, 37, 36, 0 }, { { 0, 0, 0, 0 }, { 0, 0, 4, 0 }, { 2, 0, 0, 0 }, { 2, 0, 4, 0 }, { 0, 2, 0, 0 }, { 0, 2, 4, 0 }, { 2, 2, 0, 0 }, { 2, 2, 4, 0 }, { 4, 0, 0, 0 }, { 4, 0, 4, 0 }, { 6, 0, 0, 0 }, { 6, 0, 4, 0 }, { 4, 2, 0, 0 }, { 4, 2, 4, 0 }, { 6, 2, 0, 0 }, { 6, 2, 4, 0 } } },
+   { 4, { 36, 28, 26, 27 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 1 }, { 0, 0, 1, 0 }, { 0, 0, 1, 1 }, { 0, 4, 0, 0 }, { 0, 4, 0, 1 }, { 0, 4, 1, 0 }, { 0, 4, 1, 1 }, { 2, 0, 0, 0 }, { 2, 0, 0, 1 }, { 2, 0, 1, 0 }, { 2, 0, 1, 1 }, { 2, 4, 0, 0 }, { 2, 4, 0, 1 }, { 2, 4, 1, 0 }, { 2, 4, 1, 1 } } },
+   { 2, { 28, 26, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 2, 0, 0 }, { 2, 0, 0, 0 }, { 2, 2, 0, 0 }, { 0, 4, 0, 0 }, { 0, 6, 0, 0 }, { 2, 4, 0, 0 }, { 2, 6, 0, 0 }, { 1, 0, 0, 0 }, { 1, 2, 0, 0 }, { 3, 0, 0, 0 }, { 3, 2, 0, 0 }, { 1, 4, 0, 0 }, { 1, 6, 0, 0 }, { 3, 4, 0, 0 }, { 3, 6, 0, 0 } } },
+   { 3, { 27, 19, 17, 0 }, { { 0, 0, 0, 0 }, { 0, 0, 1, 0 }, { 0, 4, 0, 0 }, { 0, 4, 1, 0 }, { 2, 0, 0, 0 }, { 2, 0, 1, 0 }, { 2, 4, 0, 0 }, { 2, 4, 1, 0 }, { 4, 0, 0, 0 }, { 4, 0, 1, 0 }, { 4, 4, 0, 0 }, { 4, 4, 1, 0 }, { 6, 0, 0, 0 }, { 6, 0, 1, 0 }, { 6, 4, 0, 0 }, { 6, 4, 1, 0 } } },
+   { 3, { 18, 19, 17, 0 }, { { 0, 0, 0, 0 }, { 0, 2, 0, 0 }, { 0, 0, 4, 0 }, { 0, 2, 4, 0 }, { 0, 1, 0, 0 }, { 0, 3, 0, 0 }, { 0, 1, 4, 0 }, { 0, 3, 4, 0 }, { 1, 0, 0, 0 }, { 1, 2, 0, 0 }, { 1, 0, 4, 0 }, { 1, 2, 4, 0 }, { 1, 1, 0, 0 }, { 1, 3, 0, 0 }, { 1, 1, 4, 0 }, { 1, 3, 4, 0 } } },
+   { 3, { 17, 18, 10, 0 }, { { 0, 0, 0, 0 }, { 0, 0, 4, 0 }, { 0, 2, 0, 0 }, { 0, 2, 4, 0 }, { 0, 4, 0, 0 }, { 0, 4, 4, 0 }, { 0, 6, 0, 0 }, { 0, 6, 4, 0 }, { 2, 0, 0, 0 }, { 2, 0, 4, 0 }, { 2, 2, 0, 0 }, { 2, 2, 4, 0 }, { 2, 4, 0, 0 }, { 2, 4, 4, 0 }, { 2, 6, 0, 0 }, { 2, 6, 4, 0 } } },
+   { 3, { 8, 9, 10, 0 }, { { 0, 0, 0, 0 }, { 4, 0, 0, 0 }, { 0, 0, 1, 0 }, { 4, 0, 1, 0 }, { 0, 1, 0, 0 }, { 4, 1, 0, 0 }, { 0, 1, 1, 0 }, { 4, 1, 1, 0 }, { 1, 0, 0, 0 }, { 5, 0, 0, 0 }, { 1, 0, 1, 0 }, { 5, 0, 1, 0 }, { 1, 1, 0, 0 }, { 5, 1, 0, 0 }, { 1, 1, 1, 0 }, { 5, 1, 1, 0 } } },
+   { 3, { 10, 8, 9, 0 }, { { 0, 0, 0, 0 }, { 0, 0, 2, 0 }, { 0, 0, 4, 0 }, { 0, 0, 6, 0 }, { 0, 2, 0, 0 }, { 0, 2, 2, 0 }, { 0, 2, 4, 0 }, { 0, 2, 6, 0 }, { 2, 0, 0, 0 }, { 2, 0, 2, 0 }, { 2, 0, 4, 0 }, { 2, 0, 6, 0 }, { 2, 2, 0, 0 }, { 2, 2, 2, 0 }, { 2, 2, 4, 0 }, { 2, 2, 6, 0 } } },
+   /* MR122 */
+   { 1, { 0, 0, 0, 0 }, { { 0, 0, 0, 0 }, { 8, 0, 0, 0 }, { 16, 0, 0, 0 }, { 24, 0, 0, 0 }, { 32, 0, 0, 0 }, { 40, 0, 0, 0 }, { 48, 0, 0, 0 }, { 56, 0, 0, 0 }, { 64, 0, 0, 0 }, { 72, 0, 0, 0 }, { 80, 0, 0, 0 }, { 88, 0, 0, 0 }, { 96, 0, 0, 0 }, { 104, 0, 0, 0 }, { 112, 0, 0, 0 }, { 120, 0, 0, 0 } } },
+   { 2, { 0, 1, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 128, 0, 0 }, { 1, 0, 0, 0 }, { 1, 128, 0, 0 }, { 2, 0, 0, 0 }, { 2, 128, 0, 0 }, { 3, 0, 0, 0 }, { 3, 128, 0, 0 }, { 4, 0, 0, 0 }, { 4, 128, 0, 0 }, { 5, 0, 0, 0 }, { 5, 128, 0, 0 }, { 6, 0, 0, 0 }, { 6, 128, 0, 0 }, { 7, 0, 0, 0 }, { 7, 128, 0, 0 } } },
+   { 1, { 1, 0, 0, 0 }, { { 0, 0, 0, 0 }, { 8, 0, 0, 0 }, { 16, 0, 0, 0 }, { 24, 0, 0, 0 }, { 32, 0, 0, 0 }, { 40, 0, 0, 0 }, { 48, 0, 0, 0 }, { 56, 0, 0, 0 }, { 64, 0, 0, 0 }, { 72, 0, 0, 0 }, { 80, 0, 0, 0 }, { 88, 0, 0, 0 }, { 96, 0, 0, 0 }, { 104, 0, 0, 0 }, { 112, 0, 0, 0 }, { 120, 0, 0, 0 } } },
+   { 2, { 1, 2, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 1, 0, 0 }, { 1, 0, 0, 0 }, { 1, 1, 0, 0 }, { 2, 0, 0, 0 }, { 2, 1, 0, 0 }, { 3, 0, 0, 0 }, { 3, 1, 0, 0 }, { 4, 0, 0, 0 }, { 4, 1, 0, 0 }, { 5, 0, 0, 0 }, { 5, 1, 0, 0 }, { 6, 0, 0, 0 }, { 6, 1, 0, 0 }, { 7, 0, 0, 0 }, { 7, 1, 0, 0 } } },
+   { 1, { 2, 0, 0, 0 }, { { 0, 0, 0, 0 }, { 32, 0, 0, 0 }, { 64, 0, 0, 0 }, { 96, 0, 0, 0 }, { 128, 0, 0, 0 }, { 160, 0, 0, 0 }, { 192, 0, 0, 0 }, { 224, 0, 0, 0 }, { 256, 0, 0, 0 }, { 288, 0, 0, 0 }, { 320, 0, 0, 0 }, { 352, 0, 0, 0 }, { 384, 0, 0, 0 }, { 416, 0, 0, 0 }, { 448, 0, 0, 0 }, { 480, 0, 0, 0 } } },
+   { 1, { 2, 0, 0, 0 }, { { 0, 0, 0, 0 }, { 2, 0, 0, 0 }, { 4, 0, 0, 0 }, { 6, 0, 0, 0 }, { 8, 0, 0, 0 }, { 10, 0, 0, 0 }, { 12, 0, 0, 0 }, { 14, 0, 0, 0 }, { 16, 0, 0, 0 }, { 18, 0, 0, 0 }, { 20, 0, 0, 0 }, { 22, 0, 0, 0 }, { 24, 0, 0, 0 }, { 26, 0, 0, 0 }, { 28, 0, 0, 0 }, { 30, 0, 0, 0 } } },
+   { 1, { 3, 0, 0, 0 }, { { 0, 0, 0, 0 }, { 16, 0, 0, 0 }, { 32, 0, 0, 0 }, { 48, 0, 0, 0 }, { 64, 0, 0, 0 }, { 80, 0, 0, 0 }, { 96, 0, 0, 0 }, { 112, 0, 0, 0 }, { 128, 0, 0, 0 }, { 144, 0, 0, 0 }, { 160, 0, 0, 0 }, { 176, 0, 0, 0 }, { 192, 0, 0, 0 }, { 208, 0, 0, 0 }, { 224, 0, 0, 0 }, { 240, 0, 0, 0 } } },
+   { 3, { 3, 5, 31, 0 }, { { 0, 0, 0, 0 }, { 0, 128, 0, 0 }, { 0, 0, 256, 0 }, { 0, 128, 256, 0 }, { 0, 256, 0, 0 }, { 0, 384, 0, 0 }, { 0, 256, 256, 0 }, { 0, 384, 256, 0 }, { 8, 0, 0, 0 }, { 8, 128, 0, 0 }, { 8, 0, 256, 0 }, { 8, 128, 256, 0 }, { 8, 256, 0, 0 }, { 8, 384, 0, 0 }, { 8, 256, 256, 0 }, { 8, 384, 256, 0 } } },
+   { 2, { 31, 5, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 32, 0, 0 }, { 64, 0, 0, 0 }, { 64, 32, 0, 0 }, { 0, 64, 0, 0 }, { 0, 96, 0, 0 }, { 64, 64, 0, 0 }, { 64, 96, 0, 0 }, { 128, 0, 0, 0 }, { 128, 32, 0, 0 }, { 192, 0, 0, 0 }, { 192, 32, 0, 0 }, { 128, 64, 0, 0 }, { 128, 96, 0, 0 }, { 192, 64, 0, 0 }, { 192, 96, 0, 0 } } },
+   { 2, { 31, 5, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 8, 0, 0 }, { 16, 0, 0, 0 }, { 16, 8, 0, 0 }, { 0, 16, 0, 0 }, { 0, 24, 0, 0 }, { 16, 16, 0, 0 }, { 16, 24, 0, 0 }, { 32, 0, 0, 0 }, { 32, 8, 0, 0 }, { 48, 0, 0, 0 }, { 48, 8, 0, 0 }, { 32, 16, 0, 0 }, { 32, 24, 0, 0 }, { 48, 16, 0, 0 }, { 48, 24, 0, 0 } } },
+   { 2, { 31, 5, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 2, 0, 0 }, { 4, 0, 0, 0 }, { 4, 2, 0, 0 }, { 0, 4, 0, 0 }, { 0, 6, 0, 0 }, { 4, 4, 0, 0 }, { 4, 6, 0, 0 }, { 8, 0, 0, 0 }, { 8, 2, 0, 0 }, { 12, 0, 0, 0 }, { 12, 2, 0, 0 }, { 8, 4, 0, 0 }, { 8, 6, 0, 0 }, { 12, 4, 0, 0 }, { 12, 6, 0, 0 } } },
+   { 3, { 31, 5, 6, 0 }, { { 0, 0, 0, 0 }, { 0, 0, 8, 0 }, { 1, 0, 0, 0 }, { 1, 0, 8, 0 }, { 0, 1, 0, 0 }, { 0, 1, 8, 0 }, { 1, 1, 0, 0 }, { 1, 1, 8, 0 }, { 2, 0, 0, 0 }, { 2, 0, 8, 0 }, { 3, 0, 0, 0 }, { 3, 0, 8, 0 }, { 2, 1, 0, 0 }, { 2, 1, 8, 0 }, { 3, 1, 0, 0 }, { 3, 1, 8, 0 } } },
+   { 4, { 19, 32, 45, 6 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 4 }, { 0, 0, 8, 0 }, { 0, 0, 8, 4 }, { 0, 8, 0, 0 }, { 0, 8, 0, 4 }, { 0, 8, 8, 0 }, { 0, 8, 8, 4 }, { 8, 0, 0, 0 }, { 8, 0, 0, 4 }, { 8, 0, 8, 0 }, { 8, 0, 8, 4 }, { 8, 8, 0, 0 }, { 8, 8, 0, 4 }, { 8, 8, 8, 0 }, { 8, 8, 8, 4 } } },
+   { 4, { 19, 32, 45, 6 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 2 }, { 0, 0, 4, 0 }, { 0, 0, 4, 2 }, { 0, 4, 0, 0 }, { 0, 4, 0, 2 }, { 0, 4, 4, 0 }, { 0, 4, 4, 2 }, { 4, 0, 0, 0 }, { 4, 0, 0, 2 }, { 4, 0, 4, 0 }, { 4, 0, 4, 2 }, { 4, 4, 0, 0 }, { 4, 4, 0, 2 }, { 4, 4, 4, 0 }, { 4, 4, 4, 2 } } },
+   { 4, { 19, 32, 45, 17 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 16 }, { 0, 0, 2, 0 }, { 0, 0, 2, 16 }, { 0, 2, 0, 0 }, { 0, 2, 0, 16 }, { 0, 2, 2, 0 }, { 0, 2, 2, 16 }, { 2, 0, 0, 0 }, { 2, 0, 0, 16 }, { 2, 0, 2, 0 }, { 2, 0, 2, 16 }, { 2, 2, 0, 0 }, { 2, 2, 0, 16 }, { 2, 2, 2, 0 }, { 2, 2, 2, 16 } } },
+   { 4, { 30, 43, 56, 17 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 8 }, { 0, 0, 16, 0 }, { 0, 0, 16, 8 }, { 0, 16, 0, 0 }, { 0, 16, 0, 8 }, { 0, 16, 16, 0 }, { 0, 16, 16, 8 }, { 16, 0, 0, 0 }, { 16, 0, 0, 8 }, { 16, 0, 16, 0 }, { 16, 0, 16, 8 }, { 16, 16, 0, 0 }, { 16, 16, 0, 8 }, { 16, 16, 16, 0 }, { 16, 16, 16, 8 } } },
+   { 4, { 30, 43, 56, 17 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 4 }, { 0, 0, 8, 0 }, { 0, 0, 8, 4 }, { 0, 8, 0, 0 }, { 0, 8, 0, 4 }, { 0, 8, 8, 0 }, { 0, 8, 8, 4 }, { 8, 0, 0, 0 }, { 8, 0, 0, 4 }, { 8, 0, 8, 0 }, { 8, 0, 8, 4 }, { 8, 8, 0, 0 }, { 8, 8, 0, 4 }, { 8, 8, 8, 0 }, { 8, 8, 8, 4 } } },
+   { 4, { 30, 43, 56, 18 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 32 }, { 0, 0, 4, 0 }, { 0, 0, 4, 32 }, { 0, 4, 0, 0 }, { 0, 4, 0, 32 }, { 0, 4, 4, 0 }, { 0, 4, 4, 32 }, { 4, 0, 0, 0 }, { 4, 0, 0, 32 }, { 4, 0, 4, 0 }, { 4, 0, 4, 32 }, { 4, 4, 0, 0 }, { 4, 4, 0, 32 }, { 4, 4, 4, 0 }, { 4, 4, 4, 32 } } },
+   { 2, { 44, 18, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 8, 0, 0 }, { 16, 0, 0, 0 }, { 16, 8, 0, 0 }, { 0, 16, 0, 0 }, { 0, 24, 0, 0 }, { 16, 16, 0, 0 }, { 16, 24, 0, 0 }, { 32, 0, 0, 0 }, { 32, 8, 0, 0 }, { 48, 0, 0, 0 }, { 48, 8, 0, 0 }, { 32, 16, 0, 0 }, { 32, 24, 0, 0 }, { 48, 16, 0, 0 }, { 48, 24, 0, 0 } } },
+   { 2, { 44, 18, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 2, 0, 0 }, { 4, 0, 0, 0 }, { 4, 2, 0, 0 }, { 0, 4, 0, 0 }, { 0, 6, 0, 0 }, { 4, 4, 0, 0 }, { 4, 6, 0, 0 }, { 8, 0, 0, 0 }, { 8, 2, 0, 0 }, { 12, 0, 0, 0 }, { 12, 2, 0, 0 }, { 8, 4, 0, 0 }, { 8, 6, 0, 0 }, { 12, 4, 0, 0 }, { 12, 6, 0, 0 } } },
+   { 2, { 44, 3, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 1, 0, 0 }, { 0, 2, 0, 0 }, { 0, 3, 0, 0 }, { 0, 4, 0, 0 }, { 0, 5, 0, 0 }, { 0, 6, 0, 0 }, { 0, 7, 0, 0 }, { 2, 0, 0, 0 }, { 2, 1, 0, 0 }, { 2, 2, 0, 0 }, { 2, 3, 0, 0 }, { 2, 4, 0, 0 }, { 2, 5, 0, 0 }, { 2, 6, 0, 0 }, { 2, 7, 0, 0 } } },
+   { 1, { 4, 0, 0, 0 }, { { 0, 0, 0, 0 }, { 4, 0, 0, 0 }, { 8, 0, 0, 0 }, { 12, 0, 0, 0 }, { 16, 0, 0, 0 }, { 20, 0, 0, 0 }, { 24, 0, 0, 0 }, { 28, 0, 0, 0 }, { 32, 0, 0, 0 }, { 36, 0, 0, 0 }, { 40, 0, 0, 0 }, { 44, 0, 0, 0 }, { 48, 0, 0, 0 }, { 52, 0, 0, 0 }, { 56, 0, 0, 0 }, { 60, 0, 0, 0 } } },
+   { 4, { 6, 19, 32, 45 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 1 }, { 0, 0, 1, 0 }, { 0, 0, 1, 1 }, { 0, 1, 0, 0 }, { 0, 1, 0, 1 }, { 0, 1, 1, 0 }, { 0, 1, 1, 1 }, { 1, 0, 0, 0 }, { 1, 0, 0, 1 }, { 1, 0, 1, 0 }, { 1, 0, 1, 1 }, { 1, 1, 0, 0 }, { 1, 1, 0, 1 }, { 1, 1, 1, 0 }, { 1, 1, 1, 1 } } },
+   { 4, { 17, 30, 43, 56 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 2 }, { 0, 0, 2, 0 }, { 0, 0, 2, 2 }, { 0, 2, 0, 0 }, { 0, 2, 0, 2 }, { 0, 2, 2, 0 }, { 0, 2, 2, 2 }, { 2, 0, 0, 0 }, { 2, 0, 0, 2 }, { 2, 0, 2, 0 }, { 2, 0, 2, 2 }, { 2, 2, 0, 0 }, { 2, 2, 0, 2 }, { 2, 2, 2, 0 }, { 2, 2, 2, 2 } } },
+   { 4, { 7, 20, 33, 46 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 8 }, { 0, 0, 8, 0 }, { 0, 0, 8, 8 }, { 0, 8, 0, 0 }, { 0, 8, 0, 8 }, { 0, 8, 8, 0 }, { 0, 8, 8, 8 }, { 8, 0, 0, 0 }, { 8, 0, 0, 8 }, { 8, 0, 8, 0 }, { 8, 0, 8, 8 }, { 8, 8, 0, 0 }, { 8, 8, 0, 8 }, { 8, 8, 8, 0 }, { 8, 8, 8, 8 } } },
+   { 4, { 8, 21, 34, 47 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 8 }, { 0, 0, 8, 0 }, { 0, 0, 8, 8 }, { 0, 8, 0, 0 }, { 0, 8, 0, 8 }, { 0, 8, 8, 0 }, { 0, 8, 8, 8 }, { 8, 0, 0, 0 }, { 8, 0, 0, 8 }, { 8, 0, 8, 0 }, { 8, 0, 8, 8 }, { 8, 8, 0, 0 }, { 8, 8, 0, 8 }, { 8, 8, 8, 0 }, { 8, 8, 8, 8 } } },
+   { 4, { 17, 30, 43, 56 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 1 }, { 0, 0, 1, 0 }, { 0, 0, 1, 1 }, { 0, 1, 0, 0 }, { 0, 1, 0, 1 }, { 0, 1, 1, 0 }, { 0, 1, 1, 1 }, { 1, 0, 0, 0 }, { 1, 0, 0, 1 }, { 1, 0, 1, 0 }, { 1, 0, 1, 1 }, { 1, 1, 0, 0 }, { 1, 1, 0, 1 }, { 1, 1, 1, 0 }, { 1, 1, 1, 1 } } },
+   { 4, { 9, 22, 35, 48 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 8 }, { 0, 0, 8, 0 }, { 0, 0, 8, 8 }, { 0, 8, 0, 0 }, { 0, 8, 0, 8 }, { 0, 8, 8, 0 }, { 0, 8, 8, 8 }, { 8, 0, 0, 0 }, { 8, 0, 0, 8 }, { 8, 0, 8, 0 }, { 8, 0, 8, 8 }, { 8, 8, 0, 0 }, { 8, 8, 0, 8 }, { 8, 8, 8, 0 }, { 8, 8, 8, 8 } } },
+   { 4, { 10, 23, 36, 49 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 8 }, { 0, 0, 8, 0 }, { 0, 0, 8, 8 }, { 0, 8, 0, 0 }, { 0, 8, 0, 8 }, { 0, 8, 8, 0 }, { 0, 8, 8, 8 }, { 8, 0, 0, 0 }, { 8, 0, 0, 8 }, { 8, 0, 8, 0 }, { 8, 0, 8, 8 }, { 8, 8, 0, 0 }, { 8, 8, 0, 8 }, { 8, 8, 8, 0 }, { 8, 8, 8, 8 } } },
+   { 4, { 11, 24, 37, 50 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 8 }, { 0, 0, 8, 0 }, { 0, 0, 8, 8 }, { 0, 8, 0, 0 }, { 0, 8, 0, 8 }, { 0, 8, 8, 0 }, { 0, 8, 8, 8 }, { 8, 0, 0, 0 }, { 8, 0, 0, 8 }, { 8, 0, 8, 0 }, { 8, 0, 8, 8 }, { 8, 8, 0, 0 }, { 8, 8, 0, 8 }, { 8, 8, 8, 0 }, { 8, 8, 8, 8 } } },
+   { 2, { 4, 7, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 2, 0, 0 }, { 0, 1, 0, 0 }, { 0, 3, 0, 0 }, { 1, 0, 0, 0 }, { 1, 2, 0, 0 }, { 1, 1, 0, 0 }, { 1, 3, 0, 0 }, { 2, 0, 0, 0 }, { 2, 2, 0, 0 }, { 2, 1, 0, 0 }, { 2, 3, 0, 0 }, { 3, 0, 0, 0 }, { 3, 2, 0, 0 }, { 3, 1, 0, 0 }, { 3, 3, 0, 0 } } },
+   { 2, { 7, 8, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 4, 0, 0 }, { 0, 2, 0, 0 }, { 0, 6, 0, 0 }, { 0, 1, 0, 0 }, { 0, 5, 0, 0 }, { 0, 3, 0, 0 }, { 0, 7, 0, 0 }, { 4, 0, 0, 0 }, { 4, 4, 0, 0 }, { 4, 2, 0, 0 }, { 4, 6, 0, 0 }, { 4, 1, 0, 0 }, { 4, 5, 0, 0 }, { 4, 3, 0, 0 }, { 4, 7, 0, 0 } } },
+   { 2, { 9, 10, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 1, 0, 0 }, { 4, 0, 0, 0 }, { 4, 1, 0, 0 }, { 2, 0, 0, 0 }, { 2, 1, 0, 0 }, { 6, 0, 0, 0 }, { 6, 1, 0, 0 }, { 1, 0, 0, 0 }, { 1, 1, 0, 0 }, { 5, 0, 0, 0 }, { 5, 1, 0, 0 }, { 3, 0, 0, 0 }, { 3, 1, 0, 0 }, { 7, 0, 0, 0 }, { 7, 1, 0, 0 } } },
+   { 2, { 10, 11, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 2, 0, 0 }, { 0, 1, 0, 0 }, { 0, 3, 0, 0 }, { 4, 0, 0, 0 }, { 4, 2, 0, 0 }, { 4, 1, 0, 0 }, { 4, 3, 0, 0 }, { 2, 0, 0, 0 }, { 2, 2, 0, 0 }, { 2, 1, 0, 0 }, { 2, 3, 0, 0 }, { 6, 0, 0, 0 }, { 6, 2, 0, 0 }, { 6, 1, 0, 0 }, { 6, 3, 0, 0 } } },
+   { 2, { 11, 20, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 4, 0, 0 }, { 0, 2, 0, 0 }, { 0, 6, 0, 0 }, { 0, 1, 0, 0 }, { 0, 5, 0, 0 }, { 0, 3, 0, 0 }, { 0, 7, 0, 0 }, { 4, 0, 0, 0 }, { 4, 4, 0, 0 }, { 4, 2, 0, 0 }, { 4, 6, 0, 0 }, { 4, 1, 0, 0 }, { 4, 5, 0, 0 }, { 4, 3, 0, 0 }, { 4, 7, 0, 0 } } },
+   { 2, { 21, 22, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 1, 0, 0 }, { 4, 0, 0, 0 }, { 4, 1, 0, 0 }, { 2, 0, 0, 0 }, { 2, 1, 0, 0 }, { 6, 0, 0, 0 }, { 6, 1, 0, 0 }, { 1, 0, 0, 0 }, { 1, 1, 0, 0 }, { 5, 0, 0, 0 }, { 5, 1, 0, 0 }, { 3, 0, 0, 0 }, { 3, 1, 0, 0 }, { 7, 0, 0, 0 }, { 7, 1, 0, 0 } } },
+   { 2, { 22, 23, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 2, 0, 0 }, { 0, 1, 0, 0 }, { 0, 3, 0, 0 }, { 4, 0, 0, 0 }, { 4, 2, 0, 0 }, { 4, 1, 0, 0 }, { 4, 3, 0, 0 }, { 2, 0, 0, 0 }, { 2, 2, 0, 0 }, { 2, 1, 0, 0 }, { 2, 3, 0, 0 }, { 6, 0, 0, 0 }, { 6, 2, 0, 0 }, { 6, 1, 0, 0 }, { 6, 3, 0, 0 } } },
+   { 2, { 23, 24, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 4, 0, 0 }, { 0, 2, 0, 0 }, { 0, 6, 0, 0 }, { 0, 1, 0, 0 }, { 0, 5, 0, 0 }, { 0, 3, 0, 0 }, { 0, 7, 0, 0 }, { 4, 0, 0, 0 }, { 4, 4, 0, 0 }, { 4, 2, 0, 0 }, { 4, 6, 0, 0 }, { 4, 1, 0, 0 }, { 4, 5, 0, 0 }, { 4, 3, 0, 0 }, { 4, 7, 0, 0 } } },
+   { 2, { 33, 34, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 1, 0, 0 }, { 4, 0, 0, 0 }, { 4, 1, 0, 0 }, { 2, 0, 0, 0 }, { 2, 1, 0, 0 }, { 6, 0, 0, 0 }, { 6, 1, 0, 0 }, { 1, 0, 0, 0 }, { 1, 1, 0, 0 }, { 5, 0, 0, 0 }, { 5, 1, 0, 0 }, { 3, 0, 0, 0 }, { 3, 1, 0, 0 }, { 7, 0, 0, 0 }, { 7, 1, 0, 0 } } },
+   { 2, { 34, 35, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 2, 0, 0 }, { 0, 1, 0, 0 }, { 0, 3, 0, 0 }, { 4, 0, 0, 0 }, { 4, 2, 0, 0 }, { 4, 1, 0, 0 }, { 4, 3, 0, 0 }, { 2, 0, 0, 0 }, { 2, 2, 0, 0 }, { 2, 1, 0, 0 }, { 2, 3, 0, 0 }, { 6, 0, 0, 0 }, { 6, 2, 0, 0 }, { 6, 1, 0, 0 }, { 6, 3, 0, 0 } } },
+   { 2, { 35, 36, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 4, 0, 0 }, { 0, 2, 0, 0 }, { 0, 6, 0, 0 }, { 0, 1, 0, 0 }, { 0, 5, 0, 0 }, { 0, 3, 0, 0 }, { 0, 7, 0, 0 }, { 4, 0, 0, 0 }, { 4, 4, 0, 0 }, { 4, 2, 0, 0 }, { 4, 6, 0, 0 }, { 4, 1, 0, 0 }, { 4, 5, 0, 0 }, { 4, 3, 0, 0 }, { 4, 7, 0, 0 } } },
+   { 2, { 37, 46, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 1, 0, 0 }, { 4, 0, 0, 0 }, { 4, 1, 0, 0 }, { 2, 0, 0, 0 }, { 2, 1, 0, 0 }, { 6, 0, 0, 0 }, { 6, 1, 0, 0 }, { 1, 0, 0, 0 }, { 1, 1, 0, 0 }, { 5, 0, 0, 0 }, { 5, 1, 0, 0 }, { 3, 0, 0, 0 }, { 3, 1, 0, 0 }, { 7, 0, 0, 0 }, { 7, 1, 0, 0 } } },
+   { 2, { 46, 47, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 2, 0, 0 }, { 0, 1, 0, 0 }, { 0, 3, 0, 0 }, { 4, 0, 0, 0 }, { 4, 2, 0, 0 }, { 4, 1, 0, 0 }, { 4, 3, 0, 0 }, { 2, 0, 0, 0 }, { 2, 2, 0, 0 }, { 2, 1, 0, 0 }, { 2, 3, 0, 0 }, { 6, 0, 0, 0 }, { 6, 2, 0, 0 }, { 6, 1, 0, 0 }, { 6, 3, 0, 0 } } },
+   { 2, { 47, 48, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 4, 0, 0 }, { 0, 2, 0, 0 }, { 0, 6, 0, 0 }, { 0, 1, 0, 0 }, { 0, 5, 0, 0 }, { 0, 3, 0, 0 }, { 0, 7, 0, 0 }, { 4, 0, 0, 0 }, { 4, 4, 0, 0 }, { 4, 2, 0, 0 }, { 4, 6, 0, 0 }, { 4, 1, 0, 0 }, { 4, 5, 0, 0 }, { 4, 3, 0, 0 }, { 4, 7, 0, 0 } } },
+   { 2, { 49, 50, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 1, 0, 0 }, { 4, 0, 0, 0 }, { 4, 1, 0, 0 }, { 2, 0, 0, 0 }, { 2, 1, 0, 0 }, { 6, 0, 0, 0 }, { 6, 1, 0, 0 }, { 1, 0, 0, 0 }, { 1, 1, 0, 0 }, { 5, 0, 0, 0 }, { 5, 1, 0, 0 }, { 3, 0, 0, 0 }, { 3, 1, 0, 0 }, { 7, 0, 0, 0 }, { 7, 1, 0, 0 } } },
+   { 2, { 50, 12, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 2, 0, 0 }, { 0, 1, 0, 0 }, { 0, 3, 0, 0 }, { 4, 0, 0, 0 }, { 4, 2, 0, 0 }, { 4, 1, 0, 0 }, { 4, 3, 0, 0 }, { 2, 0, 0, 0 }, { 2, 2, 0, 0 }, { 2, 1, 0, 0 }, { 2, 3, 0, 0 }, { 6, 0, 0, 0 }, { 6, 2, 0, 0 }, { 6, 1, 0, 0 }, { 6, 3, 0, 0 } } },
+   { 2, { 12, 13, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 4, 0, 0 }, { 0, 2, 0, 0 }, { 0, 6, 0, 0 }, { 0, 1, 0, 0 }, { 0, 5, 0, 0 }, { 0, 3, 0, 0 }, { 0, 7, 0, 0 }, { 4, 0, 0, 0 }, { 4, 4, 0, 0 }, { 4, 2, 0, 0 }, { 4, 6, 0, 0 }, { 4, 1, 0, 0 }, { 4, 5, 0, 0 }, { 4, 3, 0, 0 }, { 4, 7, 0, 0 } } },
+   { 2, { 14, 15, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 1, 0, 0 }, { 4, 0, 0, 0 }, { 4, 1, 0, 0 }, { 2, 0, 0, 0 }, { 2, 1, 0, 0 }, { 6, 0, 0, 0 }, { 6, 1, 0, 0 }, { 1, 0, 0, 0 }, { 1, 1, 0, 0 }, { 5, 0, 0, 0 }, { 5, 1, 0, 0 }, { 3, 0, 0, 0 }, { 3, 1, 0, 0 }, { 7, 0, 0, 0 }, { 7, 1, 0, 0 } } },
+   { 2, { 15, 16, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 2, 0, 0 }, { 0, 1, 0, 0 }, { 0, 3, 0, 0 }, { 4, 0, 0, 0 }, { 4, 2, 0, 0 }, { 4, 1, 0, 0 }, { 4, 3, 0, 0 }, { 2, 0, 0, 0 }, { 2, 2, 0, 0 }, { 2, 1, 0, 0 }, { 2, 3, 0, 0 }, { 6, 0, 0, 0 }, { 6, 2, 0, 0 }, { 6, 1, 0, 0 }, { 6, 3, 0, 0 } } },
+   { 2, { 16, 25, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 4, 0, 0 }, { 0, 2, 0, 0 }, { 0, 6, 0, 0 }, { 0, 1, 0, 0 }, { 0, 5, 0, 0 }, { 0, 3, 0, 0 }, { 0, 7, 0, 0 }, { 4, 0, 0, 0 }, { 4, 4, 0, 0 }, { 4, 2, 0, 0 }, { 4, 6, 0, 0 }, { 4, 1, 0, 0 }, { 4, 5, 0, 0 }, { 4, 3, 0, 0 }, { 4, 7, 0, 0 } } },
+   { 2, { 26, 27, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 1, 0, 0 }, { 4, 0, 0, 0 }, { 4, 1, 0, 0 }, { 2, 0, 0, 0 }, { 2, 1, 0, 0 }, { 6, 0, 0, 0 }, { 6, 1, 0, 0 }, { 1, 0, 0, 0 }, { 1, 1, 0, 0 }, { 5, 0, 0, 0 }, { 5, 1, 0, 0 }, { 3, 0, 0, 0 }, { 3, 1, 0, 0 }, { 7, 0, 0, 0 }, { 7, 1, 0, 0 } } },
+   { 2, { 27, 28, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 2, 0, 0 }, { 0, 1, 0, 0 }, { 0, 3, 0, 0 }, { 4, 0, 0, 0 }, { 4, 2, 0, 0 }, { 4, 1, 0, 0 }, { 4, 3, 0, 0 }, { 2, 0, 0, 0 }, { 2, 2, 0, 0 }, { 2, 1, 0, 0 }, { 2, 3, 0, 0 }, { 6, 0, 0, 0 }, { 6, 2, 0, 0 }, { 6, 1, 0, 0 }, { 6, 3, 0, 0 } } },
+   { 2, { 28, 29, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 4, 0, 0 }, { 0, 2, 0, 0 }, { 0, 6, 0, 0 }, { 0, 1, 0, 0 }, { 0, 5, 0, 0 }, { 0, 3, 0, 0 }, { 0, 7, 0, 0 }, { 4, 0, 0, 0 }, { 4, 4, 0, 0 }, { 4, 2, 0, 0 }, { 4, 6, 0, 0 }, { 4, 1, 0, 0 }, { 4, 5, 0, 0 }, { 4, 3, 0, 0 }, { 4, 7, 0, 0 } } },
+   { 2, { 38, 39, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 1, 0, 0 }, { 4, 0, 0, 0 }, { 4, 1, 0, 0 }, { 2, 0, 0, 0 }, { 2, 1, 0, 0 }, { 6, 0, 0, 0 }, { 6, 1, 0, 0 }, { 1, 0, 0, 0 }, { 1, 1, 0, 0 }, { 5, 0, 0, 0 }, { 5, 1, 0, 0 }, { 3, 0, 0, 0 }, { 3, 1, 0, 0 }, { 7, 0, 0, 0 }, { 7, 1, 0, 0 } } },
+   { 2, { 39, 40, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 2, 0, 0 }, { 0, 1, 0, 0 }, { 0, 3, 0, 0 }, { 4, 0, 0, 0 }, { 4, 2, 0, 0 }, { 4, 1, 0, 0 }, { 4, 3, 0, 0 }, { 2, 0, 0, 0 }, { 2, 2, 0, 0 }, { 2, 1, 0, 0 }, { 2, 3, 0, 0 }, { 6, 0, 0, 0 }, { 6, 2, 0, 0 }, { 6, 1, 0, 0 }, { 6, 3, 0, 0 } } },
+   { 2, { 40, 41, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 4, 0, 0 }, { 0, 2, 0, 0 }, { 0, 6, 0, 0 }, { 0, 1, 0, 0 }, { 0, 5, 0, 0 }, { 0, 3, 0, 0 }, { 0, 7, 0, 0 }, { 4, 0, 0, 0 }, { 4, 4, 0, 0 }, { 4, 2, 0, 0 }, { 4, 6, 0, 0 }, { 4, 1, 0, 0 }, { 4, 5, 0, 0 }, { 4, 3, 0, 0 }, { 4, 7, 0, 0 } } },
+   { 2, { 42, 51, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 1, 0, 0 }, { 4, 0, 0, 0 }, { 4, 1, 0, 0 }, { 2, 0, 0, 0 }, { 2, 1, 0, 0 }, { 6, 0, 0, 0 }, { 6, 1, 0, 0 }, { 1, 0, 0, 0 }, { 1, 1, 0, 0 }, { 5, 0, 0, 0 }, { 5, 1, 0, 0 }, { 3, 0, 0, 0 }, { 3, 1, 0, 0 }, { 7, 0, 0, 0 }, { 7, 1, 0, 0 } } },
+   { 2, { 51, 52, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 2, 0, 0 }, { 0, 1, 0, 0 }, { 0, 3, 0, 0 }, { 4, 0, 0, 0 }, { 4, 2, 0, 0 }, { 4, 1, 0, 0 }, { 4, 3, 0, 0 }, { 2, 0, 0, 0 }, { 2, 2, 0, 0 }, { 2, 1, 0, 0 }, { 2, 3, 0, 0 }, { 6, 0, 0, 0 }, { 6, 2, 0, 0 }, { 6, 1, 0, 0 }, { 6, 3, 0, 0 } } },
+   { 2, { 52, 53, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 4, 0, 0 }, { 0, 2, 0, 0 }, { 0, 6, 0, 0 }, { 0, 1, 0, 0 }, { 0, 5, 0, 0 }, { 0, 3, 0, 0 }, { 0, 7, 0, 0 }, { 4, 0, 0, 0 }, { 4, 4, 0, 0 }, { 4, 2, 0, 0 }, { 4, 6, 0, 0 }, { 4, 1, 0, 0 }, { 4, 5, 0, 0 }, { 4, 3, 0, 0 }, { 4, 7, 0, 0 } } },
+   { 2, { 54, 55, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 1, 0, 0 }, { 4, 0, 0, 0 }, { 4, 1, 0, 0 }, { 2, 0, 0, 0 }, { 2, 1, 0, 0 }, { 6, 0, 0, 0 }, { 6, 1, 0, 0 }, { 1, 0, 0, 0 }, { 1, 1, 0, 0 }, { 5, 0, 0, 0 }, { 5, 1, 0, 0 }, { 3, 0, 0, 0 }, { 3, 1, 0, 0 }, { 7, 0, 0, 0 }, { 7, 1, 0, 0 } } },
+   { 3, { 55, 18, 44, 0 }, { { 0, 0, 0, 0 }, { 0, 0, 1, 0 }, { 0, 1, 0, 0 }, { 0, 1, 1, 0 }, { 4, 0, 0, 0 }, { 4, 0, 1, 0 }, { 4, 1, 0, 0 }, { 4, 1, 1, 0 }, { 2, 0, 0, 0 }, { 2, 0, 1, 0 }, { 2, 1, 0, 0 }, { 2, 1, 1, 0 }, { 6, 0, 0, 0 }, { 6, 0, 1, 0 }, { 6, 1, 0, 0 }, { 6, 1, 1, 0 } } },
+   /* MRDTX */
+   { 2, { 0, 1, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 128, 0, 0 }, { 1, 0, 0, 0 }, { 1, 128, 0, 0 }, { 2, 0, 0, 0 }, { 2, 128, 0, 0 }, { 3, 0, 0, 0 }, { 3, 128, 0, 0 }, { 4, 0, 0, 0 }, { 4, 128, 0, 0 }, { 5, 0, 0, 0 }, { 5, 128, 0, 0 }, { 6, 0, 0, 0 }, { 6, 128, 0, 0 }, { 7, 0, 0, 0 }, { 7, 128, 0, 0 } } },
+   { 1, { 1, 0, 0, 0 }, { { 0, 0, 0, 0 }, { 8, 0, 0, 0 }, { 16, 0, 0, 0 }, { 24, 0, 0, 0 }, { 32, 0, 0, 0 }, { 40, 0, 0, 0 }, { 48, 0, 0, 0 }, { 56, 0, 0, 0 }, { 64, 0, 0, 0 }, { 72, 0, 0, 0 }, { 80, 0, 0, 0 }, { 88, 0, 0, 0 }, { 96, 0, 0, 0 }, { 104, 0, 0, 0 }, { 112, 0, 0, 0 }, { 120, 0, 0, 0 } } },
+   { 2, { 1, 2, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 256, 0, 0 }, { 1, 0, 0, 0 }, { 1, 256, 0, 0 }, { 2, 0, 0, 0 }, { 2, 256, 0, 0 }, { 3, 0, 0, 0 }, { 3, 256, 0, 0 }, { 4, 0, 0, 0 }, { 4, 256, 0, 0 }, { 5, 0, 0, 0 }, { 5, 256, 0, 0 }, { 6, 0, 0, 0 }, { 6, 256, 0, 0 }, { 7, 0, 0, 0 }, { 7, 256, 0, 0 } } },
+   { 1, { 2, 0, 0, 0 }, { { 0, 0, 0, 0 }, { 16, 0, 0, 0 }, { 32, 0, 0, 0 }, { 48, 0, 0, 0 }, { 64, 0, 0, 0 }, { 80, 0, 0, 0 }, { 96, 0, 0, 0 }, { 112, 0, 0, 0 }, { 128, 0, 0, 0 }, { 144, 0, 0, 0 }, { 160, 0, 0, 0 }, { 176, 0, 0, 0 }, { 192, 0, 0, 0 }, { 208, 0, 0, 0 }, { 224, 0, 0, 0 }, { 240, 0, 0, 0 } } },
+   { 1, { 2, 0, 0, 0 }, { { 0, 0, 0, 0 }, { 1, 0, 0, 0 }, { 2, 0, 0, 0 }, { 3, 0, 0, 0 }, { 4, 0, 0, 0 }, { 5, 0, 0, 0 }, { 6, 0, 0, 0 }, { 7, 0, 0, 0 }, { 8, 0, 0, 0 }, { 9, 0, 0, 0 }, { 10, 0, 0, 0 }, { 11, 0, 0, 0 }, { 12, 0, 0, 0 }, { 13, 0, 0, 0 }, { 14, 0, 0, 0 }, { 15, 0, 0, 0 } } },
+   { 1, { 3, 0, 0, 0 }, { { 0, 0, 0, 0 }, { 32, 0, 0, 0 }, { 64, 0, 0, 0 }, { 96, 0, 0, 0 }, { 128, 0, 0, 0 }, { 160, 0, 0, 0 }, { 192, 0, 0, 0 }, { 224, 0, 0, 0 }, { 256, 0, 0, 0 }, { 288, 0, 0, 0 }, { 320, 0, 0, 0 }, { 352, 0, 0, 0 }, { 384, 0, 0, 0 }, { 416, 0, 0, 0 }, { 448, 0, 0, 0 }, { 480, 0, 0, 0 } } },
+   { 1, { 3, 0, 0, 0 }, { { 0, 0, 0, 0 }, { 2, 0, 0, 0 }, { 4, 0, 0, 0 }, { 6, 0, 0, 0 }, { 8, 0, 0, 0 }, { 10, 0, 0, 0 }, { 12, 0, 0, 0 }, { 14, 0, 0, 0 }, { 16, 0, 0, 0 }, { 18, 0, 0, 0 }, { 20, 0, 0, 0 }, { 22, 0, 0, 0 }, { 24, 0, 0, 0 }, { 26, 0, 0, 0 }, { 28, 0, 0, 0 }, { 30, 0, 0, 0 } } },
+   { 2, { 3, 4, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 8, 0, 0 }, { 0, 16, 0, 0 }, { 0, 24, 0, 0 }, { 0, 32, 0, 0 }, { 0, 40, 0, 0 }, { 0, 48, 0, 0 }, { 0, 56, 0, 0 }, { 1, 0, 0, 0 }, { 1, 8, 0, 0 }, { 1, 16, 0, 0 }, { 1, 24, 0, 0 }, { 1, 32, 0, 0 }, { 1, 40, 0, 0 }, { 1, 48, 0, 0 }, { 1, 56, 0, 0 } } },
+   { 1, { 4, 0, 0, 0 }, { { 0, 0, 0, 0 }, { 0, 0, 0, 0 }, { 1, 0, 0, 0 }, { 1, 0, 0, 0 }, { 2, 0, 0, 0 }, { 2, 0, 0, 0 }, { 3, 0, 0, 0 }, { 3, 0, 0, 0 }, { 4, 0, 0, 0 }, { 4, 0, 0, 0 }, { 5, 0, 0, 0 }, { 5, 0, 0, 0 }, { 6, 0, 0, 0 }, { 6, 0, 0, 0 }, { 7, 0, 0, 0 }, { 7, 0, 0, 0 } } }
+};
+
+/*
+ * G.711 code of each 16-bit sample shifted down by 3, + 4096, of A-law
+ * and u-law, indexed by DEC_G711_ALAW and DEC_G711_ULAW, by segments of
+ * ITU-T G.711. A-law codes 13 bits, all of the sample, even bits
+ * inverted; u-law codes 14, the lowest of which is 0, clipped to 8159
+ * and biased by 33, all bits inverted. Generated, 16 kB
+ */
+static const UWord8 g711_codes[2][8192] =
+{
+   {
+      0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A,
+      0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A,
+      0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A,
+      0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A,
+      0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A,
+      0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A,
+      0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A,
+      0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A,
+      0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B,
+      0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B,
+      0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B,
+      0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B,
+      0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B,
+      0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B,
+      0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B,
+      0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B,
+      0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+      0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+      0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+      0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+      0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+      0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+      0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+      0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+      0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29,
+      0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29,
+      0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29,
+      0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29,
+      0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29,
+      0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29,
+      0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29,
+      0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29,
+      0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+      0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+      0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+      0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+      0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+      0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+      0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+      0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+      0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F,
+      0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F,
+      0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F,
+      0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F,
+      0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F,
+      0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F,
+      0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F,
+      0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F,
+      0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C,
+      0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C,
+      0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C,
+      0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C,
+      0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C,
+      0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C,
+      0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C,
+      0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C,
+      0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+      0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+      0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+      0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+      0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+      0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+      0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+      0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+      0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+      0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+      0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+      0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+      0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+      0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+      0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+      0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+      0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+      0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+      0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+      0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+      0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+      0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+      0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+      0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+      0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+      0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+      0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+      0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+      0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+      0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+      0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+      0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+      0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21,
+      0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21,
+      0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21,
+      0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21,
+      0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21,
+      0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21,
+      0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21,
+      0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21,
+      0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+      0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+      0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+      0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+      0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+      0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+      0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+      0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+      0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+      0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+      0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+      0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+      0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+      0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+      0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+      0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+      0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+      0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+      0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+      0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+      0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+      0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+      0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+      0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+      0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+      0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+      0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+      0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+      0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+      0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+      0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+      0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+      0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A,
+      0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A,
+      0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A,
+      0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A,
+      0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+      0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+      0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+      0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+      0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+      0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+      0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+      0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+      0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
+      0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
+      0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
+      0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
+      0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+      0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+      0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+      0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+      0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+      0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+      0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+      0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+      0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
+      0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
+      0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
+      0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
+      0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D,
+      0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D,
+      0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D,
+      0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D,
+      0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+      0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+      0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+      0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+      0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+      0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+      0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+      0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+      0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+      0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+      0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+      0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+      0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
+      0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
+      0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
+      0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
+      0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+      0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+      0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+      0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+      0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+      0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+      0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+      0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+      0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+      0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+      0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+      0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+      0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+      0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+      0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+      0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+      0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+      0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+      0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+      0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+      0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+      0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+      0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+      0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+      0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E,
+      0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E,
+      0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+      0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+      0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+      0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+      0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+      0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+      0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+      0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+      0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+      0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+      0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+      0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+      0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+      0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+      0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+      0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+      0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+      0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+      0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+      0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A,
+      0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+      0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+      0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+      0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+      0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+      0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
+      0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
+      0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+      0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+      0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+      0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+      0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+      0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
+      0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+      0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
+      0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B,
+      0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69,
+      0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6E, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F,
+      0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D, 0x6D,
+      0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+      0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,
+      0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+      0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+      0x7A, 0x7A, 0x7A, 0x7A, 0x7B, 0x7B, 0x7B, 0x7B, 0x78, 0x78, 0x78, 0x78, 0x79, 0x79, 0x79, 0x79,
+      0x7E, 0x7E, 0x7E, 0x7E, 0x7F, 0x7F, 0x7F, 0x7F, 0x7C, 0x7C, 0x7C, 0x7C, 0x7D, 0x7D, 0x7D, 0x7D,
+      0x72, 0x72, 0x72, 0x72, 0x73, 0x73, 0x73, 0x73, 0x70, 0x70, 0x70, 0x70, 0x71, 0x71, 0x71, 0x71,
+      0x76, 0x76, 0x76, 0x76, 0x77, 0x77, 0x77, 0x77, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x75, 0x75,
+      0x4A, 0x4A, 0x4B, 0x4B, 0x48, 0x48, 0x49, 0x49, 0x4E, 0x4E, 0x4F, 0x4F, 0x4C, 0x4C, 0x4D, 0x4D,
+      0x42, 0x42, 0x43, 0x43, 0x40, 0x40, 0x41, 0x41, 0x46, 0x46, 0x47, 0x47, 0x44, 0x44, 0x45, 0x45,
+      0x5A, 0x5A, 0x5B, 0x5B, 0x58, 0x58, 0x59, 0x59, 0x5E, 0x5E, 0x5F, 0x5F, 0x5C, 0x5C, 0x5D, 0x5D,
+      0x52, 0x52, 0x53, 0x53, 0x50, 0x50, 0x51, 0x51, 0x56, 0x56, 0x57, 0x57, 0x54, 0x54, 0x55, 0x55,
+      0xD5, 0xD5, 0xD4, 0xD4, 0xD7, 0xD7, 0xD6, 0xD6, 0xD1, 0xD1, 0xD0, 0xD0, 0xD3, 0xD3, 0xD2, 0xD2,
+      0xDD, 0xDD, 0xDC, 0xDC, 0xDF, 0xDF, 0xDE, 0xDE, 0xD9, 0xD9, 0xD8, 0xD8, 0xDB, 0xDB, 0xDA, 0xDA,
+      0xC5, 0xC5, 0xC4, 0xC4, 0xC7, 0xC7, 0xC6, 0xC6, 0xC1, 0xC1, 0xC0, 0xC0, 0xC3, 0xC3, 0xC2, 0xC2,
+      0xCD, 0xCD, 0xCC, 0xCC, 0xCF, 0xCF, 0xCE, 0xCE, 0xC9, 0xC9, 0xC8, 0xC8, 0xCB, 0xCB, 0xCA, 0xCA,
+      0xF5, 0xF5, 0xF5, 0xF5, 0xF4, 0xF4, 0xF4, 0xF4, 0xF7, 0xF7, 0xF7, 0xF7, 0xF6, 0xF6, 0xF6, 0xF6,
+      0xF1, 0xF1, 0xF1, 0xF1, 0xF0, 0xF0, 0xF0, 0xF0, 0xF3, 0xF3, 0xF3, 0xF3, 0xF2, 0xF2, 0xF2, 0xF2,
+      0xFD, 0xFD, 0xFD, 0xFD, 0xFC, 0xFC, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFE, 0xFE,
+      0xF9, 0xF9, 0xF9, 0xF9, 0xF8, 0xF8, 0xF8, 0xF8, 0xFB, 0xFB, 0xFB, 0xFB, 0xFA, 0xFA, 0xFA, 0xFA,
+      0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4,
+      0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6,
+      0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+      0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2,
+      0xED, 0xED, 0xED, 0xED, 0xED, 0xED, 0xED, 0xED, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC,
+      0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+      0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8, 0xE8,
+      0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEB, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA, 0xEA,
+      0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
+      0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
+      0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97,
+      0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
+      0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+      0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+      0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93,
+      0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
+      0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
+      0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C,
+      0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+      0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E,
+      0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+      0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+      0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
+      0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A,
+      0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85,
+      0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85,
+      0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
+      0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
+      0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87,
+      0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87,
+      0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86,
+      0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86,
+      0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+      0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+      0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+      0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+      0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+      0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+      0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
+      0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
+      0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D,
+      0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D,
+      0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C,
+      0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C,
+      0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+      0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+      0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E,
+      0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E,
+      0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
+      0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
+      0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+      0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+      0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B,
+      0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B,
+      0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A,
+      0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A,
+      0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5,
+      0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5,
+      0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5,
+      0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5,
+      0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4,
+      0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4,
+      0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4,
+      0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4,
+      0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7,
+      0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7,
+      0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7,
+      0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7,
+      0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6,
+      0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6,
+      0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6,
+      0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6,
+      0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1,
+      0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1,
+      0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1,
+      0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1,
+      0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0,
+      0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0,
+      0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0,
+      0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0,
+      0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3,
+      0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3,
+      0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3,
+      0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3,
+      0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2,
+      0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2,
+      0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2,
+      0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2,
+      0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD,
+      0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD,
+      0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD,
+      0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD,
+      0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC,
+      0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC,
+      0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC,
+      0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC,
+      0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+      0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+      0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+      0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+      0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE,
+      0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE,
+      0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE,
+      0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE,
+      0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9,
+      0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9,
+      0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9,
+      0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9,
+      0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+      0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+      0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+      0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+      0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+      0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+      0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+      0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+      0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA,
+      0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA,
+      0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA,
+      0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA,
+      0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+      0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+      0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+      0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+      0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+      0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+      0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+      0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+      0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4,
+      0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4,
+      0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4,
+      0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4,
+      0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4,
+      0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4,
+      0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4,
+      0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4,
+      0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7,
+      0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7,
+      0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7,
+      0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7,
+      0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7,
+      0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7,
+      0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7,
+      0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7,
+      0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6,
+      0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6,
+      0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6,
+      0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6,
+      0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6,
+      0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6,
+      0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6,
+      0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6,
+      0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1,
+      0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1,
+      0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1,
+      0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1,
+      0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1,
+      0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1,
+      0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1,
+      0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1,
+      0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0,
+      0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0,
+      0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0,
+      0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0,
+      0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0,
+      0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0,
+      0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0,
+      0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0,
+      0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3,
+      0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3,
+      0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3,
+      0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3,
+      0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3,
+      0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3,
+      0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3,
+      0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3,
+      0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+      0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+      0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+      0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+      0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+      0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+      0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+      0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+      0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD,
+      0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD,
+      0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD,
+      0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD,
+      0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD,
+      0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD,
+      0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD,
+      0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD,
+      0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC,
+      0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC,
+      0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC,
+      0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC,
+      0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC,
+      0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC,
+      0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC,
+      0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC,
+      0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF,
+      0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF,
+      0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF,
+      0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF,
+      0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF,
+      0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF,
+      0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF,
+      0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF,
+      0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE,
+      0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE,
+      0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE,
+      0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE,
+      0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE,
+      0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE,
+      0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE,
+      0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE,
+      0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9,
+      0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9,
+      0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9,
+      0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9,
+      0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9,
+      0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9,
+      0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9,
+      0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9,
+      0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8,
+      0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8,
+      0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8,
+      0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8,
+      0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8,
+      0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8,
+      0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8,
+      0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8,
+      0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB,
+      0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB,
+      0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB,
+      0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB,
+      0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB,
+      0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB,
+      0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB,
+      0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB,
+      0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+      0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+      0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+      0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+      0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+      0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+      0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+      0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA
+   },
+   {
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+      0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+      0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+      0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+      0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+      0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+      0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+      0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+      0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+      0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+      0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+      0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+      0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+      0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+      0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+      0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+      0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+      0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+      0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+      0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+      0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+      0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+      0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+      0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+      0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+      0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+      0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+      0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+      0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+      0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+      0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+      0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+      0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+      0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+      0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+      0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+      0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+      0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+      0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+      0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+      0x05, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+      0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+      0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+      0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+      0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+      0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+      0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+      0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+      0x06, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+      0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+      0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+      0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+      0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+      0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+      0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+      0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+      0x07, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+      0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+      0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+      0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+      0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+      0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+      0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+      0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+      0x08, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+      0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+      0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+      0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+      0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+      0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+      0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+      0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+      0x09, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+      0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+      0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+      0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+      0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+      0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+      0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+      0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+      0x0A, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+      0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+      0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+      0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+      0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+      0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+      0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+      0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+      0x0B, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+      0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+      0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+      0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+      0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+      0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+      0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+      0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+      0x0C, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+      0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+      0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+      0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+      0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+      0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+      0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+      0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+      0x0D, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E,
+      0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E,
+      0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E,
+      0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E,
+      0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E,
+      0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E,
+      0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E,
+      0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E,
+      0x0E, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+      0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+      0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+      0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+      0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+      0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+      0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+      0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+      0x0F, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+      0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+      0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+      0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+      0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+      0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+      0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+      0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+      0x11, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+      0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+      0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+      0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+      0x12, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+      0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+      0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+      0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+      0x13, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+      0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+      0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+      0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+      0x14, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
+      0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
+      0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
+      0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
+      0x15, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+      0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+      0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+      0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+      0x16, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
+      0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
+      0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
+      0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17,
+      0x17, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+      0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+      0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+      0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+      0x18, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+      0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+      0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+      0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+      0x19, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A,
+      0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A,
+      0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A,
+      0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A,
+      0x1A, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+      0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+      0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+      0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+      0x1B, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
+      0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
+      0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
+      0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
+      0x1C, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
+      0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
+      0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
+      0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
+      0x1D, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+      0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+      0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+      0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+      0x1E, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+      0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+      0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+      0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+      0x1F, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+      0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+      0x20, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21,
+      0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21,
+      0x21, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+      0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+      0x22, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+      0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+      0x23, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+      0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+      0x24, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+      0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+      0x25, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+      0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+      0x26, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+      0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+      0x27, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+      0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+      0x28, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29,
+      0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29,
+      0x29, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A,
+      0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A,
+      0x2A, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B,
+      0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B,
+      0x2B, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C,
+      0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C,
+      0x2C, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+      0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+      0x2D, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+      0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+      0x2E, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F,
+      0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F,
+      0x2F, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+      0x30, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
+      0x31, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+      0x32, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+      0x33, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34,
+      0x34, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+      0x35, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+      0x36, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+      0x37, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+      0x38, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
+      0x39, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A,
+      0x3A, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+      0x3B, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
+      0x3C, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D, 0x3D,
+      0x3D, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E,
+      0x3E, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+      0x3F, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+      0x41, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+      0x43, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
+      0x45, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47, 0x47,
+      0x47, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49,
+      0x49, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4A, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B, 0x4B,
+      0x4B, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D, 0x4D,
+      0x4D, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F, 0x4F,
+      0x4F, 0x50, 0x50, 0x50, 0x50, 0x51, 0x51, 0x51, 0x51, 0x52, 0x52, 0x52, 0x52, 0x53, 0x53, 0x53,
+      0x53, 0x54, 0x54, 0x54, 0x54, 0x55, 0x55, 0x55, 0x55, 0x56, 0x56, 0x56, 0x56, 0x57, 0x57, 0x57,
+      0x57, 0x58, 0x58, 0x58, 0x58, 0x59, 0x59, 0x59, 0x59, 0x5A, 0x5A, 0x5A, 0x5A, 0x5B, 0x5B, 0x5B,
+      0x5B, 0x5C, 0x5C, 0x5C, 0x5C, 0x5D, 0x5D, 0x5D, 0x5D, 0x5E, 0x5E, 0x5E, 0x5E, 0x5F, 0x5F, 0x5F,
+      0x5F, 0x60, 0x60, 0x61, 0x61, 0x62, 0x62, 0x63, 0x63, 0x64, 0x64, 0x65, 0x65, 0x66, 0x66, 0x67,
+      0x67, 0x68, 0x68, 0x69, 0x69, 0x6A, 0x6A, 0x6B, 0x6B, 0x6C, 0x6C, 0x6D, 0x6D, 0x6E, 0x6E, 0x6F,
+      0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x7B, 0x7C, 0x7D, 0x7E,
+      0xFF, 0xFE, 0xFD, 0xFC, 0xFB, 0xFA, 0xF9, 0xF8, 0xF7, 0xF6, 0xF5, 0xF4, 0xF3, 0xF2, 0xF1, 0xF0,
+      0xEF, 0xEF, 0xEE, 0xEE, 0xED, 0xED, 0xEC, 0xEC, 0xEB, 0xEB, 0xEA, 0xEA, 0xE9, 0xE9, 0xE8, 0xE8,
+      0xE7, 0xE7, 0xE6, 0xE6, 0xE5, 0xE5, 0xE4, 0xE4, 0xE3, 0xE3, 0xE2, 0xE2, 0xE1, 0xE1, 0xE0, 0xE0,
+      0xDF, 0xDF, 0xDF, 0xDF, 0xDE, 0xDE, 0xDE, 0xDE, 0xDD, 0xDD, 0xDD, 0xDD, 0xDC, 0xDC, 0xDC, 0xDC,
+      0xDB, 0xDB, 0xDB, 0xDB, 0xDA, 0xDA, 0xDA, 0xDA, 0xD9, 0xD9, 0xD9, 0xD9, 0xD8, 0xD8, 0xD8, 0xD8,
+      0xD7, 0xD7, 0xD7, 0xD7, 0xD6, 0xD6, 0xD6, 0xD6, 0xD5, 0xD5, 0xD5, 0xD5, 0xD4, 0xD4, 0xD4, 0xD4,
+      0xD3, 0xD3, 0xD3, 0xD3, 0xD2, 0xD2, 0xD2, 0xD2, 0xD1, 0xD1, 0xD1, 0xD1, 0xD0, 0xD0, 0xD0, 0xD0,
+      0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCE, 0xCE, 0xCE, 0xCE, 0xCE, 0xCE, 0xCE, 0xCE,
+      0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
+      0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA, 0xCA,
+      0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC9, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8,
+      0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6,
+      0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC5, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+      0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2,
+      0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+      0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+      0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE, 0xBE,
+      0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD, 0xBD,
+      0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC,
+      0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+      0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA,
+      0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9,
+      0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+      0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7, 0xB7,
+      0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6,
+      0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5,
+      0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4,
+      0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3,
+      0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2,
+      0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1, 0xB1,
+      0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0,
+      0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF,
+      0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF,
+      0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE,
+      0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE, 0xAE,
+      0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD,
+      0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD, 0xAD,
+      0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC,
+      0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC,
+      0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB,
+      0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB,
+      0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+      0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+      0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9,
+      0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9, 0xA9,
+      0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8,
+      0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8,
+      0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7,
+      0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7, 0xA7,
+      0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6,
+      0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6,
+      0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+      0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5,
+      0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4,
+      0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0xA4,
+      0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3,
+      0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3,
+      0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+      0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+      0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1,
+      0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1,
+      0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0,
+      0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0,
+      0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+      0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+      0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+      0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
+      0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E,
+      0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E,
+      0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E,
+      0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E,
+      0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
+      0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
+      0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
+      0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D, 0x9D,
+      0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C,
+      0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C,
+      0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C,
+      0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C,
+      0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
+      0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
+      0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
+      0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B, 0x9B,
+      0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A,
+      0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A,
+      0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A,
+      0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A, 0x9A,
+      0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+      0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+      0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+      0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+      0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+      0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+      0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+      0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+      0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97,
+      0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97,
+      0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97,
+      0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97,
+      0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
+      0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
+      0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
+      0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
+      0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
+      0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
+      0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
+      0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
+      0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
+      0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
+      0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
+      0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
+      0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93,
+      0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93,
+      0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93,
+      0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93,
+      0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
+      0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
+      0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
+      0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
+      0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+      0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+      0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+      0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+      0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+      0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+      0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+      0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+      0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+      0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+      0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+      0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+      0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+      0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+      0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+      0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F, 0x8F,
+      0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E,
+      0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E,
+      0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E,
+      0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E,
+      0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E,
+      0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E,
+      0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E,
+      0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E,
+      0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D,
+      0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D,
+      0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D,
+      0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D,
+      0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D,
+      0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D,
+      0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D,
+      0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D,
+      0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C,
+      0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C,
+      0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C,
+      0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C,
+      0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C,
+      0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C,
+      0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C,
+      0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C,
+      0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B,
+      0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B,
+      0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B,
+      0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B,
+      0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B,
+      0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B,
+      0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B,
+      0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B,
+      0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A,
+      0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A,
+      0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A,
+      0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A,
+      0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A,
+      0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A,
+      0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A,
+      0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A, 0x8A,
+      0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
+      0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
+      0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
+      0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
+      0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
+      0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
+      0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
+      0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
+      0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+      0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+      0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+      0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+      0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+      0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+      0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+      0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+      0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87,
+      0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87,
+      0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87,
+      0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87,
+      0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87,
+      0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87,
+      0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87,
+      0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87,
+      0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86,
+      0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86,
+      0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86,
+      0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86,
+      0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86,
+      0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86,
+      0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86,
+      0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86,
+      0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85,
+      0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85,
+      0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85,
+      0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85,
+      0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85,
+      0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85,
+      0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85,
+      0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85,
+      0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
+      0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
+      0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
+      0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
+      0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
+      0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
+      0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
+      0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
+      0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+      0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+      0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+      0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+      0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+      0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+      0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+      0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+      0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
+      0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
+      0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
+      0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
+      0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
+      0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
+      0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
+      0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
+      0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+      0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+      0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+      0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+      0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+      0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+      0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+      0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+      0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+      0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+      0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+      0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+      0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+      0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+      0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+      0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+      0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80
+   }
+};
+#endif
+
 #endif
@@ -30,6 +30,21 @@
 #include"typedef.h"
 #include"interf_rom.h"
 
+/*
+ * codebooks are searched by the index in every frame, they are kept
+ * 16-bit, which their values are, and aligned to cache line, so rows of
+ * 4 values never span two lines
+ */
+#ifndef ROM_ALIGN
+#if defined( _MSC_VER )
+#define ROM_ALIGN __declspec( align( 64 ) )
+#elif defined( __GNUC__ )
+#define ROM_ALIGN __attribute__( ( aligned( 64 ) ) )
+#else
+#define ROM_ALIGN
+#endif
+#endif
+
 /*
  * definition of constants
  */
@@ -231,7 +246,7 @@ static const Word32 qua_gain_pitch[NB_QUA_PITCH] =
 
 /* fixed codebook gain quantization table (MR122, MR795) */
 #define NB_QUA_CODE 32
-static const Word32 qua_gain_code[NB_QUA_CODE * 3] =
+ROM_ALIGN static const Word16 qua_gain_code[NB_QUA_CODE * 3] =
 {
 /* gain factor (g_fac) and quantized energy error (qua_ener_MR122, qua_ener)
  * are stored:
@@ -369,6 +384,51 @@ static const Word32 dgray[8] =
    7
 };
 
+/*
+ * position indices of 3 pulses in decompress10 for each MSBs, without
+ * the bit from LSBs: ( MSBs % 25 % 5 ) * 2, ( MSBs % 25 / 5 ) * 2 and
+ * ( MSBs / 25 ) * 2
+ */
+static const UWord8 decompress10_pos[125][3] =
+{
+   { 0, 0, 0 }, { 2, 0, 0 }, { 4, 0, 0 }, { 6, 0, 0 }, { 8, 0, 0 },
+   { 0, 2, 0 }, { 2, 2, 0 }, { 4, 2, 0 }, { 6, 2, 0 }, { 8, 2, 0 },
+   { 0, 4, 0 }, { 2, 4, 0 }, { 4, 4, 0 }, { 6, 4, 0 }, { 8, 4, 0 },
+   { 0, 6, 0 }, { 2, 6, 0 }, { 4, 6, 0 }, { 6, 6, 0 }, { 8, 6, 0 },
+   { 0, 8, 0 }, { 2, 8, 0 }, { 4, 8, 0 }, { 6, 8, 0 }, { 8, 8, 0 },
+   { 0, 0, 2 }, { 2, 0, 2 }, { 4, 0, 2 }, { 6, 0, 2 }, { 8, 0, 2 },
+   { 0, 2, 2 }, { 2, 2, 2 }, { 4, 2, 2 }, { 6, 2, 2 }, { 8, 2, 2 },
+   { 0, 4, 2 }, { 2, 4, 2 }, { 4, 4, 2 }, { 6, 4, 2 }, { 8, 4, 2 },
+   { 0, 6, 2 }, { 2, 6, 2 }, { 4, 6, 2 }, { 6, 6, 2 }, { 8, 6, 2 },
+   { 0, 8, 2 }, { 2, 8, 2 }, { 4, 8, 2 }, { 6, 8, 2 }, { 8, 8, 2 },
+   { 0, 0, 4 }, { 2, 0, 4 }, { 4, 0, 4 }, { 6, 0, 4 }, { 8, 0, 4 },
+   { 0, 2, 4 }, { 2, 2, 4 }, { 4, 2, 4 }, { 6, 2, 4 }, { 8, 2, 4 },
+   { 0, 4, 4 }, { 2, 4, 4 }, { 4, 4, 4 }, { 6, 4, 4 }, { 8, 4, 4 },
+   { 0, 6, 4 }, { 2, 6, 4 }, { 4, 6, 4 }, { 6, 6, 4 }, { 8, 6, 4 },
+   { 0, 8, 4 }, { 2, 8, 4 }, { 4, 8, 4 }, { 6, 8, 4 }, { 8, 8, 4 },
+   { 0, 0, 6 }, { 2, 0, 6 }, { 4, 0, 6 }, { 6, 0, 6 }, { 8, 0, 6 },
+   { 0, 2, 6 }, { 2, 2, 6 }, { 4, 2, 6 }, { 6, 2, 6 }, { 8, 2, 6 },
+   { 0, 4, 6 }, { 2, 4, 6 }, { 4, 4, 6 }, { 6, 4, 6 }, { 8, 4, 6 },
+   { 0, 6, 6 }, { 2, 6, 6 }, { 4, 6, 6 }, { 6, 6, 6 }, { 8, 6, 6 },
+   { 0, 8, 6 }, { 2, 8, 6 }, { 4, 8, 6 }, { 6, 8, 6 }, { 8, 8, 6 },
+   { 0, 0, 8 }, { 2, 0, 8 }, { 4, 0, 8 }, { 6, 0, 8 }, { 8, 0, 8 },
+   { 0, 2, 8 }, { 2, 2, 8 }, { 4, 2, 8 }, { 6, 2, 8 }, { 8, 2, 8 },
+   { 0, 4, 8 }, { 2, 4, 8 }, { 4, 4, 8 }, { 6, 4, 8 }, { 8, 4, 8 },
+   { 0, 6, 8 }, { 2, 6, 8 }, { 4, 6, 8 }, { 6, 6, 8 }, { 8, 6, 8 },
+   { 0, 8, 8 }, { 2, 8, 8 }, { 4, 8, 8 }, { 6, 8, 8 }, { 8, 8, 8 }
+};
+/*
+ * position indices of pulses 3 and 7 in decompress_codewords for each
+ * MSBs of the third index, without the bit from LSBs
+ */
+static const UWord8 decompress7_pos[32][2] =
+{
+   { 0, 0 }, { 2, 0 }, { 2, 0 }, { 4, 0 }, { 6, 0 }, { 8, 0 }, { 8, 2 }, { 8, 2 },
+   { 6, 2 }, { 4, 2 }, { 2, 2 }, { 2, 2 }, { 0, 2 }, { 0, 4 }, { 2, 4 }, { 4, 4 },
+   { 4, 4 }, { 6, 4 }, { 8, 4 }, { 8, 6 }, { 6, 6 }, { 6, 6 }, { 4, 6 }, { 2, 6 },
+   { 0, 6 }, { 0, 6 }, { 0, 8 }, { 2, 8 }, { 4, 8 }, { 6, 8 }, { 6, 8 }, { 8, 8 }
+};
+
 /* table[i] = sqrt((i+16)*2^-6) * 2^15, i.e. sqrt(x) scaled Q15 */
 static const Word32 sqrt_table[49] =
 {
@@ -1006,12 +1066,27 @@ static const Word32 pred_fac[10] =
    8593,
    6484
 };
+
+/* LSF prediction factors of MR122, all LSP_PRED_FAC_MR122 */
+static const Word32 pred_fac_122[10] =
+{
+   21299,
+   21299,
+   21299,
+   21299,
+   21299,
+   21299,
+   21299,
+   21299,
+   21299,
+   21299
+};
 #define DICO1_SIZE_3  256
 #define DICO2_SIZE_3  512
 #define DICO3_SIZE_3  512
 
 /* 1st LSF quantizer (not in MR122 and MR795) */
-static const Word32 dico1_lsf_3[] =
+ROM_ALIGN static const Word16 dico1_lsf_3[] =
 {
    6,
    82,
@@ -1784,7 +1859,7 @@ static const Word32 dico1_lsf_3[] =
 };
 
 /* 2nd LSF quantizer (not in MR122) */
-static const Word32 dico2_lsf_3[] =
+ROM_ALIGN static const Word16 dico2_lsf_3[] =
 {
    50,
    71,
@@ -3325,7 +3400,7 @@ static const Word32 dico2_lsf_3[] =
 };
 
 /* 3rd LSF quantizer (not in MR122, MR515 and MR475) */
-static const Word32 dico3_lsf_3[] =
+ROM_ALIGN static const Word16 dico3_lsf_3[] =
 {
    67,
    - 17,
@@ -5379,7 +5454,7 @@ static const Word32 dico3_lsf_3[] =
 #define MR515_3_SIZE  128
 
 /* 3rd LSF quantizer (MR515 and MR475) */
-static const Word32 mr515_3_lsf[] =
+ROM_ALIGN static const Word16 mr515_3_lsf[] =
 {
    419,
    163,
@@ -5897,7 +5972,7 @@ static const Word32 mr515_3_lsf[] =
 #define MR795_1_SIZE  512
 
 /* 1st LSF quantizer (MR795) */
-static const Word32 mr795_1_lsf[] =
+ROM_ALIGN static const Word16 mr795_1_lsf[] =
 {
    - 890,
    - 1550,
@@ -7443,7 +7518,7 @@ static const Word32 mr795_1_lsf[] =
 #define DICO5_SIZE_5  64
 
 /* 1st LSF quantizer (MR122) */
-static const Word32 dico1_lsf_5[DICO1_SIZE_5 * 4] =
+ROM_ALIGN static const Word16 dico1_lsf_5[DICO1_SIZE_5 * 4] =
 {
    - 451,
    - 1065,
@@ -7960,7 +8035,7 @@ static const Word32 dico1_lsf_5[DICO1_SIZE_5 * 4] =
 };
 
 /* 2nd LSF quantizer (MR122) */
-static const Word32 dico2_lsf_5[DICO2_SIZE_5 * 4] =
+ROM_ALIGN static const Word16 dico2_lsf_5[DICO2_SIZE_5 * 4] =
 {
    - 1631,
    - 1600,
@@ -8989,7 +9064,7 @@ static const Word32 dico2_lsf_5[DICO2_SIZE_5 * 4] =
 };
 
 /* 3rd LSF quantizer (MR122) */
-static const Word32 dico3_lsf_5[DICO3_SIZE_5 * 4] =
+ROM_ALIGN static const Word16 dico3_lsf_5[DICO3_SIZE_5 * 4] =
 {
    - 1812,
    - 2275,
@@ -10018,7 +10093,7 @@ static const Word32 dico3_lsf_5[DICO3_SIZE_5 * 4] =
 };
 
 /* 4th LSF quantizer (MR122) */
-static const Word32 dico4_lsf_5[DICO4_SIZE_5 * 4] =
+ROM_ALIGN static const Word16 dico4_lsf_5[DICO4_SIZE_5 * 4] =
 {
    - 1857,
    - 1681,
@@ -11047,7 +11122,7 @@ static const Word32 dico4_lsf_5[DICO4_SIZE_5 * 4] =
 };
 
 /* 5th LSF quantizer (MR122) */
-static const Word32 dico5_lsf_5[DICO5_SIZE_5 * 4] =
+ROM_ALIGN static const Word16 dico5_lsf_5[DICO5_SIZE_5 * 4] =
 {
    - 1002,
    - 929,
@@ -11347,7 +11422,7 @@ static const Word16 lsf_hist_mean_scale[M] =
  * g_fac(2)          (Q12)  frame 1 and 3
  *
  */
-static const Word32 table_gain_MR475[MR475_VQ_SIZE * 4] =
+ROM_ALIGN static const Word16 table_gain_MR475[MR475_VQ_SIZE * 4] =
 {
 /*
  * g_pit(0),
@@ -12383,7 +12458,7 @@ static const Word32 table_gain_MR475[MR475_VQ_SIZE * 4] =
 
 /* table used in 'high' rates: MR67 MR74 */
 #define VQ_SIZE_HIGHRATES 128
-static const Word32 table_gain_highrates[VQ_SIZE_HIGHRATES * 4] =
+ROM_ALIGN static const Word16 table_gain_highrates[VQ_SIZE_HIGHRATES * 4] =
 {
 /*
  * Note: every 4th value (qua_ener) contains the original values from IS641
@@ -12910,7 +12985,7 @@ static const Word32 table_gain_highrates[VQ_SIZE_HIGHRATES * 4] =
 
 /* table used in 'low' rates: MR475, MR515, MR59 */
 #define VQ_SIZE_LOWRATES 64
-static const Word32 table_gain_lowrates[VQ_SIZE_LOWRATES * 4] =
+ROM_ALIGN static const Word16 table_gain_lowrates[VQ_SIZE_LOWRATES * 4] =
 {
 /*
  * g_pit,
@@ -13240,6 +13315,89 @@ static const Word32 inter6[61] =
    0
 };
 
+#ifdef SP_DEC_SSE2
+/*
+ * inter6 taps arranged for Pred_lt_3or6_40_sse2: for each fraction,
+ * five pairs of taps applied to past samples followed by five pairs
+ * applied to future samples, each pair repeated to fill 128 bits
+ */
+static const Word16 inter6_pairs[6][10][8] =
+{
+   {
+      { 29443, 3143, 29443, 3143, 29443, 3143, 29443, 3143 },
+      { -2783, 2259, -2783, 2259, -2783, 2259, -2783, 2259 },
+      { -1666, 1099, -1666, 1099, -1666, 1099, -1666, 1099 },
+      { -634, 308, -634, 308, -634, 308, -634, 308 },
+      { -120, 34, -120, 34, -120, 34, -120, 34 },
+      { 3143, -2783, 3143, -2783, 3143, -2783, 3143, -2783 },
+      { 2259, -1666, 2259, -1666, 2259, -1666, 2259, -1666 },
+      { 1099, -634, 1099, -634, 1099, -634, 1099, -634 },
+      { 308, -120, 308, -120, 308, -120, 308, -120 },
+      { 34, 0, 34, 0, 34, 0, 34, 0 }
+   },
+   {
+      { 28346, -1352, 28346, -1352, 28346, -1352, 28346, -1352 },
+      { -672, 1170, -672, 1170, -672, 1170, -672, 1170 },
+      { -1147, 904, -1147, 904, -1147, 904, -1147, 904 },
+      { -602, 340, -602, 340, -602, 340, -602, 340 },
+      { -163, 73, -163, 73, -163, 73, -163, 73 },
+      { 8693, -4673, 8693, -4673, 8693, -4673, 8693, -4673 },
+      { 2991, -1868, 2991, -1868, 2991, -1868, 2991, -1868 },
+      { 1060, -514, 1060, -514, 1060, -514, 1060, -514 },
+      { 191, -36, 191, -36, 191, -36, 191, -36 },
+      { -19, 38, -19, 38, -19, 38, -19, 38 }
+   },
+   {
+      { 25207, -4402, 25207, -4402, 25207, -4402, 25207, -4402 },
+      { 1211, 0, 1211, 0, 1211, 0, 1211, 0 },
+      { -464, 550, -464, 550, -464, 550, -464, 550 },
+      { -451, 296, -451, 296, -451, 296, -451, 296 },
+      { -165, 91, -165, 91, -165, 91, -165, 91 },
+      { 14701, -5850, 14701, -5850, 14701, -5850, 14701, -5850 },
+      { 3130, -1652, 3130, -1652, 3130, -1652, 3130, -1652 },
+      { 756, -245, 756, -245, 756, -245, 756, -245 },
+      { 0, 78, 0, 78, 0, 78, 0, 78 },
+      { -79, 70, -79, 70, -79, 70, -79, 70 }
+   },
+   {
+      { 20449, -5865, 20449, -5865, 20449, -5865, 20449, -5865 },
+      { 2536, -1001, 2536, -1001, 2536, -1001, 2536, -1001 },
+      { 218, 135, 218, 135, 218, 135, 218, 135 },
+      { -231, 198, -231, 198, -231, 198, -231, 198 },
+      { -132, 89, -132, 89, -132, 89, -132, 89 },
+      { 20449, -5865, 20449, -5865, 20449, -5865, 20449, -5865 },
+      { 2536, -1001, 2536, -1001, 2536, -1001, 2536, -1001 },
+      { 218, 135, 218, 135, 218, 135, 218, 135 },
+      { -231, 198, -231, 198, -231, 198, -231, 198 },
+      { -132, 89, -132, 89, -132, 89, -132, 89 }
+   },
+   {
+      { 14701, -5850, 14701, -5850, 14701, -5850, 14701, -5850 },
+      { 3130, -1652, 3130, -1652, 3130, -1652, 3130, -1652 },
+      { 756, -245, 756, -245, 756, -245, 756, -245 },
+      { 0, 78, 0, 78, 0, 78, 0, 78 },
+      { -79, 70, -79, 70, -79, 70, -79, 70 },
+      { 25207, -4402, 25207, -4402, 25207, -4402, 25207, -4402 },
+      { 1211, 0, 1211, 0, 1211, 0, 1211, 0 },
+      { -464, 550, -464, 550, -464, 550, -464, 550 },
+      { -451, 296, -451, 296, -451, 296, -451, 296 },
+      { -165, 91, -165, 91, -165, 91, -165, 91 }
+   },
+   {
+      { 8693, -4673, 8693, -4673, 8693, -4673, 8693, -4673 },
+      { 2991, -1868, 2991, -1868, 2991, -1868, 2991, -1868 },
+      { 1060, -514, 1060, -514, 1060, -514, 1060, -514 },
+      { 191, -36, 191, -36, 191, -36, 191, -36 },
+      { -19, 38, -19, 38, -19, 38, -19, 38 },
+      { 28346, -1352, 28346, -1352, 28346, -1352, 28346, -1352 },
+      { -672, 1170, -672, 1170, -672, 1170, -672, 1170 },
+      { -1147, 904, -1147, 904, -1147, 904, -1147, 904 },
+      { -602, 340, -602, 340, -602, 340, -602, 340 },
+      { -163, 73, -163, 73, -163, 73, -163, 73 }
+   }
+};
+#endif
+
 /*
  * window for non-MR122 modesm; uses 40 samples lookahead
  * used only in BuildCNParam
@@ -13276,9 +13434,24 @@ static const Word32 window_200_40[L_WINDOW] = {
 /* comparision optimization tables */
 /* definition of bad speech */
 static const UWord8 table_speech_bad[9] = {0, 0, 1, 1, 0, 0, 0, 1, 0};
-static const UWord8 table_SID[9] =       {0, 0, 0, 0, 1, 1, 1, 0, 0};
-static const UWord8 table_DTX[9] =       {0, 0, 0, 0, 1, 1, 1, 1, 0};
-static const UWord8 table_mute[9] =      {0, 0, 0, 0, 1, 0, 1, 1, 0};
+
+/*
+ * DTX state transitions, by previous DTX state and received frame type,
+ * see rx_dtx_handler. Low two bits are the new state (0 SPEECH, 1 DTX,
+ * 2 DTX_MUTE), before the mute for SID parameters gone stale
+ */
+#define DTX_T_STATE 0x03
+#define DTX_T_ENC   0x04   /* encoder in DTX, hangover is counted down */
+#define DTX_T_SID   0x08   /* SID frame */
+#define DTX_T_VALID 0x10   /* SID frame with CN parameters */
+#define DTX_T_OLD   0x20   /* bad SID frame, old CN parameters are used */
+static const UWord8 dtx_transition[3][8] =
+{
+   /*           GOOD  DEGR  ONSET BAD   FIRST UPD   SID_B NO_DATA */
+   /* SPEECH */ {0x00, 0x00, 0x00, 0x00, 0x0D, 0x1D, 0x2D, 0x00},
+   /* DTX */    {0x00, 0x00, 0x01, 0x01, 0x0D, 0x1D, 0x2D, 0x05},
+   /* MUTE */   {0x00, 0x00, 0x01, 0x01, 0x0E, 0x1D, 0x2E, 0x06}
+};
 
 /* track start positions for fixed codebook routines */
 static const Word8 startPos[16] =
@@ -24,13 +24,174 @@
 /*
  * include files
  */
+#ifndef DEC_SMALL
 #include <stdio.h>
+#endif
 #include <stdlib.h>
+#include <stddef.h>
 #include <memory.h>
 #include <math.h>
+
+/*
+ * SSE2 kernels are built wherever compiler has SSE2 intrinsics, MSVC
+ * has them on x86 even if it is not allowed to use SSE2 by itself.
+ * Which kernels run is decided by Speech_Decode_Frame_select_kernels.
+ */
+#if defined( __SSE2__ ) || defined( _M_X64 ) || defined( _M_IX86 )
+#include <emmintrin.h>
+#define SP_DEC_SSE2
+#endif
+/*
+ * NEON kernels are built for ARM64, which always has NEON
+ */
+#if defined( __aarch64__ ) || defined( _M_ARM64 )
+#include <arm_neon.h>
+#define SP_DEC_NEON
+#endif
+#if defined( _MSC_VER )
+#include <intrin.h>
+#pragma intrinsic( _BitScanReverse )
+#endif
+#if defined( __ARM_FEATURE_SAT )
+#include <arm_acle.h>
+#endif
+#if defined( DEC_PROFILE ) && !defined( _MSC_VER ) && ( defined( __i386__ ) \
+      || defined( __x86_64__ ) )
+#include <x86intrin.h>
+#elif defined( DEC_PROFILE ) && !defined( _M_IX86 ) && !defined( _M_X64 )
+#include <time.h>
+#endif
 #include "sp_dec.h"
 #include "rom_dec.h"
 
+/*
+ * CPU features assumed if Speech_Decode_Frame_select_kernels is not
+ * called: SSE2 is always there on x64, and on x86 when compiler is
+ * allowed to use it, NEON on ARM64
+ */
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && \
+      _M_IX86_FP >= 2 )
+#define CPU_DEFAULT SP_DEC_CPU_SSE2
+#elif defined( SP_DEC_NEON )
+#define CPU_DEFAULT SP_DEC_CPU_NEON
+#else
+#define CPU_DEFAULT 0
+#endif
+
+/*
+ * Function expanded at every call, so that branches on constant
+ * arguments are resolved by compiler
+ */
+#if defined( _MSC_VER )
+#define FORCE_INLINE __forceinline
+#elif defined( __GNUC__ )
+#define FORCE_INLINE __inline__ __attribute__( ( always_inline ) )
+#else
+#define FORCE_INLINE
+#endif
+
+/*
+ * Small profile, for devices running a hundred and more instances in a
+ * few megabytes, built with DEC_SMALL defined: state is packed to Word16
+ * as with SP_DEC_STATE16, errors are not printed, and the size of one
+ * instance is checked against DEC_SMALL_BUDGET at compile time, see
+ * Speech_Decode_FrameBlock. Tables are static const in either profile,
+ * one read-only copy shared by all instances.
+ */
+#ifdef DEC_SMALL
+#ifndef SP_DEC_STATE16
+#define SP_DEC_STATE16
+#endif
+#define DEC_ERROR( msg ) ( ( void )0 )
+#else
+#define DEC_ERROR( msg ) fprintf( stderr, msg )
+#endif
+
+/*
+ * Type of the histories and gain memories below. Between frames they only
+ * ever hold 16-bit values, so with SP_DEC_STATE16 defined they are stored
+ * as Word16, which makes decoder state smaller. Arithmetic on them is still
+ * done in Word32, output is the same either way.
+ */
+#ifdef SP_DEC_STATE16
+typedef Word16 HistWord;
+#else
+typedef Word32 HistWord;
+#endif
+
+/*
+ * Kernels with more than one implementation. All decoders use the same
+ * table, which is picked once, before the first decoder is initialized.
+ */
+struct Post_ProcessState;
+
+typedef struct
+{
+   Word32 ( *syn_filt )( Word32 a[], Word32 x[], Word32 y[], Word32 lg, Word32
+         mem[], Word32 update );
+   void ( *residu40 )( const Word32 a[], const Word32 x[], Word32 y[] );
+   void ( *pred_lt_3or6_40 )( Word32 exc[], Word32 T0, Word32 frac, Word32
+         flag3 );
+   Word32 ( *energy )( Word32 in[] );
+   void ( *lsp_az4 )( Word32 lsp[], Word32 a[] );
+   void ( *agc2_scale )( Word32 sig[], Word32 g0 );
+   void ( *agc_scale )( Word32 sig[], const Word32 gain[] );
+   void ( *ph_disp_conv )( Word32 inno[], const Word32 ph_imp[] );
+   Word32 ( *code_energy )( const Word32 code[] );
+   void ( *lsf_pred )( const Word32 past_r_q[], const Word32 fac[], const
+         Word32 mean[], Word32 pred[] );
+   void ( *lsf_lsp )( Word32 lsf[], Word32 lsp[] );
+   void ( *post_process4 )( struct Post_ProcessState *st[], Word32 *signal[],
+         Float32 *synth_float[], Word32 stride, const Float32 scale[] );
+   void ( *residu40_float )( const Float32 a[], const Float32 x[], Float32 y[]
+         );
+   Float32 ( *energy_float )( const Float32 in[] );
+   Word32 ( *bgn_stats )( const Word32 speech[], const HistWord hist[],
+         Word32 stats[] );
+} Kernels;
+
+static const Kernels *kernels = NULL;
+
+/*
+ * Kernels of a thread that asked for plain C ones whatever was picked for
+ * all decoders, to check them against, see
+ * Speech_Decode_Frame_reference_kernels; NULL on other threads
+ */
+#if defined( _MSC_VER )
+#define THREAD_LOCAL __declspec( thread )
+#else
+#define THREAD_LOCAL __thread
+#endif
+static THREAD_LOCAL const Kernels *thread_kernels = NULL;
+#define KERNELS ( thread_kernels != NULL ? thread_kernels : kernels )
+
+/*
+ * Pointer parameters of a function that overlap none of the others,
+ * and local buffers aligned to a vector, so compilers vectorize loops
+ * over them with no overlap or alignment checks at run time
+ */
+#if defined( _MSC_VER )
+#define RESTRICT __restrict
+#define ALIGNED( n ) __declspec( align( n ) )
+#else
+#define RESTRICT __restrict__
+#define ALIGNED( n ) __attribute__( ( aligned( n ) ) )
+#endif
+
+/*
+ * Hint to bring the cache line of a ROM table entry in ahead of its use;
+ * nothing where there is no instruction for it, as on x86 without SSE
+ */
+#if defined( __GNUC__ )
+#define PREFETCH( p ) __builtin_prefetch( p )
+#elif defined( _M_X64 ) || ( defined( _M_IX86_FP ) && ( _M_IX86_FP >= 1 ) )
+#define PREFETCH( p ) _mm_prefetch( ( const char * )( p ), _MM_HINT_T0 )
+#elif defined( _M_ARM64 )
+#define PREFETCH( p ) __prefetch( p )
+#else
+#define PREFETCH( p ) ( ( void )0 )
+#endif
+
 /*
  * Declare structure types
  */
@@ -39,13 +200,27 @@ enum DTXStateType
    SPEECH = 0, DTX, DTX_MUTE
 };
 
+/*
+ * separate blocks for each state, one block allocated by decoder,
+ * or one block provided by caller
+ */
+enum ArenaType
+{
+   ARENA_NONE = 0, ARENA_OWNED, ARENA_EXTERNAL
+};
+
 /*
  * Decoder memory structure
  */
 typedef struct
 {
-   /* history vector of past synthesis speech energy */
-   Word32 frameEnergyHist[L_ENERGYHIST];
+   /*
+    * history vector of past synthesis speech energy, a ring stored twice
+    * over, so the L_ENERGYHIST entries from the oldest one on are always
+    * in a row
+    */
+   HistWord frameEnergyHist[2 * L_ENERGYHIST];
+   Word16 energyOldest;   /* index of the oldest entry */
 
 
    /* state flags */
@@ -57,7 +232,7 @@ typedef struct
 {
    Word32 hangCount;   /* counter; */
    /* history vector of past synthesis speech energy */
-   Word32 cbGainHistory[L_CBGAINHIST];
+   HistWord cbGainHistory[L_CBGAINHIST];
    Word16 hangVar;   /* counter; */
 
 }Cb_gain_averageState;
@@ -76,7 +251,7 @@ typedef struct
 }D_plsfState;
 typedef struct
 {
-   Word32 pbuf[5];
+   HistWord pbuf[5];
    Word32 past_gain_pit;
    Word32 prev_gp;
 
@@ -84,7 +259,7 @@ typedef struct
 }ec_gain_pitchState;
 typedef struct
 {
-   Word32 gbuf[5];
+   HistWord gbuf[5];
    Word32 past_gain_code;
    Word32 prev_gc;
 
@@ -109,7 +284,7 @@ typedef struct
 }gc_predState;
 typedef struct
 {
-   Word32 gainMem[PHDGAINMEMSIZE];
+   HistWord gainMem[PHDGAINMEMSIZE];
    Word32 prevCbGain;
    Word32 prevState;
    Word16 lockFull;
@@ -117,34 +292,44 @@ typedef struct
 
 
 }ph_dispState;
+/*
+ * Speech frames only run the state machine of rx_dtx_handler and add to
+ * the histories, see dtx_dec_activity_update; those fields come first.
+ * The rest is used by comfort noise only and stays out of cache while
+ * speech is decoded, see Speech_Decode_FrameArena
+ */
 typedef struct
 {
    enum DTXStateType dtxGlobalState;   /* contains previous state */
+   Word16 since_last_sid;
+   Word16 decAnaElapsedCount;
+   Word16 dtxHangoverCount;
+   Word16 dtxHangoverAdded;
+   Word16 lsf_hist_ptr;
+   Word16 log_en_hist_ptr;
+   HistWord log_en_hist[DTX_HIST_SIZE];
+   HistWord lsf_hist[M * DTX_HIST_SIZE];
 
+   /* comfort noise */
    Word32 log_en;
    Word32 old_log_en;
    Word32 pn_seed_rx;
+   Word32 true_sid_period_inv;
    Word32 lsp[M];
    Word32 lsp_old[M];
-   Word32 lsf_hist[M * DTX_HIST_SIZE];
-   Word32 lsf_hist_mean[M * DTX_HIST_SIZE];
-   Word32 log_en_hist[DTX_HIST_SIZE];
-   Word32 true_sid_period_inv;
-   Word16 since_last_sid;
-   Word16 lsf_hist_ptr;
+   HistWord lsf_hist_mean[M * DTX_HIST_SIZE];
    Word16 log_pg_mean;
-   Word16 log_en_hist_ptr;
    Word16 log_en_adjust;
-   Word16 dtxHangoverCount;
-   Word16 decAnaElapsedCount;
    Word16 sid_frame;
    Word16 valid_data;
-   Word16 dtxHangoverAdded;
 
 
    /* updated in main decoder */
    Word16 data_updated;   /* marker to know if CNI data is ever renewed */
 
+   /* excitation level of last comfort noise frame, 0 if muted to nothing */
+   Word16 cn_level;
+
 
 }dtx_decState;
 typedef struct
@@ -153,16 +338,24 @@ typedef struct
 
 
 }agcState;
+/*
+ * Fields every speech frame reads come first: pointers to the states of
+ * the parts, scalars of pitch and bad frame handling, then the filter
+ * memories and histories; excitation history follows them. Parameters
+ * for Speech_Decode_Frame_features and what only bad frames use are last
+ */
 typedef struct
 {
-   /* Excitation vector */
-   Word32 old_exc[L_SUBFR + PIT_MAX + L_INTERPOL];
+   D_plsfState * lsfState;
+   gc_predState * pred_state;
+   ec_gain_pitchState * ec_gain_p_st;
+   ec_gain_codeState * ec_gain_c_st;
+   Cb_gain_averageState * Cb_gain_averState;
+   lsp_avgState * lsp_avg_st;
+   Bgn_scdState * background_state;
+   ph_dispState * ph_disp_st;
+   dtx_decState * dtxDecoderState;
    Word32 *exc;
-   Word32 lsp_old[M];
-
-
-   /* Filter's memory */
-   Word32 mem_syn[M];
 
 
    /* pitch sharpening */
@@ -177,26 +370,43 @@ typedef struct
    /* Variables for the source characteristic detector (SCD) */
    Word32 inBackgroundNoise;
    Word32 voicedHangover;
-   Word32 ltpGainHistory[9];
 
 
    /* Memories for bad frame handling */
-   Word32 excEnergyHist[9];
    Word16 prev_bf;
    Word16 prev_pdf;
    Word16 state;
-   Word16 nodataSeed;
+   Word32 lsp_old[M];
 
 
-   Bgn_scdState * background_state;
-   Cb_gain_averageState * Cb_gain_averState;
-   lsp_avgState * lsp_avg_st;
-   D_plsfState * lsfState;
-   ec_gain_pitchState * ec_gain_p_st;
-   ec_gain_codeState * ec_gain_c_st;
-   gc_predState * pred_state;
-   ph_dispState * ph_disp_st;
-   dtx_decState * dtxDecoderState;
+   /* Filter's memory */
+   Word32 mem_syn[M];
+   HistWord ltpGainHistory[9];
+   HistWord excEnergyHist[9];
+
+
+   /*
+    * Excitation vector: history, then excitation of the frame, which exc
+    * moves along subframe by subframe; history is moved to the front
+    * once per frame rather than after each subframe
+    */
+   Word32 old_exc[L_FRAME + PIT_MAX + L_INTERPOL];
+
+   /*
+    * parameters of the speech frame decoded last, see
+    * Speech_Decode_Frame_features: LSPs before it and mid-frame ones of
+    * MR122, and pitch lag, its fraction and gains of each subframe
+    */
+   Word32 feat_lsp_old[M];
+   Word32 feat_lsp_mid[M];
+   Word16 feat_lag[L_FRAME / L_SUBFR];
+   Word16 feat_lag_frac[L_FRAME / L_SUBFR];
+   Word16 feat_gain_pit[L_FRAME / L_SUBFR];
+   Word16 feat_gain_code[L_FRAME / L_SUBFR];
+   enum Mode feat_mode;   /* MRDTX until speech is decoded */
+
+   /* seed of parameters made up for frames with no data */
+   Word16 nodataSeed;
 }Decoder_amrState;
 typedef struct
 {
@@ -205,8 +415,13 @@ typedef struct
    Word32 synth_buf[M + L_FRAME];
    Word32 preemph_state_mem_pre;
    agcState * agc_state;
+
+   /* memories of the floating point engine, see Post_Filter_float */
+   Float32 mem_syn_pst_float[M];
+   Float32 preemph_mem_pre_float;
+   Float32 past_gain_float;
 }Post_FilterState;
-typedef struct
+typedef struct Post_ProcessState
 {
    Word32 y2_hi;
    Word32 y2_lo;
@@ -215,15 +430,177 @@ typedef struct
    Word32 x0;
    Word32 x1;
 
-
+   /* memories of the floating point engine, see Post_Process_float */
+   Float32 y2_float;
+   Float32 y1_float;
+   Float32 x0_float;
+   Float32 x1_float;
 }Post_ProcessState;
 typedef struct
 {
    Decoder_amrState * decoder_amrState;
    Post_FilterState * post_state;
    Post_ProcessState * postHP_state;
+
+   /* how the states are allocated */
+   enum ArenaType arena;
+   void *arena_mem;   /* block to free, if arena == ARENA_OWNED */
+
+   /*
+    * comfort noise muted to no output for good, NO_DATA frames in
+    * silent_mode just advance the noise generator
+    */
+   Word16 silent;
+   enum Mode silent_mode;
+
+   /* excitation energy of the last subframe estimated, see Decoder_amr_estimate */
+   Float32 est_exc_energy;
+
+   /* SP_DEC_ENGINE_* of post filtering, see Speech_Decode_Frame_set_engine */
+   Word16 engine;
+
+   /* floating point output of a 16-bit sample, see Speech_Decode_Frame_set_gain */
+   Float32 out_scale;
+
+   /* work buffers of one frame, see Speech_Decode_FrameScratch */
+   struct Speech_Decode_FrameScratch *scratch;
+
+#ifdef DEC_PROFILE
+   struct Dec_profile profile;
+#endif
 }Speech_Decode_FrameState;
 
+/*
+ * All states of one decoder instance, kept in one block. States every
+ * speech frame goes through follow each other in the order it does;
+ * decoding many streams on one core, the lines of one stream it takes
+ * are then few and contiguous. DTX state is last, so its part used by
+ * comfort noise only comes after everything else, see dtx_decState
+ */
+typedef struct
+{
+   Speech_Decode_FrameState frame;
+   Decoder_amrState decoder_amr;
+   D_plsfState lsf;
+   gc_predState pred;
+   ec_gain_pitchState ec_gain_p;
+   ec_gain_codeState ec_gain_c;
+   Cb_gain_averageState Cb_gain_aver;
+   ph_dispState ph_disp;
+   Bgn_scdState background;
+   lsp_avgState lsp_avg;
+   Post_FilterState post_filter;
+   agcState agc;
+   Post_ProcessState post_process;
+   dtx_decState dtx;
+}Speech_Decode_FrameArena;
+
+/*
+ * LP filter computed from an LSP vector, kept to be reused while the
+ * LSPs stay the same, see Lsp_Az_memo
+ */
+typedef struct
+{
+   Word32 valid;
+   Word32 lsp[M];   /* key */
+   Word32 a[MP1];
+   Word32 pred_err;   /* prediction error of a, if the user needs it */
+}Lsp_AzMemo;
+
+/*
+ * Weighted filters and tilt factor of a Post_Filter subframe, kept to be
+ * reused while LP filter and weighting stay the same
+ */
+typedef struct
+{
+   const Word32 *gamma3;   /* key, NULL when empty */
+   Word32 Az[MP1];   /* key */
+   Word32 Ap3[MP1], Ap4[MP1];
+   Word32 tilt;
+}Post_FilterMemo;
+
+/*
+ * Work buffers of one frame. Nothing in them lives from one frame to
+ * the next, so they are not part of the state snapshots copy, but they
+ * are kept with the decoder rather than on the stack: the same memory
+ * is reused by every frame and stays in cache, and decoding threads
+ * can do with small stacks. Memos are the exception: they hold filters
+ * along with the parameters they were computed from, and are only used
+ * when the parameters are the same, so any state may go with them.
+ */
+typedef struct Speech_Decode_FrameScratch
+{
+#ifndef DEC_SMALL
+   /* states before and after muted NO_DATA frame, see Speech_Decode_Frame_mute */
+   Speech_Decode_FrameArena before, after;
+#endif
+   Word32 Az_dec[AZ_SIZE];   /* decoded Az for post-filter in 4 subframes */
+   Word32 synth_speech[L_FRAME];   /* post filter output */
+   Word32 code[L_SUBFR];   /* algebraic codevector */
+   Word32 excp[L_SUBFR];   /* excitation */
+   Word32 exc_enhanced[L_SUBFR];
+   Word32 ex[L_SUBFR];   /* comfort noise excitation, see dtx_dec */
+   Word32 h[22];   /* see Post_Filter */
+   Post_FilterMemo pf_memo;
+
+   /*
+    * comfort noise filters, see dtx_dec: unchanged once interpolation
+    * of SID parameters is over, one of 8 variabilities is applied
+    */
+   Lsp_AzMemo cn_az, cn_az_variab[8];
+
+   /* floating point engine, see Post_Filter_float */
+   Float32 synth_float[L_FRAME];   /* post filter output */
+   Float32 syn_float[M + L_SUBFR];   /* post filter input of a subframe */
+   Float32 syn_pst_float[M + L_SUBFR];   /* synthesis filter output */
+   Float32 res2_float[L_SUBFR];
+   Float32 h_float[22], Ap3_float[MP1], Ap4_float[MP1];
+}Speech_Decode_FrameScratch;
+
+/*
+ * Memory block of decoder initialized by Speech_Decode_Frame_init_mem,
+ * states first
+ */
+typedef struct
+{
+   Speech_Decode_FrameArena states;
+   Speech_Decode_FrameScratch scratch;
+}Speech_Decode_FrameBlock;
+
+/* arena is aligned to cache line */
+#define ARENA_ALIGN 64
+
+/*
+ * States of a decoder in one block just after reset, pointers aside, see
+ * Speech_Decode_Frame_reset_arena. Built once, by the first thread to
+ * initialize a decoder, and only read after; init_once is 0 before, 1
+ * while it's built and 2 after, see Speech_Decode_Frame_init_once
+ */
+static Speech_Decode_FrameArena pristine;
+static volatile long init_once = 0;
+#if defined( _MSC_VER )
+#define ONCE_LOAD( f ) _InterlockedOr( ( f ), 0 )
+#define ONCE_CLAIM( f ) ( _InterlockedCompareExchange( ( f ), 1, 0 ) == 0 )
+#define ONCE_DONE( f ) _InterlockedExchange( ( f ), 2 )
+#else
+#define ONCE_LOAD( f ) __atomic_load_n( ( f ), __ATOMIC_ACQUIRE )
+#define ONCE_CLAIM( f ) __sync_bool_compare_and_swap( ( f ), 0, 1 )
+#define ONCE_DONE( f ) __atomic_store_n( ( f ), 2, __ATOMIC_RELEASE )
+#endif
+
+#ifdef DEC_SMALL
+/*
+ * Bytes one instance may take in DEC_SMALL builds, see
+ * Speech_Decode_Frame_mem_size; compilation fails here if it takes more
+ */
+#ifndef DEC_SMALL_BUDGET
+#define DEC_SMALL_BUDGET 8192
+#endif
+typedef char Speech_Decode_Frame_over_budget[( sizeof(
+      Speech_Decode_FrameBlock ) + ARENA_ALIGN - 1 <= DEC_SMALL_BUDGET ) ? 1 :
+      -1];
+#endif
+
 
 /*
  * CodAmrReset
@@ -244,7 +621,8 @@ static void Decoder_amr_reset( Decoder_amrState *state, enum Mode mode )
    Word32 i;
 
    /* Cb_gain_average_reset */
-   memset(state->Cb_gain_averState->cbGainHistory, 0, L_CBGAINHIST << 2);
+   memset(state->Cb_gain_averState->cbGainHistory, 0, sizeof(state->
+         Cb_gain_averState->cbGainHistory));
    state->Cb_gain_averState->hangVar = 0;
    state->Cb_gain_averState->hangCount= 0;
 
@@ -252,14 +630,16 @@ static void Decoder_amr_reset( Decoder_amrState *state, enum Mode mode )
    state->exc = state->old_exc + PIT_MAX + L_INTERPOL;
 
    /* Static vectors to zero */
-   memset( state->old_exc, 0, ( PIT_MAX + L_INTERPOL )<<2 );
+   memset( state->old_exc, 0, ( PIT_MAX + L_INTERPOL ) * sizeof( Word32 ) );
 
    if ( mode != MRDTX )
-      memset( state->mem_syn, 0, M <<2 );
+      memset( state->mem_syn, 0, M * sizeof( Word32 ) );
 
    /* initialize pitch sharpening */
    state->sharp = SHARPMIN;
    state->old_T0 = 40;
+   if ( mode != MRDTX )
+      state->feat_mode = MRDTX;
 
    /* Initialize state->lsp_old [] */
    if ( mode != MRDTX ) {
@@ -284,8 +664,8 @@ static void Decoder_amr_reset( Decoder_amrState *state, enum Mode mode )
    state->voicedHangover = 0;
 
    if ( mode != MRDTX )
-      memset( state->excEnergyHist, 0, 9 <<2 );
-   memset( state->ltpGainHistory, 0, 9 <<2 );
+      memset( state->excEnergyHist, 0, sizeof( state->excEnergyHist ) );
+   memset( state->ltpGainHistory, 0, sizeof( state->ltpGainHistory ) );
 
    if ( mode != MRDTX ) {
       state->lsp_avg_st->lsp_meanSave[0] = 1384;
@@ -299,7 +679,7 @@ static void Decoder_amr_reset( Decoder_amrState *state, enum Mode mode )
       state->lsp_avg_st->lsp_meanSave[8] = 12714;
       state->lsp_avg_st->lsp_meanSave[9] = 13701;
    }
-   memset( state->lsfState->past_r_q, 0, M <<2 );
+   memset( state->lsfState->past_r_q, 0, M * sizeof( Word32 ) );
 
    /* Past dequantized lsfs */
    state->lsfState->past_lsf_q[0] = 1384;
@@ -332,13 +712,16 @@ static void Decoder_amr_reset( Decoder_amrState *state, enum Mode mode )
    state->nodataSeed = 21845;
 
    /* Static vectors to zero */
-   memset( state->background_state->frameEnergyHist, 0, L_ENERGYHIST <<2 );
+   memset( state->background_state->frameEnergyHist, 0, sizeof( state->
+         background_state->frameEnergyHist ) );
+   state->background_state->energyOldest = 0;
 
    /* Initialize hangover handling */
    state->background_state->bgHangover = 0;
 
    /* phDispReset */
-   memset( state->ph_disp_st->gainMem, 0, PHDGAINMEMSIZE <<2 );
+   memset( state->ph_disp_st->gainMem, 0, sizeof( state->ph_disp_st->
+         gainMem ) );
    state->ph_disp_st->prevState = 0;
    state->ph_disp_st->prevCbGain = 0;
    state->ph_disp_st->lockFull = 0;
@@ -394,9 +777,10 @@ static void Decoder_amr_reset( Decoder_amrState *state, enum Mode mode )
 
       for ( i = 1; i < DTX_HIST_SIZE; i++ ) {
          memcpy( &state->dtxDecoderState->lsf_hist[M * i], &state->
-               dtxDecoderState->lsf_hist[0], M <<2 );
+               dtxDecoderState->lsf_hist[0], M * sizeof( HistWord ) );
       }
-      memset( state->dtxDecoderState->lsf_hist_mean, 0, M * DTX_HIST_SIZE <<2 );
+      memset( state->dtxDecoderState->lsf_hist_mean, 0, sizeof( state->
+            dtxDecoderState->lsf_hist_mean ) );
 
       /* initialize decoder log frame energy */
       for ( i = 0; i < DTX_HIST_SIZE; i++ ) {
@@ -411,6 +795,7 @@ static void Decoder_amr_reset( Decoder_amrState *state, enum Mode mode )
       state->dtxDecoderState->dtxHangoverAdded = 0;
       state->dtxDecoderState->dtxGlobalState = DTX;
       state->dtxDecoderState->data_updated = 0;
+      state->dtxDecoderState->cn_level = 0;
    }
    return;
 }
@@ -431,7 +816,9 @@ static void Decoder_amr_reset( Decoder_amrState *state, enum Mode mode )
  *    frame_type              O: Frame type
  *
  * Function:
- *    Find the new DTX state
+ *    Find the new DTX state, looked up in dtx_transition. Speech going
+ *    on in SPEECH state, which is what nearly all frames are, takes a
+ *    path of its own with no lookups
  *
  * Returns:
  *    DTXStateType            DTX, DTX_MUTE or SPEECH
@@ -439,18 +826,31 @@ static void Decoder_amr_reset( Decoder_amrState *state, enum Mode mode )
 static enum DTXStateType rx_dtx_handler( dtx_decState *st, enum RXFrameType frame_type )
 {
    enum DTXStateType newState;
-   enum DTXStateType encState;
+   Word32 t;   /* transition */
 
-   /* DTX if SID frame or previously in DTX{_MUTE} and (NO_RX OR BAD_SPEECH) */
-   if ( table_SID[frame_type] | ( ( st->dtxGlobalState != SPEECH ) &
-         table_speech_bad[frame_type] ) ) {
-      newState = DTX;
 
-      /* stay in mute for these input types */
-      if ( ( st->dtxGlobalState == DTX_MUTE ) & table_mute[frame_type] ) {
-         newState = DTX_MUTE;
-      }
+   /*
+    * speech going on, nearly every frame outside pauses: state stays,
+    * encoder is not in DTX either
+    */
+   if ( ( st->dtxGlobalState == SPEECH ) & ( frame_type <= RX_SPEECH_BAD ) ) {
+      st->since_last_sid = 0;
+
+      if ( st->decAnaElapsedCount < 32767 )
+         st->decAnaElapsedCount += 1;
+      st->dtxHangoverAdded = 0;
+      st->dtxHangoverCount = DTX_HANG_CONST;
+      return SPEECH;
+   }
 
+   /*
+    * DTX if SID frame or previously in DTX{_MUTE} and (NO_RX OR BAD_SPEECH),
+    * staying in mute for some of these input types
+    */
+   t = dtx_transition[st->dtxGlobalState][frame_type];
+   newState = ( enum DTXStateType )( t & DTX_T_STATE );
+
+   if ( newState != SPEECH ) {
       /*
        * evaluate if noise parameters are too old
        * since_last_sid is reset when CN parameters have been updated
@@ -463,7 +863,6 @@ static enum DTXStateType rx_dtx_handler( dtx_decState *st, enum RXFrameType fram
       }
    }
    else {
-      newState = SPEECH;
       st->since_last_sid = 0;
    }
 
@@ -479,19 +878,14 @@ static enum DTXStateType rx_dtx_handler( dtx_decState *st, enum RXFrameType fram
    /*
     * update the SPE-SPD DTX hangover synchronization
     * to know when SPE has added dtx hangover
+    * (saturates like add() of the fixed point codec, instead of wrapping
+    * around after 11 minutes without DTX)
     */
-   st->decAnaElapsedCount += 1;
+   if ( st->decAnaElapsedCount < 32767 )
+      st->decAnaElapsedCount += 1;
    st->dtxHangoverAdded = 0;
-   encState = SPEECH;
 
-   if ( table_DTX[frame_type] ) {
-      encState = DTX;
-      if( ( frame_type == RX_NO_DATA ) & ( newState == SPEECH ) ) {
-         encState = SPEECH;
-      }
-   }
-
-   if ( encState == SPEECH ) {
+   if ( !( t & DTX_T_ENC ) ) {
       st->dtxHangoverCount = DTX_HANG_CONST;
    }
    else {
@@ -515,22 +909,12 @@ static enum DTXStateType rx_dtx_handler( dtx_decState *st, enum RXFrameType fram
        * but will do backwards analysis if a hangover period has been added
        * according to the state machine above
        */
-      st->sid_frame = 0;
-      st->valid_data = 0;
-
-      if ( frame_type == RX_SID_FIRST ) {
-         st->sid_frame = 1;
-      }
-      else if ( frame_type == RX_SID_UPDATE ) {
-         st->sid_frame = 1;
-         st->valid_data = 1;
-      }
-      else if ( frame_type == RX_SID_BAD ) {
-         st->sid_frame = 1;
+      st->sid_frame = ( t & DTX_T_SID ) != 0;
+      st->valid_data = ( t & DTX_T_VALID ) != 0;
 
-         /* use old data */
+      /* use old data */
+      if ( t & DTX_T_OLD )
          st->dtxHangoverAdded = 0;
-      }
    }
 
    /* newState is used by both SPEECH AND DTX synthesis routines */
@@ -552,7 +936,7 @@ static enum DTXStateType rx_dtx_handler( dtx_decState *st, enum RXFrameType fram
  * Returns:
  *    void
  */
-static void Lsf_lsp( Word32 lsf[], Word32 lsp[] )
+static void Lsf_lsp( Word32 * RESTRICT lsf, Word32 * RESTRICT lsp )
 {
    Word32 i, ind, offset, tmp;
 
@@ -573,86 +957,260 @@ static void Lsf_lsp( Word32 lsf[], Word32 lsp[] )
 
 
 /*
- * D_plsf_3
+ * Lsf_pred
  *
  *
  * Parameters:
- *    st->past_lsf_q    I: Past dequantized LFSs
- *    st->past_r_q      B: past quantized residual
- *    mode              I: AMR mode
- *    bfi               B: bad frame indicator
- *    indice            I: quantization indices of 3 submatrices, Q0
- *    lsp1_q            O: quantized 1st LSP vector
+ *    past_r_q          I: past quantized residual
+ *    fac               I: prediction factors, Q15
+ *    mean              I: LSF means
+ *    pred              O: predicted LSFs
  *
  * Function:
- *    Decodes the LSP parameters using the received quantization indices.
- *    1st order MA prediction and split by 3 vector quantization (split-VQ)
+ *    MA prediction of D_plsf_3 and D_plsf_5, order M:
+ *    pred[i] = mean[i] + past_r_q[i] * fac[i]
  *
  * Returns:
  *    void
  */
-static void D_plsf_3( D_plsfState *st, enum Mode mode, Word16 bfi, Word16 *
-      indice, Word32 *lsp1_q )
+static void Lsf_pred( const Word32 past_r_q[], const Word32 fac[], const
+      Word32 mean[], Word32 pred[] )
 {
-   Word32 lsf1_r[M], lsf1_q[M];
-   Word32 i, index, temp;
-   const Word32 *p_cb1, *p_cb2, *p_cb3, *p_dico;
-
+   Word32 i;
 
-   /* if bad frame */
-   if ( bfi != 0 ) {
-      /* use the past LSFs slightly shifted towards their mean */
-      for ( i = 0; i < M; i++ ) {
-         /* lsfi_q[i] = ALPHA*past_lsf_q[i] + ONE_ALPHA*meanLsf[i]; */
-         lsf1_q[i] = ( ( st->past_lsf_q[i] * ALPHA ) >> 15 ) + ( ( mean_lsf_3[i]
-               * ONE_ALPHA ) >> 15 );
-      }
 
-      /* estimate past quantized residual to be used in next frame */
-      if ( mode != MRDTX ) {
-         for ( i = 0; i < M; i++ ) {
-            /* temp  = meanLsf[i] +  pastR2_q[i] * pred_fac; */
-            temp = mean_lsf_3[i] + ( ( st->past_r_q[i] * pred_fac[i] ) >> 15 );
-            st->past_r_q[i] = lsf1_q[i] - temp;
-         }
-      }
-      else {
-         for ( i = 0; i < M; i++ ) {
-            /* temp  = meanLsf[i] +  pastR2_q[i]; */
-            temp = mean_lsf_3[i] + st->past_r_q[i];
-            st->past_r_q[i] = lsf1_q[i] - temp;
-         }
-      }
+   for ( i = 0; i < M; i++ ) {
+      pred[i] = mean[i] + ( ( past_r_q[i] * fac[i] ) >> 15 );
    }
+}
+#ifdef SP_DEC_SSE2
 
-   /* if good LSFs received */
-   else {
-      if ( ( mode == MR475 ) | ( mode == MR515 ) ) {
-         /* MR475, MR515 */
-         p_cb1 = dico1_lsf_3;
-         p_cb2 = dico2_lsf_3;
-         p_cb3 = mr515_3_lsf;
-      }
-      else if ( mode == MR795 ) {
-         /* MR795 */
-         p_cb1 = mr795_1_lsf;
-         p_cb2 = dico2_lsf_3;
-         p_cb3 = dico3_lsf_3;
-      }
-      else {
-         /* MR59, MR67, MR74, MR102, MRDTX */
-         p_cb1 = dico1_lsf_3;
-         p_cb2 = dico2_lsf_3;
-         p_cb3 = dico3_lsf_3;
-      }
-
-      /* decode prediction residuals from 3 received indices */
-      index = *indice++;
-      p_dico = &p_cb1[index + index + index];
-      index = *indice++;
-      lsf1_r[0] = *p_dico++;
-      lsf1_r[1] = *p_dico++;
-      lsf1_r[2] = *p_dico++;
+
+/*
+ * Lsf_load_sse2
+ *
+ *
+ * Parameters:
+ *    x                 I: vector of order M
+ *    v                 O: the vector in 3 registers, last 2 lanes zero
+ *
+ * Function:
+ *    Loads a vector of order M without reading past its end
+ *
+ * Returns:
+ *    void
+ */
+static FORCE_INLINE void Lsf_load_sse2( const Word32 x[], __m128i v[3] )
+{
+   v[0] = _mm_loadu_si128( ( __m128i * )&x[0] );
+   v[1] = _mm_loadu_si128( ( __m128i * )&x[4] );
+   v[2] = _mm_loadl_epi64( ( __m128i * )&x[8] );
+}
+
+
+/*
+ * Lsf_store_sse2
+ *
+ *
+ * Parameters:
+ *    v                 I: vector of order M in 3 registers
+ *    x                 O: the vector
+ *
+ * Function:
+ *    Stores a vector of order M without writing past its end
+ *
+ * Returns:
+ *    void
+ */
+static FORCE_INLINE void Lsf_store_sse2( __m128i v[3], Word32 x[] )
+{
+   _mm_storeu_si128( ( __m128i * )&x[0], v[0] );
+   _mm_storeu_si128( ( __m128i * )&x[4], v[1] );
+   _mm_storel_epi64( ( __m128i * )&x[8], v[2] );
+}
+
+
+/*
+ * Lsf_pred_sse2
+ *
+ *
+ * Parameters:
+ *    past_r_q          I: past quantized residual
+ *    fac               I: prediction factors, Q15
+ *    mean              I: LSF means
+ *    pred              O: predicted LSFs
+ *
+ * Function:
+ *    Same as Lsf_pred, the whole vector at once. Residual and factors
+ *    are multiplied in 16 bits, pmaddwd against factors paired with
+ *    zero; residual that does not fit in 16 bits, which decoded frames
+ *    never give, is left to Lsf_pred.
+ *
+ * Returns:
+ *    void
+ */
+static void Lsf_pred_sse2( const Word32 past_r_q[], const Word32 fac[], const
+      Word32 mean[], Word32 pred[] )
+{
+   __m128i r[3], f[3], m[3], over;
+   Word32 i;
+
+
+   Lsf_load_sse2( past_r_q, r );
+   over = _mm_setzero_si128( );
+
+   for ( i = 0; i < 3; i++ ) {
+      over = _mm_or_si128( over, _mm_cmpgt_epi32( r[i], _mm_set1_epi32( 32767 )
+            ) );
+      over = _mm_or_si128( over, _mm_cmplt_epi32( r[i], _mm_set1_epi32( -32768
+            ) ) );
+   }
+
+   if ( _mm_movemask_epi8( over ) != 0 ) {
+      Lsf_pred( past_r_q, fac, mean, pred );
+      return;
+   }
+   Lsf_load_sse2( fac, f );
+   Lsf_load_sse2( mean, m );
+
+   for ( i = 0; i < 3; i++ ) {
+      r[i] = _mm_add_epi32( m[i], _mm_srai_epi32( _mm_madd_epi16( r[i], f[i] ),
+            15 ) );
+   }
+   Lsf_store_sse2( r, pred );
+}
+
+
+/*
+ * Lsf_lsp_sse2
+ *
+ *
+ * Parameters:
+ *    lsf               I: vector of LSFs
+ *    lsp               O: vector of LSPs
+ *
+ * Function:
+ *    Same as Lsf_lsp, the whole vector at once. Table entries are
+ *    fetched one by one, interpolation is done in vectors. Offset is 8
+ *    bits and neighbouring entries of cos_table differ by less than 16
+ *    bits, so their product is a pmaddwd against offset paired with
+ *    zero.
+ *
+ * Returns:
+ *    void
+ */
+static void Lsf_lsp_sse2( Word32 * RESTRICT lsf, Word32 * RESTRICT lsp )
+{
+   __m128i v[3], lo, hi, offset;
+   Word32 ind[12];
+   Word32 i;
+
+
+   Lsf_load_sse2( lsf, v );
+
+   for ( i = 0; i < 3; i++ ) {
+      _mm_storeu_si128( ( __m128i * )&ind[4 * i], _mm_srai_epi32( v[i], 8 ) );
+   }
+
+   /* lanes past M look up the first entry */
+   ind[10] = ind[11] = 0;
+
+   for ( i = 0; i < 3; i++ ) {
+      lo = _mm_set_epi32( cos_table[ind[4 * i + 3]], cos_table[ind[4 * i + 2]],
+            cos_table[ind[4 * i + 1]], cos_table[ind[4 * i]] );
+      hi = _mm_set_epi32( cos_table[ind[4 * i + 3] + 1], cos_table[ind[4 * i + 2]
+            + 1], cos_table[ind[4 * i + 1] + 1], cos_table[ind[4 * i] + 1] );
+      offset = _mm_and_si128( v[i], _mm_set1_epi32( 0x00ff ) );
+      v[i] = _mm_add_epi32( lo, _mm_srai_epi32( _mm_slli_epi32( _mm_madd_epi16(
+            _mm_sub_epi32( hi, lo ), offset ), 1 ), 9 ) );
+   }
+   Lsf_store_sse2( v, lsp );
+}
+#endif
+
+
+/*
+ * D_plsf_3
+ *
+ *
+ * Parameters:
+ *    st->past_lsf_q    I: Past dequantized LFSs
+ *    st->past_r_q      B: past quantized residual
+ *    mode              I: AMR mode
+ *    bfi               B: bad frame indicator
+ *    indice            I: quantization indices of 3 submatrices, Q0
+ *    lsp1_q            O: quantized 1st LSP vector
+ *
+ * Function:
+ *    Decodes the LSP parameters using the received quantization indices.
+ *    1st order MA prediction and split by 3 vector quantization (split-VQ)
+ *
+ * Returns:
+ *    void
+ */
+static void D_plsf_3( D_plsfState *st, enum Mode mode, Word16 bfi, Word16 *
+      indice, Word32 *lsp1_q )
+{
+   ALIGNED( 16 ) Word32 lsf1_r[M], lsf1_q[M], pred[M];
+   Word32 i, index, temp;
+   const Word16 *p_cb1, *p_cb2, *p_cb3, *p_dico;
+
+
+   /* if bad frame */
+   if ( bfi != 0 ) {
+      /* use the past LSFs slightly shifted towards their mean */
+      for ( i = 0; i < M; i++ ) {
+         /* lsfi_q[i] = ALPHA*past_lsf_q[i] + ONE_ALPHA*meanLsf[i]; */
+         lsf1_q[i] = ( ( st->past_lsf_q[i] * ALPHA ) >> 15 ) + ( ( mean_lsf_3[i]
+               * ONE_ALPHA ) >> 15 );
+      }
+
+      /* estimate past quantized residual to be used in next frame */
+      if ( mode != MRDTX ) {
+         /* temp  = meanLsf[i] +  pastR2_q[i] * pred_fac; */
+         KERNELS->lsf_pred( st->past_r_q, pred_fac, mean_lsf_3, pred );
+
+         for ( i = 0; i < M; i++ ) {
+            st->past_r_q[i] = lsf1_q[i] - pred[i];
+         }
+      }
+      else {
+         for ( i = 0; i < M; i++ ) {
+            /* temp  = meanLsf[i] +  pastR2_q[i]; */
+            temp = mean_lsf_3[i] + st->past_r_q[i];
+            st->past_r_q[i] = lsf1_q[i] - temp;
+         }
+      }
+   }
+
+   /* if good LSFs received */
+   else {
+      if ( ( mode == MR475 ) | ( mode == MR515 ) ) {
+         /* MR475, MR515 */
+         p_cb1 = dico1_lsf_3;
+         p_cb2 = dico2_lsf_3;
+         p_cb3 = mr515_3_lsf;
+      }
+      else if ( mode == MR795 ) {
+         /* MR795 */
+         p_cb1 = mr795_1_lsf;
+         p_cb2 = dico2_lsf_3;
+         p_cb3 = dico3_lsf_3;
+      }
+      else {
+         /* MR59, MR67, MR74, MR102, MRDTX */
+         p_cb1 = dico1_lsf_3;
+         p_cb2 = dico2_lsf_3;
+         p_cb3 = dico3_lsf_3;
+      }
+
+      /* decode prediction residuals from 3 received indices */
+      index = *indice++;
+      p_dico = &p_cb1[index + index + index];
+      index = *indice++;
+      lsf1_r[0] = *p_dico++;
+      lsf1_r[1] = *p_dico++;
+      lsf1_r[2] = *p_dico++;
 
       if ( ( mode == MR475 ) | ( mode == MR515 ) ) {
          /* MR475, MR515 only using every second entry */
@@ -671,17 +1229,18 @@ static void D_plsf_3( D_plsfState *st, enum Mode mode, Word16 bfi, Word16 *
 
       /* Compute quantized LSFs and update the past quantized residual */
       if ( mode != MRDTX ) {
+         KERNELS->lsf_pred( st->past_r_q, pred_fac, mean_lsf_3, pred );
+
          for ( i = 0; i < M; i++ ) {
-            lsf1_q[i] = lsf1_r[i] + ( mean_lsf_3[i] + ( ( st->past_r_q[i] *
-                  pred_fac[i] ) >> 15 ) );
+            lsf1_q[i] = lsf1_r[i] + pred[i];
          }
-         memcpy( st->past_r_q, lsf1_r, M <<2 );
+         memcpy( st->past_r_q, lsf1_r, M * sizeof( Word32 ) );
       }
       else {
          for ( i = 0; i < M; i++ ) {
             lsf1_q[i] = lsf1_r[i] + ( mean_lsf_3[i] + st->past_r_q[i] );
          }
-         memcpy( st->past_r_q, lsf1_r, M <<2 );
+         memcpy( st->past_r_q, lsf1_r, M * sizeof( Word32 ) );
       }
    }
 
@@ -694,14 +1253,37 @@ static void D_plsf_3( D_plsfState *st, enum Mode mode, Word16 bfi, Word16 *
       }
       temp = lsf1_q[i] + LSF_GAP;
    }
-   memcpy( st->past_lsf_q, lsf1_q, M <<2 );
+   memcpy( st->past_lsf_q, lsf1_q, M * sizeof( Word32 ) );
 
    /*  convert LSFs to the cosine domain */
-   Lsf_lsp( lsf1_q, lsp1_q );
+   KERNELS->lsf_lsp( lsf1_q, lsp1_q );
    return;
 }
 
 
+/*
+ * pseudonoise_step
+ *
+ *
+ * Parameters:
+ *    s_reg             I: CN generator shift register state
+ *    no_bits           I: Number of bits, 1 to 3
+ *
+ * Function:
+ *    Advances the 31-bit shift register by no_bits at once. Feedback
+ *    taps are bits 0 and 28, so the 3 bits shifted in next only depend
+ *    on bits already there: bit 30 - k receives bit k xor bit 28 + k.
+ *
+ * Returns:
+ *    new state
+ */
+static FORCE_INLINE Word32 pseudonoise_step( Word32 s_reg, Word32 no_bits )
+{
+   return ( s_reg >> no_bits ) | ( ( ( s_reg ^ ( s_reg >> 28 ) ) & ( ( 1 <<
+         no_bits ) - 1 ) ) << ( 31 - no_bits ) );
+}
+
+
 /*
  * pseudonoise
  *
@@ -711,37 +1293,28 @@ static void D_plsf_3( D_plsfState *st, enum Mode mode, Word16 bfi, Word16 *
  *    no_bits           I: Number of bits
  *
  * Function:
- *    pseudonoise
+ *    pseudonoise, up to 3 bits a step. Bits come out of bit 0 of the
+ *    register, first one in the highest bit of noise_bits.
  *
  * Returns:
  *    noise_bits
  */
 static Word32 pseudonoise( Word32 *shift_reg, Word32 no_bits )
 {
-   Word32 noise_bits, Sn, i;
+   Word32 noise_bits, n;
    Word32 s_reg;
 
 
    s_reg = *shift_reg;
    noise_bits = 0;
 
-   for ( i = 0; i < no_bits; i++ ) {
-      /* State n == 31 */
-      Sn = s_reg & 0x00000001L;
-
-      /* State n == 3 */
-      if ( s_reg & 0x10000000L ) {
-         Sn = Sn ^ 0x1L;
-      }
-      else {
-         Sn = Sn ^ 0x0L;
-      }
-      noise_bits = ( noise_bits << 1 ) | ( s_reg & 1 );
-      s_reg = s_reg >> 1;
-
-      if ( Sn & 1 ) {
-         s_reg = s_reg | 0x40000000L;
-      }
+   while ( no_bits > 0 ) {
+      n = no_bits < 3 ? no_bits : 3;
+      /* low 3 bits of register in reverse order, first n of them */
+      noise_bits = ( noise_bits << n ) | ( ( ( ( s_reg & 1 ) << 2 ) | ( s_reg &
+            2 ) | ( ( s_reg >> 2 ) & 1 ) ) >> ( 3 - n ) );
+      s_reg = pseudonoise_step( s_reg, n );
+      no_bits -= n;
    }
    *shift_reg = s_reg;
    return noise_bits;
@@ -763,7 +1336,7 @@ static Word32 pseudonoise( Word32 *shift_reg, Word32 no_bits )
  * Returns:
  *    void
  */
-static void Lsp_lsf( Word32 lsp[], Word32 lsf[] )
+static void Lsp_lsf( Word32 * RESTRICT lsp, Word32 * RESTRICT lsf )
 {
    Word32 i, ind = 63;   /* begin at end of table -1 */
 
@@ -951,123 +1524,426 @@ static void Lsp_Az( Word32 lsp[], Word32 a[] )
 
 
 /*
- * A_Refl
+ * Lsp_Az4
  *
  *
  * Parameters:
- *    a                 I: Directform coefficients
- *    refl              O: Reflection coefficients
+ *    lsp                 I: Line spectral frequencies of 4 subframes [4 * M]
+ *    a                   O: Predictor coefficients of 4 subframes [AZ_SIZE]
  *
  * Function:
- *    Converts from the directform coefficients to reflection coefficients
+ *    Lsp_Az of all subframes of a frame
  *
  * Returns:
  *    void
  */
-static void A_Refl( Word32 a[], Word32 refl[] )
+static void Lsp_Az4( Word32 lsp[], Word32 a[] )
 {
-   /* local variables */
-   int normShift;
-   Word32 aState[M], bState[M];
-   Word32 normProd, acc, temp, mult, scale, i, j;
-
-
-   /* initialize states */
-   memcpy( aState, a, M <<2 );
-
-   /* backward Levinson recursion */
-   for ( i = M - 1; i >= 0; i-- ) {
-      if ( labs( aState[i] ) >= 4096 ) {
-         goto ExitRefl;
-      }
-      refl[i] = aState[i] << 3;
-      temp = ( refl[i] * refl[i] ) << 1;
-      acc = ( MAX_32 - temp );
-      normShift=0;
-      if (acc != 0){
-         temp = acc;
-         while (!(temp & 0x40000000))
-         {
-            normShift++;
-            temp = temp << 1;
-         }
-      }
-      else{
-         normShift = 0;
-      }
-      scale = 15 - normShift;
-      acc = ( acc << normShift );
-      temp = ( acc + ( Word32 )0x00008000L );
-
-      if ( temp > 0 ) {
-         normProd = temp >> 16;
-         mult = 0x20000000L / normProd;
-      }
-      else
-         mult = 16384;
-
-      for ( j = 0; j < i; j++ ) {
-         acc = aState[j] << 16;
-         acc -= ( refl[i] * aState[i - j - 1] ) << 1;
-         temp = ( acc + ( Word32 )0x00008000L ) >> 16;
-         temp = ( mult * temp ) << 1;
+   Word32 i;
 
-         if ( scale > 0 ) {
-            if ( ( temp & ( ( Word32 )1 << ( scale - 1 ) ) ) != 0 ) {
-               temp = ( temp >> scale ) + 1;
-            }
-            else
-               temp = ( temp >> scale );
-         }
-         else
-            temp = ( temp >> scale );
 
-         if ( labs( temp ) > 32767 ) {
-            goto ExitRefl;
-         }
-         bState[j] = temp;
-      }
-      memcpy( aState, bState, i <<2 );
+   for ( i = 0; i < 4; i++ ) {
+      Lsp_Az( &lsp[i * M], &a[i * MP1] );
    }
-   return;
-ExitRefl:
-   memset( refl, 0, M <<2 );
 }
 
 
 /*
- * Log2_norm
+ * Lsp_Az_memo
  *
  *
  * Parameters:
- *    x                 I: input value
- *    exp               I: exponent
- *    exponent          O: Integer part of Log2. (range: 0<=val<=30)
- *    fraction          O: Fractional part of Log2. (range: 0<=val<1)
+ *    memo                B: LP filter of the last LSPs, memo->a receives
+ *                           that of lsp
+ *    lsp                 I: Line spectral frequencies
  *
  * Function:
- *    Computes log2
- *
- *    Computes log2(L_x, exp),  where   L_x is positive and
- *    normalized, and exp is the normalisation exponent
- *    If L_x is negative or zero, the result is 0.
- *
- *    The function Log2(L_x) is approximated by a table and linear
- *    interpolation. The following steps are used to compute Log2(L_x)
- *
- *    exponent = 30-normExponent
- *    i = bit25-b31 of L_x;  32<=i<=63  (because of normalization).
- *    a = bit10-b24
- *    i -=32
- *    fraction = table[i]<<16 - (table[i] - table[i+1]) * a * 2
+ *    Lsp_Az, unless lsp are those the memo was computed from
  *
  * Returns:
- *    void
+ *    1 if filter was computed, 0 if memo had it
  */
-static void Log2_norm( Word32 x, Word32 exp, Word32 *exponent, Word32 *
-      fraction )
+static Word32 Lsp_Az_memo( Lsp_AzMemo *memo, Word32 lsp[] )
 {
-   Word32 y, i, a;
+   if ( memo->valid && memcmp( memo->lsp, lsp, M <<2 ) == 0 )
+      return 0;
+   Lsp_Az( lsp, memo->a );
+   memcpy( memo->lsp, lsp, M * sizeof( Word32 ) );
+   memo->valid = 1;
+   return 1;
+}
+#ifdef SP_DEC_SSE2
+
+
+/*
+ * Lsp_pol_mpy_sse2
+ *
+ *
+ * Parameters:
+ *    f                   I: polynomial coefficient, 8 lanes in 2 vectors
+ *    l                   I: LSP, 8 lanes
+ *    t                   O: product, 8 lanes in 2 vectors
+ *
+ * Function:
+ *    ( ( ( f >> 16 ) * l ) + ( ( ( f & 0xFFFE ) * l ) >> 16 ) ) << 2 of
+ *    Get_lsp_pol. Low half of f is unsigned, high 16 bits of its product
+ *    are those of signed product, plus l if the half has top bit set.
+ *
+ * Returns:
+ *    void
+ */
+static void Lsp_pol_mpy_sse2( __m128i f[], __m128i l, __m128i t[] )
+{
+   __m128i fh, fl, pl, ph, q;
+
+
+   fh = _mm_packs_epi32( _mm_srai_epi32( f[0], 16 ), _mm_srai_epi32( f[1], 16 )
+         );
+   fl = _mm_packs_epi32( _mm_srai_epi32( _mm_slli_epi32( f[0], 16 ), 16 ),
+         _mm_srai_epi32( _mm_slli_epi32( f[1], 16 ), 16 ) );
+   fl = _mm_and_si128( fl, _mm_set1_epi16( ( short )0xFFFE ) );
+   pl = _mm_mullo_epi16( fh, l );
+   ph = _mm_mulhi_epi16( fh, l );
+   q = _mm_add_epi16( _mm_mulhi_epi16( fl, l ), _mm_and_si128( _mm_srai_epi16(
+         fl, 15 ), l ) );
+   t[0] = _mm_slli_epi32( _mm_add_epi32( _mm_unpacklo_epi16( pl, ph ),
+         _mm_srai_epi32( _mm_unpacklo_epi16( q, q ), 16 ) ), 2 );
+   t[1] = _mm_slli_epi32( _mm_add_epi32( _mm_unpackhi_epi16( pl, ph ),
+         _mm_srai_epi32( _mm_unpackhi_epi16( q, q ), 16 ) ), 2 );
+}
+
+
+/*
+ * Lsp_Az4_sse2
+ *
+ *
+ * Parameters:
+ *    lsp                 I: Line spectral frequencies of 4 subframes [4 * M]
+ *    a                   O: Predictor coefficients of 4 subframes [AZ_SIZE]
+ *
+ * Function:
+ *    Lsp_Az4 with SSE2. Both polynomials of all 4 subframes are expanded
+ *    at once, F1 of the subframes in lanes 0..3, F2 in lanes 4..7, with
+ *    recursion of Get_lsp_pol in 32-bit wrapping arithmetic. Cosines out
+ *    of 16-bit range never come from LSF conversion, they are left to
+ *    Lsp_Az4 all the same.
+ *
+ * Returns:
+ *    void
+ */
+static void Lsp_Az4_sse2( Word32 lsp[], Word32 a[] )
+{
+   __m128i f[6][2], t[2], l32[2], l;
+   __m128i T0, r[11], one, over, t0, t1, t2, t3;
+   Word32 out[4];
+   Word32 i, j, k;
+
+
+   over = _mm_setzero_si128( );
+
+   for ( i = 1; i <= 5; i++ ) {
+      /* lsp[2 * i - 2] of F1, lsp[2 * i - 1] of F2 */
+      j = 2 * i - 2;
+      l32[0] = _mm_set_epi32( lsp[3 * M + j], lsp[2 * M + j], lsp[M + j], lsp[j]
+            );
+      l32[1] = _mm_set_epi32( lsp[3 * M + j + 1], lsp[2 * M + j + 1], lsp[M + j
+            + 1], lsp[j + 1] );
+      l = _mm_packs_epi32( l32[0], l32[1] );
+
+      /* a cosine saturated by packing differs from its sign extension */
+      over = _mm_or_si128( over, _mm_xor_si128( l32[0], _mm_srai_epi32(
+            _mm_unpacklo_epi16( l, l ), 16 ) ) );
+      over = _mm_or_si128( over, _mm_xor_si128( l32[1], _mm_srai_epi32(
+            _mm_unpackhi_epi16( l, l ), 16 ) ) );
+
+      if ( i == 1 ) {
+         for ( k = 0; k < 2; k++ ) {
+            f[0][k] = _mm_set1_epi32( 16777216L );
+            f[1][k] = _mm_slli_epi32( _mm_sub_epi32( _mm_setzero_si128( ),
+                  l32[k] ), 10 );
+         }
+         continue;
+      }
+      Lsp_pol_mpy_sse2( f[i - 1], l, t );
+
+      for ( k = 0; k < 2; k++ ) {
+         f[i][k] = _mm_sub_epi32( _mm_slli_epi32( f[i - 2][k], 1 ), t[k] );
+      }
+
+      for ( j = i - 1; j >= 2; j-- ) {
+         Lsp_pol_mpy_sse2( f[j - 1], l, t );
+
+         for ( k = 0; k < 2; k++ ) {
+            f[j][k] = _mm_sub_epi32( _mm_add_epi32( f[j][k], f[j - 2][k] ), t[k]
+                  );
+         }
+      }
+
+      for ( k = 0; k < 2; k++ ) {
+         f[1][k] = _mm_sub_epi32( f[1][k], _mm_slli_epi32( l32[k], 10 ) );
+      }
+   }
+
+   if ( _mm_movemask_epi8( over ) != 0 ) {
+      Lsp_Az4( lsp, a );
+      return;
+   }
+
+   for ( i = 5; i > 0; i-- ) {
+      f[i][0] = _mm_add_epi32( f[i][0], f[i - 1][0] );
+      f[i][1] = _mm_sub_epi32( f[i][1], f[i - 1][1] );
+   }
+   one = _mm_set1_epi32( 1 );
+
+   /* (Word16)(T0 >> 13), plus 1 if bit 12 is set, as in Lsp_Az */
+   for ( i = 1, j = 10; i <= 5; i++, j-- ) {
+      T0 = _mm_add_epi32( f[i][0], f[i][1] );
+      r[i] = _mm_srai_epi32( _mm_slli_epi32( _mm_srai_epi32( T0, 13 ), 16 ),
+            16 );
+      r[i] = _mm_add_epi32( r[i], _mm_and_si128( _mm_srli_epi32( T0, 12 ), one
+            ) );
+      T0 = _mm_sub_epi32( f[i][0], f[i][1] );
+      r[j] = _mm_srai_epi32( _mm_slli_epi32( _mm_srai_epi32( T0, 13 ), 16 ),
+            16 );
+      r[j] = _mm_add_epi32( r[j], _mm_and_si128( _mm_srli_epi32( T0, 12 ), one
+            ) );
+   }
+   r[0] = _mm_set1_epi32( 4096 );
+
+   /* lanes are subframes, transpose 4 coefficients at a time into rows */
+   for ( i = 0; i < 8; i += 4 ) {
+      t0 = _mm_unpacklo_epi32( r[i], r[i + 1] );
+      t1 = _mm_unpacklo_epi32( r[i + 2], r[i + 3] );
+      t2 = _mm_unpackhi_epi32( r[i], r[i + 1] );
+      t3 = _mm_unpackhi_epi32( r[i + 2], r[i + 3] );
+      _mm_storeu_si128( ( __m128i * )&a[i], _mm_unpacklo_epi64( t0, t1 ) );
+      _mm_storeu_si128( ( __m128i * )&a[MP1 + i], _mm_unpackhi_epi64( t0, t1 )
+            );
+      _mm_storeu_si128( ( __m128i * )&a[2 * MP1 + i], _mm_unpacklo_epi64( t2,
+            t3 ) );
+      _mm_storeu_si128( ( __m128i * )&a[3 * MP1 + i], _mm_unpackhi_epi64( t2,
+            t3 ) );
+   }
+
+   for ( i = 8; i <= 10; i++ ) {
+      _mm_storeu_si128( ( __m128i * )out, r[i] );
+
+      for ( k = 0; k < 4; k++ ) {
+         a[k * MP1 + i] = out[k];
+      }
+   }
+}
+#endif
+
+
+/*
+ * Basic operations
+ *
+ * Saturation and normalization of the fixed point code, each a single
+ * instruction where the target has one: ssat on ARM cores with the
+ * saturating instructions, bsr or clz for Norm_bit. x86 has no scalar
+ * saturation, comparisons there compile to conditional moves without
+ * branches. Vectors saturate with packs in the SSE2 kernels.
+ */
+
+/*
+ * Sat16
+ *
+ *
+ * Parameters:
+ *    x                 I: value to saturate
+ *
+ * Function:
+ *    Limit x to 16 bits
+ *
+ * Returns:
+ *    x, -32768 if below, 32767 if above
+ */
+static FORCE_INLINE Word32 Sat16( Word32 x )
+{
+#if defined( __ARM_FEATURE_SAT )
+   return __ssat( ( int )x, 16 );
+#else
+   return x < -32768 ? -32768 : x > 32767 ? 32767 : x;
+#endif
+}
+
+
+/*
+ * Sat31
+ *
+ *
+ * Parameters:
+ *    x                 I: value to saturate
+ *
+ * Function:
+ *    Limit x to 31 bits, range of the accumulators, which leaves room
+ *    for one more product of 16-bit values without wrapping around
+ *
+ * Returns:
+ *    x, -1073741824 if below, 1073741823 if above
+ */
+static FORCE_INLINE Word32 Sat31( Word32 x )
+{
+#if defined( __ARM_FEATURE_SAT )
+   return __ssat( ( int )x, 31 );
+#else
+   return x < -1073741824 ? -1073741824 : x > 1073741823 ? 1073741823 : x;
+#endif
+}
+
+
+/*
+ * Norm_bit
+ *
+ *
+ * Parameters:
+ *    x                 I: value to normalize
+ *    bit               I: bit to normalize to
+ *
+ * Function:
+ *    Number of left shifts which bring the highest set bit of x, of those
+ *    at or below bit, to bit. Same count as of the normalization loops
+ *    shifting x one bit at a time, in a single bit scan instruction.
+ *
+ * Returns:
+ *    number of shifts, 0 if no bit at or below bit is set
+ */
+static FORCE_INLINE Word32 Norm_bit( Word32 x, Word32 bit )
+{
+   unsigned long v;   /* bits of x at or below bit */
+#if defined( _MSC_VER )
+   unsigned long msb;
+#elif !defined( __GNUC__ )
+   Word32 n;
+#endif
+
+
+   v = ( unsigned long )x & ( ( 2UL << bit ) - 1 );
+
+   if ( v == 0 )
+      return 0;
+#if defined( _MSC_VER )
+   _BitScanReverse( &msb, v );
+   return bit - ( Word32 )msb;
+#elif defined( __GNUC__ )
+   return bit - ( 31 - __builtin_clz( ( unsigned int )v ) );
+#else
+   for ( n = 0; !( v & ( 1UL << bit ) ); n++ ) {
+      v = v << 1;
+   }
+   return n;
+#endif
+}
+
+
+/*
+ * A_Refl
+ *
+ *
+ * Parameters:
+ *    a                 I: Directform coefficients
+ *    refl              O: Reflection coefficients
+ *
+ * Function:
+ *    Converts from the directform coefficients to reflection coefficients
+ *
+ * Returns:
+ *    void
+ */
+static void A_Refl( Word32 a[], Word32 refl[] )
+{
+   /* local variables */
+   int normShift;
+   Word32 aState[M], bState[M];
+   Word32 normProd, acc, temp, mult, scale, i, j;
+
+
+   /* initialize states */
+   memcpy( aState, a, M * sizeof( Word32 ) );
+
+   /* backward Levinson recursion */
+   for ( i = M - 1; i >= 0; i-- ) {
+      if ( abs( aState[i] ) >= 4096 ) {
+         goto ExitRefl;
+      }
+      refl[i] = aState[i] << 3;
+      temp = ( refl[i] * refl[i] ) << 1;
+      acc = ( MAX_32 - temp );
+      normShift = Norm_bit( acc, 30 );
+      scale = 15 - normShift;
+      acc = ( acc << normShift );
+      temp = ( acc + ( Word32 )0x00008000L );
+
+      if ( temp > 0 ) {
+         normProd = temp >> 16;
+         mult = 0x20000000L / normProd;
+      }
+      else
+         mult = 16384;
+
+      for ( j = 0; j < i; j++ ) {
+         acc = aState[j] << 16;
+         acc -= ( refl[i] * aState[i - j - 1] ) << 1;
+         temp = ( acc + ( Word32 )0x00008000L ) >> 16;
+         temp = ( mult * temp ) << 1;
+
+         if ( scale > 0 ) {
+            if ( ( temp & ( ( Word32 )1 << ( scale - 1 ) ) ) != 0 ) {
+               temp = ( temp >> scale ) + 1;
+            }
+            else
+               temp = ( temp >> scale );
+         }
+         else
+            temp = ( temp >> scale );
+
+         if ( abs( temp ) > 32767 ) {
+            goto ExitRefl;
+         }
+         bState[j] = temp;
+      }
+      memcpy( aState, bState, i * sizeof( Word32 ) );
+   }
+   return;
+ExitRefl:
+   memset( refl, 0, M * sizeof( Word32 ) );
+}
+
+
+/*
+ * Log2_norm
+ *
+ *
+ * Parameters:
+ *    x                 I: input value
+ *    exp               I: exponent
+ *    exponent          O: Integer part of Log2. (range: 0<=val<=30)
+ *    fraction          O: Fractional part of Log2. (range: 0<=val<1)
+ *
+ * Function:
+ *    Computes log2
+ *
+ *    Computes log2(L_x, exp),  where   L_x is positive and
+ *    normalized, and exp is the normalisation exponent
+ *    If L_x is negative or zero, the result is 0.
+ *
+ *    The function Log2(L_x) is approximated by a table and linear
+ *    interpolation. The following steps are used to compute Log2(L_x)
+ *
+ *    exponent = 30-normExponent
+ *    i = bit25-b31 of L_x;  32<=i<=63  (because of normalization).
+ *    a = bit10-b24
+ *    i -=32
+ *    fraction = table[i]<<16 - (table[i] - table[i+1]) * a * 2
+ *
+ * Returns:
+ *    void
+ */
+static void Log2_norm( Word32 x, Word32 exp, Word32 *exponent, Word32 *
+      fraction )
+{
+   Word32 y, i, a;
 
 
    if ( x <= 0 ) {
@@ -1110,16 +1986,11 @@ static void Log2_norm( Word32 x, Word32 exp, Word32 *exponent, Word32 *
  */
 static void Log2( Word32 x, Word32 *exponent, Word32 *fraction )
 {
-   int tmp, exp=0;
+   Word32 exp = 0;
 
-   if (x != 0){
-         tmp = x;
-         while (!((tmp & 0x80000000) ^ ((tmp & 0x40000000) << 1)))
-         {
-            exp++;
-            tmp = tmp << 1;
-         }
-      }
+   /* negative x stays negative when normalized, Log2_norm gives 0 for it */
+   if ( x > 0 )
+      exp = Norm_bit( x, 30 );
    Log2_norm( x <<exp, exp, exponent, fraction );
 }
 
@@ -1190,31 +2061,29 @@ static Word32 Pow2( Word32 exponent, Word32 fraction )
  *    cod               O: Generated CN fixed codebook vector
  *
  * Function:
- *    Generate CN fixed codebook vector
+ *    Generate CN fixed codebook vector. Each pulse takes 3 bits of the
+ *    generator, 2 of position and 1 of sign, which are the low bits of
+ *    the shift register, so it is advanced 3 bits a pulse.
  *
  * Returns:
  *    void
  */
 static void Build_CN_code( Word32 *seed, Word32 cod[] )
 {
-   Word32 i, j, k;
+   Word32 i, k, s_reg = *seed;
 
 
-   memset( cod, 0, L_SUBFR <<2 );
+   memset( cod, 0, L_SUBFR * sizeof( Word32 ) );
 
    for ( k = 0; k < 10; k++ ) {
-      i = pseudonoise( seed, 2 );   /* generate pulse position */
-      i = ( i * 20 ) >> 1;
-      i = ( i + k );
-      j = pseudonoise( seed, 1 );   /* generate sign           */
+      /* generate pulse position, first bit is the high one */
+      i = ( s_reg & 1 ) * 20 + ( s_reg & 2 ) * 5 + k;
 
-      if ( j > 0 ) {
-         cod[i] = 4096;
-      }
-      else {
-         cod[i] = -4096;
-      }
+      /* generate sign */
+      cod[i] = ( s_reg & 4 ) ? 4096 : -4096;
+      s_reg = pseudonoise_step( s_reg, 3 );
    }
+   *seed = s_reg;
    return;
 }
 
@@ -1311,54 +2180,89 @@ static void Build_CN_param( Word16 *seed, enum Mode mode, Word16 parm[] )
  * Function:
  *    Perform synthesis filtering through 1/A(z).
  *
+ *    Each output depends on the one before, so the filter is bound by
+ *    latency of the recursion rather than by arithmetic. Past outputs
+ *    and coefficients are kept in locals, so they are not reloaded from
+ *    memory that has just been stored, and the newest output enters the
+ *    sum last, so all other products are computed while it's pending.
+ *    The sum is the same, since Word32 arithmetic wraps around.
+ *    x and y may be the same buffer.
+ *
  * Returns:
- *    void
+ *    1 if any output was saturated, 0 otherwise
  */
 static Word32 Syn_filt( Word32 a[], Word32 x[], Word32 y[], Word32 lg, Word32 mem[]
       , Word32 update )
 {
-   Word32 tmp[50];   /* malloc is slow */
-   Word32 s, a0, overflow = 0;
-   Word32 *yy, *yy_limit;
+   Word32 i, s, overflow = 0;
+   Word32 a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10;
+   Word32 y1, y2, y3, y4, y5, y6, y7, y8, y9, y10;
 
 
-   /* Copy mem[] to yy[] */
-   memcpy( tmp, mem, 40 );
-   yy = tmp + M;
-   yy_limit = yy + lg;
    a0 = a[0];
+   a1 = a[1];
+   a2 = a[2];
+   a3 = a[3];
+   a4 = a[4];
+   a5 = a[5];
+   a6 = a[6];
+   a7 = a[7];
+   a8 = a[8];
+   a9 = a[9];
+   a10 = a[10];
+
+   /* past outputs, y1 is the newest */
+   y1 = mem[9];
+   y2 = mem[8];
+   y3 = mem[7];
+   y4 = mem[6];
+   y5 = mem[5];
+   y6 = mem[4];
+   y7 = mem[3];
+   y8 = mem[2];
+   y9 = mem[1];
+   y10 = mem[0];
 
    /* Do the filtering. */
-   while ( yy < yy_limit ) {
-
-      s = *x++ * a0;
-      s -= yy[-1] * a[1];
-      s -= yy[-2] * a[2];
-      s -= yy[-3] * a[3];
-      s -= yy[-4] * a[4];
-      s -= yy[-5] * a[5];
-      s -= yy[-6] * a[6];
-      s -= yy[-7] * a[7];
-      s -= yy[-8] * a[8];
-      s -= yy[-9] * a[9];
-      s -= yy[-10] * a[10];
-      if ( labs( s ) < 0x7ffffff )
-         *yy = ( s + 0x800L ) >> 12;
+   for ( i = 0; i < lg; i++ ) {
+      s = x[i] * a0;
+      s -= y10 * a10;
+      s -= y9 * a9;
+      s -= y8 * a8;
+      s -= y7 * a7;
+      s -= y6 * a6;
+      s -= y5 * a5;
+      s -= y4 * a4;
+      s -= y3 * a3;
+      s -= y2 * a2;
+      s -= y1 * a1;
+
+      y10 = y9;
+      y9 = y8;
+      y8 = y7;
+      y7 = y6;
+      y6 = y5;
+      y5 = y4;
+      y4 = y3;
+      y3 = y2;
+      y2 = y1;
+
+      if ( abs( s ) < 0x7ffffff )
+         y1 = ( s + 0x800L ) >> 12;
       else if ( s > 0 ) {
-         *yy = 32767;
+         y1 = 32767;
          overflow = 1;
       }
       else {
-         *yy = -32768;
+         y1 = -32768;
          overflow = 1;
       }
-      yy++;
+      y[i] = y1;
    }
-   memcpy( y, &tmp[M], lg <<2 );
 
    /* Update of memory if update==1 */
    if ( update ) {
-      memcpy( mem, &y[lg - M], 40 );
+      memcpy( mem, &y[lg - M], M * sizeof( Word32 ) );
    }
    return overflow;
 }
@@ -1390,7 +2294,7 @@ static void Syn_filt_overflow( Word32 a[], Word32 x[], Word32 y[], Word32 lg, Wo
 
 
    /* Copy mem[] to yy[] */
-   memcpy( tmp, mem, 40 );
+   memcpy( tmp, mem, M * sizeof( Word32 ) );
    yy = tmp + M;
    a0 = a[0];
 
@@ -1399,16 +2303,10 @@ static void Syn_filt_overflow( Word32 a[], Word32 x[], Word32 y[], Word32 lg, Wo
       s = x[i] * a0;
 
       for ( j = 1; j <= M; j++ ) {
-         s -= a[j] * yy[ - j];
-         if (s > 1073741823){
-            s = 1073741823;
-         }
-         else if ( s < -1073741824) {
-            s = -1073741824;
-         }
+         s = Sat31( s - a[j] * yy[ - j] );
       }
 
-      if ( labs( s ) < 0x7FFE800 )
+      if ( abs( s ) < 0x7FFE800 )
          *yy = ( s + 0x800L ) >> 12;
       else if ( s > 0 ) {
          *yy = 32767;
@@ -1418,11 +2316,11 @@ static void Syn_filt_overflow( Word32 a[], Word32 x[], Word32 y[], Word32 lg, Wo
       }
       yy++;
    }
-   memcpy( y, &tmp[M], lg <<2 );
+   memcpy( y, &tmp[M], lg * sizeof( Word32 ) );
 
    /* Update of memory if update==1 */
    if ( update ) {
-      memcpy( mem, &y[lg - M], 40 );
+      memcpy( mem, &y[lg - M], M * sizeof( Word32 ) );
    }
    return;
 }
@@ -1444,6 +2342,7 @@ static void Syn_filt_overflow( Word32 a[], Word32 x[], Word32 y[], Word32 lg, Wo
  *    parm                          I: vector of synthesis parameters
  *    synth                         O: synthesised speech
  *    A_t                           O: decoded LP filter in 4 subframes
+ *    w                             -: work buffers
  *
  * Function:
  *    DTX
@@ -1454,9 +2353,9 @@ static void Syn_filt_overflow( Word32 a[], Word32 x[], Word32 y[], Word32 lg, Wo
 static void dtx_dec( dtx_decState *st, Word32 *mem_syn, D_plsfState *lsfState,
       gc_predState *pred_state, Cb_gain_averageState *averState, enum
       DTXStateType new_state, enum Mode mode, Word16 parm[], Word32 synth[],
-      Word32 A_t[] )
+      Word32 A_t[], Speech_Decode_FrameScratch *w )
 {
-   Word32 ex[L_SUBFR], acoeff[11], acoeff_variab[M + 1], lsp_int[M];
+   Word32 *acoeff, *acoeff_variab, *ex = w->ex, lsp_int[M];
    Word32 refl[M], lsf[M], lsf_int[M], lsf_int_variab[M], lsp_int_variab[M];
    Word32 i, j, int_fac, log_en_int, pred_err, log_pg_e, log_pg_m, log_pg;
    Word32 negative, lsf_mean, lsf_variab_index, lsf_variab_factor, ptr;
@@ -1476,7 +2375,8 @@ static void dtx_dec( dtx_decState *st, Word32 *mem_syn, D_plsfState *lsfState,
       if ( ptr == 80 ) {
          ptr = 0;
       }
-      memcpy( &st->lsf_hist[ptr], &st->lsf_hist[st->lsf_hist_ptr], M <<2 );
+      memcpy( &st->lsf_hist[ptr], &st->lsf_hist[st->lsf_hist_ptr], M * sizeof(
+            HistWord ) );
       ptr = st->log_en_hist_ptr + 1;
 
       if ( ptr == DTX_HIST_SIZE ) {
@@ -1489,7 +2389,7 @@ static void dtx_dec( dtx_decState *st, Word32 *mem_syn, D_plsfState *lsfState,
        * from decoded signal (SID_FIRST)
        */
       st->log_en = 0;
-      memset( lsf, 0, M <<2 );
+      memset( lsf, 0, M * sizeof( Word32 ) );
 
       /* average energy and lsp */
       for ( i = 0; i < DTX_HIST_SIZE; i++ ) {
@@ -1503,7 +2403,7 @@ static void dtx_dec( dtx_decState *st, Word32 *mem_syn, D_plsfState *lsfState,
       for ( j = 0; j < M; j++ ) {
          lsf[j] = lsf[j] >> 3;   /* divide by 8 */
       }
-      Lsf_lsp( lsf, st->lsp );
+      KERNELS->lsf_lsp( lsf, st->lsp );
 
       /*
        * make log_en speech coder mode independent
@@ -1512,7 +2412,7 @@ static void dtx_dec( dtx_decState *st, Word32 *mem_syn, D_plsfState *lsfState,
       st->log_en = st->log_en - st->log_en_adjust;
 
       /* compute lsf variability vector */
-      memcpy( st->lsf_hist_mean, st->lsf_hist, 80 <<2 );
+      memcpy( st->lsf_hist_mean, st->lsf_hist, sizeof( st->lsf_hist_mean ) );
 
       for ( i = 0; i < M; i++ ) {
          lsf_mean = 0;
@@ -1543,7 +2443,7 @@ static void dtx_dec( dtx_decState *st, Word32 *mem_syn, D_plsfState *lsfState,
             else {
                negative = 0;
             }
-            st->lsf_hist_mean[i + j * M] = labs( st->lsf_hist_mean[i + j * M] );
+            st->lsf_hist_mean[i + j * M] = abs( st->lsf_hist_mean[i + j * M] );
 
             /* apply soft limit */
             if ( st->lsf_hist_mean[i + j * M] > 655 ) {
@@ -1568,7 +2468,7 @@ static void dtx_dec( dtx_decState *st, Word32 *mem_syn, D_plsfState *lsfState,
        * Set old SID parameters, always shift
        * even if there is no new valid_data
        */
-      memcpy( st->lsp_old, st->lsp, M <<2 );
+      memcpy( st->lsp_old, st->lsp, M * sizeof( Word32 ) );
       st->old_log_en = st->log_en;
 
       if ( st->valid_data != 0 ) /* new data available (no CRC) */ {
@@ -1590,11 +2490,12 @@ static void dtx_dec( dtx_decState *st, Word32 *mem_syn, D_plsfState *lsfState,
          else {
             st->true_sid_period_inv = 16384;   /* 0.5 it Q15 */
          }
-         memcpy( lsfState->past_r_q, &past_rq_init[parm[0] * M], M <<2 );
+         memcpy( lsfState->past_r_q, &past_rq_init[parm[0] * M], M *
+               sizeof( Word32 ) );
          D_plsf_3( lsfState, MRDTX, 0, &parm[1], st->lsp );
 
          /* reset for next speech frame */
-         memset( lsfState->past_r_q, 0, M <<2 );
+         memset( lsfState->past_r_q, 0, M * sizeof( Word32 ) );
          log_en_index = parm[4];
 
          /* Q11 and divide by 4 */
@@ -1613,7 +2514,7 @@ static void dtx_dec( dtx_decState *st, Word32 *mem_syn, D_plsfState *lsfState,
           * or when SID_UPD has been received right after SPEECH
           */
          if ( ( st->data_updated == 0 ) || ( st->dtxGlobalState == SPEECH ) ) {
-            memcpy( st->lsp_old, st->lsp, M <<2 );
+            memcpy( st->lsp_old, st->lsp, M * sizeof( Word32 ) );
             st->old_log_en = st->log_en;
          }
       }   /* endif valid_data */
@@ -1716,7 +2617,7 @@ static void dtx_dec( dtx_decState *st, Word32 *mem_syn, D_plsfState *lsfState,
    Lsp_lsf( lsp_int, lsf_int );
 
    /* apply lsf variability */
-   memcpy( lsf_int_variab, lsf_int, M <<2 );
+   memcpy( lsf_int_variab, lsf_int, M * sizeof( Word32 ) );
 
    for ( i = 0; i < M; i++ ) {
       lsf_int_variab[i] = lsf_int_variab[i] + ( ( lsf_variab_factor * st->
@@ -1728,38 +2629,44 @@ static void dtx_dec( dtx_decState *st, Word32 *mem_syn, D_plsfState *lsfState,
    Reorder_lsf( lsf_int_variab, LSF_GAP );
 
    /* copy lsf to speech decoders lsf state */
-   memcpy( lsfState->past_lsf_q, lsf_int, M <<2 );
+   memcpy( lsfState->past_lsf_q, lsf_int, M * sizeof( Word32 ) );
 
    /* convert to lsp */
-   Lsf_lsp( lsf_int, lsp_int );
-   Lsf_lsp( lsf_int_variab, lsp_int_variab );
+   KERNELS->lsf_lsp( lsf_int, lsp_int );
+   KERNELS->lsf_lsp( lsf_int_variab, lsp_int_variab );
 
      /* Compute acoeffs Q12 acoeff is used for level
       * normalization and Post_Filter, acoeff_variab is
       * used for synthesis filter
       * by doing this we make sure that the level
       * in high frequenncies does not jump up and down
+      * both are kept until LSPs change, which they don't
+      * once interpolation is over
       */
-   Lsp_Az( lsp_int, acoeff );
-   Lsp_Az( lsp_int_variab, acoeff_variab );
-
-   /* For use in Post_Filter */
-   memcpy( &A_t[0], acoeff, MP1 <<2 );
-   memcpy( &A_t[MP1], acoeff, MP1 <<2 );
-   memcpy( &A_t[MP1 <<1], acoeff, MP1 <<2 );
-   memcpy( &A_t[MP1 + MP1 + MP1], acoeff, MP1 <<2 );
-
-   /* Compute reflection coefficients Q15 */
-   A_Refl( &acoeff[1], refl );
+   if ( Lsp_Az_memo( &w->cn_az, lsp_int ) ) {
+      /* Compute reflection coefficients Q15 */
+      A_Refl( &w->cn_az.a[1], refl );
 
-   /* Compute prediction error in Q15 */
-   /* 0.99997 in Q15 */
-   pred_err = MAX_16;
+      /* Compute prediction error in Q15 */
+      /* 0.99997 in Q15 */
+      pred_err = MAX_16;
 
-   for ( i = 0; i < M; i++ ) {
-      pred_err = ( pred_err * ( MAX_16 - ( ( refl[i] * refl[i] ) >> 15 ) ) ) >>
-            15;
+      for ( i = 0; i < M; i++ ) {
+         pred_err = ( pred_err * ( MAX_16 - ( ( refl[i] * refl[i] ) >> 15 ) ) )
+               >> 15;
+      }
+      w->cn_az.pred_err = pred_err;
    }
+   Lsp_Az_memo( &w->cn_az_variab[lsf_variab_index], lsp_int_variab );
+   acoeff = w->cn_az.a;
+   acoeff_variab = w->cn_az_variab[lsf_variab_index].a;
+   pred_err = w->cn_az.pred_err;
+
+   /* For use in Post_Filter */
+   memcpy( &A_t[0], acoeff, MP1 * sizeof( Word32 ) );
+   memcpy( &A_t[MP1], acoeff, MP1 * sizeof( Word32 ) );
+   memcpy( &A_t[MP1 <<1], acoeff, MP1 * sizeof( Word32 ) );
+   memcpy( &A_t[MP1 + MP1 + MP1], acoeff, MP1 * sizeof( Word32 ) );
 
    /* compute logarithm of prediction gain */
    Log2( pred_err, &log_pg_e, &log_pg_m );
@@ -1792,6 +2699,7 @@ static void dtx_dec( dtx_decState *st, Word32 *mem_syn, D_plsfState *lsfState,
 
    /* Q4 */
    level = ( Word16 )( Pow2( log_en_int_e, log_en_int_m ) );
+   st->cn_level = level;
 
    for ( i = 0; i < 4; i++ ) {
       /* Compute innovation vector */
@@ -1802,7 +2710,8 @@ static void dtx_dec( dtx_decState *st, Word32 *mem_syn, D_plsfState *lsfState,
       }
 
       /* Synthesize */
-      Syn_filt( acoeff_variab, ex, &synth[i * L_SUBFR], L_SUBFR, mem_syn, 1 );
+      KERNELS->syn_filt( acoeff_variab, ex, &synth[i * L_SUBFR], L_SUBFR,
+            mem_syn, 1 );
    }   /* next i */
 
    /* reset codebook averaging variables */
@@ -1842,7 +2751,7 @@ static void dtx_dec( dtx_decState *st, Word32 *mem_syn, D_plsfState *lsfState,
          }
       }
       st->since_last_sid = 0;
-      memcpy( st->lsp_old, st->lsp, M << 2 );
+      memcpy( st->lsp_old, st->lsp, M * sizeof( Word32 ) );
       st->old_log_en = st->log_en;
 
       /* subtract 1/8 in Q11 i.e -6/8 dB */
@@ -1921,36 +2830,27 @@ static void lsp_avg( lsp_avgState *st, Word32 *lsp )
  * Returns:
  *    void
  */
-static void Int_lpc_1and3( Word32 lsp_old[], Word32 lsp_mid[], Word32 lsp_new[],
-      Word32 Az[] )
+static void Int_lpc_1and3( const Word32 * RESTRICT lsp_old, const Word32 *
+      RESTRICT lsp_mid, const Word32 * RESTRICT lsp_new, Word32 Az[] )
 {
-   Word32 lsp[M];
+   ALIGNED( 16 ) Word32 lsp[4 * M];   /* LSPs of the subframes, converted at once */
    Word32 i;
 
 
-   /* lsp[i] = lsp_mid[i] * 0.5 + lsp_old[i] * 0.5 */
    for ( i = 0; i < 10; i++ ) {
+      /* Subframe 1, lsp[i] = lsp_mid[i] * 0.5 + lsp_old[i] * 0.5 */
       lsp[i] = ( lsp_mid[i] >> 1 ) + ( lsp_old[i] >> 1 );
-   }
 
-   /* Subframe 1 */
-   Lsp_Az( lsp, Az );
-   Az += MP1;
+      /* Subframe 2 */
+      lsp[M + i] = lsp_mid[i];
 
-   /* Subframe 2 */
-   Lsp_Az( lsp_mid, Az );
-   Az += MP1;
+      /* Subframe 3 */
+      lsp[2 * M + i] = ( lsp_mid[i] >> 1 ) + ( lsp_new[i] >> 1 );
 
-   for ( i = 0; i < 10; i++ ) {
-      lsp[i] = ( lsp_mid[i] >> 1 ) + ( lsp_new[i] >> 1 );
+      /* Subframe 4 */
+      lsp[3 * M + i] = lsp_new[i];
    }
-
-   /* Subframe 3 */
-   Lsp_Az( lsp, Az );
-   Az += MP1;
-
-   /* Subframe 4 */
-   Lsp_Az( lsp_new, Az );
+   KERNELS->lsp_az4( lsp, Az );
    return;
 }
 
@@ -1977,38 +2877,28 @@ static void Int_lpc_1and3( Word32 lsp_old[], Word32 lsp_mid[], Word32 lsp_new[],
  * Returns:
  *    void
  */
-static void Int_lpc_1to3( Word32 lsp_old[], Word32 lsp_new[], Word32 Az[] )
+static void Int_lpc_1to3( const Word32 * RESTRICT lsp_old, const Word32 *
+      RESTRICT lsp_new, Word32 Az[] )
 {
-   Word32 lsp[M];
+   ALIGNED( 16 ) Word32 lsp[4 * M];   /* LSPs of the subframes, converted at once */
    Word32 i;
 
 
    for ( i = 0; i < 10; i++ ) {
+      /* Subframe 1 */
       lsp[i] = ( lsp_new[i] >> 2 ) + ( lsp_old[i] - ( lsp_old[i] >> 2 ) );
-   }
 
-   /* Subframe 1 */
-   Lsp_Az( lsp, Az );
-   Az += MP1;
+      /* Subframe 2 */
+      lsp[M + i] = ( lsp_old[i] >> 1 ) + ( lsp_new[i] >> 1 );
 
-   for ( i = 0; i < 10; i++ ) {
-      lsp[i] = ( lsp_old[i] >> 1 ) + ( lsp_new[i] >> 1 );
-   }
-
-   /* Subframe 2 */
-   Lsp_Az( lsp, Az );
-   Az += MP1;
+      /* Subframe 3 */
+      lsp[2 * M + i] = ( lsp_old[i] >> 2 ) + ( lsp_new[i] - ( lsp_new[i] >> 2 )
+            );
 
-   for ( i = 0; i < 10; i++ ) {
-      lsp[i] = ( lsp_old[i] >> 2 ) + ( lsp_new[i] - ( lsp_new[i] >> 2 ) );
+      /* Subframe 4 */
+      lsp[3 * M + i] = lsp_new[i];
    }
-
-   /* Subframe 3 */
-   Lsp_Az( lsp, Az );
-   Az += MP1;
-
-   /* Subframe 4 */
-   Lsp_Az( lsp_new, Az );
+   KERNELS->lsp_az4( lsp, Az );
    return;
 }
 
@@ -2035,9 +2925,9 @@ static void Int_lpc_1to3( Word32 lsp_old[], Word32 lsp_new[], Word32 Az[] )
 static void D_plsf_5( D_plsfState *st, Word16 bfi, Word16 *indice, Word32 *lsp1_q
       , Word32 *lsp2_q )
 {
-   Word32 lsf1_r[M], lsf2_r[M], lsf1_q[M], lsf2_q[M];
-   Word32 i, temp1, temp2, sign;
-   const Word32 *p_dico;
+   ALIGNED( 16 ) Word32 lsf1_r[M], lsf2_r[M], lsf1_q[M], lsf2_q[M], pred[M];
+   Word32 i, sign;
+   const Word16 *p_dico;
 
 
    /* if bad frame */
@@ -2050,17 +2940,14 @@ static void D_plsf_5( D_plsfState *st, Word16 bfi, Word16 *indice, Word32 *lsp1_
          lsf1_q[i + 1] = ( ( st->past_lsf_q[i + 1] * ALPHA_122 ) >> 15 ) + ( (
                mean_lsf_5[i + 1] * ONE_ALPHA_122 ) >> 15 );
       }
-      memcpy( lsf2_q, lsf1_q, M <<2 );
+      memcpy( lsf2_q, lsf1_q, M * sizeof( Word32 ) );
 
       /* estimate past quantized residual to be used in next frame */
-      for ( i = 0; i < M; i += 2 ) {
-         /* temp  = meanLsf[i] +  st->past_r_q[i] * LSPPpred_facMR122; */
-         temp1 = mean_lsf_5[i] + ( ( st->past_r_q[i] * LSP_PRED_FAC_MR122 ) >>
-               15 );
-         temp2 = mean_lsf_5[i + 1] +( ( st->past_r_q[i + 1] *LSP_PRED_FAC_MR122
-               ) >> 15 );
-         st->past_r_q[i] = lsf2_q[i] - temp1;
-         st->past_r_q[i + 1] = lsf2_q[i + 1] -temp2;
+      /* temp  = meanLsf[i] +  st->past_r_q[i] * LSPPpred_facMR122; */
+      KERNELS->lsf_pred( st->past_r_q, pred_fac_122, mean_lsf_5, pred );
+
+      for ( i = 0; i < M; i++ ) {
+         st->past_r_q[i] = lsf2_q[i] - pred[i];
       }
    }
 
@@ -2105,11 +2992,11 @@ static void D_plsf_5( D_plsfState *st, Word16 bfi, Word16 *indice, Word32 *lsp1_
       lsf2_r[9] = *p_dico++;
 
       /* Compute quantized LSFs and update the past quantized residual */
+      KERNELS->lsf_pred( st->past_r_q, pred_fac_122, mean_lsf_5, pred );
+
       for ( i = 0; i < M; i++ ) {
-         temp1 = mean_lsf_5[i] + ( ( st->past_r_q[i] * LSP_PRED_FAC_MR122 ) >>
-               15 );
-         lsf1_q[i] = lsf1_r[i] + temp1;
-         lsf2_q[i] = lsf2_r[i] + temp1;
+         lsf1_q[i] = lsf1_r[i] + pred[i];
+         lsf2_q[i] = lsf2_r[i] + pred[i];
          st->past_r_q[i] = lsf2_r[i];
       }
    }
@@ -2117,11 +3004,11 @@ static void D_plsf_5( D_plsfState *st, Word16 bfi, Word16 *indice, Word32 *lsp1_
    /* verification that LSFs have minimum distance of LSF_GAP Hz */
    Reorder_lsf( lsf1_q, LSF_GAP );
    Reorder_lsf( lsf2_q, LSF_GAP );
-   memcpy( st->past_lsf_q, lsf2_q, M <<2 );
+   memcpy( st->past_lsf_q, lsf2_q, M * sizeof( Word32 ) );
 
    /*  convert LSFs to the cosine domain */
-   Lsf_lsp( lsf1_q, lsp1_q );
-   Lsf_lsp( lsf2_q, lsp2_q );
+   KERNELS->lsf_lsp( lsf1_q, lsp1_q );
+   KERNELS->lsf_lsp( lsf2_q, lsp2_q );
    return;
 }
 
@@ -2153,7 +3040,8 @@ static void D_plsf_5( D_plsfState *st, Word16 bfi, Word16 *indice, Word32 *lsp1_
  *    void
  */
 static void Dec_lag3( Word32 index, Word32 t0_min, Word32 t0_max, Word32 i_subfr
-      , Word32 T0_prev, Word32 *T0, Word32 *T0_frac, Word32 flag4 )
+      , Word32 T0_prev, Word32 * RESTRICT T0, Word32 * RESTRICT T0_frac, Word32
+      flag4 )
 {
    Word32 i, tmp_lag;
 
@@ -2296,6 +3184,112 @@ static void Pred_lt_3or6_40( Word32 exc[], Word32 T0, Word32 frac, Word32 flag3
 }
 
 
+#ifdef SP_DEC_SSE2
+/*
+ * Pred_lt_3or6_40_sse2
+ *
+ *
+ * Parameters:
+ *    exc               B: excitation buffer
+ *    T0                I: integer pitch lag
+ *    frac              I: fraction of lag
+ *    flag3             I: if set, upsampling rate = 3 (6 otherwise)
+ *
+ * Function:
+ *    Same as Pred_lt_3or6_40, eight outputs at a time.
+ *    Samples are packed to 16 bits and pairs of taps from
+ *    inter6_pairs are applied with pmaddwd. Outputs become inputs
+ *    of outputs at least 8 samples later, so each block of eight
+ *    depends on earlier blocks only, as long as lag is at least 18.
+ *    Otherwise, or if any sample does not fit in 16 bits,
+ *    Pred_lt_3or6_40 computes the whole subframe again, from
+ *    the same inputs.
+ *
+ * Returns:
+ *    void
+ */
+static void Pred_lt_3or6_40_sse2( Word32 exc[], Word32 T0, Word32 frac, Word32
+      flag3 )
+{
+   short e16[200];   /* exc[p - 9..39] */
+   short *e;
+   __m128i c[10], d0, d1, lo, hi, over;
+   Word32 i, k, n, p, t;
+
+
+   /* newest past sample of first output and phase, as in Pred_lt_3or6_40 */
+   p = -T0;
+   t = -frac;
+
+   if ( flag3 != 0 ) {
+      t <<= 1;
+   }
+
+   if ( t < 0 ) {
+      t += 6;
+      p--;
+   }
+
+   if ( p > -18 ) {
+      Pred_lt_3or6_40( exc, T0, frac, flag3 );
+      return;
+   }
+   e = e16 + 9 - p;
+
+   for ( i = p - 9; i < 0; i++ ) {
+      if ( exc[i] < -32768 || exc[i] > 32767 ) {
+         Pred_lt_3or6_40( exc, T0, frac, flag3 );
+         return;
+      }
+      e[i] = ( short )exc[i];
+   }
+
+   for ( k = 0; k < 10; k++ ) {
+      c[k] = _mm_loadu_si128( ( const __m128i * )inter6_pairs[t][k] );
+   }
+
+   for ( n = 0; n < 40; n += 8 ) {
+      lo = _mm_set1_epi32( 0x4000 );
+      hi = lo;
+
+      for ( k = 0; k < 10; k += 2 ) {
+         /* past samples x1[-k], x1[-k - 1] */
+         d0 = _mm_loadu_si128( ( __m128i * )&e[p + n - k] );
+         d1 = _mm_loadu_si128( ( __m128i * )&e[p + n - k - 1] );
+         lo = _mm_add_epi32( lo, _mm_madd_epi16( _mm_unpacklo_epi16( d0, d1 ),
+               c[k >> 1] ) );
+         hi = _mm_add_epi32( hi, _mm_madd_epi16( _mm_unpackhi_epi16( d0, d1 ),
+               c[k >> 1] ) );
+
+         /* future samples x2[k], x2[k + 1] */
+         d0 = _mm_loadu_si128( ( __m128i * )&e[p + n + 1 + k] );
+         d1 = _mm_loadu_si128( ( __m128i * )&e[p + n + 2 + k] );
+         lo = _mm_add_epi32( lo, _mm_madd_epi16( _mm_unpacklo_epi16( d0, d1 ),
+               c[5 + ( k >> 1 )] ) );
+         hi = _mm_add_epi32( hi, _mm_madd_epi16( _mm_unpackhi_epi16( d0, d1 ),
+               c[5 + ( k >> 1 )] ) );
+      }
+      lo = _mm_srai_epi32( lo, 15 );
+      hi = _mm_srai_epi32( hi, 15 );
+      _mm_storeu_si128( ( __m128i * )&exc[n], lo );
+      _mm_storeu_si128( ( __m128i * )&exc[n + 4], hi );
+
+      /* outputs are inputs of later blocks, so they have to fit too */
+      over = _mm_or_si128( _mm_cmpgt_epi32( lo, _mm_set1_epi32( 32767 ) ),
+            _mm_cmplt_epi32( lo, _mm_set1_epi32( -32768 ) ) );
+      over = _mm_or_si128( over, _mm_cmpgt_epi32( hi, _mm_set1_epi32( 32767 ) ) );
+      over = _mm_or_si128( over, _mm_cmplt_epi32( hi, _mm_set1_epi32( -32768 ) ) );
+
+      if ( _mm_movemask_epi8( over ) ) {
+         Pred_lt_3or6_40( exc, T0, frac, flag3 );
+         return;
+      }
+      _mm_storeu_si128( ( __m128i * )&e[n], _mm_packs_epi32( lo, hi ) );
+   }
+}
+#endif
+
+
 /*
  * Dec_lag6
  *
@@ -2324,7 +3318,7 @@ static void Pred_lt_3or6_40( Word32 exc[], Word32 T0, Word32 frac, Word32 flag3
  *    void
  */
 static void Dec_lag6( Word32 index, Word32 pit_min, Word32 pit_max, Word32
-      i_subfr, Word32 *T0, Word32 *T0_frac )
+      i_subfr, Word32 * RESTRICT T0, Word32 * RESTRICT T0_frac )
 {
    Word32 t0_min, t0_max, i;
 
@@ -2389,7 +3383,7 @@ static void Dec_lag6( Word32 index, Word32 pit_min, Word32 pit_max, Word32
 static void decompress10( Word32 MSBs, Word32 LSBs, Word32 index1, Word32 index2
       , Word32 index3, Word32 pos_indx[] )
 {
-   Word32 divMSB;
+   const UWord8 *pos;
 
    if (MSBs > 124)
    {
@@ -2399,13 +3393,12 @@ static void decompress10( Word32 MSBs, Word32 LSBs, Word32 index1, Word32 index2
     * pos_indx[index1] = ((MSBs-25*(MSBs/25))%5)*2 + (LSBs-4*(LSBs/4))%2;
     * pos_indx[index2] = ((MSBs-25*(MSBs/25))/5)*2 + (LSBs-4*(LSBs/4))/2;
     * pos_indx[index3] = (MSBs/25)*2 + LSBs/4;
+    * with the divisions looked up in decompress10_pos
     */
-   divMSB = MSBs / 25;
-   pos_indx[index1] = ( ( ( MSBs - 25 * ( divMSB ) ) % 5 ) << 1 ) + ( LSBs & 0x1
-         );
-   pos_indx[index2] = ( ( ( MSBs - 25 * ( divMSB ) ) / 5 ) << 1 ) + ( ( LSBs &
-         0x2 ) >> 1 );
-   pos_indx[index3] = ( divMSB << 1 ) + ( LSBs >> 2 );
+   pos = decompress10_pos[MSBs];
+   pos_indx[index1] = pos[0] + ( LSBs & 0x1 );
+   pos_indx[index2] = pos[1] + ( ( LSBs & 0x2 ) >> 1 );
+   pos_indx[index3] = pos[2] + ( LSBs >> 2 );
    return;
 }
 
@@ -2432,7 +3425,7 @@ static void decompress10( Word32 MSBs, Word32 LSBs, Word32 index1, Word32 index2
  */
 static void decompress_codewords( Word16 indx[], Word32 pos_indx[] )
 {
-   Word32 ia, ib, MSBs, LSBs, MSBs0_24, tmp;
+   Word32 MSBs, LSBs;
 
 
     /*
@@ -2463,19 +3456,12 @@ static void decompress_codewords( Word16 indx[], Word32 pos_indx[] )
      * else
      *    pos_indx[3] = (MSBs0_24%5)*2 + LSBs%2;
      * pos_indx[7] = (MSBs0_24/5)*2 + LSBs/2;
+     * with all but LSBs looked up in decompress7_pos; index has 7 bits
      */
-   MSBs = indx[2] >> 2;
+   MSBs = ( indx[2] >> 2 ) & 0x1F;
    LSBs = indx[2] & 0x3;
-   MSBs0_24 = ( ( ( MSBs * 25 ) + 12 ) >> 5 );
-   tmp = ( MSBs0_24 * 6554 ) >> 15;
-   ia = tmp & 0x1;
-   ib = ( MSBs0_24 - ( tmp * 5 ) );
-
-   if ( ia == 1 ) {
-      ib = 4 - ib;
-   }
-   pos_indx[3] = ( ib << 1 ) + ( LSBs & 0x1 );
-   pos_indx[7] = ( tmp << 1 ) + ( LSBs >> 1 );
+   pos_indx[3] = decompress7_pos[MSBs][0] + ( LSBs & 0x1 );
+   pos_indx[7] = decompress7_pos[MSBs][1] + ( LSBs >> 1 );
 }
 
 
@@ -2493,13 +3479,13 @@ static void decompress_codewords( Word16 indx[], Word32 pos_indx[] )
  *    Algebraic codebook decoder
  *
  * Returns:
- *    void
+ *    position of the first pulse
  */
-static void decode_2i40_9bits( Word32 subNr, Word32 sign, Word32 index, Word32
+static Word32 decode_2i40_9bits( Word32 subNr, Word32 sign, Word32 index, Word32
       cod[] )
 {
    Word32 pos[2];
-   Word32 i, j, k;
+   Word32 i, j, k, first;
 
 
    /* Decode the positions */
@@ -2520,7 +3506,7 @@ static void decode_2i40_9bits( Word32 subNr, Word32 sign, Word32 index, Word32
    pos[1] = ( Word16 )( i + k );
 
    /* decode the signs  and build the codeword */
-   memset( cod, 0, L_SUBFR <<2 );
+   memset( cod, 0, L_SUBFR * sizeof( Word32 ) );
 
    for ( j = 0; j < 2; j++ ) {
       i = sign & 1;
@@ -2533,7 +3519,13 @@ static void decode_2i40_9bits( Word32 subNr, Word32 sign, Word32 index, Word32
          cod[pos[j]] = -8192;   /* -1.0 */
       }
    }
-   return;
+   first = pos[0];
+
+   for ( j = 1; j < 2; j++ ) {
+      if ( pos[j] < first )
+         first = pos[j];
+   }
+   return first;
 }
 
 
@@ -2550,12 +3542,12 @@ static void decode_2i40_9bits( Word32 subNr, Word32 sign, Word32 index, Word32
  *    Algebraic codebook decoder
  *
  * Returns:
- *    void
+ *    position of the first pulse
  */
-static void decode_2i40_11bits( Word32 sign, Word32 index, Word32 cod[] )
+static Word32 decode_2i40_11bits( Word32 sign, Word32 index, Word32 cod[] )
 {
    Word32 pos[2];
-   Word32 i, j;
+   Word32 i, j, first;
 
 
    /* Decode the positions */
@@ -2585,7 +3577,7 @@ static void decode_2i40_11bits( Word32 sign, Word32 index, Word32 cod[] )
    }
 
    /* decode the signs  and build the codeword */
-   memset( cod, 0, L_SUBFR <<2 );
+   memset( cod, 0, L_SUBFR * sizeof( Word32 ) );
 
    for ( j = 0; j < 2; j++ ) {
       i = sign & 1;
@@ -2598,7 +3590,13 @@ static void decode_2i40_11bits( Word32 sign, Word32 index, Word32 cod[] )
          cod[pos[j]] = -8192;   /* -1.0 */
       }
    }
-   return;
+   first = pos[0];
+
+   for ( j = 1; j < 2; j++ ) {
+      if ( pos[j] < first )
+         first = pos[j];
+   }
+   return first;
 }
 
 
@@ -2615,12 +3613,12 @@ static void decode_2i40_11bits( Word32 sign, Word32 index, Word32 cod[] )
  *    Algebraic codebook decoder
  *
  * Returns:
- *    void
+ *    position of the first pulse
  */
-static void decode_3i40_14bits( Word32 sign, Word32 index, Word32 cod[] )
+static Word32 decode_3i40_14bits( Word32 sign, Word32 index, Word32 cod[] )
 {
    Word32 pos[3];
-   Word32 i, j;
+   Word32 i, j, first;
 
 
    /* Decode the positions */
@@ -2650,7 +3648,7 @@ static void decode_3i40_14bits( Word32 sign, Word32 index, Word32 cod[] )
    pos[2] = i + j;
 
    /* decode the signs  and build the codeword */
-   memset( cod, 0, L_SUBFR <<2 );
+   memset( cod, 0, L_SUBFR * sizeof( Word32 ) );
 
    for ( j = 0; j < 3; j++ ) {
       i = sign & 1;
@@ -2663,7 +3661,13 @@ static void decode_3i40_14bits( Word32 sign, Word32 index, Word32 cod[] )
          cod[pos[j]] = -8192;   /* -1.0 */
       }
    }
-   return;
+   first = pos[0];
+
+   for ( j = 1; j < 3; j++ ) {
+      if ( pos[j] < first )
+         first = pos[j];
+   }
+   return first;
 }
 
 
@@ -2680,12 +3684,12 @@ static void decode_3i40_14bits( Word32 sign, Word32 index, Word32 cod[] )
  *    Algebraic codebook decoder
  *
  * Returns:
- *    void
+ *    position of the first pulse
  */
-static void decode_4i40_17bits( Word32 sign, Word32 index, Word32 cod[] )
+static Word32 decode_4i40_17bits( Word32 sign, Word32 index, Word32 cod[] )
 {
    Word32 pos[4];
-   Word32 i, j;
+   Word32 i, j, first;
 
 
    /* Decode the positions */
@@ -2720,7 +3724,7 @@ static void decode_4i40_17bits( Word32 sign, Word32 index, Word32 cod[] )
    pos[3] = i + j;
 
    /* decode the signs  and build the codeword */
-   memset( cod, 0, L_SUBFR <<2 );
+   memset( cod, 0, L_SUBFR * sizeof( Word32 ) );
 
    for ( j = 0; j < 4; j++ ) {
       i = sign & 1;
@@ -2733,7 +3737,13 @@ static void decode_4i40_17bits( Word32 sign, Word32 index, Word32 cod[] )
          cod[pos[j]] = -8192;
       }
    }
-   return;
+   first = pos[0];
+
+   for ( j = 1; j < 4; j++ ) {
+      if ( pos[j] < first )
+         first = pos[j];
+   }
+   return first;
 }
 
 
@@ -2749,17 +3759,19 @@ static void decode_4i40_17bits( Word32 sign, Word32 index, Word32 cod[] )
  *    Algebraic codebook decoder
  *
  * Returns:
- *    void
+ *    position of the first pulse
  */
-static void decode_8i40_31bits( Word16 index[], Word32 cod[] )
+static Word32 decode_8i40_31bits( Word16 index[], Word32 cod[] )
 {
    Word32 linear_codewords[8];
-   Word32 i, j, pos1, pos2, sign;
+   Word32 i, j, pos1, pos2, sign, first;
 
 
-   memset( cod, 0, L_CODE <<2 );
+   memset( cod, 0, L_CODE * sizeof( Word32 ) );
    decompress_codewords( &index[NB_TRACK_MR102], linear_codewords );
 
+   first = L_CODE;
+
    /* decode the positions and signs of pulses and build the codeword */
    for ( j = 0; j < NB_TRACK_MR102; j++ ) {
       /* compute index i */
@@ -2788,8 +3800,14 @@ static void decode_8i40_31bits( Word16 index[], Word32 cod[] )
          sign = -( sign );
       }
       cod[pos2] = cod[pos2] + sign;
+
+      if ( pos1 < first )
+         first = pos1;
+
+      if ( pos2 < first )
+         first = pos2;
    }
-   return;
+   return first;
 }
 
 
@@ -2805,14 +3823,16 @@ static void decode_8i40_31bits( Word16 index[], Word32 cod[] )
  *    Algebraic codebook decoder
  *
  * Returns:
- *    void
+ *    position of the first pulse
  */
-static void decode_10i40_35bits( Word16 index[], Word32 cod[] )
+static Word32 decode_10i40_35bits( Word16 index[], Word32 cod[] )
 {
-   Word32 i, j, pos1, pos2, sign, tmp;
+   Word32 i, j, pos1, pos2, sign, tmp, first;
 
 
-   memset( cod, 0, L_CODE <<2 );
+   memset( cod, 0, L_CODE * sizeof( Word32 ) );
+
+   first = L_CODE;
 
    /* decode the positions and signs of pulses and build the codeword */
    for ( j = 0; j < 5; j++ ) {
@@ -2846,11 +3866,21 @@ static void decode_10i40_35bits( Word16 index[], Word32 cod[] )
          sign = -( sign );
       }
       cod[pos2] = cod[pos2] + sign;
+
+      if ( pos1 < first )
+         first = pos1;
+
+      if ( pos2 < first )
+         first = pos2;
    }
-   return;
+   return first;
 }
 
 
+/* orders a and b, so that a <= b */
+#define GMED_SORT( a, b ) { if ( ( a ) > ( b ) ) { t = ( a ); ( a ) = ( b ); ( b ) = t; } }
+
+
 /*
  * gmed_n
  *
@@ -2862,19 +3892,60 @@ static void decode_10i40_35bits( Word16 index[], Word32 cod[] )
  * Function:
  *    Calculates N-point median.
  *
+ *    The 5 and 9 point medians, the only ones used, are found by
+ *    sorting networks of 7 and 19 compare-exchanges instead of
+ *    n passes of max-selection. The value returned is the same:
+ *    ties change which entry is taken, not its value. Histories
+ *    hold gains and energies, all above -32768, which the
+ *    selection uses as the mark of a taken entry.
+ *
  * Returns:
- *    index of the median value
+ *    median value
  */
-static Word32 gmed_n( Word32 ind[], Word32 n )
+static Word32 gmed_n( HistWord ind[], Word32 n )
 {
    Word32 tmp[NMAX], tmp2[NMAX];
-   Word32 max, medianIndex, i, j, ix = 0;
+   Word32 max, medianIndex, i, j, t, ix = 0;
 
 
    for ( i = 0; i < n; i++ ) {
       tmp2[i] = ind[i];
    }
 
+   if ( n == 5 ) {
+      GMED_SORT( tmp2[0], tmp2[1] );
+      GMED_SORT( tmp2[3], tmp2[4] );
+      GMED_SORT( tmp2[0], tmp2[3] );
+      GMED_SORT( tmp2[1], tmp2[4] );
+      GMED_SORT( tmp2[1], tmp2[2] );
+      GMED_SORT( tmp2[2], tmp2[3] );
+      GMED_SORT( tmp2[1], tmp2[2] );
+      return( tmp2[2] );
+   }
+
+   if ( n == 9 ) {
+      GMED_SORT( tmp2[1], tmp2[2] );
+      GMED_SORT( tmp2[4], tmp2[5] );
+      GMED_SORT( tmp2[7], tmp2[8] );
+      GMED_SORT( tmp2[0], tmp2[1] );
+      GMED_SORT( tmp2[3], tmp2[4] );
+      GMED_SORT( tmp2[6], tmp2[7] );
+      GMED_SORT( tmp2[1], tmp2[2] );
+      GMED_SORT( tmp2[4], tmp2[5] );
+      GMED_SORT( tmp2[7], tmp2[8] );
+      GMED_SORT( tmp2[0], tmp2[3] );
+      GMED_SORT( tmp2[5], tmp2[8] );
+      GMED_SORT( tmp2[4], tmp2[7] );
+      GMED_SORT( tmp2[3], tmp2[6] );
+      GMED_SORT( tmp2[1], tmp2[4] );
+      GMED_SORT( tmp2[2], tmp2[5] );
+      GMED_SORT( tmp2[4], tmp2[7] );
+      GMED_SORT( tmp2[4], tmp2[2] );
+      GMED_SORT( tmp2[6], tmp2[4] );
+      GMED_SORT( tmp2[4], tmp2[2] );
+      return( tmp2[4] );
+   }
+
    for ( i = 0; i < n; i++ ) {
       max = -32767;
 
@@ -2999,6 +4070,113 @@ static void ec_gain_pitch_update( ec_gain_pitchState *st, Word32 bfi,
 }
 
 
+/*
+ * code_energy
+ *
+ *
+ * Parameters:
+ *    code              I: innovative codebook vector
+ *
+ * Function:
+ *    Energy of the innovative codebook vector, sum(code[i]^2), wrapping
+ *    around in 32 bits like the sum it replaces
+ *
+ * Returns:
+ *    energy
+ */
+static Word32 code_energy( const Word32 code[] )
+{
+   Word32 ener_code = 0, i = 0;
+
+
+   while ( i < L_SUBFR ) {
+      ener_code += code[i] * code[i];
+      i++;
+   }
+   return ener_code;
+}
+
+
+#ifdef SP_DEC_SSE2
+/*
+ * code_energy_sse2
+ *
+ *
+ * Parameters:
+ *    code              I: innovative codebook vector
+ *
+ * Function:
+ *    Same as code_energy, eight samples at a time. Samples are packed
+ *    to 16 bits and squared and paired with pmaddwd; all sums wrap
+ *    around in 32 bits, so they end up as those of code_energy. If any
+ *    sample does not fit in 16 bits, code_energy sums instead.
+ *
+ * Returns:
+ *    energy
+ */
+static Word32 code_energy_sse2( const Word32 code[] )
+{
+   __m128i lo, hi, x, over, sum;
+   Word32 i;
+
+
+   over = _mm_setzero_si128( );
+   sum = _mm_setzero_si128( );
+
+   for ( i = 0; i < L_SUBFR; i += 8 ) {
+      lo = _mm_loadu_si128( ( const __m128i * )&code[i] );
+      hi = _mm_loadu_si128( ( const __m128i * )&code[i + 4] );
+      over = _mm_or_si128( over, _mm_cmpgt_epi32( lo, _mm_set1_epi32( 32767 ) ) );
+      over = _mm_or_si128( over, _mm_cmplt_epi32( lo, _mm_set1_epi32( -32768 ) ) );
+      over = _mm_or_si128( over, _mm_cmpgt_epi32( hi, _mm_set1_epi32( 32767 ) ) );
+      over = _mm_or_si128( over, _mm_cmplt_epi32( hi, _mm_set1_epi32( -32768 ) ) );
+      x = _mm_packs_epi32( lo, hi );
+      sum = _mm_add_epi32( sum, _mm_madd_epi16( x, x ) );
+   }
+
+   if ( _mm_movemask_epi8( over ) )
+      return code_energy( code );
+
+   sum = _mm_add_epi32( sum, _mm_shuffle_epi32( sum, _MM_SHUFFLE( 1, 0, 3, 2 ) ) );
+   sum = _mm_add_epi32( sum, _mm_shuffle_epi32( sum, _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+   return _mm_cvtsi128_si32( sum );
+}
+#endif
+
+
+#ifdef SP_DEC_NEON
+/*
+ * code_energy_neon
+ *
+ *
+ * Parameters:
+ *    code              I: innovative codebook vector
+ *
+ * Function:
+ *    Same as code_energy, four samples at a time. NEON multiplies and
+ *    adds 32-bit lanes wrapping around, so the sum is that of
+ *    code_energy whatever the samples.
+ *
+ * Returns:
+ *    energy
+ */
+static Word32 code_energy_neon( const Word32 code[] )
+{
+   int32x4_t x, sum;
+   Word32 i;
+
+
+   sum = vdupq_n_s32( 0 );
+
+   for ( i = 0; i < L_SUBFR; i += 4 ) {
+      x = vld1q_s32( &code[i] );
+      sum = vmlaq_s32( sum, x, x );
+   }
+   return vaddvq_s32( sum );
+}
+#endif
+
+
 /*
  * gc_pred (366)
  *
@@ -3046,16 +4224,13 @@ static void ec_gain_pitch_update( ec_gain_pitchState *st, Word32 bfi,
 static void gc_pred( gc_predState *st, enum Mode mode, Word32 *code, Word32 *
       exp_gcode0, Word32 *frac_gcode0, Word32 *exp_en, Word32 *frac_en )
 {
-   Word32 exp, frac, ener_code = 0, i = 0;
+   Word32 exp, frac, ener_code;
 
 
     /* energy of code:
      * ener_code = sum(code[i]^2)
      */
-   while ( i < L_SUBFR ) {
-      ener_code += code[i] * code[i];
-      i++;
-   }
+   ener_code = KERNELS->code_energy( code );
 
    if ( ( 0x3fffffff <= ener_code ) | ( ener_code < 0 ) )
       ener_code = MAX_32;
@@ -3086,13 +4261,10 @@ static void gc_pred( gc_predState *st, enum Mode mode, Word32 *code, Word32 *
           *           = MEAN_ENER + sum(pred[i]*past_qua_en[i])
           * constant = 20*Log10(2)
           */
-      ener = 0;
-      i = 0;
-
-      while ( i < 4 ) {
-         ener += st->past_qua_en_MR122[i] * pred_MR122[i];
-         i++;
-      }
+      ener = st->past_qua_en_MR122[0] * pred_MR122[0] +
+            st->past_qua_en_MR122[1] * pred_MR122[1] +
+            st->past_qua_en_MR122[2] * pred_MR122[2] +
+            st->past_qua_en_MR122[3] * pred_MR122[3];
       ener <<= 1;
       ener += MEAN_ENER_MR122;
 
@@ -3117,14 +4289,8 @@ static void gc_pred( gc_predState *st, enum Mode mode, Word32 *code, Word32 *
         /*
          * Compute: meansEner - 10log10(ener_code/ LSufr)
          */
-      exp_code=0;
-      if (ener_code != 0){
-         while (!(ener_code & 0x40000000))
-         {
-            exp_code++;
-            ener_code = ener_code << 1;
-         }
-      }
+      exp_code = Norm_bit( ener_code, 30 );
+      ener_code = ener_code << exp_code;
 
       /* Log2 = log2 + 27 */
       Log2_norm( ener_code, exp_code, &exp, &frac );
@@ -3195,12 +4361,8 @@ static void gc_pred( gc_predState *st, enum Mode mode, Word32 *code, Word32 *
       tmp = tmp << 9;   /* Q23 */
 
       /* Q13 * Q10 -> Q23 */
-      i = 0;
-
-      while ( i < 4 ) {
-         tmp += pred[i] * st->past_qua_en[i];
-         i++;
-      }
+      tmp += pred[0] * st->past_qua_en[0] + pred[1] * st->past_qua_en[1] +
+            pred[2] * st->past_qua_en[2] + pred[3] * st->past_qua_en[3];
       gcode0 = tmp >> 15;   /* Q8  */
 
         /*
@@ -3247,13 +4409,9 @@ static void gc_pred( gc_predState *st, enum Mode mode, Word32 *code, Word32 *
 static void gc_pred_update( gc_predState *st, Word32 qua_ener_MR122,
       Word32 qua_ener )
 {
-   Word32 i;
-
-
-   for ( i = 3; i > 0; i-- ) {
-      st->past_qua_en[i] = st->past_qua_en[i - 1];
-      st->past_qua_en_MR122[i] = st->past_qua_en_MR122[i - 1];
-   }
+   memmove( &st->past_qua_en[1], &st->past_qua_en[0], 3 * sizeof( Word32 ) );
+   memmove( &st->past_qua_en_MR122[1], &st->past_qua_en_MR122[0], 3 * sizeof(
+         Word32 ) );
    st->past_qua_en_MR122[0] = qua_ener_MR122;   /* log2 (quaErr), Q10 */
    st->past_qua_en[0] = qua_ener;   /* 20*log10(quaErr), Q10 */
 }
@@ -3283,7 +4441,7 @@ static void Dec_gain( gc_predState *pred_state, enum Mode mode, Word32 index,
       Word32 code[], Word32 evenSubfr, Word32 *gain_pit, Word32 *gain_cod )
 {
    Word32 frac, gcode0, exp, qua_ener, qua_ener_MR122, g_code, tmp;
-   const Word32 *p;
+   const Word16 *p;
 
 
    /* Read the quantized gains (table depends on mode) */
@@ -3531,8 +4689,9 @@ static void d_gain_code( gc_predState *pred_state, enum Mode mode, Word32 index,
                         Word32 code[], Word32 *gain_code )
 {
    Word32 g_code0, exp, frac, qua_ener_MR122, qua_ener;
-   Word32 exp_inn_en, frac_inn_en, tmp, tmp2, i;
-   const Word32 *p;
+   Word32 exp_inn_en, frac_inn_en, tmp, i;
+   Word64 wide;
+   const Word16 *p;
 
 
    /*
@@ -3564,16 +4723,23 @@ static void d_gain_code( gc_predState *pred_state, enum Mode mode, Word32 index,
          tmp = tmp >> exp;
       }
       else {
-         for (i = exp; i < 0; i++) {
-            tmp2 = tmp << 1;
-            if ((tmp ^ tmp2) & 0x80000000) {
-               tmp = (tmp & 0x80000000) ? 0x80000000 : 0x7FFFFFFF;
-               break;
-            }
-            else {
-               tmp = tmp2;
-            }
-         }
+         /*
+          * shift left saturating to 32 bits; doubling one bit at a time
+          * saturates exactly when whole shift does not fit, and no
+          * shift of nonzero value by 32 does
+          */
+         i = -exp;
+
+         if ( i > 32 )
+            i = 32;
+         wide = ( Word64 )tmp * ( ( Word64 )1 << i );
+
+         if ( wide > 2147483647 )
+            tmp = 2147483647;
+         else if ( wide < -2147483647 - 1 )
+            tmp = -2147483647 - 1;
+         else
+            tmp = ( Word32 )wide;
       }
       *gain_code = tmp >> 16;
       if (*gain_code & 0xFFFF8000)
@@ -3614,8 +4780,8 @@ static void d_gain_code( gc_predState *pred_state, enum Mode mode, Word32 index,
  * Returns:
  *    void
  */
-static void Int_lsf( Word32 lsf_old[], Word32 lsf_new[], int i_subfr, Word32
-      lsf_out[] )
+static void Int_lsf( const Word32 * RESTRICT lsf_old, const Word32 * RESTRICT
+      lsf_new, int i_subfr, Word32 * RESTRICT lsf_out )
 {
    Word32 i;
 
@@ -3641,7 +4807,7 @@ static void Int_lsf( Word32 lsf_old[], Word32 lsf_new[], int i_subfr, Word32
          break;
 
       case 120:
-         memcpy( lsf_out, lsf_new, M <<2 );
+         memcpy( lsf_out, lsf_new, M * sizeof( Word32 ) );
          break;
    }
 }
@@ -3698,24 +4864,12 @@ static Word32 Cb_gain_average( Cb_gain_averageState *st, enum Mode mode, Word32
 
    /* compute lsp difference */
    for ( i = 0; i < M; i++ ) {
-      tmp1 = labs( lspAver[i]- lsp[i] );
-      shift1 = 0;
-      if (tmp1 != 0){
-         while (!(tmp1 & 0x2000))
-         {
-            shift1++;
-            tmp1 = tmp1 << 1;
-         }
-      }
+      tmp1 = abs( lspAver[i]- lsp[i] );
+      shift1 = Norm_bit( tmp1, 13 );
+      tmp1 = tmp1 << shift1;
       tmp2 = lspAver[i];
-      shift2 = 0;
-      if (tmp2 != 0){
-         while (!(tmp2 & 0x4000))
-         {
-            shift2++;
-            tmp2 = tmp2 << 1;
-         }
-      }
+      shift2 = Norm_bit( tmp2, 14 );
+      tmp2 = tmp2 << shift2;
       tmp[i] = ( tmp1 << 15 ) / tmp2;
       shift = 2 + shift1 - shift2;
 
@@ -3828,6 +4982,136 @@ static Word32 Cb_gain_average( Cb_gain_averageState *st, enum Mode mode, Word32
 }
 
 
+/*
+ * ph_disp_conv
+ *
+ *
+ * Parameters:
+ *    inno              B: Innovation vector
+ *    ph_imp            I: phase dispersion filter
+ *
+ * Function:
+ *    Circular convolution of the innovation with impulse response of
+ *    phase dispersion filter, pulse by pulse, for ph_disp
+ *
+ * Returns:
+ *    void
+ */
+static void ph_disp_conv( Word32 inno[], const Word32 ph_imp[] )
+{
+   Word32 inno_sav[L_SUBFR], ps_poss[L_SUBFR];
+   Word32 i, j, temp1, nze, nPulse, ppos;
+
+
+   /*
+    * track pulse positions, save innovation,
+    * and initialize new innovation
+    */
+   nze = 0;
+
+   for ( i = 0; i < L_SUBFR; i++ ) {
+      if ( inno[i] != 0 ) {
+         ps_poss[nze] = i;
+         nze++;
+      }
+   }
+   memcpy( inno_sav, inno, L_SUBFR * sizeof( Word32 ) );
+   memset( inno, 0, L_SUBFR * sizeof( Word32 ) );
+
+   for ( nPulse = 0; nPulse < nze; nPulse++ ) {
+      ppos = ps_poss[nPulse];
+
+      /* circular convolution with impulse response */
+      j = 0;
+
+      for ( i = ppos; i < L_SUBFR; i++ ) {
+         /* inno[i1] += inno_sav[ppos] * ph_imp[i1-ppos] */
+         temp1 = ( inno_sav[ppos] * ph_imp[j++] ) >> 15;
+         inno[i] = inno[i] + temp1;
+      }
+
+      for ( i = 0; i < ppos; i++ ) {
+         /* inno[i] += inno_sav[ppos] * ph_imp[L_SUBFR-ppos+i] */
+         temp1 = ( inno_sav[ppos] * ph_imp[j++] ) >> 15;
+         inno[i] = inno[i] + temp1;
+      }
+   }
+}
+
+
+#ifdef SP_DEC_SSE2
+/*
+ * ph_disp_conv_sse2
+ *
+ *
+ * Parameters:
+ *    inno              B: Innovation vector
+ *    ph_imp            I: phase dispersion filter
+ *
+ * Function:
+ *    Same as ph_disp_conv, eight samples at a time. Impulse response
+ *    is packed to 16 bits twice in a row, so response to a pulse at
+ *    ppos, wrapped around, is the 40 values from L_SUBFR - ppos on,
+ *    and innovation is the sum of those scaled by the pulses, which
+ *    are few. Products of 16-bit pulses and response are exactly those
+ *    of ph_disp_conv; if any pulse does not fit in 16 bits,
+ *    ph_disp_conv convolves instead.
+ *
+ * Returns:
+ *    void
+ */
+static void ph_disp_conv_sse2( Word32 inno[], const Word32 ph_imp[] )
+{
+   short imp[2 * L_SUBFR];
+   Word32 ps_poss[L_SUBFR], ps_amp[L_SUBFR];
+   __m128i acc[L_SUBFR / 4], a, d, l, h;
+   Word32 i, k, nze;
+
+
+   nze = 0;
+
+   for ( i = 0; i < L_SUBFR; i++ ) {
+      if ( inno[i] != 0 ) {
+         if ( inno[i] < -32768 || inno[i] > 32767 ) {
+            ph_disp_conv( inno, ph_imp );
+            return;
+         }
+         ps_poss[nze] = i;
+         ps_amp[nze] = inno[i];
+         nze++;
+      }
+   }
+
+   /* filters are Q15 values */
+   for ( i = 0; i < L_SUBFR; i++ ) {
+      imp[i] = imp[i + L_SUBFR] = ( short )ph_imp[i];
+   }
+
+   for ( k = 0; k < L_SUBFR / 4; k++ ) {
+      acc[k] = _mm_setzero_si128( );
+   }
+
+   for ( i = 0; i < nze; i++ ) {
+      a = _mm_set1_epi16( ( short )ps_amp[i] );
+
+      for ( k = 0; k < L_SUBFR; k += 8 ) {
+         d = _mm_loadu_si128( ( __m128i * )&imp[L_SUBFR - ps_poss[i] + k] );
+         l = _mm_mullo_epi16( d, a );
+         h = _mm_mulhi_epi16( d, a );
+         acc[k >> 2] = _mm_add_epi32( acc[k >> 2], _mm_srai_epi32(
+               _mm_unpacklo_epi16( l, h ), 15 ) );
+         acc[( k >> 2 ) + 1] = _mm_add_epi32( acc[( k >> 2 ) + 1],
+               _mm_srai_epi32( _mm_unpackhi_epi16( l, h ), 15 ) );
+      }
+   }
+
+   for ( k = 0; k < L_SUBFR / 4; k++ ) {
+      _mm_storeu_si128( ( __m128i * )&inno[k * 4], acc[k] );
+   }
+}
+#endif
+
+
 /*
  * ph_disp
  *
@@ -3855,8 +5139,7 @@ static void ph_disp( ph_dispState *state, enum Mode mode, Word32 x[],
                     Word32 cbGain, Word32 ltpGain, Word32 inno[],
                     Word32 pitch_fac, Word32 tmp_shift)
 {
-   Word32 inno_sav[L_SUBFR], ps_poss[L_SUBFR];
-   Word32 i, i1, impNr, temp1, temp2, j, nze, nPulse, ppos;
+   Word32 i, i1, impNr, temp1, temp2;
    const Word32 *ph_imp;   /* Pointer to phase dispersion filter */
 
 
@@ -3944,21 +5227,6 @@ static void ph_disp( ph_dispState *state, enum Mode mode, Word32 x[],
     */
    if ( ( mode != MR122 ) & ( mode != MR102 ) & ( mode != MR74 ) & ( impNr < 2 )
       ) {
-      /*
-       * track pulse positions, save innovation,
-       * and initialize new innovation
-       */
-      nze = 0;
-
-      for ( i = 0; i < L_SUBFR; i++ ) {
-         if ( inno[i] != 0 ) {
-            ps_poss[nze] = i;
-            nze++;
-         }
-      }
-      memcpy( inno_sav, inno, L_SUBFR <<2 );
-      memset( inno, 0, L_SUBFR <<2 );
-
       /* Choose filter corresponding to codec mode and dispersion criterium */
       ph_imp = ph_imp_mid;
 
@@ -3975,24 +5243,7 @@ static void ph_disp( ph_dispState *state, enum Mode mode, Word32 x[],
       }
 
       /* Do phase dispersion of innovation */
-      for ( nPulse = 0; nPulse < nze; nPulse++ ) {
-         ppos = ps_poss[nPulse];
-
-         /* circular convolution with impulse response */
-         j = 0;
-
-         for ( i = ppos; i < L_SUBFR; i++ ) {
-            /* inno[i1] += inno_sav[ppos] * ph_imp[i1-ppos] */
-            temp1 = ( inno_sav[ppos] * ph_imp[j++] ) >> 15;
-            inno[i] = inno[i] + temp1;
-         }
-
-         for ( i = 0; i < ppos; i++ ) {
-            /* inno[i] += inno_sav[ppos] * ph_imp[L_SUBFR-ppos+i] */
-            temp1 = ( inno_sav[ppos] * ph_imp[j++] ) >> 15;
-            inno[i] = inno[i] + temp1;
-         }
-      }
+      KERNELS->ph_disp_conv( inno, ph_imp );
    }
 
    /*
@@ -4004,7 +5255,7 @@ static void ph_disp( ph_dispState *state, enum Mode mode, Word32 x[],
       temp1 = x[i] * pitch_fac + inno[i] * cbGain;
       temp2 = temp1 << tmp_shift;
       x[i] = ( temp2 + 0x4000 ) >> 15;
-      if (labs(x[i]) > 32767)
+      if (abs(x[i]) > 32767)
       {
          if ((temp1 ^ temp2) & 0x80000000) {
             x[i] = (temp1 & 0x80000000) ? -32768: 32767;
@@ -4052,15 +5303,7 @@ static Word32 sqrt_l_exp( Word32 x, Word32 *exp )
       *exp = 0;
       return( Word32 )0;
    }
-   e=0;
-   if (x != 0){
-      tmp = x;
-      while (!(tmp & 0x40000000))
-      {
-         e++;
-         tmp = tmp << 1;
-      }
-   }
+   e = Norm_bit( x, 30 );
    e = e & 0xFFFE;
    x = ( x << e );
    *exp = ( Word16 )e;
@@ -4094,7 +5337,7 @@ static Word32 sqrt_l_exp( Word32 x, Word32 *exp )
  * Returns:
  *    background noise decision; 0 = no bgn, 1 = bgn
  */
-static Word16 Ex_ctrl( Word32 excitation[], Word32 excEnergy, Word32
+static Word16 Ex_ctrl( Word32 excitation[], Word32 excEnergy, HistWord
       exEnergyHist[], Word32 voicedHangover, Word16 prevBFI, Word16 carefulFlag
       )
 {
@@ -4125,14 +5368,8 @@ static Word16 Ex_ctrl( Word32 excitation[], Word32 excEnergy, Word32
       }
 
       /* scaleFactor=avgEnergy/excEnergy in Q0 */
-      exp=0;
-      if (excEnergy != 0){
-         while (!(excEnergy & 0x4000))
-         {
-            exp++;
-            excEnergy = excEnergy << 1;
-         }
-      }
+      exp = Norm_bit( excEnergy, 14 );
+      excEnergy = excEnergy << exp;
       excEnergy = 536838144 / excEnergy;
       T0 = ( avgEnergy * excEnergy ) << 1;
       T0 = ( T0 >> ( 20 - exp ) );
@@ -4180,12 +5417,8 @@ static Word32 Inv_sqrt( Word32 x )
 
    if ( x <= ( Word32 )0 )
       return( ( Word32 )0x3fffffffL );
-   exp=0;
-   while (!(x & 0x40000000))
-   {
-      exp++;
-      x = x << 1;
-   }
+   exp = Norm_bit( x, 30 );
+   x = x << exp;
 
    /* x is normalized */
    exp = ( 30 - exp );
@@ -4306,6 +5539,125 @@ static Word32 energy_new( Word32 in[] )
 }
 
 
+#ifdef SP_DEC_SSE2
+/*
+ * energy_sse2
+ *
+ *
+ * Parameters:
+ *    in                I: input value
+ *
+ * Function:
+ *    Same as energy_new, eight samples at a time. Samples are packed
+ *    to 16 bits and squared and paired with pmaddwd, and the sums of
+ *    both energy_new and energy_old are taken at once. With samples of
+ *    at most 32767 in magnitude, energy_new can't wrap around before
+ *    it checks for overflow, and its partial sums only grow, so it
+ *    overflows exactly when the whole sum is 2^30 or more. If any
+ *    sample does not fit, energy_new computes the energy instead.
+ *
+ * Returns:
+ *    Energy
+ */
+static Word32 energy_sse2( Word32 in[] )
+{
+   __m128i x, lo, hi, over, sum, sum_old;
+   unsigned long long total[2];
+   unsigned int old[4];
+   Word32 i;
+
+
+   over = _mm_setzero_si128( );
+   sum = _mm_setzero_si128( );
+   sum_old = _mm_setzero_si128( );
+
+   for ( i = 0; i < L_SUBFR; i += 8 ) {
+      lo = _mm_loadu_si128( ( __m128i * )&in[i] );
+      hi = _mm_loadu_si128( ( __m128i * )&in[i + 4] );
+      over = _mm_or_si128( over, _mm_cmpgt_epi32( lo, _mm_set1_epi32( 32767 ) ) );
+      over = _mm_or_si128( over, _mm_cmplt_epi32( lo, _mm_set1_epi32( -32767 ) ) );
+      over = _mm_or_si128( over, _mm_cmpgt_epi32( hi, _mm_set1_epi32( 32767 ) ) );
+      over = _mm_or_si128( over, _mm_cmplt_epi32( hi, _mm_set1_epi32( -32767 ) ) );
+      x = _mm_packs_epi32( lo, hi );
+
+      /* pairs of squares are below 2^31, their sums are kept in 64 bits */
+      lo = _mm_madd_epi16( x, x );
+      sum = _mm_add_epi64( sum, _mm_unpacklo_epi32( lo, _mm_setzero_si128( ) ) );
+      sum = _mm_add_epi64( sum, _mm_unpackhi_epi32( lo, _mm_setzero_si128( ) ) );
+
+      /* (in >> 2)^2 summed over all samples stays below 2^32 */
+      x = _mm_srai_epi16( x, 2 );
+      sum_old = _mm_add_epi32( sum_old, _mm_madd_epi16( x, x ) );
+   }
+
+   if ( _mm_movemask_epi8( over ) )
+      return energy_new( in );
+
+   _mm_storeu_si128( ( __m128i * )total, sum );
+
+   if ( total[0] + total[1] < 0x40000000 )
+      return( Word32 )( ( total[0] + total[1] ) >> 3 );
+
+   /* energy_old */
+   _mm_storeu_si128( ( __m128i * )old, sum_old );
+   old[0] += old[1] + old[2] + old[3];
+
+   if ( old[0] & 0xC0000000 ) {
+      return 0x7FFFFFFF;
+   }
+   return( Word32 )( old[0] << 1 );
+}
+#endif
+
+
+#ifdef SP_DEC_NEON
+/*
+ * energy_neon
+ *
+ *
+ * Parameters:
+ *    in                I: input value
+ *
+ * Function:
+ *    Same as energy_new, four samples at a time, squares summed in
+ *    64 bits. As with energy_sse2, energy_new overflows exactly when
+ *    the whole sum is 2^30 or more if samples are at most 32767 in
+ *    magnitude; then energy_old computes the energy. If any sample
+ *    does not fit, energy_new does.
+ *
+ * Returns:
+ *    Energy
+ */
+static Word32 energy_neon( Word32 in[] )
+{
+   int32x4_t x;
+   uint32x4_t over;
+   int64x2_t sum;
+   Word64 total;
+   Word32 i;
+
+
+   over = vdupq_n_u32( 0 );
+   sum = vdupq_n_s64( 0 );
+
+   for ( i = 0; i < L_SUBFR; i += 4 ) {
+      x = vld1q_s32( &in[i] );
+      over = vorrq_u32( over, vcgtq_s32( vqabsq_s32( x ), vdupq_n_s32( 32767 ) ) );
+      sum = vmlal_s32( sum, vget_low_s32( x ), vget_low_s32( x ) );
+      sum = vmlal_high_s32( sum, x, x );
+   }
+
+   if ( vmaxvq_u32( over ) )
+      return energy_new( in );
+   total = vaddvq_s64( sum );
+
+   if ( total < 0x40000000 )
+      return( Word32 )( total >> 3 );
+   return energy_old( in );
+}
+#endif
+
+
 /*
  * agc2
  *
@@ -4328,33 +5680,25 @@ static void agc2( Word32 *sig_in, Word32 *sig_out )
 
 
    /* calculate gain_out with exponent */
-   s = energy_new( sig_out );
+   s = KERNELS->energy( sig_out );
 
    if ( s == 0 ) {
       return;
    }
-   exp=0;
-   while (!(s & 0x20000000))
-   {
-      exp++;
-      s = s << 1;
-   }
+   exp = Norm_bit( s, 29 );
+   s = s << exp;
 
    gain_out = ( Word16 )( ( s + 0x00008000L ) >> 16 );
 
    /* calculate gain_in with exponent */
-   s = energy_new( sig_in );
+   s = KERNELS->energy( sig_in );
 
    if ( s == 0 ) {
       g0 = 0;
    }
    else {
-      i = 0;
-      while (!(s & 0x40000000))
-      {
-         i++;
-         s = s << 1;
-      }
+      i = Norm_bit( s, 30 );
+      s = s << i;
 
       if ( s < 0x7fff7fff )
          gain_in = ( Word16 )( ( s + 0x00008000L ) >> 16 );
@@ -4378,1746 +5722,4753 @@ static void agc2( Word32 *sig_in, Word32 *sig_out )
    }
 
    /* sig_out(n) = gain(n) * sig_out(n) */
-   for ( i = 0; i < L_SUBFR; i++ ) {
-      sig_out[i] = ( sig_out[i] * g0 ) >> 12;
-   }
+   KERNELS->agc2_scale( sig_out, g0 );
    return;
 }
 
 
 /*
- * Bgn_scd
+ * agc2_scale
  *
  *
  * Parameters:
- *    st->frameEnergyHist  B: Frame Energy memory
- *    st->bgHangover       B: Background hangover counter
- *    ltpGainHist          I: LTP gain history
- *    speech               I: synthesis speech frame
- *    voicedHangover       O: number of frames after last voiced frame
+ *    sig               B: signal
+ *    g0                I: gain
  *
  * Function:
- *    Charaterice synthesis speech and detect background noise
+ *    Scales the subframe by gain, for agc2
  *
  * Returns:
- *    inbgNoise         background noise decision; 0 = no bgn, 1 = bgn
+ *    void
  */
-static Word16 Bgn_scd( Bgn_scdState *st, Word32 ltpGainHist[], Word32 speech[],
-      Word32 *voicedHangover )
+static void agc2_scale( Word32 sig[], Word32 g0 )
 {
-   Word32 temp, ltpLimit, frame_energyMin, currEnergy, noiseFloor, maxEnergy,
-         maxEnergyLastPart, s, i;
-   Word16 prevVoiced, inbgNoise;
-
+   Word32 i;
 
-   /*
-    * Update the inBackgroundNoise flag (valid for use in next frame if BFI)
-    * it now works as a energy detector floating on top
-    * not as good as a VAD.
-    */
-   s = 0;
 
-   for ( i = 0; i < L_FRAME; i++ ) {
-      s += speech[i] * speech[i];
+   for ( i = 0; i < L_SUBFR; i++ ) {
+      sig[i] = ( sig[i] * g0 ) >> 12;
    }
+}
 
-   if ( (s < 0xFFFFFFF) & (s >= 0) )
-      currEnergy = s >> 13;
-   else
-      currEnergy = 32767;
-   frame_energyMin = 32767;
 
-   for ( i = 0; i < L_ENERGYHIST; i++ ) {
-      if ( st->frameEnergyHist[i] < frame_energyMin )
-         frame_energyMin = st->frameEnergyHist[i];
-   }
+/*
+ * agc_scale
+ *
+ *
+ * Parameters:
+ *    sig               B: signal
+ *    gain              I: gain of every sample
+ *
+ * Function:
+ *    Scales the subframe sample by sample, for agc, and saturates it
+ *    to 16 bits
+ *
+ * Returns:
+ *    void
+ */
+static void agc_scale( Word32 sig[], const Word32 gain[] )
+{
+   Word32 i;
 
-   /* Frame Energy Margin of 16 */
-   noiseFloor = frame_energyMin << 4;
-   maxEnergy = st->frameEnergyHist[0];
 
-   for ( i = 1; i < L_ENERGYHIST - 4; i++ ) {
-      if ( maxEnergy < st->frameEnergyHist[i] ) {
-         maxEnergy = st->frameEnergyHist[i];
-      }
+   for ( i = 0; i < L_SUBFR; i++ ) {
+      sig[i] = Sat16( ( sig[i] * gain[i] ) >> 12 );
    }
-   maxEnergyLastPart = st->frameEnergyHist[2 * L_ENERGYHIST / 3];
+}
 
-   for ( i = 2 * L_ENERGYHIST / 3 + 1; i < L_ENERGYHIST; i++ ) {
-      if ( maxEnergyLastPart < st->frameEnergyHist[i] ) {
-         maxEnergyLastPart = st->frameEnergyHist[i];
-      }
-   }
 
-   /* false */
-   inbgNoise = 0;
+#ifdef SP_DEC_SSE2
+/*
+ * mul16_sse2
+ *
+ *
+ * Parameters:
+ *    x                 I: eight 16-bit values
+ *    g                 I: eight 16-bit gains
+ *    lo                O: products of the first four, shifted right by 12
+ *    hi                O: products of the last four, shifted right by 12
+ *
+ * Function:
+ *    Full 32-bit products of 16-bit values, from their low and high
+ *    halves, as SSE2 has no 32-bit multiply
+ *
+ * Returns:
+ *    void
+ */
+static FORCE_INLINE void mul16_sse2( __m128i x, __m128i g, __m128i *lo,
+      __m128i *hi )
+{
+   __m128i l = _mm_mullo_epi16( x, g ), h = _mm_mulhi_epi16( x, g );
 
-   /*
-    * Do not consider silence as noise
-    * Do not consider continuous high volume as noise
-    * Or if the current noise level is very low
-    * Mark as noise if under current noise limit
-    * OR if the maximum energy is below the upper limit
-    */
-   if ( ( maxEnergy> LOWERNOISELIMIT )&( currEnergy<FRAMEENERGYLIMIT )&(
-         currEnergy>LOWERNOISELIMIT ) & ( ( currEnergy < noiseFloor ) || (
-         maxEnergyLastPart < UPPERNOISELIMIT ) ) ) {
-      if ( ( st->bgHangover + 1 ) > 30 ) {
-         st->bgHangover = 30;
-      }
-      else {
-         st->bgHangover += 1;
-      }
-   }
-   else {
-      st->bgHangover = 0;
-   }
 
-   /* make final decision about frame state, act somewhat cautiosly */
-   if ( st->bgHangover > 1 )
-      inbgNoise = 1;   /* true  */
+   *lo = _mm_srai_epi32( _mm_unpacklo_epi16( l, h ), 12 );
+   *hi = _mm_srai_epi32( _mm_unpackhi_epi16( l, h ), 12 );
+}
 
-   for ( i = 0; i < L_ENERGYHIST - 1; i++ ) {
-      st->frameEnergyHist[i] = st->frameEnergyHist[i + 1];
-   }
-   st->frameEnergyHist[L_ENERGYHIST - 1] = currEnergy;
 
-   /*
-    * prepare for voicing decision;
-    * tighten the threshold after some time in noise
-    */
-   ltpLimit = 13926;   /* 0.85  Q14 */
+/*
+ * over16_sse2
+ *
+ *
+ * Parameters:
+ *    v                 I: four 32-bit values
+ *
+ * Function:
+ *    Lanes of values that don't fit in 16 bits
+ *
+ * Returns:
+ *    mask, all ones in such lanes
+ */
+static FORCE_INLINE __m128i over16_sse2( __m128i v )
+{
+   return _mm_or_si128( _mm_cmpgt_epi32( v, _mm_set1_epi32( 32767 ) ),
+         _mm_cmplt_epi32( v, _mm_set1_epi32( -32768 ) ) );
+}
 
-   if ( st->bgHangover > 8 ) {
-      ltpLimit = 15565;   /* 0.95  Q14 */
-   }
 
-   if ( st->bgHangover > 15 ) {
-      ltpLimit = 16383;   /* 1.00  Q14 */
-   }
+/*
+ * agc2_scale_sse2
+ *
+ *
+ * Parameters:
+ *    sig               B: signal
+ *    g0                I: gain
+ *
+ * Function:
+ *    Same as agc2_scale, eight samples at a time. Samples and gain are
+ *    multiplied in 16 bits, with 32-bit products exactly as those of
+ *    agc2_scale; if any sample or the gain does not fit in 16 bits,
+ *    agc2_scale scales the subframe instead.
+ *
+ * Returns:
+ *    void
+ */
+static void agc2_scale_sse2( Word32 sig[], Word32 g0 )
+{
+   __m128i x[5], g, lo, hi, over;
+   Word32 i;
 
-   /* weak sort of voicing indication. */
-   prevVoiced = 0;   /* false */
 
-   if ( gmed_n( &ltpGainHist[4], 5 ) > ltpLimit ) {
-      prevVoiced = 1;   /* true  */
+   if ( g0 < -32768 || g0 > 32767 ) {
+      agc2_scale( sig, g0 );
+      return;
    }
+   over = _mm_setzero_si128( );
 
-   if ( st->bgHangover > 20 ) {
-      if ( gmed_n( ltpGainHist, 9 ) > ltpLimit ) {
-         prevVoiced = 1;   /* true  */
-      }
-      else {
-         prevVoiced = 0;   /* false  */
-      }
+   for ( i = 0; i < L_SUBFR; i += 8 ) {
+      lo = _mm_loadu_si128( ( __m128i * )&sig[i] );
+      hi = _mm_loadu_si128( ( __m128i * )&sig[i + 4] );
+      over = _mm_or_si128( over, _mm_or_si128( over16_sse2( lo ), over16_sse2( hi ) ) );
+      x[i >> 3] = _mm_packs_epi32( lo, hi );
    }
 
-   if ( prevVoiced ) {
-      *voicedHangover = 0;
+   if ( _mm_movemask_epi8( over ) ) {
+      agc2_scale( sig, g0 );
+      return;
    }
-   else {
-      temp = *voicedHangover + 1;
+   g = _mm_set1_epi16( ( short )g0 );
 
-      if ( temp > 10 ) {
-         *voicedHangover = 10;
-      }
-      else {
-         *voicedHangover = temp;
-      }
+   for ( i = 0; i < L_SUBFR; i += 8 ) {
+      mul16_sse2( x[i >> 3], g, &lo, &hi );
+      _mm_storeu_si128( ( __m128i * )&sig[i], lo );
+      _mm_storeu_si128( ( __m128i * )&sig[i + 4], hi );
    }
-   return inbgNoise;
 }
 
 
 /*
- * dtx_dec_activity_update
+ * agc_scale_sse2
  *
  *
  * Parameters:
- *    st->lsf_hist_ptr  B: LSF history pointer
- *    st->lsf_hist      B: LSF history
- *    lsf               I: lsf
- *    frame             I: noise frame
+ *    sig               B: signal
+ *    gain              I: gain of every sample
  *
  * Function:
- *    Update lsp history and compute log energy.
+ *    Same as agc_scale, eight samples at a time. Products of 16-bit
+ *    samples and gains are below 2^30, so shifted they are below 2^27,
+ *    where the sign test of agc_scale is the sign, and packing with
+ *    signed saturation saturates them alike. If any sample or gain does
+ *    not fit in 16 bits, agc_scale scales the subframe instead.
  *
  * Returns:
  *    void
  */
-static void dtx_dec_activity_update( dtx_decState *st, Word32 lsf[], Word32
-      frame[] )
+static void agc_scale_sse2( Word32 sig[], const Word32 gain[] )
 {
-   Word32 frame_en;
-   Word32 log_en_e, log_en_m, log_en, i;
+   __m128i x[5], g[5], lo, hi, over;
+   Word32 i;
 
 
-   /* update lsp history */
-   st->lsf_hist_ptr += M;
+   over = _mm_setzero_si128( );
 
-   if ( st->lsf_hist_ptr == 80 ) {
-      st->lsf_hist_ptr = 0;
+   for ( i = 0; i < L_SUBFR; i += 8 ) {
+      lo = _mm_loadu_si128( ( __m128i * )&sig[i] );
+      hi = _mm_loadu_si128( ( __m128i * )&sig[i + 4] );
+      over = _mm_or_si128( over, _mm_or_si128( over16_sse2( lo ), over16_sse2( hi ) ) );
+      x[i >> 3] = _mm_packs_epi32( lo, hi );
+      lo = _mm_loadu_si128( ( __m128i * )&gain[i] );
+      hi = _mm_loadu_si128( ( __m128i * )&gain[i + 4] );
+      over = _mm_or_si128( over, _mm_or_si128( over16_sse2( lo ), over16_sse2( hi ) ) );
+      g[i >> 3] = _mm_packs_epi32( lo, hi );
+   }
+
+   if ( _mm_movemask_epi8( over ) ) {
+      agc_scale( sig, gain );
+      return;
    }
-   memcpy( &st->lsf_hist[st->lsf_hist_ptr], lsf, M <<2 );
 
-   /* compute log energy based on frame energy */
-   frame_en = 0;   /* Q0 */
-
-   for ( i = 0; (i < L_FRAME); i ++ ) {
-      frame_en += frame[i] * frame[i];
-      if (frame_en & 0x80000000)
-         break;
+   for ( i = 0; i < L_SUBFR; i += 8 ) {
+      mul16_sse2( x[i >> 3], g[i >> 3], &lo, &hi );
+      /* saturate to 16 bits and sign extend back */
+      lo = _mm_packs_epi32( lo, hi );
+      hi = _mm_srai_epi32( _mm_unpackhi_epi16( lo, lo ), 16 );
+      lo = _mm_srai_epi32( _mm_unpacklo_epi16( lo, lo ), 16 );
+      _mm_storeu_si128( ( __m128i * )&sig[i], lo );
+      _mm_storeu_si128( ( __m128i * )&sig[i + 4], hi );
    }
+}
+#endif
 
-   log_en = (frame_en & 0xC0000000) ? 0x7FFFFFFE: (Word32)frame_en << 1;
 
-   Log2( log_en , &log_en_e, &log_en_m );
+#ifdef SP_DEC_NEON
+/*
+ * agc2_scale_neon
+ *
+ *
+ * Parameters:
+ *    sig               B: signal
+ *    g0                I: gain
+ *
+ * Function:
+ *    Same as agc2_scale, four samples at a time. NEON has a 32-bit
+ *    multiply, wrapping around as the one of agc2_scale, so samples
+ *    and gain of any size are scaled alike.
+ *
+ * Returns:
+ *    void
+ */
+static void agc2_scale_neon( Word32 sig[], Word32 g0 )
+{
+   Word32 i;
 
-   /* convert exponent and mantissa to Word16 Q10 */
-   log_en = log_en_e << 10;   /* Q10 */
-   log_en = log_en + ( log_en_m >> 5 );
 
-   /* divide with L_FRAME i.e subtract with log2(L_FRAME) = 7.32193 */
-   log_en = log_en - 8521;
+   for ( i = 0; i < L_SUBFR; i += 4 ) {
+      vst1q_s32( &sig[i], vshrq_n_s32( vmulq_n_s32( vld1q_s32( &sig[i] ), g0 ),
+            12 ) );
+   }
+}
 
-   /*
-    * insert into log energy buffer, no division by two as
-    * log_en in decoder is Q11
-    */
-   st->log_en_hist_ptr += 1;
 
-   if ( st->log_en_hist_ptr == DTX_HIST_SIZE ) {
-      st->log_en_hist_ptr = 0;
+/*
+ * agc_scale_neon
+ *
+ *
+ * Parameters:
+ *    sig               B: signal
+ *    gain              I: gain of every sample
+ *
+ * Function:
+ *    Same as agc_scale, four samples at a time. Products wrap around
+ *    in 32 bits as those of agc_scale, and narrowing with signed
+ *    saturation saturates them as Sat16 does.
+ *
+ * Returns:
+ *    void
+ */
+static void agc_scale_neon( Word32 sig[], const Word32 gain[] )
+{
+   int32x4_t x;
+   Word32 i;
+
+
+   for ( i = 0; i < L_SUBFR; i += 4 ) {
+      x = vmulq_s32( vld1q_s32( &sig[i] ), vld1q_s32( &gain[i] ) );
+      x = vmovl_s16( vqmovn_s32( vshrq_n_s32( x, 12 ) ) );
+      vst1q_s32( &sig[i], x );
    }
-   st->log_en_hist[st->log_en_hist_ptr] = log_en;   /* Q11 */
 }
+#endif
 
 
 /*
- * Decoder_amr
+ * Bgn_stats
  *
  *
  * Parameters:
- *    st                B: State variables
- *    mode              I: AMR mode
- *    parm              I: vector of synthesis parameters
- *    frame_type        I: received frame type
- *    synth             O: synthesis speech
- *    A_t               O: decoded LP filter in 4 subframes
+ *    speech            I: synthesis speech frame
+ *    hist              I: frame energy history, oldest first
+ *    stats             O: smallest energy of the history, largest of all
+ *                         but the last four, largest of the last third
  *
  * Function:
- *    Speech decoder routine
+ *    Energy of the frame and the extremes of the energy history that
+ *    Bgn_scd decides on. History entries are between 0 and 32767.
  *
  * Returns:
- *    void
+ *    frame energy, sum(speech[i]^2) wrapping around in 32 bits
  */
-static void Decoder_amr( Decoder_amrState *st, enum Mode mode, Word16 parm[],
-      enum RXFrameType frame_type, Word32 synth[], Word32 A_t[] )
+static Word32 Bgn_stats( const Word32 speech[], const HistWord hist[],
+      Word32 stats[] )
 {
-   /* LSPs */
-   Word32 lsp_new[M];
-   Word32 lsp_mid[M];
+   Word32 s, frame_energyMin, maxEnergy, maxEnergyLastPart, i;
 
 
-   /* LSFs */
-   Word32 prev_lsf[M];
-   Word32 lsf_i[M];
+   s = 0;
 
+   for ( i = 0; i < L_FRAME; i++ ) {
+      s += speech[i] * speech[i];
+   }
+   frame_energyMin = 32767;
 
-   /* Algebraic codevector */
-   Word32 code[L_SUBFR];
+   for ( i = 0; i < L_ENERGYHIST; i++ ) {
+      if ( hist[i] < frame_energyMin )
+         frame_energyMin = hist[i];
+   }
+   maxEnergy = hist[0];
 
+   for ( i = 1; i < L_ENERGYHIST - 4; i++ ) {
+      if ( maxEnergy < hist[i] ) {
+         maxEnergy = hist[i];
+      }
+   }
+   maxEnergyLastPart = hist[2 * L_ENERGYHIST / 3];
 
-   /* excitation */
-   Word32 excp[L_SUBFR];
-   Word32 exc_enhanced[L_SUBFR];
+   for ( i = 2 * L_ENERGYHIST / 3 + 1; i < L_ENERGYHIST; i++ ) {
+      if ( maxEnergyLastPart < hist[i] ) {
+         maxEnergyLastPart = hist[i];
+      }
+   }
+   stats[0] = frame_energyMin;
+   stats[1] = maxEnergy;
+   stats[2] = maxEnergyLastPart;
+   return s;
+}
 
 
-   /* Scalars */
-   Word32 i, i_subfr, overflow, T0_frac, index, temp, temp2, subfrNr, excEnergy;
-   Word32 gain_code, gain_code_mix, pit_sharp, pit_flag, pitch_fac, t0_min, t0_max;
-   Word32 gain_pit = 0, evenSubfr = 0, T0 = 0, index_mr475 = 0;
-   Word32 *Az;   /* Pointer on A_t */
-   Word16 flag4, carefulFlag;
-   Word16 delta_frc_low, delta_frc_range, tmp_shift;
-   Word16 bfi = 0, pdfi = 0;
-   /* bad frame indication flag, potential degraded bad frame flag */
+#ifdef SP_DEC_SSE2
+/*
+ * Hist_load_sse2
+ *
+ *
+ * Parameters:
+ *    hist              I: eight history entries
+ *
+ * Function:
+ *    History entries as 16-bit lanes; they fit, packing keeps them
+ *
+ * Returns:
+ *    vector of the entries
+ */
+static FORCE_INLINE __m128i Hist_load_sse2( const HistWord hist[] )
+{
+#ifdef SP_DEC_STATE16
+   return _mm_loadu_si128( ( const __m128i * )hist );
+#else
+   return _mm_packs_epi32( _mm_loadu_si128( ( const __m128i * )hist ),
+         _mm_loadu_si128( ( const __m128i * )&hist[4] ) );
+#endif
+}
 
 
-   enum DTXStateType newDTXState;   /* SPEECH , DTX, DTX_MUTE */
+/*
+ * Bgn_stats_sse2
+ *
+ *
+ * Parameters:
+ *    speech            I: synthesis speech frame
+ *    hist              I: frame energy history, oldest first
+ *    stats             O: see Bgn_stats
+ *
+ * Function:
+ *    Same as Bgn_stats in one pass over each. Energy is summed as in
+ *    code_energy_sse2, wrapping around the same way; if any sample does
+ *    not fit in 16 bits, Bgn_stats computes everything instead. History
+ *    is taken eight entries at a time: the first seven vectors are the
+ *    entries all but the last four, the last two of them and the
+ *    vector of the last eight entries make up the last third.
+ *
+ * Returns:
+ *    frame energy, sum(speech[i]^2) wrapping around in 32 bits
+ */
+static Word32 Bgn_stats_sse2( const Word32 speech[], const HistWord hist[],
+      Word32 stats[] )
+{
+   __m128i lo, hi, x, over, sum, lo_min, hi_max, last_max;
+   Word32 i;
 
-   /* find the new  DTX state  SPEECH OR DTX */
-   newDTXState = rx_dtx_handler( st->dtxDecoderState, frame_type );
 
-   /* DTX actions */
-   if ( newDTXState != SPEECH ) {
-      Decoder_amr_reset( st, MRDTX );
-      dtx_dec( st->dtxDecoderState, st->mem_syn, st->lsfState, st->pred_state,
-            st->Cb_gain_averState, newDTXState, mode, parm, synth, A_t );
+   over = _mm_setzero_si128( );
+   sum = _mm_setzero_si128( );
+
+   for ( i = 0; i < L_FRAME; i += 8 ) {
+      lo = _mm_loadu_si128( ( const __m128i * )&speech[i] );
+      hi = _mm_loadu_si128( ( const __m128i * )&speech[i + 4] );
+      over = _mm_or_si128( over, _mm_cmpgt_epi32( lo, _mm_set1_epi32( 32767 ) ) );
+      over = _mm_or_si128( over, _mm_cmplt_epi32( lo, _mm_set1_epi32( -32768 ) ) );
+      over = _mm_or_si128( over, _mm_cmpgt_epi32( hi, _mm_set1_epi32( 32767 ) ) );
+      over = _mm_or_si128( over, _mm_cmplt_epi32( hi, _mm_set1_epi32( -32768 ) ) );
+      x = _mm_packs_epi32( lo, hi );
+      sum = _mm_add_epi32( sum, _mm_madd_epi16( x, x ) );
+   }
+
+   if ( _mm_movemask_epi8( over ) )
+      return Bgn_stats( speech, hist, stats );
+
+   sum = _mm_add_epi32( sum, _mm_shuffle_epi32( sum, _MM_SHUFFLE( 1, 0, 3, 2 ) ) );
+   sum = _mm_add_epi32( sum, _mm_shuffle_epi32( sum, _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+
+   /* entries 0 to 39 */
+   lo_min = hi_max = Hist_load_sse2( hist );
+
+   for ( i = 8; i < 2 * L_ENERGYHIST / 3; i += 8 ) {
+      x = Hist_load_sse2( &hist[i] );
+      lo_min = _mm_min_epi16( lo_min, x );
+      hi_max = _mm_max_epi16( hi_max, x );
+   }
+
+   /* entries 40 to 55 */
+   last_max = Hist_load_sse2( &hist[2 * L_ENERGYHIST / 3] );
+   lo_min = _mm_min_epi16( lo_min, last_max );
+
+   for ( i = 2 * L_ENERGYHIST / 3 + 8; i < L_ENERGYHIST - 4; i += 8 ) {
+      x = Hist_load_sse2( &hist[i] );
+      lo_min = _mm_min_epi16( lo_min, x );
+      last_max = _mm_max_epi16( last_max, x );
+   }
+   hi_max = _mm_max_epi16( hi_max, last_max );
+
+   /* last eight, of which 52 to 55 are in already */
+   x = Hist_load_sse2( &hist[L_ENERGYHIST - 8] );
+   last_max = _mm_max_epi16( last_max, x );
+   lo_min = _mm_min_epi16( lo_min, x );
+
+   lo_min = _mm_min_epi16( lo_min, _mm_shuffle_epi32( lo_min, _MM_SHUFFLE( 1, 0, 3, 2 ) ) );
+   lo_min = _mm_min_epi16( lo_min, _mm_shuffle_epi32( lo_min, _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+   lo_min = _mm_min_epi16( lo_min, _mm_shufflelo_epi16( lo_min, _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+   hi_max = _mm_max_epi16( hi_max, _mm_shuffle_epi32( hi_max, _MM_SHUFFLE( 1, 0, 3, 2 ) ) );
+   hi_max = _mm_max_epi16( hi_max, _mm_shuffle_epi32( hi_max, _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+   hi_max = _mm_max_epi16( hi_max, _mm_shufflelo_epi16( hi_max, _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+   last_max = _mm_max_epi16( last_max, _mm_shuffle_epi32( last_max, _MM_SHUFFLE( 1, 0, 3, 2 ) ) );
+   last_max = _mm_max_epi16( last_max, _mm_shuffle_epi32( last_max, _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+   last_max = _mm_max_epi16( last_max, _mm_shufflelo_epi16( last_max, _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+   stats[0] = ( Word16 )_mm_cvtsi128_si32( lo_min );
+   stats[1] = ( Word16 )_mm_cvtsi128_si32( hi_max );
+   stats[2] = ( Word16 )_mm_cvtsi128_si32( last_max );
+   return _mm_cvtsi128_si32( sum );
+}
+#endif
 
-      /* update average lsp */
-      Lsf_lsp( st->lsfState->past_lsf_q, st->lsp_old );
-      lsp_avg( st->lsp_avg_st, st->lsfState->past_lsf_q );
-      goto theEnd;
-   }
 
-   /* SPEECH action state machine  */
-   if ( table_speech_bad[frame_type] ) {
-      bfi = 1;
+#ifdef SP_DEC_NEON
+/*
+ * Hist_load_neon
+ *
+ *
+ * Parameters:
+ *    hist              I: eight history entries
+ *
+ * Function:
+ *    History entries as 16-bit lanes; they fit, narrowing keeps them
+ *
+ * Returns:
+ *    vector of the entries
+ */
+static FORCE_INLINE int16x8_t Hist_load_neon( const HistWord hist[] )
+{
+#ifdef SP_DEC_STATE16
+   return vld1q_s16( hist );
+#else
+   return vcombine_s16( vmovn_s32( vld1q_s32( hist ) ), vmovn_s32( vld1q_s32(
+         &hist[4] ) ) );
+#endif
+}
 
-      if ( frame_type != RX_SPEECH_BAD ) {
-         Build_CN_param( &st->nodataSeed, mode, parm );
-      }
-   }
-   else if ( frame_type == RX_SPEECH_DEGRADED ) {
-      pdfi = 1;
-   }
 
-   if ( bfi != 0 ) {
-      st->state += 1;
-   }
-   else if ( st->state == 6 ) {
-      st->state = 5;
-   }
-   else {
-      st->state = 0;
-   }
+/*
+ * Bgn_stats_neon
+ *
+ *
+ * Parameters:
+ *    speech            I: synthesis speech frame
+ *    hist              I: frame energy history, oldest first
+ *    stats             O: see Bgn_stats
+ *
+ * Function:
+ *    Same as Bgn_stats in one pass over each. Energy is summed as in
+ *    code_energy_neon, whatever the samples. History is taken eight
+ *    entries at a time, as in Bgn_stats_sse2.
+ *
+ * Returns:
+ *    frame energy, sum(speech[i]^2) wrapping around in 32 bits
+ */
+static Word32 Bgn_stats_neon( const Word32 speech[], const HistWord hist[],
+      Word32 stats[] )
+{
+   int32x4_t x, sum;
+   int16x8_t h, lo_min, hi_max, last_max;
+   Word32 i;
 
-   if ( st->state > 6 ) {
-      st->state = 6;
+
+   sum = vdupq_n_s32( 0 );
+
+   for ( i = 0; i < L_FRAME; i += 4 ) {
+      x = vld1q_s32( &speech[i] );
+      sum = vmlaq_s32( sum, x, x );
    }
 
-    /*
-     * If this frame is the first speech frame after CNI period,
-     * set the BFH state machine to an appropriate state depending
-     * on whether there was DTX muting before start of speech or not
-     * If there was DTX muting, the first speech frame is muted.
-     * If there was no DTX muting, the first speech frame is not
-     * muted. The BFH state machine starts from state 5, however, to
-     * keep the audible noise resulting from a SID frame which is
-     * erroneously interpreted as a good speech frame as small as
-     * possible (the decoder output in this case is quickly muted)
-     */
-   if ( st->dtxDecoderState->dtxGlobalState == DTX ) {
-      st->state = 5;
-      st->prev_bf = 0;
+   /* entries 0 to 39 */
+   lo_min = hi_max = Hist_load_neon( hist );
+
+   for ( i = 8; i < 2 * L_ENERGYHIST / 3; i += 8 ) {
+      h = Hist_load_neon( &hist[i] );
+      lo_min = vminq_s16( lo_min, h );
+      hi_max = vmaxq_s16( hi_max, h );
    }
-   else if ( st->dtxDecoderState->dtxGlobalState == DTX_MUTE ) {
-      st->state = 5;
-      st->prev_bf = 1;
+
+   /* entries 40 to 55 */
+   last_max = Hist_load_neon( &hist[2 * L_ENERGYHIST / 3] );
+   lo_min = vminq_s16( lo_min, last_max );
+
+   for ( i = 2 * L_ENERGYHIST / 3 + 8; i < L_ENERGYHIST - 4; i += 8 ) {
+      h = Hist_load_neon( &hist[i] );
+      lo_min = vminq_s16( lo_min, h );
+      last_max = vmaxq_s16( last_max, h );
    }
+   hi_max = vmaxq_s16( hi_max, last_max );
 
-   /* save old LSFs for CB gain smoothing */
-   memcpy( prev_lsf, st->lsfState->past_lsf_q, M <<2 );
+   /* last eight, of which 52 to 55 are in already */
+   h = Hist_load_neon( &hist[L_ENERGYHIST - 8] );
+   last_max = vmaxq_s16( last_max, h );
+   lo_min = vminq_s16( lo_min, h );
 
-    /*
-     * decode LSF parameters and generate interpolated lpc coefficients
-     * for the 4 subframes
-     */
-   if ( mode != MR122 ) {
-      D_plsf_3( st->lsfState, mode, bfi, parm, lsp_new );
+   stats[0] = vminvq_s16( lo_min );
+   stats[1] = vmaxvq_s16( hi_max );
+   stats[2] = vmaxvq_s16( last_max );
+   return vaddvq_s32( sum );
+}
+#endif
 
-      /* Advance synthesis parameters pointer */
-      parm += 3;
-      Int_lpc_1to3( st->lsp_old, lsp_new, A_t );
-   }
-   else {
-      D_plsf_5( st->lsfState, bfi, parm, lsp_mid, lsp_new );
 
-      /* Advance synthesis parameters pointer */
-      parm += 5;
-      Int_lpc_1and3( st->lsp_old, lsp_mid, lsp_new, A_t );
-   }
+/*
+ * Bgn_scd
+ *
+ *
+ * Parameters:
+ *    st->frameEnergyHist  B: Frame Energy memory
+ *    st->energyOldest     B: oldest entry of Frame Energy memory
+ *    st->bgHangover       B: Background hangover counter
+ *    ltpGainHist          I: LTP gain history
+ *    speech               I: synthesis speech frame
+ *    voicedHangover       O: number of frames after last voiced frame
+ *
+ * Function:
+ *    Charaterice synthesis speech and detect background noise
+ *
+ * Returns:
+ *    inbgNoise         background noise decision; 0 = no bgn, 1 = bgn
+ */
+static Word16 Bgn_scd( Bgn_scdState *st, HistWord ltpGainHist[], Word32 speech[],
+      Word32 *voicedHangover )
+{
+   Word32 temp, ltpLimit, currEnergy, noiseFloor, maxEnergy, maxEnergyLastPart,
+         s, stats[3];
+   Word16 prevVoiced, inbgNoise;
 
-   /* update the LSPs for the next frame */
-   memcpy( st->lsp_old, lsp_new, M <<2 );
 
    /*
-    * Loop for every subframe in the analysis frame
-    *
-    * The subframe size is L_SUBFR and the loop is repeated
-    * L_FRAME/L_SUBFR times                                                                 *
-    *  - decode the pitch delay
-    *  - decode algebraic code
-    *  - decode pitch and codebook gains
-    *  - find the excitation and compute synthesis speech
+    * Update the inBackgroundNoise flag (valid for use in next frame if BFI)
+    * it now works as a energy detector floating on top
+    * not as good as a VAD.
     */
-   /* pointer to interpolated LPC parameters */
-   Az = A_t;
-   evenSubfr = 0;
-   subfrNr = -1;
-
-   for ( i_subfr = 0; i_subfr < L_FRAME; i_subfr += L_SUBFR ) {
-      subfrNr += 1;
-      evenSubfr = 1 - evenSubfr;
+   s = KERNELS->bgn_stats( speech, &st->frameEnergyHist[st->energyOldest],
+         stats );
 
-      /* flag for first and 3th subframe */
-      pit_flag = i_subfr;
+   if ( (s < 0xFFFFFFF) & (s >= 0) )
+      currEnergy = s >> 13;
+   else
+      currEnergy = 32767;
 
-      if ( i_subfr == L_FRAME_BY2 ) {
-         if ( ( mode != MR475 ) & ( mode != MR515 ) ) {
-            pit_flag = 0;
-         }
-      }
+   /* Frame Energy Margin of 16 */
+   noiseFloor = stats[0] << 4;
+   maxEnergy = stats[1];
+   maxEnergyLastPart = stats[2];
 
-      /* pitch index */
-      index = *parm++;
+   /* false */
+   inbgNoise = 0;
 
-       /*
-        * decode pitch lag and find adaptive codebook vector.
-        */
-      if ( mode != MR122 ) {
-          /*
-           * flag4 indicates encoding with 4 bit resolution;
-           * this is needed for mode MR475, MR515, MR59 and MR67
-           */
-         flag4 = 0;
+   /*
+    * Do not consider silence as noise
+    * Do not consider continuous high volume as noise
+    * Or if the current noise level is very low
+    * Mark as noise if under current noise limit
+    * OR if the maximum energy is below the upper limit
+    */
+   if ( ( maxEnergy> LOWERNOISELIMIT )&( currEnergy<FRAMEENERGYLIMIT )&(
+         currEnergy>LOWERNOISELIMIT ) & ( ( currEnergy < noiseFloor ) || (
+         maxEnergyLastPart < UPPERNOISELIMIT ) ) ) {
+      if ( ( st->bgHangover + 1 ) > 30 ) {
+         st->bgHangover = 30;
+      }
+      else {
+         st->bgHangover += 1;
+      }
+   }
+   else {
+      st->bgHangover = 0;
+   }
 
-         if ( ( mode == MR475 ) || ( mode == MR515 ) || ( mode == MR59 ) || (
-               mode == MR67 ) ) {
-            flag4 = 1;
-         }
+   /* make final decision about frame state, act somewhat cautiosly */
+   if ( st->bgHangover > 1 )
+      inbgNoise = 1;   /* true  */
 
-          /*
-           * get ranges for the t0_min and t0_max
-           * only needed in delta decoding
-           */
-         delta_frc_low = 5;
-         delta_frc_range = 9;
+   /* newest entry takes the place of the oldest, in both copies */
+   st->frameEnergyHist[st->energyOldest] = ( HistWord )currEnergy;
+   st->frameEnergyHist[st->energyOldest + L_ENERGYHIST] = ( HistWord )
+         currEnergy;
 
-         if ( mode == MR795 ) {
-            delta_frc_low = 10;
-            delta_frc_range = 19;
-         }
-         t0_min = st->old_T0 - delta_frc_low;
+   if ( ++st->energyOldest == L_ENERGYHIST )
+      st->energyOldest = 0;
 
-         if ( t0_min < PIT_MIN ) {
-            t0_min = PIT_MIN;
-         }
-         t0_max = t0_min + delta_frc_range;
+   /*
+    * prepare for voicing decision;
+    * tighten the threshold after some time in noise
+    */
+   ltpLimit = 13926;   /* 0.85  Q14 */
 
-         if ( t0_max > PIT_MAX ) {
-            t0_max = PIT_MAX;
-            t0_min = t0_max - delta_frc_range;
-         }
-         Dec_lag3( index, t0_min, t0_max, pit_flag, st->old_T0, &T0, &T0_frac,
-               flag4 );
-         st->T0_lagBuff = T0;
+   if ( st->bgHangover > 8 ) {
+      ltpLimit = 15565;   /* 0.95  Q14 */
+   }
 
-         if ( bfi != 0 ) {
-            if ( st->old_T0 < PIT_MAX ) {
-               /* Graceful pitch degradation */
-               st->old_T0 += 1;
-            }
-            T0 = st->old_T0;
-            T0_frac = 0;
+   if ( st->bgHangover > 15 ) {
+      ltpLimit = 16383;   /* 1.00  Q14 */
+   }
 
-            if ( ( st->inBackgroundNoise != 0 ) & ( st->voicedHangover > 4 ) & (
-                  ( mode == MR475 ) || ( mode == MR515 ) || ( mode == MR59 ) ) )
-            {
-               T0 = st->T0_lagBuff;
-            }
-         }
-         Pred_lt_3or6_40( st->exc, T0, T0_frac, 1 );
+   /* weak sort of voicing indication. */
+   prevVoiced = 0;   /* false */
+
+   if ( gmed_n( &ltpGainHist[4], 5 ) > ltpLimit ) {
+      prevVoiced = 1;   /* true  */
+   }
+
+   if ( st->bgHangover > 20 ) {
+      if ( gmed_n( ltpGainHist, 9 ) > ltpLimit ) {
+         prevVoiced = 1;   /* true  */
       }
       else {
-         Dec_lag6( index, PIT_MIN_MR122, PIT_MAX, pit_flag, &T0, &T0_frac );
-
-         if ( ( bfi != 0 ) || ( ( pit_flag != 0 ) & ( index > 60 ) ) ) {
-            st->T0_lagBuff = T0;
-            T0 = st->old_T0;
-            T0_frac = 0;
-         }
-         Pred_lt_3or6_40( st->exc, T0, T0_frac, 0 );
+         prevVoiced = 0;   /* false  */
       }
+   }
 
-       /*
-        * (MR122 only: Decode pitch gain.)
-        * Decode innovative codebook.
-        * set pitch sharpening factor
-        */
-      /* MR475, MR515 */
-      if ( ( mode == MR475 ) || ( mode == MR515 ) ) {
-         /* index of position */
-         index = *parm++;
+   if ( prevVoiced ) {
+      *voicedHangover = 0;
+   }
+   else {
+      temp = *voicedHangover + 1;
 
-         /* signs */
-         i = *parm++;
-         decode_2i40_9bits( subfrNr, i, index, code );
-         pit_sharp = st->sharp << 1;
+      if ( temp > 10 ) {
+         *voicedHangover = 10;
       }
-
-      /* MR59 */
-      else if ( mode == MR59 ) {
-         /* index of position */
-         index = *parm++;
-
-         /* signs */
-         i = *parm++;
-         decode_2i40_11bits( i, index, code );
-         pit_sharp = st->sharp << 1;
+      else {
+         *voicedHangover = temp;
       }
+   }
+   return inbgNoise;
+}
 
-      /* MR67 */
-      else if ( mode == MR67 ) {
-         /* index of position */
-         index = *parm++;
 
-         /* signs */
-         i = *parm++;
-         decode_3i40_14bits( i, index, code );
-         pit_sharp = st->sharp << 1;
-      }
+/*
+ * dtx_dec_activity_update
+ *
+ *
+ * Parameters:
+ *    st->lsf_hist_ptr  B: LSF history pointer
+ *    st->lsf_hist      B: LSF history
+ *    lsf               I: lsf
+ *    frame             I: noise frame
+ *
+ * Function:
+ *    Update lsp history and compute log energy.
+ *
+ * Returns:
+ *    void
+ */
+static void dtx_dec_activity_update( dtx_decState *st, Word32 lsf[], Word32
+      frame[] )
+{
+   Word32 frame_en;
+   Word32 log_en_e, log_en_m, log_en, i;
 
-      /* MR74, MR795 */
-      else if ( mode <= MR795 ) {
-         /* index of position */
-         index = *parm++;
 
-         /* signs */
-         i = *parm++;
-         decode_4i40_17bits( i, index, code );
-         pit_sharp = st->sharp << 1;
-      }
+   /* update lsp history */
+   st->lsf_hist_ptr += M;
 
-      /* MR102 */
-      else if ( mode == MR102 ) {
-         decode_8i40_31bits( parm, code );
-         parm += 7;
-         pit_sharp = st->sharp << 1;
-      }
+   if ( st->lsf_hist_ptr == 80 ) {
+      st->lsf_hist_ptr = 0;
+   }
+   for ( i = 0; i < M; i++ ) {
+      st->lsf_hist[st->lsf_hist_ptr + i] = lsf[i];
+   }
 
-      /* MR122 */
-      else {
-         index = *parm++;
+   /*
+    * compute log energy based on frame energy, which saturates once it
+    * reaches 2^30; squares of 16-bit samples are at most 2^30, so three
+    * of them can be added before checking without wrapping past that
+    */
+   frame_en = frame[0] * frame[0];   /* Q0 */
 
-         if ( bfi != 0 ) {
-            ec_gain_pitch( st->ec_gain_p_st, st->state, &gain_pit );
-         }
-         else {
-            gain_pit = d_gain_pitch( mode, index );
-         }
-         ec_gain_pitch_update( st->ec_gain_p_st, bfi, st->prev_bf, &gain_pit );
-         decode_10i40_35bits( parm, code );
-         parm += 10;
+   for ( i = 1; i < L_FRAME; i += 3 ) {
+      frame_en += frame[i] * frame[i];
+      frame_en += frame[i + 1] * frame[i + 1];
+      frame_en += frame[i + 2] * frame[i + 2];
+      if (frame_en & 0xC0000000)
+         break;
+   }
 
-           /*
-            * pit_sharp = gain_pit;
-            * if (pit_sharp > 1.0) pit_sharp = 1.0;
-            */
-         pit_sharp = gain_pit;
+   log_en = (frame_en & 0xC0000000) ? 0x7FFFFFFE: (Word32)frame_en << 1;
 
-         if ( pit_sharp > 16383 )
-            pit_sharp = 32767;
-         else
-            pit_sharp *= 2;
-      }
+   Log2( log_en , &log_en_e, &log_en_m );
 
-        /*
-         * Add the pitch contribution to code[].
-         */
-      for ( i = T0; i < L_SUBFR; i++ ) {
-         temp = ( code[i - T0] * pit_sharp ) >> 15;
-         code[i] = code[i] + temp;
-      }
+   /* convert exponent and mantissa to Word16 Q10 */
+   log_en = log_en_e << 10;   /* Q10 */
+   log_en = log_en + ( log_en_m >> 5 );
 
-        /*
-         * Decode codebook gain (MR122) or both pitch
-         * gain and codebook gain (all others)
-         * Update pitch sharpening "sharp" with quantized gain_pit
-         */
-      if ( mode == MR475 ) {
-         /* read and decode pitch and code gain */
-         if ( evenSubfr != 0 ) {
-            /* index of gain(s) */
-            index_mr475 = *parm++;
-         }
+   /* divide with L_FRAME i.e subtract with log2(L_FRAME) = 7.32193 */
+   log_en = log_en - 8521;
 
-         if ( bfi == 0 ) {
-            Dec_gain( st->pred_state, mode, index_mr475, code, evenSubfr, &
-                  gain_pit, &gain_code );
-         }
-         else {
-            ec_gain_pitch( st->ec_gain_p_st, st->state, &gain_pit );
-            ec_gain_code( st->ec_gain_c_st, st->pred_state, st->state, &
-                  gain_code );
-         }
-         ec_gain_pitch_update( st->ec_gain_p_st, bfi, st->prev_bf, &gain_pit );
-         ec_gain_code_update( st->ec_gain_c_st, bfi, st->prev_bf, &gain_code );
-         pit_sharp = gain_pit;
+   /*
+    * insert into log energy buffer, no division by two as
+    * log_en in decoder is Q11
+    */
+   st->log_en_hist_ptr += 1;
 
-         if ( pit_sharp > SHARPMAX ) {
-            pit_sharp = SHARPMAX;
-         }
-      }
-      else if ( ( mode <= MR74 ) || ( mode == MR102 ) ) {
-         /* read and decode pitch and code gain */
-         /* index of gain(s) */
-         index = *parm++;
+   if ( st->log_en_hist_ptr == DTX_HIST_SIZE ) {
+      st->log_en_hist_ptr = 0;
+   }
+   st->log_en_hist[st->log_en_hist_ptr] = log_en;   /* Q11 */
+}
 
-         if ( bfi == 0 ) {
-            Dec_gain( st->pred_state, mode, index, code, evenSubfr, &gain_pit, &
-                  gain_code );
-         }
-         else {
-            ec_gain_pitch( st->ec_gain_p_st, st->state, &gain_pit );
-            ec_gain_code( st->ec_gain_c_st, st->pred_state, st->state, &
-                  gain_code );
-         }
-         ec_gain_pitch_update( st->ec_gain_p_st, bfi, st->prev_bf, &gain_pit );
-         ec_gain_code_update( st->ec_gain_c_st, bfi, st->prev_bf, &gain_code );
-         pit_sharp = gain_pit;
 
-         if ( pit_sharp > SHARPMAX ) {
-            pit_sharp = SHARPMAX;
-         }
+/*
+ * Decoder_amr_mode
+ *
+ *
+ * Parameters:
+ *    st                B: State variables
+ *    mode              I: AMR mode
+ *    parm              I: vector of synthesis parameters
+ *    frame_type        I: received frame type
+ *    synth             O: synthesis speech
+ *    A_t               O: decoded LP filter in 4 subframes
+ *    w                 -: work buffers
+ *
+ * Function:
+ *    Speech decoder routine, expanded into the callers, see Decoder_amr
+ *
+ * Returns:
+ *    void
+ */
+static FORCE_INLINE void Decoder_amr_mode( Decoder_amrState *st, enum Mode
+      mode, Word16 parm[], enum RXFrameType frame_type, Word32 synth[], Word32
+      A_t[], Speech_Decode_FrameScratch *w )
+{
+   /* LSPs */
+   Word32 lsp_new[M];
+   Word32 lsp_mid[M];
 
-         if ( mode == MR102 ) {
-            if ( st->old_T0 > ( L_SUBFR + 5 ) ) {
-               pit_sharp = pit_sharp >> 2;
-            }
-         }
-      }
-      else {
-         /* read and decode pitch gain */
-         /* index of gain(s) */
-         index = *parm++;
 
-         if ( mode == MR795 ) {
-            /* decode pitch gain */
-            if ( bfi != 0 ) {
-               ec_gain_pitch( st->ec_gain_p_st, st->state, &gain_pit );
-            }
-            else {
-               gain_pit = d_gain_pitch( mode, index );
-            }
-            ec_gain_pitch_update( st->ec_gain_p_st, bfi, st->prev_bf, &gain_pit
-                  );
+   /* LSFs */
+   Word32 prev_lsf[M];
+   Word32 lsf_i[M];
 
-            /* read and decode code gain */
-            index = *parm++;
 
-            if ( bfi == 0 ) {
-               d_gain_code( st->pred_state, mode, index, code, &gain_code );
-            }
-            else {
-               ec_gain_code( st->ec_gain_c_st, st->pred_state, st->state, &
-                     gain_code );
-            }
-            ec_gain_code_update( st->ec_gain_c_st, bfi, st->prev_bf, &gain_code
-                  );
-            pit_sharp = gain_pit;
+   /* Algebraic codevector */
+   Word32 *code = w->code;
 
-            if ( pit_sharp > SHARPMAX ) {
-               pit_sharp = SHARPMAX;
-            }
-         }
-         else {   /* MR122 */
 
-            if ( bfi == 0 ) {
-               d_gain_code( st->pred_state, mode, index, code, &gain_code );
-            }
-            else {
-               ec_gain_code( st->ec_gain_c_st, st->pred_state, st->state, &
-                     gain_code );
-            }
-            ec_gain_code_update( st->ec_gain_c_st, bfi, st->prev_bf, &gain_code
-                  );
-            pit_sharp = gain_pit;
-         }
-      }
+   /* excitation */
+   Word32 *excp = w->excp;
+   Word32 *exc_enhanced = w->exc_enhanced;
 
-        /*
-         * store pitch sharpening for next subframe
-         * (for modes which use the previous pitch gain for
-         *  pitch sharpening in the search phase)
-         * do not update sharpening in even subframes for MR475
-         */
-      if ( ( mode != MR475 ) || evenSubfr == 0 ) {
-         st->sharp = gain_pit;
 
-         if ( st->sharp > SHARPMAX ) {
-            st->sharp = SHARPMAX;
-         }
-      }
+   /* Scalars */
+   Word32 i, i_subfr, overflow, T0_frac, index, temp, temp2, subfrNr, excEnergy;
+   Word32 gain_code, gain_code_mix, pit_sharp, pit_flag, pitch_fac, t0_min, t0_max;
+   Word32 gain_pit = 0, evenSubfr = 0, T0 = 0, index_mr475 = 0;
+   Word32 first;   /* position of the first pulse of code[] */
+   Word32 *Az;   /* Pointer on A_t */
+   Word16 flag4, carefulFlag;
+   Word16 delta_frc_low, delta_frc_range, tmp_shift;
+   Word16 bfi = 0, pdfi = 0;
+   /* bad frame indication flag, potential degraded bad frame flag */
 
-      if ( pit_sharp > 16383 )
-         pit_sharp = 32767;
-      else
-         pit_sharp *= 2;
 
-      if ( pit_sharp > 16384 ) {
-         for ( i = 0; i < L_SUBFR; i++ ) {
-            temp = ( st->exc[i] * pit_sharp ) >> 15;
-            temp2 = ( temp * gain_pit ) << 1;
+   enum DTXStateType newDTXState;   /* SPEECH , DTX, DTX_MUTE */
 
-            if ( mode == MR122 ) {
-               temp2 = ( temp2 >> 1 );
-            }
-            excp[i] = ( temp2 + 0x00008000L ) >> 16;
-         }
-      }
+   /* find the new  DTX state  SPEECH OR DTX */
+   newDTXState = rx_dtx_handler( st->dtxDecoderState, frame_type );
 
-        /*
-         * Store list of LTP gains needed in the source
-         * characteristic detector (SCD)
-         */
-      if ( bfi == 0 ) {
-         for (i = 0; i < 8; i++){
-            st->ltpGainHistory[i] = st->ltpGainHistory[i+1];
-         }
-         st->ltpGainHistory[8] = gain_pit;
-      }
+   /* DTX actions */
+   if ( newDTXState != SPEECH ) {
+      Decoder_amr_reset( st, MRDTX );
+      dtx_dec( st->dtxDecoderState, st->mem_syn, st->lsfState, st->pred_state,
+            st->Cb_gain_averState, newDTXState, mode, parm, synth, A_t, w );
 
+      /* update average lsp */
+      KERNELS->lsf_lsp( st->lsfState->past_lsf_q, st->lsp_old );
+      lsp_avg( st->lsp_avg_st, st->lsfState->past_lsf_q );
+      goto theEnd;
+   }
 
-        /*
-         * Limit gain_pit if in background noise and BFI
-         * for MR475, MR515, MR59
-         */
-      if ( ( st->prev_bf != 0 || bfi != 0 ) & ( st->inBackgroundNoise != 0 ) & (
-            ( mode == MR475 ) || ( mode == MR515 ) || ( mode == MR59 ) ) ) {
-         /* if (gain_pit > 0.75) in Q14*/
-         if ( gain_pit > 12288 )
-            /* gain_pit = (gain_pit-0.75)/2.0 + 0.75; */
-            gain_pit = ( ( gain_pit - 12288 ) >> 1 ) + 12288;
+   /* SPEECH action state machine  */
+   if ( table_speech_bad[frame_type] ) {
+      bfi = 1;
 
-         /* if (gain_pit > 0.90) in Q14*/
-         if ( gain_pit > 14745 ) {
-            gain_pit = 14745;
-         }
+      if ( frame_type != RX_SPEECH_BAD ) {
+         Build_CN_param( &st->nodataSeed, mode, parm );
       }
+   }
+   else if ( frame_type == RX_SPEECH_DEGRADED ) {
+      pdfi = 1;
+   }
 
-        /*
-         * Calculate CB mixed gain
-         */
-      Int_lsf( prev_lsf, st->lsfState->past_lsf_q, i_subfr, lsf_i );
-      gain_code_mix = Cb_gain_average( st->Cb_gain_averState, mode, gain_code,
-            lsf_i, st->lsp_avg_st->lsp_meanSave, bfi, st->prev_bf, pdfi, st->
-            prev_pdf, st->inBackgroundNoise, st->voicedHangover );
+   if ( bfi != 0 ) {
+      st->state += 1;
+   }
+   else if ( st->state == 6 ) {
+      st->state = 5;
+   }
+   else {
+      st->state = 0;
+   }
 
-      /* make sure that MR74, MR795, MR122 have original codeGain*/
-      /* MR74, MR795, MR122 */
-      if ( ( mode > MR67 ) & ( mode != MR102 ) ) {
-         gain_code_mix = gain_code;
-      }
+   if ( st->state > 6 ) {
+      st->state = 6;
+   }
 
-        /*
-         * Find the total excitation.
-         * Find synthesis speech corresponding to st->exc[].
-         */
-      /* MR475, MR515, MR59, MR67, MR74, MR795, MR102*/
-      if ( mode <= MR102 ) {
-         pitch_fac = gain_pit;
-         tmp_shift = 1;
-      }
+    /*
+     * If this frame is the first speech frame after CNI period,
+     * set the BFH state machine to an appropriate state depending
+     * on whether there was DTX muting before start of speech or not
+     * If there was DTX muting, the first speech frame is muted.
+     * If there was no DTX muting, the first speech frame is not
+     * muted. The BFH state machine starts from state 5, however, to
+     * keep the audible noise resulting from a SID frame which is
+     * erroneously interpreted as a good speech frame as small as
+     * possible (the decoder output in this case is quickly muted)
+     */
+   if ( st->dtxDecoderState->dtxGlobalState == DTX ) {
+      st->state = 5;
+      st->prev_bf = 0;
+   }
+   else if ( st->dtxDecoderState->dtxGlobalState == DTX_MUTE ) {
+      st->state = 5;
+      st->prev_bf = 1;
+   }
 
-      /* MR122 */
-      else {
-         pitch_fac = gain_pit >> 1;
-         tmp_shift = 2;
-      }
+   /* save old LSFs for CB gain smoothing */
+   memcpy( prev_lsf, st->lsfState->past_lsf_q, M * sizeof( Word32 ) );
 
-        /*
-         * copy unscaled LTP excitation to exc_enhanced (used in phase
-         * dispersion below) and compute total excitation for LTP feedback
-         */
-      memcpy( exc_enhanced, st->exc, L_SUBFR <<2 );
+    /*
+     * decode LSF parameters and generate interpolated lpc coefficients
+     * for the 4 subframes
+     */
+   if ( mode != MR122 ) {
+      D_plsf_3( st->lsfState, mode, bfi, parm, lsp_new );
 
-      for ( i = 0; i < L_SUBFR; i++ ) {
-         /* st->exc[i] = gain_pit*st->exc[i] + gain_code*code[i]; */
-         temp = ( st->exc[i] * pitch_fac ) + ( code[i] * gain_code );
-         temp2 = ( temp << tmp_shift );
-         if (((temp2 >> 1) ^ temp2) & 0x40000000) {
-            if ((temp ^ temp2) & 0x80000000) {
-               temp2 = (temp & 0x80000000) ? (-1073741824L) : 1073725439;
-            }
-            else {
-               temp2 = (temp2 & 0x80000000) ? (-1073741824L) : 1073725439;
-            }
-         }
-         st->exc[i] = ( temp2 + 0x00004000L ) >> 15;
-      }
-      /*
-       * Adaptive phase dispersion
-       */
+      /* Advance synthesis parameters pointer */
+      parm += 3;
+      Int_lpc_1to3( st->lsp_old, lsp_new, A_t );
+   }
+   else {
+      D_plsf_5( st->lsfState, bfi, parm, lsp_mid, lsp_new );
 
-      /* free phase dispersion adaption */
-      st->ph_disp_st->lockFull = 0;
+      /* Advance synthesis parameters pointer */
+      parm += 5;
+      Int_lpc_1and3( st->lsp_old, lsp_mid, lsp_new, A_t );
+   }
 
-      if ( ( ( mode == MR475 ) || ( mode == MR515 ) || ( mode == MR59 ) ) & ( st
-            ->voicedHangover > 3 ) & ( st->inBackgroundNoise != 0 ) & ( bfi != 0
-            ) ) {
-           /*
-            * Always Use full Phase Disp.
-            * if error in bg noise
-            */
-         st->ph_disp_st->lockFull = 1;
-      }
+   /* LSPs the frame is interpolated from, kept for its parameters */
+   memcpy( st->feat_lsp_old, st->lsp_old, M * sizeof( Word32 ) );
 
-        /*
-         * apply phase dispersion to innovation (if enabled) and
-         * compute total excitation for synthesis part
-         */
-      ph_disp( st->ph_disp_st, mode, exc_enhanced, gain_code_mix, gain_pit, code
-            , pitch_fac, tmp_shift );
+   if ( mode == MR122 )
+      memcpy( st->feat_lsp_mid, lsp_mid, M * sizeof( Word32 ) );
+   st->feat_mode = mode;
 
-        /*
-         * The Excitation control module are active during BFI.
-         * Conceal drops in signal energy if in bg noise.
-         */
-      temp2 = 0;
+   /* update the LSPs for the next frame */
+   memcpy( st->lsp_old, lsp_new, M * sizeof( Word32 ) );
 
-      for ( i = 0; i < L_SUBFR; i++ ) {
-         temp2 += ( exc_enhanced[i] * exc_enhanced[i] );
+   /*
+    * Loop for every subframe in the analysis frame
+    *
+    * The subframe size is L_SUBFR and the loop is repeated
+    * L_FRAME/L_SUBFR times                                                                 *
+    *  - decode the pitch delay
+    *  - decode algebraic code
+    *  - decode pitch and codebook gains
+    *  - find the excitation and compute synthesis speech
+    */
+   /* pointer to interpolated LPC parameters */
+   Az = A_t;
+   evenSubfr = 0;
+   subfrNr = -1;
+
+   for ( i_subfr = 0; i_subfr < L_FRAME; i_subfr += L_SUBFR ) {
+      subfrNr += 1;
+      evenSubfr = 1 - evenSubfr;
+
+      /* flag for first and 3th subframe */
+      pit_flag = i_subfr;
+
+      if ( i_subfr == L_FRAME_BY2 ) {
+         if ( ( mode != MR475 ) & ( mode != MR515 ) ) {
+            pit_flag = 0;
+         }
       }
 
-      if ( temp2 > 0x3FFFFFFF ) {
-         excEnergy = 11584;
+      /* pitch index */
+      index = *parm++;
+
+       /*
+        * decode pitch lag and find adaptive codebook vector.
+        */
+      if ( mode != MR122 ) {
+          /*
+           * flag4 indicates encoding with 4 bit resolution;
+           * this is needed for mode MR475, MR515, MR59 and MR67
+           */
+         flag4 = 0;
+
+         if ( ( mode == MR475 ) || ( mode == MR515 ) || ( mode == MR59 ) || (
+               mode == MR67 ) ) {
+            flag4 = 1;
+         }
+
+          /*
+           * get ranges for the t0_min and t0_max
+           * only needed in delta decoding
+           */
+         delta_frc_low = 5;
+         delta_frc_range = 9;
+
+         if ( mode == MR795 ) {
+            delta_frc_low = 10;
+            delta_frc_range = 19;
+         }
+         t0_min = st->old_T0 - delta_frc_low;
+
+         if ( t0_min < PIT_MIN ) {
+            t0_min = PIT_MIN;
+         }
+         t0_max = t0_min + delta_frc_range;
+
+         if ( t0_max > PIT_MAX ) {
+            t0_max = PIT_MAX;
+            t0_min = t0_max - delta_frc_range;
+         }
+         Dec_lag3( index, t0_min, t0_max, pit_flag, st->old_T0, &T0, &T0_frac,
+               flag4 );
+         st->T0_lagBuff = T0;
+
+         if ( bfi != 0 ) {
+            if ( st->old_T0 < PIT_MAX ) {
+               /* Graceful pitch degradation */
+               st->old_T0 += 1;
+            }
+            T0 = st->old_T0;
+            T0_frac = 0;
+
+            if ( ( st->inBackgroundNoise != 0 ) & ( st->voicedHangover > 4 ) & (
+                  ( mode == MR475 ) || ( mode == MR515 ) || ( mode == MR59 ) ) )
+            {
+               T0 = st->T0_lagBuff;
+            }
+         }
+         KERNELS->pred_lt_3or6_40( st->exc, T0, T0_frac, 1 );
       }
       else {
-         temp2 = sqrt_l_exp( temp2, &temp );
-         temp2 = ( temp2 >> ( ( temp >> 1 ) + 15 ) );
-         excEnergy = temp2 >> 2;
+         Dec_lag6( index, PIT_MIN_MR122, PIT_MAX, pit_flag, &T0, &T0_frac );
+
+         if ( ( bfi != 0 ) || ( ( pit_flag != 0 ) & ( index > 60 ) ) ) {
+            st->T0_lagBuff = T0;
+            T0 = st->old_T0;
+            T0_frac = 0;
+         }
+         KERNELS->pred_lt_3or6_40( st->exc, T0, T0_frac, 0 );
       }
 
-      if ( ( ( mode == MR475 ) || ( mode == MR515 ) || ( mode == MR59 ) ) & ( st
-            ->voicedHangover > 5 ) & ( st->inBackgroundNoise != 0 ) & ( st->
-            state < 4 ) & ( ( ( pdfi != 0 ) & ( st->prev_pdf != 0 ) ) || bfi !=
-            0 || st->prev_bf != 0 ) ) {
-         carefulFlag = 0;
+       /*
+        * (MR122 only: Decode pitch gain.)
+        * Decode innovative codebook.
+        * set pitch sharpening factor
+        */
+      /* MR475, MR515 */
+      if ( ( mode == MR475 ) || ( mode == MR515 ) ) {
+         /* index of position */
+         index = *parm++;
 
-         if ( ( pdfi != 0 ) & ( bfi == 0 ) ) {
-            carefulFlag = 1;
-         }
-         Ex_ctrl( exc_enhanced, excEnergy, st->excEnergyHist, st->voicedHangover
-               , st->prev_bf, carefulFlag );
+         /* signs */
+         i = *parm++;
+         first = decode_2i40_9bits( subfrNr, i, index, code );
+         pit_sharp = st->sharp << 1;
       }
 
-      if ( ( st->inBackgroundNoise != 0 ) & ( bfi != 0 || st->prev_bf != 0 ) & (
-            st->state < 4 ) ) {;   /* do nothing! */
+      /* MR59 */
+      else if ( mode == MR59 ) {
+         /* index of position */
+         index = *parm++;
+
+         /* signs */
+         i = *parm++;
+         first = decode_2i40_11bits( i, index, code );
+         pit_sharp = st->sharp << 1;
       }
-      else {
-         /* Update energy history for all modes */
-         for (i = 0; i < 8; i++){
-            st->excEnergyHist[i] = st->excEnergyHist[i+1];
-         }
-         st->excEnergyHist[8] = excEnergy;
+
+      /* MR67 */
+      else if ( mode == MR67 ) {
+         /* index of position */
+         index = *parm++;
+
+         /* signs */
+         i = *parm++;
+         first = decode_3i40_14bits( i, index, code );
+         pit_sharp = st->sharp << 1;
       }
 
-        /*
-         * Excitation control module end.
-         */
-      if ( pit_sharp > 16384 ) {
-         for ( i = 0; i < L_SUBFR; i++ ) {
-            excp[i] = excp[i] + exc_enhanced[i];
-            if (labs(excp[i]) > 32767)
-               excp[i] = (excp[i] & 0x80000000) ? -32768 : 32767;
-         }
-         agc2( exc_enhanced, excp );
-         overflow = Syn_filt( Az, excp, &synth[i_subfr], L_SUBFR, st->mem_syn, 0
-            );
+      /* MR74, MR795 */
+      else if ( mode <= MR795 ) {
+         /* index of position */
+         index = *parm++;
+
+         /* signs */
+         i = *parm++;
+         first = decode_4i40_17bits( i, index, code );
+         pit_sharp = st->sharp << 1;
       }
-      else {
-         overflow = Syn_filt( Az, exc_enhanced, &synth[i_subfr], L_SUBFR, st->
-            mem_syn, 0 );
+
+      /* MR102 */
+      else if ( mode == MR102 ) {
+         first = decode_8i40_31bits( parm, code );
+         parm += 7;
+         pit_sharp = st->sharp << 1;
       }
 
-      if ( overflow ) {
-         for ( i = 0; i < PIT_MAX + L_INTERPOL + L_SUBFR; i++ ) {
-            st->old_exc[i] = st->old_exc[i] >> 2;
-         }
+      /* MR122 */
+      else {
+         index = *parm++;
 
-         for ( i = 0; i < L_SUBFR; i++ ) {
-            exc_enhanced[i] = exc_enhanced[i] >> 2;
+         if ( bfi != 0 ) {
+            ec_gain_pitch( st->ec_gain_p_st, st->state, &gain_pit );
          }
-         Syn_filt_overflow( Az, exc_enhanced, &synth[i_subfr], L_SUBFR, st->mem_syn, 1 );
+         else {
+            gain_pit = d_gain_pitch( mode, index );
+         }
+         ec_gain_pitch_update( st->ec_gain_p_st, bfi, st->prev_bf, &gain_pit );
+         first = decode_10i40_35bits( parm, code );
+         parm += 10;
+
+           /*
+            * pit_sharp = gain_pit;
+            * if (pit_sharp > 1.0) pit_sharp = 1.0;
+            */
+         pit_sharp = gain_pit;
+
+         if ( pit_sharp > 16383 )
+            pit_sharp = 32767;
+         else
+            pit_sharp *= 2;
       }
-      else {
-         memcpy( st->mem_syn, &synth[i_subfr + 30], 40 );
+
+        /*
+         * Add the pitch contribution to code[]; it is zero
+         * up to the first pulse
+         */
+      for ( i = first + T0; i < L_SUBFR; i++ ) {
+         temp = ( code[i - T0] * pit_sharp ) >> 15;
+         code[i] = code[i] + temp;
       }
 
         /*
-         * Update signal for next frame.
-         * -> shift to the left by L_SUBFR  st->exc[]
+         * Decode codebook gain (MR122) or both pitch
+         * gain and codebook gain (all others)
+         * Update pitch sharpening "sharp" with quantized gain_pit
          */
-      memcpy( &st->old_exc[0], &st->old_exc[L_SUBFR], ( PIT_MAX + L_INTERPOL )<<
-            2 );
+      if ( mode == MR475 ) {
+         /* read and decode pitch and code gain */
+         if ( evenSubfr != 0 ) {
+            /* index of gain(s) */
+            index_mr475 = *parm++;
+         }
 
-      /* interpolated LPC parameters for next subframe */
-      Az += MP1;
+         if ( bfi == 0 ) {
+            Dec_gain( st->pred_state, mode, index_mr475, code, evenSubfr, &
+                  gain_pit, &gain_code );
+         }
+         else {
+            ec_gain_pitch( st->ec_gain_p_st, st->state, &gain_pit );
+            ec_gain_code( st->ec_gain_c_st, st->pred_state, st->state, &
+                  gain_code );
+         }
+         ec_gain_pitch_update( st->ec_gain_p_st, bfi, st->prev_bf, &gain_pit );
+         ec_gain_code_update( st->ec_gain_c_st, bfi, st->prev_bf, &gain_code );
+         pit_sharp = gain_pit;
 
-      /* store T0 for next subframe */
-      st->old_T0 = T0;
+         if ( pit_sharp > SHARPMAX ) {
+            pit_sharp = SHARPMAX;
+         }
+      }
+      else if ( ( mode <= MR74 ) || ( mode == MR102 ) ) {
+         /* read and decode pitch and code gain */
+         /* index of gain(s) */
+         index = *parm++;
+
+         if ( bfi == 0 ) {
+            Dec_gain( st->pred_state, mode, index, code, evenSubfr, &gain_pit, &
+                  gain_code );
+         }
+         else {
+            ec_gain_pitch( st->ec_gain_p_st, st->state, &gain_pit );
+            ec_gain_code( st->ec_gain_c_st, st->pred_state, st->state, &
+                  gain_code );
+         }
+         ec_gain_pitch_update( st->ec_gain_p_st, bfi, st->prev_bf, &gain_pit );
+         ec_gain_code_update( st->ec_gain_c_st, bfi, st->prev_bf, &gain_code );
+         pit_sharp = gain_pit;
+
+         if ( pit_sharp > SHARPMAX ) {
+            pit_sharp = SHARPMAX;
+         }
+
+         if ( mode == MR102 ) {
+            if ( st->old_T0 > ( L_SUBFR + 5 ) ) {
+               pit_sharp = pit_sharp >> 2;
+            }
+         }
+      }
+      else {
+         /* read and decode pitch gain */
+         /* index of gain(s) */
+         index = *parm++;
+
+         if ( mode == MR795 ) {
+            /* decode pitch gain */
+            if ( bfi != 0 ) {
+               ec_gain_pitch( st->ec_gain_p_st, st->state, &gain_pit );
+            }
+            else {
+               gain_pit = d_gain_pitch( mode, index );
+            }
+            ec_gain_pitch_update( st->ec_gain_p_st, bfi, st->prev_bf, &gain_pit
+                  );
+
+            /* read and decode code gain */
+            index = *parm++;
+
+            if ( bfi == 0 ) {
+               d_gain_code( st->pred_state, mode, index, code, &gain_code );
+            }
+            else {
+               ec_gain_code( st->ec_gain_c_st, st->pred_state, st->state, &
+                     gain_code );
+            }
+            ec_gain_code_update( st->ec_gain_c_st, bfi, st->prev_bf, &gain_code
+                  );
+            pit_sharp = gain_pit;
+
+            if ( pit_sharp > SHARPMAX ) {
+               pit_sharp = SHARPMAX;
+            }
+         }
+         else {   /* MR122 */
+
+            if ( bfi == 0 ) {
+               d_gain_code( st->pred_state, mode, index, code, &gain_code );
+            }
+            else {
+               ec_gain_code( st->ec_gain_c_st, st->pred_state, st->state, &
+                     gain_code );
+            }
+            ec_gain_code_update( st->ec_gain_c_st, bfi, st->prev_bf, &gain_code
+                  );
+            pit_sharp = gain_pit;
+         }
+      }
+
+        /*
+         * store pitch sharpening for next subframe
+         * (for modes which use the previous pitch gain for
+         *  pitch sharpening in the search phase)
+         * do not update sharpening in even subframes for MR475
+         */
+      if ( ( mode != MR475 ) || evenSubfr == 0 ) {
+         st->sharp = gain_pit;
+
+         if ( st->sharp > SHARPMAX ) {
+            st->sharp = SHARPMAX;
+         }
+      }
+
+      if ( pit_sharp > 16383 )
+         pit_sharp = 32767;
+      else
+         pit_sharp *= 2;
+
+      if ( pit_sharp > 16384 ) {
+         for ( i = 0; i < L_SUBFR; i++ ) {
+            temp = ( st->exc[i] * pit_sharp ) >> 15;
+            temp2 = ( temp * gain_pit ) << 1;
+
+            if ( mode == MR122 ) {
+               temp2 = ( temp2 >> 1 );
+            }
+            excp[i] = ( temp2 + 0x00008000L ) >> 16;
+         }
+      }
+
+        /*
+         * Store list of LTP gains needed in the source
+         * characteristic detector (SCD)
+         */
+      if ( bfi == 0 ) {
+         memmove( &st->ltpGainHistory[0], &st->ltpGainHistory[1], 8 * sizeof(
+               HistWord ) );
+         st->ltpGainHistory[8] = gain_pit;
+      }
+
+
+        /*
+         * Limit gain_pit if in background noise and BFI
+         * for MR475, MR515, MR59
+         */
+      if ( ( st->prev_bf != 0 || bfi != 0 ) & ( st->inBackgroundNoise != 0 ) & (
+            ( mode == MR475 ) || ( mode == MR515 ) || ( mode == MR59 ) ) ) {
+         /* if (gain_pit > 0.75) in Q14*/
+         if ( gain_pit > 12288 )
+            /* gain_pit = (gain_pit-0.75)/2.0 + 0.75; */
+            gain_pit = ( ( gain_pit - 12288 ) >> 1 ) + 12288;
+
+         /* if (gain_pit > 0.90) in Q14*/
+         if ( gain_pit > 14745 ) {
+            gain_pit = 14745;
+         }
+      }
+
+        /*
+         * Calculate CB mixed gain
+         */
+      Int_lsf( prev_lsf, st->lsfState->past_lsf_q, i_subfr, lsf_i );
+      gain_code_mix = Cb_gain_average( st->Cb_gain_averState, mode, gain_code,
+            lsf_i, st->lsp_avg_st->lsp_meanSave, bfi, st->prev_bf, pdfi, st->
+            prev_pdf, st->inBackgroundNoise, st->voicedHangover );
+
+      /* make sure that MR74, MR795, MR122 have original codeGain*/
+      /* MR74, MR795, MR122 */
+      if ( ( mode > MR67 ) & ( mode != MR102 ) ) {
+         gain_code_mix = gain_code;
+      }
+
+        /*
+         * Find the total excitation.
+         * Find synthesis speech corresponding to st->exc[].
+         */
+      /* MR475, MR515, MR59, MR67, MR74, MR795, MR102*/
+      if ( mode <= MR102 ) {
+         pitch_fac = gain_pit;
+         tmp_shift = 1;
+      }
+
+      /* MR122 */
+      else {
+         pitch_fac = gain_pit >> 1;
+         tmp_shift = 2;
+      }
+
+        /*
+         * copy unscaled LTP excitation to exc_enhanced (used in phase
+         * dispersion below) and compute total excitation for LTP feedback
+         */
+      memcpy( exc_enhanced, st->exc, L_SUBFR * sizeof( Word32 ) );
+
+      for ( i = 0; i < L_SUBFR; i++ ) {
+         /* st->exc[i] = gain_pit*st->exc[i] + gain_code*code[i]; */
+         temp = ( st->exc[i] * pitch_fac ) + ( code[i] * gain_code );
+         temp2 = ( temp << tmp_shift );
+         if (((temp2 >> 1) ^ temp2) & 0x40000000) {
+            if ((temp ^ temp2) & 0x80000000) {
+               temp2 = (temp & 0x80000000) ? (-1073741824L) : 1073725439;
+            }
+            else {
+               temp2 = (temp2 & 0x80000000) ? (-1073741824L) : 1073725439;
+            }
+         }
+         st->exc[i] = ( temp2 + 0x00004000L ) >> 15;
+      }
+      /*
+       * Adaptive phase dispersion
+       */
+
+      /* free phase dispersion adaption */
+      st->ph_disp_st->lockFull = 0;
+
+      if ( ( ( mode == MR475 ) || ( mode == MR515 ) || ( mode == MR59 ) ) & ( st
+            ->voicedHangover > 3 ) & ( st->inBackgroundNoise != 0 ) & ( bfi != 0
+            ) ) {
+           /*
+            * Always Use full Phase Disp.
+            * if error in bg noise
+            */
+         st->ph_disp_st->lockFull = 1;
+      }
+
+        /*
+         * apply phase dispersion to innovation (if enabled) and
+         * compute total excitation for synthesis part
+         */
+      ph_disp( st->ph_disp_st, mode, exc_enhanced, gain_code_mix, gain_pit, code
+            , pitch_fac, tmp_shift );
+
+        /*
+         * The Excitation control module are active during BFI.
+         * Conceal drops in signal energy if in bg noise.
+         */
+      temp2 = 0;
+
+      for ( i = 0; i < L_SUBFR; i++ ) {
+         temp2 += ( exc_enhanced[i] * exc_enhanced[i] );
+      }
+
+      if ( temp2 > 0x3FFFFFFF ) {
+         excEnergy = 11584;
+      }
+      else {
+         temp2 = sqrt_l_exp( temp2, &temp );
+         temp2 = ( temp2 >> ( ( temp >> 1 ) + 15 ) );
+         excEnergy = temp2 >> 2;
+      }
+
+      if ( ( ( mode == MR475 ) || ( mode == MR515 ) || ( mode == MR59 ) ) & ( st
+            ->voicedHangover > 5 ) & ( st->inBackgroundNoise != 0 ) & ( st->
+            state < 4 ) & ( ( ( pdfi != 0 ) & ( st->prev_pdf != 0 ) ) || bfi !=
+            0 || st->prev_bf != 0 ) ) {
+         carefulFlag = 0;
+
+         if ( ( pdfi != 0 ) & ( bfi == 0 ) ) {
+            carefulFlag = 1;
+         }
+         Ex_ctrl( exc_enhanced, excEnergy, st->excEnergyHist, st->voicedHangover
+               , st->prev_bf, carefulFlag );
+      }
+
+      if ( ( st->inBackgroundNoise != 0 ) & ( bfi != 0 || st->prev_bf != 0 ) & (
+            st->state < 4 ) ) {;   /* do nothing! */
+      }
+      else {
+         /* Update energy history for all modes */
+         memmove( &st->excEnergyHist[0], &st->excEnergyHist[1], 8 * sizeof(
+               HistWord ) );
+         st->excEnergyHist[8] = excEnergy;
+      }
+
+        /*
+         * Excitation control module end.
+         */
+      if ( pit_sharp > 16384 ) {
+         for ( i = 0; i < L_SUBFR; i++ ) {
+            excp[i] = Sat16( excp[i] + exc_enhanced[i] );
+         }
+         agc2( exc_enhanced, excp );
+         overflow = KERNELS->syn_filt( Az, excp, &synth[i_subfr], L_SUBFR, st->
+               mem_syn, 0 );
+      }
+      else {
+         overflow = KERNELS->syn_filt( Az, exc_enhanced, &synth[i_subfr],
+               L_SUBFR, st->mem_syn, 0 );
+      }
+
+      if ( overflow ) {
+         for ( i = -( PIT_MAX + L_INTERPOL ); i < L_SUBFR; i++ ) {
+            st->exc[i] = st->exc[i] >> 2;
+         }
+
+         for ( i = 0; i < L_SUBFR; i++ ) {
+            exc_enhanced[i] = exc_enhanced[i] >> 2;
+         }
+         Syn_filt_overflow( Az, exc_enhanced, &synth[i_subfr], L_SUBFR, st->mem_syn, 1 );
+      }
+      else {
+         memcpy( st->mem_syn, &synth[i_subfr + 30], M * sizeof( Word32 ) );
+      }
+
+        /*
+         * Update signal for next subframe.
+         * -> excitation of this one becomes part of the history
+         */
+      st->exc += L_SUBFR;
+
+      /* interpolated LPC parameters for next subframe */
+      Az += MP1;
+
+      /* store T0 for next subframe */
+      st->old_T0 = T0;
+
+      /* parameters of the subframe as synthesized */
+      st->feat_lag[subfrNr] = ( Word16 )T0;
+      st->feat_lag_frac[subfrNr] = ( Word16 )T0_frac;
+      st->feat_gain_pit[subfrNr] = ( Word16 )gain_pit;
+      st->feat_gain_code[subfrNr] = ( Word16 )gain_code;
+   }
+
+   /* history of the next frame ends with excitation of this one */
+   memcpy( &st->old_exc[0], &st->old_exc[L_FRAME], ( PIT_MAX +
+         L_INTERPOL ) * sizeof( Word32 ) );
+   st->exc = st->old_exc + PIT_MAX + L_INTERPOL;
+
+    /*
+     * Call the Source Characteristic Detector which updates
+     * st->inBackgroundNoise and st->voicedHangover.
+     */
+   st->inBackgroundNoise = Bgn_scd( st->background_state, &( st->ltpGainHistory[
+         0] ), &( synth[0] ), &( st->voicedHangover ) );
+   dtx_dec_activity_update( st->dtxDecoderState, st->lsfState->past_lsf_q, synth
+         );
+
+   /* store bfi for next subframe */
+   st->prev_bf = bfi;
+   st->prev_pdf = pdfi;
+
+    /*
+     * Calculate the LSF averages on the eight
+     * previous frames
+     */
+   lsp_avg( st->lsp_avg_st, st->lsfState->past_lsf_q );
+theEnd:
+   st->dtxDecoderState->dtxGlobalState = newDTXState;
+   return;
+}
+
+
+/*
+ * Decoder_amr
+ *
+ *
+ * Parameters:
+ *    st                B: State variables
+ *    mode              I: AMR mode
+ *    parm              I: vector of synthesis parameters
+ *    frame_type        I: received frame type
+ *    synth             O: synthesis speech
+ *    A_t               O: decoded LP filter in 4 subframes
+ *    w                 -: work buffers
+ *
+ * Function:
+ *    Speech decoder routine. MR122 and MR475, modes of nearly all files,
+ *    have own copies of Decoder_amr_mode with the tests of mode folded
+ *    by compiler, other modes share the generic one
+ *
+ * Returns:
+ *    void
+ */
+static void Decoder_amr( Decoder_amrState *st, enum Mode mode, Word16 parm[],
+      enum RXFrameType frame_type, Word32 synth[], Word32 A_t[],
+      Speech_Decode_FrameScratch *w )
+{
+   switch ( mode ) {
+      case MR122:
+         Decoder_amr_mode( st, MR122, parm, frame_type, synth, A_t, w );
+         break;
+
+      case MR475:
+         Decoder_amr_mode( st, MR475, parm, frame_type, synth, A_t, w );
+         break;
+
+      default:
+         Decoder_amr_mode( st, mode, parm, frame_type, synth, A_t, w );
+         break;
+   }
+}
+
+
+/*
+ * Residu40
+ *
+ *
+ * Parameters:
+ *    a                 I: prediction coefficients
+ *    x                 I: speech signal
+ *    y                 O: residual signal
+ *
+ * Function:
+ *    The LP residual is computed by filtering the input
+ *    speech through the LP inverse filter a(z)
+ *
+ * Returns:
+ *    void
+ */
+static void Residu40( const Word32 * RESTRICT a, const Word32 * RESTRICT x,
+      Word32 * RESTRICT y )
+{
+   Word32 s, i, j, over;
+
+   /*
+    * all outputs first, with no exit from the loop, so it vectorizes;
+    * any of them out of 16 bits sends all of them to safe mode after
+    */
+   over = 0;
+
+   for ( i = 0; i < 40; i++ ) {
+      s = a[0] * x[i] + a[1] * x[i - 1] + a[2] * x[i - 2] + a[3] * x[i - 3];
+      s += a[4] * x[i - 4] + a[5] * x[i - 5] + a[6] * x[i - 6] + a[7] * x[i - 7]
+         ;
+      s += a[8] * x[i - 8] + a[9] * x[i - 9] + a[10] * x[i - 10];
+      y[i] = ( s + 0x800 ) >> 12;
+      over |= ( y[i] > 32767 ) | ( y[i] < -32767 );
+   }
+
+   if ( over != 0 ) {
+      /* go to safe mode */
+      for (i = 0; i < 40; i++) {
+         s = a[0] * x[i];
+         for (j = 1; j <= 10; j++) {
+            s = Sat31( s + a[j] * x[i - j] );
+         }
+         y[i] = Sat16( ( s + 0x800 ) >> 12 );
+      }
+   }
+   return;
+}
+
+
+#ifdef SP_DEC_SSE2
+/*
+ * Residu40_sse2
+ *
+ *
+ * Parameters:
+ *    a                 I: prediction coefficients
+ *    x                 I: speech signal
+ *    y                 O: residual signal
+ *
+ * Function:
+ *    Same as Residu40, eight outputs at a time. Signal and
+ *    coefficients are packed to 16 bits, and pairs of taps are
+ *    multiplied and added with pmaddwd, which wraps around in 32 bits
+ *    just like Word32 arithmetic of Residu40. If any input does not
+ *    fit in 16 bits, or if any output needs safe mode, Residu40
+ *    computes y instead.
+ *
+ * Returns:
+ *    void
+ */
+static void Residu40_sse2( const Word32 * RESTRICT a, const Word32 * RESTRICT
+      x, Word32 * RESTRICT y )
+{
+   short x16[56];   /* x[-11..39], x[-11] is multiplied by zero */
+   __m128i c[6], d0, d1, lo, hi, over;
+   Word32 i, j, n;
+
+
+   for ( i = 0; i <= 10; i++ ) {
+      if ( a[i] < -32768 || a[i] > 32767 ) {
+         Residu40( a, x, y );
+         return;
+      }
+   }
+
+   for ( i = -10; i < 40; i++ ) {
+      if ( x[i] < -32768 || x[i] > 32767 ) {
+         Residu40( a, x, y );
+         return;
+      }
+      x16[i + 11] = ( short )x[i];
+   }
+   x16[0] = 0;
+
+   /* a[j] in low and a[j + 1] in high half of each 32-bit lane */
+   for ( j = 0; j < 10; j += 2 ) {
+      c[j >> 1] = _mm_set1_epi32( ( a[j] & 0xFFFF ) | ( a[j + 1] << 16 ) );
+   }
+   c[5] = _mm_set1_epi32( a[10] & 0xFFFF );
+   over = _mm_setzero_si128( );
+
+   for ( n = 0; n < 40; n += 8 ) {
+      lo = _mm_set1_epi32( 0x800 );
+      hi = lo;
+
+      for ( j = 0; j < 12; j += 2 ) {
+         /* pairs x[n + k - j], x[n + k - j - 1] for k = 0..7 */
+         d0 = _mm_loadu_si128( ( __m128i * )&x16[n - j + 11] );
+         d1 = _mm_loadu_si128( ( __m128i * )&x16[n - j + 10] );
+         lo = _mm_add_epi32( lo, _mm_madd_epi16( _mm_unpacklo_epi16( d0, d1 ),
+               c[j >> 1] ) );
+         hi = _mm_add_epi32( hi, _mm_madd_epi16( _mm_unpackhi_epi16( d0, d1 ),
+               c[j >> 1] ) );
+      }
+      lo = _mm_srai_epi32( lo, 12 );
+      hi = _mm_srai_epi32( hi, 12 );
+
+      /* abs(y) > 32767 sends Residu40 to safe mode */
+      over = _mm_or_si128( over, _mm_cmpgt_epi32( lo, _mm_set1_epi32( 32767 ) ) );
+      over = _mm_or_si128( over, _mm_cmplt_epi32( lo, _mm_set1_epi32( -32767 ) ) );
+      over = _mm_or_si128( over, _mm_cmpgt_epi32( hi, _mm_set1_epi32( 32767 ) ) );
+      over = _mm_or_si128( over, _mm_cmplt_epi32( hi, _mm_set1_epi32( -32767 ) ) );
+      _mm_storeu_si128( ( __m128i * )&y[n], lo );
+      _mm_storeu_si128( ( __m128i * )&y[n + 4], hi );
+   }
+
+   if ( _mm_movemask_epi8( over ) )
+      Residu40( a, x, y );
+}
+#endif
+
+
+#ifdef SP_DEC_NEON
+/*
+ * Residu40_neon
+ *
+ *
+ * Parameters:
+ *    a                 I: prediction coefficients
+ *    x                 I: speech signal
+ *    y                 O: residual signal
+ *
+ * Function:
+ *    Same as Residu40, four outputs at a time. Taps are multiplied
+ *    and added in 32-bit lanes, which wrap around just like Word32
+ *    arithmetic of Residu40, so inputs of any size give its sums. If
+ *    any output needs safe mode, Residu40 computes y instead.
+ *
+ * Returns:
+ *    void
+ */
+static void Residu40_neon( const Word32 * RESTRICT a, const Word32 * RESTRICT
+      x, Word32 * RESTRICT y )
+{
+   int32x4_t s;
+   uint32x4_t over;
+   Word32 i, j;
+
+
+   over = vdupq_n_u32( 0 );
+
+   for ( i = 0; i < 40; i += 4 ) {
+      s = vmulq_n_s32( vld1q_s32( &x[i] ), a[0] );
+
+      for ( j = 1; j <= 10; j++ ) {
+         s = vmlaq_n_s32( s, vld1q_s32( &x[i - j] ), a[j] );
+      }
+      s = vshrq_n_s32( vaddq_s32( s, vdupq_n_s32( 0x800 ) ), 12 );
+
+      /* abs(y) > 32767 sends Residu40 to safe mode */
+      over = vorrq_u32( over, vcgtq_s32( vabsq_s32( s ), vdupq_n_s32( 32767 ) ) );
+      vst1q_s32( &y[i], s );
+   }
+
+   if ( vmaxvq_u32( over ) )
+      Residu40( a, x, y );
+}
+#endif
+
+
+/*
+ * agc
+ *
+ *
+ * Parameters:
+ *    st->past_gain     B: gain memory
+ *    sig_in            I: Post_Filter input signal
+ *    sig_out           B: Post_Filter output signal
+ *    agc_fac           I: AGC factor
+ *
+ * Function:
+ *    Scales the Post_Filter output on a subframe basis
+ *
+ * Returns:
+ *    void
+ */
+static void agc( agcState *st, Word32 *sig_in, Word32 *sig_out, Word16 agc_fac )
+{
+   Word32 gains[L_SUBFR];
+   Word32 s, gain_in, gain_out, g0, gain;
+   int exp, i;
+
+
+   /* calculate gain_out with exponent */
+   s = KERNELS->energy( sig_out );
+
+   if ( s == 0 ) {
+      st->past_gain = 0;
+      return;
+   }
+   exp = Norm_bit( s, 30 );
+   exp -=1;
+   if (exp & 0x80000000) {
+      s >>= 1;
+   }
+   else {
+      s <<= exp;
+   }
+   gain_out = ( s + 0x00008000L ) >> 16;
+
+   /* calculate gain_in with exponent */
+   s = KERNELS->energy( sig_in );
+
+   if ( s == 0 ) {
+      g0 = 0;
+   }
+   else {
+      i = Norm_bit( s, 30 );
+      s = s << i;
+      s = s + 0x00008000L;
+
+      if ( s >= 0 )
+         gain_in = s >> 16;
+      else
+         gain_in = 32767;
+      exp = ( exp - i );
+
+      /*
+       * g0 = (1-agc_fac) * sqrt(gain_in/gain_out);
+       */
+      /* s = gain_out / gain_in */
+      s = ( gain_out << 15 ) / gain_in;
+      exp = 7 - exp;
+
+      if ( exp > 0 ){
+         if (exp > 31)
+         {
+            if(s){
+               s = 2147483647;
+            }
+         }
+         else {
+            s = s << exp ;
+         }
+      }
+      else
+         s = ( s >> ( -exp ) );
+      if (s < 0)
+         s = 2147483647;
+      s = Inv_sqrt( s );
+      i = ( ( s << 9 ) + 0x00008000L ) >> 16;
+      if (i & 0xFFFF8000)
+         i = 32767;
+
+      /* g0 = i * (1-agc_fac) */
+      g0 = ( i * ( 32767 - agc_fac ) ) >> 15;
+   }
+
+   /*
+    * compute gain[n] = agc_fac * gain[n-1] + (1-agc_fac) * sqrt(gain_in/gain_out)
+    * sig_out[n] = gain[n] * sig_out[n]
+    */
+   gain = st->past_gain;
+
+   /* gains depend on each other, samples are scaled by them all at once */
+   for ( i = 0; i < L_SUBFR; i++ ) {
+      gain = ( gain * agc_fac ) >> 15;
+      gain = gain + g0;
+      gains[i] = gain;
+   }
+   KERNELS->agc_scale( sig_out, gains );
+   st->past_gain = gain;
+   return;
+}
+
+
+/*
+ * Post_Filter
+ *
+ *
+ * Parameters:
+ *    st                B: post filter states, synthesis speech in
+ *                         st->synth_buf[M..]
+ *    mode              I: AMR mode
+ *    syn               O: post filtered speech
+ *    Az_4              I: interpolated LPC parameters in all subfr.
+ *    w                 -: work buffers
+ *
+ * Function:
+ *    Post_Filtering of synthesis speech. Decoder synthesizes it right
+ *    into synth_buf, after its last samples of the previous frame, so
+ *    it is not copied there.
+ *
+ *    inverse filtering of syn[] through A(z/0.7) to get res2[]
+ *    tilt compensation filtering; 1 - MU*k*z^-1
+ *    synthesis filtering through 1/A(z/0.75)
+ *    adaptive gain control
+ *
+ *    Weighted filters and tilt factor of the last subframe are kept in
+ *    w->pf_memo. Subframes of comfort noise share one LP filter, which
+ *    changes little once SID interpolation is over, so they are mostly
+ *    taken from there.
+ *
+ * Returns:
+ *    void
+ */
+static void Post_Filter( Post_FilterState *st, enum Mode mode, Word32 *syn,
+      Word32 *Az_4, Speech_Decode_FrameScratch *w )
+{
+   Post_FilterMemo *memo = &w->pf_memo;
+   Word32 *h = w->h, *Ap3 = memo->Ap3, *Ap4 = memo->Ap4;   /* bandwidth expanded LP parameters */
+   Word32 tmp, i_subfr, i, temp1, temp2, overflow = 0;
+   Word32 *Az, *p1, *p2, *syn_work = &st->synth_buf[M];
+   const Word32 *pgamma3 = &gamma3[0];
+   const Word32 *pgamma4 = &gamma4_gamma3_MR122[0];
+
+
+   /*
+    * Post filtering
+    */
+   Az = Az_4;
+
+   if ( ( mode == MR122 ) || ( mode == MR102 ) ) {
+      pgamma3 = &gamma4_gamma3_MR122[0];
+      pgamma4 = &gamma4_MR122[0];
+   }
+
+   for ( i_subfr = 0; i_subfr < L_FRAME; i_subfr += L_SUBFR ) {
+      if ( memo->gamma3 == pgamma3 && memcmp( memo->Az, Az, MP1 <<2 ) == 0 ) {
+         /* same filters as before */
+         KERNELS->residu40( Ap3, &syn_work[i_subfr], st->res2 );
+         temp2 = memo->tilt;
+         goto preemphasis;
+      }
+
+      /* Find weighted filter coefficients Ap3[] and Ap[4] */
+      Ap3[0] = Az[0];
+      Ap4[0] = Az[0];
+
+      for ( i = 1; i <= 10; i++ ) {
+         Ap3[i] = ( Az[i] * pgamma3[i - 1] +0x4000 ) >> 15;
+         Ap4[i] = ( Az[i] * pgamma4[i - 1] +0x4000 ) >> 15;
+      }
+
+      /* filtering of synthesis speech by A(z/0.7) to find res2[] */
+      KERNELS->residu40( Ap3, &syn_work[i_subfr], st->res2 );
+
+      /* tilt compensation filter */
+      /* impulse response of A(z/0.7)/A(z/0.75) */
+      memcpy( h, Ap3, MP1 * sizeof( Word32 ) );
+      memset( &h[M +1], 0, ( 22 - M - 1 ) * sizeof( Word32 ) );
+      KERNELS->syn_filt( Ap4, h, h, 22, &h[M +1], 0 );
+
+      /* 1st correlation of h[] */
+      tmp = 16777216 + h[1] * h[1];
+
+      for ( i = 2; i < 22; i++ ) {
+         tmp += h[i] * h[i];
+         if (tmp > 0x3FFF8000)
+            break;
+      }
+      temp1 = tmp >> 15;
+      if (temp1 & 0xFFFF8000)
+         temp1 = 32767;
+
+      tmp = h[0] * h[1];
+
+      for ( i = 1; i < 21; i++ ) {
+         tmp += h[i] * h[i + 1];
+         if (abs(tmp) > 1073741823)
+            tmp = 1073741823;
+      }
+      temp2 = tmp >> 15;
+
+      if ( temp2 <= 0 ) {
+         temp2 = 0;
+      }
+      else {
+         tmp = temp2 * 26214;
+         temp2 = ( tmp & 0xffff8000 ) / temp1;
+      }
+      memcpy( memo->Az, Az, MP1 * sizeof( Word32 ) );
+      memo->gamma3 = pgamma3;
+      memo->tilt = temp2;
+
+      /* preemphasis */
+preemphasis:
+      p1 = st->res2 + 39;
+      p2 = p1 - 1;
+      tmp = *p1;
+
+      do {
+         *p1 = Sat16( *p1 - ( ( temp2 * *p2-- ) >> 15 ) );
+         p1--;
+         *p1 = Sat16( *p1 - ( ( temp2 * *p2-- ) >> 15 ) );
+         p1--;
+         *p1 = Sat16( *p1 - ( ( temp2 * *p2-- ) >> 15 ) );
+         p1--;
+      } while( p1 > st->res2 );
+      *p1 = Sat16( *p1 - ( ( temp2 * st->preemph_state_mem_pre ) >> 15 ) );
+      st->preemph_state_mem_pre = tmp;
+
+      /* filtering through  1/A(z/0.75) */
+      overflow = KERNELS->syn_filt( Ap4, st->res2, &syn[i_subfr], L_SUBFR, st->
+            mem_syn_pst, 0 );
+      if (overflow){
+         Syn_filt_overflow( Ap4, st->res2, &syn[i_subfr], L_SUBFR, st->mem_syn_pst, 1 );
+         overflow = 0;
+      }
+      else {
+         memcpy( st->mem_syn_pst, &syn[i_subfr + 30], M * sizeof( Word32 ) );
+      }
+
+      /* scale output to input */
+      agc( st->agc_state, &syn_work[i_subfr], &syn[i_subfr], AGC_FAC );
+      Az += MP1;
+   }
+
+   /* update syn_work[] buffer */
+   memcpy( &syn_work[- M], &syn_work[L_FRAME - M], M * sizeof( Word32 ) );
+   return;
+}
+
+
+/*
+ * Post_Process
+ *
+ *
+ * Parameters:
+ *    st                B: post filter states
+ *    signal            B: signal
+ *    synth             O: output speech, or NULL
+ *    synth_float       O: output speech as floating point, or NULL
+ *    stride            I: distance of output samples in the buffer
+ *    scale             I: floating point output of a 16-bit sample
+ *
+ * Function:
+ *    Postprocessing of input speech.
+ *
+ *    2nd order high pass filtering with cut off frequency at 60 Hz.
+ *    Multiplication of output by two.
+ *
+ *    Each filtered sample is also stored to whichever output buffer is
+ *    given, truncated to 13 bits unless NO13BIT is defined, so output
+ *    takes no pass of its own, and interleaved output of several decoders
+ *    needs no pass either, nor does gain of floating point output, see
+ *    Speech_Decode_Frame_set_gain. Expanded into callers, which pass the
+ *    buffers they have, and the stride, as constants.
+ *
+ * Returns:
+ *    void
+ */
+ static FORCE_INLINE void Post_Process( Post_ProcessState *st, Word32
+       signal[], Word16 synth[], Float32 synth_float[], Word32 stride, Float32
+       scale )
+ {
+    Word32 x2, tmp, y, i = 0;
+    Word16 out;
+
+    do {
+       x2 = st->x1;
+       st->x1 = st->x0;
+       st->x0 = signal[i];
+
+       /*
+       * y[i] = b[0]*x[i]*2 + b[1]*x[i-1]*2 + b140[2]*x[i-2]/2
+       *                    + a[1]*y[i-1] + a[2] * y[i-2];
+       */
+       tmp = ( st->y1_hi * 15836) + ( ( ( st->y1_lo * 15836 ) & ( Word32 )0xffff8000 ) >> 15);
+       tmp += (st->y2_hi * -7667) + ( ( ( st->y2_lo * ( -7667 ) ) & ( Word32 )0xffff8000 ) >> 15);
+       tmp += st->x0 * 7699;
+       tmp = Sat31( tmp + st->x1 * -15398 );
+       tmp = Sat31( tmp + x2 * 7699 );
+       tmp = Sat31( tmp << 1 );
+       tmp = Sat31( tmp << 1 );
+
+       if ( abs( tmp ) < 536862720 ) {
+          y = ( tmp + 0x00002000L ) >> 14;
+       }
+       else if ( tmp > 0 ) {
+          y = 32767;
+       }
+       else {
+          y = -32768;
+       }
+       signal[i] = y;
+#ifndef NO13BIT
+       /* Truncate to 13 bits */
+       out = ( Word16 )( y & 0xfff8 );
+#else
+       out = ( Word16 )y;
+#endif
+
+       if ( synth_float != NULL )
+          synth_float[i * stride] = out * scale;
+       else
+          synth[i * stride] = out;
+       i++;
+       st->y2_hi = st->y1_hi;
+       st->y2_lo = st->y1_lo;
+       st->y1_hi = tmp >> 15;
+       st->y1_lo = ( ( tmp << 1 ) - ( st->y1_hi << 16 ) ) >> 1;
+    } while( i < 160 );
+    return;
+}
+
+/*
+ * Post_Process4
+ *
+ *
+ * Parameters:
+ *    st                B: post filter states of four decoders
+ *    signal            B: signal of each
+ *    synth_float       O: output speech of each, as floating point
+ *    stride            I: distance of output samples in the buffers
+ *    scale             I: floating point output of a 16-bit sample, of each
+ *
+ * Function:
+ *    Post_Process of four decoders, see Speech_Decode_Frame_group_float
+ *
+ * Returns:
+ *    void
+ */
+static void Post_Process4( Post_ProcessState *st[], Word32 *signal[], Float32
+      *synth_float[], Word32 stride, const Float32 scale[] )
+{
+   Word32 l;
+
+
+   for ( l = 0; l < 4; l++ )
+      Post_Process( st[l], signal[l], NULL, synth_float[l], stride, scale[l] );
+}
+
+
+#ifdef SP_DEC_SSE2
+/*
+ * transpose4_sse2
+ *
+ *
+ * Parameters:
+ *    v                 B: four rows of four 32-bit values
+ *
+ * Function:
+ *    Turns rows into columns
+ *
+ * Returns:
+ *    void
+ */
+static FORCE_INLINE void transpose4_sse2( __m128i v[4] )
+{
+   __m128i t0, t1, t2, t3;
+
+
+   t0 = _mm_unpacklo_epi32( v[0], v[1] );
+   t1 = _mm_unpacklo_epi32( v[2], v[3] );
+   t2 = _mm_unpackhi_epi32( v[0], v[1] );
+   t3 = _mm_unpackhi_epi32( v[2], v[3] );
+   v[0] = _mm_unpacklo_epi64( t0, t1 );
+   v[1] = _mm_unpackhi_epi64( t0, t1 );
+   v[2] = _mm_unpacklo_epi64( t2, t3 );
+   v[3] = _mm_unpackhi_epi64( t2, t3 );
+}
+
+
+/*
+ * sat31_sse2
+ *
+ *
+ * Parameters:
+ *    v                 I: four 32-bit values
+ *
+ * Function:
+ *    Saturation of Post_Process: values that don't fit in 31 bits are
+ *    replaced by -2^30 or 2^30 - 1
+ *
+ * Returns:
+ *    saturated values
+ */
+static FORCE_INLINE __m128i sat31_sse2( __m128i v )
+{
+   const __m128i bit30 = _mm_set1_epi32( 0x40000000 );
+   __m128i over, sat;
+
+
+   over = _mm_cmpeq_epi32( _mm_and_si128( _mm_xor_si128( _mm_srai_epi32( v,
+         1 ), v ), bit30 ), bit30 );
+   sat = _mm_xor_si128( _mm_srai_epi32( v, 31 ), _mm_set1_epi32( 0x3FFFFFFF ) );
+   return _mm_or_si128( _mm_and_si128( over, sat ), _mm_andnot_si128( over, v )
+         );
+}
+
+
+/*
+ * madd16_sse2
+ *
+ *
+ * Parameters:
+ *    v                 I: four 32-bit values that fit in 16 bits
+ *    c                 I: 16-bit coefficient
+ *
+ * Function:
+ *    Products of the values and the coefficient, as with pmaddwd
+ *
+ * Returns:
+ *    products
+ */
+static FORCE_INLINE __m128i madd16_sse2( __m128i v, Word32 c )
+{
+   return _mm_madd_epi16( v, _mm_set1_epi32( c & 0xFFFF ) );
+}
+
+
+/*
+ * Post_Process_sse2
+ *
+ *
+ * Parameters:
+ *    st                B: post filter states of four decoders
+ *    signal            B: signal of each
+ *    synth_float       O: output speech of each, as floating point
+ *    stride            I: distance of output samples in the buffers
+ *    scale             I: floating point output of a 16-bit sample, of each
+ *
+ * Function:
+ *    Same as Post_Process4, with one decoder in each lane. The filter
+ *    is recursive, so samples of one decoder can't be filtered side by
+ *    side, but the decoders don't depend on each other. Four samples
+ *    of each are transposed into lanes at a time. Products are 16 by 16
+ *    bits, pmaddwd against coefficients paired with zero; if any sample
+ *    does not fit in 16 bits, Post_Process4 filters instead.
+ *
+ * Returns:
+ *    void
+ */
+static void Post_Process_sse2( Post_ProcessState *st[], Word32 *signal[],
+      Float32 *synth_float[], Word32 stride, const Float32 scale[] )
+{
+   __m128i y1_hi, y1_lo, y2_hi, y2_lo, x0, x1, x2, tmp, s, y, small, over;
+   __m128i x[4];
+   __m128 f[4], lane_scale;
+   float out[4];
+   Word32 lane[6][4];
+   Word32 i, k, l;
+
+
+   x0 = _mm_set_epi32( st[3]->x0, st[2]->x0, st[1]->x0, st[0]->x0 );
+   x1 = _mm_set_epi32( st[3]->x1, st[2]->x1, st[1]->x1, st[0]->x1 );
+
+   /* earlier input stays in memory, so it is checked too */
+   over = _mm_or_si128( _mm_cmpgt_epi32( x0, _mm_set1_epi32( 32767 ) ),
+         _mm_cmplt_epi32( x0, _mm_set1_epi32( -32768 ) ) );
+   over = _mm_or_si128( over, _mm_cmpgt_epi32( x1, _mm_set1_epi32( 32767 ) ) );
+   over = _mm_or_si128( over, _mm_cmplt_epi32( x1, _mm_set1_epi32( -32768 ) ) );
+
+   for ( l = 0; l < 4; l++ ) {
+      for ( i = 0; i < L_FRAME; i += 4 ) {
+         tmp = _mm_loadu_si128( ( __m128i * )&signal[l][i] );
+         over = _mm_or_si128( over, _mm_cmpgt_epi32( tmp, _mm_set1_epi32( 32767 ) ) );
+         over = _mm_or_si128( over, _mm_cmplt_epi32( tmp, _mm_set1_epi32( -32768 ) ) );
+      }
+   }
+
+   if ( _mm_movemask_epi8( over ) ) {
+      Post_Process4( st, signal, synth_float, stride, scale );
+      return;
+   }
+   lane_scale = _mm_set_ps( scale[3], scale[2], scale[1], scale[0] );
+   y1_hi = _mm_set_epi32( st[3]->y1_hi, st[2]->y1_hi, st[1]->y1_hi, st[0]->y1_hi );
+   y1_lo = _mm_set_epi32( st[3]->y1_lo, st[2]->y1_lo, st[1]->y1_lo, st[0]->y1_lo );
+   y2_hi = _mm_set_epi32( st[3]->y2_hi, st[2]->y2_hi, st[1]->y2_hi, st[0]->y2_hi );
+   y2_lo = _mm_set_epi32( st[3]->y2_lo, st[2]->y2_lo, st[1]->y2_lo, st[0]->y2_lo );
+
+   for ( i = 0; i < L_FRAME; i += 4 ) {
+      for ( l = 0; l < 4; l++ )
+         x[l] = _mm_loadu_si128( ( __m128i * )&signal[l][i] );
+      transpose4_sse2( x );
+
+      for ( k = 0; k < 4; k++ ) {
+         x2 = x1;
+         x1 = x0;
+         x0 = x[k];
+         tmp = _mm_add_epi32( madd16_sse2( y1_hi, 15836 ), _mm_srai_epi32(
+               madd16_sse2( y1_lo, 15836 ), 15 ) );
+         tmp = _mm_add_epi32( tmp, madd16_sse2( y2_hi, -7667 ) );
+         tmp = _mm_add_epi32( tmp, _mm_srai_epi32( madd16_sse2( y2_lo, -7667 ),
+               15 ) );
+         tmp = _mm_add_epi32( tmp, madd16_sse2( x0, 7699 ) );
+         tmp = sat31_sse2( _mm_add_epi32( tmp, madd16_sse2( x1, -15398 ) ) );
+         tmp = sat31_sse2( _mm_add_epi32( tmp, madd16_sse2( x2, 7699 ) ) );
+         tmp = sat31_sse2( _mm_slli_epi32( tmp, 1 ) );
+         tmp = sat31_sse2( _mm_slli_epi32( tmp, 1 ) );
+
+         /* rounded to 16 bits where it fits, saturated elsewhere */
+         s = _mm_srai_epi32( tmp, 31 );
+         small = _mm_cmplt_epi32( _mm_sub_epi32( _mm_xor_si128( tmp, s ), s ),
+               _mm_set1_epi32( 536862720 ) );
+         y = _mm_or_si128( _mm_and_si128( small, _mm_srai_epi32( _mm_add_epi32(
+               tmp, _mm_set1_epi32( 0x00002000L ) ), 14 ) ), _mm_andnot_si128(
+               small, _mm_xor_si128( s, _mm_set1_epi32( 32767 ) ) ) );
+         x[k] = y;
+#ifndef NO13BIT
+         /* Truncate to 13 bits */
+         y = _mm_and_si128( y, _mm_set1_epi32( -8 ) );
+#endif
+         f[k] = _mm_mul_ps( _mm_cvtepi32_ps( y ), lane_scale );
+         y2_hi = y1_hi;
+         y2_lo = y1_lo;
+         y1_hi = _mm_srai_epi32( tmp, 15 );
+         y1_lo = _mm_srai_epi32( _mm_sub_epi32( _mm_slli_epi32( tmp, 1 ),
+               _mm_slli_epi32( y1_hi, 16 ) ), 1 );
+      }
+      transpose4_sse2( x );
+      _MM_TRANSPOSE4_PS( f[0], f[1], f[2], f[3] );
+
+      for ( l = 0; l < 4; l++ ) {
+         _mm_storeu_si128( ( __m128i * )&signal[l][i], x[l] );
+         _mm_storeu_ps( out, f[l] );
+
+         for ( k = 0; k < 4; k++ )
+            synth_float[l][( i + k ) * stride] = out[k];
+      }
+   }
+
+   _mm_storeu_si128( ( __m128i * )lane[0], y1_hi );
+   _mm_storeu_si128( ( __m128i * )lane[1], y1_lo );
+   _mm_storeu_si128( ( __m128i * )lane[2], y2_hi );
+   _mm_storeu_si128( ( __m128i * )lane[3], y2_lo );
+   _mm_storeu_si128( ( __m128i * )lane[4], x0 );
+   _mm_storeu_si128( ( __m128i * )lane[5], x1 );
+
+   for ( l = 0; l < 4; l++ ) {
+      st[l]->y1_hi = lane[0][l];
+      st[l]->y1_lo = lane[1][l];
+      st[l]->y2_hi = lane[2][l];
+      st[l]->y2_lo = lane[3][l];
+      st[l]->x0 = lane[4][l];
+      st[l]->x1 = lane[5][l];
+   }
+}
+#endif
+
+
+/*
+ * Float_to_Word32
+ *
+ *
+ * Parameters:
+ *    x                 I: value
+ *    min               I: smallest result
+ *    max               I: largest result
+ *
+ * Function:
+ *    Rounds x to the nearest integer, limited to [min, max]
+ *
+ * Returns:
+ *    rounded value
+ */
+static Word32 Float_to_Word32( Float32 x, Word32 min, Word32 max )
+{
+   if ( x <= min )
+      return min;
+
+   if ( x >= max )
+      return max;
+   return ( Word32 )floor( x + 0.5F );
+}
+
+/*
+ * Residu40_float
+ *
+ *
+ * Parameters:
+ *    a                 I: prediction coefficients
+ *    x                 I: speech signal, M samples of history before it
+ *    y                 O: residual signal
+ *
+ * Function:
+ *    Residu40 of the floating point engine
+ *
+ * Returns:
+ *    void
+ */
+static void Residu40_float( const Float32 * RESTRICT a, const Float32 *
+      RESTRICT x, Float32 * RESTRICT y )
+{
+   Float32 s;
+   Word32 i, j;
+
+
+   for ( i = 0; i < L_SUBFR; i++ ) {
+      s = a[0] * x[i];
+
+      for ( j = 1; j <= M; j++ ) {
+         s += a[j] * x[i - j];
+      }
+      y[i] = s;
+   }
+}
+
+
+/*
+ * energy_float
+ *
+ *
+ * Parameters:
+ *    in                I: input vector of L_SUBFR samples
+ *
+ * Function:
+ *    Energy of the floating point engine, summed in four partial sums
+ *    as energy_float_sse2 sums it
+ *
+ * Returns:
+ *    energy
+ */
+static Float32 energy_float( const Float32 in[] )
+{
+   Float32 s[4] = { 0, 0, 0, 0 };
+   Word32 i, j;
+
+
+   for ( i = 0; i < L_SUBFR; i += 4 ) {
+      for ( j = 0; j < 4; j++ ) {
+         s[j] += in[i + j] * in[i + j];
+      }
+   }
+   return ( s[0] + s[2] ) + ( s[1] + s[3] );
+}
+#ifdef SP_DEC_SSE2
+
+
+/*
+ * Residu40_float_sse2
+ *
+ *
+ * Parameters:
+ *    a                 I: prediction coefficients
+ *    x                 I: speech signal, M samples of history before it
+ *    y                 O: residual signal
+ *
+ * Function:
+ *    Residu40_float with SSE2, four output samples at a time, each
+ *    summed in the same order as there
+ *
+ * Returns:
+ *    void
+ */
+static void Residu40_float_sse2( const Float32 * RESTRICT a, const Float32 *
+      RESTRICT x, Float32 * RESTRICT y )
+{
+   __m128 c[MP1], s;
+   Word32 i, j;
+
+
+   for ( j = 0; j <= M; j++ ) {
+      c[j] = _mm_set1_ps( a[j] );
+   }
+
+   for ( i = 0; i < L_SUBFR; i += 4 ) {
+      s = _mm_mul_ps( c[0], _mm_loadu_ps( &x[i] ) );
+
+      for ( j = 1; j <= M; j++ ) {
+         s = _mm_add_ps( s, _mm_mul_ps( c[j], _mm_loadu_ps( &x[i - j] ) ) );
+      }
+      _mm_storeu_ps( &y[i], s );
+   }
+}
+
+
+/*
+ * energy_float_sse2
+ *
+ *
+ * Parameters:
+ *    in                I: input vector of L_SUBFR samples
+ *
+ * Function:
+ *    energy_float with SSE2
+ *
+ * Returns:
+ *    energy
+ */
+static Float32 energy_float_sse2( const Float32 in[] )
+{
+   __m128 s, v;
+   Word32 i;
+
+
+   s = _mm_setzero_ps( );
+
+   for ( i = 0; i < L_SUBFR; i += 4 ) {
+      v = _mm_loadu_ps( &in[i] );
+      s = _mm_add_ps( s, _mm_mul_ps( v, v ) );
+   }
+
+   /* ( s[0] + s[2] ) + ( s[1] + s[3] ) */
+   s = _mm_add_ps( s, _mm_movehl_ps( s, s ) );
+   s = _mm_add_ss( s, _mm_shuffle_ps( s, s, _MM_SHUFFLE( 1, 1, 1, 1 ) ) );
+   return _mm_cvtss_f32( s );
+}
+#endif
+#ifdef SP_DEC_NEON
+
+
+/*
+ * Residu40_float_neon
+ *
+ *
+ * Parameters:
+ *    a                 I: prediction coefficients
+ *    x                 I: speech signal, M samples of history before it
+ *    y                 O: residual signal
+ *
+ * Function:
+ *    Residu40_float with NEON, four output samples at a time, each
+ *    summed in the same order as there. Products and sums are
+ *    separate, not fused, to round as there.
+ *
+ * Returns:
+ *    void
+ */
+static void Residu40_float_neon( const Float32 * RESTRICT a, const Float32 *
+      RESTRICT x, Float32 * RESTRICT y )
+{
+   float32x4_t s;
+   Word32 i, j;
+
+
+   for ( i = 0; i < L_SUBFR; i += 4 ) {
+      s = vmulq_n_f32( vld1q_f32( &x[i] ), a[0] );
+
+      for ( j = 1; j <= M; j++ ) {
+         s = vaddq_f32( s, vmulq_n_f32( vld1q_f32( &x[i - j] ), a[j] ) );
+      }
+      vst1q_f32( &y[i], s );
+   }
+}
+
+
+/*
+ * energy_float_neon
+ *
+ *
+ * Parameters:
+ *    in                I: input vector of L_SUBFR samples
+ *
+ * Function:
+ *    energy_float with NEON
+ *
+ * Returns:
+ *    energy
+ */
+static Float32 energy_float_neon( const Float32 in[] )
+{
+   float32x4_t s, v;
+   float32x2_t h;
+   Word32 i;
+
+
+   s = vdupq_n_f32( 0 );
+
+   for ( i = 0; i < L_SUBFR; i += 4 ) {
+      v = vld1q_f32( &in[i] );
+      s = vaddq_f32( s, vmulq_f32( v, v ) );
+   }
+
+   /* ( s[0] + s[2] ) + ( s[1] + s[3] ) */
+   h = vadd_f32( vget_low_f32( s ), vget_high_f32( s ) );
+   return vget_lane_f32( h, 0 ) + vget_lane_f32( h, 1 );
+}
+#endif
+
+
+/*
+ * Post_Filter_float
+ *
+ *
+ * Parameters:
+ *    st                B: post filter states, synthesis speech in
+ *                         st->synth_buf[M..]
+ *    mode              I: AMR mode
+ *    syn               O: post filtered speech, 16-bit scale
+ *    Az_4              I: interpolated LPC parameters in all subfr.
+ *    w                 -: work buffers
+ *
+ * Function:
+ *    Post_Filter of the floating point engine. Same filters, in single
+ *    precision, without the rounding and saturation of each step, so
+ *    output is close to that of Post_Filter but not the same. Memories
+ *    are the floating point ones of st, synth_buf is shared with
+ *    Post_Filter, as decoder synthesizes into it either way.
+ *
+ * Returns:
+ *    void
+ */
+static void Post_Filter_float( Post_FilterState *st, enum Mode mode, Float32
+      *syn, Word32 *Az_4, Speech_Decode_FrameScratch *w )
+{
+   Float32 *h = w->h_float, *Ap3 = w->Ap3_float, *Ap4 = w->Ap4_float;
+   Float32 *x = w->syn_float, *y = w->syn_pst_float, *res2 = w->res2_float;
+   Float32 r0, r1, mu, s, tmp, e_in, e_out, g0, gain;
+   const Float32 agc_fac = AGC_FAC * ( 1.0F / 32768.0F );
+   Word32 *Az, *syn_work = &st->synth_buf[M];
+   const Word32 *pgamma3 = &gamma3[0];
+   const Word32 *pgamma4 = &gamma4_gamma3_MR122[0];
+   Word32 i_subfr, i, j;
+
+
+   Az = Az_4;
+
+   if ( ( mode == MR122 ) || ( mode == MR102 ) ) {
+      pgamma3 = &gamma4_gamma3_MR122[0];
+      pgamma4 = &gamma4_MR122[0];
+   }
+
+   for ( i_subfr = 0; i_subfr < L_FRAME; i_subfr += L_SUBFR ) {
+      /* weighted filter coefficients, Az in Q12, gammas in Q15 */
+      Ap3[0] = Az[0] * ( 1.0F / 4096.0F );
+      Ap4[0] = Ap3[0];
+
+      for ( i = 1; i <= M; i++ ) {
+         Ap3[i] = ( Float32 )( Az[i] * pgamma3[i - 1] ) * ( 1.0F / 134217728.0F );
+         Ap4[i] = ( Float32 )( Az[i] * pgamma4[i - 1] ) * ( 1.0F / 134217728.0F );
+      }
+
+      /* filtering of synthesis speech by A(z/0.7) to find res2[] */
+      for ( i = 0; i < M + L_SUBFR; i++ ) {
+         x[i] = ( Float32 )syn_work[i_subfr - M + i];
+      }
+      KERNELS->residu40_float( Ap3, &x[M], res2 );
+
+      /* tilt compensation filter */
+      /* impulse response of A(z/0.7)/A(z/0.75) */
+      for ( i = 0; i < 22; i++ ) {
+         s = i <= M ? Ap4[0] * Ap3[i] : 0;
+
+         for ( j = 1; j <= M && j <= i; j++ ) {
+            s -= Ap4[j] * h[i - j];
+         }
+         h[i] = s;
+      }
+      r0 = h[0] * h[0];
+      r1 = 0;
+
+      for ( i = 1; i < 22; i++ ) {
+         r0 += h[i] * h[i];
+         r1 += h[i - 1] * h[i];
+      }
+      mu = r1 > 0 ? 0.8F * r1 / r0 : 0;
+
+      /* preemphasis */
+      tmp = res2[L_SUBFR - 1];
+
+      for ( i = L_SUBFR - 1; i > 0; i-- ) {
+         res2[i] -= mu * res2[i - 1];
+      }
+      res2[0] -= mu * st->preemph_mem_pre_float;
+      st->preemph_mem_pre_float = tmp;
+
+      /*
+       * filtering through  1/A(z/0.75), memory in front of the output;
+       * saturated to 16 bits as in Syn_filt, quantized filters are not
+       * always stable
+       */
+      memcpy( y, st->mem_syn_pst_float, M * sizeof( Float32 ) );
+
+      for ( i = M; i < M + L_SUBFR; i++ ) {
+         s = Ap4[0] * res2[i - M];
+
+         for ( j = 1; j <= M; j++ ) {
+            s -= Ap4[j] * y[i - j];
+         }
+         y[i] = s > 32767.0F ? 32767.0F : s < -32768.0F ? -32768.0F : s;
+      }
+      memcpy( st->mem_syn_pst_float, &y[L_SUBFR], M * sizeof( Float32 ) );
+
+      /*
+       * scale output to input, as agc does:
+       * gain[n] = agc_fac * gain[n-1] + (1-agc_fac) * sqrt(e_in/e_out)
+       */
+      e_out = KERNELS->energy_float( &y[M] );
+
+      if ( e_out == 0 ) {
+         st->past_gain_float = 0;
+         memcpy( &syn[i_subfr], &y[M], L_SUBFR * sizeof( Float32 ) );
+      }
+      else {
+         e_in = KERNELS->energy_float( &x[M] );
+         /* square root limited to 8, as in Q12 of agc */
+         g0 = e_in < 64.0F * e_out ? ( Float32 )sqrt( e_in / e_out ) : 8.0F;
+         g0 *= 1.0F - agc_fac;
+         gain = st->past_gain_float;
+
+         for ( i = 0; i < L_SUBFR; i++ ) {
+            gain = gain * agc_fac + g0;
+            s = y[M + i] * gain;
+            syn[i_subfr + i] = s > 32767.0F ? 32767.0F : s < -32768.0F ?
+                  -32768.0F : s;
+         }
+         st->past_gain_float = gain;
+      }
+      Az += MP1;
+   }
+
+   /* update syn_work[] buffer */
+   memcpy( &syn_work[- M], &syn_work[L_FRAME - M], M * sizeof( Word32 ) );
+   return;
+}
+
+
+/*
+ * Post_Filter_bypass
+ *
+ *
+ * Parameters:
+ *    st                B: post filter states, synthesis speech in
+ *                         st->synth_buf[M..]
+ *    syn               O: synthesis speech, 16-bit scale
+ *
+ * Function:
+ *    Post_Filter of the bypass engine: synthesis speech goes to
+ *    Post_Process_float as it is. Formant and tilt filters and adaptive
+ *    gain control only make speech sound better, so output analysed by
+ *    machines does without them. Last samples are kept in synth_buf as
+ *    Post_Filter keeps them, so the engine can be changed after.
+ *
+ * Returns:
+ *    void
+ */
+static void Post_Filter_bypass( Post_FilterState *st, Float32 *syn )
+{
+   Word32 *syn_work = &st->synth_buf[M];
+   Word32 i;
+
+
+   for ( i = 0; i < L_FRAME; i++ )
+      syn[i] = ( Float32 )syn_work[i];
+
+   /* update syn_work[] buffer */
+   memcpy( &syn_work[- M], &syn_work[L_FRAME - M], M * sizeof( Word32 ) );
+}
+
+
+/*
+ * Post_Process_float
+ *
+ *
+ * Parameters:
+ *    st                B: post filter states
+ *    signal            B: signal, 16-bit scale
+ *    synth             O: output speech, or NULL
+ *    synth_float       O: output speech as floating point, or NULL
+ *    stride            I: distance of output samples in the buffer
+ *    scale             I: floating point output of a 16-bit sample
+ *
+ * Function:
+ *    Post_Process of the floating point engine: the same high pass
+ *    filter and multiplication by two, in single precision. Floating
+ *    point output is not truncated to 13 bits, 16-bit output is rounded
+ *    and truncated as in Post_Process. Expanded into callers, as
+ *    Post_Process is.
+ *
+ * Returns:
+ *    void
+ */
+static FORCE_INLINE void Post_Process_float( Post_ProcessState *st, Float32
+      signal[], Word16 synth[], Float32 synth_float[], Word32 stride, Float32
+      scale )
+{
+   Float32 x2, y;
+   Word32 i, out;
+
+
+   for ( i = 0; i < L_FRAME; i++ ) {
+      x2 = st->x1_float;
+      st->x1_float = st->x0_float;
+      st->x0_float = signal[i];
+
+      /* coefficients of Post_Process, in Q13 */
+      y = ( 15836.0F * st->y1_float - 7667.0F * st->y2_float + 7699.0F * (
+            st->x0_float + x2 ) - 15398.0F * st->x1_float ) * ( 1.0F / 8192.0F
+            );
+      /* memory and output saturated as in Post_Process */
+      y = y > 32767.0F ? 32767.0F : y < -32768.0F ? -32768.0F : y;
+      st->y2_float = st->y1_float;
+      st->y1_float = y;
+      y = y > 16383.5F ? 32767.0F : y < -16384.0F ? -32768.0F : y * 2;
+      signal[i] = y;
+
+      if ( synth_float != NULL ) {
+         synth_float[i * stride] = y * scale;
+      }
+      else {
+         out = Float_to_Word32( y, -32768, 32767 );
+#ifndef NO13BIT
+         /* Truncate to 13 bits */
+         out &= 0xfffffff8;
+#endif
+         synth[i * stride] = ( Word16 )out;
+      }
+   }
+}
+
+
+/*
+ * Post_float_load
+ *
+ *
+ * Parameters:
+ *    f                 B: post filter states
+ *    agc               I: gain memory of f
+ *    p                 B: post process states
+ *
+ * Function:
+ *    Sets memories of the floating point engine to values of the fixed
+ *    point ones, so decoding goes on from where they are
+ *
+ * Returns:
+ *    void
+ */
+static void Post_float_load( Post_FilterState *f, const agcState *agc,
+      Post_ProcessState *p )
+{
+   Word32 i;
+
+
+   for ( i = 0; i < M; i++ ) {
+      f->mem_syn_pst_float[i] = ( Float32 )f->mem_syn_pst[i];
+   }
+   f->preemph_mem_pre_float = ( Float32 )f->preemph_state_mem_pre;
+   f->past_gain_float = agc->past_gain * ( 1.0F / 4096.0F );
+   p->y2_float = p->y2_hi + p->y2_lo * ( 1.0F / 32768.0F );
+   p->y1_float = p->y1_hi + p->y1_lo * ( 1.0F / 32768.0F );
+   p->x0_float = ( Float32 )p->x0;
+   p->x1_float = ( Float32 )p->x1;
+}
+
+
+/*
+ * Post_float_store
+ *
+ *
+ * Parameters:
+ *    f                 B: post filter states
+ *    agc               O: gain memory of f
+ *    p                 B: post process states
+ *
+ * Function:
+ *    Sets memories of the fixed point engine to the nearest values of
+ *    the floating point ones, in the ranges fixed point engine keeps
+ *    them in
+ *
+ * Returns:
+ *    void
+ */
+static void Post_float_store( Post_FilterState *f, agcState *agc,
+      Post_ProcessState *p )
+{
+   Word32 i;
+
+
+   for ( i = 0; i < M; i++ ) {
+      f->mem_syn_pst[i] = Float_to_Word32( f->mem_syn_pst_float[i], -32768,
+            32767 );
+   }
+   f->preemph_state_mem_pre = Float_to_Word32( f->preemph_mem_pre_float, -32768,
+         32767 );
+   agc->past_gain = Float_to_Word32( f->past_gain_float * 4096.0F, 0, 32767 );
+   p->y2_hi = Float_to_Word32( p->y2_float * 32768.0F, -1073741824, 1073741823 );
+   p->y2_lo = p->y2_hi - ( p->y2_hi >> 15 ) * 32768;
+   p->y2_hi >>= 15;
+   p->y1_hi = Float_to_Word32( p->y1_float * 32768.0F, -1073741824, 1073741823 );
+   p->y1_lo = p->y1_hi - ( p->y1_hi >> 15 ) * 32768;
+   p->y1_hi >>= 15;
+   p->x0 = Float_to_Word32( p->x0_float, -32768, 32767 );
+   p->x1 = Float_to_Word32( p->x1_float, -32768, 32767 );
+}
+
+
+/*
+ * Post_float_clear
+ *
+ *
+ * Parameters:
+ *    f                 B: post filter states
+ *    p                 B: post process states
+ *
+ * Function:
+ *    Clears memories of the floating point engine, so states that differ
+ *    only in them compare equal
+ *
+ * Returns:
+ *    void
+ */
+static void Post_float_clear( Post_FilterState *f, Post_ProcessState *p )
+{
+   memset( f->mem_syn_pst_float, 0, M * sizeof( Float32 ) );
+   f->preemph_mem_pre_float = 0;
+   f->past_gain_float = 0;
+   p->y2_float = 0;
+   p->y1_float = 0;
+   p->x0_float = 0;
+   p->x1_float = 0;
+}
+
+
+/*
+ * Silent_NO_DATA
+ *
+ *
+ * Parameters:
+ *    st                B: state structure
+ *
+ * Function:
+ *    Does to the state what decoding of NO_DATA frame does once comfort
+ *    noise is muted for good: DTX state machine takes a step and noise
+ *    generator is advanced as dtx_dec advances it. All other state, and
+ *    output, which is zero, would stay the same.
+ *
+ * Returns:
+ *    void
+ */
+static void Silent_NO_DATA( Decoder_amrState *st )
+{
+   Word32 ex[L_SUBFR];
+   Word32 i;
+
+
+   st->dtxDecoderState->dtxGlobalState = rx_dtx_handler( st->dtxDecoderState,
+         RX_NO_DATA );
+   pseudonoise( &st->dtxDecoderState->pn_seed_rx, 3 );
+
+   for ( i = 0; i < 4; i++ ) {
+      Build_CN_code( &st->dtxDecoderState->pn_seed_rx, ex );
+   }
+
+   /* reset in dtx_dec when muting */
+   st->dtxDecoderState->since_last_sid = 0;
+}
+
+
+/*
+ * Speech_Decode_Frame_filter
+ *
+ *
+ * Parameters:
+ *    st                B: decoder memory
+ *    mode              I: AMR mode
+ *    parm              I: speech parameters
+ *    frame_type        I: Frame type
+ *    check             O: frame is to be checked for muted comfort noise
+ *                         by Speech_Decode_Frame_mute once it is output
+
+ * Function:
+ *    First part of Speech_Decode_Frame_synth: synthesis and post
+ *    filtering, into scratch->synth_speech, or scratch->synth_float of
+ *    the floating point engine, for Post_Process.
+ *
+ * Returns:
+ *    1 if frame was skipped, output is silence, 0 otherwise
+ */
+static FORCE_INLINE Word32 Speech_Decode_Frame_filter( void *st, enum Mode
+      mode, Word16 *parm, enum RXFrameType frame_type, Word32 *check )
+{
+   Speech_Decode_FrameState *s = ( Speech_Decode_FrameState * ) st;
+   Speech_Decode_FrameScratch *w = s->scratch;
+#ifdef DEC_PROFILE
+   unsigned long long t0, t1;
+
+
+   s->profile.frames[DEC_PROFILE_MODE( mode )][frame_type]++;
+#endif
+
+   *check = 0;
+
+   if ( ( frame_type == RX_NO_DATA ) & ( mode == s->silent_mode ) & ( s->silent
+         != 0 ) ) {
+      Silent_NO_DATA( s->decoder_amrState );
+      return 1;
+   }
+   s->silent = 0;
+
+#ifndef DEC_SMALL
+   /* cheap preconditions first, comparing whole state is not */
+   *check = ( frame_type == RX_NO_DATA ) & ( s->decoder_amrState->
+         dtxDecoderState->dtxGlobalState == DTX_MUTE ) & ( s->decoder_amrState->
+         dtxDecoderState->log_en == -32768 );
+
+   if ( *check )
+      Speech_Decode_Frame_snapshot( st, &w->before );
+#endif
+
+#ifdef DEC_PROFILE
+   t0 = Speech_Decode_Frame_cycles( );
+#endif
+
+   /* Synthesis, into the post filter buffer */
+   DEC_TRACE_BEGIN( "Decoder_amr" );
+   Decoder_amr( s->decoder_amrState, mode, parm, frame_type, &s->post_state->
+         synth_buf[M], w->Az_dec, w );
+   DEC_TRACE_END( "Decoder_amr" );
+#ifdef DEC_PROFILE
+   t1 = Speech_Decode_Frame_cycles( );
+   s->profile.cycles[DEC_PROFILE_MODE( mode )][frame_type][
+         STAGE_DECODER_AMR] += t1 - t0;
+#endif
+   DEC_TRACE_BEGIN( "Post_Filter" );
+   if ( s->engine == SP_DEC_ENGINE_FLOAT )
+      Post_Filter_float( s->post_state, mode, w->synth_float, w->Az_dec, w );
+   else if ( s->engine == SP_DEC_ENGINE_BYPASS )
+      Post_Filter_bypass( s->post_state, w->synth_float );
+   else
+      Post_Filter( s->post_state, mode, w->synth_speech, w->Az_dec, w );
+   DEC_TRACE_END( "Post_Filter" );
+#ifdef DEC_PROFILE
+   s->profile.cycles[DEC_PROFILE_MODE( mode )][frame_type][
+         STAGE_POST_FILTER] += Speech_Decode_Frame_cycles( ) - t1;
+#endif
+   return 0;
+}
+
+
+/*
+ * Speech_Decode_Frame_mute
+ *
+ *
+ * Parameters:
+ *    st                B: decoder memory
+ *    mode              I: AMR mode
+
+ * Function:
+ *    Last part of Speech_Decode_Frame_synth, for frames
+ *    Speech_Decode_Frame_filter asked to check, after Post_Process.
+ *
+ *    Long runs of NO_DATA frames mute comfort noise to no output at all.
+ *    Whether decoder got to the point it only repeats itself is checked on
+ *    muted NO_DATA frames: state must be the same after the frame as before,
+ *    except for the noise generator, and output zero. The generator picks
+ *    excitation and synthesis filter, so excitation level and synthesis
+ *    filter memory must be zero too, then it does not matter. Following
+ *    NO_DATA frames of the same mode skip synthesis, see Silent_NO_DATA.
+ *    DEC_SMALL builds have no room for the two copies of state and
+ *    synthesize every frame.
+ *
+ * Returns:
+ *    void
+ */
+static void Speech_Decode_Frame_mute( void *st, enum Mode mode )
+{
+#ifndef DEC_SMALL
+   Speech_Decode_FrameState *s = ( Speech_Decode_FrameState * ) st;
+   Speech_Decode_FrameScratch *w = s->scratch;
+   Word32 i;
+
+
+   if ( s->decoder_amrState->dtxDecoderState->cn_level != 0 )
+      return;
+
+   if ( s->engine != SP_DEC_ENGINE_FIXED ) {
+      /* floating point output is silence if it rounds to it */
+      for ( i = 0; i < L_FRAME; i++ ) {
+         if ( w->synth_float[i] >= 0.5F || w->synth_float[i] <= -0.5F )
+            return;
+      }
+   }
+   else {
+      for ( i = 0; i < L_FRAME; i++ ) {
+         if ( w->synth_speech[i] != 0 )
+            return;
+      }
+   }
+   for ( i = 0; i < M; i++ ) {
+      if ( w->before.decoder_amr.mem_syn[i] != 0 )
+         return;
+   }
+   Speech_Decode_Frame_snapshot( st, &w->after );
+   w->before.dtx.pn_seed_rx = w->after.dtx.pn_seed_rx;
+
+   if ( memcmp( &w->before, &w->after, sizeof( Speech_Decode_FrameArena ) ) == 0 ) {
+      s->silent = 1;
+      s->silent_mode = mode;
+   }
+#else
+   ( void )st;
+   ( void )mode;
+#endif
+}
+
+
+/*
+ * Speech_Decode_Frame_synth
+ *
+ *
+ * Parameters:
+ *    st                B: decoder memory
+ *    mode              I: AMR mode
+ *    parm              I: speech parameters
+ *    frame_type        I: Frame type
+ *    synth             O: output speech, or NULL
+ *    synth_float       O: output speech as floating point, or NULL
+ *    stride            I: distance of output samples in the buffer
+
+ * Function:
+ *    Decode one frame, to whichever output buffer is given. Expanded
+ *    into callers, so output format is a constant of each copy. Post
+ *    filtering is done by the engine set, see
+ *    Speech_Decode_Frame_set_engine. Muted comfort noise is not
+ *    synthesized, see Speech_Decode_Frame_mute.
+ *
+ * Returns:
+ *    1 if frame was skipped, output is silence and was not written,
+ *    0 otherwise
+ */
+static FORCE_INLINE Word32 Speech_Decode_Frame_synth( void *st, enum Mode mode,
+      Word16 *parm, enum RXFrameType frame_type, Word16 synth[], Float32
+      synth_float[], Word32 stride )
+{
+   Speech_Decode_FrameState *s = ( Speech_Decode_FrameState * ) st;
+   Speech_Decode_FrameScratch *w = s->scratch;
+   Word32 check;
+#ifdef DEC_PROFILE
+   unsigned long long t0;
+#endif
+
+
+   if ( Speech_Decode_Frame_filter( st, mode, parm, frame_type, &check ) )
+      return 1;
+#ifdef DEC_PROFILE
+   t0 = Speech_Decode_Frame_cycles( );
+#endif
+
+   /* post HP filter, and 15->16 bits, to output */
+   DEC_TRACE_BEGIN( "Post_Process" );
+   if ( s->engine != SP_DEC_ENGINE_FIXED )
+      Post_Process_float( s->postHP_state, w->synth_float, synth, synth_float,
+            stride, s->out_scale );
+   else
+      Post_Process( s->postHP_state, w->synth_speech, synth, synth_float,
+            stride, s->out_scale );
+   DEC_TRACE_END( "Post_Process" );
+#ifdef DEC_PROFILE
+   s->profile.cycles[DEC_PROFILE_MODE( mode )][frame_type][
+         STAGE_POST_PROCESS] += Speech_Decode_Frame_cycles( ) - t0;
+#endif
+
+   if ( check )
+      Speech_Decode_Frame_mute( st, mode );
+   return 0;
+}
+
+
+/*
+ * Speech_Decode_Frame
+ *
+ *
+ * Parameters:
+ *    st                B: decoder memory
+ *    mode              I: AMR mode
+ *    parm              I: speech parameters
+ *    frame_type        I: Frame type
+ *    synth             O: synthesis speech
+
+ * Function:
+ *    Decode one frame
+ *
+ * Returns:
+ *    void
+ */
+void Speech_Decode_Frame( void *st, enum Mode mode, Word16 *parm, enum
+      RXFrameType frame_type, Word16 *synth )
+{
+   if ( Speech_Decode_Frame_synth( st, mode, parm, frame_type, synth, NULL, 1 ) )
+      memset( synth, 0, L_FRAME * sizeof( Word16 ) );
+   return;
+}
+
+
+/*
+ * Speech_Decode_Frame_float
+ *
+ *
+ * Parameters:
+ *    st                B: decoder memory
+ *    mode              I: AMR mode
+ *    parm              I: speech parameters
+ *    frame_type        I: Frame type
+ *    synth             O: synthesis speech, scaled to [-1, 1)
+
+ * Function:
+ *    Decode one frame to floating point samples. Output of the fixed
+ *    point engine equals Speech_Decode_Frame output divided by 32768,
+ *    times the gain set, see Speech_Decode_Frame_set_gain.
+ *
+ * Returns:
+ *    void
+ */
+void Speech_Decode_Frame_float( void *st, enum Mode mode, Word16 *parm, enum
+      RXFrameType frame_type, Float32 *synth )
+{
+   if ( Speech_Decode_Frame_synth( st, mode, parm, frame_type, NULL, synth, 1 ) )
+      memset( synth, 0, L_FRAME * sizeof( Float32 ) );
+   return;
+}
+
+
+/*
+ * Speech_Decode_Frame_float_stride
+ *
+ *
+ * Parameters:
+ *    st                B: decoder memory
+ *    mode              I: AMR mode
+ *    parm              I: speech parameters
+ *    frame_type        I: Frame type
+ *    synth             O: synthesis speech, scaled to [-1, 1)
+ *    stride            I: distance of output samples in synth
+
+ * Function:
+ *    Same as Speech_Decode_Frame_float, storing every stride-th sample,
+ *    so decoders of several channels write interleaved output together
+ *
+ * Returns:
+ *    void
+ */
+void Speech_Decode_Frame_float_stride( void *st, enum Mode mode, Word16 *parm,
+      enum RXFrameType frame_type, Float32 *synth, int stride )
+{
+   Word32 i;
+
+   if ( Speech_Decode_Frame_synth( st, mode, parm, frame_type, NULL, synth,
+         stride ) ) {
+      for ( i = 0; i < L_FRAME; i++ )
+         synth[i * stride] = 0;
+   }
+   return;
+}
+
+
+/*
+ * Speech_Decode_Frame_group_float
+ *
+ *
+ * Parameters:
+ *    st                B: decoder memory of each stream
+ *    count             I: streams
+ *    mode              I: AMR mode of each
+ *    parm              I: speech parameters of each
+ *    frame_type        I: Frame type of each
+ *    synth             O: synthesis speech of each, scaled to [-1, 1)
+ *    stride            I: distance of output samples in synth
+
+ * Function:
+ *    Same as Speech_Decode_Frame_float_stride of each stream in turn.
+ *    Streams are independent, so the fixed point engine filters them up
+ *    to synthesis and post filter one by one, then runs Post_Process of
+ *    four streams at a time, one in each lane. Synthesis and post filter
+ *    stay per stream, as the branches they take depend on the frame.
+ *
+ * Returns:
+ *    void
+ */
+void Speech_Decode_Frame_group_float( void *st[], int count, enum Mode mode[],
+      Word16 *parm[], enum RXFrameType frame_type[], Float32 *synth[], int
+      stride )
+{
+   Speech_Decode_FrameState *s;
+   Post_ProcessState *hp[4];
+   Word32 *signal[4];
+   Float32 *out[4];
+   Float32 scale[4];
+   Word32 lane[4], check[4];
+   Word32 i, l, n = 0, k = 0;
+#ifdef DEC_PROFILE
+   unsigned long long t0;
+#endif
+
+
+   for ( l = 0; l < count; l++ ) {
+      s = ( Speech_Decode_FrameState * ) st[l];
+
+      if ( s->engine != SP_DEC_ENGINE_FIXED ) {
+         Speech_Decode_Frame_float_stride( st[l], mode[l], parm[l], frame_type[l],
+               synth[l], stride );
+      }
+      else if ( Speech_Decode_Frame_filter( st[l], mode[l], parm[l], frame_type[l],
+            &check[n] ) ) {
+         for ( i = 0; i < L_FRAME; i++ )
+            synth[l][i * stride] = 0;
+      }
+      else {
+         lane[n] = l;
+         hp[n] = s->postHP_state;
+         signal[n] = s->scratch->synth_speech;
+         scale[n] = s->out_scale;
+         out[n++] = synth[l];
+      }
+
+      /* last lanes of the group are filtered one by one */
+      if ( n == 4 || ( l == count - 1 && n > 0 ) ) {
+#ifdef DEC_PROFILE
+         t0 = Speech_Decode_Frame_cycles( );
+#endif
+         DEC_TRACE_BEGIN( "Post_Process" );
+         if ( n == 4 )
+            KERNELS->post_process4( hp, signal, out, stride, scale );
+         else {
+            for ( k = 0; k < n; k++ )
+               Post_Process( hp[k], signal[k], NULL, out[k], stride, scale[k] );
+         }
+         DEC_TRACE_END( "Post_Process" );
+#ifdef DEC_PROFILE
+         t0 = ( Speech_Decode_Frame_cycles( ) - t0 ) / n;
+#endif
+
+         for ( k = 0; k < n; k++ ) {
+#ifdef DEC_PROFILE
+            ( ( Speech_Decode_FrameState * ) st[lane[k]] )->profile.cycles[
+                  DEC_PROFILE_MODE( mode[lane[k]] )][frame_type[lane[k]]][
+                  STAGE_POST_PROCESS] += t0;
+#endif
+            if ( check[k] )
+               Speech_Decode_Frame_mute( st[lane[k]], mode[lane[k]] );
+         }
+         n = 0;
+      }
+   }
+   return;
+}
+
+
+/*
+ * Speech_Decode_Frame_warmup
+ *
+ *
+ * Parameters:
+ *    st                B: decoder memory
+ *    mode              I: AMR mode
+ *    parm              I: speech parameters
+ *    frame_type        I: Frame type
+
+ * Function:
+ *    Decode one frame whose output is thrown away, such as frames
+ *    decoded before seek target. Decoder_amr runs as for any frame, so
+ *    predictors, LSPs, excitation and synthesis filter memory are what
+ *    decoding leaves; post filter and Post_Process are skipped, except
+ *    for the last samples of synthesis post filter keeps. Their short
+ *    memories are left as they were, and settle within a frame or two
+ *    decoded in full after. Comfort noise is not checked for muting.
+ *
+ * Returns:
+ *    void
+ */
+void Speech_Decode_Frame_warmup( void *st, enum Mode mode, Word16 *parm, enum
+      RXFrameType frame_type )
+{
+   Speech_Decode_FrameState *s = ( Speech_Decode_FrameState * ) st;
+   Word32 *syn_work = &s->post_state->synth_buf[M];
+
+
+   if ( ( frame_type == RX_NO_DATA ) & ( mode == s->silent_mode ) & ( s->silent
+         != 0 ) ) {
+      Silent_NO_DATA( s->decoder_amrState );
+      return;
+   }
+   s->silent = 0;
+   Decoder_amr( s->decoder_amrState, mode, parm, frame_type, syn_work, s->
+         scratch->Az_dec, s->scratch );
+
+   /* update syn_work[] buffer */
+   memcpy( &syn_work[- M], &syn_work[L_FRAME - M], M * sizeof( Word32 ) );
+   return;
+}
+
+
+/*
+ * Speech_Decode_Frame_prefetch
+ *
+ *
+ * Parameters:
+ *    mode              I: AMR mode
+ *    parm              I: speech parameters
+ *    frame_type        I: Frame type
+ *
+ * Function:
+ *    Bring in the rows of the ROM tables that parameters of a good speech
+ *    frame pick: LSF split VQ codebooks, and gain quantizer tables of
+ *    each subframe. Tables are tens of kilobytes, and decoding hits one
+ *    row of each here and there, so rows are mostly out of cache when
+ *    many streams are decoded; called as soon as the frame is unpacked,
+ *    or while the frame before is synthesized, loads overlap that work
+ *    rather than stall D_plsf_3, D_plsf_5 and the gain decoding. Only a
+ *    hint: nothing is read, and other frames are left alone
+ *
+ * Returns:
+ *    void
+ */
+void Speech_Decode_Frame_prefetch( enum Mode mode, const Word16 *parm, enum
+      RXFrameType frame_type )
+{
+   const Word16 *p_cb1, *p_cb3;
+   Word32 i, index;
+
+
+   if ( ( ( frame_type != RX_SPEECH_GOOD ) & ( frame_type !=
+         RX_SPEECH_DEGRADED ) ) | ( mode >= MRDTX ) )
+      return;
+
+   if ( mode == MR122 ) {
+      PREFETCH( &dico1_lsf_5[parm[0] << 2] );
+      PREFETCH( &dico2_lsf_5[parm[1] << 2] );
+      PREFETCH( &dico3_lsf_5[( parm[2] >> 1 ) << 2] );
+      PREFETCH( &dico4_lsf_5[parm[3] << 2] );
+      PREFETCH( &dico5_lsf_5[parm[4] << 2] );
+
+      /* subframe is lag, pitch gain, 10 pulses and code gain */
+      PREFETCH( qua_gain_pitch );
+
+      for ( i = 5; i < 57; i += 13 )
+         PREFETCH( &qua_gain_code[parm[i + 12] * 3] );
+      return;
+   }
+
+   /* codebooks as D_plsf_3 picks them */
+   index = parm[1];
+
+   if ( ( mode == MR475 ) | ( mode == MR515 ) ) {
+      p_cb1 = dico1_lsf_3;
+      p_cb3 = mr515_3_lsf;
+      index = index << 1;
+   }
+   else if ( mode == MR795 ) {
+      p_cb1 = mr795_1_lsf;
+      p_cb3 = dico3_lsf_3;
+   }
+   else {
+      p_cb1 = dico1_lsf_3;
+      p_cb3 = dico3_lsf_3;
+   }
+   PREFETCH( &p_cb1[parm[0] * 3] );
+   PREFETCH( &dico2_lsf_3[index * 3] );
+   PREFETCH( &p_cb3[parm[2] << 2] );
+
+   /* gain indices, where Decoder_amr_mode reads them */
+   switch ( mode ) {
+      case MR475:
+         /* lag, pulses and sign, with joint gains of two subframes first */
+         PREFETCH( &table_gain_MR475[parm[6] << 2] );
+         PREFETCH( &table_gain_MR475[parm[13] << 2] );
+         break;
+
+      case MR515:
+      case MR59:
+         /* lag, pulses, sign and gains */
+         for ( i = 3; i < 19; i += 4 )
+            PREFETCH( &table_gain_lowrates[parm[i + 3] << 2] );
+         break;
+
+      case MR67:
+      case MR74:
+         for ( i = 3; i < 19; i += 4 )
+            PREFETCH( &table_gain_highrates[parm[i + 3] << 2] );
+         break;
+
+      case MR795:
+         /* lag, pulses, sign, pitch gain and code gain */
+         PREFETCH( qua_gain_pitch );
+
+         for ( i = 3; i < 23; i += 5 )
+            PREFETCH( &qua_gain_code[parm[i + 4] * 3] );
+         break;
+
+      default:
+         /* MR102: lag, 7 pulse indices and gains */
+         for ( i = 3; i < 39; i += 9 )
+            PREFETCH( &table_gain_highrates[parm[i + 8] << 2] );
+         break;
+   }
+}
+
+/*
+ * Decoder_amr_estimate
+ *
+ *
+ * Parameters:
+ *    st                B: State variables
+ *    mode              I: AMR mode
+ *    parm              I: vector of synthesis parameters
+ *    exc_energy        B: excitation energy of the previous subframe
+ *
+ * Function:
+ *    Energy of a good speech frame from its parameters alone, without
+ *    excitation, synthesis or post filtering. LSFs and pitch lags are
+ *    decoded, and codebook vectors, which gain prediction needs, then
+ *    excitation energy of each subframe is taken as that of the scaled
+ *    codebook vector plus that of the previous subframe scaled by pitch
+ *    gain, and interpolated synthesis filter of the subframe multiplies
+ *    it by the energy of its impulse response. Only LSF and gain
+ *    predictors, LSPs, pitch lag and sharpening are updated, so the
+ *    state is fit for nothing but further estimates
+ *
+ * Returns:
+ *    energy of synthesis speech, sum of squares of the frame
+ */
+static Float32 Decoder_amr_estimate( Decoder_amrState *st, enum Mode mode,
+      Word16 parm[], Float32 *exc_energy )
+{
+   Word32 lsp_new[M], lsp_mid[M], A_t[AZ_SIZE];
+   Word32 code[L_SUBFR];
+   Word32 i, k, i_subfr, subfrNr, evenSubfr, index, pit_flag, first;
+   Word32 T0, T0_frac, t0_min, t0_max, temp, pit_sharp, gain_pit, gain_code;
+   Word32 index_mr475 = 0, flag4, delta_frc_low, delta_frc_range, code_shift;
+   Float32 h[32], lpc_gain, energy, code_energy, gain, s;
+
+
+   if ( mode != MR122 ) {
+      D_plsf_3( st->lsfState, mode, 0, parm, lsp_new );
+      parm += 3;
+      Int_lpc_1to3( st->lsp_old, lsp_new, A_t );
+   }
+   else {
+      D_plsf_5( st->lsfState, 0, parm, lsp_mid, lsp_new );
+      parm += 5;
+      Int_lpc_1and3( st->lsp_old, lsp_mid, lsp_new, A_t );
+   }
+   memcpy( st->lsp_old, lsp_new, M * sizeof( Word32 ) );
+
+   /* codebook term of excitation is code * gain_code >> code_shift */
+   code_shift = ( mode == MR122 ) ? 13 : 14;
+   flag4 = ( mode == MR475 ) || ( mode == MR515 ) || ( mode == MR59 ) || (
+         mode == MR67 );
+   delta_frc_low = ( mode == MR795 ) ? 10 : 5;
+   delta_frc_range = ( mode == MR795 ) ? 19 : 9;
+   energy = 0;
+   evenSubfr = 0;
+   subfrNr = -1;
+
+   for ( i_subfr = 0; i_subfr < L_FRAME; i_subfr += L_SUBFR ) {
+      subfrNr += 1;
+      evenSubfr = 1 - evenSubfr;
+      pit_flag = i_subfr;
+
+      if ( ( i_subfr == L_FRAME_BY2 ) & ( mode != MR475 ) & ( mode != MR515 ) )
+         pit_flag = 0;
+      index = *parm++;
+
+      if ( mode != MR122 ) {
+         t0_min = st->old_T0 - delta_frc_low;
+
+         if ( t0_min < PIT_MIN )
+            t0_min = PIT_MIN;
+         t0_max = t0_min + delta_frc_range;
+
+         if ( t0_max > PIT_MAX ) {
+            t0_max = PIT_MAX;
+            t0_min = t0_max - delta_frc_range;
+         }
+         Dec_lag3( index, t0_min, t0_max, pit_flag, st->old_T0, &T0, &T0_frac,
+               flag4 );
+      }
+      else {
+         Dec_lag6( index, PIT_MIN_MR122, PIT_MAX, pit_flag, &T0, &T0_frac );
+
+         if ( ( pit_flag != 0 ) & ( index > 60 ) )
+            T0 = st->old_T0;
+      }
+
+      /* codebook vector, with pitch sharpening as decoder has it */
+      gain_pit = 0;
+      pit_sharp = st->sharp << 1;
+
+      if ( ( mode == MR475 ) || ( mode == MR515 ) ) {
+         index = *parm++;
+         i = *parm++;
+         first = decode_2i40_9bits( subfrNr, i, index, code );
+      }
+      else if ( mode == MR59 ) {
+         index = *parm++;
+         i = *parm++;
+         first = decode_2i40_11bits( i, index, code );
+      }
+      else if ( mode == MR67 ) {
+         index = *parm++;
+         i = *parm++;
+         first = decode_3i40_14bits( i, index, code );
+      }
+      else if ( mode <= MR795 ) {
+         index = *parm++;
+         i = *parm++;
+         first = decode_4i40_17bits( i, index, code );
+      }
+      else if ( mode == MR102 ) {
+         first = decode_8i40_31bits( parm, code );
+         parm += 7;
+      }
+      else {
+         gain_pit = d_gain_pitch( mode, *parm++ );
+         first = decode_10i40_35bits( parm, code );
+         parm += 10;
+         pit_sharp = gain_pit > 16383 ? 32767 : gain_pit * 2;
+      }
+
+      for ( i = first + T0; i < L_SUBFR; i++ ) {
+         temp = ( code[i - T0] * pit_sharp ) >> 15;
+         code[i] = code[i] + temp;
+      }
+
+      /* gains, and pitch sharpening for the next subframe */
+      if ( mode == MR475 ) {
+         if ( evenSubfr != 0 )
+            index_mr475 = *parm++;
+         Dec_gain( st->pred_state, mode, index_mr475, code, evenSubfr, &
+               gain_pit, &gain_code );
+      }
+      else if ( ( mode <= MR74 ) || ( mode == MR102 ) ) {
+         Dec_gain( st->pred_state, mode, *parm++, code, evenSubfr, &gain_pit,
+               &gain_code );
+      }
+      else {
+         if ( mode == MR795 )
+            gain_pit = d_gain_pitch( mode, *parm++ );
+         d_gain_code( st->pred_state, mode, *parm++, code, &gain_code );
+      }
+
+      if ( ( mode != MR475 ) || evenSubfr == 0 ) {
+         st->sharp = gain_pit;
+
+         if ( st->sharp > SHARPMAX )
+            st->sharp = SHARPMAX;
+      }
+      st->old_T0 = T0;
+
+      /* excitation energy of the subframe */
+      code_energy = 0;
+
+      for ( i = 0; i < L_SUBFR; i++ ) {
+         s = ( Float32 )( code[i] * gain_code >> code_shift );
+         code_energy += s * s;
+      }
+      gain = gain_pit * ( 1.0F / 16384.0F );
+      *exc_energy = gain * gain * *exc_energy + code_energy;
+
+      /* excitation saturates at 16 bits */
+      if ( *exc_energy > L_SUBFR * 32768.0F * 32768.0F )
+         *exc_energy = L_SUBFR * 32768.0F * 32768.0F;
+
+      /* energy of 32 samples of impulse response of 1/A(z) */
+      lpc_gain = 0;
+
+      for ( i = 0; i < 32; i++ ) {
+         s = ( i == 0 ) ? 1.0F : 0.0F;
+
+         for ( k = 1; ( k <= M ) & ( k <= i ); k++ )
+            s -= A_t[subfrNr * MP1 + k] * ( 1.0F / 4096.0F ) * h[i - k];
+         h[i] = s;
+         lpc_gain += s * s;
+      }
+
+      /*
+       * synthesis overflows at about a third of full scale RMS, then
+       * the decoder scales excitation history down by 4
+       */
+      if ( *exc_energy * lpc_gain > L_SUBFR * 11585.0F * 11585.0F )
+         *exc_energy *= 1.0F / 16.0F;
+      energy += *exc_energy * lpc_gain;
+   }
+   return energy;
+}
+
+
+/*
+ * Speech_Decode_Frame_estimate
+ *
+ *
+ * Parameters:
+ *    st                B: decoder memory
+ *    mode              I: AMR mode
+ *    parm              I: speech parameters
+ *    frame_type        I: Frame type
+
+ * Function:
+ *    Rough energy of the frame decoded to floating point samples, see
+ *    Decoder_amr_estimate; for loudness scans, an order of magnitude
+ *    faster than decoding. Only good speech frames are estimated, other
+ *    frames are taken for silence. Instance is left fit only for
+ *    further estimates, it is to be reset before decoding
+ *
+ * Returns:
+ *    mean square of the output samples, scaled to [-1, 1)
+ */
+Float32 Speech_Decode_Frame_estimate( void *st, enum Mode mode, Word16 *parm,
+      enum RXFrameType frame_type )
+{
+   Speech_Decode_FrameState *s = ( Speech_Decode_FrameState * ) st;
+   Float32 energy;
+
+   if ( ( frame_type != RX_SPEECH_GOOD ) || ( mode > MR122 ) ) {
+      s->est_exc_energy = 0;
+      return 0;
+   }
+   energy = Decoder_amr_estimate( s->decoder_amrState, mode, parm, &s->
+         est_exc_energy );
+
+   /* post filter keeps the level, Post_Process doubles it */
+   return energy * ( 4.0F / ( L_FRAME * 32768.0F * 32768.0F ) );
+}
+
+
+/*
+ * Decoder_amr_exit
+ *
+ *
+ * Parameters:
+ *    state                I: state structure
+ *
+ * Function:
+ *    The memory used for state memory is freed
+ *
+ * Returns:
+ *    Void
+ */
+static void Decoder_amr_exit( Decoder_amrState **state )
+{
+   if ( state == NULL || *state == NULL )
+      return;
+   free( ( *state )->lsfState );
+   free( ( *state )->ec_gain_p_st );
+   free( ( *state )->ec_gain_c_st );
+   free( ( *state )->pred_state );
+   free( ( *state )->background_state );
+   free( ( *state )->ph_disp_st );
+   free( ( *state )->Cb_gain_averState );
+   free( ( *state )->lsp_avg_st );
+   free( ( *state )->dtxDecoderState );
+
+   /* deallocate memory */
+   free( *state );
+   *state = NULL;
+   return;
+}
+
+
+/*
+ * Post_Filter_exit
+ *
+ *
+ * Parameters:
+ *    state                I: state structure
+ *
+ * Function:
+ *    The memory used for state memory is freed
+ *
+ * Returns:
+ *    Void
+ */
+static void Post_Filter_exit( Post_FilterState **state )
+{
+   if ( state == NULL || *state == NULL )
+      return;
+   free( ( *state )->agc_state );
+
+   /* deallocate memory */
+   free( *state );
+   *state = NULL;
+   return;
+}
+
+
+/*
+ * Post_Process_reset
+ *
+ *
+ * Parameters:
+ *    state             B: state structure
+ *
+ * Function:
+ *    Resets state memory
+ *
+ * Returns:
+ *    -1 failure
+ */
+static int Post_Process_reset( Post_ProcessState *state )
+{
+   if ( ( Post_ProcessState * )state == NULL ) {
+      DEC_ERROR( "Post_Process_reset: invalid parameter\n" );
+      return-1;
+   }
+   state->y2_hi = 0;
+   state->y2_lo = 0;
+   state->y1_hi = 0;
+   state->y1_lo = 0;
+   state->x0 = 0;
+   state->x1 = 0;
+   state->y2_float = 0;
+   state->y1_float = 0;
+   state->x0_float = 0;
+   state->x1_float = 0;
+   return 0;
+}
+
+
+/*
+ * Post_Process_exit
+ *
+ *
+ * Parameters:
+ *    state                I: state structure
+ *
+ * Function:
+ *    The memory used for state memory is freed
+ *
+ * Returns:
+ *    Void
+ */
+static void Post_Process_exit( Post_ProcessState **state )
+{
+   if ( state == NULL || *state == NULL )
+      return;
+
+   /* deallocate memory */
+   free( *state );
+   *state = NULL;
+   return;
+}
+
+
+/*
+ * Decoder_amr_init
+ *
+ *
+ * Parameters:
+ *    state             O: state structure
+ *
+ * Function:
+ *    Allocates state memory and initializes state memory
+ *
+ * Returns:
+ *    success = 0
+ */
+static int Decoder_amr_init( Decoder_amrState **state )
+{
+   Decoder_amrState * s;
+
+   if ( ( Decoder_amrState * )state == NULL ) {
+      DEC_ERROR( "Decoder_amr_init: invalid parameter\n" );
+      return-1;
+   }
+   *state = NULL;
+
+   /* allocate memory */
+   if ( ( s = ( Decoder_amrState * ) malloc( sizeof( Decoder_amrState ) ) ) ==
+         NULL ) {
+      DEC_ERROR( "Decoder_amr_init: can not malloc state structure\n" );
+      return-1;
+   }
+
+   /* DPlsf_init */
+   /* allocate memory */
+   if ( ( s->lsfState = ( D_plsfState * ) malloc( sizeof( D_plsfState ) ) ) ==
+         NULL ) {
+      DEC_ERROR( "DPlsf_init: can not malloc state structure\n" );
+      return-1;
+   }
+
+   /* ecGainPitchInit */
+   /* allocate memory */
+   if ( ( s->ec_gain_p_st = ( ec_gain_pitchState * ) malloc( sizeof(
+         ec_gain_pitchState ) ) ) == NULL ) {
+      DEC_ERROR( "ecGainPitchInit: can not malloc state structure\n" );
+      return-1;
+   }
+
+   /* ecGainCodeInit */
+   /* allocate memory */
+   if ( ( s->ec_gain_c_st = ( ec_gain_codeState * ) malloc( sizeof(
+         ec_gain_codeState ) ) ) == NULL ) {
+      DEC_ERROR( "ecGainCodeInit: can not malloc state structure\n" );
+      return-1;
+   }
+
+   /* gcPredInit */
+   /* allocate memory */
+   if ( ( s->pred_state = ( gc_predState * ) malloc( sizeof( gc_predState ) ) )
+         == NULL ) {
+      DEC_ERROR( "gcPredInit: can not malloc state structure\n" );
+      return-1;
+   }
+
+   /* Cb_gain_averageInit */
+   /* allocate memory */
+   if ( ( s->Cb_gain_averState = ( Cb_gain_averageState * ) malloc( sizeof(
+         Cb_gain_averageState ) ) ) == NULL ) {
+      DEC_ERROR( "Cb_gain_averageInit: can not malloc state structure\n" )
+      ;
+      return-1;
+   }
+   memset( s->Cb_gain_averState->cbGainHistory, 0, sizeof( s->
+         Cb_gain_averState->cbGainHistory ) );
+
+   /* Initialize hangover handling */
+   s->Cb_gain_averState->hangVar = 0;
+   s->Cb_gain_averState->hangCount = 0;
+
+   /* lsp_avgInit */
+   /* allocate memory */
+   if ( ( s->lsp_avg_st = ( lsp_avgState * ) malloc( sizeof( lsp_avgState ) ) )
+         == NULL ) {
+      DEC_ERROR( "lsp_avgInit: can not malloc state structure\n" );
+      return-1;
+   }
+
+   /* Bgn_scdInit */
+   /* allocate memory */
+   if ( ( s->background_state = ( Bgn_scdState * ) malloc( sizeof( Bgn_scdState
+         ) ) ) == NULL ) {
+      DEC_ERROR( "Bgn_scdInit: can not malloc state structure\n" );
+      return-1;
+   }
+
+   /* phDispInit */
+   /* allocate memory */
+   if ( ( s->ph_disp_st = ( ph_dispState * ) malloc( sizeof( ph_dispState ) ) )
+         == NULL ) {
+      DEC_ERROR( "phDispInit: can not malloc state structure\n" );
+      return-1;
    }
 
-    /*
-     * Call the Source Characteristic Detector which updates
-     * st->inBackgroundNoise and st->voicedHangover.
-     */
-   st->inBackgroundNoise = Bgn_scd( st->background_state, &( st->ltpGainHistory[
-         0] ), &( synth[0] ), &( st->voicedHangover ) );
-   dtx_dec_activity_update( st->dtxDecoderState, st->lsfState->past_lsf_q, synth
-         );
+   /* dtxDecInit */
+   /* allocate memory */
+   if ( ( s->dtxDecoderState = ( dtx_decState * ) malloc( sizeof( dtx_decState )
+         ) ) == NULL ) {
+      DEC_ERROR( "dtxDecInit: can not malloc state structure\n" );
+      return-1;
+   }
+   Decoder_amr_reset( s, 0 );
+   *state = s;
+   return 0;
+}
 
-   /* store bfi for next subframe */
-   st->prev_bf = bfi;
-   st->prev_pdf = pdfi;
 
-    /*
-     * Calculate the LSF averages on the eight
-     * previous frames
-     */
-   lsp_avg( st->lsp_avg_st, st->lsfState->past_lsf_q );
-theEnd:
-   st->dtxDecoderState->dtxGlobalState = newDTXState;
-   return;
+/*
+ * Post_Filter_reset
+ *
+ *
+ * Parameters:
+ *    state             B: state structure
+ *
+ * Function:
+ *    Resets state memory
+ *
+ * Returns:
+ *    -1 failure
+ */
+static int Post_Filter_reset( Post_FilterState *state )
+{
+   if ( ( Post_FilterState * )state == NULL ) {
+      DEC_ERROR( "Post_Filter_reset: invalid parameter\n" );
+      return-1;
+   }
+   state->preemph_state_mem_pre = 0;
+   state->agc_state->past_gain = 4096;
+   memset( state->mem_syn_pst, 0, M * sizeof( Word32 ) );
+   memset( state->res2, 0, L_SUBFR * sizeof( Word32 ) );
+   memset( state->synth_buf, 0, ( L_FRAME + M ) * sizeof( Word32 ) );
+   memset( state->mem_syn_pst_float, 0, M * sizeof( Float32 ) );
+   state->preemph_mem_pre_float = 0;
+   state->past_gain_float = 1.0F;
+   return 0;
 }
 
 
 /*
- * Residu40
+ * Post_Filter_init
  *
  *
  * Parameters:
- *    a                 I: prediction coefficients
- *    x                 I: speech signal
- *    y                 O: residual signal
+ *    state             O: state structure
  *
  * Function:
- *    The LP residual is computed by filtering the input
- *    speech through the LP inverse filter a(z)
+ *    Allocates state memory and initializes state memory
  *
  * Returns:
- *    void
+ *    success = 0
  */
-static void Residu40( Word32 a[], Word32 x[], Word32 y[] )
+static int Post_Filter_init( Post_FilterState **state )
 {
-   Word32 s, i, j;
+   Post_FilterState * s;
 
+   if ( ( Post_FilterState * )state == NULL ) {
+      DEC_ERROR( "F057:invalid parameter\n" );
+      return-1;
+   }
+   *state = NULL;
 
-   for ( i = 0; i < 40; i++ ) {
-      s = a[0] * x[i] + a[1] * x[i - 1] + a[2] * x[i - 2] + a[3] * x[i - 3];
-      s += a[4] * x[i - 4] + a[5] * x[i - 5] + a[6] * x[i - 6] + a[7] * x[i - 7]
-         ;
-      s += a[8] * x[i - 8] + a[9] * x[i - 9] + a[10] * x[i - 10];
-      y[i] = ( s + 0x800 ) >> 12;
-      if (abs(y[i]) > 32767){
-         /* go to safe mode */
-         for (i = 0; i < 40; i++) {
-            s = a[0] * x[i];
-            for (j = 1; j <= 10; j++) {
-               s += a[j] * x[i - j];
-               if (s > 1073741823){
-                  s = 1073741823;
-               }
-               else if ( s < -1073741824) {
-                  s = -1073741824;
-               }
-            }
-            y[i] = ( s + 0x800 ) >> 12;
-            if (abs(y[i]) > 32767)
-               y[i] = (y[i] & 0x80000000) ? -32768 : 32767;
-         }
-         return;
-      }
+   /* allocate memory */
+   if ( ( s = ( Post_FilterState * ) malloc( sizeof( Post_FilterState ) ) ) ==
+         NULL ) {
+      DEC_ERROR( "F057:can not malloc filter structure\n" );
+      return-1;
+   }
+   s->agc_state = NULL;
 
+   /* allocate memory */
+   if ( ( s->agc_state = ( agcState * ) malloc( sizeof( agcState ) ) ) == NULL )
+   {
+      DEC_ERROR( "agcInit: can not malloc state structure\n" );
+      return-1;
    }
-   return;
+   Post_Filter_reset( s );
+   *state = s;
+   return 0;
 }
 
 
 /*
- * agc
+ * Post_Process_init
  *
  *
  * Parameters:
- *    st->past_gain     B: gain memory
- *    sig_in            I: Post_Filter input signal
- *    sig_out           B: Post_Filter output signal
- *    agc_fac           I: AGC factor
+ *    state             O: state structure
  *
  * Function:
- *    Scales the Post_Filter output on a subframe basis
+ *    Allocates state memory and initializes state memory
  *
  * Returns:
- *    void
+ *    success = 0
  */
-static void agc( agcState *st, Word32 *sig_in, Word32 *sig_out, Word16 agc_fac )
+static int Post_Process_init( Post_ProcessState **state )
 {
-   Word32 s, gain_in, gain_out, g0, gain;
-   int exp, i;
+   Post_ProcessState * s;
+
+   if ( ( Post_ProcessState * )state == NULL ) {
+      DEC_ERROR( "Post_Process_init: invalid parameter\n" );
+      return-1;
+   }
+   *state = NULL;
 
+   /* allocate memory */
+   if ( ( s = ( Post_ProcessState * ) malloc( sizeof( Post_ProcessState ) ) ) ==
+         NULL ) {
+      DEC_ERROR( "Post_Process_init: can not malloc state structure\n" );
+      return-1;
+   }
+   Post_Process_reset( s );
+   *state = s;
+   return 0;
+}
 
-   /* calculate gain_out with exponent */
-   s = energy_new( sig_out );
 
-   if ( s == 0 ) {
-      st->past_gain = 0;
+/*
+ * Speech_Decode_Frame_exit
+ *
+ *
+ * Parameters:
+ *    state                I: state structure
+ *
+ * Function:
+ *    The memory used for state memory is freed
+ *
+ * Returns:
+ *    Void
+ */
+void Speech_Decode_Frame_exit( void **st )
+{
+   if ( (( Speech_Decode_FrameState * )( st )) == NULL )
+      return;
+
+   /* states in one block are released all at once */
+   if ( ( ( Speech_Decode_FrameState * ) st )->arena == ARENA_OWNED ) {
+      free( ( ( Speech_Decode_FrameState * ) st )->arena_mem );
       return;
    }
-   exp=0;
-   i = s;
-   while (!(i & 0x40000000))
-   {
-      exp++;
-      i = i << 1;
-   }
-   exp -=1;
-   if (exp & 0x80000000) {
-      s >>= 1;
-   }
-   else {
-      s <<= exp;
-   }
-   gain_out = ( s + 0x00008000L ) >> 16;
+   else if ( ( ( Speech_Decode_FrameState * ) st )->arena == ARENA_EXTERNAL )
+      return;
+   Decoder_amr_exit( &( ( ( Speech_Decode_FrameState * ) st )->decoder_amrState
+         ) );
+   Post_Filter_exit( &( ( ( Speech_Decode_FrameState * ) st )->post_state ) );
+   Post_Process_exit( &( ( ( Speech_Decode_FrameState * ) st )->postHP_state ) )
+   ;
+   free( ( ( Speech_Decode_FrameState * ) st )->scratch );
 
-   /* calculate gain_in with exponent */
-   s = energy_new( sig_in );
+   /* deallocate memory */
+   free( (( Speech_Decode_FrameState * )st) );
+   return;
+}
 
-   if ( s == 0 ) {
-      g0 = 0;
-   }
-   else {
-      i=0;
-   while (!(s & 0x40000000))
-   {
-      i++;
-      s = s << 1;
-   }
-      s = s + 0x00008000L;
 
-      if ( s >= 0 )
-         gain_in = s >> 16;
-      else
-         gain_in = 32767;
-      exp = ( exp - i );
+/*
+ * Speech_Decode_Frame_link
+ *
+ *
+ * Parameters:
+ *    a                 B: states of one decoder in one block
+ *
+ * Function:
+ *    Points states of the block at each other, and excitation at its
+ *    place in the history
+ *
+ * Returns:
+ *    void
+ */
+static void Speech_Decode_Frame_link( Speech_Decode_FrameArena *a )
+{
+   a->frame.decoder_amrState = &a->decoder_amr;
+   a->frame.post_state = &a->post_filter;
+   a->frame.postHP_state = &a->post_process;
+   a->decoder_amr.lsfState = &a->lsf;
+   a->decoder_amr.ec_gain_p_st = &a->ec_gain_p;
+   a->decoder_amr.ec_gain_c_st = &a->ec_gain_c;
+   a->decoder_amr.pred_state = &a->pred;
+   a->decoder_amr.Cb_gain_averState = &a->Cb_gain_aver;
+   a->decoder_amr.lsp_avg_st = &a->lsp_avg;
+   a->decoder_amr.background_state = &a->background;
+   a->decoder_amr.ph_disp_st = &a->ph_disp;
+   a->decoder_amr.dtxDecoderState = &a->dtx;
+   a->decoder_amr.exc = a->decoder_amr.old_exc + PIT_MAX + L_INTERPOL;
+   a->post_filter.agc_state = &a->agc;
+}
 
-      /*
-       * g0 = (1-agc_fac) * sqrt(gain_in/gain_out);
-       */
-      /* s = gain_out / gain_in */
-      s = ( gain_out << 15 ) / gain_in;
-      exp = 7 - exp;
 
-      if ( exp > 0 ){
-         if (exp > 31)
-         {
-            if(s){
-               s = 2147483647;
-            }
-         }
-         else {
-            s = s << exp ;
-         }
-      }
-      else
-         s = ( s >> ( -exp ) );
-      if (s < 0)
-         s = 2147483647;
-      s = Inv_sqrt( s );
-      i = ( ( s << 9 ) + 0x00008000L ) >> 16;
-      if (i & 0xFFFF8000)
-         i = 32767;
+/*
+ * Speech_Decode_Frame_reset_arena
+ *
+ *
+ * Parameters:
+ *    a                 B: states of one decoder in one block
+ *
+ * Function:
+ *    Resets the states by one copy of the pristine image, as states
+ *    after the frame state follow each other in the block, and links
+ *    them again. Decodes the same as resetting them one by one, which
+ *    homing frames, seeks and reuse of pooled decoders would otherwise
+ *    pay for. Settings in the frame state are kept
+ *
+ * Returns:
+ *    void
+ */
+static void Speech_Decode_Frame_reset_arena( Speech_Decode_FrameArena *a )
+{
+   memcpy( &a->decoder_amr, &pristine.decoder_amr, sizeof(
+         Speech_Decode_FrameArena ) - offsetof( Speech_Decode_FrameArena,
+         decoder_amr ) );
+   Speech_Decode_Frame_link( a );
+}
 
-      /* g0 = i * (1-agc_fac) */
-      g0 = ( i * ( 32767 - agc_fac ) ) >> 15;
-   }
 
-   /*
-    * compute gain[n] = agc_fac * gain[n-1] + (1-agc_fac) * sqrt(gain_in/gain_out)
-    * sig_out[n] = gain[n] * sig_out[n]
-    */
-   gain = st->past_gain;
+/*
+ * Speech_Decode_Frame_reset
+ *
+ *
+ * Parameters:
+ *    state             B: state structure
+ *
+ * Function:
+ *    Resets state memory
+ *
+ * Returns:
+ *    -1 = failure
+ */
+int Speech_Decode_Frame_reset( void **st )
+{
+   Speech_Decode_FrameState * state;
 
-   for ( i = 0; i < L_SUBFR; i++ ) {
-      gain = ( gain * agc_fac ) >> 15;
-      gain = gain + g0;
-      sig_out[i] = ( sig_out[i] * gain ) >> 12;
-      if (labs(sig_out[i]) > 32767)
-         sig_out[i] = (sig_out[i] & 0x8000000) ? -32768 : 32767;
+   if ( st == NULL || *st == NULL )
+      return (-1);
+   state = ( Speech_Decode_FrameState * )st;
+
+   /* states in one block are reset from the pristine image */
+   if ( state->arena != ARENA_NONE )
+      Speech_Decode_Frame_reset_arena( ( Speech_Decode_FrameArena * )state );
+   else {
+      Decoder_amr_reset( state->decoder_amrState, ( enum Mode ) 0 );
+      Post_Filter_reset( state->post_state );
+      Post_Process_reset( state->postHP_state );
    }
-   st->past_gain = gain;
-   return;
+   state->silent = 0;
+   state->est_exc_energy = 0;
+   return 0;
 }
+#ifdef DEC_PROFILE
 
 
 /*
- * Post_Filter
+ * Speech_Decode_Frame_profile
  *
  *
  * Parameters:
- *    st                B: post filter states
- *    mode              I: AMR mode
- *    syn               B: synthesis speech
- *    Az_4              I: interpolated LPC parameters in all subfr.
+ *    st                I: state structure
  *
  * Function:
- *    Post_Filtering of synthesis speech.
- *
- *    inverse filtering of syn[] through A(z/0.7) to get res2[]
- *    tilt compensation filtering; 1 - MU*k*z^-1
- *    synthesis filtering through 1/A(z/0.75)
- *    adaptive gain control
+ *    Counters of instrumentation build. Frames and stages decoded here
+ *    are counted in, caller adds the stages it runs itself. Reset does
+ *    not clear them.
  *
  * Returns:
- *    void
+ *    pointer to counters inside the state
  */
-static void Post_Filter( Post_FilterState *st, enum Mode mode, Word32 *syn,
-      Word32 *Az_4 )
+struct Dec_profile *Speech_Decode_Frame_profile( void *st )
 {
-   Word32 h[22], Ap3[MP1], Ap4[MP1];   /* bandwidth expanded LP parameters */
-   Word32 tmp, i_subfr, i, temp1, temp2, overflow = 0;
-   Word32 *Az, *p1, *p2, *syn_work = &st->synth_buf[M];
-   const Word32 *pgamma3 = &gamma3[0];
-   const Word32 *pgamma4 = &gamma4_gamma3_MR122[0];
-
-
-   /*
-    * Post filtering
-    */
-   memcpy( syn_work, syn, L_FRAME <<2 );
-   Az = Az_4;
-
-   if ( ( mode == MR122 ) || ( mode == MR102 ) ) {
-      pgamma3 = &gamma4_gamma3_MR122[0];
-      pgamma4 = &gamma4_MR122[0];
-   }
-
-   for ( i_subfr = 0; i_subfr < L_FRAME; i_subfr += L_SUBFR ) {
-      /* Find weighted filter coefficients Ap3[] and Ap[4] */
-      Ap3[0] = Az[0];
-      Ap4[0] = Az[0];
-
-      for ( i = 1; i <= 10; i++ ) {
-         Ap3[i] = ( Az[i] * pgamma3[i - 1] +0x4000 ) >> 15;
-         Ap4[i] = ( Az[i] * pgamma4[i - 1] +0x4000 ) >> 15;
-      }
-
-      /* filtering of synthesis speech by A(z/0.7) to find res2[] */
-      Residu40( Ap3, &syn_work[i_subfr], st->res2 );
-
-      /* tilt compensation filter */
-      /* impulse response of A(z/0.7)/A(z/0.75) */
-      memcpy( h, Ap3, MP1 <<2 );
-      memset( &h[M +1], 0, ( 22 - M - 1 )<<2 );
-      Syn_filt( Ap4, h, h, 22, &h[M +1], 0 );
-
-      /* 1st correlation of h[] */
-      tmp = 16777216 + h[1] * h[1];
-
-      for ( i = 2; i < 22; i++ ) {
-         tmp += h[i] * h[i];
-         if (tmp > 0x3FFF8000)
-            break;
-      }
-      temp1 = tmp >> 15;
-      if (temp1 & 0xFFFF8000)
-         temp1 = 32767;
-
-      tmp = h[0] * h[1];
+   return &( ( Speech_Decode_FrameState * )st )->profile;
+}
 
-      for ( i = 1; i < 21; i++ ) {
-         tmp += h[i] * h[i + 1];
-         if (abs(tmp) > 1073741823)
-            tmp = 1073741823;
-      }
-      temp2 = tmp >> 15;
 
-      if ( temp2 <= 0 ) {
-         temp2 = 0;
-      }
-      else {
-         tmp = temp2 * 26214;
-         temp2 = ( tmp & 0xffff8000 ) / temp1;
-      }
+/*
+ * Speech_Decode_Frame_cycles
+ *
+ *
+ * Parameters:
+ *    void
+ *
+ * Function:
+ *    Reads time stamp counter, or processor time where there is none
+ *
+ * Returns:
+ *    counter value
+ */
+unsigned long long Speech_Decode_Frame_cycles( void )
+{
+#if defined( _M_IX86 ) || defined( _M_X64 ) || defined( __i386__ ) || \
+      defined( __x86_64__ )
+   return __rdtsc( );
+#else
+   return clock( );
+#endif
+}
+#endif
 
-      /* preemphasis */
-      p1 = st->res2 + 39;
-      p2 = p1 - 1;
-      tmp = *p1;
 
-      do {
-         *p1 = *p1 - ( ( temp2 * *p2-- ) >> 15 );
-         if (abs(*p1) > 32767) {
-            *p1 = (*p1 & 0x80000000) ? -32768 : 32767;
-         }
-         p1--;
-         *p1 = *p1 - ( ( temp2 * *p2-- ) >> 15 );
-         if (abs(*p1) > 32767) {
-            *p1 = (*p1 & 0x80000000) ? -32768 : 32767;
-         }
-         p1--;
-         *p1 = *p1 - ( ( temp2 * *p2-- ) >> 15 );
-         if (abs(*p1) > 32767) {
-            *p1 = (*p1 & 0x80000000) ? -32768 : 32767;
-         }
-         p1--;
-      } while( p1 > st->res2 );
-      *p1 = *p1 - ( ( temp2 * st->preemph_state_mem_pre ) >> 15 );
-      if (abs(*p1) > 32767) {
-         *p1 = (*p1 & 0x80000000) ? -32768 : 32767;
-      }
-      st->preemph_state_mem_pre = tmp;
+/*
+ * kernel tables
+ */
+static const Kernels kernels_c = { Syn_filt, Residu40, Pred_lt_3or6_40,
+      energy_new, Lsp_Az4, agc2_scale, agc_scale, ph_disp_conv, code_energy,
+      Lsf_pred, Lsf_lsp, Post_Process4, Residu40_float, energy_float,
+      Bgn_stats };
+#ifdef SP_DEC_SSE2
+static const Kernels kernels_sse2 = { Syn_filt, Residu40_sse2,
+      Pred_lt_3or6_40_sse2, energy_sse2, Lsp_Az4_sse2, agc2_scale_sse2,
+      agc_scale_sse2, ph_disp_conv_sse2, code_energy_sse2, Lsf_pred_sse2,
+      Lsf_lsp_sse2, Post_Process_sse2, Residu40_float_sse2, energy_float_sse2,
+      Bgn_stats_sse2 };
+#endif
+#ifdef SP_DEC_NEON
+static const Kernels kernels_neon = { Syn_filt, Residu40_neon, Pred_lt_3or6_40,
+      energy_neon, Lsp_Az4, agc2_scale_neon, agc_scale_neon, ph_disp_conv,
+      code_energy_neon, Lsf_pred, Lsf_lsp, Post_Process4, Residu40_float_neon,
+      energy_float_neon, Bgn_stats_neon };
+#endif
 
-      /* filtering through  1/A(z/0.75) */
-      overflow = Syn_filt( Ap4, st->res2, &syn[i_subfr], L_SUBFR, st->mem_syn_pst, 0 );
-      if (overflow){
-         Syn_filt_overflow( Ap4, st->res2, &syn[i_subfr], L_SUBFR, st->mem_syn_pst, 1 );
-         overflow = 0;
-      }
-      else {
-         memcpy(st->mem_syn_pst, &syn[i_subfr + 30], 40);
-      }
 
-      /* scale output to input */
-      agc( st->agc_state, &syn_work[i_subfr], &syn[i_subfr], AGC_FAC );
-      Az += MP1;
+/*
+ * Speech_Decode_Frame_select_kernels
+ *
+ *
+ * Parameters:
+ *    cpu_features      I: SP_DEC_CPU_* flags of the CPU, 0 for plain C
+ *
+ * Function:
+ *    Picks the fastest kernels the CPU can run, for all decoders. Must be
+ *    called before any decoder is initialized, otherwise first init picks
+ *    kernels for CPU features the compiler was allowed to assume.
+ *    Output of the fixed point engine is the same with any kernels.
+ *
+ * Returns:
+ *    void
+ */
+void Speech_Decode_Frame_select_kernels( int cpu_features )
+{
+#ifdef SP_DEC_SSE2
+   if ( cpu_features & SP_DEC_CPU_SSE2 ) {
+      kernels = &kernels_sse2;
+      return;
    }
-
-   /* update syn_work[] buffer */
-   memcpy( &syn_work[- M], &syn_work[L_FRAME - M], M <<2 );
-   return;
+#endif
+#ifdef SP_DEC_NEON
+   if ( cpu_features & SP_DEC_CPU_NEON ) {
+      kernels = &kernels_neon;
+      return;
+   }
+#endif
+   kernels = &kernels_c;
 }
 
 
 /*
- * Post_Process
+ * Speech_Decode_Frame_init_once
  *
  *
  * Parameters:
- *    st                B: post filter states
- *    signal            B: signal
+ *    void
  *
  * Function:
- *    Postprocessing of input speech.
- *
- *    2nd order high pass filtering with cut off frequency at 60 Hz.
- *    Multiplication of output by two.
- *
+ *    Picks kernels for CPU features the compiler was allowed to assume,
+ *    unless some were picked already, and resets states of a block field
+ *    by field into the image all decoders in one block are reset from,
+ *    see Speech_Decode_Frame_reset_arena. Called by every init; the first
+ *    one does it, others starting at the same time wait for it, and
+ *    neither is written again after, as decoders read them
  *
  * Returns:
  *    void
  */
- static void Post_Process( Post_ProcessState *st, Word32 signal[] )
- {
-    Word32 x2, tmp, i = 0;
-    Word32 mask = 0x40000000;
-
-    do {
-       x2 = st->x1;
-       st->x1 = st->x0;
-       st->x0 = signal[i];
-
-       /*
-       * y[i] = b[0]*x[i]*2 + b[1]*x[i-1]*2 + b140[2]*x[i-2]/2
-       *                    + a[1]*y[i-1] + a[2] * y[i-2];
-       */
-       tmp = ( st->y1_hi * 15836) + ( ( ( st->y1_lo * 15836 ) & ( Word32 )0xffff8000 ) >> 15);
-       tmp += (st->y2_hi * -7667) + ( ( ( st->y2_lo * ( -7667 ) ) & ( Word32 )0xffff8000 ) >> 15);
-       tmp += st->x0 * 7699;
-       tmp += st->x1 * -15398;
-       if ( ( (tmp >> 1) ^ tmp ) & mask)
-          tmp = (tmp & 0x80000000) ? -1073741824 : 1073741823;
-
-       tmp += x2 * 7699;
-       if ( ( (tmp >> 1) ^ tmp ) & mask)
-          tmp = (tmp & 0x80000000) ? -1073741824 : 1073741823;
-
-       tmp = tmp << 1;
-       if ( ( (tmp >> 1) ^ tmp ) & mask)
-          tmp = (tmp & 0x80000000) ? -1073741824 : 1073741823;
+static void Speech_Decode_Frame_init_once( void )
+{
+   if ( ONCE_LOAD( &init_once ) == 2 )
+      return;
 
-       tmp = tmp << 1;
-       if ( ( (tmp >> 1) ^ tmp ) & mask)
-          tmp = (tmp & 0x80000000) ? -1073741824 : 1073741823;
+   if ( !ONCE_CLAIM( &init_once ) ) {
+      while ( ONCE_LOAD( &init_once ) != 2 ) {
+      }
+      return;
+   }
 
-       if ( labs( tmp ) < 536862720 ) {
-          signal[i++] = ( tmp + 0x00002000L ) >> 14;
-       }
-       else if ( tmp > 0 ) {
-          signal[i++] = 32767;
-       }
-       else {
-          signal[i++] = -32768;
-       }
-       st->y2_hi = st->y1_hi;
-       st->y2_lo = st->y1_lo;
-       st->y1_hi = tmp >> 15;
-       st->y1_lo = ( ( tmp << 1 ) - ( st->y1_hi << 16 ) ) >> 1;
-    } while( i < 160 );
-    return;
+   if ( kernels == NULL )
+      Speech_Decode_Frame_select_kernels( CPU_DEFAULT );
+   memset( &pristine, 0, sizeof( pristine ) );
+   Speech_Decode_Frame_link( &pristine );
+   Decoder_amr_reset( &pristine.decoder_amr, 0 );
+   Post_Filter_reset( &pristine.post_filter );
+   Post_Process_reset( &pristine.post_process );
+   ONCE_DONE( &init_once );
 }
 
 
 /*
- * Speech_Decode_Frame
+ * Speech_Decode_Frame_reference_kernels
  *
  *
  * Parameters:
- *    st                B: decoder memory
- *    mode              I: AMR mode
- *    parm              I: speech parameters
- *    frame_type        I: Frame type
- *    synth             O: synthesis speech
-
+ *    enable            I: nonzero for plain C kernels, 0 for picked ones
+ *
  * Function:
- *    Decode one frame
+ *    Makes decoders run by the calling thread use plain C kernels, the
+ *    reference the others are checked against, whatever kernels were
+ *    picked for all decoders, until called with 0. Other threads keep
+ *    the picked ones.
  *
  * Returns:
  *    void
  */
-void Speech_Decode_Frame( void *st, enum Mode mode, Word16 *parm, enum
-      RXFrameType frame_type, Word16 *synth )
+void Speech_Decode_Frame_reference_kernels( int enable )
 {
-   Word32 Az_dec[AZ_SIZE];   /* Decoded Az for post-filter in 4 subframes*/
-   Word32 synth_speech[L_FRAME];
-   Word32 i;
-
-   /* Synthesis */
-   Decoder_amr( ( ( Speech_Decode_FrameState * ) st )->decoder_amrState, mode,
-         parm, frame_type, synth_speech, Az_dec );
-   Post_Filter( ( ( Speech_Decode_FrameState * ) st )->post_state, mode,
-         synth_speech, Az_dec );
-
-   /* post HP filter, and 15->16 bits */
-   Post_Process( ( ( Speech_Decode_FrameState * ) st )->postHP_state,
-         synth_speech );
-
-for ( i = 0; i < L_FRAME; i++ ) {
-#ifndef NO13BIT
-      /* Truncate to 13 bits */
-      synth[i] = ( Word16 )( synth_speech[i] & 0xfff8 );
-#else
-      synth[i] = ( Word16 )( synth_speech[i]);
-#endif
-   }
-
-
-   return;
+   thread_kernels = enable ? &kernels_c : NULL;
 }
 
 
 /*
- * Decoder_amr_exit
+ * Speech_Decode_Frame_memo_reset
  *
  *
  * Parameters:
- *    state                I: state structure
+ *    w                 O: work buffers
  *
  * Function:
- *    The memory used for state memory is freed
+ *    Empties memos of work buffers, which are not initialized otherwise.
+ *    Reset of decoder keeps them, they hold nothing but filters of
+ *    given parameters.
  *
  * Returns:
- *    Void
+ *    void
  */
-static void Decoder_amr_exit( Decoder_amrState **state )
+static void Speech_Decode_Frame_memo_reset( Speech_Decode_FrameScratch *w )
 {
-   if ( state == NULL || *state == NULL )
-      return;
-   free( ( *state )->lsfState );
-   free( ( *state )->ec_gain_p_st );
-   free( ( *state )->ec_gain_c_st );
-   free( ( *state )->pred_state );
-   free( ( *state )->background_state );
-   free( ( *state )->ph_disp_st );
-   free( ( *state )->Cb_gain_averState );
-   free( ( *state )->lsp_avg_st );
-   free( ( *state )->dtxDecoderState );
+   Word32 i;
 
-   /* deallocate memory */
-   free( *state );
-   *state = NULL;
-   return;
+
+   w->pf_memo.gamma3 = NULL;
+   w->cn_az.valid = 0;
+
+   for ( i = 0; i < 8; i++ ) {
+      w->cn_az_variab[i].valid = 0;
+   }
 }
 
 
 /*
- * Post_Filter_exit
+ * Speech_Decode_Frame_init
  *
  *
  * Parameters:
- *    state                I: state structure
+ *    state             O: state structure
  *
  * Function:
- *    The memory used for state memory is freed
+ *    Allocates state memory and initializes state memory
  *
  * Returns:
- *    Void
+ *    success = 0
  */
-static void Post_Filter_exit( Post_FilterState **state )
+void * Speech_Decode_Frame_init( )
 {
-   if ( state == NULL || *state == NULL )
-      return;
-   free( ( *state )->agc_state );
+   Speech_Decode_FrameState * s;
 
-   /* deallocate memory */
-   free( *state );
-   *state = NULL;
-   return;
+   Speech_Decode_Frame_init_once( );
+
+   /* allocate memory */
+   if ( ( s = ( Speech_Decode_FrameState * ) malloc( sizeof(
+         Speech_Decode_FrameState ) ) ) == NULL ) {
+      DEC_ERROR( "Speech_Decode_Frame_init: can not malloc state "
+            "structure\n" );
+      return NULL;
+   }
+   s->decoder_amrState = NULL;
+   s->post_state = NULL;
+   s->postHP_state = NULL;
+   s->arena = ARENA_NONE;
+   s->arena_mem = NULL;
+   s->silent = 0;
+   s->engine = SP_DEC_ENGINE_FIXED;
+   s->out_scale = 1.0F / 32768.0F;
+   s->scratch = NULL;
+#ifdef DEC_PROFILE
+   memset( &s->profile, 0, sizeof( s->profile ) );
+#endif
+
+   if ( Decoder_amr_init( &s->decoder_amrState ) || Post_Filter_init( &s->
+         post_state ) || Post_Process_init( &s->postHP_state ) || ( s->scratch =
+         ( Speech_Decode_FrameScratch * ) malloc( sizeof(
+         Speech_Decode_FrameScratch ) ) ) == NULL ) {
+      Speech_Decode_Frame_exit( ( void ** )( &s ) );
+      return NULL;
+   }
+   Speech_Decode_Frame_memo_reset( s->scratch );
+   return s;
 }
 
 
 /*
- * Post_Process_reset
+ * Speech_Decode_Frame_mem_size
  *
  *
  * Parameters:
- *    state             B: state structure
+ *    void
  *
  * Function:
- *    Resets state memory
+ *    Size of memory block needed by Speech_Decode_Frame_init_mem,
+ *    including slack for alignment
  *
  * Returns:
- *    -1 failure
+ *    size in bytes
  */
-static int Post_Process_reset( Post_ProcessState *state )
+int Speech_Decode_Frame_mem_size( void )
 {
-   if ( ( Post_ProcessState * )state == NULL ) {
-      fprintf( stderr, "Post_Process_reset: invalid parameter\n" );
-      return-1;
-   }
-   state->y2_hi = 0;
-   state->y2_lo = 0;
-   state->y1_hi = 0;
-   state->y1_lo = 0;
-   state->x0 = 0;
-   state->x1 = 0;
-   return 0;
+   return sizeof( Speech_Decode_FrameBlock ) + ARENA_ALIGN - 1;
 }
 
 
 /*
- * Post_Process_exit
+ * Speech_Decode_Frame_init_mem
  *
  *
  * Parameters:
- *    state                I: state structure
+ *    mem               I: Speech_Decode_Frame_mem_size() bytes of memory
  *
  * Function:
- *    The memory used for state memory is freed
+ *    Initializes state memory of one decoder in given block. All states
+ *    are placed together at cache line aligned address inside the block,
+ *    followed by work buffers of the decoder.
+ *    Speech_Decode_Frame_exit does not free the block, it stays owned by
+ *    the caller.
  *
  * Returns:
- *    Void
+ *    success           : pointer to structure inside the block
+ *    failure           : NULL
  */
-static void Post_Process_exit( Post_ProcessState **state )
+void * Speech_Decode_Frame_init_mem( void *mem )
 {
-   if ( state == NULL || *state == NULL )
-      return;
+   Speech_Decode_FrameBlock * b;
+   Speech_Decode_FrameArena * a;
 
-   /* deallocate memory */
-   free( *state );
-   *state = NULL;
-   return;
+   if ( mem == NULL ) {
+      DEC_ERROR( "Speech_Decode_Frame_init_mem: invalid parameter\n" );
+      return NULL;
+   }
+
+   Speech_Decode_Frame_init_once( );
+   b = ( Speech_Decode_FrameBlock * )( ( ( size_t )mem + ARENA_ALIGN - 1 ) & ~(
+         ( size_t )ARENA_ALIGN - 1 ) );
+   a = &b->states;
+
+   /* padding bytes too are then the same in every instance, see snapshot */
+   memset( a, 0, sizeof( Speech_Decode_FrameArena ) );
+
+   /* link states together */
+   a->frame.arena = ARENA_EXTERNAL;
+   a->frame.arena_mem = mem;
+   a->frame.scratch = &b->scratch;
+   a->frame.out_scale = 1.0F / 32768.0F;
+   Speech_Decode_Frame_link( a );
+   Speech_Decode_Frame_reset_arena( a );
+   Speech_Decode_Frame_memo_reset( &b->scratch );
+   return &a->frame;
 }
 
 
 /*
- * Decoder_amr_init
+ * Speech_Decode_Frame_init_arena
  *
  *
  * Parameters:
- *    state             O: state structure
+ *    void
  *
  * Function:
- *    Allocates state memory and initializes state memory
+ *    Same as Speech_Decode_Frame_init, but allocates all states
+ *    in one block with single malloc
  *
  * Returns:
- *    success = 0
+ *    success           : pointer to structure
+ *    failure           : NULL
  */
-static int Decoder_amr_init( Decoder_amrState **state )
+void * Speech_Decode_Frame_init_arena( void )
 {
-   Decoder_amrState * s;
-
-   if ( ( Decoder_amrState * )state == NULL ) {
-      fprintf( stderr, "Decoder_amr_init: invalid parameter\n" );
-      return-1;
-   }
-   *state = NULL;
-
-   /* allocate memory */
-   if ( ( s = ( Decoder_amrState * ) malloc( sizeof( Decoder_amrState ) ) ) ==
-         NULL ) {
-      fprintf( stderr, "Decoder_amr_init: can not malloc state structure\n" );
-      return-1;
-   }
-
-   /* DPlsf_init */
-   /* allocate memory */
-   if ( ( s->lsfState = ( D_plsfState * ) malloc( sizeof( D_plsfState ) ) ) ==
-         NULL ) {
-      fprintf( stderr, "DPlsf_init: can not malloc state structure\n" );
-      return-1;
-   }
-
-   /* ecGainPitchInit */
-   /* allocate memory */
-   if ( ( s->ec_gain_p_st = ( ec_gain_pitchState * ) malloc( sizeof(
-         ec_gain_pitchState ) ) ) == NULL ) {
-      fprintf( stderr, "ecGainPitchInit: can not malloc state structure\n" );
-      return-1;
-   }
-
-   /* ecGainCodeInit */
-   /* allocate memory */
-   if ( ( s->ec_gain_c_st = ( ec_gain_codeState * ) malloc( sizeof(
-         ec_gain_codeState ) ) ) == NULL ) {
-      fprintf( stderr, "ecGainCodeInit: can not malloc state structure\n" );
-      return-1;
-   }
-
-   /* gcPredInit */
-   /* allocate memory */
-   if ( ( s->pred_state = ( gc_predState * ) malloc( sizeof( gc_predState ) ) )
-         == NULL ) {
-      fprintf( stderr, "gcPredInit: can not malloc state structure\n" );
-      return-1;
-   }
-
-   /* Cb_gain_averageInit */
-   /* allocate memory */
-   if ( ( s->Cb_gain_averState = ( Cb_gain_averageState * ) malloc( sizeof(
-         Cb_gain_averageState ) ) ) == NULL ) {
-      fprintf( stderr, "Cb_gain_averageInit: can not malloc state structure\n" )
-      ;
-      return-1;
-   }
-   memset( s->Cb_gain_averState->cbGainHistory, 0, L_CBGAINHIST <<2 );
-
-   /* Initialize hangover handling */
-   s->Cb_gain_averState->hangVar = 0;
-   s->Cb_gain_averState->hangCount = 0;
-
-   /* lsp_avgInit */
-   /* allocate memory */
-   if ( ( s->lsp_avg_st = ( lsp_avgState * ) malloc( sizeof( lsp_avgState ) ) )
-         == NULL ) {
-      fprintf( stderr, "lsp_avgInit: can not malloc state structure\n" );
-      return-1;
-   }
-
-   /* Bgn_scdInit */
-   /* allocate memory */
-   if ( ( s->background_state = ( Bgn_scdState * ) malloc( sizeof( Bgn_scdState
-         ) ) ) == NULL ) {
-      fprintf( stderr, "Bgn_scdInit: can not malloc state structure\n" );
-      return-1;
-   }
-
-   /* phDispInit */
-   /* allocate memory */
-   if ( ( s->ph_disp_st = ( ph_dispState * ) malloc( sizeof( ph_dispState ) ) )
-         == NULL ) {
-      fprintf( stderr, "phDispInit: can not malloc state structure\n" );
-      return-1;
-   }
+   void * mem;
+   Speech_Decode_FrameState * s;
 
-   /* dtxDecInit */
    /* allocate memory */
-   if ( ( s->dtxDecoderState = ( dtx_decState * ) malloc( sizeof( dtx_decState )
-         ) ) == NULL ) {
-      fprintf( stderr, "dtxDecInit: can not malloc state structure\n" );
-      return-1;
+   if ( ( mem = malloc( Speech_Decode_Frame_mem_size( ) ) ) == NULL ) {
+      DEC_ERROR( "Speech_Decode_Frame_init_arena: can not malloc state "
+            "structure\n" );
+      return NULL;
    }
-   Decoder_amr_reset( s, 0 );
-   *state = s;
-   return 0;
+   s = ( Speech_Decode_FrameState * )Speech_Decode_Frame_init_mem( mem );
+   s->arena = ARENA_OWNED;
+   return s;
 }
 
 
 /*
- * Post_Filter_reset
+ * Speech_Decode_Frame_snapshot_size
  *
  *
  * Parameters:
- *    state             B: state structure
+ *    void
  *
  * Function:
- *    Resets state memory
+ *    Size of buffer needed by Speech_Decode_Frame_snapshot
  *
  * Returns:
- *    -1 failure
+ *    size in bytes
  */
-static int Post_Filter_reset( Post_FilterState *state )
+int Speech_Decode_Frame_snapshot_size( void )
 {
-   if ( ( Post_FilterState * )state == NULL ) {
-      fprintf( stderr, "Post_Filter_reset: invalid parameter\n" );
-      return-1;
-   }
-   state->preemph_state_mem_pre = 0;
-   state->agc_state->past_gain = 4096;
-   memset( state->mem_syn_pst, 0, M <<2 );
-   memset( state->res2, 0, L_SUBFR <<2 );
-   memset( state->synth_buf, 0, ( L_FRAME + M )<<2 );
-   return 0;
+   return sizeof( Speech_Decode_FrameArena );
 }
 
 
 /*
- * Post_Filter_init
+ * Speech_Decode_Frame_snapshot
  *
  *
  * Parameters:
- *    state             O: state structure
+ *    st                I: state structure
+ *    buf               O: Speech_Decode_Frame_snapshot_size() bytes,
+ *                         aligned as if returned by malloc
  *
  * Function:
- *    Allocates state memory and initializes state memory
+ *    Copies everything that decoder remembers between frames to buf,
+ *    with pointers cleared. Two decoders produce the same output from
+ *    now on if their snapshots have the same bytes. The opposite does
+ *    not hold: padding bytes are compared too, and they are the same
+ *    only in decoders initialized by Speech_Decode_Frame_init_mem.
+ *    Post filter memories are taken in fixed point whatever engine the
+ *    decoder has, so snapshots of either engine restore into both.
  *
  * Returns:
- *    success = 0
+ *    void
  */
-static int Post_Filter_init( Post_FilterState **state )
+void Speech_Decode_Frame_snapshot( void *st, void *buf )
 {
-   Post_FilterState * s;
-
-   if ( ( Post_FilterState * )state == NULL ) {
-      fprintf( stderr, "F057:invalid parameter\n" );
-      return-1;
-   }
-   *state = NULL;
+   Speech_Decode_FrameState * s;
+   Decoder_amrState * d;
+   Speech_Decode_FrameArena * a;
+
+   s = ( Speech_Decode_FrameState * )st;
+   d = s->decoder_amrState;
+   a = ( Speech_Decode_FrameArena * )buf;
+   memset( &a->frame, 0, sizeof( a->frame ) );
+   memcpy( &a->decoder_amr, d, sizeof( a->decoder_amr ) );
+   /* excitation past the history is scratch between frames */
+   memset( &a->decoder_amr.old_exc[PIT_MAX + L_INTERPOL], 0, L_FRAME *
+         sizeof( Word32 ) );
+   memcpy( &a->post_filter, s->post_state, sizeof( a->post_filter ) );
+   memcpy( &a->post_process, s->postHP_state, sizeof( a->post_process ) );
+   memcpy( &a->lsf, d->lsfState, sizeof( a->lsf ) );
+   memcpy( &a->ec_gain_p, d->ec_gain_p_st, sizeof( a->ec_gain_p ) );
+   memcpy( &a->ec_gain_c, d->ec_gain_c_st, sizeof( a->ec_gain_c ) );
+   memcpy( &a->pred, d->pred_state, sizeof( a->pred ) );
+   memcpy( &a->Cb_gain_aver, d->Cb_gain_averState, sizeof( a->Cb_gain_aver ) );
+   memcpy( &a->lsp_avg, d->lsp_avg_st, sizeof( a->lsp_avg ) );
+   memcpy( &a->background, d->background_state, sizeof( a->background ) );
+   memcpy( &a->ph_disp, d->ph_disp_st, sizeof( a->ph_disp ) );
+   memcpy( &a->dtx, d->dtxDecoderState, sizeof( a->dtx ) );
+   memcpy( &a->agc, s->post_state->agc_state, sizeof( a->agc ) );
+
+   /* post filter memories in fixed point, whichever engine has them */
+   if ( s->engine != SP_DEC_ENGINE_FIXED )
+      Post_float_store( &a->post_filter, &a->agc, &a->post_process );
+   Post_float_clear( &a->post_filter, &a->post_process );
+
+   /* counter values above threshold all act the same, see rx_dtx_handler */
+   if ( a->dtx.decAnaElapsedCount > DTX_ELAPSED_FRAMES_THRESH )
+      a->dtx.decAnaElapsedCount = DTX_ELAPSED_FRAMES_THRESH + 1;
+
+   /* addresses differ between instances */
+   a->decoder_amr.exc = NULL;
+   a->decoder_amr.background_state = NULL;
+   a->decoder_amr.Cb_gain_averState = NULL;
+   a->decoder_amr.lsp_avg_st = NULL;
+   a->decoder_amr.lsfState = NULL;
+   a->decoder_amr.ec_gain_p_st = NULL;
+   a->decoder_amr.ec_gain_c_st = NULL;
+   a->decoder_amr.pred_state = NULL;
+   a->decoder_amr.ph_disp_st = NULL;
+   a->decoder_amr.dtxDecoderState = NULL;
+   a->post_filter.agc_state = NULL;
+}
 
-   /* allocate memory */
-   if ( ( s = ( Post_FilterState * ) malloc( sizeof( Post_FilterState ) ) ) ==
-         NULL ) {
-      fprintf( stderr, "F057:can not malloc filter structure\n" );
-      return-1;
-   }
-   s->agc_state = NULL;
 
-   /* allocate memory */
-   if ( ( s->agc_state = ( agcState * ) malloc( sizeof( agcState ) ) ) == NULL )
-   {
-      fprintf( stderr, "agcInit: can not malloc state structure\n" );
-      return-1;
-   }
-   Post_Filter_reset( s );
-   *state = s;
-   return 0;
+/*
+ * Speech_Decode_Frame_restore
+ *
+ *
+ * Parameters:
+ *    st                B: state structure
+ *    buf               I: snapshot by Speech_Decode_Frame_snapshot
+ *
+ * Function:
+ *    Copies states from buf back, keeping pointers of this instance.
+ *    Decoder then produces the same output the snapshot instance did
+ *    after the snapshot was taken, if both have the fixed point engine;
+ *    floating point engine takes post filter memories over from their
+ *    fixed point values. Silence detection starts over, it is taken
+ *    again once a frame shows it applies
+ *
+ * Returns:
+ *    void
+ */
+void Speech_Decode_Frame_restore( void *st, const void *buf )
+{
+   Speech_Decode_FrameState * s;
+   Decoder_amrState * d;
+   Post_FilterState * p;
+   const Speech_Decode_FrameArena * a;
+   Bgn_scdState * background;
+   Cb_gain_averageState * Cb_gain_aver;
+   lsp_avgState * lsp_avg;
+   D_plsfState * lsf;
+   ec_gain_pitchState * ec_gain_p;
+   ec_gain_codeState * ec_gain_c;
+   gc_predState * pred;
+   ph_dispState * ph_disp;
+   dtx_decState * dtx;
+   agcState * agc;
+
+   s = ( Speech_Decode_FrameState * )st;
+   d = s->decoder_amrState;
+   p = s->post_state;
+   a = ( const Speech_Decode_FrameArena * )buf;
+
+   /* addresses of this instance */
+   background = d->background_state;
+   Cb_gain_aver = d->Cb_gain_averState;
+   lsp_avg = d->lsp_avg_st;
+   lsf = d->lsfState;
+   ec_gain_p = d->ec_gain_p_st;
+   ec_gain_c = d->ec_gain_c_st;
+   pred = d->pred_state;
+   ph_disp = d->ph_disp_st;
+   dtx = d->dtxDecoderState;
+   agc = p->agc_state;
+
+   memcpy( d, &a->decoder_amr, sizeof( a->decoder_amr ) );
+   memcpy( p, &a->post_filter, sizeof( a->post_filter ) );
+   memcpy( s->postHP_state, &a->post_process, sizeof( a->post_process ) );
+   memcpy( lsf, &a->lsf, sizeof( a->lsf ) );
+   memcpy( ec_gain_p, &a->ec_gain_p, sizeof( a->ec_gain_p ) );
+   memcpy( ec_gain_c, &a->ec_gain_c, sizeof( a->ec_gain_c ) );
+   memcpy( pred, &a->pred, sizeof( a->pred ) );
+   memcpy( Cb_gain_aver, &a->Cb_gain_aver, sizeof( a->Cb_gain_aver ) );
+   memcpy( lsp_avg, &a->lsp_avg, sizeof( a->lsp_avg ) );
+   memcpy( background, &a->background, sizeof( a->background ) );
+   memcpy( ph_disp, &a->ph_disp, sizeof( a->ph_disp ) );
+   memcpy( dtx, &a->dtx, sizeof( a->dtx ) );
+   memcpy( agc, &a->agc, sizeof( a->agc ) );
+
+   d->exc = d->old_exc + PIT_MAX + L_INTERPOL;
+   d->background_state = background;
+   d->Cb_gain_averState = Cb_gain_aver;
+   d->lsp_avg_st = lsp_avg;
+   d->lsfState = lsf;
+   d->ec_gain_p_st = ec_gain_p;
+   d->ec_gain_c_st = ec_gain_c;
+   d->pred_state = pred;
+   d->ph_disp_st = ph_disp;
+   d->dtxDecoderState = dtx;
+   p->agc_state = agc;
+   s->silent = 0;
+
+   if ( s->engine != SP_DEC_ENGINE_FIXED )
+      Post_float_load( p, agc, s->postHP_state );
 }
 
 
 /*
- * Post_Process_init
+ * Speech_Decode_Frame_set_engine
  *
  *
  * Parameters:
- *    state             O: state structure
+ *    st                B: state structure
+ *    engine            I: SP_DEC_ENGINE_FIXED, SP_DEC_ENGINE_FLOAT or
+ *                         SP_DEC_ENGINE_BYPASS
  *
  * Function:
- *    Allocates state memory and initializes state memory
+ *    Selects how this decoder does post filtering, adaptive gain control
+ *    and the high pass filter after it. Fixed point engine is bit-exact
+ *    with the reference decoder, and the default. Floating point engine
+ *    does them in single precision with SSE2 where kernels have it, and
+ *    does not round floating point output to 16 bits and then 13 of them,
+ *    for speed and output that is a little smoother, but not the same. Synthesis stays
+ *    in fixed point either way, as decoding of the following frames
+ *    depends on it. Bypass engine skips post filtering and adaptive gain
+ *    control altogether, and runs the floating point high pass filter on
+ *    synthesis speech, for output analysed by machines rather than
+ *    listened to. Memories of the engine left are carried over to the
+ *    other one, so it can be changed between any two frames. The setting
+ *    is kept over reset.
  *
  * Returns:
- *    success = 0
+ *    void
  */
-static int Post_Process_init( Post_ProcessState **state )
+void Speech_Decode_Frame_set_engine( void *st, int engine )
 {
-   Post_ProcessState * s;
+   Speech_Decode_FrameState * s;
 
-   if ( ( Post_ProcessState * )state == NULL ) {
-      fprintf( stderr, "Post_Process_init: invalid parameter\n" );
-      return-1;
-   }
-   *state = NULL;
+   s = ( Speech_Decode_FrameState * )st;
+   engine = engine == SP_DEC_ENGINE_FLOAT || engine == SP_DEC_ENGINE_BYPASS ?
+         engine : SP_DEC_ENGINE_FIXED;
 
-   /* allocate memory */
-   if ( ( s = ( Post_ProcessState * ) malloc( sizeof( Post_ProcessState ) ) ) ==
-         NULL ) {
-      fprintf( stderr, "Post_Process_init: can not malloc state structure\n" );
-      return-1;
+   /* floating point engines share memories */
+   if ( ( engine == SP_DEC_ENGINE_FIXED ) == ( s->engine == SP_DEC_ENGINE_FIXED ) ) {
+      s->engine = ( Word16 )engine;
+      return;
    }
-   Post_Process_reset( s );
-   *state = s;
-   return 0;
+
+   if ( engine != SP_DEC_ENGINE_FIXED )
+      Post_float_load( s->post_state, s->post_state->agc_state, s->
+            postHP_state );
+   else
+      Post_float_store( s->post_state, s->post_state->agc_state, s->
+            postHP_state );
+   s->engine = ( Word16 )engine;
 }
 
 
 /*
- * Speech_Decode_Frame_exit
+ * Speech_Decode_Frame_set_gain
  *
  *
  * Parameters:
- *    state                I: state structure
+ *    st                B: state structure
+ *    gain              I: linear gain, 1 for none
  *
  * Function:
- *    The memory used for state memory is freed
+ *    Multiplies floating point output by gain, in the last step of
+ *    Post_Process, where each sample is converted anyway, so a player
+ *    normalizing loudness needs no pass over the output after. 16-bit
+ *    output and everything the decoder keeps between frames are not
+ *    affected, so snapshots restore into any gain. Output of a gain
+ *    above 1 may go past [-1, 1). The setting is kept over reset.
  *
  * Returns:
- *    Void
+ *    void
  */
-void Speech_Decode_Frame_exit( void **st )
+void Speech_Decode_Frame_set_gain( void *st, float gain )
 {
-   if ( (( Speech_Decode_FrameState * )( st )) == NULL )
-      return;
-   Decoder_amr_exit( &( ( ( Speech_Decode_FrameState * ) st )->decoder_amrState
-         ) );
-   Post_Filter_exit( &( ( ( Speech_Decode_FrameState * ) st )->post_state ) );
-   Post_Process_exit( &( ( ( Speech_Decode_FrameState * ) st )->postHP_state ) )
-   ;
-
-   /* deallocate memory */
-   free( (( Speech_Decode_FrameState * )st) );
-   return;
+   ( ( Speech_Decode_FrameState * )st )->out_scale = gain * ( 1.0F /
+         32768.0F );
 }
 
 
 /*
- * Speech_Decode_Frame_reset
+ * Speech_Decode_Frame_pitch_lag
  *
  *
  * Parameters:
- *    state             B: state structure
+ *    st                I: state structure
  *
  * Function:
- *    Resets state memory
+ *    Integer pitch lag of the last subframe of the frame decoded last,
+ *    as the adaptive codebook had it, for time scaling of the output
+ *    without pitch detection of its own. Comfort noise has no lag
  *
  * Returns:
- *    -1 = failure
+ *    lag in samples, 0 after comfort noise
  */
-int Speech_Decode_Frame_reset( void **st )
+int Speech_Decode_Frame_pitch_lag( void *st )
 {
-   Speech_Decode_FrameState * state;
+   Decoder_amrState *d;
 
-   if ( st == NULL || *st == NULL )
-      return (-1);
-   state = ( Speech_Decode_FrameState * )st;
-   Decoder_amr_reset( state->decoder_amrState, ( enum Mode ) 0 );
-   Post_Filter_reset( state->post_state );
-   Post_Process_reset( state->postHP_state );
-   return 0;
+
+   d = ( ( Speech_Decode_FrameState * )st )->decoder_amrState;
+
+   if ( d->dtxDecoderState->dtxGlobalState != SPEECH )
+      return 0;
+   return ( int )d->old_T0;
 }
 
 
 /*
- * Speech_Decode_Frame_init
+ * Speech_Decode_Frame_features
  *
  *
  * Parameters:
- *    state             O: state structure
+ *    st                I: state structure
+ *    lsp               O: LSPs of each subframe, M each, Q15
+ *    lag               O: integer pitch lag of each subframe
+ *    lag_frac          O: its fraction, in sixths for MR122, thirds otherwise
+ *    gain_pit          O: pitch gain of each subframe, Q14
+ *    gain_code         O: codebook gain of each subframe, Q1
  *
  * Function:
- *    Allocates state memory and initializes state memory
+ *    Parameters the frame decoded last was synthesized from, for speech
+ *    analysis without analysing the output again. LSPs are interpolated
+ *    as for the synthesis filter, see Int_lpc_1and3 and Int_lpc_1to3.
+ *    Comfort noise has its LSPs in every subframe, and no lags or gains
  *
  * Returns:
- *    success = 0
+ *    mode of the frame, MRDTX if it was no speech
  */
-void * Speech_Decode_Frame_init( )
+enum Mode Speech_Decode_Frame_features( void *st, short *lsp, short *lag,
+      short *lag_frac, short *gain_pit, short *gain_code )
 {
-   Speech_Decode_FrameState * s;
+   Decoder_amrState *d;
+   const Word32 *prev, *mid, *next;
+   Word32 i, j;
 
-   /* allocate memory */
-   if ( ( s = ( Speech_Decode_FrameState * ) malloc( sizeof(
-         Speech_Decode_FrameState ) ) ) == NULL ) {
-      fprintf( stderr, "Speech_Decode_Frame_init: can not malloc state "
-            "structure\n" );
-      return NULL;
+
+   d = ( ( Speech_Decode_FrameState * )st )->decoder_amrState;
+   next = d->lsp_old;
+
+   if ( ( d->dtxDecoderState->dtxGlobalState != SPEECH ) | ( d->feat_mode ==
+         MRDTX ) ) {
+      for ( j = 0; j < L_FRAME / L_SUBFR; j++ ) {
+         for ( i = 0; i < M; i++ )
+            lsp[j * M + i] = ( short )next[i];
+         lag[j] = lag_frac[j] = gain_pit[j] = gain_code[j] = 0;
+      }
+      return MRDTX;
    }
-   s->decoder_amrState = NULL;
-   s->post_state = NULL;
-   s->postHP_state = NULL;
+   prev = d->feat_lsp_old;
+   mid = d->feat_lsp_mid;
 
-   if ( Decoder_amr_init( &s->decoder_amrState ) || Post_Filter_init( &s->
-         post_state ) || Post_Process_init( &s->postHP_state ) ) {
-      Speech_Decode_Frame_exit( ( void ** )( &s ) );
-      return NULL;
+   for ( i = 0; i < M; i++ ) {
+      if ( d->feat_mode == MR122 ) {
+         lsp[i] = ( short )( ( mid[i] >> 1 ) + ( prev[i] >> 1 ) );
+         lsp[M + i] = ( short )mid[i];
+         lsp[2 * M + i] = ( short )( ( mid[i] >> 1 ) + ( next[i] >> 1 ) );
+      }
+      else {
+         lsp[i] = ( short )( ( next[i] >> 2 ) + ( prev[i] - ( prev[i] >> 2 ) ) );
+         lsp[M + i] = ( short )( ( prev[i] >> 1 ) + ( next[i] >> 1 ) );
+         lsp[2 * M + i] = ( short )( ( prev[i] >> 2 ) + ( next[i] - ( next[i] >>
+               2 ) ) );
+      }
+      lsp[3 * M + i] = ( short )next[i];
    }
-   return s;
+
+   for ( j = 0; j < L_FRAME / L_SUBFR; j++ ) {
+      lag[j] = d->feat_lag[j];
+      lag_frac[j] = d->feat_lag_frac[j];
+      gain_pit[j] = d->feat_gain_pit[j];
+      gain_code[j] = d->feat_gain_code[j];
+   }
+   return d->feat_mode;
 }
@@ -53,15 +53,142 @@ enum RXFrameType { RX_SPEECH_GOOD = 0,
                    RX_N_FRAMETYPES     /* number of frame types */
 };
 
+#ifdef DEC_PROFILE
+/*
+ * stages timed by instrumentation build, built with DEC_PROFILE defined
+ */
+enum Dec_stage { STAGE_UNPACK = 0,
+                 STAGE_DECODER_AMR,
+                 STAGE_POST_FILTER,
+                 STAGE_POST_PROCESS,
+                 N_STAGES     /* number of stages */
+};
+
+/*
+ * frames decoded and time stamp counter cycles they took per stage,
+ * by mode and frame type; see DEC_PROFILE_MODE for the mode index
+ */
+struct Dec_profile {
+   unsigned long long frames[N_MODES][RX_N_FRAMETYPES];
+   unsigned long long cycles[N_MODES][RX_N_FRAMETYPES][N_STAGES];
+};
+
+/*
+ * index of counters of a frame decoded in mode; frames that carry no
+ * mode, as NO_DATA frames, which come with 15, are counted with MRDTX
+ */
+#define DEC_PROFILE_MODE( mode ) ( ( unsigned )( mode ) < N_MODES ? ( mode ) : \
+      MRDTX )
+#endif
+
+#ifdef DEC_TRACE
+/*
+ * begin and end of zones of decoder stages, in tracing build, built
+ * with DEC_TRACE defined; defined by whoever links the decoder, to emit
+ * them to a timeline profiler. zone is a literal
+ */
+void Dec_trace_begin( const char *zone );
+void Dec_trace_end( const char *zone );
+#define DEC_TRACE_BEGIN( zone ) Dec_trace_begin( zone )
+#define DEC_TRACE_END( zone ) Dec_trace_end( zone )
+#else
+#define DEC_TRACE_BEGIN( zone )
+#define DEC_TRACE_END( zone )
+#endif
+
+/*
+ * CPU features for Speech_Decode_Frame_select_kernels
+ */
+#define SP_DEC_CPU_SSE2 0x1
+#define SP_DEC_CPU_NEON 0x2
+
+/*
+ * engines for Speech_Decode_Frame_set_engine
+ */
+#define SP_DEC_ENGINE_FIXED 0
+#define SP_DEC_ENGINE_FLOAT 1
+#define SP_DEC_ENGINE_BYPASS 2
+
 /*
  * Function prototypes
  */
 
+/*
+ * pick kernels for given CPU features for all instances, 0 forces
+ * plain C ones; call before the first instance is initialized
+ */
+void Speech_Decode_Frame_select_kernels (int cpu_features);
+
+/*
+ * plain C kernels for instances run by the calling thread, whatever was
+ * picked for all of them, while enable is nonzero
+ */
+void Speech_Decode_Frame_reference_kernels (int enable);
+
 /*
  * initialize one instance of the speech decoder
  */
 void* Speech_Decode_Frame_init ();
 
+/*
+ * initialize one instance of the speech decoder, with all of its
+ * state in one cache line aligned block
+ */
+void* Speech_Decode_Frame_init_arena (void);
+
+/*
+ * size of block needed by Speech_Decode_Frame_init_mem
+ */
+int Speech_Decode_Frame_mem_size (void);
+
+/*
+ * initialize one instance of the speech decoder in caller's block;
+ * the block is not freed by Speech_Decode_Frame_exit
+ */
+void* Speech_Decode_Frame_init_mem (void *mem);
+
+/*
+ * size of buffer needed by Speech_Decode_Frame_snapshot
+ */
+int Speech_Decode_Frame_snapshot_size (void);
+
+/*
+ * copy of decoder state, which compares equal for decoders that are
+ * going to produce the same output
+ */
+void Speech_Decode_Frame_snapshot (void *st, void *buf);
+
+/*
+ * bring decoder to state of a snapshot, taken from this or another
+ * instance; it then decodes exactly as the instance did
+ */
+void Speech_Decode_Frame_restore (void *st, const void *buf);
+
+/*
+ * post filter in fixed point, bit-exact, or in floating point, faster;
+ * kept over reset
+ */
+void Speech_Decode_Frame_set_engine (void *st, int engine);
+
+/*
+ * gain of floating point output, applied as samples are converted;
+ * kept over reset
+ */
+void Speech_Decode_Frame_set_gain (void *st, float gain);
+
+/*
+ * integer pitch lag of the last subframe decoded, 0 after comfort noise
+ */
+int Speech_Decode_Frame_pitch_lag (void *st);
+
+/*
+ * parameters the frame decoded last was synthesized from, 4 subframes
+ * of each, LSPs 10 per subframe; returns its mode, MRDTX if it was no
+ * speech
+ */
+enum Mode Speech_Decode_Frame_features (void *st, short *lsp, short *lag,
+      short *lag_frac, short *gain_pit, short *gain_code);
+
 /*
  * free status struct
  */
@@ -74,9 +201,64 @@ void Speech_Decode_Frame (void *st, enum Mode mode, short *serial,
                    enum RXFrameType frame_type, short *synth);
 
 /*
- * reset speech decoder
+ * Decodes one frame from encoded parameters to floating point samples
+ */
+void Speech_Decode_Frame_float (void *st, enum Mode mode, short *serial,
+                   enum RXFrameType frame_type, float *synth);
+
+/*
+ * Same as Speech_Decode_Frame_float, to every stride-th sample of synth
+ */
+void Speech_Decode_Frame_float_stride (void *st, enum Mode mode, short *serial,
+                   enum RXFrameType frame_type, float *synth, int stride);
+
+/*
+ * Same as Speech_Decode_Frame_float_stride of count independent streams,
+ * filtered side by side where they can be
+ */
+void Speech_Decode_Frame_group_float (void *st[], int count, enum Mode mode[],
+                   short *serial[], enum RXFrameType frame_type[], float *synth[],
+                   int stride);
+
+/*
+ * Same as Speech_Decode_Frame, but with no output: for frames decoded
+ * only for the state they leave, up to post filter memories, which the
+ * next frame or two decoded in full settle
+ */
+void Speech_Decode_Frame_warmup (void *st, enum Mode mode, short *serial,
+                   enum RXFrameType frame_type);
+
+/*
+ * Hint the cache to load rows of ROM tables a good speech frame of these
+ * parameters will read, ahead of decoding it; reads and changes nothing
+ */
+void Speech_Decode_Frame_prefetch (enum Mode mode, const short *serial,
+                   enum RXFrameType frame_type);
+
+/*
+ * Rough mean square of a frame decoded to floating point samples, from
+ * its parameters alone; state is fit only for further estimates after
+ */
+float Speech_Decode_Frame_estimate (void *st, enum Mode mode, short *serial,
+                   enum RXFrameType frame_type);
+
+/*
+ * reset speech decoder; decoders with states in one block are reset by
+ * one copy of a pristine image
  */
 int Speech_Decode_Frame_reset (void **st);
 
+#ifdef DEC_PROFILE
+/*
+ * counters of the instance, kept over reset
+ */
+struct Dec_profile *Speech_Decode_Frame_profile (void *st);
+
+/*
+ * current value of time stamp counter
+ */
+unsigned long long Speech_Decode_Frame_cycles (void);
+#endif
+
 #endif
 
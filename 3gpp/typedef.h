@@ -8,15 +8,22 @@
  * ===================================================================
  *
  */
-/* This is valid for PC */
+/*
+ * Fixed width on every target: long is 64 bits on LP64 systems such as
+ * macOS and Linux, which would double the decoder state and break the
+ * 32-bit wrap-around the fixed point code relies on.
+ */
 
 #ifndef _TYPEDEF_H
 #define _TYPEDEF_H
 
+#include <stdint.h>
+
 typedef char Word8;
 typedef unsigned char UWord8;
-typedef short Word16;
-typedef long Word32;
+typedef int16_t Word16;
+typedef int32_t Word32;
+typedef int64_t Word64;
 typedef float Float32;
 typedef double Float64;
 
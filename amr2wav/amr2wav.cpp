@@ -0,0 +1,630 @@
+/**
+ * amr2wav - batch conversion of AMR files to WAV, outside foobar2000, on several threads
+*/
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+/* foobar sdk only for types of amr_frame_reader; conversion uses none of its services, so it runs without foobar2000 */
+#include "../foo_sdk/foobar2000/SDK/foobar2000.h"
+extern "C" {
+	#include "../3gpp/interf_dec.h"
+}
+#include "../foo_amr/amr_frame_reader.h"
+
+enum {
+	/* as in input_amr */
+	amr_max_channels = 6,
+	amr_frame_samples = 160,
+	amr_sample_rate = 8000,
+	amr_magic_size = 6,
+	amr_mc_magic_size = 12,
+	amr_mc_header_size = amr_mc_magic_size + 4,
+	/* frames decoded at a time, per channel */
+	amr2wav_block_frames = 500,
+	amr2wav_wav_header_size = 44,
+	/* non-PCM header has fmt extension size, and a fact chunk with the length */
+	amr2wav_g711_header_size = 58,
+	/* progress of a file is saved after at least this many frames, a minute, see amr2wav_worker::save_progress() */
+	amr2wav_progress_frames = 3000,
+	amr2wav_progress_version = 1,
+};
+
+/* sample formats of WAV files written */
+enum amr2wav_format {
+	amr2wav_pcm,
+	amr2wav_alaw,
+	amr2wav_ulaw,
+};
+
+static const char g_magic[] = "#!AMR\x0a";
+static const char g_magic_mc[] = "#!AMR_MC1.0\x0a";
+static const char g_progress_magic[] = "AMR2WAVP";
+static const char g_progress_extension[] = ".resume";
+static const char g_progress_temp_extension[] = ".resume.tmp";
+
+/* FNV-1a, 64-bit, of input before where progress was saved, so input changed since does not resume */
+static const unsigned long long amr2wav_hash_basis = 0xcbf29ce484222325ULL;
+static const unsigned long long amr2wav_hash_prime = 0x100000001b3ULL;
+
+/* 64-bit offsets, as outputs of long multichannel files pass 2 GB */
+#ifdef _MSC_VER
+#define amr2wav_fseek _fseeki64
+#define amr2wav_ftell _ftelli64
+#else
+#define amr2wav_fseek fseeko
+#define amr2wav_ftell ftello
+#endif
+
+
+/* feature flags for Decoder_Interface_select_kernels, as detected on this CPU */
+static int amr2wav_cpu_features() {
+#if defined(__SSE2__) || defined(_M_X64)
+	return DEC_CPU_SSE2;
+#elif defined(_MSC_VER) && defined(_M_IX86)
+	int info[4];
+	__cpuid(info, 1);
+	return (info[3] & (1 << 26)) != 0 ? DEC_CPU_SSE2 : 0;
+#elif defined(__aarch64__) || defined(_M_ARM64)
+	return DEC_CPU_NEON;
+#else
+	return 0;
+#endif
+}
+
+/* stores p_value in p_out as p_bytes bytes, little endian */
+static void amr2wav_put(unsigned char * p_out, unsigned long long p_value, unsigned p_bytes) {
+	for (unsigned i = 0; i < p_bytes; ++i) p_out[i] = (unsigned char)(p_value >> (8 * i));
+}
+
+/* value stored by amr2wav_put() */
+static unsigned long long amr2wav_get(const unsigned char * p_in, unsigned p_bytes) {
+	unsigned long long value = 0;
+	for (unsigned i = 0; i < p_bytes; ++i) value |= (unsigned long long)p_in[i] << (8 * i);
+	return value;
+}
+
+/* p_hash with p_size bytes of p_data added */
+static unsigned long long amr2wav_hash(unsigned long long p_hash, const unsigned char * p_data, size_t p_size) {
+	for (size_t i = 0; i < p_size; ++i) p_hash = (p_hash ^ p_data[i]) * amr2wav_hash_prime;
+	return p_hash;
+}
+
+/**
+ * Header of WAV file of 16-bit PCM, or of 8-bit G.711 A-law or u-law.
+ *
+ * @param p_out			receives amr2wav_wav_header_size bytes, amr2wav_g711_header_size for G.711
+ * @param p_format		sample format
+ * @param p_channels	number of channels
+ * @param p_samples		number of samples per channel
+ * @return				size of the header
+ * @since				1.2.0
+ */
+static unsigned amr2wav_header(unsigned char * p_out, amr2wav_format p_format, unsigned p_channels, unsigned p_samples) {
+	static const unsigned tags[] = { 1 /* PCM */, 6 /* A-law */, 7 /* u-law */ };
+	const unsigned bytes = p_format == amr2wav_pcm ? 2 : 1;
+	const unsigned size = p_format == amr2wav_pcm ? amr2wav_wav_header_size : amr2wav_g711_header_size;
+	const unsigned data = p_samples * p_channels * bytes;
+	memcpy(p_out, "RIFF", 4);
+	amr2wav_put(p_out + 4, size - 8 + data, 4);
+	memcpy(p_out + 8, "WAVEfmt ", 8);
+	amr2wav_put(p_out + 16, p_format == amr2wav_pcm ? 16 : 18, 4);
+	amr2wav_put(p_out + 20, tags[p_format], 2);
+	amr2wav_put(p_out + 22, p_channels, 2);
+	amr2wav_put(p_out + 24, amr_sample_rate, 4);
+	amr2wav_put(p_out + 28, amr_sample_rate * p_channels * bytes, 4);
+	amr2wav_put(p_out + 32, p_channels * bytes, 2);
+	amr2wav_put(p_out + 34, bytes * 8, 2);
+	unsigned char * chunk = p_out + 36;
+	if (p_format != amr2wav_pcm) {
+		amr2wav_put(chunk, 0, 2);
+		memcpy(chunk + 2, "fact", 4);
+		amr2wav_put(chunk + 6, 4, 4);
+		amr2wav_put(chunk + 10, p_samples, 4);
+		chunk += 14;
+	}
+	memcpy(chunk, "data", 4);
+	amr2wav_put(chunk + 4, data, 4);
+	return size;
+}
+
+/* where conversion of a file got to, see amr2wav_worker::save_progress() */
+struct amr2wav_progress {
+	amr2wav_progress() : m_pos(0), m_hash(amr2wav_hash_basis), m_samples(0) {}
+	/* input offset of the next frame, hash of input before it, and samples per channel written */
+	size_t m_pos;
+	unsigned long long m_hash;
+	unsigned m_samples;
+	/* snapshot of the decoder of each channel, see Decoder_Interface_snapshot */
+	std::vector<unsigned char> m_snapshots;
+};
+
+/**
+ * Decoders of one worker thread, reset for every file it converts.
+ *
+ * @since   1.2.0
+ */
+class amr2wav_worker {
+public:
+	/**
+	 * Every file is written in each of p_formats, decoded once; G.711 is coded from the 16-bit output, see
+	 * Decoder_Interface_Code_g711. With p_resume, progress of each file is saved as it's converted, and
+	 * conversion cut short, by the process being killed, resumes where it was saved last.
+	 */
+	amr2wav_worker(const std::vector<amr2wav_format> & p_formats, bool p_resume) : m_formats(p_formats), m_resume(p_resume) {
+		for (unsigned i = 0; i < amr_max_channels; ++i) m_decoders[i] = NULL;
+	}
+	~amr2wav_worker() {
+		for (unsigned i = 0; i < amr_max_channels; ++i) if (m_decoders[i] != NULL) Decoder_Interface_exit(m_decoders[i]);
+	}
+
+	/**
+	 * Converts a file, as input_amr decodes it: frames of a multichannel file are one frame of each channel in a row,
+	 * and frame cut short by the end of file is left out, with frames of other channels before it. Damaged data in
+	 * single channel files is skipped up to where frames start again, see amr_frame_reader::find_run().
+	 *
+	 * @param p_in			path to AMR file
+	 * @param p_out			paths to WAV files to write, one of each format, in order
+	 * @param p_error		receives what went wrong, if anything did
+	 * @return				<code>true</code> if the file was converted
+	 * @since				1.2.0
+	 */
+	bool convert(const std::string & p_in, const std::vector<std::string> & p_out, std::string & p_error) {
+		std::vector<unsigned char> data;
+		if (!load(p_in, data)) {
+			p_error = "can't read the file";
+			return false;
+		}
+
+		unsigned channels, start;
+		if (data.size() >= amr_magic_size && memcmp(data.data(), g_magic, amr_magic_size) == 0) {
+			channels = 1;
+			start = amr_magic_size;
+		}
+		else if (data.size() >= amr_mc_header_size && memcmp(data.data(), g_magic_mc, amr_mc_magic_size) == 0) {
+			channels = data[amr_mc_header_size - 1] & 0x0F;
+			start = amr_mc_header_size;
+			if (channels == 0 || channels > amr_max_channels) {
+				p_error = "unsupported number of channels";
+				return false;
+			}
+		}
+		else {
+			p_error = "not an AMR-NB file";
+			return false;
+		}
+
+		for (unsigned i = 0; i < channels; ++i) {
+			if (m_decoders[i] == NULL) m_decoders[i] = Decoder_Interface_init();
+			else Decoder_Interface_reset(m_decoders[i]);
+			if (m_decoders[i] == NULL) {
+				p_error = "out of memory";
+				return false;
+			}
+		}
+
+		/* progress is there before outputs are, so outputs without it are of files converted in full */
+		amr2wav_progress progress;
+		progress.m_pos = start;
+		const bool resumed = m_resume && load_progress(p_out, data, channels, progress);
+		if (!resumed) {
+			progress = amr2wav_progress();
+			progress.m_hash = amr2wav_hash(amr2wav_hash_basis, data.data(), start);
+			progress.m_pos = start;
+			if (m_resume) save_progress(p_out, data, channels, start, 0, std::vector<FILE *>(), progress);
+		}
+
+		const size_t outputs = m_formats.size();
+		std::vector<FILE *> out(outputs, (FILE *)NULL);
+		/* headers are written again once the length is known */
+		unsigned char header[amr2wav_g711_header_size];
+		bool ok = true;
+		for (size_t k = 0; k < outputs; ++k) {
+			/* resumed output is written again from where progress was saved, the same as it was */
+			out[k] = fopen(p_out[k].c_str(), resumed ? "r+b" : "wb");
+			if (out[k] == NULL) {
+				close(out, p_out);
+				p_error = "can't create " + p_out[k];
+				return false;
+			}
+			if (resumed) ok = amr2wav_fseek(out[k], output_size(k, channels, progress.m_samples), SEEK_SET) == 0 && ok;
+			else {
+				const unsigned header_size = amr2wav_header(header, m_formats[k], channels, 0);
+				ok = fwrite(header, 1, header_size, out[k]) == header_size && ok;
+			}
+		}
+		if (resumed) {
+			const size_t size = Decoder_Interface_snapshot_size();
+			for (unsigned i = 0; i < channels; ++i) Decoder_Interface_restore(m_decoders[i], progress.m_snapshots.data() + i * size);
+		}
+
+		unsigned samples = progress.m_samples;
+		size_t pos = progress.m_pos;
+		if (channels == 1) {
+			/* runs of frames with valid headers are decoded a block at a time */
+			m_samples.resize(amr2wav_block_frames * amr_frame_samples);
+			m_codes.resize(amr2wav_block_frames * amr_frame_samples);
+			while (ok && pos < data.size()) {
+				if (!amr_frame_reader::is_frame_header(data[pos])) {
+					pos += 1 + amr_frame_reader::find_run(data.data() + pos + 1, data.size() - pos - 1, Decoder_Interface_block_size, true);
+					continue;
+				}
+				size_t end = pos;
+				unsigned frames = 0;
+				while (frames < amr2wav_block_frames && end < data.size() && amr_frame_reader::is_frame_header(data[end])) {
+					const size_t length = 1 + Decoder_Interface_block_size[(data[end] >> 3) & 0x0F];
+					if (data.size() - end < length) break;
+					end += length;
+					++frames;
+				}
+				if (frames == 0) break;
+				/* G.711 alone is coded by the decoder while each frame is in cache */
+				if (outputs == 1 && m_formats[0] != amr2wav_pcm) {
+					Decoder_Interface_DecodeN_g711(m_decoders[0], data.data() + pos, (int)(end - pos), m_codes.data(), law(m_formats[0]), frames, NULL);
+					ok = fwrite(m_codes.data(), 1, frames * amr_frame_samples, out[0]) == (size_t)frames * amr_frame_samples;
+				}
+				else {
+					Decoder_Interface_DecodeN(m_decoders[0], data.data() + pos, (int)(end - pos), m_samples.data(), frames, NULL);
+					ok = write(m_samples.data(), frames * amr_frame_samples, out);
+				}
+				pos = end;
+				samples += frames * amr_frame_samples;
+				if (m_resume && ok && samples - progress.m_samples >= amr2wav_progress_frames * amr_frame_samples) save_progress(p_out, data, channels, pos, samples, out, progress);
+			}
+		}
+		else {
+			m_samples.resize(amr_frame_samples * channels);
+			m_channel.resize(amr_frame_samples);
+			m_codes.resize(amr_frame_samples * channels);
+			while (ok) {
+				/* frame of every channel has to be there */
+				size_t end = pos;
+				unsigned i = 0;
+				for (; i < channels && end < data.size(); ++i) end += 1 + Decoder_Interface_block_size[(data[end] >> 3) & 0x0F];
+				if (i < channels || end > data.size()) break;
+				for (i = 0; i < channels; ++i) {
+					Decoder_Interface_Decode(m_decoders[i], data.data() + pos, m_channel.data(), 0);
+					for (unsigned j = 0; j < amr_frame_samples; ++j) m_samples[j * channels + i] = m_channel[j];
+					pos += 1 + Decoder_Interface_block_size[(data[pos] >> 3) & 0x0F];
+				}
+				ok = write(m_samples.data(), m_samples.size(), out);
+				samples += amr_frame_samples;
+				if (m_resume && ok && samples - progress.m_samples >= amr2wav_progress_frames * amr_frame_samples) save_progress(p_out, data, channels, pos, samples, out, progress);
+			}
+		}
+
+		for (size_t k = 0; k < outputs && ok; ++k) {
+			const unsigned header_size = amr2wav_header(header, m_formats[k], channels, samples);
+			ok = fseek(out[k], 0, SEEK_SET) == 0 && fwrite(header, 1, header_size, out[k]) == header_size;
+		}
+		for (size_t k = 0; k < outputs; ++k) if (fclose(out[k]) != 0) ok = false;
+		if (!ok) {
+			for (size_t k = 0; k < outputs; ++k) remove(p_out[k].c_str());
+			p_error = outputs == 1 ? "can't write " + p_out[0] : "can't write the files";
+		}
+		/* outputs done or gone, so a run after starts over, or takes the file for converted */
+		if (m_resume) remove_progress(p_out);
+		return ok;
+	}
+
+	/* whether outputs of a file are there, with no progress saved for them, as a file converted in full by a run with p_resume */
+	static bool is_converted(const std::vector<std::string> & p_out) {
+		for (size_t k = 0; k < p_out.size(); ++k) {
+			FILE * f = fopen(p_out[k].c_str(), "rb");
+			if (f == NULL) return false;
+			fclose(f);
+		}
+		return !exists(p_out[0] + g_progress_extension) && !exists(p_out[0] + g_progress_temp_extension);
+	}
+
+private:
+	/* bytes of output p_output with p_samples per channel written */
+	unsigned long long output_size(size_t p_output, unsigned p_channels, unsigned p_samples) const {
+		const unsigned bytes = m_formats[p_output] == amr2wav_pcm ? 2 : 1;
+		const unsigned header = m_formats[p_output] == amr2wav_pcm ? amr2wav_wav_header_size : amr2wav_g711_header_size;
+		return header + (unsigned long long)p_samples * p_channels * bytes;
+	}
+
+	/**
+	 * Saves where conversion got to in file.wav.resume next to the first output: input offset of the next frame and
+	 * hash of input before it, samples per channel written, and decoder snapshots. Outputs are flushed first, so they
+	 * hold all that was written before, and a run resumed writes the rest as an uninterrupted one would. It's written
+	 * to file.wav.resume.tmp, then put in place of the one before; the temporary one is read if the process is killed
+	 * in between. Failure only keeps the progress saved before, which is as good, if older.
+	 *
+	 * @param p_out			paths of outputs
+	 * @param p_data		input
+	 * @param p_channels	number of channels
+	 * @param p_pos			input offset of the next frame
+	 * @param p_samples		samples per channel written
+	 * @param p_files		outputs, none before they're created
+	 * @param p_progress	progress saved before, receives this one
+	 * @since				1.2.0
+	 */
+	void save_progress(const std::vector<std::string> & p_out, const std::vector<unsigned char> & p_data, unsigned p_channels, size_t p_pos,
+		unsigned p_samples, const std::vector<FILE *> & p_files, amr2wav_progress & p_progress) {
+		p_progress.m_hash = amr2wav_hash(p_progress.m_hash, p_data.data() + p_progress.m_pos, p_pos - p_progress.m_pos);
+		p_progress.m_pos = p_pos;
+		p_progress.m_samples = p_samples;
+		for (size_t k = 0; k < p_files.size(); ++k) if (fflush(p_files[k]) != 0) return;
+
+		const size_t size = Decoder_Interface_snapshot_size();
+		std::vector<unsigned char> record(8 + 4 * 5 + 4 * m_formats.size() + 8 * 3 + p_channels * size);
+		unsigned char * p = record.data();
+		memcpy(p, g_progress_magic, 8); p += 8;
+		amr2wav_put(p, amr2wav_progress_version, 4); p += 4;
+		amr2wav_put(p, p_channels, 4); p += 4;
+		amr2wav_put(p, (unsigned)m_formats.size(), 4); p += 4;
+		for (size_t k = 0; k < m_formats.size(); ++k, p += 4) amr2wav_put(p, m_formats[k], 4);
+		amr2wav_put(p, p_data.size(), 8); p += 8;
+		amr2wav_put(p, p_pos, 8); p += 8;
+		amr2wav_put(p, p_progress.m_hash, 8); p += 8;
+		amr2wav_put(p, p_samples, 4); p += 4;
+		amr2wav_put(p, (unsigned)size, 4); p += 4;
+		for (unsigned i = 0; i < p_channels; ++i, p += size) Decoder_Interface_snapshot(m_decoders[i], p);
+		/* hash of the record, so one cut short is told from a whole one */
+		unsigned char check[8];
+		amr2wav_put(check, amr2wav_hash(amr2wav_hash_basis, record.data(), record.size()), 8);
+		record.insert(record.end(), check, check + 8);
+
+		const std::string path = p_out[0] + g_progress_extension;
+		const std::string temp = p_out[0] + g_progress_temp_extension;
+		FILE * f = fopen(temp.c_str(), "wb");
+		if (f == NULL) return;
+		const bool written = fwrite(record.data(), 1, record.size(), f) == record.size();
+		if (fclose(f) != 0 || !written) return;
+		/* rename doesn't replace a file on Windows */
+		remove(path.c_str());
+		rename(temp.c_str(), path.c_str());
+	}
+
+	/**
+	 * Reads progress saved by save_progress(), from file.wav.resume, or file.wav.resume.tmp if that's not there or not
+	 * whole. It's taken only if it's of the same formats and build of the decoder, input is the same up to where it
+	 * got, and outputs are there and hold all that was written by then.
+	 *
+	 * @param p_out			paths of outputs
+	 * @param p_data		input
+	 * @param p_channels	number of channels
+	 * @param p_progress	receives the progress
+	 * @return				<code>true</code> if conversion is to resume from p_progress
+	 * @since				1.2.0
+	 */
+	bool load_progress(const std::vector<std::string> & p_out, const std::vector<unsigned char> & p_data, unsigned p_channels, amr2wav_progress & p_progress) const {
+		const size_t size = Decoder_Interface_snapshot_size();
+		const size_t record_size = 8 + 4 * 5 + 4 * m_formats.size() + 8 * 3 + p_channels * size + 8;
+		std::vector<unsigned char> record;
+		bool found = false;
+		for (unsigned attempt = 0; attempt < 2 && !found; ++attempt) {
+			found = load(p_out[0] + (attempt == 0 ? g_progress_extension : g_progress_temp_extension), record) && record.size() == record_size
+				&& amr2wav_hash(amr2wav_hash_basis, record.data(), record_size - 8) == amr2wav_get(record.data() + record_size - 8, 8);
+		}
+		if (!found) return false;
+
+		const unsigned char * p = record.data();
+		if (memcmp(p, g_progress_magic, 8) != 0) return false;
+		p += 8;
+		if (amr2wav_get(p, 4) != amr2wav_progress_version || amr2wav_get(p + 4, 4) != p_channels || amr2wav_get(p + 8, 4) != m_formats.size()) return false;
+		p += 12;
+		for (size_t k = 0; k < m_formats.size(); ++k, p += 4) if (amr2wav_get(p, 4) != (unsigned)m_formats[k]) return false;
+		if (amr2wav_get(p, 8) != p_data.size()) return false;
+		const unsigned long long pos = amr2wav_get(p + 8, 8);
+		if (pos > p_data.size()) return false;
+		p_progress.m_pos = (size_t)pos;
+		p_progress.m_hash = amr2wav_get(p + 16, 8);
+		p_progress.m_samples = (unsigned)amr2wav_get(p + 24, 4);
+		if (amr2wav_get(p + 28, 4) != size) return false;
+		p += 32;
+		p_progress.m_snapshots.assign(p, p + p_channels * size);
+		if (p_progress.m_samples == 0 || amr2wav_hash(amr2wav_hash_basis, p_data.data(), p_progress.m_pos) != p_progress.m_hash) return false;
+
+		for (size_t k = 0; k < p_out.size(); ++k) {
+			FILE * f = fopen(p_out[k].c_str(), "rb");
+			if (f == NULL) return false;
+			const bool whole = amr2wav_fseek(f, 0, SEEK_END) == 0 && (unsigned long long)amr2wav_ftell(f) >= output_size(k, p_channels, p_progress.m_samples);
+			fclose(f);
+			if (!whole) return false;
+		}
+		return true;
+	}
+
+	/* removes saved progress of a file */
+	static void remove_progress(const std::vector<std::string> & p_out) {
+		remove((p_out[0] + g_progress_extension).c_str());
+		remove((p_out[0] + g_progress_temp_extension).c_str());
+	}
+
+	static bool exists(const std::string & p_path) {
+		FILE * f = fopen(p_path.c_str(), "rb");
+		if (f == NULL) return false;
+		fclose(f);
+		return true;
+	}
+
+	static int law(amr2wav_format p_format) {
+		return p_format == amr2wav_alaw ? DEC_G711_ALAW : DEC_G711_ULAW;
+	}
+
+	/* writes p_count samples, interleaved, to each output in its format */
+	bool write(const short * p_samples, size_t p_count, const std::vector<FILE *> & p_out) {
+		for (size_t k = 0; k < p_out.size(); ++k) {
+			if (m_formats[k] == amr2wav_pcm) {
+				if (fwrite(p_samples, 2, p_count, p_out[k]) != p_count) return false;
+				continue;
+			}
+			Decoder_Interface_Code_g711(p_samples, m_codes.data(), (int)p_count, law(m_formats[k]));
+			if (fwrite(m_codes.data(), 1, p_count, p_out[k]) != p_count) return false;
+		}
+		return true;
+	}
+
+	/* closes and removes outputs created before one that couldn't be */
+	static void close(const std::vector<FILE *> & p_out, const std::vector<std::string> & p_paths) {
+		for (size_t k = 0; k < p_out.size() && p_out[k] != NULL; ++k) {
+			fclose(p_out[k]);
+			remove(p_paths[k].c_str());
+		}
+	}
+
+	/* reads whole file; AMR is 1.6 kB per second at most, an hour is below 6 MB */
+	static bool load(const std::string & p_path, std::vector<unsigned char> & p_out) {
+		FILE * f = fopen(p_path.c_str(), "rb");
+		if (f == NULL) return false;
+		bool ok = fseek(f, 0, SEEK_END) == 0;
+		const long size = ok ? ftell(f) : -1;
+		ok = size >= 0 && fseek(f, 0, SEEK_SET) == 0;
+		if (ok) {
+			p_out.resize((size_t)size);
+			ok = fread(p_out.data(), 1, p_out.size(), f) == p_out.size();
+		}
+		fclose(f);
+		return ok;
+	}
+
+	const std::vector<amr2wav_format> m_formats;
+	const bool m_resume;
+	void * m_decoders[amr_max_channels];
+	std::vector<short> m_samples, m_channel;
+	/* G.711 codes of a block, or of a frame of each channel */
+	std::vector<unsigned char> m_codes;
+};
+
+/* path of WAV file of given AMR file: extension replaced by p_extension, in p_dir if it's not empty */
+static std::string amr2wav_output_path(const std::string & p_in, const std::string & p_dir, const char * p_extension) {
+	const size_t slash = p_in.find_last_of("/\\");
+	const size_t name = slash == std::string::npos ? 0 : slash + 1;
+	std::string out = p_dir.empty() ? p_in : p_dir + "/" + p_in.substr(name);
+	const size_t dot = out.find_last_of('.');
+	if (dot != std::string::npos && dot > out.size() - (p_in.size() - name)) out.resize(dot);
+	return out + p_extension;
+}
+
+/* appends non-empty lines of p_path to p_out */
+static bool amr2wav_read_list(const char * p_path, std::vector<std::string> & p_out) {
+	FILE * f = strcmp(p_path, "-") == 0 ? stdin : fopen(p_path, "r");
+	if (f == NULL) return false;
+	char line[4096];
+	while (fgets(line, sizeof(line), f) != NULL) {
+		size_t n = strlen(line);
+		while (n > 0 && (line[n - 1] == '\n' || line[n - 1] == '\r')) line[--n] = 0;
+		if (n > 0) p_out.push_back(line);
+	}
+	if (f != stdin) fclose(f);
+	return true;
+}
+
+/* format named p_name; false if there's none of that name */
+static bool amr2wav_parse_format(const std::string & p_name, amr2wav_format & p_out) {
+	if (p_name == "pcm") p_out = amr2wav_pcm;
+	else if (p_name == "alaw") p_out = amr2wav_alaw;
+	else if (p_name == "ulaw") p_out = amr2wav_ulaw;
+	else return false;
+	return true;
+}
+
+static void amr2wav_usage() {
+	fputs("usage: amr2wav [-j threads] [-o directory] [-l list] [-g alaw|ulaw] [-t formats] [-r] [file.amr ...]\n"
+		"  -j  number of worker threads, one per CPU by default\n"
+		"  -o  directory to write WAV files to, next to AMR files by default\n"
+		"  -l  file with one AMR file path per line, - for standard input\n"
+		"  -g  write 8-bit G.711 A-law or u-law instead of 16-bit PCM, as telephone systems take it\n"
+		"  -t  write each file in every one of comma separated formats, pcm, alaw and ulaw, decoding it once;\n"
+		"      files are file.wav, file.alaw.wav and file.ulaw.wav\n"
+		"  -r  resumable: save progress of each file in file.wav.resume every minute of audio, and resume files\n"
+		"      a run killed before left off where it was saved, with the same output; files converted in full\n"
+		"      by such a run, whose outputs are there with no progress left, are not converted again\n", stderr);
+}
+
+/**
+ * Converts files given, and those listed in list files, each worker thread taking the next file not taken yet.
+ * Exit code is 0 if all of them were converted, 1 if any failed, 2 for bad arguments.
+ */
+int main(int argc, char ** argv) {
+	std::vector<std::string> files;
+	std::string dir;
+	std::vector<amr2wav_format> formats(1, amr2wav_pcm);
+	unsigned threads = std::thread::hardware_concurrency();
+	bool resume = false;
+	for (int i = 1; i < argc; ++i) {
+		if (strcmp(argv[i], "-j") == 0 && i + 1 < argc) threads = (unsigned)atoi(argv[++i]);
+		else if (strcmp(argv[i], "-r") == 0) resume = true;
+		else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) dir = argv[++i];
+		else if (strcmp(argv[i], "-g") == 0 && i + 1 < argc) {
+			++i;
+			if (strcmp(argv[i], "alaw") == 0) formats.assign(1, amr2wav_alaw);
+			else if (strcmp(argv[i], "ulaw") == 0) formats.assign(1, amr2wav_ulaw);
+			else {
+				amr2wav_usage();
+				return 2;
+			}
+		}
+		else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+			formats.clear();
+			const std::string list = argv[++i];
+			for (size_t pos = 0; pos <= list.size(); ) {
+				size_t comma = list.find(',', pos);
+				if (comma == std::string::npos) comma = list.size();
+				amr2wav_format format;
+				if (!amr2wav_parse_format(list.substr(pos, comma - pos), format) || std::find(formats.begin(), formats.end(), format) != formats.end()) {
+					amr2wav_usage();
+					return 2;
+				}
+				formats.push_back(format);
+				pos = comma + 1;
+			}
+		}
+		else if (strcmp(argv[i], "-l") == 0 && i + 1 < argc) {
+			if (!amr2wav_read_list(argv[++i], files)) {
+				fprintf(stderr, "amr2wav: can't read list %s\n", argv[i]);
+				return 2;
+			}
+		}
+		else if (argv[i][0] == '-' && argv[i][1] != 0) {
+			amr2wav_usage();
+			return 2;
+		}
+		else files.push_back(argv[i]);
+	}
+	if (files.empty()) {
+		amr2wav_usage();
+		return 2;
+	}
+	if (threads == 0) threads = 1;
+	if (threads > files.size()) threads = (unsigned)files.size();
+
+	/* one format keeps the plain name; several are told apart by their law */
+	static const char * const extensions[] = { ".wav", ".alaw.wav", ".ulaw.wav" };
+
+	/* has to happen before any decoder exists */
+	Decoder_Interface_select_kernels(amr2wav_cpu_features());
+
+	std::atomic<size_t> next(0);
+	std::atomic<unsigned> failed(0);
+	std::vector<std::thread> workers;
+	for (unsigned t = 0; t < threads; ++t) {
+		workers.push_back(std::thread([&] {
+			amr2wav_worker worker(formats, resume);
+			std::string error;
+			std::vector<std::string> out(formats.size());
+			for (size_t i; (i = next++) < files.size(); ) {
+				for (size_t k = 0; k < formats.size(); ++k) out[k] = amr2wav_output_path(files[i], dir, formats.size() == 1 ? ".wav" : extensions[formats[k]]);
+				if (resume && amr2wav_worker::is_converted(out)) continue;
+				if (worker.convert(files[i], out, error)) continue;
+				/* one call, so lines of different threads don't mix */
+				fprintf(stderr, "amr2wav: %s: %s\n", files[i].c_str(), error.c_str());
+				++failed;
+			}
+		}));
+	}
+	for (size_t t = 0; t < workers.size(); ++t) workers[t].join();
+
+	if (failed > 0) fprintf(stderr, "amr2wav: %u of %u files failed\n", (unsigned)failed, (unsigned)files.size());
+	return failed > 0 ? 1 : 0;
+}
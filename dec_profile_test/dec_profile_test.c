@@ -0,0 +1,146 @@
+/**
+ * dec_profile_test - checks of the DEC_PROFILE build of the decoder, outside foobar2000: a stream of speech with
+ * DTX pauses, SID frames and NO_DATA frames, some of them with no mode, is decoded frame by frame and in batches.
+ * Output must be the same both ways, and every frame counted once, NO_DATA ones as NO_DATA, by counters of the
+ * decoder; those of a frame counted past the end of them would be written over the decoder's state. Exits with 0
+ * if so, 1 if not; run under a bounds checker, it also catches counters indexed out of their arrays
+*/
+#include <stdio.h>
+#include <string.h>
+#include "../3gpp/interf_dec.h"
+#include "../3gpp/sp_dec.h"
+
+#ifndef DEC_PROFILE
+#error dec_profile_test is to be built with DEC_PROFILE defined
+#endif
+
+enum {
+	/* frames of a talk spurt and the pause after it, and how many of them the stream has */
+	dec_profile_test_cycle = 40,
+	dec_profile_test_cycles = 50,
+	dec_profile_test_frames = dec_profile_test_cycle * dec_profile_test_cycles,
+	dec_profile_test_samples = 160,
+	/* largest frame, 12.2 kbit/s: header byte and 31 bytes of data */
+	dec_profile_test_max_frame = 32,
+	/* frames decoded at a time in batches */
+	dec_profile_test_batch = 25,
+};
+
+/* storage format frame headers: frame type, and the quality bit */
+#define DEC_PROFILE_TEST_SPEECH 0x3C
+#define DEC_PROFILE_TEST_SPEECH_BAD 0x38
+#define DEC_PROFILE_TEST_SID 0x44
+#define DEC_PROFILE_TEST_NO_DATA 0x7C
+/* NO_DATA without the quality bit is decoded with mode 15, which no counters are kept for */
+#define DEC_PROFILE_TEST_NO_DATA_BAD 0x78
+
+static unsigned char g_stream[dec_profile_test_frames * dec_profile_test_max_frame];
+static short g_single[dec_profile_test_frames * dec_profile_test_samples];
+static short g_batch[dec_profile_test_frames * dec_profile_test_samples];
+
+/* pseudo random bytes, the same on every run */
+static unsigned g_seed = 1;
+static unsigned char dec_profile_test_random( void )
+{
+	g_seed = g_seed * 1103515245 + 12345;
+	return ( unsigned char )( g_seed >> 16 );
+}
+
+/* appends a frame of the header, with data of its size, to the stream at pos; returns its end */
+static int dec_profile_test_frame( int pos, unsigned char header, int sid_update )
+{
+	const int size = 1 + Decoder_Interface_block_size[( header >> 3 ) & 0x0F];
+	int i;
+
+
+	g_stream[pos] = header;
+	for ( i = 1; i < size; i++ )
+		g_stream[pos + i] = dec_profile_test_random( );
+
+	/* SID type bit, after the 35 bits of comfort noise parameters */
+	if ( header == DEC_PROFILE_TEST_SID )
+		g_stream[pos + 5] = sid_update ? 0xF0 : 0x00;
+	return pos + size;
+}
+
+/* a talk spurt, some of it damaged, and a pause of SID and NO_DATA frames after it, each time; NO_DATA frames go to *no_data */
+static int dec_profile_test_build( int *no_data )
+{
+	int pos = 0, cycle, n;
+
+
+	for ( cycle = 0; cycle < dec_profile_test_cycles; cycle++ ) {
+		for ( n = 0; n < dec_profile_test_cycle; n++ ) {
+			if ( n < 12 )
+				pos = dec_profile_test_frame( pos, n == 7 ? DEC_PROFILE_TEST_SPEECH_BAD : DEC_PROFILE_TEST_SPEECH, 0 );
+			else if ( n == 12 || n == 20 || n == 28 )
+				pos = dec_profile_test_frame( pos, DEC_PROFILE_TEST_SID, n != 12 );
+			else {
+				pos = dec_profile_test_frame( pos, ( n + cycle ) % 3 == 0 ? DEC_PROFILE_TEST_NO_DATA_BAD : DEC_PROFILE_TEST_NO_DATA, 0 );
+				++*no_data;
+			}
+		}
+	}
+	return pos;
+}
+
+/* checks frames counted by counters of the decoder, which are cleared; returns 0 if they're all there, 1 if not */
+static int dec_profile_test_counted( void *decoder, const char *name, int no_data )
+{
+	struct Dec_profile profile;
+	unsigned long long frames = 0, no_data_frames = 0;
+	int mode, type;
+
+
+	Decoder_Interface_profile( decoder, &profile );
+	for ( mode = 0; mode < N_MODES; mode++ ) {
+		for ( type = 0; type < RX_N_FRAMETYPES; type++ )
+			frames += profile.frames[mode][type];
+		no_data_frames += profile.frames[mode][RX_NO_DATA];
+	}
+	if ( frames == dec_profile_test_frames && no_data_frames == ( unsigned long long )no_data )
+		return 0;
+	fprintf( stderr, "Frames counted %s: %llu of %d, %llu of %d NO_DATA ones\n", name, frames, dec_profile_test_frames, no_data_frames, no_data );
+	return 1;
+}
+
+int main( void )
+{
+	int no_data = 0;
+	const int size = dec_profile_test_build( &no_data );
+	void *single = Decoder_Interface_init( );
+	void *batch = Decoder_Interface_init( );
+	int pos = 0, n, used, failed = 0;
+
+
+	if ( single == NULL || batch == NULL ) {
+		fprintf( stderr, "Could not create decoders\n" );
+		return 1;
+	}
+
+	for ( n = 0; n < dec_profile_test_frames; n++ ) {
+		Decoder_Interface_Decode( single, g_stream + pos, g_single + n * dec_profile_test_samples, 0 );
+		pos += 1 + Decoder_Interface_block_size[( g_stream[pos] >> 3 ) & 0x0F];
+	}
+	pos = 0;
+	for ( n = 0; n < dec_profile_test_frames; n += dec_profile_test_batch ) {
+		Decoder_Interface_DecodeN( batch, g_stream + pos, size - pos, g_batch + n * dec_profile_test_samples, dec_profile_test_batch, &used );
+		pos += used;
+	}
+
+	if ( memcmp( g_single, g_batch, sizeof( g_single ) ) != 0 ) {
+		fprintf( stderr, "Output decoded in batches differs from that decoded frame by frame\n" );
+		failed = 1;
+	}
+
+	/* pauses are too short for comfort noise to be muted, so no frame is skipped before it's counted */
+	failed |= dec_profile_test_counted( single, "frame by frame", no_data );
+	failed |= dec_profile_test_counted( batch, "in batches", no_data );
+
+	Decoder_Interface_exit( single );
+	Decoder_Interface_exit( batch );
+	if ( failed )
+		return 1;
+	printf( "%d frames ok, %d of them NO_DATA\n", dec_profile_test_frames, no_data );
+	return 0;
+}
@@ -0,0 +1,175 @@
+/**
+ * foo_input_amr - voice activity of AMR files from their index, without decoding
+*/
+#include "../foo_sdk/foobar2000/SDK/foobar2000.h"
+#include <memory>
+#include "amr_activity.h"
+
+enum {
+	/* frames are 20ms */
+	amr_activity_frame_ms = 20,
+	/* cue sheet time is in 75ths of a second */
+	amr_activity_cue_rate = 75,
+};
+
+/* formats runs of speech are exported in */
+enum amr_activity_format {
+	amr_activity_csv,
+	amr_activity_json,
+	amr_activity_cue,
+	amr_activity_formats,
+};
+
+/* seconds of a frame, to the millisecond */
+static pfc::string8 amr_activity_seconds(unsigned p_frame) {
+	return pfc::format_float((double)p_frame * amr_activity_frame_ms / 1000, 0, 3);
+}
+
+/* cue sheet time of a frame, mm:ss:ff */
+static pfc::string8 amr_activity_cue_time(unsigned p_frame) {
+	const t_uint64 ff = (t_uint64)p_frame * amr_activity_frame_ms * amr_activity_cue_rate / 1000;
+	const t_uint64 seconds = ff / amr_activity_cue_rate;
+	return pfc::string_formatter() << pfc::format_uint(seconds / 60, 2) << ":" << pfc::format_uint(seconds % 60, 2) << ":" << pfc::format_uint(ff % amr_activity_cue_rate, 2);
+}
+
+pfc::string8 amr_activity_json_string(const char * p_text) {
+	pfc::string_formatter out;
+	out << "\"";
+	for (const char * p = p_text; *p; ++p) {
+		if (*p == '"' || *p == '\\') out << "\\" << pfc::string8(p, 1);
+		else if ((unsigned char)*p < 0x20) out << "\\u" << pfc::format_hex((unsigned char)*p, 4);
+		else out.add_byte(*p);
+	}
+	out << "\"";
+	return out;
+}
+
+/**
+ * Runs of speech in given format: CSV of start and end seconds, JSON object with path of the file and
+ * its runs, or cue sheet with a track per run, so players show them as chapters.
+ *
+ * @param p_path		path of the file
+ * @param p_segments	its runs of speech
+ * @param p_format		format
+ * @return				text of the export
+ * @since				1.2.0
+ */
+static pfc::string8 amr_activity_format_text(const char * p_path, const pfc::list_t<amr_activity_segment> & p_segments, amr_activity_format p_format) {
+	pfc::string_formatter out;
+	if (p_format == amr_activity_csv) {
+		out << "start,end\r\n";
+		for (t_size i = 0; i < p_segments.get_count(); ++i) {
+			out << amr_activity_seconds(p_segments[i].m_begin) << "," << amr_activity_seconds(p_segments[i].m_end) << "\r\n";
+		}
+	}
+	else if (p_format == amr_activity_json) {
+		pfc::string8 display;
+		filesystem::g_get_display_path(p_path, display);
+		out << "{\"file\": " << amr_activity_json_string(display) << ", \"speech\": [";
+		for (t_size i = 0; i < p_segments.get_count(); ++i) {
+			if (i > 0) out << ", ";
+			out << "{\"start\": " << amr_activity_seconds(p_segments[i].m_begin) << ", \"end\": " << amr_activity_seconds(p_segments[i].m_end) << "}";
+		}
+		out << "]}\r\n";
+	}
+	else {
+		/* first track starts at the start of the file; its speech may come later */
+		out << "FILE \"" << pfc::string_filename_ext(p_path) << "\" WAVE\r\n";
+		for (t_size i = 0; i < p_segments.get_count(); ++i) {
+			out << "  TRACK " << pfc::format_uint(i + 1, 2) << " AUDIO\r\n";
+			out << "    TITLE \"Speech " << (i + 1) << "\"\r\n";
+			if (i == 0 && p_segments[i].m_begin > 0) out << "    INDEX 00 00:00:00\r\n";
+			out << "    INDEX 01 " << amr_activity_cue_time(p_segments[i].m_begin) << "\r\n";
+		}
+	}
+	return out;
+}
+
+/**
+ * Writes runs of speech of each file to a file next to it, as name.speech.csv, .json or .cue.
+ *
+ * @return				report, a line per file
+ * @since				1.2.0
+ */
+static pfc::string8 amr_activity_export(const pfc::list_t<pfc::string8> & p_paths, amr_activity_format p_format, threaded_process_status & p_status, abort_callback & p_abort) {
+	static const char * const extensions[amr_activity_formats] = { "csv", "json", "cue" };
+	pfc::string_formatter report;
+	for (t_size i = 0; i < p_paths.get_count(); ++i) {
+		p_status.set_progress(i, p_paths.get_count());
+		const char * path = p_paths[i];
+		try {
+			pfc::list_t<amr_activity_segment> segments;
+			amr_find_activity(path, segments, p_abort);
+			pfc::string8 out_path = path;
+			out_path.truncate(out_path.length() - pfc::string_extension(path).length() - 1);
+			out_path << ".speech." << extensions[p_format];
+			const pfc::string8 text = amr_activity_format_text(path, segments, p_format);
+			service_ptr_t<file> out;
+			filesystem::g_open_write_new(out, out_path, p_abort);
+			out->write(text.get_ptr(), text.length(), p_abort);
+			unsigned frames = 0;
+			for (t_size s = 0; s < segments.get_count(); ++s) frames += segments[s].m_end - segments[s].m_begin;
+			report << out_path << ": " << segments.get_count() << " runs of speech, " << amr_activity_seconds(frames) << " seconds\n";
+		} catch (exception_aborted const &) {
+			throw;
+		} catch (std::exception const & e) {
+			report << path << ": " << e.what() << "\n";
+		}
+	}
+	return report;
+}
+
+/**
+ * "Export AMR voice activity" items in the Utilities context menu, one per format. Runs of speech come
+ * from the index, see amr_find_activity(), so no frame is decoded; files with no index cached have
+ * their frame headers walked. Report goes to the console.
+ *
+ * @since   1.2.0
+ */
+class amr_activity_item_menu : public contextmenu_item_simple {
+public:
+	GUID get_parent() { return contextmenu_groups::utilities; }
+	unsigned get_num_items() { return amr_activity_formats; }
+	void get_item_name(unsigned p_index, pfc::string_base & p_out) {
+		static const char * const names[amr_activity_formats] = { "Export AMR voice activity as CSV", "Export AMR voice activity as JSON", "Export AMR voice activity as chapters" };
+		p_out = names[p_index];
+	}
+	bool get_item_description(unsigned p_index, pfc::string_base & p_out) {
+		p_out = "Writes start and end of each run of speech of the selected AMR files next to them, taken from frame types without decoding.";
+		return true;
+	}
+	GUID get_item_guid(unsigned p_index) {
+		static const GUID guids[amr_activity_formats] = {
+			{ 0x3e7a91c5, 0x8b02, 0x4f6d,{ 0xa1, 0x5c, 0x26, 0xd8, 0x0b, 0x97, 0xe4, 0x13 } },
+			{ 0x91c4f20b, 0x6d3e, 0x4a75,{ 0x8f, 0x19, 0xb0, 0x5e, 0x42, 0xc7, 0x3a, 0xd6 } },
+			{ 0xc05d8e36, 0x27a9, 0x4b14,{ 0x96, 0xe2, 0x7f, 0x31, 0xad, 0x58, 0x0c, 0x9b } },
+		};
+		return guids[p_index];
+	}
+	void context_command(unsigned p_index, metadb_handle_list_cref p_data, const GUID & p_caller) {
+		/* tracks of a file split at pauses are one file */
+		pfc::list_t<pfc::string8> paths;
+		for (t_size i = 0; i < p_data.get_count(); ++i) {
+			const char * path = p_data[i]->get_path();
+			if (stricmp_utf8(pfc::string_extension(path), "amr") != 0) continue;
+			bool seen = false;
+			for (t_size j = 0; j < paths.get_count() && !seen; ++j) seen = strcmp(paths[j], path) == 0;
+			if (!seen) paths.add_item(path);
+		}
+		if (paths.get_count() == 0) return;
+		const amr_activity_format format = (amr_activity_format)p_index;
+		std::shared_ptr<pfc::string8> report = std::make_shared<pfc::string8>();
+		threaded_process::g_run_modeless(threaded_process_callback_lambda::create(nullptr,
+			[paths, format, report](threaded_process_status & p_status, abort_callback & p_abort) {
+				*report = amr_activity_export(paths, format, p_status, p_abort);
+			},
+			[report](HWND p_wnd, bool p_was_aborted) {
+				if (p_was_aborted) return;
+				console::formatter() << "AMR voice activity: " << *report;
+			}),
+			threaded_process::flag_show_progress | threaded_process::flag_show_abort,
+			core_api::get_main_window(), "Exporting AMR voice activity");
+	}
+};
+
+static contextmenu_item_factory_t<amr_activity_item_menu> g_amr_activity_item_menu;
@@ -0,0 +1,32 @@
+/**
+ * foo_input_amr - voice activity of AMR files from their index, without decoding
+*/
+#pragma once
+
+/**
+ * Run of speech in a file, in 20ms frames. Frame types tell speech from comfort noise and no data, and
+ * the index records every run of at least amr_pause_min_frames frames without speech, so speech is what
+ * lies between them; shorter gaps are within speech, as a VAD with two seconds of hangover would have
+ * them. Pause at the very end of a file is not recorded, so the last run goes to its end.
+ *
+ * @since   1.2.0
+ */
+struct amr_activity_segment {
+	/* first frame of speech, and frame right after the last one */
+	unsigned m_begin, m_end;
+};
+
+/**
+ * Finds runs of speech of a file with its index, as opening it would; file with no index cached is
+ * scanned, which reads frame headers only. Defined by the input.
+ *
+ * @param p_path		path to file
+ * @param p_out			receives runs of speech, in order
+ * @param p_abort		abort callback
+ * @throws				exception_io if the file can't be read, is not AMR-NB, or can't be indexed, as remote files can't
+ * @since				1.2.0
+ */
+void amr_find_activity(const char * p_path, pfc::list_t<amr_activity_segment> & p_out, abort_callback & p_abort);
+
+/* string as JSON string literal, quotes included; exports of other reports use it too */
+pfc::string8 amr_activity_json_string(const char * p_text);
@@ -0,0 +1,92 @@
+/**
+ * foo_input_amr - counting heap allocations of input calls, to keep decoding free of them
+*/
+#ifdef DEC_ALLOC_TRACK
+#include "../foo_sdk/foobar2000/SDK/foobar2000.h"
+#include <crtdbg.h>
+#include <mutex>
+#include "amr_alloc_track.h"
+
+enum {
+	/* sites totals are kept for; scopes of more sites count in the last one */
+	amr_alloc_max_sites = 16,
+};
+
+/* allocations and bytes of all scopes of a site */
+struct amr_alloc_total {
+	const char * m_site;
+	t_uint64 m_scopes, m_allocations, m_bytes;
+};
+
+static std::mutex g_alloc_mutex;
+static amr_alloc_total g_alloc_totals[amr_alloc_max_sites];
+static t_size g_alloc_sites;
+
+/* innermost scope of the thread */
+static thread_local amr_alloc_scope * t_alloc_scope;
+
+amr_alloc_scope::amr_alloc_scope(const char * p_site, bool p_steady) : m_site(p_site), m_steady(p_steady), m_allocations(0), m_bytes(0), m_file(NULL), m_line(0), m_outer(t_alloc_scope) {
+	t_alloc_scope = this;
+}
+
+amr_alloc_scope::~amr_alloc_scope() {
+	t_alloc_scope = m_outer;
+	{
+		std::lock_guard<std::mutex> lock(g_alloc_mutex);
+		t_size i = 0;
+		while (i < g_alloc_sites && g_alloc_totals[i].m_site != m_site) ++i;
+		if (i == g_alloc_sites) {
+			if (g_alloc_sites < amr_alloc_max_sites) g_alloc_totals[g_alloc_sites++].m_site = m_site;
+			else i = amr_alloc_max_sites - 1;
+		}
+		++g_alloc_totals[i].m_scopes;
+		g_alloc_totals[i].m_allocations += m_allocations;
+		g_alloc_totals[i].m_bytes += m_bytes;
+	}
+	if (m_steady && m_allocations > 0) {
+		console::formatter out;
+		out << "AMR allocations: " << m_site << " allocated " << m_allocations << " times, " << m_bytes << " bytes, in steady state";
+		if (m_file != NULL) out << ", last at " << (const char *)m_file << ":" << m_line;
+		PFC_ASSERT(m_allocations == 0);
+	}
+}
+
+void amr_alloc_scope::on_alloc(size_t p_size, const unsigned char * p_file, int p_line) {
+	amr_alloc_scope * scope = t_alloc_scope;
+	if (scope == NULL) return;
+	++scope->m_allocations;
+	scope->m_bytes += p_size;
+	if (p_file != NULL) {
+		scope->m_file = p_file;
+		scope->m_line = p_line;
+	}
+}
+
+/* allocation hook of the debug CRT; must not allocate itself */
+static int __cdecl amr_alloc_hook(int p_type, void * p_data, size_t p_size, int p_block, long p_request, const unsigned char * p_file, int p_line) {
+	/* CRT's own blocks are not the component's */
+	if ((p_type == _HOOK_ALLOC || p_type == _HOOK_REALLOC) && p_block != _CRT_BLOCK) amr_alloc_scope::on_alloc(p_size, p_file, p_line);
+	return TRUE;
+}
+
+/**
+ * Installs the hook when foobar starts, and writes totals of each site to the console on shutdown.
+ */
+class amr_alloc_track_initquit : public initquit {
+public:
+	void on_init() { m_previous = _CrtSetAllocHook(amr_alloc_hook); }
+	void on_quit() {
+		_CrtSetAllocHook(m_previous);
+		std::lock_guard<std::mutex> lock(g_alloc_mutex);
+		for (t_size i = 0; i < g_alloc_sites; ++i) {
+			const amr_alloc_total & total = g_alloc_totals[i];
+			console::formatter() << "AMR allocations: " << total.m_site << ": " << total.m_scopes << " calls, " << total.m_allocations
+				<< " allocations, " << total.m_bytes << " bytes, " << pfc::format_float((double)total.m_allocations / total.m_scopes, 0, 2) << " per call";
+		}
+	}
+private:
+	_CRT_ALLOC_HOOK m_previous;
+};
+
+static initquit_factory_t<amr_alloc_track_initquit> g_amr_alloc_track_initquit;
+#endif
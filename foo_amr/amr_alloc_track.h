@@ -0,0 +1,57 @@
+/**
+ * foo_input_amr - counting heap allocations of input calls, to keep decoding free of them
+*/
+#pragma once
+
+#ifdef DEC_ALLOC_TRACK
+#ifndef _DEBUG
+#error DEC_ALLOC_TRACK needs debug CRT, whose allocation hook counts the allocations
+#endif
+
+/**
+ * Counts heap allocations, and bytes asked for, made on this thread while the object lives, and adds
+ * them to the totals of its site, say the input call it's in. Allocations are caught by allocation hook
+ * of the debug CRT, so everything allocated with the CRT this component is linked with is counted:
+ * pfc::array_t resizes, containers, and mallocs of the 3gpp decoder. Memory that foobar allocates for
+ * the component, as audio_chunk it passes in, comes from foobar's CRT and is not. Scopes nest; an
+ * allocation counts in the innermost one only. Scope in steady state, as decoding long after the start
+ * or a seek, must not allocate at all: if it did, where is written to the console and it's asserted.
+ * Totals are written to the console on shutdown.
+ *
+ * @since   1.2.0
+ */
+class amr_alloc_scope {
+public:
+	/**
+	 * @param p_site		literal name of the site
+	 * @param p_steady		scope must not allocate
+	 * @since				1.2.0
+	 */
+	amr_alloc_scope(const char * p_site, bool p_steady = false);
+	~amr_alloc_scope();
+
+	/* counts the allocation of p_size bytes in the innermost scope of this thread, if it has one; called by the hook */
+	static void on_alloc(size_t p_size, const unsigned char * p_file, int p_line);
+
+private:
+	amr_alloc_scope(const amr_alloc_scope &);
+	amr_alloc_scope & operator=(const amr_alloc_scope &);
+
+	const char * m_site;
+	bool m_steady;
+	t_uint64 m_allocations, m_bytes;
+	/* source of the last allocation, if the CRT knows it */
+	const unsigned char * m_file;
+	int m_line;
+	/* scope this one is nested in */
+	amr_alloc_scope * m_outer;
+};
+
+/* counts allocations of the rest of the enclosing block under given literal site, in tracking build only, built with DEC_ALLOC_TRACK defined */
+#define AMR_ALLOC_SCOPE(site) amr_alloc_scope amr_alloc_scope_(site)
+/* same, and asserts there are none if steady is true; steady is not evaluated unless tracking */
+#define AMR_ALLOC_SCOPE_STEADY(site, steady) amr_alloc_scope amr_alloc_scope_(site, steady)
+#else
+#define AMR_ALLOC_SCOPE(site) (void)0
+#define AMR_ALLOC_SCOPE_STEADY(site, steady) (void)0
+#endif
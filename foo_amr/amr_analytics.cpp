@@ -0,0 +1,229 @@
+/**
+ * foo_input_amr - statistics of many AMR files from their index, without decoding
+*/
+#include "../foo_sdk/foobar2000/SDK/foobar2000.h"
+#include <atomic>
+#include <memory>
+#include "amr_analytics.h"
+#include "amr_activity.h"
+#include "amr_thread_pool.h"
+
+enum {
+	/* frames are 20ms */
+	amr_analytics_frame_ms = 20,
+};
+
+/* formats reports are exported in */
+enum amr_analytics_format {
+	amr_analytics_csv,
+	amr_analytics_json,
+	amr_analytics_formats,
+};
+
+/* progress is updated this often while workers read indexes, in seconds */
+static const double g_analytics_progress_period = 0.1;
+
+/* frame types reported, speech modes first; reserved ones, which files practically never have, are left out */
+static const unsigned g_analytics_types[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 15 };
+static const char * const g_analytics_type_names[] = { "MR475", "MR515", "MR59", "MR67", "MR74", "MR795", "MR102", "MR122", "SID", "NO_DATA" };
+
+/**
+ * Files to report and their statistics, shared by workers; each takes the next file nobody took yet.
+ * Statistics come from the index cache, or a scan of frame headers, so no file is decoded.
+ *
+ * @since   1.2.0
+ */
+struct amr_analytics_job {
+	amr_analytics_job(const pfc::list_t<pfc::string8> & p_paths, abort_callback & p_abort) : m_paths(p_paths), m_abort(p_abort), m_next(0), m_done(0) {
+		m_stats.set_size(p_paths.get_count());
+		m_errors.set_size(p_paths.get_count());
+	}
+
+	/* task of a worker: statistics of the next file, unless it's aborted */
+	void work() {
+		const t_size i = m_next++;
+		if (i >= m_paths.get_count() || m_abort.is_aborting()) return;
+		try {
+			amr_find_stats(m_paths[i], m_stats[i], m_abort);
+		} catch (exception_aborted const &) {
+			return;
+		} catch (std::exception const & e) {
+			m_errors[i] = e.what();
+		}
+		++m_done;
+	}
+
+	const pfc::list_t<pfc::string8> & m_paths;
+	abort_callback & m_abort;
+	std::atomic<t_size> m_next;
+	std::atomic<t_size> m_done;
+	/* statistics of each file, and why there are none, if there aren't; each is written by one worker */
+	pfc::array_t<amr_file_stats> m_stats;
+	pfc::array_t<pfc::string8> m_errors;
+};
+
+/* ratio of p_part to p_whole, 0 if there's no whole */
+static pfc::string8 amr_analytics_ratio(t_uint64 p_part, t_uint64 p_whole) {
+	return pfc::format_float(p_whole > 0 ? (double)p_part / p_whole : 0, 0, 4);
+}
+
+/**
+ * Report row of a file: length in seconds, channels, average bitrate, channel frames of each frame type,
+ * and shares of comfort noise and no data, of damaged frames and of speech, with hash of the frames.
+ *
+ * @param p_path		path of the file
+ * @param p_stats		its statistics
+ * @param p_format		format
+ * @return				text of the row; CSV rows end with a line end, JSON objects with none
+ * @since				1.2.0
+ */
+static pfc::string8 amr_analytics_row(const char * p_path, const amr_file_stats & p_stats, amr_analytics_format p_format) {
+	pfc::string8 display;
+	filesystem::g_get_display_path(p_path, display);
+	const t_uint64 frames = (t_uint64)p_stats.m_frames * p_stats.m_channels;
+	t_uint64 dtx = 0;
+	for (unsigned i = amr_index_speech_modes; i < amr_frame_types; ++i) dtx += p_stats.m_histogram[i];
+	const pfc::string8 seconds = pfc::format_float((double)p_stats.m_frames * amr_analytics_frame_ms / 1000, 0, 2);
+	const pfc::string8 hash = p_stats.m_hash != 0 ? pfc::string8(pfc::format_hex(p_stats.m_hash, 16)) : pfc::string8();
+
+	pfc::string_formatter out;
+	if (p_format == amr_analytics_csv) {
+		/* path in quotes, as it may hold commas */
+		pfc::string8 quoted = display;
+		quoted.replace_string("\"", "\"\"");
+		out << "\"" << quoted << "\"," << seconds << "," << p_stats.m_channels << "," << p_stats.m_bitrate;
+		for (t_size i = 0; i < PFC_TABSIZE(g_analytics_types); ++i) out << "," << p_stats.m_histogram[g_analytics_types[i]];
+		out << "," << amr_analytics_ratio(dtx, frames) << "," << amr_analytics_ratio(p_stats.m_bad, frames) << "," << amr_analytics_ratio(p_stats.m_speech, p_stats.m_frames) << "," << hash << "\r\n";
+	}
+	else {
+		out << "{\"file\": " << amr_activity_json_string(display) << ", \"duration\": " << seconds << ", \"channels\": " << p_stats.m_channels << ", \"bitrate\": " << p_stats.m_bitrate << ", \"modes\": {";
+		for (t_size i = 0; i < PFC_TABSIZE(g_analytics_types); ++i) {
+			if (i > 0) out << ", ";
+			out << "\"" << g_analytics_type_names[i] << "\": " << p_stats.m_histogram[g_analytics_types[i]];
+		}
+		out << "}, \"dtx_ratio\": " << amr_analytics_ratio(dtx, frames) << ", \"bad_ratio\": " << amr_analytics_ratio(p_stats.m_bad, frames) << ", \"speech_ratio\": " << amr_analytics_ratio(p_stats.m_speech, p_stats.m_frames);
+		out << ", \"content_hash\": " << (hash.is_empty() ? pfc::string8("null") : amr_activity_json_string(hash)) << "}";
+	}
+	return out;
+}
+
+/* folder holding all given files, with the separator it ends with; they're in one folder as long as their paths say so */
+static pfc::string8 amr_analytics_folder(const pfc::list_t<pfc::string8> & p_paths) {
+	pfc::string8 folder = p_paths[0];
+	for (t_size i = 1; i < p_paths.get_count(); ++i) {
+		t_size same = 0;
+		while (same < folder.length() && folder[same] == p_paths[i].get_ptr()[same]) ++same;
+		folder.truncate(same);
+	}
+	t_size end = folder.length();
+	while (end > 0 && folder[end - 1] != '\\' && folder[end - 1] != '/') --end;
+	folder.truncate(end);
+	return folder;
+}
+
+/**
+ * Reads statistics of given files on workers of amr_thread_pool, as many at once as there are cores, and
+ * writes a row per file, in their order, to amr-analytics.csv or .json in the folder holding all of them.
+ *
+ * @return				report: where the rows went, how many files there were, and why some are missing
+ * @since				1.2.0
+ */
+static pfc::string8 amr_analytics_export(const pfc::list_t<pfc::string8> & p_paths, amr_analytics_format p_format, threaded_process_status & p_status, abort_callback & p_abort) {
+	static const char * const extensions[amr_analytics_formats] = { "csv", "json" };
+	pfc::hires_timer timer;
+	timer.start();
+	amr_analytics_job job(p_paths, p_abort);
+	const t_size count = p_paths.get_count();
+	std::unique_ptr<amr_task[]> tasks(new amr_task[count]);
+	for (t_size i = 0; i < count; ++i) amr_thread_pool::get().submit(tasks[i], [&job] { job.work(); }, amr_priority_indexing);
+	/* workers don't touch the dialog; progress is shown from here */
+	while (job.m_done < count) {
+		p_status.set_progress(job.m_done, count);
+		if (!p_abort.sleep_ex(g_analytics_progress_period)) break;
+	}
+	/* after abort, tasks no worker took yet are run here, and return right away */
+	for (t_size i = 0; i < count; ++i) tasks[i].wait();
+	p_abort.check();
+
+	pfc::string_formatter text, errors;
+	if (p_format == amr_analytics_csv) {
+		text << "file,duration,channels,bitrate";
+		for (t_size i = 0; i < PFC_TABSIZE(g_analytics_type_names); ++i) text << "," << g_analytics_type_names[i];
+		text << ",dtx_ratio,bad_ratio,speech_ratio,content_hash\r\n";
+	}
+	else text << "[";
+	t_size rows = 0;
+	for (t_size i = 0; i < count; ++i) {
+		if (!job.m_errors[i].is_empty()) {
+			errors << p_paths[i] << ": " << job.m_errors[i] << "\n";
+			continue;
+		}
+		if (p_format == amr_analytics_json) text << (rows > 0 ? ",\r\n " : "\r\n ");
+		text << amr_analytics_row(p_paths[i], job.m_stats[i], p_format);
+		++rows;
+	}
+	if (p_format == amr_analytics_json) text << "\r\n]\r\n";
+
+	pfc::string8 out_path = amr_analytics_folder(p_paths);
+	out_path << "amr-analytics." << extensions[p_format];
+	service_ptr_t<file> out;
+	filesystem::g_open_write_new(out, out_path, p_abort);
+	out->write(text.get_ptr(), text.length(), p_abort);
+
+	pfc::string_formatter report;
+	report << out_path << ": " << pfc::format_uint(rows) << " of " << pfc::format_uint(count) << " files in " << pfc::format_float(timer.query(), 0, 1) << " s\n" << errors;
+	return report;
+}
+
+/**
+ * "Export AMR analytics" items in the Utilities context menu, one per format. A row per selected file,
+ * as of a whole folder or library, with what its index tells, see amr_find_stats(); cached indexes are
+ * read, files with none have their frame headers walked, on as many threads as there are cores, and no
+ * frame is decoded. Report goes to the console.
+ *
+ * @since   1.2.0
+ */
+class amr_analytics_item : public contextmenu_item_simple {
+public:
+	GUID get_parent() { return contextmenu_groups::utilities; }
+	unsigned get_num_items() { return amr_analytics_formats; }
+	void get_item_name(unsigned p_index, pfc::string_base & p_out) {
+		static const char * const names[amr_analytics_formats] = { "Export AMR analytics as CSV", "Export AMR analytics as JSON" };
+		p_out = names[p_index];
+	}
+	bool get_item_description(unsigned p_index, pfc::string_base & p_out) {
+		p_out = "Writes length, frame types, bitrate, shares of comfort noise, damaged frames and speech, and hash of each selected AMR file to one file in their folder, taken from their index without decoding.";
+		return true;
+	}
+	GUID get_item_guid(unsigned p_index) {
+		static const GUID guids[amr_analytics_formats] = {
+			{ 0x6b2f90d4, 0x1e73, 0x4c58,{ 0xa9, 0x06, 0x3d, 0xc1, 0x7e, 0x52, 0xb8, 0x4a } },
+			{ 0xd47a13e8, 0x5c29, 0x4f06,{ 0x8b, 0x7d, 0xe2, 0x94, 0x0a, 0x6f, 0x31, 0xc5 } },
+		};
+		return guids[p_index];
+	}
+	void context_command(unsigned p_index, metadb_handle_list_cref p_data, const GUID & p_caller) {
+		/* tracks of a file split at pauses are one file */
+		pfc::list_t<pfc::string8> paths;
+		for (t_size i = 0; i < p_data.get_count(); ++i) {
+			const pfc::string8 path = p_data[i]->get_path();
+			if (stricmp_utf8(pfc::string_extension(path), "amr") != 0) continue;
+			if (!paths.have_item(path)) paths.add_item(path);
+		}
+		if (paths.get_count() == 0) return;
+		const amr_analytics_format format = (amr_analytics_format)p_index;
+		std::shared_ptr<pfc::string8> report = std::make_shared<pfc::string8>();
+		threaded_process::g_run_modeless(threaded_process_callback_lambda::create(nullptr,
+			[paths, format, report](threaded_process_status & p_status, abort_callback & p_abort) {
+				*report = amr_analytics_export(paths, format, p_status, p_abort);
+			},
+			[report](HWND p_wnd, bool p_was_aborted) {
+				if (p_was_aborted) return;
+				console::formatter() << "AMR analytics: " << *report;
+			}),
+			threaded_process::flag_show_progress | threaded_process::flag_show_abort,
+			core_api::get_main_window(), "Exporting AMR analytics");
+	}
+};
+
+static contextmenu_item_factory_t<amr_analytics_item> g_amr_analytics_item;
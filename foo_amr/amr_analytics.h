@@ -0,0 +1,39 @@
+/**
+ * foo_input_amr - statistics of many AMR files from their index, without decoding
+*/
+#pragma once
+
+#include "amr_index.h"
+
+/**
+ * What the index tells of a file, for reports over archives of recordings: frame types, damaged frames,
+ * speech between pauses and hash of the frames, see amr_frame_index.
+ *
+ * @since   1.2.0
+ */
+struct amr_file_stats {
+	unsigned m_channels;
+	/* 20ms frames, and channel frames of each frame type */
+	unsigned m_frames;
+	unsigned m_histogram[amr_frame_types];
+	/* bits per second of frames, headers included */
+	unsigned m_bitrate;
+	/* channel frames marked damaged */
+	unsigned m_bad;
+	/* 20ms frames outside pauses, see amr_activity_segment */
+	unsigned m_speech;
+	/* hash of the frames, 0 if the file was indexed without hashing them */
+	t_uint64 m_hash;
+};
+
+/**
+ * Gets statistics of a file from its index, as opening it would; file with no index cached is
+ * scanned, which reads frame headers only. Defined by the input.
+ *
+ * @param p_path		path to file
+ * @param p_out			receives the statistics
+ * @param p_abort		abort callback
+ * @throws				exception_io if the file can't be read, is not AMR-NB, or can't be indexed, as remote files can't
+ * @since				1.2.0
+ */
+void amr_find_stats(const char * p_path, amr_file_stats & p_out, abort_callback & p_abort);
@@ -0,0 +1,1195 @@
+/**
+ * foo_input_amr - timing of the 3gpp decoder, as a yardstick for comparing builds and machines
+*/
+#include "../foo_sdk/foobar2000/SDK/foobar2000.h"
+extern "C" {
+	#include "../3gpp/interf_dec.h"
+}
+#include "../foo_sdk/foobar2000/helpers/readers.h"
+#include <psapi.h>
+#include <math.h>
+#include "amr_decoder_pool.h"
+#include "amr_frame_reader.h"
+#include "amr_index_cache.h"
+#include "amr_synth.h"
+#include "amr_thread_pool.h"
+#include "amr_tuning.h"
+
+enum {
+	/* frames of each synthetic stream, 100 seconds of audio */
+	amr_benchmark_synthetic_frames = 5000,
+	/* frame types timed separately, indexed by the frame header */
+	amr_benchmark_frame_types = 16,
+	/* every frame decodes to 160 samples */
+	amr_benchmark_frame_samples = 160,
+	/* real time of one frame in nanoseconds */
+	amr_benchmark_frame_ns = 20 * 1000 * 1000,
+	/* frame type of SID, which stands for a DTX pause among synthetic streams */
+	amr_benchmark_sid = 8,
+	/* random seeks timed per file */
+	amr_benchmark_seeks = 50,
+	/* streams each thread of the scaling benchmark decodes, one after another */
+	amr_benchmark_scaling_streams = 4,
+	/* chunks a soak pass decodes from the start, seeks it makes, and rounds over all files before its baseline is taken */
+	amr_soak_chunks = 5,
+	amr_soak_seeks = 3,
+	amr_soak_warmup_rounds = 3,
+	/* seconds between samples, and samples reported at most */
+	amr_soak_sample_seconds = 60,
+	amr_soak_reported_samples = 24,
+	/* growth taken for a leak: private memory in MB, handles, and decoders beyond those the pool may keep idle */
+	amr_soak_max_growth_mb = 16,
+	amr_soak_max_growth_handles = 16,
+	/* format of results of the comparison, see amr_benchmark_format_cases(), and change of median below which a case is taken as unchanged */
+	amr_benchmark_results_version = 1,
+	amr_benchmark_noise_percent = 2,
+	/* frames of the autotuner's stream, 60 seconds of audio, and runs of each candidate, enough for the U test to tell at amr_benchmark_significance */
+	amr_autotune_frames = 3000,
+	amr_autotune_runs = 7,
+	/* throughput of threads, against one, above which long files are decoded on several threads */
+	amr_autotune_min_speedup_percent = 150,
+};
+
+/* p-value below which runs of a case are taken to differ from those of the baseline */
+static const double amr_benchmark_significance = 0.01;
+
+/* how long the soak test runs */
+static advconfig_integer_factory g_amr_soak_minutes("AMR decoder: soak test duration, in minutes",
+	{ 0xd6a41e09, 0x73c5, 0x4b2e,{ 0x9f, 0x81, 0x0c, 0x5b, 0xe3, 0x27, 0xa4, 0x6d } },
+	advconfig_branch::guid_branch_decoding, 26, 60, 1, 7 * 24 * 60);
+
+/* how many times the comparison with the baseline runs each case */
+static advconfig_integer_factory g_amr_benchmark_runs("AMR decoder: benchmark comparison, runs of each case",
+	{ 0x6a0e93d4, 0x1bf7, 0x4c58,{ 0x92, 0x0d, 0xe5, 0x3b, 0x7c, 0x14, 0xa8, 0x66 } },
+	advconfig_branch::guid_branch_decoding, 28, 7, 3, 101);
+
+/* wait of the simulated slow file before every read and seek, in seconds */
+static const double g_slow_file_latency = 0.005;
+
+
+static const char * const g_frame_type_name[amr_benchmark_frame_types] = {
+	"MR475", "MR515", "MR59", "MR67", "MR74", "MR795", "MR102", "MR122", "SID",
+	NULL, NULL, NULL, NULL, NULL, NULL, "NO_DATA"
+};
+
+/**
+ * Decoding time and number of frames per frame type.
+ *
+ * @since   1.2.0
+ */
+struct amr_benchmark_result {
+	amr_benchmark_result() {
+		for (unsigned i = 0; i < amr_benchmark_frame_types; ++i) {
+			m_seconds[i] = 0;
+			m_frames[i] = 0;
+		}
+	}
+
+	/* appends table of ns/frame and realtime factor of every frame type seen, and of all of them */
+	void format(pfc::string_base & p_out) const {
+		for (unsigned i = 0; i < amr_benchmark_frame_types; ++i) {
+			if (m_frames[i] == 0) continue;
+			line(p_out, g_frame_type_name[i] != NULL ? g_frame_type_name[i] : "reserved", m_seconds[i], m_frames[i]);
+		}
+		format_all(p_out, "all");
+	}
+
+	/* appends ns/frame and realtime factor of all frame types together, under given name */
+	void format_all(pfc::string_base & p_out, const char * p_name) const {
+		double seconds = 0;
+		t_uint64 frames = 0;
+		for (unsigned i = 0; i < amr_benchmark_frame_types; ++i) {
+			seconds += m_seconds[i];
+			frames += m_frames[i];
+		}
+		if (frames > 0) line(p_out, p_name, seconds, frames);
+	}
+
+	double m_seconds[amr_benchmark_frame_types];
+	t_uint64 m_frames[amr_benchmark_frame_types];
+
+private:
+	static void line(pfc::string_base & p_out, const char * p_name, double p_seconds, t_uint64 p_frames) {
+		const double ns = p_seconds * 1e9 / (double)p_frames;
+		p_out << "  " << p_name << ": " << p_frames << " frames, " << pfc::format_float(ns, 0, 0) << " ns/frame, "
+			<< pfc::format_float(ns > 0 ? amr_benchmark_frame_ns / ns : 0, 0, 1) << "x realtime\n";
+	}
+};
+
+/**
+ * Decodes storage format frames one at a time with a fresh decoder, timing each of them.
+ *
+ * @param p_data		frames, without the magic string
+ * @param p_size		length of p_data in bytes
+ * @param p_result		receives time and count of decoded frames
+ * @param p_abort		abort callback
+ * @param p_engine		post filter engine, DEC_ENGINE_FIXED, DEC_ENGINE_FLOAT or DEC_ENGINE_BYPASS
+ * @since				1.2.0
+ */
+static void amr_benchmark_decode(const t_uint8 * p_data, t_size p_size, amr_benchmark_result & p_result, abort_callback & p_abort, int p_engine = DEC_ENGINE_FIXED) {
+	amr_decoder decoder;
+	decoder.acquire();
+	Decoder_Interface_set_engine(decoder.get(), p_engine);
+	float output[amr_benchmark_frame_samples];
+	/* decoder reads the frame in place, but wants it writable */
+	unsigned char * frame = const_cast<unsigned char *>(p_data);
+	t_size left = p_size;
+	pfc::hires_timer timer;
+	while (left > 0) {
+		const unsigned ft = (frame[0] >> 3) & 0x0F;
+		int used;
+		timer.start();
+		if (Decoder_Interface_DecodeN_float(decoder.get(), frame, (int)left, output, 1, &used) == 0) break;
+		p_result.m_seconds[ft] += timer.query();
+		++p_result.m_frames[ft];
+		frame += used;
+		left -= used;
+		p_abort.check();
+	}
+}
+
+/**
+ * Builds stream of frames with random payload, same every time, see amr_synthesize(). Frame types
+ * 0 to 7 give frames of that mode only; SID gives a DTX pause, which is one SID frame and NO_DATA
+ * frames after it.
+ *
+ * @param p_type		frame type
+ * @param p_out			receives the frames
+ * @since				1.2.0
+ */
+static void amr_benchmark_synthesize(unsigned p_type, pfc::array_t<t_uint8> & p_out) {
+	amr_synth_params params = {};
+	params.m_modes = p_type == amr_benchmark_sid ? 0 : 1u << p_type;
+	params.m_seed = 1 + p_type;
+	amr_synthesize(params, amr_benchmark_synthetic_frames, false, p_out);
+}
+
+/**
+ * Times decoding of synthetic streams of every mode, and of the given files. Synthetic streams are
+ * decoded again with each of the other post filter engines, for their gain over the bit-exact one;
+ * files are decoded with that one only.
+ *
+ * @param p_paths		files to decode
+ * @param p_status		progress
+ * @param p_abort		abort callback
+ * @return				report, one line per frame type
+ * @since				1.2.0
+ */
+static pfc::string8 amr_benchmark_run(const pfc::list_t<pfc::string8> & p_paths, threaded_process_status & p_status, abort_callback & p_abort) {
+	pfc::string_formatter report;
+	const t_size steps = amr_benchmark_sid + 1 + p_paths.get_count();
+
+	amr_benchmark_result synthetic;
+	pfc::array_t<t_uint8> frames;
+	for (unsigned type = 0; type <= amr_benchmark_sid; ++type) {
+		p_status.set_progress(type, steps);
+		amr_benchmark_synthesize(type, frames);
+		amr_benchmark_decode(frames.get_ptr(), frames.get_size(), synthetic, p_abort);
+	}
+	report << "Synthetic streams, random payload:\n";
+	synthetic.format(report);
+
+	/* floating point post filter is what playback may use, none at all what machine consumers may */
+	static const int engines[] = { DEC_ENGINE_FLOAT, DEC_ENGINE_BYPASS };
+	static const char * const engine_names[] = { "floating point post filter", "no post filter" };
+	report << "Synthetic streams, by post filter engine:\n";
+	synthetic.format_all(report, "fixed point post filter");
+	for (unsigned e = 0; e < PFC_TABSIZE(engines); ++e) {
+		amr_benchmark_result result;
+		for (unsigned type = 0; type <= amr_benchmark_sid; ++type) {
+			amr_benchmark_synthesize(type, frames);
+			amr_benchmark_decode(frames.get_ptr(), frames.get_size(), result, p_abort, engines[e]);
+		}
+		result.format_all(report, engine_names[e]);
+	}
+
+	for (t_size i = 0; i < p_paths.get_count(); ++i) {
+		p_status.set_progress(amr_benchmark_sid + 1 + i, steps);
+		p_status.set_item_path(p_paths[i]);
+		report << p_paths[i] << ":\n";
+		try {
+			service_ptr_t<file> f;
+			filesystem::g_open_read(f, p_paths[i], p_abort);
+			amr_frame_reader reader;
+			reader.attach(f);
+			/* frames are timed from memory, so I/O does not count */
+			if (!reader.load(p_abort) || reader.get_size() < 6 || memcmp(reader.get_data(), "#!AMR\x0a", 6) != 0) {
+				report << "  not a local AMR file\n";
+				continue;
+			}
+			amr_benchmark_result result;
+			amr_benchmark_decode(reader.get_data() + 6, reader.get_size() - 6, result, p_abort);
+			result.format(report);
+		} catch (exception_aborted const &) {
+			throw;
+		} catch (std::exception const & e) {
+			report << "  " << e.what() << "\n";
+		}
+	}
+	return report;
+}
+
+/* what one thread of the scaling benchmark did */
+struct amr_benchmark_thread {
+	amr_benchmark_thread() : m_seconds(0), m_frames(0) {}
+	double m_seconds;
+	t_uint64 m_frames;
+};
+
+/**
+ * Decodes each stream with a decoder of its own, created and freed here, as a transcoding server
+ * would, so contention in allocating decoder state counts too. Waits for p_start before the timer
+ * starts, so all threads run at once.
+ *
+ * @param p_streams		streams, see amr_benchmark_synthesize()
+ * @param p_start		set once all threads are there
+ * @param p_result		receives time and frames decoded
+ * @param p_abort		abort callback
+ * @since				1.2.0
+ */
+static void amr_benchmark_scaling_thread(const pfc::array_t<t_uint8> * p_streams, pfc::event & p_start, amr_benchmark_thread & p_result, abort_callback & p_abort) {
+	/* decoder wants the frames writable, so each thread has a copy of its own */
+	pfc::array_t<t_uint8> streams[amr_benchmark_scaling_streams];
+	for (unsigned s = 0; s < amr_benchmark_scaling_streams; ++s) streams[s] = p_streams[s];
+	short output[amr_benchmark_frame_samples];
+	p_start.wait_for(-1);
+	pfc::hires_timer timer;
+	timer.start();
+	for (unsigned s = 0; s < amr_benchmark_scaling_streams && !p_abort.is_aborting(); ++s) {
+		void * decoder = Decoder_Interface_init();
+		if (decoder == NULL) break;
+		unsigned char * frame = streams[s].get_ptr();
+		unsigned char * const end = frame + streams[s].get_size();
+		while (frame < end) {
+			const unsigned ft = (frame[0] >> 3) & 0x0F;
+			Decoder_Interface_Decode(decoder, frame, output, 0);
+			frame += 1 + Decoder_Interface_block_size[ft];
+			++p_result.m_frames;
+		}
+		Decoder_Interface_exit(decoder);
+	}
+	p_result.m_seconds = timer.query();
+}
+
+/**
+ * Runs amr_benchmark_scaling_thread() on as many threads at once as there are results.
+ *
+ * @param p_streams		streams each thread decodes, see amr_benchmark_synthesize()
+ * @param p_results		receives what each thread did
+ * @param p_abort		abort callback
+ * @return				seconds from start of the first thread to end of the last
+ * @since				1.2.0
+ */
+static double amr_benchmark_scaling_wall(const pfc::array_t<t_uint8> * p_streams, pfc::array_t<amr_benchmark_thread> & p_results, abort_callback & p_abort) {
+	const t_size count = p_results.get_size();
+	pfc::array_t<pfc::thread2> threads;
+	threads.set_size(count);
+	pfc::event start;
+	for (t_size t = 0; t < count; ++t) {
+		amr_benchmark_thread * result = &p_results[t];
+		threads[t].startHere([p_streams, &start, result, &p_abort] { amr_benchmark_scaling_thread(p_streams, start, *result, p_abort); });
+	}
+	pfc::hires_timer timer;
+	timer.start();
+	start.set_state(true);
+	for (t_size t = 0; t < count; ++t) threads[t].waitTillDone();
+	const double wall = timer.query();
+	p_abort.check();
+	return wall;
+}
+
+/**
+ * Decodes independent streams on 1 to as many threads as there are cores, each thread the same
+ * amount, and reports frames per second of all threads together and how they compare with what one
+ * thread does alone: efficiency is that rate divided by threads times the rate of one thread, the
+ * slowest thread is its own rate against that of one thread. Efficiency falling off with threads is
+ * shared state or memory bandwidth; machines are sized from frames per second.
+ *
+ * @param p_status		progress
+ * @param p_abort		abort callback
+ * @return				report, one line per thread count
+ * @since				1.2.0
+ */
+static pfc::string8 amr_benchmark_run_scaling(threaded_process_status & p_status, abort_callback & p_abort) {
+	/* speech of the highest and the lowest mode, in between, and DTX pause */
+	static const unsigned types[amr_benchmark_scaling_streams] = { 7, 0, 4, amr_benchmark_sid };
+	pfc::array_t<t_uint8> streams[amr_benchmark_scaling_streams];
+	for (unsigned s = 0; s < amr_benchmark_scaling_streams; ++s) amr_benchmark_synthesize(types[s], streams[s]);
+
+	const unsigned cores = (unsigned)pfc::max_t<t_size>(pfc::getOptimalWorkerThreadCount(), 1);
+	pfc::string_formatter report;
+	report << "Threads decoding " << (unsigned)amr_benchmark_scaling_streams << " synthetic streams of "
+		<< (unsigned)(amr_benchmark_synthetic_frames / 50) << " s each, with a new decoder per stream:\n";
+	double single = 0;
+	for (unsigned count = 1; count <= cores; ++count) {
+		p_status.set_progress(count - 1, cores);
+		pfc::array_t<amr_benchmark_thread> results;
+		results.set_size(count);
+		const double wall = amr_benchmark_scaling_wall(streams, results, p_abort);
+
+		t_uint64 frames = 0;
+		double slowest = 0;
+		for (unsigned t = 0; t < count; ++t) {
+			frames += results[t].m_frames;
+			slowest = pfc::max_t(slowest, results[t].m_seconds);
+		}
+		const double rate = wall > 0 ? frames / wall : 0;
+		if (count == 1) single = rate;
+		const double per_thread = slowest > 0 ? results[0].m_frames / slowest : 0;
+		report << "  " << count << (count == 1 ? " thread: " : " threads: ") << pfc::format_float(rate, 0, 0) << " frames/s, "
+			<< pfc::format_float(rate * amr_benchmark_frame_ns / 1e9, 0, 0) << " streams in real time, efficiency "
+			<< pfc::format_float(single > 0 ? 100 * rate / count / single : 0, 0, 1) << "%, slowest thread "
+			<< pfc::format_float(single > 0 ? 100 * per_thread / single : 0, 0, 1) << "%\n";
+	}
+	return report;
+}
+
+/* what the process holds at one point of the soak test */
+struct amr_soak_sample {
+	double m_seconds;
+	t_uint64 m_passes;
+	/* private bytes and working set */
+	t_uint64 m_private, m_working_set;
+	unsigned long m_handles;
+	long m_decoders;
+};
+
+/* takes a sample of the process now */
+static amr_soak_sample amr_soak_measure(double p_seconds, t_uint64 p_passes) {
+	amr_soak_sample sample;
+	sample.m_seconds = p_seconds;
+	sample.m_passes = p_passes;
+	PROCESS_MEMORY_COUNTERS_EX counters = {};
+	counters.cb = sizeof(counters);
+	GetProcessMemoryInfo(GetCurrentProcess(), reinterpret_cast<PROCESS_MEMORY_COUNTERS *>(&counters), sizeof(counters));
+	sample.m_private = counters.PrivateUsage;
+	sample.m_working_set = counters.WorkingSetSize;
+	DWORD handles = 0;
+	GetProcessHandleCount(GetCurrentProcess(), &handles);
+	sample.m_handles = handles;
+	sample.m_decoders = amr_decoder_pool::get_live();
+	return sample;
+}
+
+/* appends one line of a sample */
+static void amr_soak_format(pfc::string_base & p_out, const amr_soak_sample & p_sample) {
+	p_out << "  " << pfc::format_float(p_sample.m_seconds / 60, 0, 1) << " min, " << p_sample.m_passes << " passes: private "
+		<< pfc::format_float(p_sample.m_private / (1024.0 * 1024.0), 0, 1) << " MB, working set "
+		<< pfc::format_float(p_sample.m_working_set / (1024.0 * 1024.0), 0, 1) << " MB, " << (t_uint64)p_sample.m_handles << " handles, "
+		<< p_sample.m_decoders << " decoders\n";
+}
+
+/**
+ * One pass of the soak test over a file, as a listener would make it: opens it, decodes a few chunks,
+ * seeks to a few random positions decoding a chunk after each, and closes it.
+ *
+ * @param p_path		path to file
+ * @param p_seed		random positions, advanced
+ * @param p_abort		abort callback
+ * @since				1.2.0
+ */
+static void amr_soak_pass(const char * p_path, t_uint32 & p_seed, abort_callback & p_abort) {
+	service_ptr_t<input_decoder> decoder;
+	input_entry::g_open_for_decoding(decoder, NULL, p_path, p_abort);
+	decoder->initialize(0, input_flag_playback, p_abort);
+	file_info_impl info;
+	decoder->get_info(0, info, p_abort);
+	audio_chunk_impl chunk;
+	for (unsigned i = 0; i < amr_soak_chunks && decoder->run(chunk, p_abort); ++i) {}
+	const double length = info.get_length();
+	if (!decoder->can_seek() || length <= 0) return;
+	for (unsigned i = 0; i < amr_soak_seeks; ++i) {
+		p_seed = p_seed * 1103515245 + 12345;
+		decoder->seek(length * ((p_seed >> 16) & 0x7FFF) / 0x8000, p_abort);
+		decoder->run(chunk, p_abort);
+	}
+}
+
+/**
+ * Opens, decodes, seeks and closes the selected files through input_amr, one after another over and
+ * over, for as long as set, sampling private memory, handles and live decoders of the process, see
+ * amr_decoder_pool::get_live(). Baseline is taken after a few rounds, once caches and pools have
+ * filled up; the test fails if, at its end, any of them grew by more than could be noise: 16 MB,
+ * 16 handles, or the decoders the pool may keep idle.
+ *
+ * @param p_paths		files to decode
+ * @param p_status		progress
+ * @param p_abort		abort callback
+ * @return				report, samples and verdict
+ * @since				1.2.0
+ */
+static pfc::string8 amr_benchmark_run_soak(const pfc::list_t<pfc::string8> & p_paths, threaded_process_status & p_status, abort_callback & p_abort) {
+	if (p_paths.get_count() == 0) return "No files to soak test with\n";
+	const double duration = 60.0 * g_amr_soak_minutes.get();
+	pfc::list_t<amr_soak_sample> samples;
+	pfc::string_formatter errors;
+	pfc::hires_timer timer;
+	timer.start();
+	t_uint32 seed = 1;
+	t_uint64 passes = 0;
+	double next_sample = 0;
+	amr_soak_sample baseline = {};
+	for (unsigned round = 0; timer.query() < duration; ++round) {
+		for (t_size i = 0; i < p_paths.get_count(); ++i) {
+			p_abort.check();
+			try {
+				amr_soak_pass(p_paths[i], seed, p_abort);
+			} catch (exception_aborted const &) {
+				throw;
+			} catch (std::exception const & e) {
+				/* first error of each file is enough */
+				if (round == 0) errors << "  " << p_paths[i] << ": " << e.what() << "\n";
+			}
+			++passes;
+		}
+		const double now = timer.query();
+		p_status.set_progress_float(pfc::min_t(now / duration, 1.0));
+		if (round + 1 == amr_soak_warmup_rounds) {
+			baseline = amr_soak_measure(now, passes);
+			samples.add_item(baseline);
+			next_sample = now + amr_soak_sample_seconds;
+		}
+		else if (round + 1 > amr_soak_warmup_rounds && now >= next_sample) {
+			samples.add_item(amr_soak_measure(now, passes));
+			next_sample = now + amr_soak_sample_seconds;
+		}
+	}
+	const amr_soak_sample last = amr_soak_measure(timer.query(), passes);
+	if (samples.get_count() == 0) baseline = last;
+	samples.add_item(last);
+
+	pfc::string_formatter report;
+	report << p_paths.get_count() << " files, " << passes << " passes in " << pfc::format_float(last.m_seconds / 60, 0, 1) << " minutes\n";
+	if (!errors.is_empty()) report << "Errors:\n" << errors;
+	const t_size count = samples.get_count();
+	const t_size step = (count + amr_soak_reported_samples - 1) / amr_soak_reported_samples;
+	for (t_size i = 0; i < count; i += step) amr_soak_format(report, samples[i]);
+	if ((count - 1) % step != 0) amr_soak_format(report, last);
+
+	const double memory = ((double)last.m_private - (double)baseline.m_private) / (1024 * 1024);
+	const long handles = (long)last.m_handles - (long)baseline.m_handles;
+	const long decoders = last.m_decoders - baseline.m_decoders;
+	const bool leaked = memory > amr_soak_max_growth_mb || handles > amr_soak_max_growth_handles || decoders > amr_decoder_pool_max_idle;
+	report << (leaked ? "FAILED" : "PASSED") << ": since baseline, private memory " << pfc::format_float(memory, 0, 1) << " MB, "
+		<< handles << " handles, " << decoders << " decoders\n";
+	return report;
+}
+
+/**
+ * File that waits before every read and seek, like one on a busy network share. foobar2000 takes
+ * such shares for local files, so the file does not pretend to be remote.
+ *
+ * @since   1.2.0
+ */
+class amr_benchmark_slow_file : public file_chain_readonly {
+public:
+	amr_benchmark_slow_file(file::ptr p_file) : file_chain_readonly(p_file) {}
+
+	static file::ptr create(file::ptr p_file) { return new service_impl_t<amr_benchmark_slow_file>(p_file); }
+
+	t_size read(void * p_buffer, t_size p_bytes, abort_callback & p_abort) {
+		p_abort.sleep(g_slow_file_latency);
+		return file_chain_readonly::read(p_buffer, p_bytes, p_abort);
+	}
+	void read_object(void * p_buffer, t_size p_bytes, abort_callback & p_abort) {
+		p_abort.sleep(g_slow_file_latency);
+		file_chain_readonly::read_object(p_buffer, p_bytes, p_abort);
+	}
+	t_filesize skip(t_filesize p_bytes, abort_callback & p_abort) {
+		p_abort.sleep(g_slow_file_latency);
+		return file_chain_readonly::skip(p_bytes, p_abort);
+	}
+	void skip_object(t_filesize p_bytes, abort_callback & p_abort) {
+		p_abort.sleep(g_slow_file_latency);
+		file_chain_readonly::skip_object(p_bytes, p_abort);
+	}
+	void seek(t_filesize p_position, abort_callback & p_abort) {
+		p_abort.sleep(g_slow_file_latency);
+		file_chain_readonly::seek(p_position, p_abort);
+	}
+	void seek_ex(t_sfilesize p_position, t_seek_mode p_mode, abort_callback & p_abort) {
+		p_abort.sleep(g_slow_file_latency);
+		file_chain_readonly::seek_ex(p_position, p_mode, p_abort);
+	}
+	void reopen(abort_callback & p_abort) {
+		p_abort.sleep(g_slow_file_latency);
+		file_chain_readonly::reopen(p_abort);
+	}
+};
+
+/**
+ * Times of one pass of input_amr over a file, from open to the end and then seeking around.
+ *
+ * @since   1.2.0
+ */
+struct amr_benchmark_input_result {
+	amr_benchmark_input_result() : m_open(0), m_initialize(0), m_decode(0), m_audio(0), m_bytes(0) {}
+
+	/* appends one line with all the times */
+	void format(pfc::string_base & p_out, const char * p_name) {
+		p_out << "  " << p_name << ": open " << ms(m_open) << ", initialize " << ms(m_initialize)
+			<< ", decode " << pfc::format_float(m_decode > 0 ? m_bytes / m_decode / (1024 * 1024) : 0, 0, 2) << " MB/s, "
+			<< pfc::format_float(m_decode > 0 ? m_audio / m_decode : 0, 0, 1) << "x realtime";
+		const t_size count = m_seeks.get_size();
+		if (count > 0) {
+			pfc::sort_t(m_seeks, pfc::compare_t<double, double>, count);
+			p_out << ", seek p50 " << ms(m_seeks[(count - 1) / 2]) << ", p90 " << ms(m_seeks[(count - 1) * 9 / 10])
+				<< ", max " << ms(m_seeks[count - 1]);
+		}
+		p_out << "\n";
+	}
+
+	/* input_entry::g_open_for_decoding, decoder->initialize */
+	double m_open, m_initialize;
+	/* decoding from start to end, and length of audio it gave, in seconds */
+	double m_decode, m_audio;
+	t_filesize m_bytes;
+	/* decode_seek and first chunk after it, in seconds */
+	pfc::array_t<double> m_seeks;
+
+private:
+	static pfc::string8 ms(double p_seconds) {
+		pfc::string8 out;
+		out << pfc::format_float(p_seconds * 1000, 0, 2) << " ms";
+		return out;
+	}
+};
+
+/**
+ * Drives input_amr through input_decoder like foobar2000 does when playing: opens the file,
+ * initializes for exact seeking, decodes all of it and then seeks to random positions, each
+ * seek timed until the first chunk after it is there.
+ *
+ * @param p_path		path to file
+ * @param p_file		the file, opened
+ * @param p_result		receives the times
+ * @param p_abort		abort callback
+ * @since				1.2.0
+ */
+static void amr_benchmark_input(const char * p_path, file::ptr p_file, amr_benchmark_input_result & p_result, abort_callback & p_abort) {
+	pfc::hires_timer timer;
+	p_result.m_bytes = p_file->get_size(p_abort);
+
+	timer.start();
+	service_ptr_t<input_decoder> decoder;
+	input_entry::g_open_for_decoding(decoder, p_file, p_path, p_abort);
+	p_result.m_open = timer.query();
+
+	timer.start();
+	decoder->initialize(0, 0, p_abort);
+	p_result.m_initialize = timer.query();
+
+	file_info_impl info;
+	decoder->get_info(0, info, p_abort);
+	const double length = info.get_length();
+
+	audio_chunk_impl chunk;
+	timer.start();
+	while (decoder->run(chunk, p_abort)) p_result.m_audio += chunk.get_duration();
+	p_result.m_decode = timer.query();
+
+	if (!decoder->can_seek() || length <= 0) return;
+	/* same positions every time, see amr_benchmark_synthesize */
+	t_uint32 seed = 1;
+	p_result.m_seeks.set_size(amr_benchmark_seeks);
+	for (unsigned i = 0; i < amr_benchmark_seeks; ++i) {
+		seed = seed * 1103515245 + 12345;
+		const double position = length * ((seed >> 16) & 0x7FFF) / 0x8000;
+		timer.start();
+		decoder->seek(position, p_abort);
+		decoder->run(chunk, p_abort);
+		p_result.m_seeks[i] = timer.query();
+	}
+}
+
+/**
+ * Times input_amr on each of the given files three times: with its index not cached, with the
+ * index cached by that first pass, and from a slow file with no cached index.
+ *
+ * @param p_paths		files to decode
+ * @param p_status		progress
+ * @param p_abort		abort callback
+ * @return				report, one line per pass
+ * @since				1.2.0
+ */
+static pfc::string8 amr_benchmark_run_input(const pfc::list_t<pfc::string8> & p_paths, threaded_process_status & p_status, abort_callback & p_abort) {
+	pfc::string_formatter report;
+	for (t_size i = 0; i < p_paths.get_count(); ++i) {
+		p_status.set_progress(i, p_paths.get_count());
+		p_status.set_item_path(p_paths[i]);
+		report << p_paths[i] << ":\n";
+		try {
+			file::ptr f;
+			amr_benchmark_input_result cold, warm, slow;
+			amr_index_cache::get().remove(p_paths[i]);
+			filesystem::g_open_read(f, p_paths[i], p_abort);
+			amr_benchmark_input(p_paths[i], f, cold, p_abort);
+			cold.format(report, "cold cache");
+
+			filesystem::g_open_read(f, p_paths[i], p_abort);
+			amr_benchmark_input(p_paths[i], f, warm, p_abort);
+			warm.format(report, "warm cache");
+
+			amr_index_cache::get().remove(p_paths[i]);
+			filesystem::g_open_read(f, p_paths[i], p_abort);
+			amr_benchmark_input(p_paths[i], amr_benchmark_slow_file::create(f), slow, p_abort);
+			slow.format(report, "slow file, cold cache");
+		} catch (exception_aborted const &) {
+			throw;
+		} catch (std::exception const & e) {
+			report << "  " << e.what() << "\n";
+		}
+	}
+	return report;
+}
+
+/* one case of the comparison, as ns/frame or ms, lower is better, with a sample from each run */
+struct amr_benchmark_case {
+	pfc::string8 m_name, m_unit;
+	pfc::array_t<double> m_samples;
+
+	double median() const {
+		pfc::array_t<double> sorted = m_samples;
+		const t_size count = sorted.get_size();
+		if (count == 0) return 0;
+		pfc::sort_t(sorted, pfc::compare_t<double, double>, count);
+		return count % 2 ? sorted[count / 2] : (sorted[count / 2 - 1] + sorted[count / 2]) / 2;
+	}
+	/* median absolute deviation, the dispersion a stray slow run does not blow up */
+	double deviation() const {
+		const double center = median();
+		amr_benchmark_case spread;
+		spread.m_samples.set_size(m_samples.get_size());
+		for (t_size i = 0; i < m_samples.get_size(); ++i) spread.m_samples[i] = fabs(m_samples[i] - center);
+		return spread.median();
+	}
+};
+
+/* adds a sample to the case of given name, which is added if it's not there */
+static void amr_benchmark_sample(pfc::list_t<amr_benchmark_case> & p_cases, const char * p_name, const char * p_unit, double p_value) {
+	t_size i = 0;
+	while (i < p_cases.get_count() && strcmp(p_cases[i].m_name, p_name) != 0) ++i;
+	if (i == p_cases.get_count()) {
+		amr_benchmark_case added;
+		added.m_name = p_name;
+		added.m_unit = p_unit;
+		p_cases.add_item(added);
+	}
+	p_cases[i].m_samples.append_single(p_value);
+}
+
+/**
+ * Two-sided p-value of the Mann-Whitney U test, which tells whether samples of one case come from
+ * slower or faster runs than those of the other, whatever the shape of their spread. Normal
+ * approximation, with ranks of ties averaged; it's close enough from 5 samples a side on.
+ *
+ * @since				1.2.0
+ */
+static double amr_benchmark_p_value(const pfc::array_t<double> & p_a, const pfc::array_t<double> & p_b) {
+	const t_size na = p_a.get_size(), nb = p_b.get_size();
+	if (na == 0 || nb == 0) return 1;
+	/* rank sum of a: 1 for each value of b below, half for each equal, plus its own rank among a */
+	double rank_sum = 0;
+	for (t_size i = 0; i < na; ++i) {
+		double rank = 1;
+		for (t_size j = 0; j < na; ++j) rank += p_a[j] < p_a[i] ? 1 : p_a[j] == p_a[i] && j != i ? 0.5 : 0;
+		for (t_size j = 0; j < nb; ++j) rank += p_b[j] < p_a[i] ? 1 : p_b[j] == p_a[i] ? 0.5 : 0;
+		rank_sum += rank;
+	}
+	const double u = rank_sum - (double)na * (na + 1) / 2;
+	const double sigma = sqrt((double)na * nb * (na + nb + 1) / 12);
+	return erfc(fabs(u - (double)na * nb / 2) / sigma / sqrt(2.0));
+}
+
+/* results as text, a line per case: name, unit, median, deviation and samples, separated by tabs */
+static pfc::string8 amr_benchmark_format_cases(const pfc::list_t<amr_benchmark_case> & p_cases) {
+	pfc::string_formatter out;
+	out << "# foo_input_amr benchmark " << (unsigned)amr_benchmark_results_version << "\r\n# case\tunit\tmedian\tdeviation\tsamples\r\n";
+	for (t_size i = 0; i < p_cases.get_count(); ++i) {
+		const amr_benchmark_case & c = p_cases[i];
+		out << c.m_name << "\t" << c.m_unit << "\t" << pfc::format_float(c.median(), 0, 3) << "\t" << pfc::format_float(c.deviation(), 0, 3);
+		for (t_size s = 0; s < c.m_samples.get_size(); ++s) out << "\t" << pfc::format_float(c.m_samples[s], 0, 3);
+		out << "\r\n";
+	}
+	return out;
+}
+
+/* cases of results as written by amr_benchmark_format_cases(); medians and deviations are taken from samples again */
+static void amr_benchmark_parse_cases(const char * p_text, pfc::list_t<amr_benchmark_case> & p_out) {
+	for (const char * line = p_text; *line; ) {
+		const char * end = line + strcspn(line, "\r\n");
+		if (*line != '#' && end > line) {
+			pfc::list_t<pfc::string8> fields;
+			for (const char * field = line; field <= end; ) {
+				const char * tab = field;
+				while (tab < end && *tab != '\t') ++tab;
+				fields.add_item(pfc::string8(field, tab - field));
+				field = tab + 1;
+			}
+			for (t_size f = 4; f < fields.get_count(); ++f) amr_benchmark_sample(p_out, fields[0], fields[1], pfc::string_to_float(fields[f]));
+		}
+		line = end + strspn(end, "\r\n");
+	}
+}
+
+/**
+ * Runs every case g_amr_benchmark_runs times, in turns so a machine slowing down weighs on all of
+ * them alike, and compares them with the baseline. Cases are decoding of a synthetic stream of each
+ * frame type with each post filter engine, and the input on each selected file with cold and warm
+ * index cache and from a slow file, opening to end and seeking. Results go to amr-benchmark-last.tsv
+ * in the profile, and become the baseline, amr-benchmark-baseline.tsv, if there is none; for a new
+ * baseline, the last results are copied over it. A case is a regression if its median is more than
+ * amr_benchmark_noise_percent slower than that of the baseline, and the U test says runs are slower
+ * at p below amr_benchmark_significance.
+ *
+ * @param p_paths		files to run the input on
+ * @param p_status		progress
+ * @param p_abort		abort callback
+ * @return				report, one line per case
+ * @since				1.2.0
+ */
+static pfc::string8 amr_benchmark_run_compare(const pfc::list_t<pfc::string8> & p_paths, threaded_process_status & p_status, abort_callback & p_abort) {
+	static const int engines[] = { DEC_ENGINE_FIXED, DEC_ENGINE_FLOAT, DEC_ENGINE_BYPASS };
+	static const char * const engine_names[] = { "fixed", "float", "bypass" };
+	pfc::array_t<t_uint8> streams[amr_benchmark_sid + 1];
+	for (unsigned type = 0; type <= amr_benchmark_sid; ++type) amr_benchmark_synthesize(type, streams[type]);
+
+	const unsigned runs = (unsigned)g_amr_benchmark_runs.get();
+	pfc::list_t<amr_benchmark_case> cases;
+	for (unsigned run = 0; run < runs; ++run) {
+		p_status.set_progress(run, runs);
+		for (unsigned type = 0; type <= amr_benchmark_sid; ++type) {
+			for (unsigned e = 0; e < PFC_TABSIZE(engines); ++e) {
+				amr_benchmark_result result;
+				amr_benchmark_decode(streams[type].get_ptr(), streams[type].get_size(), result, p_abort, engines[e]);
+				double seconds = 0;
+				t_uint64 frames = 0;
+				for (unsigned i = 0; i < amr_benchmark_frame_types; ++i) {
+					seconds += result.m_seconds[i];
+					frames += result.m_frames[i];
+				}
+				amr_benchmark_sample(cases, pfc::string_formatter() << "decode/" << g_frame_type_name[type] << "/" << engine_names[e], "ns/frame", frames > 0 ? seconds * 1e9 / frames : 0);
+			}
+		}
+		for (t_size i = 0; i < p_paths.get_count(); ++i) {
+			p_status.set_item_path(p_paths[i]);
+			const pfc::string8 name = pfc::string_formatter() << "input/" << pfc::string_filename_ext(p_paths[i]);
+			try {
+				static const char * const passes[] = { "cold", "warm", "slow" };
+				for (unsigned pass = 0; pass < PFC_TABSIZE(passes); ++pass) {
+					if (pass != 1) amr_index_cache::get().remove(p_paths[i]);
+					file::ptr f;
+					filesystem::g_open_read(f, p_paths[i], p_abort);
+					amr_benchmark_input_result result;
+					amr_benchmark_input(p_paths[i], pass == 2 ? amr_benchmark_slow_file::create(f) : f, result, p_abort);
+					amr_benchmark_sample(cases, pfc::string_formatter() << name << "/" << passes[pass] << "/play", "ms", (result.m_open + result.m_initialize + result.m_decode) * 1000);
+					double seeks = 0;
+					for (t_size s = 0; s < result.m_seeks.get_size(); ++s) seeks += result.m_seeks[s];
+					if (result.m_seeks.get_size() > 0) amr_benchmark_sample(cases, pfc::string_formatter() << name << "/" << passes[pass] << "/seek", "ms", seeks * 1000 / result.m_seeks.get_size());
+				}
+			} catch (exception_aborted const &) {
+				throw;
+			} catch (std::exception const & e) {
+				/* said once, in the first run */
+				if (run == 0) console::formatter() << "AMR benchmark comparison: " << p_paths[i] << ": " << e.what();
+			}
+		}
+	}
+
+	const pfc::string8 last_path = core_api::pathInProfile("amr-benchmark-last.tsv");
+	const pfc::string8 baseline_path = core_api::pathInProfile("amr-benchmark-baseline.tsv");
+	const pfc::string8 text = amr_benchmark_format_cases(cases);
+	file::ptr out;
+	filesystem::g_open_write_new(out, last_path, p_abort);
+	out->write(text.get_ptr(), text.length(), p_abort);
+	pfc::list_t<amr_benchmark_case> baseline;
+	pfc::string_formatter report;
+	if (filesystem::g_exists(baseline_path, p_abort)) {
+		file::ptr in;
+		filesystem::g_open_read(in, baseline_path, p_abort);
+		pfc::string8 baseline_text;
+		in->read_string_raw(baseline_text, p_abort);
+		amr_benchmark_parse_cases(baseline_text, baseline);
+	}
+	else {
+		filesystem::g_open_write_new(out, baseline_path, p_abort);
+		out->write(text.get_ptr(), text.length(), p_abort);
+		report << "No baseline yet, these results are it: " << baseline_path << "\n";
+	}
+
+	report << runs << " runs of each case, median and median absolute deviation, against baseline:\n";
+	unsigned regressions = 0;
+	for (t_size i = 0; i < cases.get_count(); ++i) {
+		const amr_benchmark_case & c = cases[i];
+		const double median = c.median();
+		report << "  " << c.m_name << ": " << pfc::format_float(median, 0, 1) << " " << c.m_unit << " +-" << pfc::format_float(median > 0 ? 100 * c.deviation() / median : 0, 0, 1) << "%";
+		t_size b = 0;
+		while (b < baseline.get_count() && strcmp(baseline[b].m_name, c.m_name) != 0) ++b;
+		if (b == baseline.get_count()) {
+			report << ", not in baseline\n";
+			continue;
+		}
+		const double before = baseline[b].median();
+		const double change = before > 0 ? 100 * (median - before) / before : 0;
+		const double p = amr_benchmark_p_value(c.m_samples, baseline[b].m_samples);
+		report << ", baseline " << pfc::format_float(before, 0, 1) << " +-" << pfc::format_float(before > 0 ? 100 * baseline[b].deviation() / before : 0, 0, 1)
+			<< "%, " << (change >= 0 ? "+" : "") << pfc::format_float(change, 0, 1) << "% (p " << pfc::format_float(p, 0, 3) << ")";
+		if (p < amr_benchmark_significance && fabs(change) > amr_benchmark_noise_percent) {
+			if (change > 0) ++regressions;
+			report << (change > 0 ? " REGRESSION" : " faster");
+		}
+		report << "\n";
+	}
+	report << (regressions > 0 ? "FAILED" : "PASSED") << ": " << regressions << " cases significantly slower than baseline; results in " << last_path << "\n";
+	return report;
+}
+
+/* tune settings to the machine the first time foobar runs on it, see amr_autotune_initquit */
+static advconfig_checkbox_factory g_amr_autotune("AMR decoder: tune kernels, chunk size and threads to this computer when first run",
+	{ 0xd9fa69b9, 0x4b15, 0x4e59,{ 0x96, 0xc3, 0x6f, 0xd1, 0x58, 0x46, 0xd8, 0x2f } },
+	advconfig_branch::guid_branch_decoding, 45, true);
+
+/* what the autotuner picked, in the profile; that it's there tells it has run on this machine */
+static const char amr_autotune_file[] = "amr-autotune.txt";
+
+/* frames per chunk the autotuner tries, besides the one set */
+static const unsigned amr_autotune_chunks[] = { 10, 25, 50, 100, 250, 500 };
+
+/* what the autotuner picked, and a report of what it measured */
+struct amr_autotune_result {
+	bool m_scalar;
+	unsigned m_chunk_frames;
+	bool m_parallel;
+	pfc::string8 m_report;
+};
+
+/**
+ * Decodes stream in chunks of given frames into one buffer, as input_amr does, with a fresh decoder.
+ *
+ * @param p_stream			frames, without the magic string
+ * @param p_chunk_frames	frames decoded by a call
+ * @param p_engine			post filter engine
+ * @param p_abort			abort callback
+ * @return					ns per frame
+ * @since					1.2.0
+ */
+static double amr_autotune_decode(pfc::array_t<t_uint8> & p_stream, unsigned p_chunk_frames, int p_engine, abort_callback & p_abort) {
+	amr_decoder decoder;
+	decoder.acquire();
+	Decoder_Interface_set_engine(decoder.get(), p_engine);
+	pfc::array_t<float> output;
+	output.set_size((t_size)p_chunk_frames * amr_benchmark_frame_samples);
+	unsigned char * frame = p_stream.get_ptr();
+	t_size left = p_stream.get_size();
+	t_uint64 frames = 0;
+	pfc::hires_timer timer;
+	timer.start();
+	while (left > 0) {
+		int used;
+		const int decoded = Decoder_Interface_DecodeN_float(decoder.get(), frame, (int)left, output.get_ptr(), (int)p_chunk_frames, &used);
+		if (decoded == 0) break;
+		frames += decoded;
+		frame += used;
+		left -= used;
+		p_abort.check();
+	}
+	const double seconds = timer.query();
+	return frames > 0 ? seconds * 1e9 / frames : 0;
+}
+
+/**
+ * Candidate of a setting to keep, from cases of all of them: the fastest by median, if it's faster than the one
+ * set as amr_benchmark_run_compare() tells a case is, else the one set, so noise never moves a setting.
+ *
+ * @param p_cases		a case per candidate
+ * @param p_current		case of the value set
+ * @return				case of the value to keep
+ * @since				1.2.0
+ */
+static t_size amr_autotune_pick(const pfc::list_t<amr_benchmark_case> & p_cases, t_size p_current) {
+	t_size best = p_current;
+	for (t_size i = 0; i < p_cases.get_count(); ++i) {
+		if (p_cases[i].median() < p_cases[best].median()) best = i;
+	}
+	if (best == p_current) return p_current;
+	const double current = p_cases[p_current].median();
+	const double change = current > 0 ? 100 * (current - p_cases[best].median()) / current : 0;
+	if (change > amr_benchmark_noise_percent && amr_benchmark_p_value(p_cases[best].m_samples, p_cases[p_current].m_samples) < amr_benchmark_significance) return best;
+	return p_current;
+}
+
+/* appends a line per case, the one kept marked */
+static void amr_autotune_format(pfc::string_base & p_out, const pfc::list_t<amr_benchmark_case> & p_cases, t_size p_kept) {
+	for (t_size i = 0; i < p_cases.get_count(); ++i) {
+		const amr_benchmark_case & c = p_cases[i];
+		const double median = c.median();
+		p_out << "  " << c.m_name << ": " << pfc::format_float(median, 0, 1) << " " << c.m_unit << " +-"
+			<< pfc::format_float(median > 0 ? 100 * c.deviation() / median : 0, 0, 1) << "%" << (i == p_kept ? ", picked" : "") << "\n";
+	}
+}
+
+/**
+ * Times the candidates of the settings whose best value depends on the machine, on a synthetic stream of all
+ * modes switching, and picks the fastest of each: decoder kernels picked for the CPU or plain C ones, frames
+ * per chunk, and whether long files are decoded on several threads when converting. Candidates of a setting
+ * run in turns, amr_autotune_runs times, and one replaces the value set only if it's significantly faster,
+ * see amr_autotune_pick(). Kernels take the plain C path on this thread only, see
+ * Decoder_Interface_reference_kernels(), so they're compared without restart; with plain C kernels set both
+ * are the same and the setting stays. Threads are turned on if as many as there are cores, up to
+ * amr_benchmark_scaling_streams, decode at least amr_autotune_min_speedup_percent of what one does.
+ * Post filter engines are timed too, but not picked, as the fast ones are not bit-exact; decoding ahead hides
+ * latency of storage, which a stream in memory does not have, so it stays as set.
+ *
+ * @param p_abort		abort callback
+ * @return				values picked and report
+ * @since				1.2.0
+ */
+static amr_autotune_result amr_autotune_run(abort_callback & p_abort) {
+	amr_autotune_result result;
+	result.m_scalar = amr_get_scalar_kernels();
+	result.m_chunk_frames = amr_get_chunk_frames();
+	result.m_parallel = amr_get_parallel();
+
+	pfc::array_t<t_uint8> stream;
+	amr_synth_params params = {};
+	params.m_modes = 0xFF;
+	params.m_switch_frames = 50;
+	params.m_dtx = 0.1;
+	params.m_seed = 1;
+	amr_synthesize(params, amr_autotune_frames, false, stream);
+
+	/* chunk sizes and the one set, if it's none of them */
+	pfc::array_t<unsigned> chunks;
+	for (unsigned i = 0; i < PFC_TABSIZE(amr_autotune_chunks); ++i) chunks.append_single(amr_autotune_chunks[i]);
+	t_size chunk_current = 0;
+	while (chunk_current < chunks.get_size() && chunks[chunk_current] != result.m_chunk_frames) ++chunk_current;
+	if (chunk_current == chunks.get_size()) chunks.append_single(result.m_chunk_frames);
+
+	pfc::list_t<amr_benchmark_case> kernels, sizes, engines;
+	for (unsigned run = 0; run < amr_autotune_runs; ++run) {
+		for (unsigned scalar = 0; scalar < 2; ++scalar) {
+			Decoder_Interface_reference_kernels(scalar);
+			const double ns = amr_autotune_decode(stream, result.m_chunk_frames, DEC_ENGINE_FIXED, p_abort);
+			Decoder_Interface_reference_kernels(0);
+			amr_benchmark_sample(kernels, scalar ? "plain C kernels" : "kernels for this CPU", "ns/frame", ns);
+		}
+		for (t_size i = 0; i < chunks.get_size(); ++i) {
+			amr_benchmark_sample(sizes, pfc::string_formatter() << chunks[i] << " frames per chunk", "ns/frame", amr_autotune_decode(stream, chunks[i], DEC_ENGINE_FIXED, p_abort));
+		}
+		amr_benchmark_sample(engines, "fixed point post filter", "ns/frame", amr_autotune_decode(stream, result.m_chunk_frames, DEC_ENGINE_FIXED, p_abort));
+		amr_benchmark_sample(engines, "floating point post filter", "ns/frame", amr_autotune_decode(stream, result.m_chunk_frames, DEC_ENGINE_FLOAT, p_abort));
+	}
+
+	pfc::string_formatter report;
+	report << "Synthetic stream of all modes, " << (unsigned)amr_autotune_runs << " runs, median and median absolute deviation:\n";
+	const t_size kernel = amr_autotune_pick(kernels, result.m_scalar ? 1 : 0);
+	result.m_scalar = kernel == 1;
+	report << "Decoder kernels (restart required):\n";
+	amr_autotune_format(report, kernels, kernel);
+	const t_size size = amr_autotune_pick(sizes, chunk_current);
+	result.m_chunk_frames = chunks[size];
+	report << "Chunk size:\n";
+	amr_autotune_format(report, sizes, size);
+	report << "Post filter engine, not picked, floating point is not bit-exact:\n";
+	amr_autotune_format(report, engines, pfc_infinite);
+
+	/* one thread, then one per core, each decoding a stream of the highest and lowest mode, in between and DTX pause */
+	static const unsigned types[amr_benchmark_scaling_streams] = { 7, 0, 4, amr_benchmark_sid };
+	pfc::array_t<t_uint8> streams[amr_benchmark_scaling_streams];
+	for (unsigned s = 0; s < amr_benchmark_scaling_streams; ++s) amr_benchmark_synthesize(types[s], streams[s]);
+	const unsigned cores = (unsigned)pfc::min_t<t_size>(pfc::getOptimalWorkerThreadCount(), amr_benchmark_scaling_streams);
+	double rates[2] = { 0, 0 };
+	for (unsigned pass = 0; pass < 2 && cores > 1; ++pass) {
+		pfc::array_t<amr_benchmark_thread> results;
+		results.set_size(pass == 0 ? 1 : cores);
+		const double wall = amr_benchmark_scaling_wall(streams, results, p_abort);
+		t_uint64 frames = 0;
+		for (t_size t = 0; t < results.get_size(); ++t) frames += results[t].m_frames;
+		rates[pass] = wall > 0 ? frames / wall : 0;
+	}
+	if (cores > 1 && rates[0] > 0) {
+		const double speedup = 100 * rates[1] / rates[0];
+		result.m_parallel = speedup >= amr_autotune_min_speedup_percent;
+		report << "Threads decoding long files when converting:\n  1 thread: " << pfc::format_float(rates[0], 0, 0) << " frames/s\n  "
+			<< cores << " threads: " << pfc::format_float(rates[1], 0, 0) << " frames/s, " << pfc::format_float(speedup, 0, 0) << "% of one, "
+			<< (result.m_parallel ? "turned on" : "turned off") << "\n";
+	}
+	else {
+		report << "Threads decoding long files when converting: one core, left as set\n";
+	}
+	result.m_report = report;
+	return result;
+}
+
+/**
+ * Sets what the autotuner picked, and keeps its report in amr_autotune_file in the profile. Main thread only.
+ * Settings are those of the Custom profile; another profile picked in advanced preferences overrides them.
+ *
+ * @param p_result		what amr_autotune_run() picked
+ * @return				report, with what was changed
+ * @since				1.2.0
+ */
+static pfc::string8 amr_autotune_apply(const amr_autotune_result & p_result) {
+	pfc::string_formatter report;
+	report << p_result.m_report;
+	if (p_result.m_scalar != amr_get_scalar_kernels()) report << "Set plain C kernels " << (p_result.m_scalar ? "on" : "off") << ", takes effect after restart\n";
+	if (p_result.m_chunk_frames != amr_get_chunk_frames()) report << "Set frames per chunk to " << p_result.m_chunk_frames << "\n";
+	if (p_result.m_parallel != amr_get_parallel()) report << "Set decoding long files on several threads " << (p_result.m_parallel ? "on" : "off") << "\n";
+	amr_set_scalar_kernels(p_result.m_scalar);
+	amr_set_chunk_frames(p_result.m_chunk_frames);
+	amr_set_parallel(p_result.m_parallel);
+	if (amr_get_profile() != amr_profile_custom) report << "Tuning profile other than Custom is picked, it overrides these settings\n";
+	try {
+		abort_callback_dummy abort;
+		file::ptr out;
+		filesystem::g_open_write_new(out, core_api::pathInProfile(amr_autotune_file), abort);
+		out->write(report.get_ptr(), report.length(), abort);
+	} catch (std::exception const & e) {
+		report << "Report not kept: " << e.what() << "\n";
+	}
+	return report;
+}
+
+/**
+ * Runs the autotuner once per machine: on the first startup after the component is installed, and again when
+ * amr_autotune_file is deleted from the profile, as after moving the profile to another machine. It runs on
+ * a worker of amr_thread_pool at background priority, so startup doesn't wait for it, and what it picked goes
+ * to the console.
+ */
+class amr_autotune_initquit : public initquit {
+public:
+	void on_init() {
+		if (!g_amr_autotune.get()) return;
+		try {
+			abort_callback_dummy abort;
+			if (filesystem::g_exists(core_api::pathInProfile(amr_autotune_file), abort)) return;
+		} catch (std::exception const &) {
+			return;
+		}
+		amr_thread_pool::get().submit(m_task, [this] {
+			try {
+				std::shared_ptr<amr_autotune_result> result = std::make_shared<amr_autotune_result>(amr_autotune_run(m_abort));
+				fb2k::inMainThread([result] { console::formatter() << "AMR decoder autotune\n" << amr_autotune_apply(*result); });
+			} catch (std::exception const &) {
+				/* aborted by shutdown */
+			}
+		}, amr_priority_indexing);
+	}
+
+	void on_quit() {
+		m_abort.abort();
+		m_task.cancel();
+	}
+
+private:
+	abort_callback_impl m_abort;
+	amr_task m_task;
+};
+
+static initquit_factory_t<amr_autotune_initquit> g_amr_autotune_initquit;
+
+/**
+ * Benchmark items in the Utilities context menu. "Benchmark AMR decoder" decodes synthetic streams
+ * of every mode and the selected files, and reports times per frame; realtime factor is 20ms divided
+ * by that. "Benchmark AMR input" times the whole input_amr on the selected files. "Benchmark AMR decoder
+ * scaling" decodes synthetic streams on more and more threads at once, see amr_benchmark_run_scaling().
+ * "Soak test AMR input" plays the selected files over and over for as long as set, watching the process
+ * for leaks, see amr_benchmark_run_soak(). "Write synthetic AMR test files" writes the worst cases the
+ * others are best run on, see amr_synth_write_presets(), to folder amr-synthetic of the profile; it
+ * ignores the selection. "Compare AMR benchmark with baseline" runs all the cases over and over, and
+ * tells which are slower than the baseline, see amr_benchmark_run_compare(). "Autotune AMR decoder" runs
+ * the autotuner again and sets what it picks, see amr_autotune_run(); it ignores the selection too.
+ * All run on a worker thread, and their results go to the console and a popup.
+ *
+ * @since   1.2.0
+ */
+class amr_benchmark_item : public contextmenu_item_simple {
+public:
+	enum {
+		cmd_decoder = 0,
+		cmd_input,
+		cmd_scaling,
+		cmd_soak,
+		cmd_synth,
+		cmd_compare,
+		cmd_autotune,
+		cmd_total
+	};
+	GUID get_parent() { return contextmenu_groups::utilities; }
+	unsigned get_num_items() { return cmd_total; }
+	void get_item_name(unsigned p_index, pfc::string_base & p_out) {
+		switch (p_index) {
+			case cmd_decoder: p_out = "Benchmark AMR decoder"; break;
+			case cmd_input: p_out = "Benchmark AMR input"; break;
+			case cmd_scaling: p_out = "Benchmark AMR decoder scaling"; break;
+			case cmd_soak: p_out = "Soak test AMR input"; break;
+			case cmd_synth: p_out = "Write synthetic AMR test files"; break;
+			case cmd_compare: p_out = "Compare AMR benchmark with baseline"; break;
+			case cmd_autotune: p_out = "Autotune AMR decoder"; break;
+			default: uBugCheck();
+		}
+	}
+	bool get_item_description(unsigned p_index, pfc::string_base & p_out) {
+		switch (p_index) {
+			case cmd_decoder: p_out = "Times decoding of synthetic AMR streams and of the selected files."; return true;
+			case cmd_input: p_out = "Times opening, decoding and seeking the selected AMR files, also with a slow file and without a cached index."; return true;
+			case cmd_scaling: p_out = "Times decoding of independent AMR streams on one thread, then on more at once, up to one per core."; return true;
+			case cmd_soak: p_out = "Opens, decodes, seeks and closes the selected AMR files over and over, and fails if memory, handles or decoders of the process grow."; return true;
+			case cmd_synth: p_out = "Writes AMR files of every mode, mode switching, DTX, bad and corrupt frames and truncation to folder amr-synthetic of the profile, for benchmarks and stress tests."; return true;
+			case cmd_compare: p_out = "Runs every decoder and input benchmark case several times, and reports those significantly slower than the baseline kept in the profile."; return true;
+			case cmd_autotune: p_out = "Times decoder kernels, chunk sizes and threads on this computer, and sets the fastest in advanced preferences."; return true;
+			default: uBugCheck();
+		}
+	}
+	GUID get_item_guid(unsigned p_index) {
+		static const GUID guid_decoder = { 0x7c1e5a90, 0x3b6d, 0x4f27,{ 0x8e, 0x54, 0xa1, 0x0d, 0x6f, 0xc2, 0x93, 0xb8 } };
+		static const GUID guid_input = { 0x1d84b3e6, 0xc05f, 0x4a72,{ 0x9b, 0x2e, 0x5f, 0x71, 0x3a, 0xd8, 0x46, 0x0c } };
+		static const GUID guid_scaling = { 0xa53f0c87, 0x4e19, 0x4d6b,{ 0xb2, 0x70, 0x8c, 0x16, 0xe9, 0x4d, 0x05, 0x3a } };
+		static const GUID guid_soak = { 0x2f96d4b1, 0x08ea, 0x4c73,{ 0xa5, 0x3d, 0x61, 0xf2, 0x8b, 0x0e, 0xc7, 0x94 } };
+		static const GUID guid_synth = { 0x84c2e71a, 0x5d03, 0x4b9f,{ 0xbe, 0x46, 0x13, 0x7a, 0xc9, 0x58, 0x2d, 0xe0 } };
+		static const GUID guid_compare = { 0xe37b5c02, 0x9a4d, 0x4613,{ 0x8f, 0xc1, 0x2d, 0x06, 0xb4, 0x7e, 0x51, 0x9a } };
+		static const GUID guid_autotune = { 0x0af62a4f, 0xd95f, 0x48a4,{ 0x8d, 0x9b, 0xed, 0x7c, 0x36, 0x0f, 0x2e, 0xbf } };
+		switch (p_index) {
+			case cmd_decoder: return guid_decoder;
+			case cmd_input: return guid_input;
+			case cmd_scaling: return guid_scaling;
+			case cmd_soak: return guid_soak;
+			case cmd_synth: return guid_synth;
+			case cmd_compare: return guid_compare;
+			case cmd_autotune: return guid_autotune;
+			default: uBugCheck();
+		}
+	}
+	void context_command(unsigned p_index, metadb_handle_list_cref p_data, const GUID & p_caller) {
+		pfc::list_t<pfc::string8> paths;
+		for (t_size i = 0; i < p_data.get_count(); ++i) {
+			const pfc::string8 path = p_data[i]->get_path();
+			if (!paths.have_item(path)) paths.add_item(path);
+		}
+		const unsigned cmd = p_index;
+		const char * title = cmd == cmd_input ? "AMR input benchmark" : cmd == cmd_scaling ? "AMR decoder scaling benchmark" : cmd == cmd_soak ? "AMR input soak test" : cmd == cmd_synth ? "Synthetic AMR test files" : cmd == cmd_compare ? "AMR benchmark comparison" : cmd == cmd_autotune ? "AMR decoder autotune" : "AMR decoder benchmark";
+		std::shared_ptr<pfc::string8> report = std::make_shared<pfc::string8>();
+		std::shared_ptr<amr_autotune_result> tuned = std::make_shared<amr_autotune_result>();
+		threaded_process::g_run_modeless(threaded_process_callback_lambda::create(nullptr,
+			[paths, report, tuned, cmd](threaded_process_status & p_status, abort_callback & p_abort) {
+				if (cmd == cmd_input) *report = amr_benchmark_run_input(paths, p_status, p_abort);
+				else if (cmd == cmd_scaling) *report = amr_benchmark_run_scaling(p_status, p_abort);
+				else if (cmd == cmd_soak) *report = amr_benchmark_run_soak(paths, p_status, p_abort);
+				else if (cmd == cmd_compare) *report = amr_benchmark_run_compare(paths, p_status, p_abort);
+				else if (cmd == cmd_autotune) *tuned = amr_autotune_run(p_abort);
+				else if (cmd == cmd_synth) *report = amr_synth_write_presets(core_api::pathInProfile("amr-synthetic"), p_abort);
+				else *report = amr_benchmark_run(paths, p_status, p_abort);
+			},
+			[report, tuned, title, cmd](HWND p_wnd, bool p_was_aborted) {
+				if (p_was_aborted) return;
+				/* settings are set here, on the main thread */
+				if (cmd == cmd_autotune) *report = amr_autotune_apply(*tuned);
+				console::formatter() << title << "\n" << *report;
+				popup_message::g_show(*report, title);
+			}),
+			threaded_process::flag_show_progress | threaded_process::flag_show_item | threaded_process::flag_show_abort,
+			core_api::get_main_window(), title);
+	}
+};
+
+static contextmenu_item_factory_t<amr_benchmark_item> g_amr_benchmark_item;
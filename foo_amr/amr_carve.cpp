@@ -0,0 +1,366 @@
+/**
+ * foo_input_amr - AMR-NB streams carved from disk images and memory dumps
+*/
+#include "../foo_sdk/foobar2000/SDK/foobar2000.h"
+extern "C" {
+	#include "../3gpp/interf_dec.h"
+}
+#include <exception>
+#include "amr_frame_reader.h"
+
+enum {
+	/* bytes of the image read at once; next block is read while this one is searched */
+	amr_carve_block_size = 4 * 1024 * 1024,
+	/* frames a run without a file header needs to be taken for a stream, a second; random data passes amr_resync_frames now and then */
+	amr_carve_min_frames = 50,
+	/* streams one image may yield at most; anything beyond is left out of the listing */
+	amr_carve_max_streams = 100000,
+};
+
+static const char g_carve_magic[] = "#!AMR\n";
+static const t_size g_carve_magic_size = sizeof(g_carve_magic) - 1;
+
+/* extensions of images and dumps searched for streams; any other file is not taken for one */
+static const char * const g_carve_extensions[] = { "img", "dd", "raw", "bin", "dmp", "mem", "vmem", "001" };
+
+static advconfig_checkbox_factory g_amr_carve("AMR decoder: list AMR streams found in disk images and memory dumps (.img, .dd, .raw, .bin, .dmp, .mem) as files inside them",
+	{ 0x1c6e3f90, 0xa257, 0x4d18,{ 0x8b, 0x4f, 0xd0, 0x39, 0x7e, 0x61, 0xa5, 0x2c } },
+	advconfig_branch::guid_branch_decoding, 39, false);
+
+/* a stream found in an image: where it starts, the file header if it has one, bytes of it and its frames */
+struct amr_carved_stream {
+	t_filesize m_offset;
+	t_filesize m_size;
+	unsigned m_frames;
+	bool m_header;
+};
+
+/**
+ * Finds AMR-NB storage format streams in arbitrary data: ones starting with file header, and runs of frames
+ * without one, as left of a file whose first cluster was overwritten, or buffered in memory by a phone app.
+ * Data is given a block at a time, and may be of any size; where a frame or header is cut off by the end of
+ * a block, the rest of the block is to be given again with the next one. Bytes which can't start a header
+ * nor a run, most of them, are skipped 16 at a time with SSE2, and runs are found as amr_frame_reader finds
+ * them after damaged data, see amr_frame_reader::find_run(). A stream ends at the first byte which is not
+ * a valid frame header.
+ *
+ * @since   1.2.0
+ */
+class amr_carver {
+public:
+	amr_carver() : m_in(false) {}
+
+	/**
+	 * Searches next block of data.
+	 *
+	 * @param p_data		the data
+	 * @param p_size		its length
+	 * @param p_base		offset of its first byte in the image
+	 * @param p_final		the image ends with it
+	 * @return				bytes of p_data done with; the rest is to come again in front of the next block
+	 * @since				1.2.0
+	 */
+	t_size scan(const t_uint8 * p_data, t_size p_size, t_filesize p_base, bool p_final) {
+		t_size pos = 0;
+		for (;;) {
+			if (m_in) {
+				for (;;) {
+					if (pos == p_size) {
+						if (!p_final) return suspend(p_base, pos);
+						break;
+					}
+					const t_uint8 header = p_data[pos];
+					if (!amr_frame_reader::is_frame_header(header)) break;
+					const t_size length = 1 + Decoder_Interface_block_size[(header >> 3) & 0x0F];
+					if (p_size - pos < length) {
+						if (!p_final) return suspend(p_base, pos);
+						break;
+					}
+					pos += length;
+					++m_current.m_frames;
+				}
+				/* run too short to be a stream may hide one starting inside it; search goes on from the byte after */
+				if (!finish(p_base + pos) && !m_current.m_header) pos = (t_size)(m_current.m_offset - p_base) + 1;
+				continue;
+			}
+			const t_size magic = pos + find_magic(p_data + pos, p_size - pos);
+			/* frames right before a file header end there */
+			const t_size run = pos + amr_frame_reader::find_run(p_data + pos, magic - pos, Decoder_Interface_block_size, p_final || magic < p_size);
+			if (run < magic) {
+				start(p_base + run, false);
+				pos = run;
+				continue;
+			}
+			if (magic < p_size) {
+				start(p_base + magic, true);
+				pos = magic + g_carve_magic_size;
+				continue;
+			}
+			if (p_final) return p_size;
+			/* header may start in the last bytes, and go on in the next block */
+			return p_size - pfc::min_t<t_size>(p_size - pos, g_carve_magic_size - 1);
+		}
+	}
+
+	const pfc::list_t<amr_carved_stream> & get_streams() const { return m_streams; }
+
+private:
+	/* offset of the first whole file header in p_data, or p_size if there is none */
+	static t_size find_magic(const t_uint8 * p_data, t_size p_size) {
+		if (p_size < g_carve_magic_size) return p_size;
+		const t_size last = p_size - g_carve_magic_size;
+		t_size i = 0;
+#ifdef AMR_READER_SSE2
+		/* "#!" anywhere in 16 bytes at once, the rest of the header is compared where it's found */
+		const __m128i first = _mm_set1_epi8(g_carve_magic[0]), second = _mm_set1_epi8(g_carve_magic[1]);
+		for (; i + 17 <= p_size; i += 16) {
+			const __m128i at = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p_data + i)), first);
+			const __m128i after = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p_data + i + 1)), second);
+			unsigned bits = (unsigned)_mm_movemask_epi8(_mm_and_si128(at, after));
+			for (; bits != 0; bits &= bits - 1) {
+				const t_size found = i + lowest_bit(bits);
+				if (found <= last && memcmp(p_data + found, g_carve_magic, g_carve_magic_size) == 0) return found;
+			}
+		}
+#endif
+		for (; i <= last; ++i) {
+			if (p_data[i] == g_carve_magic[0] && memcmp(p_data + i, g_carve_magic, g_carve_magic_size) == 0) return i;
+		}
+		return p_size;
+	}
+
+	/* index of the lowest bit set in nonzero p_bits */
+	static unsigned lowest_bit(unsigned p_bits) {
+#if defined(_MSC_VER)
+		unsigned long index;
+		_BitScanForward(&index, p_bits);
+		return (unsigned)index;
+#else
+		return (unsigned)__builtin_ctz(p_bits);
+#endif
+	}
+
+	void start(t_filesize p_offset, bool p_header) {
+		m_current.m_offset = p_offset;
+		m_current.m_size = 0;
+		m_current.m_frames = 0;
+		m_current.m_header = p_header;
+		m_in = true;
+	}
+
+	/**
+	 * Block ended in the current stream at p_pos; returns bytes done with. Run without file header is kept
+	 * from its first frame until it has frames enough to be a stream, so search can go back into it if it
+	 * falls short; it's found again at the front of the next block.
+	 */
+	t_size suspend(t_filesize p_base, t_size p_pos) {
+		if (m_current.m_header || m_current.m_frames >= (unsigned)amr_carve_min_frames) return p_pos;
+		m_in = false;
+		return (t_size)(m_current.m_offset - p_base);
+	}
+
+	/* ends the current stream at given offset, and keeps it if it's one; returns whether it was */
+	bool finish(t_filesize p_end) {
+		m_in = false;
+		m_current.m_size = p_end - m_current.m_offset;
+		if (m_current.m_frames < (m_current.m_header ? 1u : (unsigned)amr_carve_min_frames)) return false;
+		if (m_streams.get_count() < amr_carve_max_streams) m_streams.add_item(m_current);
+		return true;
+	}
+
+	pfc::list_t<amr_carved_stream> m_streams;
+	/* stream being walked */
+	bool m_in;
+	amr_carved_stream m_current;
+};
+
+/**
+ * Searches a whole image for streams, reading the next block on another thread while one is searched,
+ * so it goes as fast as the image can be read.
+ *
+ * @param p_file		the image
+ * @param p_out			receives the streams, in order of their offset
+ * @param p_abort		abort callback
+ * @since				1.2.0
+ */
+static void amr_carve_scan(const service_ptr_t<file> & p_file, pfc::list_t<amr_carved_stream> & p_out, abort_callback & p_abort) {
+	amr_carver carver;
+	/* bytes of the last block not done with, then the block read after it */
+	pfc::array_t<t_uint8> data, next;
+	data.set_size(amr_resync_span + g_carve_magic_size + amr_carve_block_size);
+	next.set_size(amr_carve_block_size);
+	t_size left = 0, read = 0;
+	t_filesize base = 0;
+	std::exception_ptr error;
+	pfc::thread2 thread;
+	const auto read_next = [&] {
+		thread.startHere([&] {
+			try {
+				read = p_file->read(next.get_ptr(), amr_carve_block_size, p_abort);
+			} catch (...) {
+				read = 0;
+				error = std::current_exception();
+			}
+		});
+	};
+	p_file->seek(0, p_abort);
+	read_next();
+	for (;;) {
+		thread.waitTillDone();
+		if (error) std::rethrow_exception(error);
+		p_abort.check();
+		/* what's not done with is a frame or a header cut off, or a run not long enough yet, amr_carve_min_frames frames at most */
+		if (data.get_size() < left + read) data.set_size(left + read);
+		memcpy(data.get_ptr() + left, next.get_ptr(), read);
+		left += read;
+		const bool final = read == 0;
+		if (!final) read_next();
+		const t_size done = carver.scan(data.get_ptr(), left, base, final);
+		if (final) break;
+		memmove(data.get_ptr(), data.get_ptr() + done, left - done);
+		left -= done;
+		base += done;
+	}
+	p_out = carver.get_streams();
+}
+
+/**
+ * A carved stream as a file: its bytes in the image, after a file header if it lacks one, so input_amr plays it as any other file.
+ *
+ * @since   1.2.0
+ */
+class amr_carved_file : public file_readonly {
+public:
+	amr_carved_file(const service_ptr_t<file> & p_image, t_filesize p_offset, t_filesize p_size, bool p_header)
+		: m_image(p_image), m_offset(p_offset), m_size(p_size), m_prefix(p_header ? 0 : g_carve_magic_size), m_position(0) {}
+
+	t_size read(void * p_buffer, t_size p_bytes, abort_callback & p_abort) {
+		t_uint8 * out = (t_uint8 *)p_buffer;
+		t_size done = 0;
+		if (m_position < m_prefix) {
+			done = (t_size)pfc::min_t<t_filesize>(p_bytes, m_prefix - m_position);
+			memcpy(out, g_carve_magic + m_position, done);
+			m_position += done;
+		}
+		const t_filesize end = m_prefix + m_size;
+		const t_size bytes = (t_size)pfc::min_t<t_filesize>(p_bytes - done, end - pfc::min_t(m_position, end));
+		if (bytes > 0) {
+			m_image->seek(m_offset + m_position - m_prefix, p_abort);
+			const t_size got = m_image->read(out + done, bytes, p_abort);
+			m_position += got;
+			done += got;
+		}
+		return done;
+	}
+
+	t_filesize get_size(abort_callback & p_abort) { return m_prefix + m_size; }
+	t_filesize get_position(abort_callback & p_abort) { return m_position; }
+	void seek(t_filesize p_position, abort_callback & p_abort) {
+		if (p_position > m_prefix + m_size) throw exception_io_seek_out_of_range();
+		m_position = p_position;
+	}
+	bool can_seek() { return true; }
+	bool get_content_type(pfc::string_base & p_out) { return false; }
+	void reopen(abort_callback & p_abort) { seek(0, p_abort); }
+	bool is_remote() { return m_image->is_remote(); }
+	t_filetimestamp get_timestamp(abort_callback & p_abort) { return m_image->get_timestamp(p_abort); }
+
+private:
+	const service_ptr_t<file> m_image;
+	const t_filesize m_offset, m_size;
+	/* bytes of file header put in front */
+	const t_filesize m_prefix;
+	t_filesize m_position;
+};
+
+/**
+ * Disk images and memory dumps as archives of the AMR-NB streams found in them, see amr_carver, so
+ * recovered audio is added to playlists, played, and converted as files. Names of the streams tell
+ * where they are in the image, as stream_<offset>_<size>.amr with file header, frames_<offset>_<size>.amr
+ * without, in hex, so a stream is opened without searching the image again. Off unless it's set in
+ * preferences, as adding an image reads all of it.
+ *
+ * @since   1.2.0
+ */
+class amr_carve_archive : public archive_impl {
+public:
+	bool supports_content_types() { return false; }
+	const char * get_archive_type() { return "amrcarve"; }
+
+	t_filestats get_stats_in_archive(const char * p_archive, const char * p_file, abort_callback & p_abort) {
+		amr_carved_stream stream;
+		if (!parse_name(p_file, stream)) throw exception_io_not_found();
+		service_ptr_t<file> image;
+		filesystem::g_open_read(image, p_archive, p_abort);
+		t_filestats stats;
+		stats.m_size = stream.m_size + (stream.m_header ? 0 : g_carve_magic_size);
+		stats.m_timestamp = image->get_timestamp(p_abort);
+		return stats;
+	}
+
+	void open_archive(service_ptr_t<file> & p_out, const char * p_archive, const char * p_file, abort_callback & p_abort) {
+		amr_carved_stream stream;
+		if (!parse_name(p_file, stream)) throw exception_io_not_found();
+		service_ptr_t<file> image;
+		filesystem::g_open_read(image, p_archive, p_abort);
+		const t_filesize size = image->get_size(p_abort);
+		if (size != filesize_invalid && (stream.m_offset > size || stream.m_size > size - stream.m_offset)) throw exception_io_not_found();
+		p_out = new service_impl_t<amr_carved_file>(image, stream.m_offset, stream.m_size, stream.m_header);
+	}
+
+	void archive_list(const char * p_path, const service_ptr_t<file> & p_reader, archive_callback & p_out, bool p_want_readers) {
+		if (!g_amr_carve.get() || !is_image(p_path)) throw exception_io_data();
+		service_ptr_t<file> image = p_reader;
+		if (image.is_empty()) filesystem::g_open_read(image, p_path, p_out);
+		pfc::list_t<amr_carved_stream> streams;
+		amr_carve_scan(image, streams, p_out);
+		if (streams.get_count() == 0) throw exception_io_data();
+		const t_filetimestamp timestamp = image->get_timestamp(p_out);
+		for (t_size i = 0; i < streams.get_count(); ++i) {
+			const amr_carved_stream & stream = streams[i];
+			pfc::string_formatter name, url;
+			name << (stream.m_header ? "stream_" : "frames_") << pfc::format_hex(stream.m_offset, 12) << "_" << pfc::format_hex(stream.m_size) << ".amr";
+			make_unpack_path(url, p_path, name);
+			t_filestats stats;
+			stats.m_size = stream.m_size + (stream.m_header ? 0 : g_carve_magic_size);
+			stats.m_timestamp = timestamp;
+			service_ptr_t<file> reader;
+			if (p_want_readers) {
+				/* readers share the image handle; each seeks it before it reads */
+				reader = new service_impl_t<amr_carved_file>(image, stream.m_offset, stream.m_size, stream.m_header);
+			}
+			if (!p_out.on_entry(this, url, stats, reader)) break;
+		}
+	}
+
+private:
+	/* extension is one of an image or a dump */
+	static bool is_image(const char * p_path) {
+		const pfc::string_extension extension(p_path);
+		for (t_size i = 0; i < PFC_TABSIZE(g_carve_extensions); ++i) {
+			if (stricmp_utf8(extension, g_carve_extensions[i]) == 0) return true;
+		}
+		return false;
+	}
+
+	/* stream a name given by archive_list() stands for */
+	static bool parse_name(const char * p_name, amr_carved_stream & p_out) {
+		pfc::string8 name = pfc::string_filename(p_name);
+		if (pfc::strcmp_partial(name, "stream_") == 0) p_out.m_header = true;
+		else if (pfc::strcmp_partial(name, "frames_") == 0) p_out.m_header = false;
+		else return false;
+		const char * offset = name.get_ptr() + 7;
+		const char * separator = strchr(offset, '_');
+		if (separator == NULL || separator == offset || separator[1] == 0) return false;
+		try {
+			p_out.m_offset = pfc::atohex<t_filesize>(offset, separator - offset);
+			p_out.m_size = pfc::atohex<t_filesize>(separator + 1, strlen(separator + 1));
+		} catch (std::exception const &) {
+			return false;
+		}
+		p_out.m_frames = 0;
+		return true;
+	}
+};
+
+static archive_factory_t<amr_carve_archive> g_amr_carve_archive;
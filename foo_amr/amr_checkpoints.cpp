@@ -0,0 +1,92 @@
+/**
+ * foo_input_amr - decoder checkpoints kept compact, as differences from the one before
+*/
+#include "../foo_sdk/foobar2000/SDK/foobar2000.h"
+#include "amr_checkpoints.h"
+
+enum {
+	/* bytes a mask byte covers */
+	amr_checkpoint_group = 8,
+	/* most groups a run of zero ones counts */
+	amr_checkpoint_max_run = 255,
+};
+
+/**
+ * Packs XOR of p_state and p_base, or p_state alone if there's no base, to p_out.
+ *
+ * @param p_out			room for p_size + p_size / amr_checkpoint_group + 1 bytes, as much as packing takes at most
+ * @return				bytes written
+ */
+static t_size amr_checkpoint_pack(const t_uint8 * p_state, const t_uint8 * p_base, t_size p_size, t_uint8 * p_out) {
+	t_uint8 * out = p_out;
+	t_size zero_run = 0;
+	for (t_size group = 0; group < p_size; group += amr_checkpoint_group) {
+		const t_size count = pfc::min_t<t_size>(amr_checkpoint_group, p_size - group);
+		t_uint8 diff[amr_checkpoint_group];
+		unsigned mask = 0;
+		for (t_size i = 0; i < count; ++i) {
+			diff[i] = p_base != NULL ? p_state[group + i] ^ p_base[group + i] : p_state[group + i];
+			if (diff[i] != 0) mask |= 1u << i;
+		}
+		if (mask == 0) {
+			++zero_run;
+			if (zero_run == amr_checkpoint_max_run) {
+				*out++ = 0;
+				*out++ = (t_uint8)zero_run;
+				zero_run = 0;
+			}
+			continue;
+		}
+		if (zero_run > 0) {
+			*out++ = 0;
+			*out++ = (t_uint8)zero_run;
+			zero_run = 0;
+		}
+		*out++ = (t_uint8)mask;
+		for (t_size i = 0; i < count; ++i) if (diff[i] != 0) *out++ = diff[i];
+	}
+	/* zero groups at the end need nothing; unpacking starts from zeros or the base */
+	return out - p_out;
+}
+
+/* XORs what amr_checkpoint_pack() packed into p_out, p_size bytes, which are zeros or the base */
+static void amr_checkpoint_unpack(const t_uint8 * p_data, const t_uint8 * p_end, t_uint8 * p_out, t_size p_size) {
+	t_size group = 0;
+	while (p_data < p_end && group < p_size) {
+		const t_uint8 mask = *p_data++;
+		if (mask == 0) {
+			group += (t_size)*p_data++ * amr_checkpoint_group;
+			continue;
+		}
+		for (unsigned i = 0; i < amr_checkpoint_group; ++i) if (mask & (1u << i)) p_out[group + i] ^= *p_data++;
+		group += amr_checkpoint_group;
+	}
+}
+
+void amr_checkpoint_store::reset() {
+	m_data.set_size(0);
+	m_start.set_size(0);
+	m_last.set_size(0);
+	m_size = 0;
+}
+
+void amr_checkpoint_store::append(const t_uint8 * p_state, t_size p_size) {
+	PFC_ASSERT(get_count() == 0 || p_size == m_size);
+	m_size = p_size;
+	const t_size count = get_count();
+	const t_size offset = m_data.get_size();
+	m_data.set_size(offset + p_size + p_size / amr_checkpoint_group + 1);
+	const t_uint8 * base = count % amr_checkpoint_key_interval == 0 ? NULL : m_last.get_ptr();
+	m_data.set_size(offset + amr_checkpoint_pack(p_state, base, p_size, m_data.get_ptr() + offset));
+	m_start.append_single(offset);
+	m_last.set_data_fromptr(p_state, p_size);
+}
+
+void amr_checkpoint_store::get(t_size p_index, t_uint8 * p_out) const {
+	PFC_ASSERT(p_index < get_count());
+	memset(p_out, 0, m_size);
+	for (t_size i = p_index / amr_checkpoint_key_interval * amr_checkpoint_key_interval; i <= p_index; ++i) {
+		const t_size end = i + 1 < get_count() ? m_start[i + 1] : m_data.get_size();
+		amr_checkpoint_unpack(m_data.get_ptr() + m_start[i], m_data.get_ptr() + end, p_out, m_size);
+	}
+}
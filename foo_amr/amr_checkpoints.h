@@ -0,0 +1,60 @@
+/**
+ * foo_input_amr - decoder checkpoints kept compact, as differences from the one before
+*/
+#pragma once
+
+enum {
+	/* every this many checkpoints one is kept whole, so restoring one applies this many differences at most */
+	amr_checkpoint_key_interval = 8,
+};
+
+/**
+ * Decoder states saved as decoding goes, see Decoder_Interface_snapshot(), one after another, kept in
+ * a fraction of their size. Each is stored as the XOR of it and the one before, or of zeros for every
+ * amr_checkpoint_key_interval-th one; runs of 8 bytes become a byte telling which of them are not zero,
+ * followed by those, and runs of all zero 8 bytes a zero byte and their count. Memories that don't
+ * change between checkpoints, the high halves of 32-bit ones holding 16-bit values and the state of
+ * what wasn't used, as the DTX state during speech, mostly are zero then; a state of a few KB takes less
+ * than half. Restoring one takes unpacking the key state before it and the differences after that.
+ *
+ * @since   1.2.0
+ */
+class amr_checkpoint_store {
+public:
+	amr_checkpoint_store() : m_size(0) {}
+
+	/* drops all states */
+	void reset();
+
+	/* number of states */
+	t_size get_count() const { return m_start.get_size(); }
+
+	/**
+	 * Adds a state after the ones there are.
+	 *
+	 * @param p_state		the state
+	 * @param p_size		its size in bytes; the same for all states until reset()
+	 * @since				1.2.0
+	 */
+	void append(const t_uint8 * p_state, t_size p_size);
+
+	/**
+	 * Gets a state as it was added.
+	 *
+	 * @param p_index		number of the state, from 0
+	 * @param p_out			receives the state, size given to append()
+	 * @since				1.2.0
+	 */
+	void get(t_size p_index, t_uint8 * p_out) const;
+
+	/* bytes kept, all states together */
+	t_size get_memory() const { return m_data.get_size() + m_start.get_size() * sizeof(t_size) + m_last.get_size(); }
+
+private:
+	t_size m_size;
+	/* packed states one after another, and where each starts */
+	pfc::array_t<t_uint8, pfc::alloc_fast_aggressive> m_data;
+	pfc::array_t<t_size, pfc::alloc_fast_aggressive> m_start;
+	/* state added last, as it was, which the next one is packed against */
+	pfc::array_t<t_uint8> m_last;
+};
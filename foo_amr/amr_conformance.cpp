@@ -0,0 +1,203 @@
+/**
+ * foo_input_amr - checking decoder output against reference decoder output
+*/
+#include "../foo_sdk/foobar2000/SDK/foobar2000.h"
+extern "C" {
+	#include "../3gpp/interf_dec.h"
+}
+#include "amr_decoder_pool.h"
+#include "amr_frame_reader.h"
+
+enum {
+	/* every frame decodes to 160 samples */
+	amr_conformance_frame_samples = 160,
+	/* frames start after the magic string */
+	amr_conformance_start = 6,
+};
+
+
+/* reference output is looked for next to the file, with this extension: 16-bit little endian samples, as the 3gpp decoder writes them */
+static const char g_reference_extension[] = "pcm";
+
+/**
+ * Decodes frames one at a time to 16-bit samples, the way the 3gpp reference decoder does.
+ *
+ * @param p_data		frames, without the magic string
+ * @param p_size		length of p_data in bytes
+ * @param p_out			receives the samples
+ * @param p_abort		abort callback
+ * @since				1.2.0
+ */
+static void amr_conformance_decode(const t_uint8 * p_data, t_size p_size, pfc::array_t<t_int16> & p_out, abort_callback & p_abort) {
+	/* count whole frames first, so the output is allocated once */
+	t_size frames = 0;
+	for (t_size pos = 0; pos < p_size; ++frames) {
+		const t_size size = 1 + Decoder_Interface_block_size[(p_data[pos] >> 3) & 0x0F];
+		if (p_size - pos < size) break;
+		pos += size;
+	}
+	p_out.set_size(frames * amr_conformance_frame_samples);
+
+	amr_decoder decoder;
+	decoder.acquire();
+	const t_uint8 * frame = p_data;
+	for (t_size i = 0; i < frames; ++i) {
+		Decoder_Interface_Decode(decoder.get(), const_cast<t_uint8 *>(frame), p_out.get_ptr() + i * amr_conformance_frame_samples, 0);
+		frame += 1 + Decoder_Interface_block_size[(frame[0] >> 3) & 0x0F];
+		p_abort.check();
+	}
+}
+
+/* appends result of comparing p_count samples to p_out: match, or where they first differ */
+static void amr_conformance_report(pfc::string_base & p_out, const char * p_name, t_size p_mismatch, t_size p_count, t_size p_expected) {
+	p_out << "  " << p_name << ": ";
+	if (p_mismatch < p_count) {
+		p_out << "differs at sample " << p_mismatch << ", frame " << p_mismatch / amr_conformance_frame_samples << "\n";
+	} else if (p_count != p_expected) {
+		p_out << p_count << " samples, expected " << p_expected << "\n";
+	} else {
+		p_out << "match, " << p_count / amr_conformance_frame_samples << " frames\n";
+	}
+}
+
+/**
+ * Checks the selected files the way 3GPP TS 26.074 test vectors are checked: output of the per frame
+ * 16-bit decoder is compared with reference output, if there is one, and output of the optimized
+ * paths, batch decoding and input_amr with whatever it's set to, is compared with that.
+ *
+ * @param p_paths		files to check
+ * @param p_status		progress
+ * @param p_abort		abort callback
+ * @return				report, one line per comparison
+ * @since				1.2.0
+ */
+static pfc::string8 amr_conformance_run(const pfc::list_t<pfc::string8> & p_paths, threaded_process_status & p_status, abort_callback & p_abort) {
+	pfc::string_formatter report;
+	for (t_size i = 0; i < p_paths.get_count(); ++i) {
+		p_status.set_progress(i, p_paths.get_count());
+		p_status.set_item_path(p_paths[i]);
+		report << p_paths[i] << ":\n";
+		try {
+			file::ptr f;
+			filesystem::g_open_read(f, p_paths[i], p_abort);
+			amr_frame_reader reader;
+			reader.attach(f);
+			if (!reader.load(p_abort) || reader.get_size() < amr_conformance_start || memcmp(reader.get_data(), "#!AMR\x0a", amr_conformance_start) != 0) {
+				report << "  not a local AMR file\n";
+				continue;
+			}
+			pfc::array_t<t_int16> pcm;
+			amr_conformance_decode(reader.get_data() + amr_conformance_start, reader.get_size() - amr_conformance_start, pcm, p_abort);
+			const t_size count = pcm.get_size();
+
+			/* reference output */
+			const pfc::string8 reference = pfc::string_replace_extension(p_paths[i], g_reference_extension);
+			if (filesystem::g_exists(reference, p_abort)) {
+				file::ptr r;
+				filesystem::g_open_read(r, reference, p_abort);
+				pfc::array_t<t_uint8> expected;
+				expected.set_size((t_size)r->get_size_ex(p_abort));
+				r->read_object(expected.get_ptr(), expected.get_size(), p_abort);
+				const t_size samples = expected.get_size() / 2;
+				t_size mismatch = pfc_infinite;
+				for (t_size k = 0; k < samples && k < count; ++k) {
+					if ((t_int16)(expected[2 * k] | expected[2 * k + 1] << 8) != pcm[k]) {
+						mismatch = k;
+						break;
+					}
+				}
+				amr_conformance_report(report, "reference", mismatch, pfc::min_t(samples, count), count);
+			} else {
+				report << "  reference: no ." << g_reference_extension << " file next to it\n";
+			}
+
+			/* batch decoding */
+			{
+				pfc::array_t<t_int16> batch;
+				batch.set_size(count);
+				amr_decoder decoder;
+				decoder.acquire();
+				const int frames = Decoder_Interface_DecodeN(decoder.get(), const_cast<t_uint8 *>(reader.get_data() + amr_conformance_start),
+					(int)(reader.get_size() - amr_conformance_start), batch.get_ptr(), (int)(count / amr_conformance_frame_samples), NULL);
+				const t_size samples = (t_size)frames * amr_conformance_frame_samples;
+				t_size mismatch = pfc_infinite;
+				for (t_size k = 0; k < samples; ++k) {
+					if (batch[k] != pcm[k]) {
+						mismatch = k;
+						break;
+					}
+				}
+				amr_conformance_report(report, "batch", mismatch, samples, count);
+			}
+
+			/* input_amr, as converter runs it; float output is exactly the 16-bit one scaled */
+			{
+				service_ptr_t<input_decoder> decoder;
+				input_entry::g_open_for_decoding(decoder, f, p_paths[i], p_abort);
+				decoder->initialize(0, input_flag_simpledecode, p_abort);
+				audio_chunk_impl chunk;
+				t_size samples = 0;
+				t_size mismatch = pfc_infinite;
+				while (mismatch == pfc_infinite && decoder->run(chunk, p_abort)) {
+					const audio_sample * data = chunk.get_data();
+					const t_size n = chunk.get_sample_count();
+					for (t_size k = 0; k < n && samples + k < count; ++k) {
+						if (data[k] != (audio_sample)pcm[samples + k] * (1.0f / 32768.0f)) {
+							mismatch = samples + k;
+							break;
+						}
+					}
+					samples += n;
+				}
+				amr_conformance_report(report, "input", mismatch, samples, count);
+			}
+		} catch (exception_aborted const &) {
+			throw;
+		} catch (std::exception const & e) {
+			report << "  " << e.what() << "\n";
+		}
+	}
+	return report;
+}
+
+/**
+ * "Verify AMR decoder" item in the Utilities context menu, see amr_conformance_run. Decoder kernels
+ * of both kinds are checked by running it again with plain C kernels turned on in advanced preferences.
+ *
+ * @since   1.2.0
+ */
+class amr_conformance_item : public contextmenu_item_simple {
+public:
+	GUID get_parent() { return contextmenu_groups::utilities; }
+	unsigned get_num_items() { return 1; }
+	void get_item_name(unsigned p_index, pfc::string_base & p_out) { p_out = "Verify AMR decoder"; }
+	bool get_item_description(unsigned p_index, pfc::string_base & p_out) {
+		p_out = "Compares decoder output for the selected AMR files with reference output in .pcm files next to them.";
+		return true;
+	}
+	GUID get_item_guid(unsigned p_index) {
+		static const GUID guid = { 0x94f0c2d7, 0x1e8a, 0x4b63,{ 0xa5, 0x0f, 0x27, 0xd9, 0x6c, 0x3e, 0x81, 0x5a } };
+		return guid;
+	}
+	void context_command(unsigned p_index, metadb_handle_list_cref p_data, const GUID & p_caller) {
+		pfc::list_t<pfc::string8> paths;
+		for (t_size i = 0; i < p_data.get_count(); ++i) {
+			const pfc::string8 path = p_data[i]->get_path();
+			if (!paths.have_item(path)) paths.add_item(path);
+		}
+		std::shared_ptr<pfc::string8> report = std::make_shared<pfc::string8>();
+		threaded_process::g_run_modeless(threaded_process_callback_lambda::create(nullptr,
+			[paths, report](threaded_process_status & p_status, abort_callback & p_abort) {
+				*report = amr_conformance_run(paths, p_status, p_abort);
+			},
+			[report](HWND p_wnd, bool p_was_aborted) {
+				if (p_was_aborted) return;
+				console::formatter() << "AMR decoder verification\n" << *report;
+				popup_message::g_show(*report, "AMR decoder verification");
+			}),
+			threaded_process::flag_show_progress | threaded_process::flag_show_item | threaded_process::flag_show_abort,
+			core_api::get_main_window(), "Verifying AMR decoder");
+	}
+};
+
+static contextmenu_item_factory_t<amr_conformance_item> g_amr_conformance_item;
@@ -0,0 +1,7 @@
+/**
+ * foo_input_amr - counters of what all inputs and caches do, for live statistics
+*/
+#include "../foo_sdk/foobar2000/SDK/foobar2000.h"
+#include "amr_counters.h"
+
+std::atomic<t_int64> g_amr_counters[amr_counters];
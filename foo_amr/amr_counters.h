@@ -0,0 +1,61 @@
+/**
+ * foo_input_amr - counters of what all inputs and caches do, for live statistics
+*/
+#pragma once
+
+#include <atomic>
+
+/* what's counted; rates are told from how counts grow over time */
+enum amr_counter {
+	/* inputs decoding now */
+	amr_counter_decoders,
+	/* 20ms frames decoded, and time decode_run() took for them, in microseconds */
+	amr_counter_frames,
+	amr_counter_decode_us,
+	/* bytes frame readers read from files, and time the reads took, in microseconds */
+	amr_counter_read_bytes,
+	amr_counter_read_us,
+	/* lookups in the index cache, in decoded audio in memory and on disk, and how many of them found what they looked for */
+	amr_counter_index_lookups,
+	amr_counter_index_hits,
+	amr_counter_pcm_lookups,
+	amr_counter_pcm_hits,
+	amr_counter_disk_lookups,
+	amr_counter_disk_hits,
+	amr_counters,
+};
+
+/* the counts, shared by all threads; counting is a relaxed add, so it costs next to nothing where it's done */
+extern std::atomic<t_int64> g_amr_counters[amr_counters];
+
+inline void amr_count(amr_counter p_counter, t_int64 p_count = 1) { g_amr_counters[p_counter].fetch_add(p_count, std::memory_order_relaxed); }
+inline t_int64 amr_counter_get(amr_counter p_counter) { return g_amr_counters[p_counter].load(std::memory_order_relaxed); }
+
+/**
+ * One of a counter of things going on, as inputs decoding, for as long as it's held; held once
+ * however often hold() is called.
+ *
+ * @since   1.2.0
+ */
+template<amr_counter t_counter> class amr_counter_hold {
+public:
+	amr_counter_hold() : m_held(false) {}
+	~amr_counter_hold() { release(); }
+
+	void hold() {
+		if (m_held) return;
+		amr_count(t_counter);
+		m_held = true;
+	}
+
+	void release() {
+		if (!m_held) return;
+		amr_count(t_counter, -1);
+		m_held = false;
+	}
+
+private:
+	amr_counter_hold(const amr_counter_hold &);
+	amr_counter_hold & operator=(const amr_counter_hold &);
+	bool m_held;
+};
@@ -0,0 +1,147 @@
+/**
+ * foo_input_amr - reading and decoding ahead of playback on a worker thread
+*/
+#include "../foo_sdk/foobar2000/SDK/foobar2000.h"
+extern "C" {
+	#include "../3gpp/interf_dec.h"
+}
+#include "amr_decode_ahead.h"
+#include "amr_tuning.h"
+
+enum {
+	/* samples decoded from one frame */
+	amr_ahead_frame_samples = 160,
+};
+
+static advconfig_checkbox_factory g_amr_decode_ahead("AMR decoder: read and decode ahead on a separate thread when playing",
+	{ 0xc27e4a91, 0x5d03, 0x4f6b,{ 0x8e, 0x2a, 0x97, 0x4c, 0xd0, 0x6b, 0x38, 0xe5 } },
+	advconfig_branch::guid_branch_decoding, 6, false);
+
+/* each block is a chunk, a second of audio by default */
+static advconfig_integer_factory g_amr_ahead_depth("AMR decoder: blocks read and decoded ahead when playing, 1 to 8",
+	{ 0xe3a05f2d, 0x7b16, 0x4c8e,{ 0xa2, 0x94, 0x3f, 0x61, 0xd8, 0x0c, 0x57, 0xb9 } },
+	advconfig_branch::guid_branch_decoding, 32, amr_ahead_blocks, 1, amr_ahead_blocks);
+
+bool amr_decode_ahead::is_enabled() {
+	return amr_tuned<bool>(g_amr_decode_ahead.get(), true, g_amr_decode_ahead.get(), g_amr_decode_ahead.get());
+}
+
+/* blocks the thread may get ahead by, as set in preferences; low memory profile keeps two */
+static unsigned amr_ahead_depth() {
+	const unsigned custom = (unsigned)pfc::min_t<t_uint64>(pfc::max_t<t_uint64>(g_amr_ahead_depth.get(), 1), amr_ahead_blocks);
+	return amr_tuned<unsigned>(custom, amr_ahead_blocks, amr_ahead_blocks, 2);
+}
+
+amr_decode_ahead::amr_decode_ahead() : m_reader(NULL), m_decoder(NULL), m_block_size(NULL), m_frame(0), m_end(0), m_block_frames(0),
+	m_checkpoint(0), m_interval(0), m_depth(amr_ahead_blocks), m_head(0), m_tail(0), m_done(false), m_active(false) {}
+
+amr_decode_ahead::~amr_decode_ahead() {
+	reset();
+}
+
+void amr_decode_ahead::start(amr_frame_reader & p_reader, amr_decoder & p_decoder, const short * p_block_size, unsigned p_frame, unsigned p_frames,
+	unsigned p_block_frames, unsigned p_checkpoint, unsigned p_interval) {
+	reset();
+	m_reader = &p_reader;
+	m_decoder = &p_decoder;
+	m_block_size = p_block_size;
+	m_frame = p_frame;
+	m_end = p_frame + p_frames;
+	m_block_frames = p_block_frames;
+	m_checkpoint = p_checkpoint;
+	m_interval = p_interval;
+	m_depth = amr_ahead_depth();
+	m_head = 0;
+	m_tail = 0;
+	m_done = false;
+	m_error = std::exception_ptr();
+	m_filled.set_state(false);
+	m_space.set_state(false);
+	m_abort.reset();
+	m_active = true;
+	amr_thread_pool::get().submit(m_task, [this] { produce(); }, amr_priority_playback);
+}
+
+void amr_decode_ahead::reset() {
+	if (!m_active) return;
+	/* wakes the thread wherever it waits, reads included; it's not run at all if no worker took it yet */
+	m_abort.abort();
+	m_task.cancel();
+	m_error = std::exception_ptr();
+	m_active = false;
+}
+
+void amr_decode_ahead::produce() {
+	try {
+		const t_size snapshot_size = Decoder_Interface_snapshot_size();
+		while (m_frame < m_end) {
+			/* wait for the caller to give a block back; event is cleared first, so a pop() in between is not missed */
+			while (m_head.load(std::memory_order_relaxed) - m_tail.load(std::memory_order_acquire) >= m_depth) {
+				m_space.set_state(false);
+				if (m_head.load(std::memory_order_relaxed) - m_tail.load(std::memory_order_acquire) < m_depth) break;
+				m_abort.waitForEvent(m_space, -1);
+			}
+
+			const unsigned head = m_head.load(std::memory_order_relaxed);
+			block & b = m_blocks[head % amr_ahead_blocks];
+			const unsigned wanted = pfc::min_t(m_block_frames, m_end - m_frame);
+			b.m_samples.set_size(wanted * amr_ahead_frame_samples);
+			b.m_frames = 0;
+			b.m_bytes = 0;
+			b.m_checkpoints = 0;
+			while (b.m_frames < wanted) {
+				/* run ends where the next checkpoint is to be taken */
+				unsigned run_frames = wanted - b.m_frames;
+				if (m_checkpoint > m_frame) run_frames = pfc::min_t(run_frames, m_checkpoint - m_frame);
+				unsigned frames;
+				t_size size;
+				const t_uint8 * run = m_reader->next_run(m_block_size, run_frames, frames, size, m_abort);
+				if (run == NULL) break;
+				Decoder_Interface_DecodeN_float(m_decoder->get(), const_cast<t_uint8*>(run), (int)size, b.m_samples.get_ptr() + b.m_frames * amr_ahead_frame_samples, (int)frames, NULL);
+				b.m_frames += frames;
+				b.m_bytes += size;
+				m_frame += frames;
+				if (m_checkpoint > 0 && m_frame == m_checkpoint) {
+					b.m_snapshot.set_size((b.m_checkpoints + 1) * snapshot_size);
+					Decoder_Interface_snapshot(m_decoder->get(), b.m_snapshot.get_ptr() + b.m_checkpoints * snapshot_size);
+					++b.m_checkpoints;
+					m_checkpoint += m_interval;
+				}
+			}
+
+			/* file is shorter than expected; there is nothing more to read */
+			const bool ended = b.m_frames < wanted;
+			if (b.m_frames > 0) {
+				m_head.store(head + 1, std::memory_order_release);
+				m_filled.set_state(true);
+			}
+			if (ended) break;
+		}
+	} catch (...) {
+		m_error = std::current_exception();
+	}
+	m_done.store(true, std::memory_order_release);
+	m_filled.set_state(true);
+}
+
+const amr_decode_ahead::block * amr_decode_ahead::front(abort_callback & p_abort) {
+	const unsigned tail = m_tail.load(std::memory_order_relaxed);
+	for (;;) {
+		if (m_head.load(std::memory_order_acquire) != tail) return &m_blocks[tail % amr_ahead_blocks];
+		if (m_done.load(std::memory_order_acquire)) {
+			/* the last block may have come right before the end */
+			if (m_head.load(std::memory_order_acquire) != tail) continue;
+			if (m_error) std::rethrow_exception(m_error);
+			return NULL;
+		}
+		/* event is cleared first, so a block filled in between is not missed */
+		m_filled.set_state(false);
+		if (m_head.load(std::memory_order_acquire) != tail || m_done.load(std::memory_order_acquire)) continue;
+		p_abort.waitForEvent(m_filled, -1);
+	}
+}
+
+void amr_decode_ahead::pop() {
+	m_tail.store(m_tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+	m_space.set_state(true);
+}
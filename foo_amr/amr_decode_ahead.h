@@ -0,0 +1,104 @@
+/**
+ * foo_input_amr - reading and decoding ahead of playback on a worker thread
+*/
+#pragma once
+
+#include <atomic>
+#include <exception>
+#include "amr_decoder_pool.h"
+#include "amr_frame_reader.h"
+#include "amr_thread_pool.h"
+
+enum {
+	/* blocks of decoded audio the thread may get ahead by at most; a power of two, so ring counters can wrap */
+	amr_ahead_blocks = 8,
+};
+
+/**
+ * Reads and decodes frames on a worker of amr_thread_pool, a block of frames at a time, into a ring of
+ * up to amr_ahead_blocks blocks, as many as preferences say, so that playback thread only takes decoded
+ * audio and slow reads of files on network shares don't stall it. Ring is single producer, single
+ * consumer: each side moves only its own counter, and waits on an event only when the ring is full or empty.
+ *
+ * Blocks carry decoder snapshots taken after the checkpoint frames in them, since the decoder
+ * is not to be touched by the caller while decoding ahead, nor is the reader.
+ *
+ * @since   1.2.0
+ */
+class amr_decode_ahead {
+public:
+	/* decoded frames, as handed out by front() */
+	struct block {
+		pfc::array_t<audio_sample> m_samples;
+		/* number of frames, and their length in bytes */
+		unsigned m_frames;
+		t_size m_bytes;
+		/* snapshots of decoder after each checkpoint frame of the block, in order, and their number */
+		pfc::array_t<t_uint8> m_snapshot;
+		unsigned m_checkpoints;
+	};
+
+	amr_decode_ahead();
+	~amr_decode_ahead();
+
+	/* "read and decode ahead when playing" preference, always on under playback profile */
+	static bool is_enabled();
+
+	/**
+	 * Starts the thread.
+	 *
+	 * @param p_reader		reader positioned at the first frame to decode; not to be used by the caller until reset()
+	 * @param p_decoder		decoder in the state the first frame is to be decoded with; not to be used either
+	 * @param p_block_size	payload sizes indexed by frame type
+	 * @param p_frame		number of the first frame to decode
+	 * @param p_frames		number of frames to decode, from p_frame on
+	 * @param p_block_frames	maximum number of frames in a block
+	 * @param p_checkpoint	number of the next frame to take snapshot after, 0 for none
+	 * @param p_interval	frames between checkpoints after that one
+	 * @since				1.2.0
+	 */
+	void start(amr_frame_reader & p_reader, amr_decoder & p_decoder, const short * p_block_size, unsigned p_frame, unsigned p_frames,
+		unsigned p_block_frames, unsigned p_checkpoint, unsigned p_interval);
+
+	/**
+	 * Gets the oldest block decoded ahead, waiting for it if there's none yet.
+	 *
+	 * @param p_abort		abort callback
+	 * @return				the block, valid until pop(), or <code>NULL</code> if all frames were decoded,
+	 *						or the file ended before
+	 * @throws				whatever reading the file threw on the thread
+	 * @since				1.2.0
+	 */
+	const block * front(abort_callback & p_abort);
+
+	/* gives the block returned by front() back to the thread */
+	void pop();
+
+	/* stops the thread and drops what it decoded; reader and decoder are the caller's again, somewhere ahead, to be positioned anew */
+	void reset();
+
+	/* thread was started and not reset since */
+	bool is_active() const { return m_active; }
+
+private:
+	/* the thread: fills free blocks until frames run out */
+	void produce();
+
+	amr_frame_reader * m_reader;
+	amr_decoder * m_decoder;
+	const short * m_block_size;
+	unsigned m_frame, m_end, m_block_frames, m_checkpoint, m_interval;
+	/* blocks of the ring used, amr_ahead_blocks at most */
+	unsigned m_depth;
+	block m_blocks[amr_ahead_blocks];
+	/* blocks filled, moved only by the thread, and blocks given back, moved only by the caller */
+	std::atomic<unsigned> m_head, m_tail;
+	/* thread decoded everything it was to, or failed with m_error */
+	std::atomic<bool> m_done;
+	std::exception_ptr m_error;
+	/* set by the thread when it filled a block or ended, and by the caller when it gave one back */
+	pfc::event m_filled, m_space;
+	abort_callback_impl m_abort;
+	bool m_active;
+	amr_task m_task;
+};
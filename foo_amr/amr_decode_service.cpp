@@ -0,0 +1,137 @@
+/**
+ * foo_input_amr - AMR-NB decoding for other components
+*/
+#include "../foo_sdk/foobar2000/SDK/foobar2000.h"
+extern "C" {
+	#include "../3gpp/interf_dec.h"
+}
+#include "amr_decode_service.h"
+#include "amr_analytics.h"
+#include "amr_decoder_pool.h"
+
+enum {
+	/* rate of output of frames, for a range that is empty */
+	amr_range_sample_rate = 8000,
+};
+
+/* frames are 20ms long; seek goes to the start of one */
+static const double amr_range_frame_seconds = 0.02;
+
+static_assert(amr_frame_types == PFC_TABSIZE(((amr_file_summary *)0)->m_frame_types), "summary must have every frame type");
+
+/**
+ * Opens a file for decoding with input_amr, whatever other inputs take the path. Defined by the input.
+ *
+ * @param p_out			receives decoder of the file, not initialized yet
+ * @param p_path		path to file
+ * @param p_abort		abort callback
+ * @since				1.2.0
+ */
+void amr_open_decoder(service_ptr_t<input_decoder> & p_out, const char * p_path, abort_callback & p_abort);
+
+/* decoder taken from the pool for another component */
+class amr_frame_decoder_impl : public amr_frame_decoder {
+public:
+	amr_frame_decoder_impl(unsigned p_flags) : m_flags(p_flags) {
+		m_decoder.acquire((p_flags & amr_decode_service::flag_float_engine) != 0);
+	}
+
+	t_size decode(const void * p_frame, t_size p_size, audio_sample * p_out) {
+		const t_size length = frame_length(p_frame, p_size);
+		if (length > 0) Decoder_Interface_Decode_float(m_decoder.get(), (unsigned char *)p_frame, p_out, 0);
+		return length;
+	}
+
+	t_size decode_int16(const void * p_frame, t_size p_size, t_int16 * p_out) {
+		const t_size length = frame_length(p_frame, p_size);
+		if (length > 0) Decoder_Interface_Decode(m_decoder.get(), (unsigned char *)p_frame, p_out, 0);
+		return length;
+	}
+
+	void reset() { m_decoder.acquire((m_flags & amr_decode_service::flag_float_engine) != 0); }
+
+private:
+	/* bytes of the frame at p_frame, 0 if there are fewer of them */
+	static t_size frame_length(const void * p_frame, t_size p_size) {
+		if (p_frame == NULL || p_size == 0) return 0;
+		const t_size length = 1 + Decoder_Interface_block_size[(*(const t_uint8 *)p_frame >> 3) & 0x0F];
+		return length <= p_size ? length : 0;
+	}
+
+	const unsigned m_flags;
+	amr_decoder m_decoder;
+};
+
+/**
+ * The one instance of amr_decode_service, registered for other components to enumerate.
+ *
+ * @since   1.2.0
+ */
+class amr_decode_service_impl : public amr_decode_service {
+public:
+	amr_frame_decoder::ptr create_decoder(unsigned p_flags) {
+		return fb2k::service_new<amr_frame_decoder_impl>(p_flags);
+	}
+
+	input_decoder::ptr open(const char * p_path, abort_callback & p_abort) {
+		input_decoder::ptr decoder;
+		amr_open_decoder(decoder, p_path, p_abort);
+		return decoder;
+	}
+
+	void get_summary(const char * p_path, amr_file_summary & p_out, abort_callback & p_abort) {
+		amr_file_stats stats;
+		amr_find_stats(p_path, stats, p_abort);
+		p_out.m_channels = stats.m_channels;
+		p_out.m_frames = stats.m_frames;
+		for (unsigned i = 0; i < amr_frame_types; ++i) p_out.m_frame_types[i] = stats.m_histogram[i];
+		p_out.m_bitrate = stats.m_bitrate;
+		p_out.m_bad_frames = stats.m_bad;
+		p_out.m_speech_frames = stats.m_speech;
+		p_out.m_hash = stats.m_hash;
+	}
+
+	void decode_range(const char * p_path, t_uint32 p_subsong, double p_start, double p_end, audio_chunk & p_out, abort_callback & p_abort) {
+		if (!(p_start >= 0) || !(p_end >= p_start)) throw pfc::exception_invalid_params();
+		input_decoder::ptr decoder;
+		amr_open_decoder(decoder, p_path, p_abort);
+		decoder->initialize(p_subsong, 0, p_abort);
+		/* seek lands on the start of the frame; samples of it before the range are trimmed */
+		const double from = floor(p_start / amr_range_frame_seconds) * amr_range_frame_seconds;
+		decoder->seek(from, p_abort);
+
+		pfc::array_t<audio_sample> samples;
+		t_size count = 0;
+		unsigned rate = 0, channels = 0, config = 0;
+		/* position, start and end of the range, in samples of the rate output has, known from the first chunk */
+		t_uint64 position = 0, start = 0, end = 0;
+		audio_chunk_impl chunk;
+		while (decoder->run(chunk, p_abort)) {
+			if (rate == 0) {
+				rate = chunk.get_srate();
+				channels = chunk.get_channels();
+				config = chunk.get_channel_config();
+				position = audio_math::time_to_samples(from, rate);
+				start = audio_math::time_to_samples(p_start, rate);
+				end = audio_math::time_to_samples(p_end, rate);
+			}
+			const t_uint64 next = position + chunk.get_sample_count();
+			const t_uint64 first = pfc::max_t(position, start), last = pfc::min_t(next, end);
+			if (last > first) {
+				const t_size take = (t_size)(last - first);
+				samples.set_size(pfc::max_t<t_size>(samples.get_size(), (count + take) * channels));
+				memcpy(samples.get_ptr() + count * channels, chunk.get_data() + (t_size)(first - position) * channels, take * channels * sizeof(audio_sample));
+				count += take;
+			}
+			position = next;
+			if (position >= end) break;
+		}
+		if (rate == 0) {
+			p_out.set_data(NULL, 0, 1, amr_range_sample_rate);
+			return;
+		}
+		p_out.set_data(samples.get_ptr(), count, channels, rate, config);
+	}
+};
+
+static service_factory_single_t<amr_decode_service_impl> g_amr_decode_service_factory;
@@ -0,0 +1,130 @@
+/**
+ * foo_input_amr - AMR-NB decoding for other components
+ *
+ * Public interface: other components copy this header alone, include it after foobar2000.h, and get
+ * the service with amr_decode_service::tryGet(), which fails unless foo_input_amr is installed.
+*/
+#pragma once
+
+/* summary of a file from its frame index, see amr_decode_service::get_summary() */
+struct amr_file_summary {
+	t_uint32 m_channels;
+	/* 20ms frames, and channel frames of each frame type, 0 to 15 as in frame headers */
+	t_uint32 m_frames;
+	t_uint32 m_frame_types[16];
+	/* bits per second of frames, headers included */
+	t_uint32 m_bitrate;
+	/* channel frames marked damaged */
+	t_uint32 m_bad_frames;
+	/* 20ms frames outside pauses in speech */
+	t_uint32 m_speech_frames;
+	/* hash of the frames, same for files with the same frames, 0 if the index has none */
+	t_uint64 m_hash;
+};
+
+/**
+ * Decoder of one channel of storage format frames, 8 kHz, taken from the decoder pool of foo_input_amr
+ * and given back when the last reference goes away. Used by one thread at a time.
+ *
+ * @since   1.2.0
+ */
+class NOVTABLE amr_frame_decoder : public service_base {
+	FB2K_MAKE_SERVICE_INTERFACE(amr_frame_decoder, service_base);
+public:
+	enum {
+		/* samples of a frame */
+		frame_samples = 160,
+	};
+
+	/**
+	 * Decodes a frame, header byte first, to frame_samples samples.
+	 *
+	 * @param p_frame		the frame
+	 * @param p_size		bytes there are at p_frame, one frame or more
+	 * @param p_out			receives frame_samples samples, scaled to [-1, 1)
+	 * @return				bytes the frame took, or 0 if there isn't a whole frame, when nothing is decoded
+	 * @since				1.2.0
+	 */
+	virtual t_size decode(const void * p_frame, t_size p_size, audio_sample * p_out) = 0;
+
+	/* same, to 16-bit samples, bit-exact with the reference decoder unless the decoder was created with flag_float_engine */
+	virtual t_size decode_int16(const void * p_frame, t_size p_size, t_int16 * p_out) = 0;
+
+	/* brings decoder back to its initial state, as before the first frame of a stream */
+	virtual void reset() = 0;
+};
+
+/**
+ * Decoding engine of foo_input_amr, shared with other components: decoders come from its pool, with
+ * the kernels picked for this CPU, and files are opened with indexes from its cache, so components
+ * decoding the same files don't scan them again nor keep decoders of their own. Methods can be called
+ * from any thread once foobar has started.
+ *
+ * @since   1.2.0
+ */
+class NOVTABLE amr_decode_service : public service_base {
+	FB2K_MAKE_SERVICE_INTERFACE_ENTRYPOINT(amr_decode_service);
+public:
+	enum {
+		/* post filter in floating point, faster but not bit-exact */
+		flag_float_engine = 1 << 0,
+	};
+
+	/* gets the service, if foo_input_amr is installed */
+	static bool tryGet(ptr & p_out) { return service_enum_t<amr_decode_service>().first(p_out); }
+
+	/**
+	 * Takes a decoder from the pool.
+	 *
+	 * @param p_flags		flag_* values
+	 * @return				the decoder, in its initial state
+	 * @throws				std::bad_alloc if a decoder can't be created
+	 * @since				1.2.0
+	 */
+	virtual amr_frame_decoder::ptr create_decoder(unsigned p_flags) = 0;
+
+	/**
+	 * Opens a file for decoding, as playback does, with its index from the cache, or scanned and cached.
+	 * Tracks of a file split at pauses are its subsongs; decoder is initialized with one of them.
+	 *
+	 * @param p_path		path to file
+	 * @param p_abort		abort callback
+	 * @return				decoder of the file
+	 * @throws				exception_io if the file can't be read, or is not AMR-NB
+	 * @since				1.2.0
+	 */
+	virtual input_decoder::ptr open(const char * p_path, abort_callback & p_abort) = 0;
+
+	/**
+	 * Gets summary of a file from its index, without decoding it.
+	 *
+	 * @param p_path		path to file
+	 * @param p_out			receives the summary
+	 * @param p_abort		abort callback
+	 * @throws				exception_io if the file can't be read, is not AMR-NB, or can't be indexed
+	 * @since				1.2.0
+	 */
+	virtual void get_summary(const char * p_path, amr_file_summary & p_out, abort_callback & p_abort) = 0;
+
+	/**
+	 * Decodes part of a track, as a transcription tool asks for snippets of a file by time. File is opened
+	 * as by open(), on a decoder of the call's own, so ranges of one file can be decoded on several threads
+	 * at once; it seeks to the frame the range starts in with the index and the nearest checkpoint, and
+	 * output is trimmed to the sample.
+	 *
+	 * @param p_path		path to file
+	 * @param p_subsong		track of the file, 0 unless it's split at pauses
+	 * @param p_start		start of the range, in seconds from the start of the track
+	 * @param p_end			end of the range, in seconds; range ends with the track, if that's sooner
+	 * @param p_out			receives audio of the range, in one chunk
+	 * @param p_abort		abort callback
+	 * @throws				exception_io if the file can't be read, or is not AMR-NB
+	 * @since				1.2.0
+	 */
+	virtual void decode_range(const char * p_path, t_uint32 p_subsong, double p_start, double p_end, audio_chunk & p_out, abort_callback & p_abort) = 0;
+};
+
+// {3A9E5C21-7D46-4B8F-9E12-C58A0F6B4D73}
+FOOGUIDDECL const GUID amr_decode_service::class_guid = { 0x3a9e5c21, 0x7d46, 0x4b8f,{ 0x9e, 0x12, 0xc5, 0x8a, 0x0f, 0x6b, 0x4d, 0x73 } };
+// {B5170E8D-2F3C-4A69-8D5E-7143A92C06F1}
+FOOGUIDDECL const GUID amr_frame_decoder::class_guid = { 0xb5170e8d, 0x2f3c, 0x4a69,{ 0x8d, 0x5e, 0x71, 0x43, 0xa9, 0x2c, 0x06, 0xf1 } };
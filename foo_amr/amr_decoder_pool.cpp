@@ -0,0 +1,171 @@
+/**
+ * foo_input_amr - ownership and reuse of 3gpp decoder instances
+*/
+#include "../foo_sdk/foobar2000/SDK/foobar2000.h"
+#include <atomic>
+extern "C" {
+	#include "../3gpp/interf_dec.h"
+}
+#include "amr_decoder_pool.h"
+#include "amr_tuning.h"
+
+/* see amr_decoder_pool::get_live() */
+static std::atomic<long> g_live_decoders(0);
+
+/* creates a decoder, counted as live */
+static void * amr_decoder_create() {
+	void * state = Decoder_Interface_init();
+	if (state == NULL) throw std::bad_alloc();
+	++g_live_decoders;
+	return state;
+}
+
+/* frees a decoder created by amr_decoder_create() */
+static void amr_decoder_free(void * p_state) {
+	Decoder_Interface_exit(p_state);
+	--g_live_decoders;
+}
+
+long amr_decoder_pool::get_live() {
+	return g_live_decoders.load();
+}
+
+amr_decoder_pool & amr_decoder_pool::get() {
+	static amr_decoder_pool instance;
+	return instance;
+}
+
+/* idle decoders kept by a thread, see amr_decoder_pool_thread_idle */
+struct amr_decoder_thread_stock {
+	amr_decoder_thread_stock() : m_count(0) {}
+	~amr_decoder_thread_stock() { for (t_size i = 0; i < m_count; ++i) amr_decoder_free(m_idle[i]); }
+
+	void * m_idle[amr_decoder_pool_thread_idle];
+	t_size m_count;
+};
+
+static thread_local amr_decoder_thread_stock g_thread_stock;
+
+void * amr_decoder_pool::take() {
+	if (g_thread_stock.m_count > 0) return g_thread_stock.m_idle[--g_thread_stock.m_count];
+	{
+		insync(m_lock);
+		const t_size count = m_idle.get_size();
+		if (count > 0) {
+			void * state = m_idle[count - 1];
+			m_idle.set_size(count - 1);
+			return state;
+		}
+	}
+	return amr_decoder_create();
+}
+
+void amr_decoder_pool::give_back(void * p_state) {
+	/* idle decoders are kept reset, so take() can hand them out right away */
+	Decoder_Interface_reset(p_state);
+	if (g_thread_stock.m_count < amr_decoder_pool_thread_idle) {
+		g_thread_stock.m_idle[g_thread_stock.m_count++] = p_state;
+		return;
+	}
+	{
+		insync(m_lock);
+		if (m_idle.get_size() < amr_tuned<t_size>(amr_decoder_pool_max_idle, amr_decoder_pool_max_idle, amr_decoder_pool_max_idle, amr_decoder_pool_low_memory_idle)) {
+			m_idle.append_single(p_state);
+			return;
+		}
+	}
+	amr_decoder_free(p_state);
+}
+
+void amr_decoder_pool::reserve(t_size p_count) {
+	insync(m_lock);
+	while (m_idle.get_size() < p_count) {
+		m_idle.append_single(amr_decoder_create());
+	}
+}
+
+void amr_decoder_pool::clear() {
+	insync(m_lock);
+	for (t_size i = 0; i < m_idle.get_size(); ++i) amr_decoder_free(m_idle[i]);
+	m_idle.set_size(0);
+}
+
+t_size amr_decoder_pool::get_memory() {
+	insync(m_lock);
+	return m_idle.get_size() * (t_size)Decoder_Interface_mem_size();
+}
+
+t_size amr_decoder_pool::trim(t_size p_bytes) {
+	const t_size size = (t_size)Decoder_Interface_mem_size();
+	insync(m_lock);
+	t_size count = m_idle.get_size(), freed = 0;
+	while (count > 0 && freed < p_bytes) {
+		amr_decoder_free(m_idle[--count]);
+		freed += size;
+	}
+	m_idle.set_size(count);
+	return freed;
+}
+
+/* homing frames come from codec test vectors, files practically never have them, so checking can be turned off */
+static advconfig_checkbox_factory g_amr_homing("AMR decoder: detect decoder homing frames",
+	{ 0x2c94e7a1, 0x5d03, 0x4b8f,{ 0x96, 0x1e, 0x3a, 0x7f, 0xc5, 0x08, 0xd2, 0x4b } },
+	advconfig_branch::guid_branch_decoding, 4, true);
+
+void amr_decoder::acquire(bool p_float_engine, float p_gain) {
+	if (m_state != NULL) Decoder_Interface_reset(m_state);
+	else m_state = amr_decoder_pool::get().take();
+	Decoder_Interface_set_homing(m_state, g_amr_homing.get());
+	/* pooled decoders keep the engine and gain of their last owner */
+	Decoder_Interface_set_engine(m_state, p_float_engine ? DEC_ENGINE_FLOAT : DEC_ENGINE_FIXED);
+	Decoder_Interface_set_gain(m_state, p_gain);
+}
+
+void amr_decoder::release() {
+	if (m_state == NULL) return;
+	amr_decoder_pool::get().give_back(m_state);
+	m_state = NULL;
+}
+
+/* debugging aid: run the plain C decoder kernels even if the CPU could run faster ones */
+static advconfig_checkbox_factory g_amr_scalar_kernels("AMR decoder: use plain C kernels (restart required)",
+	{ 0xafb770d7, 0x6454, 0x4751,{ 0x80, 0x71, 0x8a, 0x7c, 0xd2, 0x52, 0x01, 0xb7 } },
+	advconfig_branch::guid_branch_decoding, 0, false);
+
+bool amr_get_scalar_kernels() { return g_amr_scalar_kernels.get(); }
+void amr_set_scalar_kernels(bool p_scalar) { g_amr_scalar_kernels.set(p_scalar); }
+
+/* feature flags for Decoder_Interface_select_kernels, as detected on this CPU */
+static int amr_cpu_features() {
+	if (g_amr_scalar_kernels.get()) return 0;
+#if PFC_HAVE_CPUID
+	if (pfc::query_cpu_feature_set(pfc::CPU_HAVE_SSE2)) return DEC_CPU_SSE2;
+	return 0;
+#elif defined(__SSE2__) || defined(_M_X64)
+	return DEC_CPU_SSE2;
+#elif defined(__aarch64__) || defined(_M_ARM64)
+	return DEC_CPU_NEON;
+#else
+	return 0;
+#endif
+}
+
+/**
+ * Picks decoder kernels for this CPU and creates a few decoders when foobar starts, so first
+ * playback does not have to, and frees the idle ones on shutdown.
+ */
+class amr_decoder_pool_initquit : public initquit {
+public:
+	void on_init() {
+		/* has to happen before any decoder exists */
+		Decoder_Interface_select_kernels(amr_cpu_features());
+		try {
+			amr_decoder_pool::get().reserve(amr_decoder_pool_reserve);
+		} catch (std::exception const &) {}
+	}
+	void on_quit() {
+		amr_decoder_pool::get().clear();
+	}
+};
+
+static initquit_factory_t<amr_decoder_pool_initquit> g_amr_decoder_pool_initquit;
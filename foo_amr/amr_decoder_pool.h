@@ -0,0 +1,107 @@
+/**
+ * foo_input_amr - ownership and reuse of 3gpp decoder instances
+*/
+#pragma once
+
+enum {
+	/* decoders created up front, when foobar starts */
+	amr_decoder_pool_reserve = 2,
+	/* released decoders kept for reuse; any beyond that are freed */
+	amr_decoder_pool_max_idle = 8,
+	/* or this many under low memory profile */
+	amr_decoder_pool_low_memory_idle = 2,
+	/* of those, kept by the thread that released them, for inputs it opens next */
+	amr_decoder_pool_thread_idle = 2,
+};
+
+/**
+ * Shared stock of idle 3gpp decoder instances. Creating a decoder allocates its whole state, so
+ * instead of that, released decoders are kept here and handed out again after a reset. All methods
+ * are thread-safe.
+ *
+ * First few decoders a thread releases stay with that thread, and it takes them back first, without
+ * locking; threads opening one short file after another, as batch processing of clips does, then
+ * reuse the same decoders, warm in their cache. They're freed when the thread ends.
+ *
+ * @since   1.2.0
+ */
+class amr_decoder_pool {
+public:
+	/* the one instance shared by all inputs */
+	static amr_decoder_pool & get();
+
+	/**
+	 * Hands out a decoder in its initial state, reused one if there is any.
+	 *
+	 * @return				decoder state, as returned by <code>Decoder_Interface_init</code>
+	 * @throws				std::bad_alloc if a new decoder can't be created
+	 * @since				1.2.0
+	 */
+	void * take();
+
+	/**
+	 * Gives decoder back for reuse, or frees it if there are enough idle ones already.
+	 *
+	 * @param p_state		decoder obtained from take()
+	 * @since				1.2.0
+	 */
+	void give_back(void * p_state);
+
+	/* makes sure at least p_count idle decoders are ready */
+	void reserve(t_size p_count);
+
+	/* frees all idle decoders */
+	void clear();
+
+	/* memory of idle decoders kept here, for amr_memory_budget; the few each thread keeps are not counted */
+	t_size get_memory();
+
+	/* frees idle decoders until p_bytes of them are freed or there are none left; returns bytes freed */
+	t_size trim(t_size p_bytes);
+
+	/* decoders created and not freed yet, idle ones included, for telling whether any leak */
+	static long get_live();
+
+private:
+	amr_decoder_pool() {}
+	~amr_decoder_pool() { clear(); }
+
+	critical_section m_lock;
+	pfc::array_t<void*> m_idle;
+};
+
+/**
+ * Owns one decoder taken from amr_decoder_pool and gives it back when destroyed, so decoder
+ * state is never leaked, whichever way the input goes away.
+ *
+ * @since   1.2.0
+ */
+class amr_decoder {
+public:
+	amr_decoder() : m_state(NULL) {}
+	~amr_decoder() { release(); }
+
+	/**
+	 * Gets decoder ready to decode from the first frame; existing one is reset rather than replaced.
+	 *
+	 * @param p_float_engine	post filter in floating point, faster but not bit-exact, rather than in fixed point
+	 * @param p_gain		linear gain of floating point output, see <code>Decoder_Interface_set_gain</code>
+	 * @since				1.2.0
+	 */
+	void acquire(bool p_float_engine = false, float p_gain = 1.0f);
+
+	/* returns decoder to the pool, if there is one */
+	void release();
+
+	/* decoder state to pass to Decoder_Interface_* functions */
+	void * get() const { return m_state; }
+
+	/* exchanges decoders with another owner, states and all */
+	void swap(amr_decoder & p_other) { pfc::swap_t(m_state, p_other.m_state); }
+
+private:
+	amr_decoder(const amr_decoder &);
+	void operator=(const amr_decoder &);
+
+	void * m_state;
+};
@@ -0,0 +1,194 @@
+/**
+ * foo_input_amr - cutting and joining AMR files at frame boundaries, without decoding
+*/
+#include "../foo_sdk/foobar2000/SDK/foobar2000.h"
+#include <memory>
+#include "amr_edit.h"
+
+/**
+ * Path of a new file next to p_path, its name with p_suffix added, and a number if that's taken.
+ *
+ * @param p_path		path to file next to which the new one goes
+ * @param p_suffix		what's added to its name
+ * @param p_abort		abort callback
+ * @return				path of a file that does not exist
+ * @since				1.2.0
+ */
+static pfc::string8 amr_edit_path(const char * p_path, const char * p_suffix, abort_callback & p_abort) {
+	pfc::string8 base = p_path;
+	base.truncate(base.length() - pfc::string_extension(p_path).length() - 1);
+	for (unsigned i = 1;; ++i) {
+		pfc::string_formatter path;
+		path << base << " (" << p_suffix;
+		if (i > 1) path << " " << i;
+		path << ").amr";
+		if (!filesystem::g_exists(path, p_abort)) return path;
+	}
+}
+
+/**
+ * Writes frames of the tracks, one after another, to a new file with the header they share. Bytes are
+ * copied as they are, a block at a time.
+ *
+ * @param p_path		path of the new file
+ * @param p_ranges		where frames of each track lie, see amr_find_frames()
+ * @param p_paths		file of each track
+ * @param p_abort		abort callback
+ * @throws				exception_io_data if tracks have different headers, that is channel counts; whatever writing throws
+ * @since				1.2.0
+ */
+static void amr_edit_write(const char * p_path, const pfc::list_t<amr_frame_range> & p_ranges, const pfc::list_t<pfc::string8> & p_paths, abort_callback & p_abort) {
+	const amr_frame_range & first = p_ranges[0];
+	for (t_size i = 1; i < p_ranges.get_count(); ++i) {
+		const amr_frame_range & range = p_ranges[i];
+		if (range.m_header.get_size() != first.m_header.get_size() || memcmp(range.m_header.get_ptr(), first.m_header.get_ptr(), first.m_header.get_size()) != 0) {
+			throw exception_io_data(pfc::string_formatter() << p_paths[i] << " has another number of channels than " << p_paths[0]);
+		}
+	}
+	service_ptr_t<file> out;
+	filesystem::g_open_write_new(out, p_path, p_abort);
+	try {
+		out->write(first.m_header.get_ptr(), first.m_header.get_size(), p_abort);
+		for (t_size i = 0; i < p_ranges.get_count(); ++i) {
+			service_ptr_t<file> in;
+			filesystem::g_open_read(in, p_paths[i], p_abort);
+			in->seek(p_ranges[i].m_begin, p_abort);
+			file::g_transfer_object(in, out, p_ranges[i].m_end - p_ranges[i].m_begin, p_abort);
+		}
+	} catch (...) {
+		/* half written file is no use to anyone */
+		out.release();
+		try {
+			abort_callback_dummy abort;
+			filesystem::g_remove(p_path, abort);
+		} catch (exception_io const &) {}
+		throw;
+	}
+}
+
+/* a selected track: file and subsong */
+struct amr_edit_item {
+	pfc::string8 m_path;
+	t_uint32 m_subsong;
+};
+
+/**
+ * Saves each selected track of a file split at pauses to a file of its own, next to it.
+ *
+ * @return				report, a line per track
+ * @since				1.2.0
+ */
+static pfc::string8 amr_edit_cut(const pfc::list_t<amr_edit_item> & p_items, threaded_process_status & p_status, abort_callback & p_abort) {
+	pfc::string_formatter report;
+	for (t_size i = 0; i < p_items.get_count(); ++i) {
+		p_status.set_progress(i, p_items.get_count());
+		const amr_edit_item & item = p_items[i];
+		try {
+			pfc::list_t<amr_frame_range> ranges;
+			pfc::list_t<pfc::string8> paths;
+			ranges.add_item(amr_frame_range());
+			amr_find_frames(item.m_path, item.m_subsong, ranges[0], p_abort);
+			if (ranges[0].m_tracks < 2) {
+				report << item.m_path << ": not split into tracks, nothing to cut\n";
+				continue;
+			}
+			paths.add_item(item.m_path);
+			const pfc::string8 path = amr_edit_path(item.m_path, pfc::string_formatter() << "track " << (item.m_subsong + 1), p_abort);
+			amr_edit_write(path, ranges, paths, p_abort);
+			report << path << ": " << ranges[0].m_frames << " frames\n";
+		} catch (exception_aborted const &) {
+			throw;
+		} catch (std::exception const & e) {
+			report << item.m_path << ": " << e.what() << "\n";
+		}
+	}
+	return report;
+}
+
+/**
+ * Joins the selected tracks, in order, into a new file next to the first one.
+ *
+ * @return				report
+ * @since				1.2.0
+ */
+static pfc::string8 amr_edit_join(const pfc::list_t<amr_edit_item> & p_items, threaded_process_status & p_status, abort_callback & p_abort) {
+	pfc::list_t<amr_frame_range> ranges;
+	pfc::list_t<pfc::string8> paths;
+	unsigned frames = 0;
+	for (t_size i = 0; i < p_items.get_count(); ++i) {
+		p_status.set_progress(i, p_items.get_count());
+		const amr_edit_item & item = p_items[i];
+		amr_frame_range range;
+		try {
+			amr_find_frames(item.m_path, item.m_subsong, range, p_abort);
+		} catch (exception_aborted const &) {
+			throw;
+		} catch (std::exception const & e) {
+			return pfc::string_formatter() << item.m_path << ": " << e.what() << ", nothing joined\n";
+		}
+		ranges.add_item(range);
+		paths.add_item(item.m_path);
+		frames += range.m_frames;
+	}
+	const pfc::string8 path = amr_edit_path(p_items[0].m_path, "joined", p_abort);
+	try {
+		amr_edit_write(path, ranges, paths, p_abort);
+	} catch (exception_aborted const &) {
+		throw;
+	} catch (std::exception const & e) {
+		return pfc::string_formatter() << path << ": " << e.what() << "\n";
+	}
+	return pfc::string_formatter() << path << ": " << p_items.get_count() << " tracks, " << frames << " frames\n";
+}
+
+/**
+ * "Cut AMR tracks to files" and "Join AMR tracks" items in the Utilities context menu. AMR frames
+ * are copied as they are, found with the index of each file, see amr_find_frames(), so no frame is
+ * decoded and none is encoded again; cutting and joining take as long as copying the bytes. Tracks
+ * are those files are split into at pauses, or whole files. Report goes to the console.
+ *
+ * @since   1.2.0
+ */
+class amr_edit_item_menu : public contextmenu_item_simple {
+public:
+	enum { cmd_cut, cmd_join, cmd_count };
+
+	GUID get_parent() { return contextmenu_groups::utilities; }
+	unsigned get_num_items() { return cmd_count; }
+	void get_item_name(unsigned p_index, pfc::string_base & p_out) { p_out = p_index == cmd_cut ? "Cut AMR tracks to files" : "Join AMR tracks"; }
+	bool get_item_description(unsigned p_index, pfc::string_base & p_out) {
+		if (p_index == cmd_cut) p_out = "Saves each selected track of an AMR file split at pauses to a file of its own, without decoding.";
+		else p_out = "Joins the selected AMR tracks, in order, into a new file next to the first one, without decoding.";
+		return true;
+	}
+	GUID get_item_guid(unsigned p_index) {
+		static const GUID guid_cut = { 0x6c1e93b5, 0x24a8, 0x4d07,{ 0x8b, 0x5f, 0xe2, 0x39, 0x70, 0xc4, 0x1d, 0xa6 } };
+		static const GUID guid_join = { 0xd0475a2e, 0x9f63, 0x4b1c,{ 0xa7, 0x08, 0x5d, 0xb1, 0x2e, 0x96, 0xc3, 0x74 } };
+		return p_index == cmd_cut ? guid_cut : guid_join;
+	}
+	void context_command(unsigned p_index, metadb_handle_list_cref p_data, const GUID & p_caller) {
+		pfc::list_t<amr_edit_item> items;
+		for (t_size i = 0; i < p_data.get_count(); ++i) {
+			amr_edit_item item;
+			item.m_path = p_data[i]->get_path();
+			item.m_subsong = p_data[i]->get_subsong_index();
+			if (stricmp_utf8(pfc::string_extension(item.m_path), "amr") != 0) continue;
+			items.add_item(item);
+		}
+		if (items.get_count() == 0 || (p_index == cmd_join && items.get_count() < 2)) return;
+		const bool cut = p_index == cmd_cut;
+		std::shared_ptr<pfc::string8> report = std::make_shared<pfc::string8>();
+		threaded_process::g_run_modeless(threaded_process_callback_lambda::create(nullptr,
+			[items, cut, report](threaded_process_status & p_status, abort_callback & p_abort) {
+				*report = cut ? amr_edit_cut(items, p_status, p_abort) : amr_edit_join(items, p_status, p_abort);
+			},
+			[report](HWND p_wnd, bool p_was_aborted) {
+				if (p_was_aborted) return;
+				console::formatter() << "AMR editing: " << *report;
+			}),
+			threaded_process::flag_show_progress | threaded_process::flag_show_abort,
+			core_api::get_main_window(), cut ? "Cutting AMR tracks" : "Joining AMR tracks");
+	}
+};
+
+static contextmenu_item_factory_t<amr_edit_item_menu> g_amr_edit_item_menu;
@@ -0,0 +1,34 @@
+/**
+ * foo_input_amr - cutting and joining AMR files at frame boundaries, without decoding
+*/
+#pragma once
+
+/**
+ * Where frames of one track lie in its file: AMR storage format is a header followed by frames, so
+ * header and any run of whole frames make a file of their own, and runs of files with the same header
+ * put one after another make one file.
+ *
+ * @since   1.2.0
+ */
+struct amr_frame_range {
+	/* magic string, with channel count of multichannel files */
+	pfc::array_t<t_uint8> m_header;
+	/* file offsets of the first frame of the track and right after its last whole frame */
+	t_filesize m_begin, m_end;
+	/* 20ms frames of the track, and tracks the file is split into, see input_amr::split_tracks() */
+	unsigned m_frames;
+	unsigned m_tracks;
+};
+
+/**
+ * Finds frames of a track with the index of its file, as opening it would; file with no index cached
+ * is scanned. Only the frames around the ends of the track are walked. Defined by the input.
+ *
+ * @param p_path		path to file
+ * @param p_subsong		track of the file
+ * @param p_out			receives where the track lies
+ * @param p_abort		abort callback
+ * @throws				exception_io if the file can't be read, is not AMR-NB, or can't be indexed, as remote files can't
+ * @since				1.2.0
+ */
+void amr_find_frames(const char * p_path, t_uint32 p_subsong, amr_frame_range & p_out, abort_callback & p_abort);
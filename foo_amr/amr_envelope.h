@@ -0,0 +1,95 @@
+/**
+ * foo_input_amr - peak and RMS summary of decoded audio, for waveform seekbars
+*/
+#pragma once
+
+#include <math.h>
+
+enum {
+	/* summary has one entry per 5 frames, 100ms */
+	amr_envelope_frames = 5,
+	amr_envelope_frame_samples = 160,
+};
+
+/**
+ * Type of extended_param() query of the decoder for the summary, so waveform seekbar needs not decode
+ * the file once more: arg1 is the first entry wanted, arg2 buffer for entries, arg2size its size in bytes.
+ * Each entry is two t_uint16 values, peak and RMS of 100ms of audio of all channels, 65535 being full scale.
+ * Returns number of entries copied, or number of entries there are if arg2 is <code>NULL</code>; 0 if the
+ * file was not decoded from start to end yet.
+ *
+ * @since   1.2.0
+ */
+// {4A7C1E93-2D58-4B06-9F3A-C81E6D05B27F}
+static const GUID guid_amr_envelope = { 0x4a7c1e93, 0x2d58, 0x4b06,{ 0x9f, 0x3a, 0xc8, 0x1e, 0x6d, 0x05, 0xb2, 0x7f } };
+
+/**
+ * Builds the summary from audio decoded from the first frame on, chunk after chunk.
+ *
+ * @since   1.2.0
+ */
+class amr_envelope {
+public:
+	amr_envelope() { reset(); }
+
+	/* start over, with no entries */
+	void reset() {
+		m_entries.set_size(0);
+		m_count = 0;
+		m_peak = 0;
+		m_sum = 0;
+		m_samples = 0;
+	}
+
+	/**
+	 * Adds audio following what was added before.
+	 *
+	 * @param p_samples		interleaved samples
+	 * @param p_frames		number of frames they're of
+	 * @param p_channels	number of channels
+	 * @since				1.2.0
+	 */
+	void add(const audio_sample * p_samples, unsigned p_frames, unsigned p_channels) {
+		const t_size total = (t_size)p_frames * amr_envelope_frame_samples * p_channels;
+		const t_size entry = (t_size)amr_envelope_frames * amr_envelope_frame_samples * p_channels;
+		for (t_size i = 0; i < total; ++i) {
+			const audio_sample sample = p_samples[i];
+			const audio_sample magnitude = sample < 0 ? -sample : sample;
+			if (magnitude > m_peak) m_peak = magnitude;
+			m_sum += (double)sample * sample;
+			if (++m_samples == entry) append();
+		}
+	}
+
+	/* adds entry of the audio added since the last one, if there was any; there is no more to come */
+	void finish() {
+		if (m_samples > 0) append();
+		m_entries.set_size(m_count * 2);
+	}
+
+	/* entries, two values each, once finish() was called */
+	const pfc::array_t<t_uint16> & get() const { return m_entries; }
+
+private:
+	void append() {
+		/* grow by doubling, entries come one at a time */
+		if (m_entries.get_size() < m_count * 2 + 2) m_entries.set_size(pfc::max_t<t_size>(m_entries.get_size() * 2, 1024));
+		m_entries[m_count * 2] = scale(m_peak);
+		m_entries[m_count * 2 + 1] = scale((audio_sample)sqrt(m_sum / m_samples));
+		++m_count;
+		m_peak = 0;
+		m_sum = 0;
+		m_samples = 0;
+	}
+
+	static t_uint16 scale(audio_sample p_value) {
+		return p_value >= 1 ? 0xFFFF : (t_uint16)(p_value * 0xFFFF + 0.5f);
+	}
+
+	pfc::array_t<t_uint16> m_entries;
+	t_size m_count;
+	/* entry being added */
+	audio_sample m_peak;
+	double m_sum;
+	t_size m_samples;
+};
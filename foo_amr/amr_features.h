@@ -0,0 +1,18 @@
+/**
+ * foo_input_amr - speech parameters of decoded frames, for analysis without analysing the audio again
+*/
+#pragma once
+
+/**
+ * Type of extended_param() query of the decoder for parameters the frames of the last chunk were
+ * synthesized from, so speech recognition front ends can take LSPs, pitch and gains from the decoder
+ * rather than estimate them from the audio: arg1 is the first frame of the chunk wanted, arg2 buffer for
+ * frames, arg2size its size in bytes. Each frame is a struct Dec_features, see 3gpp/interf_dec.h; of
+ * multichannel files, that of the first channel. Returns number of frames copied, or number of frames
+ * the last chunk has parameters of if arg2 is <code>NULL</code>. Frames are decoded one at a time to
+ * get them, so that's turned on by the first query, and the chunk after it is the first one with them.
+ *
+ * @since   1.2.0
+ */
+// {6E2B9F41-83C7-4D5A-B019-27F4C8A35E6D}
+static const GUID guid_amr_features = { 0x6e2b9f41, 0x83c7, 0x4d5a,{ 0xb0, 0x19, 0x27, 0xf4, 0xc8, 0xa3, 0x5e, 0x6d } };
@@ -0,0 +1,514 @@
+/**
+ * foo_input_amr - buffered reader of AMR frames
+*/
+#pragma once
+
+#include <exception>
+#include "amr_io_throttle.h"
+#include "amr_counters.h"
+/* where compiler may use SSE2 anyway, damaged data is searched 16 bytes at a time */
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define AMR_READER_SSE2
+#endif
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+enum {
+	/* size of blocks read at once by amr_frame_reader */
+	amr_read_block_size = 64 * 1024,
+	/* local files up to this size are loaded into memory as a whole; that's hours of audio */
+	amr_max_loaded_size = 32 * 1024 * 1024,
+	/* room before block read ahead for unread bytes of the previous one; more than a frame of each of 6 channels */
+	amr_read_ahead_slack = 256,
+	/* frames with valid headers in a row that mark a found frame boundary in damaged data */
+	amr_resync_frames = 8,
+	/* bytes such frames may take */
+	amr_resync_span = amr_resync_frames * 32,
+};
+
+/**
+ * Reads file in big blocks and hands out whole frames from memory, so decoding does not need
+ * an I/O call per 20ms frame. Frame split by block boundary is moved to the front of the buffer
+ * before the rest of the block is read.
+ *
+ * Small local files can instead be loaded as a whole with load(); after that the reader,
+ * seeking included, works purely on memory and never touches the file again.
+ *
+ * Otherwise the next block can be read on another thread while frames of the current one are
+ * decoded, see set_read_ahead(), so reading and decoding overlap. File is then not to be used by
+ * anything else without wait() first.
+ *
+ * Frame with damaged header can be skipped along with whatever follows it, up to where frames start
+ * again, see set_resync(), so damaged file does not lose sync for good.
+ *
+ * File header is read through the reader too, see read(), so the block read with it has the first frames,
+ * and reading can go back to them, see seek_buffered(), without another request to a remote file.
+ *
+ * File can be made to end early for the reader, where tags at its end start, see set_end(); nothing
+ * past that is read, nor loaded.
+ *
+ * Blocks read for playback have their latency taken by amr_io_throttle; blocks read for indexing ahead
+ * of need, on a background thread or by a reader set so, see set_background(), are not, and the ones
+ * read on a background thread wait while playback reads are slow.
+ *
+ * @since   1.2.0
+ */
+class amr_frame_reader {
+public:
+	amr_frame_reader() : m_base(0), m_pos(0), m_size(0), m_skipped(0), m_end(filesize_invalid), m_loaded(false), m_read_ahead(false), m_resync(false), m_background(false), m_pending(false), m_next_size(0) {}
+	/* thread must not outlive the buffer it reads into */
+	~amr_frame_reader() { drop(); }
+
+	/* read frames from given file from now on, dropping whatever was buffered or loaded */
+	void attach(const service_ptr_t<file> & p_file) {
+		drop();
+		m_file = p_file;
+		m_data.set_size(0);
+		m_base = 0;
+		m_pos = m_size = 0;
+		m_skipped = 0;
+		m_end = filesize_invalid;
+		m_loaded = false;
+	}
+
+	/* file ends at given offset for the reader, as where tags at its end start; filesize_invalid for its real end, as after attach() */
+	void set_end(t_filesize p_end) {
+		m_end = p_end;
+		if (!m_loaded) return;
+		m_size = (t_size)pfc::min_t<t_filesize>(m_data.get_size(), m_end);
+		m_pos = pfc::min_t(m_pos, m_size);
+	}
+
+	/**
+	 * Loads the attached file into memory, unless it's remote or too big.
+	 *
+	 * @param p_abort		abort callback
+	 * @return				<code>true</code> if the whole file is in memory
+	 * @since				1.2.0
+	 */
+	bool load(abort_callback & p_abort) {
+		if (m_loaded) return true;
+		drop();
+		if (m_file->is_remote()) return false;
+		const t_filesize size = m_file->get_size(p_abort);
+		if (size == filesize_invalid || size > amr_max_loaded_size) return false;
+		m_data.set_size((t_size)size);
+		m_file->seek(0, p_abort);
+		m_file->read_object(m_data.get_ptr(), (t_size)size, p_abort);
+		m_pos = 0;
+		m_size = (t_size)pfc::min_t<t_filesize>(size, m_end);
+		m_loaded = true;
+		return true;
+	}
+
+	/* whole file was loaded by load() */
+	bool is_loaded() const { return m_loaded; }
+	/* unread bytes buffered; once next() or next_frames() returned NULL, what's left of the frame cut off by end of file */
+	t_size get_left() const { return m_size - m_pos; }
+	/* contents of loaded file; meaningful only if is_loaded() */
+	const t_uint8 * get_data() const { return m_data.get_ptr(); }
+	t_size get_size() const { return m_size; }
+
+	/* continue reading at given file offset */
+	void seek(t_filesize p_offset, abort_callback & p_abort) {
+		if (m_loaded) {
+			m_pos = p_offset < m_size ? (t_size)p_offset : m_size;
+			return;
+		}
+		drop();
+		m_file->seek(p_offset, p_abort);
+		m_base = p_offset;
+		m_pos = m_size = 0;
+	}
+
+	/**
+	 * Continues reading at given file offset, if it's within the block buffered, without touching the
+	 * file. Block read ahead on another thread is left alone, so it's only done without read ahead.
+	 * File is to be where the reader left it, that is not read or seeked by anything else since.
+	 *
+	 * @param p_offset		file offset
+	 * @return				<code>false</code> if the offset is not buffered; reader is as it was then
+	 * @since				1.2.0
+	 */
+	bool seek_buffered(t_filesize p_offset) {
+		if (m_loaded) {
+			m_pos = p_offset < m_size ? (t_size)p_offset : m_size;
+			return true;
+		}
+		if (m_read_ahead || m_pending || p_offset < m_base || p_offset > m_base + m_size) return false;
+		m_pos = (t_size)(p_offset - m_base);
+		return true;
+	}
+
+	/**
+	 * Copies next bytes as they are, for headers ahead of frames; first call after attach() or seek()
+	 * reads a whole block, which the frames after are then taken from.
+	 *
+	 * @param p_out			receives the bytes
+	 * @param p_bytes		number of bytes wanted
+	 * @param p_abort		abort callback
+	 * @return				number of bytes copied, fewer only if file ends first
+	 * @since				1.2.0
+	 */
+	t_size read(void * p_out, t_size p_bytes, abort_callback & p_abort) {
+		ensure(p_bytes, p_abort);
+		const t_size bytes = pfc::min_t(p_bytes, m_size - m_pos);
+		memcpy(p_out, m_data.get_ptr() + m_pos, bytes);
+		m_pos += bytes;
+		return bytes;
+	}
+
+	/* unread bytes buffered, for walking frames in them without taking them one by one; valid until next call */
+	const t_uint8 * get_buffered(t_size & p_size) const {
+		p_size = m_size - m_pos;
+		return m_data.get_ptr() + m_pos;
+	}
+
+	/* takes p_bytes of the bytes get_buffered() gave, all of them whole frames */
+	void skip_buffered(t_size p_bytes) {
+		m_pos += p_bytes;
+	}
+
+	/* file offset of the next frame, as far as it's known; after seek() or load(), that is */
+	t_filesize get_offset() const { return m_loaded ? m_pos : m_base + m_pos; }
+
+	/* skip data after damaged frame header up to next run of frames, see find_run(); off by default */
+	void set_resync(bool p_resync) { m_resync = p_resync; }
+
+	bool get_resync() const { return m_resync; }
+
+	/* reads are for indexing ahead of need, as in idle time, and are not taken for playback reads; off by default */
+	void set_background(bool p_background) { m_background = p_background; }
+
+	/* bytes skipped that way since attach() */
+	t_filesize get_skipped() const { return m_skipped; }
+
+	/* valid storage format frame header: zero padding bits, and frame type of a mode, SID or NO_DATA, not a reserved one */
+	static bool is_frame_header(t_uint8 p_byte) {
+		const unsigned ft = (p_byte >> 3) & 0x0F;
+		return (p_byte & 0x83) == 0 && (ft < 9 || ft == 15);
+	}
+
+	/**
+	 * Finds where frames start in damaged data: first offset with amr_resync_frames frames in a row with
+	 * valid headers, the first one marked good by its quality bit, so runs of zero bytes, which are valid
+	 * headers of damaged frames, don't count. Bytes which can't start a run, most of them, are skipped
+	 * 16 at a time with SSE2.
+	 *
+	 * @param p_data		data to search
+	 * @param p_size		its length
+	 * @param p_block_size	payload sizes indexed by frame type
+	 * @param p_final		there is no more data to come; frames with valid headers up to the very end then
+	 *						count as a run, whereas otherwise they're found as one to check once there's more data
+	 * @return				offset of the run, or p_size if there is none
+	 * @since				1.2.0
+	 */
+	static t_size find_run(const t_uint8 * p_data, t_size p_size, const short * p_block_size, bool p_final) {
+		t_size i = 0;
+#ifdef AMR_READER_SSE2
+		const __m128i mask = _mm_set1_epi8((char)0x87), good = _mm_set1_epi8(0x04);
+		for (; i + 16 <= p_size; i += 16) {
+			const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p_data + i));
+			unsigned bits = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(bytes, mask), good));
+			for (; bits != 0; bits &= bits - 1) {
+				const t_size at = i + lowest_bit(bits);
+				if (is_run(p_data + at, p_size - at, p_block_size, p_final)) return at;
+			}
+		}
+#endif
+		for (; i < p_size; ++i) {
+			if ((p_data[i] & 0x87) == 0x04 && is_run(p_data + i, p_size - i, p_block_size, p_final)) return i;
+		}
+		return p_size;
+	}
+
+	/* read next block on another thread as soon as the current one is taken; off by default, and for loaded files */
+	void set_read_ahead(bool p_read_ahead) {
+		if (!p_read_ahead) wait();
+		m_read_ahead = p_read_ahead;
+	}
+
+	/* waits for the read going on on another thread, if any, so the file can be used by others */
+	void wait() {
+		m_thread.waitTillDone();
+	}
+
+	/**
+	 * Gets next frame from the file.
+	 *
+	 * @param p_block_size	payload sizes indexed by frame type
+	 * @param p_frame_size	receives length of the frame, header byte included
+	 * @param p_abort		abort callback
+	 * @return				pointer to the frame, valid until next call, or <code>NULL</code> if file ends before whole frame
+	 * @since				1.2.0
+	 */
+	const t_uint8 * next(const short * p_block_size, t_size & p_frame_size, abort_callback & p_abort) {
+		if (!at_frame(p_block_size, p_abort)) return NULL;
+		const t_size size = 1 + p_block_size[(m_data[m_pos] >> 3) & 0x0F];
+		if (!ensure(size, p_abort)) return NULL;
+		const t_uint8 * frame = m_data.get_ptr() + m_pos;
+		m_pos += size;
+		p_frame_size = size;
+		return frame;
+	}
+
+	/**
+	 * Gets exactly p_count next frames, lying one after another in memory, as multichannel files
+	 * have a frame of each channel; unlike next_run(), reads more if they're not all buffered.
+	 *
+	 * @param p_block_size	payload sizes indexed by frame type
+	 * @param p_count		number of frames
+	 * @param p_size		receives length of the frames in bytes, header bytes included
+	 * @param p_abort		abort callback
+	 * @return				pointer to the first frame, valid until next call, or <code>NULL</code> if file ends before the last whole frame
+	 * @since				1.2.0
+	 */
+	const t_uint8 * next_frames(const short * p_block_size, unsigned p_count, t_size & p_size, abort_callback & p_abort) {
+		if (!at_frame(p_block_size, p_abort)) return NULL;
+		t_size size = 0;
+		for (unsigned i = 0; i < p_count; ++i) {
+			if (!ensure(size + 1, p_abort)) return NULL;
+			size += 1 + p_block_size[(m_data[m_pos + size] >> 3) & 0x0F];
+		}
+		if (!ensure(size, p_abort)) return NULL;
+		const t_uint8 * first = m_data.get_ptr() + m_pos;
+		m_pos += size;
+		p_size = size;
+		return first;
+	}
+
+	/**
+	 * Gets run of next frames lying one after another in memory, for batch decoding.
+	 *
+	 * @param p_block_size	payload sizes indexed by frame type
+	 * @param p_max_frames	maximum number of frames to return
+	 * @param p_frames		receives number of frames in the run, at least one
+	 * @param p_size		receives length of the run in bytes
+	 * @param p_abort		abort callback
+	 * @return				pointer to the first frame, valid until next call, or <code>NULL</code> if file ends before whole frame
+	 * @since				1.2.0
+	 */
+	const t_uint8 * next_run(const short * p_block_size, unsigned p_max_frames, unsigned & p_frames, t_size & p_size, abort_callback & p_abort) {
+		t_size size;
+		const t_uint8 * first = next(p_block_size, size, p_abort);
+		if (first == NULL) return NULL;
+		/* take whatever else is buffered, not reading more */
+		const unsigned more = p_max_frames > 1 ? p_max_frames - 1 : 0;
+		unsigned frames;
+		size += m_resync ? take_run<true>(p_block_size, more, frames) : take_run<false>(p_block_size, more, frames);
+		p_frames = frames + 1;
+		p_size = size;
+		return first;
+	}
+
+private:
+	/* index of the lowest bit set in nonzero p_bits */
+	static unsigned lowest_bit(unsigned p_bits) {
+#if defined(_MSC_VER)
+		unsigned long index;
+		_BitScanForward(&index, p_bits);
+		return (unsigned)index;
+#else
+		return (unsigned)__builtin_ctz(p_bits);
+#endif
+	}
+
+	/**
+	 * Takes whole frames buffered after the current one, for next_run(). Resync is a template argument, so
+	 * the loop has no check for it where it's off; positions are kept in locals, as stores and loads through
+	 * byte pointers could otherwise touch members and make the compiler read them again every frame.
+	 *
+	 * @param p_block_size	payload sizes indexed by frame type
+	 * @param p_max_frames	frames to take at most
+	 * @param p_frames		receives number of frames taken
+	 * @return				bytes of them
+	 */
+	template<bool t_resync> t_size take_run(const short * p_block_size, unsigned p_max_frames, unsigned & p_frames) {
+		const t_uint8 * const data = m_data.get_ptr();
+		const t_size end = m_size;
+		t_size pos = m_pos;
+		unsigned frames = 0;
+		while (frames < p_max_frames && pos < end) {
+			/* damaged frame is left for next call to skip */
+			if (t_resync && !is_frame_header(data[pos])) break;
+			const t_size length = 1 + p_block_size[(data[pos] >> 3) & 0x0F];
+			if (end - pos < length) break;
+			pos += length;
+			++frames;
+		}
+		const t_size bytes = pos - m_pos;
+		m_pos = pos;
+		p_frames = frames;
+		return bytes;
+	}
+
+	/* p_data starts with amr_resync_frames frames with valid headers; if it ends first, the frames before count if p_final */
+	static bool is_run(const t_uint8 * p_data, t_size p_size, const short * p_block_size, bool p_final) {
+		t_size pos = 0;
+		unsigned frames = 0;
+		for (; frames < amr_resync_frames && pos < p_size; ++frames) {
+			if (!is_frame_header(p_data[pos])) return false;
+			pos += 1 + p_block_size[(p_data[pos] >> 3) & 0x0F];
+		}
+		return frames == amr_resync_frames ? pos <= p_size || !p_final : !p_final || pos == p_size;
+	}
+
+	/**
+	 * Makes sure there is a frame to read, skipping damaged data first if it's not at its header and
+	 * resync is on: data is searched from the byte after, a block at a time, until a run of frames is found.
+	 *
+	 * @return				<code>false</code> if file ends first
+	 */
+	bool at_frame(const short * p_block_size, abort_callback & p_abort) {
+		if (!ensure(1, p_abort)) return false;
+		if (!m_resync || is_frame_header(m_data[m_pos])) return true;
+		++m_pos;
+		++m_skipped;
+		for (;;) {
+			/* run found where data ends may go on in what is read next */
+			const bool final = !ensure(amr_resync_span, p_abort);
+			const t_size left = m_size - m_pos;
+			const t_size found = find_run(m_data.get_ptr() + m_pos, left, p_block_size, final);
+			m_pos += found;
+			m_skipped += found;
+			if (found == left) {
+				if (final) return false;
+				continue;
+			}
+			if (final || m_size - m_pos >= amr_resync_span) return true;
+		}
+	}
+
+	/* makes sure at least p_bytes unread bytes are buffered, unless file ends first; just the check is inlined into loops over frames */
+	bool ensure(t_size p_bytes, abort_callback & p_abort) {
+		return m_size - m_pos >= p_bytes || refill(p_bytes, p_abort);
+	}
+
+	/* ensure() where the bytes aren't buffered: loaded file has no more, other is read on */
+	PFC_NOINLINE bool refill(t_size p_bytes, abort_callback & p_abort) {
+		if (m_loaded) return false;
+		if (m_read_ahead) return ensure_read_ahead(p_bytes, p_abort);
+		if (m_data.get_size() == 0) m_data.set_size(amr_read_block_size);
+		/* move the unread tail to the front and top the block up */
+		const t_size left = m_size - m_pos;
+		memmove(m_data.get_ptr(), m_data.get_ptr() + m_pos, left);
+		m_base += m_pos;
+		m_pos = 0;
+		m_size = left;
+		m_size += read_block(m_data.get_ptr() + left, clip(amr_read_block_size - left), !is_background(), p_abort);
+		return m_size >= p_bytes;
+	}
+
+	/* reads are not playback ones, see set_background() */
+	bool is_background() const { return m_background || amr_io_throttle::is_background_thread(); }
+
+	/* reads a block from the file, after waiting if it's read on a background thread, and takes its latency if it's read for playback; all reads are counted, see amr_counters */
+	t_size read_block(void * p_buffer, t_size p_bytes, bool p_playback, abort_callback & p_abort) {
+		if (amr_io_throttle::is_background_thread()) amr_io_throttle::get().wait(p_abort);
+		pfc::hires_timer timer;
+		timer.start();
+		const t_size read = m_file->read(p_buffer, p_bytes, p_abort);
+		const double seconds = timer.query();
+		amr_count(amr_counter_read_bytes, read);
+		amr_count(amr_counter_read_us, (t_int64)(seconds * 1000000));
+		if (p_playback) amr_io_throttle::get().on_playback_read(seconds);
+		return read;
+	}
+
+	/**
+	 * Same as ensure(), with blocks read on another thread: unread bytes are put in front of the block
+	 * read ahead, which becomes the current one, and the next block is read into the previous one's
+	 * buffer meanwhile. File ends when a read gets nothing.
+	 */
+	bool ensure_read_ahead(t_size p_bytes, abort_callback & p_abort) {
+		/* first block after seek is not there yet */
+		if (!m_pending) read_ahead();
+		wait();
+		m_pending = false;
+		if (m_error) {
+			std::exception_ptr error = m_error;
+			m_error = std::exception_ptr();
+			std::rethrow_exception(error);
+		}
+		p_abort.check();
+		const t_size left = m_size - m_pos;
+		const t_filesize offset = m_base + m_pos;
+		memcpy(m_next.get_ptr() + amr_read_ahead_slack - left, m_data.get_ptr() + m_pos, left);
+		pfc::swap_t(m_data, m_next);
+		m_pos = amr_read_ahead_slack - left;
+		m_base = offset - m_pos;
+		m_size = amr_read_ahead_slack + m_next_size;
+		if (m_next_size == 0) return false;
+		read_ahead();
+		return m_size - m_pos >= p_bytes;
+	}
+
+	/* starts reading next block into m_next, right after its slack */
+	void read_ahead() {
+		if (m_next.get_size() == 0) m_next.set_size(amr_read_ahead_slack + amr_read_block_size);
+		if (m_data.get_size() < m_next.get_size()) {
+			/* unread bytes are copied from there while the thread reads */
+			pfc::array_t<t_uint8> data;
+			data.set_size(m_next.get_size());
+			memcpy(data.get_ptr(), m_data.get_ptr() + m_pos, m_size - m_pos);
+			m_size -= m_pos;
+			m_base += m_pos;
+			m_pos = 0;
+			pfc::swap_t(m_data, data);
+		}
+		/* file ends for the reader when nothing is read */
+		const t_size bytes = clip(amr_read_block_size);
+		/* told here, as the thread reading is not the one the reader is used on */
+		const bool playback = !is_background();
+		m_pending = true;
+		m_thread.startHere([this, bytes, playback] {
+			try {
+				abort_callback_dummy abort;
+				m_next_size = read_block(m_next.get_ptr() + amr_read_ahead_slack, bytes, playback, abort);
+			} catch (...) {
+				m_next_size = 0;
+				m_error = std::current_exception();
+			}
+		});
+	}
+
+	/* how many of p_bytes, to be read from the file right after the bytes buffered, lie before the end set by set_end() */
+	t_size clip(t_size p_bytes) const {
+		const t_filesize offset = m_base + m_size;
+		if (offset >= m_end) return 0;
+		return (t_size)pfc::min_t<t_filesize>(p_bytes, m_end - offset);
+	}
+
+	/* waits for the read on another thread and drops the block, as the file is going to be read elsewhere */
+	void drop() {
+		wait();
+		m_pending = false;
+		m_error = std::exception_ptr();
+	}
+
+	service_ptr_t<file> m_file;
+	/* read-ahead block, or the whole file if m_loaded, and file offset of its first byte */
+	pfc::array_t<t_uint8> m_data;
+	t_filesize m_base;
+	/* first unread byte */
+	t_size m_pos;
+	/* number of valid bytes in m_data */
+	t_size m_size;
+	/* bytes skipped by at_frame() */
+	t_filesize m_skipped;
+	/* offset the file ends at for the reader, see set_end() */
+	t_filesize m_end;
+	bool m_loaded;
+	bool m_read_ahead;
+	bool m_resync;
+	bool m_background;
+	/* block read ahead into m_next, m_next_size bytes of it after amr_read_ahead_slack, not taken yet; read may be going on */
+	bool m_pending;
+	pfc::array_t<t_uint8> m_next;
+	t_size m_next_size;
+	/* what the read threw */
+	std::exception_ptr m_error;
+	pfc::thread2 m_thread;
+};
@@ -0,0 +1,235 @@
+/**
+ * foo_input_amr - bulk walk of buffered frame headers, for indexing
+*/
+#pragma once
+
+#include "amr_frame_reader.h"
+#include "amr_index.h"
+
+enum {
+	/* frames of all channels walked by one amr_frame_scanner::scan() at most, about a minute and a half */
+	amr_scan_max_frames = 4096,
+};
+
+/**
+ * Walks frames lying in memory in two passes, so indexing does not go through the reader frame by
+ * frame. First pass only follows frame lengths: a table of 256 entries, one per header byte, gives
+ * length of the frame and whether the header is valid, and frame offsets and headers are written
+ * to compact arrays as they're walked. Second pass counts frame types, damaged frames, mode switches
+ * and pauses, and picks indexed offsets, over those arrays, 16 headers at a time with SSE2.
+ *
+ * @since   1.2.0
+ */
+class amr_frame_scanner {
+public:
+	amr_frame_scanner() : m_frames(0), m_channels(0) {}
+
+	/**
+	 * Fills the table for given payload sizes; cheap enough to be done before each walk.
+	 *
+	 * @param p_block_size	payload sizes indexed by frame type
+	 * @since				1.2.0
+	 */
+	void init(const short * p_block_size) {
+		for (unsigned i = 0; i < 256; ++i) {
+			m_length[i] = (t_uint8)(1 + p_block_size[(i >> 3) & 0x0F]);
+			m_invalid[i] = !amr_frame_reader::is_frame_header((t_uint8)i);
+		}
+	}
+
+	/**
+	 * First pass: walks whole frames of all channels at the start of p_data, as long as they're there.
+	 *
+	 * @param p_data		frames
+	 * @param p_size		bytes of them in memory
+	 * @param p_channels	frames of one 20ms frame, one per channel
+	 * @param p_max_frames	20ms frames to walk at most, up to amr_scan_max_frames
+	 * @param p_resync		stop at a damaged frame header, for the reader to skip what follows it
+	 * @return				bytes the frames walked take
+	 * @since				1.2.0
+	 */
+	t_size scan(const t_uint8 * p_data, t_size p_size, unsigned p_channels, unsigned p_max_frames, bool p_resync) {
+		const unsigned max_frames = pfc::min_t<unsigned>(p_max_frames, amr_scan_max_frames);
+		if (m_headers.get_size() < (t_size)amr_scan_max_frames * p_channels) {
+			m_headers.set_size((t_size)amr_scan_max_frames * p_channels);
+			m_pause.set_size((t_size)amr_scan_max_frames * p_channels);
+		}
+		/* damaged headers only stop the walk with resync on, as the reader follows them otherwise */
+		const t_uint8 stop = p_resync ? 1 : 0;
+		t_uint8 * headers = m_headers.get_ptr();
+		t_size pos = 0;
+		unsigned frames = 0;
+		m_channels = p_channels;
+		/* longest frames of all channels fit in what's left, so the walk needs no bounds check per channel */
+		while (frames < max_frames && p_size - pos >= (t_size)amr_scan_max_frame_size * p_channels) {
+			t_size end = pos;
+			t_uint8 invalid = 0;
+			for (unsigned c = 0; c < p_channels; ++c) {
+				const t_uint8 header = p_data[end];
+				headers[frames * p_channels + c] = header;
+				invalid |= m_invalid[header];
+				end += m_length[header];
+			}
+			if (invalid & stop) break;
+			m_offsets[frames++] = (t_uint32)pos;
+			pos = end;
+		}
+		m_frames = frames;
+		return pos;
+	}
+
+	/**
+	 * Second pass: adds the frames walked by scan() to the index, as if each was walked on its own.
+	 *
+	 * @param p_index		index of the frames before
+	 * @param p_offset		file offset of p_data given to scan()
+	 * @since				1.2.0
+	 */
+	void add_to(amr_frame_index & p_index, t_filesize p_offset) {
+		const unsigned first = p_index.m_frames;
+		const t_uint8 * headers = m_headers.get_ptr();
+		const t_size count = (t_size)m_frames * m_channels;
+		const unsigned bad = p_index.m_bad;
+		count_types(headers, count, p_index);
+		add_quality(p_index, first, p_index.m_bad != bad);
+
+		/* 20ms frame without speech in every channel is a pause frame; flags of channels are folded in place */
+		t_uint8 * pause = m_pause.get_ptr();
+		for (t_size i = 0; i < count; ++i) pause[i] = is_pause(headers[i]);
+		if (m_channels > 1) {
+			for (unsigned f = 0; f < m_frames; ++f) {
+				t_uint8 all = 1;
+				for (unsigned c = 0; c < m_channels; ++c) all &= pause[f * m_channels + c];
+				pause[f] = all;
+			}
+		}
+		add_pauses(p_index, first);
+
+		for (unsigned f = (amr_index_interval - first % amr_index_interval) % amr_index_interval; f < m_frames; f += amr_index_interval) {
+			p_index.m_offsets.append(p_offset + m_offsets[f]);
+		}
+		p_index.m_frames = first + m_frames;
+	}
+
+	/* 20ms frames walked by scan() */
+	unsigned get_frames() const { return m_frames; }
+	/* offset of each of them within data given to scan() */
+	const t_uint32 * get_offsets() const { return m_offsets; }
+
+private:
+	enum {
+		/* longest frame there is, header included */
+		amr_scan_max_frame_size = 32,
+	};
+
+	/* frame type of comfort noise or no data, which is what DTX sends when nobody speaks */
+	static t_uint8 is_pause(t_uint8 p_header) {
+		const unsigned ft = (p_header >> 3) & 0x0F;
+		return ft == 8 || ft == 15;
+	}
+
+#ifdef AMR_READER_SSE2
+	/* sum of the 16 bytes */
+	static unsigned sum_bytes(__m128i p_bytes) {
+		const __m128i sums = _mm_sad_epu8(p_bytes, _mm_setzero_si128());
+		return (unsigned)(_mm_cvtsi128_si32(sums) + _mm_cvtsi128_si32(_mm_srli_si128(sums, 8)));
+	}
+#endif
+
+	/* adds frames of each type and damaged ones among p_count headers to the index */
+	static void count_types(const t_uint8 * p_headers, t_size p_count, amr_frame_index & p_index) {
+		t_size i = 0;
+#ifdef AMR_READER_SSE2
+		/* counts of each type are kept in bytes, so they're added up every 255 rounds at the latest */
+		const __m128i low = _mm_set1_epi8(0x0F), quality = _mm_set1_epi8(0x04);
+		while (p_count - i >= 16) {
+			const t_size rounds = pfc::min_t<t_size>((p_count - i) / 16, 255);
+			__m128i counts[amr_frame_types], good = _mm_setzero_si128();
+			for (unsigned t = 0; t < amr_frame_types; ++t) counts[t] = _mm_setzero_si128();
+			for (t_size r = 0; r < rounds; ++r, i += 16) {
+				const __m128i headers = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p_headers + i));
+				const __m128i types = _mm_and_si128(_mm_srli_epi16(headers, 3), low);
+				for (unsigned t = 0; t < amr_frame_types; ++t) counts[t] = _mm_sub_epi8(counts[t], _mm_cmpeq_epi8(types, _mm_set1_epi8((char)t)));
+				good = _mm_sub_epi8(good, _mm_cmpeq_epi8(_mm_and_si128(headers, quality), quality));
+			}
+			for (unsigned t = 0; t < amr_frame_types; ++t) p_index.m_histogram[t] += sum_bytes(counts[t]);
+			p_index.m_bad += (unsigned)(rounds * 16) - sum_bytes(good);
+		}
+#endif
+		for (; i < p_count; ++i) {
+			++p_index.m_histogram[(p_headers[i] >> 3) & 0x0F];
+			/* quality bit is clear in frames marked damaged */
+			p_index.m_bad += (p_headers[i] & 0x04) == 0;
+		}
+	}
+
+	/* adds damaged frames and mode switches of the frames walked to the index, which has p_first frames before them */
+	void add_quality(amr_frame_index & p_index, unsigned p_first, bool p_damaged) {
+		const t_uint8 * headers = m_headers.get_ptr();
+		const t_size count = (t_size)m_frames * m_channels;
+		if (p_damaged) {
+			for (unsigned f = 0; f < m_frames; ++f) {
+				bool bad = false;
+				for (unsigned c = 0; c < m_channels; ++c) {
+					const t_uint8 header = headers[f * m_channels + c];
+					bad = bad || (header & 0x04) == 0;
+					p_index.add_mode(c, header);
+				}
+				p_index.m_frames = p_first + f;
+				p_index.add_quality_frame(bad);
+			}
+			return;
+		}
+		/* nothing lost: a run of losses ends, and only headers unlike the one of their channel before can switch mode */
+		if (m_frames > 0) p_index.m_bad_run = 0;
+		t_size i = 0;
+		for (; i < count && i < m_channels; ++i) p_index.add_mode((unsigned)i, headers[i]);
+		while (i < count) {
+#ifdef AMR_READER_SSE2
+			if (count - i >= 16) {
+				const __m128i now = _mm_loadu_si128(reinterpret_cast<const __m128i *>(headers + i));
+				const __m128i before = _mm_loadu_si128(reinterpret_cast<const __m128i *>(headers + i - m_channels));
+				if (_mm_movemask_epi8(_mm_cmpeq_epi8(now, before)) == 0xFFFF) {
+					i += 16;
+					continue;
+				}
+			}
+#endif
+			if (headers[i] != headers[i - m_channels]) p_index.add_mode((unsigned)(i % m_channels), headers[i]);
+			++i;
+		}
+	}
+
+	/* adds pause flags of the frames walked to runs of the index, which has p_first frames before them */
+	void add_pauses(amr_frame_index & p_index, unsigned p_first) {
+		const t_uint8 * pause = m_pause.get_ptr();
+		unsigned f = 0;
+		while (f < m_frames) {
+#ifdef AMR_READER_SSE2
+			/* 16 frames of speech out of a pause, or of a pause going on, change nothing but the run */
+			if (m_frames - f >= 16) {
+				const __m128i flags = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pause + f));
+				const unsigned speech = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(flags, _mm_setzero_si128()));
+				if (speech == 0 || (speech == 0xFFFF && p_index.m_pause_run == 0)) {
+					if (speech == 0) p_index.m_pause_run += 16;
+					f += 16;
+					continue;
+				}
+			}
+#endif
+			p_index.m_frames = p_first + f;
+			p_index.add_pause_frame(pause[f] != 0);
+			++f;
+		}
+	}
+
+	/* frame length and whether the header is damaged, by header byte */
+	t_uint8 m_length[256];
+	t_uint8 m_invalid[256];
+	/* headers and pause flags of frames of all channels, and offsets of 20ms frames, walked by scan() */
+	pfc::array_t<t_uint8> m_headers;
+	pfc::array_t<t_uint8> m_pause;
+	t_uint32 m_offsets[amr_scan_max_frames];
+	unsigned m_frames;
+	unsigned m_channels;
+};
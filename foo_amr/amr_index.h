@@ -0,0 +1,515 @@
+/**
+ * foo_input_amr - frame index of an AMR file
+*/
+#pragma once
+
+#include <memory>
+#include "amr_replaygain.h"
+
+enum {
+	/* seek index stores offset of every 50th frame, that is one entry per second */
+	amr_index_interval = 50,
+	/* seek index keeps every 60th entry whole, that is one per minute, see amr_offset_index */
+	amr_index_coarse_entries = 60,
+	/* bytes of 7 bits a 64-bit distance takes at most */
+	amr_index_max_varint = 10,
+	/* seek index keeps offsets as runs while they hold this many entries on average, see amr_offset_index, */
+	amr_index_run_min_entries = 8,
+	/* or while there are no more than this many runs, whatever their length */
+	amr_index_free_runs = 16,
+	/* frame type is 4-bit field of the frame header */
+	amr_frame_types = 16,
+	/* estimated level of file with nothing but silence, in hundredths of dB */
+	amr_level_silent = -32768,
+	/* shortest run of frames without speech recorded as a pause, 2 seconds */
+	amr_pause_min_frames = 100,
+	/* frame types below are speech of each mode; comfort noise and no data come between speech of any mode */
+	amr_index_speech_modes = 8,
+	/* 20ms frames of a minute, for losses by minute */
+	amr_index_minute_frames = 3000,
+};
+
+/* FNV-1a, 64-bit; frames are hashed as they're walked, so the hash needs no pass of its own */
+static const t_uint64 amr_hash_basis = 0xcbf29ce484222325ULL;
+static const t_uint64 amr_hash_prime = 0x100000001b3ULL;
+
+/* hash of frames of a file with given number of channels, before any frames */
+inline t_uint64 amr_hash_start(unsigned p_channels) {
+	return (amr_hash_basis ^ p_channels) * amr_hash_prime;
+}
+
+/* hash p_hash with p_size bytes of p_data added */
+inline t_uint64 amr_hash_add(t_uint64 p_hash, const t_uint8 * p_data, t_size p_size) {
+	for (t_size i = 0; i < p_size; ++i) p_hash = (p_hash ^ p_data[i]) * amr_hash_prime;
+	return p_hash;
+}
+
+/**
+ * File offsets of every amr_index_interval-th frame. Most files are of one mode, or switch between
+ * modes seldom, so offsets are kept as runs of entries a constant distance apart, each its first entry,
+ * offset and that distance: a file of one mode takes a single run, whatever its length, and an offset is
+ * found by binary search over runs and a multiplication. Once runs get shorter than
+ * amr_index_run_min_entries on average, as with DTX, which changes frame sizes all the time, they'd take
+ * more than distances, and offsets are kept in two levels instead: every amr_index_coarse_entries-th
+ * offset, a minute apart, whole, along with where its minute starts in the fine level, and the rest as
+ * distance from the offset before, in as many bytes of 7 bits as it takes; a second of single channel
+ * file takes 2. That's about 7 KB per hour rather than 28 KB of whole offsets, so index of a week-long
+ * recording takes a megabyte. Getting an offset then decodes a minute of distances at most.
+ * Offsets are added in increasing order, as frames are walked. They're serialized in two levels either
+ * way, so data written before runs were kept reads as it did.
+ *
+ * @since   1.2.0
+ */
+class amr_offset_index {
+public:
+	amr_offset_index() : m_count(0), m_last(0), m_packed(true) {}
+
+	/* drops all offsets */
+	void reset() {
+		m_runs.set_size(0);
+		m_coarse.set_size(0);
+		m_fine_start.set_size(0);
+		m_fine.set_size(0);
+		m_count = 0;
+		m_last = 0;
+		m_packed = true;
+	}
+
+	/* adds offset of the next indexed frame, not less than the one before */
+	void append(t_filesize p_offset) {
+		if (m_packed) put_run(m_count, p_offset, m_last);
+		else put_fine(m_count, p_offset, m_last);
+		m_last = p_offset;
+		++m_count;
+		if (m_packed && too_many_runs()) unpack();
+	}
+
+	/* number of offsets */
+	t_size get_size() const { return m_count; }
+
+	/* bytes the offsets take in memory */
+	t_size get_memory() const {
+		return m_runs.get_size() * sizeof(run) + m_coarse.get_size() * sizeof(t_filesize) + m_fine_start.get_size() * sizeof(t_uint32) + m_fine.get_size();
+	}
+
+	/* offset of p_entry-th indexed frame */
+	t_filesize operator[](t_size p_entry) const {
+		if (m_packed) {
+			/* last run starting at p_entry or before */
+			t_size low = 0, high = m_runs.get_size();
+			while (high - low > 1) {
+				const t_size middle = (low + high) / 2;
+				if (m_runs[middle].m_entry <= p_entry) low = middle;
+				else high = middle;
+			}
+			const run & r = m_runs[low];
+			return r.m_offset + (t_filesize)(p_entry - r.m_entry) * r.m_stride;
+		}
+		const t_size minute = p_entry / amr_index_coarse_entries;
+		t_filesize offset = m_coarse[minute];
+		const t_uint8 * fine = m_fine.get_ptr() + m_fine_start[minute];
+		for (t_size i = minute * amr_index_coarse_entries; i < p_entry; ++i) offset += get_varint(fine);
+		return offset;
+	}
+
+	/**
+	 * Serializes the offsets in two levels: their number, whole offsets, and distances.
+	 *
+	 * @param p_stream		stream to write to
+	 * @param p_abort		abort callback
+	 * @since				1.2.0
+	 */
+	void write(stream_writer * p_stream, abort_callback & p_abort) const {
+		if (m_packed) {
+			amr_offset_index levels(*this);
+			levels.unpack();
+			levels.write(p_stream, p_abort);
+			return;
+		}
+		p_stream->write_lendian_t((t_uint32)m_count, p_abort);
+		for (t_size i = 0; i < m_coarse.get_size(); ++i) p_stream->write_lendian_t((t_uint64)m_coarse[i], p_abort);
+		p_stream->write_lendian_t((t_uint32)m_fine.get_size(), p_abort);
+		p_stream->write(m_fine.get_ptr(), m_fine.get_size(), p_abort);
+	}
+
+	/**
+	 * Deserializes offsets stored by write(); distances are walked once, so each minute's start is known,
+	 * so that distances that don't add up to the number of offsets are taken for damaged data, and so
+	 * that offsets are put into runs, if there are few enough of them.
+	 *
+	 * @param p_stream		stream to read from
+	 * @param p_count		number of offsets there have to be
+	 * @param p_abort		abort callback
+	 * @since				1.2.0
+	 */
+	void read(stream_reader * p_stream, t_size p_count, abort_callback & p_abort) {
+		reset();
+		m_packed = false;
+		t_uint32 value;
+		p_stream->read_lendian_t(value, p_abort);
+		if (value != p_count) throw exception_io_data();
+		m_count = value;
+		const t_size minutes = (m_count + amr_index_coarse_entries - 1) / amr_index_coarse_entries;
+		m_coarse.set_size(minutes);
+		for (t_size i = 0; i < minutes; ++i) {
+			t_uint64 offset;
+			p_stream->read_lendian_t(offset, p_abort);
+			m_coarse[i] = offset;
+		}
+		p_stream->read_lendian_t(value, p_abort);
+		/* a distance takes one byte at least */
+		if (value > m_count * amr_index_max_varint) throw exception_io_data();
+		m_fine.set_size(value);
+		p_stream->read_object(m_fine.get_ptr(), value, p_abort);
+		m_fine_start.set_size(minutes);
+		const t_uint8 * fine = m_fine.get_ptr();
+		const t_uint8 * const end = fine + value;
+		/* runs are gathered on the way, until there are too many of them */
+		bool packable = true;
+		for (t_size i = 0; i < minutes; ++i) {
+			m_fine_start[i] = (t_uint32)(fine - m_fine.get_ptr());
+			if (packable) put_run(i * amr_index_coarse_entries, m_coarse[i], m_last);
+			m_last = m_coarse[i];
+			const t_size entries = pfc::min_t<t_size>(m_count - i * amr_index_coarse_entries, amr_index_coarse_entries);
+			for (t_size e = 1; e < entries; ++e) {
+				/* last byte of a distance has the top bit clear */
+				t_size bytes = 0;
+				while (fine + bytes < end && bytes < amr_index_max_varint && (fine[bytes] & 0x80) != 0) ++bytes;
+				if (fine + bytes >= end || bytes == amr_index_max_varint) throw exception_io_data();
+				const t_filesize offset = m_last + get_varint(fine);
+				if (packable) put_run(i * amr_index_coarse_entries + e, offset, m_last);
+				m_last = offset;
+			}
+			if (i + 1 < minutes && m_coarse[i + 1] < m_last) throw exception_io_data();
+			if (packable && m_runs.get_size() > amr_index_free_runs && m_runs.get_size() * amr_index_run_min_entries > (i + 1) * amr_index_coarse_entries) {
+				packable = false;
+				m_runs.set_size(0);
+			}
+		}
+		if (fine != end) throw exception_io_data();
+		if (packable && !too_many_runs()) {
+			m_coarse.set_size(0);
+			m_fine_start.set_size(0);
+			m_fine.set_size(0);
+			m_packed = true;
+		}
+		else m_runs.set_size(0);
+	}
+
+private:
+	/* entries from m_entry on, m_stride bytes apart, the first at m_offset */
+	struct run {
+		t_filesize m_offset;
+		t_uint32 m_entry;
+		t_uint32 m_stride;
+	};
+
+	/* adds p_entry-th offset to runs, p_previous being the one before */
+	void put_run(t_size p_entry, t_filesize p_offset, t_filesize p_previous) {
+		const t_filesize distance = p_offset - p_previous;
+		if (m_runs.get_size() > 0) {
+			run & last = m_runs[m_runs.get_size() - 1];
+			const t_size entries = p_entry - last.m_entry;
+			/* second entry of a run sets the distance of all */
+			if (entries == 1 && distance <= 0xFFFFFFFF) {
+				last.m_stride = (t_uint32)distance;
+				return;
+			}
+			if (entries > 1 && distance == last.m_stride) return;
+		}
+		const run added = { p_offset, (t_uint32)p_entry, 0 };
+		m_runs.append_single(added);
+	}
+
+	/* adds p_entry-th offset to the two levels, p_previous being the one before */
+	void put_fine(t_size p_entry, t_filesize p_offset, t_filesize p_previous) {
+		if (p_entry % amr_index_coarse_entries == 0) {
+			m_coarse.append_single(p_offset);
+			m_fine_start.append_single((t_uint32)m_fine.get_size());
+		}
+		else put_varint(p_offset - p_previous);
+	}
+
+	/* runs take more than distances would, with the few every file may have aside */
+	bool too_many_runs() const {
+		return m_runs.get_size() > amr_index_free_runs && m_runs.get_size() * amr_index_run_min_entries > m_count;
+	}
+
+	/* moves offsets from runs to the two levels, for good */
+	void unpack() {
+		t_filesize previous = 0;
+		for (t_size i = 0; i < m_count; ++i) {
+			const t_filesize offset = (*this)[i];
+			put_fine(i, offset, previous);
+			previous = offset;
+		}
+		m_runs.set_size(0);
+		m_packed = false;
+	}
+
+	void put_varint(t_uint64 p_value) {
+		t_uint8 bytes[amr_index_max_varint];
+		t_size count = 0;
+		while (p_value >= 0x80) {
+			bytes[count++] = (t_uint8)(p_value | 0x80);
+			p_value >>= 7;
+		}
+		bytes[count++] = (t_uint8)p_value;
+		m_fine.append_fromptr(bytes, count);
+	}
+
+	static t_uint64 get_varint(const t_uint8 * & p_data) {
+		t_uint64 value = 0;
+		for (unsigned shift = 0;; shift += 7) {
+			const t_uint8 byte = *p_data++;
+			value |= (t_uint64)(byte & 0x7F) << shift;
+			if ((byte & 0x80) == 0) return value;
+		}
+	}
+
+	/* runs of offsets, by first entry, while m_packed */
+	pfc::array_t<run> m_runs;
+	/* whole offset of every amr_index_coarse_entries-th entry, and where distances after it start in m_fine, unless m_packed */
+	pfc::array_t<t_filesize> m_coarse;
+	pfc::array_t<t_uint32> m_fine_start;
+	/* distances from the offset before, for the other entries */
+	pfc::array_t<t_uint8, pfc::alloc_fast_aggressive> m_fine;
+	t_size m_count;
+	/* offset added last */
+	t_filesize m_last;
+	/* offsets are kept in m_runs */
+	bool m_packed;
+};
+
+/**
+ * Everything that is learnt about AMR file by walking its frame headers: total number of frames,
+ * number of frames of each frame type and of damaged ones, reception quality, long pauses, and sparse seek index; estimated level and hash of frame
+ * contents too, if they were asked for, see amr_loudness and amr_hash_add(). It's a plain value, so it can be cached
+ * and copied between input instances. Peak and RMS summary and ReplayGain are learnt by decoding, see amr_envelope and
+ * amr_replaygain, so they come later, if at all.
+ *
+ * @since   1.2.0
+ */
+struct amr_frame_index {
+	amr_frame_index() { reset(); }
+
+	/* forget everything, as if the file had no frames */
+	void reset() {
+		m_frames = 0;
+		for (unsigned i = 0; i < amr_frame_types; ++i) m_histogram[i] = 0;
+		m_bad = 0;
+		m_bad_burst = 0;
+		m_mode_switches = 0;
+		m_bad_minutes.set_size(0);
+		m_bad_run = 0;
+		m_last_modes = ~0u;
+		m_level = 0;
+		m_level_frames = 0;
+		m_silent = 0;
+		m_hash = 0;
+		m_pauses.set_size(0);
+		m_pause_run = 0;
+		m_offsets.reset();
+		m_envelope.set_size(0);
+		m_track_gain = amr_gain_none;
+		m_track_peak = 0;
+	}
+
+	/* bytes the index takes in memory, for amr_memory_budget */
+	t_size get_memory() const {
+		return sizeof(*this) + (m_bad_minutes.get_size() + m_pauses.get_size()) * sizeof(t_uint32) + m_offsets.get_memory() + m_envelope.get_size() * sizeof(t_uint16);
+	}
+
+	/**
+	 * Adds a frame walked to the run of frames without speech, or ends the run, and records it
+	 * if it was long enough. Called before the frame is counted in m_frames.
+	 *
+	 * @param p_pause		frames of all channels are comfort noise or no data
+	 * @since				1.2.0
+	 */
+	void add_pause_frame(bool p_pause) {
+		if (p_pause) {
+			++m_pause_run;
+			return;
+		}
+		if (m_pause_run >= amr_pause_min_frames) {
+			m_pauses.append_single(m_frames - m_pause_run);
+			m_pauses.append_single(m_pause_run);
+		}
+		m_pause_run = 0;
+	}
+
+	/**
+	 * Adds a 20ms frame walked to the run of damaged ones, and to losses of its minute, or ends the run.
+	 * Called before the frame is counted in m_frames.
+	 *
+	 * @param p_bad			frame of some channel is marked damaged by its quality bit
+	 * @since				1.2.0
+	 */
+	void add_quality_frame(bool p_bad) {
+		if (!p_bad) {
+			m_bad_run = 0;
+			return;
+		}
+		if (++m_bad_run > m_bad_burst) m_bad_burst = m_bad_run;
+		const t_uint32 minute = m_frames / amr_index_minute_frames;
+		const t_size size = m_bad_minutes.get_size();
+		if (size > 0 && m_bad_minutes[size - 2] == minute) ++m_bad_minutes[size - 1];
+		else {
+			m_bad_minutes.append_single(minute);
+			m_bad_minutes.append_single(1);
+		}
+	}
+
+	/**
+	 * Counts a switch of speech mode, if the frame header has another one than the last speech frame
+	 * of its channel had; comfort noise and no data switch nothing.
+	 *
+	 * @param p_channel		channel of the frame
+	 * @param p_header		its header
+	 * @since				1.2.0
+	 */
+	void add_mode(unsigned p_channel, t_uint8 p_header) {
+		const unsigned ft = (p_header >> 3) & 0x0F;
+		if (ft >= amr_index_speech_modes) return;
+		const unsigned shift = 4 * p_channel;
+		const unsigned last = (m_last_modes >> shift) & 0x0F;
+		if (last == ft) return;
+		if (last != 0x0F) ++m_mode_switches;
+		m_last_modes = (m_last_modes & ~(0x0Fu << shift)) | (ft << shift);
+	}
+
+	/**
+	 * Serializes the index. Seek index is stored as it's kept, see amr_offset_index::write(); summary
+	 * precedes it, if there is one.
+	 *
+	 * @param p_stream		stream to write to
+	 * @param p_abort		abort callback
+	 * @since				1.2.0
+	 */
+	void write(stream_writer * p_stream, abort_callback & p_abort) const {
+		p_stream->write_lendian_t((t_uint32)m_frames, p_abort);
+		for (unsigned i = 0; i < amr_frame_types; ++i) p_stream->write_lendian_t((t_uint32)m_histogram[i], p_abort);
+		p_stream->write_lendian_t((t_uint32)m_bad, p_abort);
+		p_stream->write_lendian_t((t_uint32)m_bad_burst, p_abort);
+		p_stream->write_lendian_t((t_uint32)m_mode_switches, p_abort);
+		p_stream->write_lendian_t((t_uint32)m_bad_minutes.get_size(), p_abort);
+		for (t_size i = 0; i < m_bad_minutes.get_size(); ++i) p_stream->write_lendian_t(m_bad_minutes[i], p_abort);
+		p_stream->write_lendian_t((t_int32)m_level, p_abort);
+		p_stream->write_lendian_t((t_uint32)m_level_frames, p_abort);
+		p_stream->write_lendian_t((t_uint32)m_silent, p_abort);
+		p_stream->write_lendian_t(m_hash, p_abort);
+		p_stream->write_lendian_t((t_uint32)m_pauses.get_size(), p_abort);
+		for (t_size i = 0; i < m_pauses.get_size(); ++i) p_stream->write_lendian_t(m_pauses[i], p_abort);
+		p_stream->write_lendian_t((t_uint32)m_envelope.get_size(), p_abort);
+		for (t_size i = 0; i < m_envelope.get_size(); ++i) p_stream->write_lendian_t(m_envelope[i], p_abort);
+		p_stream->write_lendian_t(m_track_gain, p_abort);
+		p_stream->write_lendian_t(m_track_peak, p_abort);
+		m_offsets.write(p_stream, p_abort);
+	}
+
+	/**
+	 * Deserializes an index stored by write().
+	 *
+	 * @param p_stream		stream to read from
+	 * @param p_abort		abort callback
+	 * @since				1.2.0
+	 */
+	void read(stream_reader * p_stream, abort_callback & p_abort) {
+		t_uint32 value;
+		p_stream->read_lendian_t(value, p_abort); m_frames = value;
+		for (unsigned i = 0; i < amr_frame_types; ++i) {
+			p_stream->read_lendian_t(value, p_abort); m_histogram[i] = value;
+		}
+		p_stream->read_lendian_t(value, p_abort); m_bad = value;
+		p_stream->read_lendian_t(value, p_abort); m_bad_burst = value;
+		if (m_bad_burst > m_frames) throw exception_io_data();
+		p_stream->read_lendian_t(value, p_abort); m_mode_switches = value;
+		p_stream->read_lendian_t(value, p_abort);
+		/* minute and damaged frames of each minute that has some, in order */
+		if (value % 2 != 0 || value / 2 > m_frames / amr_index_minute_frames + 1) throw exception_io_data();
+		m_bad_minutes.set_size(value);
+		for (t_size i = 0; i < value; i += 2) {
+			p_stream->read_lendian_t(m_bad_minutes[i], p_abort);
+			p_stream->read_lendian_t(m_bad_minutes[i + 1], p_abort);
+			if ((i > 0 && m_bad_minutes[i] <= m_bad_minutes[i - 2]) || (t_uint64)m_bad_minutes[i] * amr_index_minute_frames >= m_frames) throw exception_io_data();
+			if (m_bad_minutes[i + 1] == 0 || m_bad_minutes[i + 1] > amr_index_minute_frames) throw exception_io_data();
+		}
+		m_bad_run = 0;
+		m_last_modes = ~0u;
+		t_int32 level;
+		p_stream->read_lendian_t(level, p_abort); m_level = level;
+		p_stream->read_lendian_t(value, p_abort); m_level_frames = value;
+		p_stream->read_lendian_t(value, p_abort); m_silent = value;
+		if (m_silent > m_level_frames) throw exception_io_data();
+		p_stream->read_lendian_t(m_hash, p_abort);
+		p_stream->read_lendian_t(value, p_abort);
+		/* first frame and length of each, in order, within the file */
+		if (value % 2 != 0) throw exception_io_data();
+		m_pauses.set_size(value);
+		t_uint64 end = 0;
+		for (t_size i = 0; i < value; i += 2) {
+			p_stream->read_lendian_t(m_pauses[i], p_abort);
+			p_stream->read_lendian_t(m_pauses[i + 1], p_abort);
+			if (m_pauses[i] < end || m_pauses[i + 1] < amr_pause_min_frames) throw exception_io_data();
+			end = (t_uint64)m_pauses[i] + m_pauses[i + 1];
+			if (end > m_frames) throw exception_io_data();
+		}
+		m_pause_run = 0;
+		p_stream->read_lendian_t(value, p_abort);
+		/* two values per entry */
+		if (value % 2 != 0) throw exception_io_data();
+		m_envelope.set_size(value);
+		for (t_size i = 0; i < value; ++i) p_stream->read_lendian_t(m_envelope[i], p_abort);
+		p_stream->read_lendian_t(m_track_gain, p_abort);
+		p_stream->read_lendian_t(m_track_peak, p_abort);
+		/* there is one entry per amr_index_interval frames; anything else means the data is damaged */
+		m_offsets.read(p_stream, (m_frames + amr_index_interval - 1) / amr_index_interval, p_abort);
+	}
+
+	/* total number of 20ms frames; 32 bits are enough for over two years */
+	unsigned m_frames;
+	/* number of frames of each frame type */
+	unsigned m_histogram[amr_frame_types];
+	/* frames marked damaged by their quality bit */
+	unsigned m_bad;
+	/* most 20ms frames in a row with a damaged frame of some channel, lost in a burst */
+	unsigned m_bad_burst;
+	/* changes of speech mode from one speech frame of a channel to the next, as the network adapted the rate */
+	unsigned m_mode_switches;
+	/* minute and number of 20ms frames with a damaged frame of some channel, of each minute that has any */
+	pfc::array_t<t_uint32> m_bad_minutes;
+	/* damaged 20ms frames walked last in a row, and last speech mode of each channel, 4 bits each, while walking */
+	unsigned m_bad_run;
+	unsigned m_last_modes;
+	/* estimated mean level of frames that are not silent, in hundredths of dB of full scale, see amr_loudness */
+	t_int32 m_level;
+	/* channel frames estimated, 0 if level was not, and number of silent ones among them */
+	unsigned m_level_frames;
+	unsigned m_silent;
+	/**
+	 * hash of channel count and of all frames, headers and payloads, as walked; 0 if it was not made.
+	 * Files with the same hash decode to the same audio, whatever else there is in them
+	 */
+	t_uint64 m_hash;
+	/* first frame and number of frames of each run of at least amr_pause_min_frames frames without speech, followed by speech */
+	pfc::array_t<t_uint32> m_pauses;
+	/* frames without speech walked last, while walking */
+	unsigned m_pause_run;
+	/* file offsets of every amr_index_interval-th frame */
+	amr_offset_index m_offsets;
+	/* peak and RMS of every amr_envelope_frames frames, see amr_envelope; empty until the file was decoded through */
+	pfc::array_t<t_uint16> m_envelope;
+	/* ReplayGain measured as the file was played through, see amr_replaygain: track gain in hundredths of dB, amr_gain_none until then, and peak in 1/65536ths */
+	t_int32 m_track_gain;
+	t_uint32 m_track_peak;
+};
+
+/**
+ * Index as it's shared by inputs and amr_index_cache. It's never changed once it's shared; whoever has
+ * more to add makes a copy and shares that, so opening a file does not copy its index, and an input
+ * keeps using the index it got while another replaces the cached one.
+ *
+ * @since   1.2.0
+ */
+typedef std::shared_ptr<const amr_frame_index> amr_frame_index_ptr;
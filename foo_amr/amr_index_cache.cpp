@@ -0,0 +1,297 @@
+/**
+ * foo_input_amr - persistent cache of frame indexes
+*/
+#include "../foo_sdk/foobar2000/SDK/foobar2000.h"
+#include <algorithm>
+#include <vector>
+#include "amr_index_cache.h"
+#include "amr_index_shared.h"
+#include "amr_index_sidecar.h"
+#include "amr_memory_budget.h"
+#include "amr_counters.h"
+#include "amr_thread_pool.h"
+
+/* cache file in profile directory. bump version, whenever layout of amr_frame_index::write changes */
+static const char g_cache_file_name[] = "foo_input_amr.cache";
+static const t_uint32 g_cache_magic = 0x43524d41; /* "AMRC" */
+static const t_uint32 g_cache_version = 11;
+
+amr_index_cache & amr_index_cache::get() {
+	static amr_index_cache instance;
+	return instance;
+}
+
+amr_frame_index_ptr amr_index_cache::query(const char * p_path, const t_filestats & p_stats) {
+	amr_frame_index_ptr index;
+	bool loaded;
+	{
+		insync(m_lock);
+		loaded = !m_loaded;
+		ensure_loaded();
+		entry * found = m_entries.query_ptr(p_path);
+		if (found != NULL && found->m_stats == p_stats) {
+			found->m_used = ++m_clock;
+			index = found->m_index;
+		}
+	}
+	/* another foobar2000 on the computer may have indexed it already */
+	if (!index && p_stats.m_timestamp != filetimestamp_invalid && amr_index_shared::is_enabled()) {
+		std::shared_ptr<amr_frame_index> shared = std::make_shared<amr_frame_index>();
+		if (amr_index_shared::get().read(p_path, p_stats, *shared)) {
+			insync(m_lock);
+			set_entry(p_path, p_stats, shared);
+			m_dirty = true;
+			index = shared;
+		}
+	}
+	amr_count(amr_counter_index_lookups);
+	if (index) amr_count(amr_counter_index_hits);
+	/* whole cache came in just now */
+	if (loaded) amr_memory_budget::get().enforce();
+	return index;
+}
+
+amr_frame_index_ptr amr_index_cache::query_grown(const char * p_path, const t_filestats & p_stats, t_filestats & p_before) {
+	if (p_stats.m_size == filesize_invalid || p_stats.m_timestamp == filetimestamp_invalid) return amr_frame_index_ptr();
+	insync(m_lock);
+	ensure_loaded();
+	entry * found = m_entries.query_ptr(p_path);
+	if (found == NULL || found->m_stats.m_size >= p_stats.m_size || found->m_stats.m_timestamp > p_stats.m_timestamp) return amr_frame_index_ptr();
+	found->m_used = ++m_clock;
+	p_before = found->m_stats;
+	return found->m_index;
+}
+
+void amr_index_cache::store(const char * p_path, const t_filestats & p_stats, const amr_frame_index_ptr & p_index) {
+	if (p_stats.m_timestamp == filetimestamp_invalid) return;
+	{
+		insync(m_lock);
+		ensure_loaded();
+		set_entry(p_path, p_stats, p_index);
+		m_dirty = true;
+	}
+	if (amr_index_shared::is_enabled()) amr_index_shared::get().write(p_path, p_stats, *p_index);
+	amr_memory_budget::get().enforce();
+}
+
+void amr_index_cache::set_entry(const char * p_path, const t_filestats & p_stats, const amr_frame_index_ptr & p_index) {
+	entry & e = m_entries.find_or_add(p_path);
+	m_bytes -= e.m_memory;
+	e.m_stats = p_stats;
+	e.m_index = p_index;
+	e.m_memory = strlen(p_path) + p_index->get_memory();
+	e.m_used = ++m_clock;
+	m_bytes += e.m_memory;
+}
+
+amr_frame_index_ptr amr_index_cache::query_content(t_uint64 p_hash, unsigned p_frames, pfc::string_base & p_path) {
+	if (p_hash == 0) return amr_frame_index_ptr();
+	insync(m_lock);
+	ensure_loaded();
+	/* summary takes decoding the file through, so an entry that has one is better */
+	const pfc::string8 * best = NULL;
+	const entry * found = NULL;
+	m_entries.enumerate([&](const pfc::string8 & p_name, const entry & p_entry) {
+		if (p_entry.m_index->m_hash != p_hash || p_entry.m_index->m_frames != p_frames) return;
+		if (found != NULL && (found->m_index->m_envelope.get_size() > 0 || p_entry.m_index->m_envelope.get_size() == 0)) return;
+		best = &p_name;
+		found = &p_entry;
+	});
+	if (found == NULL) return amr_frame_index_ptr();
+	p_path = *best;
+	return found->m_index;
+}
+
+void amr_index_cache::remove(const char * p_path) {
+	insync(m_lock);
+	ensure_loaded();
+	const entry * found = m_entries.query_ptr(p_path);
+	if (found == NULL) return;
+	m_bytes -= found->m_memory;
+	m_entries.remove(p_path);
+	m_dirty = true;
+}
+
+t_size amr_index_cache::get_memory() {
+	insync(m_lock);
+	return m_bytes;
+}
+
+t_size amr_index_cache::trim(t_size p_bytes) {
+	insync(m_lock);
+	/* index an input holds stays in memory anyway */
+	std::vector<std::pair<t_uint64, const pfc::string8 *> > unused;
+	m_entries.enumerate([&](const pfc::string8 & p_name, const entry & p_entry) {
+		if (p_entry.m_index.use_count() == 1) unused.push_back(std::make_pair(p_entry.m_used, &p_name));
+	});
+	std::sort(unused.begin(), unused.end());
+	pfc::list_t<pfc::string8> dropped;
+	t_size bytes = 0;
+	for (size_t i = 0; i < unused.size() && bytes < p_bytes; ++i) {
+		bytes += m_entries.query_ptr(*unused[i].second)->m_memory;
+		dropped.add_item(*unused[i].second);
+	}
+	for (t_size i = 0; i < dropped.get_count(); ++i) m_entries.remove(dropped[i]);
+	m_bytes -= bytes;
+	if (bytes > 0) m_dirty = true;
+	return bytes;
+}
+
+void amr_index_cache::begin_scan(const char * p_path, abort_callback & p_abort) {
+	for (;;) {
+		std::shared_ptr<pfc::event> scan;
+		{
+			insync(m_lock);
+			const std::shared_ptr<pfc::event> * found = m_scans.query_ptr(p_path);
+			if (found == NULL) {
+				m_scans.set(p_path, std::make_shared<pfc::event>());
+				return;
+			}
+			scan = *found;
+		}
+		/* another input may claim it as soon as it's ended, so it's looked for again */
+		p_abort.waitForEvent(*scan, -1);
+	}
+}
+
+void amr_index_cache::end_scan(const char * p_path) {
+	insync(m_lock);
+	const std::shared_ptr<pfc::event> * found = m_scans.query_ptr(p_path);
+	if (found == NULL) return;
+	(*found)->set_state(true);
+	m_scans.remove(p_path);
+}
+
+void amr_index_cache::ensure_loaded() {
+	if (m_loaded) return;
+	m_loaded = true;
+	try {
+		abort_callback_dummy abort;
+		const pfc::string8 path = core_api::pathInProfile(g_cache_file_name);
+		if (!filesystem::g_exists(path, abort)) return;
+		file::ptr f;
+		filesystem::g_open_read(f, path, abort);
+		t_uint32 magic, version, count;
+		f->read_lendian_t(magic, abort);
+		f->read_lendian_t(version, abort);
+		if (magic != g_cache_magic || version != g_cache_version) return;
+		f->read_lendian_t(count, abort);
+		for (t_uint32 i = 0; i < count; ++i) {
+			pfc::string8 name;
+			t_filestats stats;
+			f->read_string(name, abort);
+			f->read_lendian_t(stats.m_size, abort);
+			f->read_lendian_t(stats.m_timestamp, abort);
+			std::shared_ptr<amr_frame_index> index = std::make_shared<amr_frame_index>();
+			index->read(f.get_ptr(), abort);
+			set_entry(name, stats, index);
+		}
+	} catch (std::exception const &) {
+		/* damaged or unreadable cache is as good as no cache */
+		m_entries.remove_all();
+		m_bytes = 0;
+	}
+}
+
+void amr_index_cache::preload(const pfc::list_t<pfc::string8> & p_paths, abort_callback & p_abort) {
+	{
+		insync(m_lock);
+		ensure_loaded();
+	}
+	for (t_size i = 0; i < p_paths.get_count(); ++i) {
+		p_abort.check();
+		try {
+			t_filestats stats;
+			bool writable;
+			filesystem::g_get_stats(p_paths[i], stats, writable, p_abort);
+			{
+				insync(m_lock);
+				entry * found = m_entries.query_ptr(p_paths[i]);
+				if (found != NULL && found->m_stats == stats) {
+					found->m_used = ++m_clock;
+					continue;
+				}
+			}
+			std::shared_ptr<amr_frame_index> index = std::make_shared<amr_frame_index>();
+			if (amr_index_sidecar::read(p_paths[i], stats, *index, p_abort)) store(p_paths[i], stats, index);
+		} catch (exception_aborted const &) {
+			throw;
+		} catch (std::exception const &) {
+			/* file gone or unreadable; opening it fails the same way */
+		}
+	}
+}
+
+void amr_index_cache::save(abort_callback & p_abort) {
+	insync(m_lock);
+	if (!m_dirty) return;
+	file::ptr f;
+	filesystem::g_open_write_new(f, core_api::pathInProfile(g_cache_file_name), p_abort);
+	f->write_lendian_t(g_cache_magic, p_abort);
+	f->write_lendian_t(g_cache_version, p_abort);
+	f->write_lendian_t((t_uint32)m_entries.get_count(), p_abort);
+	m_entries.enumerate([&](const pfc::string8 & p_name, const entry & p_entry) {
+		f->write_string(p_name, p_abort);
+		f->write_lendian_t(p_entry.m_stats.m_size, p_abort);
+		f->write_lendian_t(p_entry.m_stats.m_timestamp, p_abort);
+		p_entry.m_index->write(f.get_ptr(), p_abort);
+	});
+	m_dirty = false;
+}
+
+static advconfig_checkbox_factory g_amr_index_warm("AMR decoder: load cached indexes of files in the active playlist right after startup",
+	{ 0x41b8e2c7, 0x5d19, 0x4a63,{ 0x8f, 0x0b, 0xc6, 0x37, 0x92, 0xe4, 0x1a, 0x5d } },
+	advconfig_branch::guid_branch_decoding, 42, true);
+
+enum {
+	/* files of the active playlist warmed up at startup, from the focused one on */
+	amr_warm_max_files = 1000,
+};
+
+/**
+ * Warms the cache up right after startup, for AMR files of the active playlist, from the focused one on,
+ * on a worker of amr_thread_pool at background priority, see preload(), so the playlist shown first is
+ * served from memory; startup itself doesn't wait for it. Nothing is loaded if there are no AMR files there.
+ * Saves the cache when foobar shuts down. Failure to save is not worth bothering the user.
+ */
+class amr_index_cache_initquit : public initquit {
+public:
+	void on_init() {
+		if (!g_amr_index_warm.get()) return;
+		/* playlists are read here, on the main thread */
+		auto playlists = playlist_manager::get();
+		const t_size playlist = playlists->get_active_playlist();
+		if (playlist == pfc_infinite) return;
+		const t_size count = playlists->playlist_get_item_count(playlist);
+		t_size first = playlists->playlist_get_focus_item(playlist);
+		if (first >= count) first = 0;
+		for (t_size i = first; i < count && m_paths.get_count() < amr_warm_max_files; ++i) {
+			const metadb_handle_ptr item = playlists->playlist_get_item_handle(playlist, i);
+			if (stricmp_utf8(pfc::string_extension(item->get_path()), "amr") == 0) m_paths.add_item(item->get_path());
+		}
+		if (m_paths.get_count() == 0) return;
+		amr_thread_pool::get().submit(m_task, [this] {
+			try {
+				amr_index_cache::get().preload(m_paths, m_abort);
+			} catch (std::exception const &) {
+				/* aborted by shutdown */
+			}
+		}, amr_priority_indexing);
+	}
+
+	void on_quit() {
+		m_abort.abort();
+		m_task.cancel();
+		try {
+			abort_callback_dummy abort;
+			amr_index_cache::get().save(abort);
+		} catch (std::exception const &) {}
+	}
+
+private:
+	pfc::list_t<pfc::string8> m_paths;
+	abort_callback_impl m_abort;
+	amr_task m_task;
+};
+
+static initquit_factory_t<amr_index_cache_initquit> g_amr_index_cache_initquit;
@@ -0,0 +1,138 @@
+/**
+ * foo_input_amr - persistent cache of frame indexes
+*/
+#pragma once
+
+#include "amr_index.h"
+
+/**
+ * Remembers frame indexes of scanned files, so reopening unchanged file does not need to walk
+ * all its frames again. Entries are keyed by path and are valid only as long as file size and
+ * timestamp stay the same. The cache is loaded from the profile directory on first use and saved
+ * back on shutdown. Least recently used indexes no input holds are dropped when amr_memory_budget asks
+ * for memory; they're gone from the saved cache too. All methods are thread-safe.
+ *
+ * Indexes are handed out shared, not copied, see amr_frame_index_ptr, so the info reader, the decoder
+ * and the properties dialog foobar opens a file with in quick succession all use the one index of it.
+ * Input that is about to scan a file claims it first, see begin_scan(), so one opening the file while
+ * another scans it waits for that index rather than scanning it as well. Indexes may be shared with other
+ * processes of the user on the computer as well, see amr_index_shared.
+ *
+ * @since   1.2.0
+ */
+class amr_index_cache {
+public:
+	/* the one instance shared by all inputs */
+	static amr_index_cache & get();
+
+	/**
+	 * Looks up index of given file.
+	 *
+	 * @param p_path		path to file
+	 * @param p_stats		current stats of the file
+	 * @return				index cached for file with exactly these stats, or empty pointer
+	 * @since				1.2.0
+	 */
+	amr_frame_index_ptr query(const char * p_path, const t_filestats & p_stats);
+
+	/**
+	 * Looks up index of given file as it was before it grew, as a file a recorder appends to: one cached
+	 * for the file when it was smaller, and not newer than it is now. Whether the file still starts the
+	 * same is for the caller to check.
+	 *
+	 * @param p_path		path to file
+	 * @param p_stats		current stats of the file
+	 * @param p_before		receives stats the file had when it was indexed
+	 * @return				index cached for the file as it was, or empty pointer
+	 * @since				1.2.0
+	 */
+	amr_frame_index_ptr query_grown(const char * p_path, const t_filestats & p_stats, t_filestats & p_before);
+
+	/**
+	 * Stores index of given file, replacing whatever was there before. Files without valid timestamp
+	 * can't be told apart from their modified versions, so they're not cached at all.
+	 *
+	 * @param p_path		path to file
+	 * @param p_stats		stats of the file at the time of the scan
+	 * @param p_index		the index, not to be changed from now on
+	 * @since				1.2.0
+	 */
+	void store(const char * p_path, const t_filestats & p_stats, const amr_frame_index_ptr & p_index);
+
+	/**
+	 * Looks up index of another file with the same frames, as byte-identical copies of a file have. Entries
+	 * of files changed since they were cached still count, their index is of the content they had. Entry
+	 * with a summary is preferred, see amr_frame_index::m_envelope.
+	 *
+	 * @param p_hash		hash of frames of the file, see amr_frame_index::m_hash; 0 never matches
+	 * @param p_frames		number of frames of the file
+	 * @param p_path		receives path of the file found
+	 * @return				its index, or empty pointer if none was found
+	 * @since				1.2.0
+	 */
+	amr_frame_index_ptr query_content(t_uint64 p_hash, unsigned p_frames, pfc::string_base & p_path);
+
+	/**
+	 * Claims scanning of given file, waiting first for the input that claimed it before, if any, to end
+	 * its scan; index it stored is there to query once this returns. Claim lasts until end_scan().
+	 *
+	 * @param p_path		path to file
+	 * @param p_abort		abort callback
+	 * @since				1.2.0
+	 */
+	void begin_scan(const char * p_path, abort_callback & p_abort);
+
+	/* ends scan claimed by begin_scan(), whether it stored the index or failed, and wakes inputs waiting for it */
+	void end_scan(const char * p_path);
+
+	/* forgets index of given file, so the next open has to scan it again */
+	void remove(const char * p_path);
+
+	/**
+	 * Warms the cache up for given files: reads it from the profile directory, if that wasn't done yet,
+	 * marks indexes of the files as used lately, and takes indexes of the ones that aren't cached from their
+	 * sidecars, if there are any. No file is scanned. Lookups made so are not counted, see amr_counters.
+	 *
+	 * @param p_paths		paths to files
+	 * @param p_abort		abort callback
+	 * @since				1.2.0
+	 */
+	void preload(const pfc::list_t<pfc::string8> & p_paths, abort_callback & p_abort);
+
+	/* writes cache to the profile directory, if anything has changed */
+	void save(abort_callback & p_abort);
+
+	/* memory of all indexes cached, for amr_memory_budget; cache not loaded yet takes none */
+	t_size get_memory();
+
+	/* drops least recently used indexes no input holds until p_bytes of them are dropped or there are none left; returns bytes dropped */
+	t_size trim(t_size p_bytes);
+
+private:
+	amr_index_cache() : m_loaded(false), m_dirty(false), m_bytes(0), m_clock(0) {}
+
+	struct entry {
+		entry() : m_memory(0), m_used(0) {}
+		t_filestats m_stats;
+		amr_frame_index_ptr m_index;
+		/* memory of the index, and m_clock when it was stored or looked up last */
+		t_size m_memory;
+		t_uint64 m_used;
+	};
+
+	/* puts index in the cache, replacing whatever was there before; m_lock must be held */
+	void set_entry(const char * p_path, const t_filestats & p_stats, const amr_frame_index_ptr & p_index);
+
+	/* reads cache from the profile directory, unless it was already done; m_lock must be held */
+	void ensure_loaded();
+
+	critical_section m_lock;
+	pfc::map_t<pfc::string8, entry> m_entries;
+	/* files being scanned, and events set once they are */
+	pfc::map_t<pfc::string8, std::shared_ptr<pfc::event> > m_scans;
+	bool m_loaded;
+	bool m_dirty;
+	/* memory of all indexes, and count of lookups and stores, which tells entries used lately */
+	t_size m_bytes;
+	t_uint64 m_clock;
+};
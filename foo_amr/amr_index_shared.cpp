@@ -0,0 +1,217 @@
+/**
+ * foo_input_amr - frame indexes shared in memory by every foobar2000 the user runs on the computer
+*/
+#include "../foo_sdk/foobar2000/SDK/foobar2000.h"
+#include <shlobj.h>
+#include "amr_index_shared.h"
+
+/**
+ * Segment in the local application data folder of the user, which no other user may open. bump version,
+ * whenever layout of the segment or of amr_frame_index::write changes, and the file name with it, so builds of
+ * different versions running at once keep a segment each rather than clearing each other's
+ */
+static const char g_shared_folder[] = "foo_input_amr";
+static const char g_shared_file_name[] = "index-2.shm";
+static const t_uint32 g_shared_magic = 0x53524d41; /* "AMRS" */
+static const t_uint32 g_shared_version = 2;
+
+enum {
+	/* bytes of the segment; an hour of audio has an index of a few kB */
+	amr_shared_size = 64 * 1024 * 1024,
+	/* buckets of the hash table, a power of two */
+	amr_shared_buckets = 64 * 1024,
+	/* index taking more than this share of the segment is not shared */
+	amr_shared_max_share = 16,
+	/* records of a bucket walked at most, should it be read while being cleared */
+	amr_shared_max_chain = 1024,
+};
+
+/* writers lock this byte of the file, past the segment; unlike a named mutex, no other user can take it, and it's let go of should the writer die */
+static const t_uint64 amr_shared_lock_offset = amr_shared_size;
+
+static advconfig_checkbox_factory g_amr_index_shared("AMR decoder: share indexes with your other foobar2000 instances on this computer in shared memory, for terminal servers",
+	{ 0x7a3d51e8, 0x0c64, 0x4b9f,{ 0x86, 0x2e, 0xd1, 0x4b, 0x7f, 0x09, 0xa5, 0x3c } },
+	advconfig_branch::guid_branch_decoding, 43, false);
+
+/* start of the segment, followed by records; all of it is 8-byte aligned */
+struct amr_index_shared::header {
+	t_uint32 m_magic;
+	t_uint32 m_version;
+	t_uint64 m_size;
+	/* odd while the segment is being cleared */
+	volatile LONG64 m_generation;
+	/* bytes of the segment taken, records included */
+	volatile LONG64 m_used;
+	/* offset of the newest record of each bucket, 0 for none */
+	volatile LONG64 m_buckets[amr_shared_buckets];
+};
+
+/* record, followed by the path and the index, padded to 8 bytes */
+struct amr_index_shared::record {
+	/* offset of the record linked to the bucket before it, 0 for none */
+	t_uint64 m_next;
+	t_uint64 m_hash;
+	/* stats of the file */
+	t_uint64 m_size, m_timestamp;
+	t_uint32 m_path_length, m_data_length;
+};
+
+/* FNV-1a hash of the path */
+static t_uint64 amr_shared_hash(const char * p_path) {
+	t_uint64 hash = 0xcbf29ce484222325ull;
+	for (; *p_path != 0; ++p_path) hash = (hash ^ (t_uint8)*p_path) * 0x100000001b3ull;
+	return hash;
+}
+
+/* value another process may change, read before anything read after it */
+static t_uint64 amr_shared_load(const volatile LONG64 & p_value) {
+	const t_uint64 value = (t_uint64)p_value;
+	MemoryBarrier();
+	return value;
+}
+
+amr_index_shared & amr_index_shared::get() {
+	static amr_index_shared instance;
+	return instance;
+}
+
+bool amr_index_shared::is_enabled() {
+	return g_amr_index_shared.get();
+}
+
+amr_index_shared::~amr_index_shared() {
+	if (m_view != NULL) UnmapViewOfFile(m_view);
+	if (m_mapping != NULL) CloseHandle(m_mapping);
+	if (m_file != INVALID_HANDLE_VALUE) CloseHandle(m_file);
+}
+
+bool amr_index_shared::ensure_open() {
+	insync(m_lock);
+	if (m_opened) return m_view != NULL;
+	m_opened = true;
+	wchar_t folder[MAX_PATH];
+	if (SUCCEEDED(SHGetFolderPathW(NULL, CSIDL_LOCAL_APPDATA, NULL, SHGFP_TYPE_CURRENT, folder))) {
+		pfc::string8 path = pfc::stringcvt::string_utf8_from_os(folder).get_ptr();
+		path << "\\" << g_shared_folder;
+		/* folder and segment inherit access of the user's folder, so they're the user's alone */
+		CreateDirectoryW(pfc::stringcvt::string_os_from_utf8(path), NULL);
+		path << "\\" << g_shared_file_name;
+		const pfc::stringcvt::string_os_from_utf8 name(path);
+		m_file = CreateFileW(name, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, OPEN_ALWAYS, FILE_ATTRIBUTE_NOT_CONTENT_INDEXED, NULL);
+		m_writable = m_file != INVALID_HANDLE_VALUE;
+		/* segment the user made read only: it's only read */
+		if (m_file == INVALID_HANDLE_VALUE) m_file = CreateFileW(name, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, OPEN_EXISTING, 0, NULL);
+	}
+	if (m_file == INVALID_HANDLE_VALUE) return false;
+
+	if (m_writable) {
+		m_mapping = CreateFileMappingW(m_file, NULL, PAGE_READWRITE, 0, amr_shared_size, NULL);
+		if (m_mapping != NULL) m_view = (t_uint8 *)MapViewOfFile(m_mapping, FILE_MAP_READ | FILE_MAP_WRITE, 0, 0, amr_shared_size);
+		m_size = amr_shared_size;
+	}
+	else {
+		LARGE_INTEGER size;
+		if (!GetFileSizeEx(m_file, &size) || size.QuadPart < (LONGLONG)sizeof(header)) return false;
+		m_size = (t_size)pfc::min_t<LONGLONG>(size.QuadPart, amr_shared_size);
+		m_mapping = CreateFileMappingW(m_file, NULL, PAGE_READONLY, 0, 0, NULL);
+		if (m_mapping != NULL) m_view = (t_uint8 *)MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, m_size);
+	}
+	return m_view != NULL;
+}
+
+bool amr_index_shared::get_record(t_uint64 p_offset, t_uint64 p_limit, record & p_out) const {
+	if (p_offset < sizeof(header) || p_offset % 8 != 0 || p_offset + sizeof(record) > p_limit) return false;
+	memcpy(&p_out, m_view + p_offset, sizeof(record));
+	return p_offset + sizeof(record) + p_out.m_path_length + p_out.m_data_length <= p_limit;
+}
+
+bool amr_index_shared::read(const char * p_path, const t_filestats & p_stats, amr_frame_index & p_out) {
+	if (p_stats.m_timestamp == filetimestamp_invalid || !ensure_open()) return false;
+	const header * h = (const header *)m_view;
+	if (h->m_magic != g_shared_magic || h->m_version != g_shared_version) return false;
+	const t_uint64 generation = amr_shared_load(h->m_generation);
+	if ((generation & 1) != 0) return false;
+	const t_uint64 limit = pfc::min_t<t_uint64>(amr_shared_load(h->m_used), m_size);
+	const t_uint64 hash = amr_shared_hash(p_path);
+	const t_size length = strlen(p_path);
+
+	pfc::array_t<t_uint8> data;
+	bool found = false;
+	t_uint64 offset = amr_shared_load(h->m_buckets[hash & (amr_shared_buckets - 1)]);
+	for (unsigned i = 0; offset != 0 && i < amr_shared_max_chain; ++i) {
+		record r;
+		if (!get_record(offset, limit, r)) return false;
+		const t_uint8 * path = m_view + offset + sizeof(record);
+		if (r.m_hash == hash && r.m_path_length == length && r.m_size == p_stats.m_size && r.m_timestamp == p_stats.m_timestamp && memcmp(path, p_path, length) == 0) {
+			data.set_data_fromptr(path + length, r.m_data_length);
+			found = true;
+			break;
+		}
+		offset = r.m_next;
+	}
+	/* segment was cleared meanwhile, so what was read may be of another record */
+	MemoryBarrier();
+	if (!found || amr_shared_load(h->m_generation) != generation) return false;
+
+	try {
+		abort_callback_dummy abort;
+		stream_reader_memblock_ref reader(data.get_ptr(), data.get_size());
+		amr_frame_index index;
+		index.read(&reader, abort);
+		if (reader.get_remaining() != 0) return false;
+		p_out = index;
+		return true;
+	} catch (std::exception const &) {
+		return false;
+	}
+}
+
+void amr_index_shared::clear(header * p_header) {
+	/* writer that died clearing it left the generation odd */
+	if ((p_header->m_generation & 1) == 0) InterlockedIncrement64(&p_header->m_generation);
+	for (unsigned i = 0; i < amr_shared_buckets; ++i) p_header->m_buckets[i] = 0;
+	p_header->m_used = sizeof(header);
+	p_header->m_size = m_size;
+	p_header->m_version = g_shared_version;
+	MemoryBarrier();
+	p_header->m_magic = g_shared_magic;
+	InterlockedIncrement64(&p_header->m_generation);
+}
+
+void amr_index_shared::write(const char * p_path, const t_filestats & p_stats, const amr_frame_index & p_index) {
+	if (p_stats.m_timestamp == filetimestamp_invalid || !ensure_open() || !m_writable) return;
+	stream_writer_buffer_simple buffer;
+	abort_callback_dummy abort;
+	p_index.write(&buffer, abort);
+	const t_size length = strlen(p_path);
+	const t_uint64 bytes = (sizeof(record) + length + buffer.m_buffer.get_size() + 7) & ~(t_uint64)7;
+	if (bytes > (m_size - sizeof(header)) / amr_shared_max_share) return;
+
+	OVERLAPPED lock = {};
+	lock.Offset = (DWORD)amr_shared_lock_offset;
+	lock.OffsetHigh = (DWORD)(amr_shared_lock_offset >> 32);
+	if (!LockFileEx(m_file, LOCKFILE_EXCLUSIVE_LOCK, 0, 1, 0, &lock)) return;
+	header * h = (header *)m_view;
+	const bool ours = h->m_magic == g_shared_magic && h->m_version == g_shared_version;
+	/* new segment, one of another version or layout, one a writer died clearing, or one that's full */
+	if (!ours || (h->m_generation & 1) != 0 || (t_uint64)h->m_used + bytes > m_size) clear(h);
+	if (h->m_magic == g_shared_magic && h->m_version == g_shared_version) {
+		const t_uint64 offset = (t_uint64)h->m_used;
+		const t_uint64 hash = amr_shared_hash(p_path);
+		volatile LONG64 & bucket = h->m_buckets[hash & (amr_shared_buckets - 1)];
+		record * r = (record *)(m_view + offset);
+		r->m_next = (t_uint64)bucket;
+		r->m_hash = hash;
+		r->m_size = p_stats.m_size;
+		r->m_timestamp = p_stats.m_timestamp;
+		r->m_path_length = (t_uint32)length;
+		r->m_data_length = (t_uint32)buffer.m_buffer.get_size();
+		memcpy(r + 1, p_path, length);
+		memcpy((t_uint8 *)(r + 1) + length, buffer.m_buffer.get_ptr(), buffer.m_buffer.get_size());
+		/* record is whole before readers can get to it */
+		MemoryBarrier();
+		h->m_used = (LONG64)(offset + bytes);
+		InterlockedExchange64(&bucket, (LONG64)offset);
+	}
+	UnlockFileEx(m_file, 0, 1, 0, &lock);
+}
@@ -0,0 +1,79 @@
+/**
+ * foo_input_amr - frame indexes shared in memory by every foobar2000 the user runs on the computer
+*/
+#pragma once
+
+#include "amr_index.h"
+
+/**
+ * Keeps frame indexes in memory shared by every foobar2000 a user runs on the computer, so of the user's
+ * sessions of a terminal server browsing the same archive only the first one to open a file scans it;
+ * amr_index_cache takes indexes it doesn't have from here, and puts the ones it stores here too. Named
+ * section of the global namespace can't be created by users of a terminal server, so the segment is a file
+ * in the local application data folder of the user that every process of the user maps, which shares its
+ * pages just the same. Other users can't open it: paths in it are the user's own, and indexes seeking trusts
+ * can't be planted by anyone else.
+ *
+ * Segment is a hash table of paths and an area records are appended to, each with path, size and timestamp
+ * of the file, and its index, serialized. Records are never changed once they're linked to their bucket,
+ * newest first, so a newer version of a file is found before the older ones. Lookups take no lock: they
+ * walk the chain of the bucket and copy the record out, and the record counts only if the generation of the
+ * segment is still the one they started with. Writers are serialized by a lock on the file; the one that finds
+ * the area full clears the segment, moving the generation on before and after.
+ *
+ * @since   1.2.0
+ */
+class amr_index_shared {
+public:
+	/* the one mapping of the segment in the process */
+	static amr_index_shared & get();
+
+	/* "share indexes with other foobar2000 instances in shared memory" preference */
+	static bool is_enabled();
+
+	/**
+	 * Looks up index of given file, without locking.
+	 *
+	 * @param p_path		path to file
+	 * @param p_stats		current stats of the file
+	 * @param p_out			receives the index, if there is one
+	 * @return				<code>true</code> if there's one of the file with exactly these stats
+	 * @since				1.2.0
+	 */
+	bool read(const char * p_path, const t_filestats & p_stats, amr_frame_index & p_out);
+
+	/**
+	 * Puts index of given file in the segment, unless it can only be read, or the index takes more than
+	 * a share of it. Failures are ignored, the index is cached by the process anyway.
+	 *
+	 * @param p_path		path to file
+	 * @param p_stats		stats of the file at the time of the scan
+	 * @param p_index		the index
+	 * @since				1.2.0
+	 */
+	void write(const char * p_path, const t_filestats & p_stats, const amr_frame_index & p_index);
+
+private:
+	struct header;
+	struct record;
+
+	amr_index_shared() : m_file(INVALID_HANDLE_VALUE), m_mapping(NULL), m_view(NULL), m_size(0), m_opened(false), m_writable(false) {}
+	~amr_index_shared();
+
+	/* maps the segment, unless it was already tried; false if it's not there to use */
+	bool ensure_open();
+
+	/* copies header of the record at p_offset, if the record lies within p_limit bytes of the segment */
+	bool get_record(t_uint64 p_offset, t_uint64 p_limit, record & p_out) const;
+
+	/* sets header and table up, or clears them once the area is full; the lock on the file must be held */
+	void clear(header * p_header);
+
+	critical_section m_lock;
+	HANDLE m_file, m_mapping;
+	t_uint8 * m_view;
+	t_size m_size;
+	bool m_opened;
+	/* segment was mapped for writing, which it's not if the user made it read only */
+	bool m_writable;
+};
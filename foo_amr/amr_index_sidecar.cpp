@@ -0,0 +1,74 @@
+/**
+ * foo_input_amr - frame indexes shared in files next to the AMR files
+*/
+#include "../foo_sdk/foobar2000/SDK/foobar2000.h"
+#include "amr_index_sidecar.h"
+
+/* sidecar of "file.amr" is "file.amr.idx". bump version, whenever layout of amr_frame_index::write changes */
+static const char g_sidecar_extension[] = ".idx";
+static const t_uint32 g_sidecar_magic = 0x49524d41; /* "AMRI" */
+static const t_uint32 g_sidecar_version = 7;
+/* anything larger is not a sidecar; an hour of audio has an index of a few kB */
+static const t_filesize g_sidecar_max_size = 16 * 1024 * 1024;
+
+static advconfig_checkbox_factory g_amr_sidecar("AMR decoder: share indexes of files with other computers in sidecar .idx files next to them",
+	{ 0x0c6e93b5, 0x47d2, 0x4a18,{ 0x9b, 0x5f, 0xe1, 0x26, 0x83, 0x7a, 0xd4, 0x0f } },
+	advconfig_branch::guid_branch_decoding, 12, false);
+
+bool amr_index_sidecar::is_enabled() {
+	return g_amr_sidecar.get();
+}
+
+bool amr_index_sidecar::read(const char * p_path, const t_filestats & p_stats, amr_frame_index & p_out, abort_callback & p_abort) {
+	if (!is_enabled() || p_stats.m_timestamp == filetimestamp_invalid) return false;
+	pfc::string8 path = p_path;
+	path.add_string(g_sidecar_extension);
+	try {
+		if (!filesystem::g_exists(path, p_abort)) return false;
+		file::ptr f;
+		filesystem::g_open_read(f, path, p_abort);
+		const t_filesize size = f->get_size(p_abort);
+		if (size == filesize_invalid || size > g_sidecar_max_size) return false;
+		pfc::array_t<t_uint8> data;
+		data.set_size((t_size)size);
+		f->read_object(data.get_ptr(), data.get_size(), p_abort);
+
+		stream_reader_memblock_ref reader(data.get_ptr(), data.get_size());
+		t_uint32 magic, version;
+		t_filestats stats;
+		reader.read_lendian_t(magic, p_abort);
+		reader.read_lendian_t(version, p_abort);
+		if (magic != g_sidecar_magic || version != g_sidecar_version) return false;
+		reader.read_lendian_t(stats.m_size, p_abort);
+		reader.read_lendian_t(stats.m_timestamp, p_abort);
+		if (stats != p_stats) return false;
+		amr_frame_index index;
+		index.read(&reader, p_abort);
+		/* sidecar being written by another computer right now may be cut short, or have something left over */
+		if (reader.get_remaining() != 0) return false;
+		p_out = index;
+		return true;
+	} catch (const exception_aborted &) {
+		throw;
+	} catch (std::exception const &) {
+		/* damaged or unreadable sidecar is as good as none */
+		return false;
+	}
+}
+
+void amr_index_sidecar::write(const char * p_path, const t_filestats & p_stats, const amr_frame_index & p_index, abort_callback & p_abort) {
+	if (!is_enabled() || p_stats.m_timestamp == filetimestamp_invalid) return;
+	/* made in memory first, so the sidecar is written with one call, and readers elsewhere are unlikely to see half of it */
+	stream_writer_buffer_simple buffer;
+	buffer.write_lendian_t(g_sidecar_magic, p_abort);
+	buffer.write_lendian_t(g_sidecar_version, p_abort);
+	buffer.write_lendian_t(p_stats.m_size, p_abort);
+	buffer.write_lendian_t(p_stats.m_timestamp, p_abort);
+	p_index.write(&buffer, p_abort);
+
+	pfc::string8 path = p_path;
+	path.add_string(g_sidecar_extension);
+	file::ptr f;
+	filesystem::g_open_write_new(f, path, p_abort);
+	f->write_object(buffer.m_buffer.get_ptr(), buffer.m_buffer.get_size(), p_abort);
+}
@@ -0,0 +1,46 @@
+/**
+ * foo_input_amr - frame indexes shared in files next to the AMR files
+*/
+#pragma once
+
+#include "amr_index.h"
+
+/**
+ * Keeps frame index of a file in "file.amr.idx" next to it, so every computer reading the same archive
+ * over network does not have to scan each file on its own: the first one to scan it writes the sidecar,
+ * the others read it, and cache it as their own, see amr_index_cache. Sidecar holds size and timestamp
+ * of the file it was made of, and is ignored once they change. It's read and written with one call each,
+ * being small; sidecars that can't be written, as on read-only shares, are simply not there.
+ *
+ * @since   1.2.0
+ */
+class amr_index_sidecar {
+public:
+	/* "share indexes in sidecar files" preference */
+	static bool is_enabled();
+
+	/**
+	 * Reads index of given file from its sidecar.
+	 *
+	 * @param p_path		path to file
+	 * @param p_stats		current stats of the file
+	 * @param p_out			receives the index, if there is one
+	 * @param p_abort		abort callback
+	 * @return				<code>true</code> if sidecars are enabled, and there is one made of the file with exactly these stats
+	 * @throws				exception_aborted if aborted; anything else is taken for no sidecar
+	 * @since				1.2.0
+	 */
+	static bool read(const char * p_path, const t_filestats & p_stats, amr_frame_index & p_out, abort_callback & p_abort);
+
+	/**
+	 * Writes index of given file to its sidecar, if sidecars are enabled; failure is only logged by the caller.
+	 *
+	 * @param p_path		path to file
+	 * @param p_stats		stats of the file at the time of the scan
+	 * @param p_index		the index
+	 * @param p_abort		abort callback
+	 * @throws				whatever writing throws
+	 * @since				1.2.0
+	 */
+	static void write(const char * p_path, const t_filestats & p_stats, const amr_frame_index & p_index, abort_callback & p_abort);
+};
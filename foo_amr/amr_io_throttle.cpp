@@ -0,0 +1,81 @@
+/**
+ * foo_input_amr - background indexing slowed down while playback reads are slow
+*/
+#include "../foo_sdk/foobar2000/SDK/foobar2000.h"
+#include <chrono>
+#include "amr_io_throttle.h"
+
+enum {
+	/* first wait of background reads once playback reads got slow, and longest one, in ms */
+	amr_throttle_min_delay_ms = 10,
+	amr_throttle_max_delay_ms = 500,
+	/* playback reads older than this don't count, 2 seconds; playback stopped or is served from memory */
+	amr_throttle_idle_ms = 2000,
+	/* most that can be set, in ms */
+	amr_throttle_max_latency_ms = 1000,
+};
+
+/* weight of the latest playback read in the moving average */
+static const double g_throttle_weight = 0.25;
+
+static advconfig_integer_factory g_amr_throttle_latency("AMR decoder: playback read latency above which background indexing slows down, in ms, 0 not to slow it down",
+	{ 0x8e31d5a2, 0x46bf, 0x4c07,{ 0xb3, 0x9a, 0x5f, 0x20, 0xd7, 0x6c, 0x1e, 0x84 } },
+	advconfig_branch::guid_branch_decoding, 38, 30, 0, amr_throttle_max_latency_ms);
+
+static thread_local bool g_throttle_background = false;
+
+static t_uint64 amr_throttle_now_ms() {
+	return (t_uint64)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+amr_io_throttle::background_scope::background_scope() {
+	g_throttle_background = true;
+	/* lowers I/O and memory priority along with CPU priority; fails if the thread is in background mode already */
+	m_mode = SetThreadPriority(GetCurrentThread(), THREAD_MODE_BACKGROUND_BEGIN) != FALSE;
+}
+
+amr_io_throttle::background_scope::~background_scope() {
+	if (m_mode) SetThreadPriority(GetCurrentThread(), THREAD_MODE_BACKGROUND_END);
+	g_throttle_background = false;
+}
+
+amr_io_throttle & amr_io_throttle::get() {
+	static amr_io_throttle instance;
+	return instance;
+}
+
+bool amr_io_throttle::is_background_thread() {
+	return g_throttle_background;
+}
+
+void amr_io_throttle::on_playback_read(double p_seconds) {
+	const t_uint64 now = amr_throttle_now_ms();
+	insync(m_lock);
+	/* after a pause, the average starts over rather than from reads long gone */
+	m_latency = recent_latency(now) == 0 ? p_seconds : m_latency + (p_seconds - m_latency) * g_throttle_weight;
+	m_last_read = now;
+}
+
+double amr_io_throttle::recent_latency(t_uint64 p_now) const {
+	return m_last_read != 0 && p_now - m_last_read < amr_throttle_idle_ms ? m_latency : 0;
+}
+
+bool amr_io_throttle::is_congested() {
+	const t_uint64 limit = g_amr_throttle_latency.get();
+	if (limit == 0) return false;
+	const t_uint64 now = amr_throttle_now_ms();
+	insync(m_lock);
+	return recent_latency(now) * 1000 > limit;
+}
+
+void amr_io_throttle::wait(abort_callback & p_abort) {
+	unsigned delay;
+	{
+		const bool congested = is_congested();
+		insync(m_lock);
+		if (congested) m_delay = m_delay == 0 ? amr_throttle_min_delay_ms : pfc::min_t<unsigned>(m_delay * 2, amr_throttle_max_delay_ms);
+		else m_delay = m_delay / 2 < amr_throttle_min_delay_ms ? 0 : m_delay / 2;
+		delay = m_delay;
+	}
+	if (delay > 0) p_abort.sleep(delay / 1000.0);
+}
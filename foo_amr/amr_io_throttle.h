@@ -0,0 +1,64 @@
+/**
+ * foo_input_amr - background indexing slowed down while playback reads are slow
+*/
+#pragma once
+
+/**
+ * Keeps indexing ahead of need, as pre-indexing, indexing of the next track and indexing in idle time,
+ * from starving playback of disk time on a disk both use. Latency of blocks read for playback is averaged;
+ * while it's above what's set in preferences, background reads wait before each block, twice as long as
+ * before the last one up to amr_throttle_max_delay_ms, and once it's back under, wait half as long each
+ * time until they don't wait at all. With no playback reads for a while, background reads go at full speed.
+ *
+ * Workers of amr_thread_pool run indexing tasks as background threads, see background_scope; on Windows
+ * their I/O then goes at low priority too.
+ *
+ * @since   1.2.0
+ */
+class amr_io_throttle {
+public:
+	/* marks the current thread as doing background work for as long as it lives, with Windows background mode on */
+	class background_scope {
+	public:
+		background_scope();
+		~background_scope();
+	private:
+		background_scope(const background_scope &);
+		background_scope & operator=(const background_scope &);
+		bool m_mode;
+	};
+
+	/* the one instance shared by all readers */
+	static amr_io_throttle & get();
+
+	/* current thread is in a background_scope */
+	static bool is_background_thread();
+
+	/* a block read for playback took so many seconds */
+	void on_playback_read(double p_seconds);
+
+	/* playback reads were slower than set in preferences lately, so background work should wait */
+	bool is_congested();
+
+	/**
+	 * Waits as long as background reads have to before the next block, see class description.
+	 *
+	 * @param p_abort		abort callback
+	 * @throws				exception_aborted if aborted while waiting
+	 * @since				1.2.0
+	 */
+	void wait(abort_callback & p_abort);
+
+private:
+	amr_io_throttle() : m_latency(0), m_last_read(0), m_delay(0) {}
+
+	/* m_latency, unless there were no playback reads for a while; m_lock must be held */
+	double recent_latency(t_uint64 p_now) const;
+
+	critical_section m_lock;
+	/* moving average of playback read latency in seconds, and when the last such read was, in ms of steady clock */
+	double m_latency;
+	t_uint64 m_last_read;
+	/* what background reads wait now, in ms */
+	unsigned m_delay;
+};
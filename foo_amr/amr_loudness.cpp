@@ -0,0 +1,57 @@
+/**
+ * foo_input_amr - loudness and silence estimated from frame parameters, without decoding
+*/
+#include "../foo_sdk/foobar2000/SDK/foobar2000.h"
+extern "C" {
+	#include "../3gpp/interf_dec.h"
+}
+#include <math.h>
+#include "amr_loudness.h"
+
+/* frames with less power than -60 dB of full scale count as silent */
+static const double amr_loudness_silence_level = 1e-6;
+
+static advconfig_checkbox_factory g_amr_loudness("AMR decoder: estimate loudness and silence when indexing, shown in file properties",
+	{ 0x7d2c4f18, 0xa6e3, 0x4b95,{ 0x8c, 0x41, 0x0f, 0xb7, 0x5a, 0xe2, 0x93, 0x6d } },
+	advconfig_branch::guid_branch_decoding, 10, false);
+
+bool amr_loudness::is_enabled() {
+	return g_amr_loudness.get();
+}
+
+void amr_loudness::start(unsigned p_channels) {
+	for (unsigned i = 0; i < p_channels; ++i) m_decoders[i].acquire();
+	m_channels = p_channels;
+	m_sum = 0;
+	m_estimated = 0;
+	m_silent = 0;
+}
+
+void amr_loudness::add(const t_uint8 * p_frame, const short * p_block_size) {
+	for (unsigned c = 0; c < m_channels; ++c) {
+		const int size = 1 + p_block_size[(p_frame[0] >> 3) & 0x0F];
+		float energy;
+		Decoder_Interface_EstimateN(m_decoders[c].get(), const_cast<t_uint8*>(p_frame), size, &energy, 1, NULL);
+		if (energy < amr_loudness_silence_level) ++m_silent;
+		else {
+			m_sum += energy;
+			++m_estimated;
+		}
+		p_frame += size;
+	}
+}
+
+void amr_loudness::finish(amr_frame_index & p_index) {
+	if (!is_active()) return;
+	/* hundredths of dB; all silent file has no level, and is at the lowest one there is */
+	p_index.m_level = m_estimated > 0 ? (t_int32)floor(1000.0 * log10(m_sum / m_estimated) + 0.5) : amr_level_silent;
+	p_index.m_level_frames = m_estimated + m_silent;
+	p_index.m_silent = m_silent;
+	stop();
+}
+
+void amr_loudness::stop() {
+	/* decoders are left fit for estimates only; the pool resets them */
+	for (unsigned i = 0; i < m_channels; ++i) m_decoders[i].release();
+	m_channels = 0;
+}
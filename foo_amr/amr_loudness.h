@@ -0,0 +1,63 @@
+/**
+ * foo_input_amr - loudness and silence estimated from frame parameters, without decoding
+*/
+#pragma once
+
+#include "amr_decoder_pool.h"
+#include "amr_index.h"
+
+enum {
+	/* multichannel files have up to 6 channels */
+	amr_loudness_max_channels = 6,
+};
+
+/**
+ * Estimates level of a file while its frames are walked for the index, from codebook and pitch gains and
+ * LPC filters of the frames, see <code>Decoder_Interface_EstimateN</code>, an order of magnitude faster
+ * than decoding them. Level is the mean power of frames that are not silent, within a dB or two of what
+ * decoding gives; DTX frames, damaged ones and frames quieter than amr_loudness_silence_level count as
+ * silence. Each channel has a decoder of its own, taken only for the walk and given back reset.
+ *
+ * @since   1.2.0
+ */
+class amr_loudness {
+public:
+	amr_loudness() : m_channels(0), m_sum(0), m_estimated(0), m_silent(0) {}
+
+	/* "estimate loudness when indexing" preference */
+	static bool is_enabled();
+
+	/**
+	 * Gets ready to estimate frames from the first one on.
+	 *
+	 * @param p_channels	number of channels
+	 * @throws				std::bad_alloc if decoders can't be created
+	 * @since				1.2.0
+	 */
+	void start(unsigned p_channels);
+
+	/**
+	 * Estimates the next frame.
+	 *
+	 * @param p_frame		frames of all channels, one after another, whole
+	 * @param p_block_size	payload sizes indexed by frame type
+	 * @since				1.2.0
+	 */
+	void add(const t_uint8 * p_frame, const short * p_block_size);
+
+	/* puts level and silence of the frames added into p_index, and gives decoders back */
+	void finish(amr_frame_index & p_index);
+
+	/* gives decoders back without results */
+	void stop();
+
+	/* start() was called, and neither finish() nor stop() since */
+	bool is_active() const { return m_channels > 0; }
+
+private:
+	amr_decoder m_decoders[amr_loudness_max_channels];
+	unsigned m_channels;
+	/* total power of frames that are not silent, their number, and number of silent ones */
+	double m_sum;
+	unsigned m_estimated, m_silent;
+};
@@ -0,0 +1,120 @@
+/**
+ * foo_input_amr - one ceiling for memory of all caches shared by inputs
+*/
+#include "../foo_sdk/foobar2000/SDK/foobar2000.h"
+#include <chrono>
+#include "amr_memory_budget.h"
+#include "amr_decoder_pool.h"
+#include "amr_index.h"
+#include "amr_index_cache.h"
+#include "amr_pcm_cache.h"
+#include "amr_tuning.h"
+
+enum {
+	/* use is written to the console this often at most, as memory is dropped, 1 minute */
+	amr_budget_report_ms = 60 * 1000,
+	/* limit of low memory profile, in MB, unless a lower one is set */
+	amr_budget_low_memory_megabytes = 64,
+	/* most that can be set, in MB */
+	amr_budget_max_megabytes = 64 * 1024,
+};
+
+static advconfig_integer_factory g_amr_budget("AMR decoder: memory for caches of all files together, in MB, 0 for no limit",
+	{ 0x4d7a2e19, 0xc05b, 0x4f83,{ 0x9a, 0x6e, 0x12, 0xb8, 0x3d, 0xf4, 0x70, 0xc5 } },
+	advconfig_branch::guid_branch_decoding, 33, 0, 0, amr_budget_max_megabytes);
+
+/* a cache under the budget: what it holds, and how it drops at least so many bytes, returning how many it did */
+struct amr_budget_cache {
+	const char * m_name;
+	t_size (*m_get_memory)();
+	t_size (*m_trim)(t_size p_bytes);
+};
+
+/* cheapest to fill again first */
+static const amr_budget_cache g_budget_caches[] = {
+	{ "idle decoders", [] { return amr_decoder_pool::get().get_memory(); }, [](t_size p_bytes) { return amr_decoder_pool::get().trim(p_bytes); } },
+	{ "decoded audio", [] { return amr_pcm_cache::get().get_memory(); }, [](t_size p_bytes) { return amr_pcm_cache::get().trim(p_bytes); } },
+	{ "frame indexes", [] { return amr_index_cache::get().get_memory(); }, [](t_size p_bytes) { return amr_index_cache::get().trim(p_bytes); } },
+};
+
+static_assert(PFC_TABSIZE(g_budget_caches) == amr_budget_caches, "amr_budget_caches is the number of caches");
+
+static t_uint64 amr_budget_now_ms() {
+	return (t_uint64)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+amr_memory_budget::amr_memory_budget() : m_peak(0), m_reported(0) {
+	for (t_size i = 0; i < PFC_TABSIZE(m_dropped); ++i) m_dropped[i] = 0;
+}
+
+amr_memory_budget & amr_memory_budget::get() {
+	static amr_memory_budget instance;
+	return instance;
+}
+
+t_size amr_memory_budget::get_limit() {
+	const t_uint64 custom = pfc::min_t<t_uint64>(g_amr_budget.get(), amr_budget_max_megabytes);
+	const t_uint64 low_memory = custom == 0 ? amr_budget_low_memory_megabytes : pfc::min_t<t_uint64>(custom, amr_budget_low_memory_megabytes);
+	return (t_size)amr_tuned<t_uint64>(custom, custom, custom, low_memory) << 20;
+}
+
+void amr_memory_budget::enforce() {
+	const t_size limit = get_limit();
+	bool dropped = false;
+	{
+		insync(m_lock);
+		t_size memory[PFC_TABSIZE(g_budget_caches)];
+		t_size total = 0;
+		for (t_size i = 0; i < PFC_TABSIZE(g_budget_caches); ++i) total += memory[i] = g_budget_caches[i].m_get_memory();
+		m_peak = pfc::max_t(m_peak, total);
+		if (limit == 0 || total <= limit) return;
+		for (t_size i = 0; i < PFC_TABSIZE(g_budget_caches) && total > limit; ++i) {
+			if (memory[i] == 0) continue;
+			const t_size freed = g_budget_caches[i].m_trim(total - limit);
+			m_dropped[i] += freed;
+			total -= pfc::min_t(freed, total);
+			dropped = dropped || freed > 0;
+		}
+		const t_uint64 now = amr_budget_now_ms();
+		if (!dropped || (m_reported != 0 && now - m_reported < amr_budget_report_ms)) return;
+		m_reported = now;
+	}
+	report();
+}
+
+t_size amr_memory_budget::get_memory() {
+	t_size total = 0;
+	for (t_size i = 0; i < PFC_TABSIZE(g_budget_caches); ++i) total += g_budget_caches[i].m_get_memory();
+	return total;
+}
+
+void amr_memory_budget::report() {
+	const t_size limit = get_limit();
+	pfc::string_formatter out;
+	t_size total = 0;
+	{
+		insync(m_lock);
+		for (t_size i = 0; i < PFC_TABSIZE(g_budget_caches); ++i) {
+			const t_size memory = g_budget_caches[i].m_get_memory();
+			total += memory;
+			out << ", " << g_budget_caches[i].m_name << " " << pfc::format_file_size_short(memory) << " (" << pfc::format_file_size_short(m_dropped[i]) << " dropped)";
+		}
+		m_peak = pfc::max_t(m_peak, total);
+		out << ", most " << pfc::format_file_size_short(m_peak);
+	}
+	console::formatter status;
+	status << "AMR memory: " << pfc::format_file_size_short(total);
+	if (limit == 0) status << ", no limit";
+	else status << " of " << pfc::format_file_size_short(limit);
+	status << out;
+}
+
+/**
+ * Writes use of the caches to the console on shutdown, before they are freed.
+ */
+class amr_memory_budget_initquit : public initquit {
+public:
+	void on_quit() { amr_memory_budget::get().report(); }
+};
+
+static initquit_factory_t<amr_memory_budget_initquit> g_amr_memory_budget_initquit;
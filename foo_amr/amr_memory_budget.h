@@ -0,0 +1,55 @@
+/**
+ * foo_input_amr - one ceiling for memory of all caches shared by inputs
+*/
+#pragma once
+
+enum {
+	/* caches kept under the budget */
+	amr_budget_caches = 3,
+};
+
+/**
+ * Keeps memory of the caches inputs share, idle decoders, decoded audio and frame indexes, under one
+ * limit set in preferences, so many foobar sessions on one machine each stay within what's given to them.
+ * A cache that grew asks for the limit to be enforced; if all of them together are over it, the ones
+ * cheapest to fill again drop memory first, least recently used first within each: an idle decoder is
+ * just allocated again, decoded audio is decoded again, and a dropped index takes walking the whole file
+ * again, unless its sidecar has it. Use of each cache goes to the console whenever memory was dropped,
+ * once a minute at most, and on shutdown. All methods are thread-safe.
+ *
+ * Checkpoints and other memory of an input are not caches; they live as long as the input does.
+ *
+ * @since   1.2.0
+ */
+class amr_memory_budget {
+public:
+	/* the one instance shared by all caches */
+	static amr_memory_budget & get();
+
+	/* limit in bytes, as set in preferences, 0 for none */
+	static t_size get_limit();
+
+	/**
+	 * Drops memory of caches, cheapest to fill again first, until all of them together are within the limit.
+	 * Called by a cache after it grew, with none of its locks held, as dropping takes them.
+	 *
+	 * @since				1.2.0
+	 */
+	void enforce();
+
+	/* memory all caches hold together, as enforce() counts it */
+	t_size get_memory();
+
+	/* writes memory of each cache, and what was dropped of it, to the console */
+	void report();
+
+private:
+	amr_memory_budget();
+
+	critical_section m_lock;
+	/* most all caches held together, and bytes dropped of each */
+	t_size m_peak;
+	t_uint64 m_dropped[amr_budget_caches];
+	/* when use was written to the console last, in ms of steady clock */
+	t_uint64 m_reported;
+};
@@ -0,0 +1,504 @@
+/**
+ * foo_input_amr - packs of many short AMR files in one file, with a directory of them
+*/
+#include "../foo_sdk/foobar2000/SDK/foobar2000.h"
+#include "../foo_sdk/foobar2000/helpers/readers.h"
+extern "C" {
+	#include "../3gpp/interf_dec.h"
+}
+#include <algorithm>
+#include <memory>
+#include <vector>
+#include "amr_frame_reader.h"
+#include "amr_index.h"
+
+enum {
+	/* magic, version, number of clips, bytes of their names, offset of the directory */
+	amr_pack_header_size = 32,
+	/* offset, size, frames, hash, name offset and length, header size and channels of a clip */
+	amr_pack_entry_size = 32,
+	/* directories of the packs opened last kept in memory, so opening a clip reads only the clip */
+	amr_pack_cached_directories = 4,
+	/* file bigger than this is not packed; packs are for clips of seconds, and an hour of 12.2 kbit/s is 5.5 MB */
+	amr_pack_max_clip_size = 16 * 1024 * 1024,
+	amr_pack_max_name_length = 0xFFFF,
+	/* as in input_amr */
+	amr_pack_max_channels = 6,
+	amr_pack_magic_size = 6,
+	amr_pack_mc_magic_size = 12,
+	amr_pack_mc_header_size = amr_pack_mc_magic_size + 4,
+};
+
+static const char g_pack_magic[] = "#!AMRPACK\n";
+static const t_uint32 g_pack_version = 1;
+static const char g_pack_extension[] = "amrpack";
+static const char g_pack_amr_magic[] = "#!AMR\n";
+static const char g_pack_amr_mc_magic[] = "#!AMR_MC1.0\n";
+
+/* little-endian p_bytes of p_value */
+static void amr_pack_put(t_uint8 * p_out, t_uint64 p_value, unsigned p_bytes) {
+	for (unsigned i = 0; i < p_bytes; ++i) p_out[i] = (t_uint8)(p_value >> (8 * i));
+}
+
+/* value stored by amr_pack_put() */
+static t_uint64 amr_pack_get(const t_uint8 * p_in, unsigned p_bytes) {
+	t_uint64 value = 0;
+	for (unsigned i = p_bytes; i-- > 0;) value = value << 8 | p_in[i];
+	return value;
+}
+
+/* order of clips in the directory: bytes of names, as strcmp has it for UTF-8 */
+static int amr_pack_compare(const char * p_a, t_size p_a_length, const char * p_b, t_size p_b_length) {
+	const int result = memcmp(p_a, p_b, pfc::min_t(p_a_length, p_b_length));
+	if (result != 0) return result;
+	return p_a_length < p_b_length ? -1 : p_a_length > p_b_length ? 1 : 0;
+}
+
+/**
+ * Directory of a pack, as it's stored: an entry of amr_pack_entry_size bytes per clip, in order of their
+ * names, and the names, so a clip is found by binary search over entries, with no structure built on load;
+ * directory of a million clips takes about 50 MB. Entry holds where the clip is in the pack, its size,
+ * frames per channel, FNV-1a hash of its bytes, where its name is among names, and bytes of its header
+ * and channels.
+ *
+ * @since   1.2.0
+ */
+class amr_pack_directory {
+public:
+	/* a clip, as its entry has it */
+	struct clip {
+		t_uint64 m_offset;
+		t_uint32 m_size;
+		t_uint32 m_frames;
+		t_uint64 m_hash;
+		unsigned m_header;
+		unsigned m_channels;
+	};
+
+	amr_pack_directory() : m_count(0), m_names(0) {}
+
+	/**
+	 * Reads the directory of a pack: header, then directory at the end of the pack, checked by its hash.
+	 *
+	 * @param p_file		the pack
+	 * @param p_abort		abort callback
+	 * @throws				exception_io_data if it's not a pack or its directory is damaged
+	 * @since				1.2.0
+	 */
+	void read(const service_ptr_t<file> & p_file, abort_callback & p_abort) {
+		t_uint8 header[amr_pack_header_size];
+		p_file->seek(0, p_abort);
+		if (p_file->read(header, amr_pack_header_size, p_abort) != amr_pack_header_size || memcmp(header, g_pack_magic, sizeof(g_pack_magic) - 1) != 0) {
+			throw exception_io_data("Not an AMR pack");
+		}
+		if (amr_pack_get(header + 12, 4) != g_pack_version) throw exception_io_data("Unsupported version of AMR pack");
+		m_count = (t_size)amr_pack_get(header + 16, 4);
+		const t_uint64 names = amr_pack_get(header + 20, 4);
+		const t_uint64 offset = amr_pack_get(header + 24, 8);
+		const t_uint64 size = (t_uint64)m_count * amr_pack_entry_size + names + 8;
+		const t_filesize file_size = p_file->get_size(p_abort);
+		if (offset < amr_pack_header_size || (file_size != filesize_invalid && (offset > file_size || size != file_size - offset))) throw exception_io_data("Damaged AMR pack");
+		m_data.set_size((t_size)size);
+		p_file->seek(offset, p_abort);
+		p_file->read_object(m_data.get_ptr(), m_data.get_size(), p_abort);
+		if (amr_hash_add(amr_hash_basis, m_data.get_ptr(), m_data.get_size() - 8) != amr_pack_get(m_data.get_ptr() + m_data.get_size() - 8, 8)) {
+			throw exception_io_data("Damaged AMR pack directory");
+		}
+		m_names = m_count * amr_pack_entry_size;
+		for (t_size i = 0; i < m_count; ++i) {
+			const t_uint8 * entry = m_data.get_ptr() + i * amr_pack_entry_size;
+			if (amr_pack_get(entry + 24, 4) + amr_pack_get(entry + 28, 2) > names) throw exception_io_data("Damaged AMR pack directory");
+		}
+	}
+
+	t_size get_count() const { return m_count; }
+
+	/* name of clip p_index, p_length bytes of it, not terminated */
+	const char * get_name(t_size p_index, t_size & p_length) const {
+		const t_uint8 * entry = m_data.get_ptr() + p_index * amr_pack_entry_size;
+		p_length = (t_size)amr_pack_get(entry + 28, 2);
+		return (const char *)m_data.get_ptr() + m_names + amr_pack_get(entry + 24, 4);
+	}
+
+	clip get_clip(t_size p_index) const {
+		const t_uint8 * entry = m_data.get_ptr() + p_index * amr_pack_entry_size;
+		clip c;
+		c.m_offset = amr_pack_get(entry, 8);
+		c.m_size = (t_uint32)amr_pack_get(entry + 8, 4);
+		c.m_frames = (t_uint32)amr_pack_get(entry + 12, 4);
+		c.m_hash = amr_pack_get(entry + 16, 8);
+		c.m_header = entry[30];
+		c.m_channels = entry[31];
+		return c;
+	}
+
+	/* index of the clip named p_name, or pfc::infinite_size if there is none */
+	t_size find(const char * p_name) const {
+		const t_size length = strlen(p_name);
+		t_size lo = 0, hi = m_count;
+		while (lo < hi) {
+			const t_size mid = (lo + hi) / 2;
+			t_size mid_length;
+			const char * name = get_name(mid, mid_length);
+			const int result = amr_pack_compare(name, mid_length, p_name, length);
+			if (result == 0) return mid;
+			if (result < 0) lo = mid + 1;
+			else hi = mid;
+		}
+		return pfc::infinite_size;
+	}
+
+private:
+	pfc::array_t<t_uint8> m_data;
+	t_size m_count;
+	/* offset of names in m_data */
+	t_size m_names;
+};
+
+typedef std::shared_ptr<const amr_pack_directory> amr_pack_directory_ptr;
+
+/**
+ * Directories of the packs opened last, so opening clips of a pack one after another, as a playlist of them
+ * is played or its info read, costs one binary search and one read of the clip each. Directory is taken for
+ * the pack's as long as pack's size and timestamp are what they were when it was read.
+ *
+ * @since   1.2.0
+ */
+class amr_pack_directories {
+public:
+	static amr_pack_directories & get() {
+		static amr_pack_directories instance;
+		return instance;
+	}
+
+	/**
+	 * Gets the directory of a pack, read now if it's not kept.
+	 *
+	 * @param p_path		path to the pack
+	 * @param p_file		the pack, opened
+	 * @param p_abort		abort callback
+	 * @throws				whatever amr_pack_directory::read() throws
+	 * @since				1.2.0
+	 */
+	amr_pack_directory_ptr query(const char * p_path, const service_ptr_t<file> & p_file, abort_callback & p_abort) {
+		const t_filestats stats = p_file->get_stats(p_abort);
+		{
+			insync(m_lock);
+			for (t_size i = 0; i < m_entries.size(); ++i) {
+				entry & e = m_entries[i];
+				if (strcmp(e.m_path, p_path) != 0 || e.m_stats != stats) continue;
+				/* newest first, so the one used longest ago goes */
+				std::rotate(m_entries.begin(), m_entries.begin() + i, m_entries.begin() + i + 1);
+				return m_entries[0].m_directory;
+			}
+		}
+		std::shared_ptr<amr_pack_directory> directory = std::make_shared<amr_pack_directory>();
+		directory->read(p_file, p_abort);
+		entry e;
+		e.m_path = p_path;
+		e.m_stats = stats;
+		e.m_directory = directory;
+		insync(m_lock);
+		m_entries.insert(m_entries.begin(), e);
+		if (m_entries.size() > amr_pack_cached_directories) m_entries.pop_back();
+		return directory;
+	}
+
+private:
+	struct entry {
+		pfc::string8 m_path;
+		t_filestats m_stats;
+		amr_pack_directory_ptr m_directory;
+	};
+
+	critical_section m_lock;
+	std::vector<entry> m_entries;
+};
+
+/**
+ * Reads a clip in one read, and checks it against its hash, so a clip damaged in the pack is not played as another.
+ *
+ * @param p_file		the pack
+ * @param p_clip		the clip
+ * @param p_abort		abort callback
+ * @return				reader of the clip, in memory
+ * @throws				exception_io_data if the clip is damaged
+ * @since				1.2.0
+ */
+static service_ptr_t<file> amr_pack_read_clip(const service_ptr_t<file> & p_file, const amr_pack_directory::clip & p_clip, abort_callback & p_abort) {
+	pfc::array_t<t_uint8> data;
+	data.set_size(p_clip.m_size);
+	p_file->seek(p_clip.m_offset, p_abort);
+	p_file->read_object(data.get_ptr(), data.get_size(), p_abort);
+	if (amr_hash_add(amr_hash_basis, data.get_ptr(), data.get_size()) != p_clip.m_hash) throw exception_io_data("Damaged clip in AMR pack");
+	return new service_impl_t<reader_membuffer_simple>(data.get_ptr(), data.get_size(), p_file->get_timestamp(p_abort), p_file->is_remote());
+}
+
+/**
+ * AMR packs (.amrpack) as archives of the clips in them, so each clip is added to playlists, played, and
+ * converted as a file of its own, input_amr playing it, with a path of unpack://amrpack|...|name.amr.
+ * Meant for millions of clips of seconds, where opening a file and reading its info takes longer than
+ * decoding it: pack is one file, and a clip of it is opened with a binary search of its directory, kept in
+ * memory for the packs opened last, and one read of its bytes.
+ *
+ * Pack is a header, clips as they were, one after another, and the directory at the end, see
+ * amr_pack_directory. Header is "#!AMRPACK\n", 2 zero bytes, and little-endian 32-bit version, clips, and
+ * bytes of their names, then 64-bit offset of the directory. Directory is followed by FNV-1a hash of it.
+ *
+ * @since   1.2.0
+ */
+class amr_pack_archive : public archive_impl {
+public:
+	bool supports_content_types() { return false; }
+	const char * get_archive_type() { return g_pack_extension; }
+
+	t_filestats get_stats_in_archive(const char * p_archive, const char * p_file, abort_callback & p_abort) {
+		service_ptr_t<file> pack;
+		filesystem::g_open_read(pack, p_archive, p_abort);
+		const amr_pack_directory_ptr directory = amr_pack_directories::get().query(p_archive, pack, p_abort);
+		const t_size index = directory->find(p_file);
+		if (index == pfc::infinite_size) throw exception_io_not_found();
+		t_filestats stats;
+		stats.m_size = directory->get_clip(index).m_size;
+		stats.m_timestamp = pack->get_timestamp(p_abort);
+		return stats;
+	}
+
+	void open_archive(service_ptr_t<file> & p_out, const char * p_archive, const char * p_file, abort_callback & p_abort) {
+		service_ptr_t<file> pack;
+		filesystem::g_open_read(pack, p_archive, p_abort);
+		const amr_pack_directory_ptr directory = amr_pack_directories::get().query(p_archive, pack, p_abort);
+		const t_size index = directory->find(p_file);
+		if (index == pfc::infinite_size) throw exception_io_not_found();
+		p_out = amr_pack_read_clip(pack, directory->get_clip(index), p_abort);
+	}
+
+	void archive_list(const char * p_path, const service_ptr_t<file> & p_reader, archive_callback & p_out, bool p_want_readers) {
+		if (stricmp_utf8(pfc::string_extension(p_path), g_pack_extension) != 0) throw exception_io_data();
+		service_ptr_t<file> pack = p_reader;
+		if (pack.is_empty()) filesystem::g_open_read(pack, p_path, p_out);
+		const amr_pack_directory_ptr directory = amr_pack_directories::get().query(p_path, pack, p_out);
+		const t_filetimestamp timestamp = pack->get_timestamp(p_out);
+		for (t_size i = 0; i < directory->get_count(); ++i) {
+			t_size length;
+			const char * name = directory->get_name(i, length);
+			const amr_pack_directory::clip clip = directory->get_clip(i);
+			pfc::string_formatter url;
+			make_unpack_path(url, p_path, pfc::string8(name, length));
+			t_filestats stats;
+			stats.m_size = clip.m_size;
+			stats.m_timestamp = timestamp;
+			service_ptr_t<file> reader;
+			if (p_want_readers) reader = amr_pack_read_clip(pack, clip, p_out);
+			if (!p_out.on_entry(this, url, stats, reader)) break;
+		}
+	}
+};
+
+static archive_factory_t<amr_pack_archive> g_amr_pack_archive;
+
+/* a clip to pack: where it's in the pack, and its entry but for the name */
+struct amr_pack_item {
+	pfc::string8 m_name;
+	amr_pack_directory::clip m_clip;
+};
+
+/**
+ * Checks a file is AMR-NB, and counts frames of it, walked to the first byte that's not a valid frame header.
+ *
+ * @param p_data		the file
+ * @param p_size		its length
+ * @param p_clip		receives its header size, channels and frames
+ * @return				<code>false</code> if it's not AMR-NB
+ * @since				1.2.0
+ */
+static bool amr_pack_walk(const t_uint8 * p_data, t_size p_size, amr_pack_directory::clip & p_clip) {
+	if (p_size >= amr_pack_magic_size && memcmp(p_data, g_pack_amr_magic, amr_pack_magic_size) == 0) {
+		p_clip.m_header = amr_pack_magic_size;
+		p_clip.m_channels = 1;
+	}
+	else if (p_size >= amr_pack_mc_header_size && memcmp(p_data, g_pack_amr_mc_magic, amr_pack_mc_magic_size) == 0) {
+		p_clip.m_header = amr_pack_mc_header_size;
+		p_clip.m_channels = p_data[amr_pack_mc_header_size - 1] & 0x0F;
+		if (p_clip.m_channels == 0 || p_clip.m_channels > amr_pack_max_channels) return false;
+	}
+	else return false;
+	t_size frames = 0;
+	for (t_size pos = p_clip.m_header; pos < p_size && amr_frame_reader::is_frame_header(p_data[pos]); ++frames) {
+		const t_size length = 1 + Decoder_Interface_block_size[(p_data[pos] >> 3) & 0x0F];
+		if (p_size - pos < length) break;
+		pos += length;
+	}
+	p_clip.m_frames = (t_uint32)(frames / p_clip.m_channels);
+	return true;
+}
+
+/**
+ * Packs files into a new pack: each file is copied whole, as it is, after the ones before, and the directory
+ * is written once all are in. Clips are named by their file names, with a number added to a name taken.
+ *
+ * @param p_path		path of the pack
+ * @param p_paths		the files
+ * @param p_status		progress
+ * @param p_abort		abort callback
+ * @return				report
+ * @since				1.2.0
+ */
+static pfc::string8 amr_pack_write(const char * p_path, const pfc::list_t<pfc::string8> & p_paths, threaded_process_status & p_status, abort_callback & p_abort) {
+	pfc::string_formatter report;
+	std::vector<amr_pack_item> items;
+	pfc::map_t<pfc::string8, bool> names;
+	service_ptr_t<file> out;
+	filesystem::g_open_write_new(out, p_path, p_abort);
+	try {
+		t_uint8 header[amr_pack_header_size] = {};
+		out->write(header, amr_pack_header_size, p_abort);
+		t_uint64 offset = amr_pack_header_size;
+		pfc::array_t<t_uint8> data;
+		for (t_size i = 0; i < p_paths.get_count(); ++i) {
+			p_status.set_progress(i, p_paths.get_count());
+			const char * path = p_paths[i];
+			amr_pack_item item;
+			try {
+				service_ptr_t<file> in;
+				filesystem::g_open_read(in, path, p_abort);
+				const t_filesize size = in->get_size(p_abort);
+				if (size == filesize_invalid || size > amr_pack_max_clip_size) throw exception_io_data("too big to pack");
+				data.set_size((t_size)size);
+				in->read_object(data.get_ptr(), data.get_size(), p_abort);
+				if (!amr_pack_walk(data.get_ptr(), data.get_size(), item.m_clip)) throw exception_io_unsupported_format("not AMR-NB");
+			} catch (exception_aborted const &) {
+				throw;
+			} catch (std::exception const & e) {
+				report << path << ": " << e.what() << ", not packed\n";
+				continue;
+			}
+			const pfc::string_filename_ext name(path);
+			item.m_name = name;
+			for (unsigned n = 2; names.have_item(item.m_name); ++n) {
+				const pfc::string_extension extension(name);
+				pfc::string8 base = name;
+				if (extension.length() > 0) base.truncate(base.length() - extension.length() - 1);
+				item.m_name = pfc::string_formatter() << base << " (" << n << ")" << (extension.length() > 0 ? "." : "") << extension;
+			}
+			if (item.m_name.length() > amr_pack_max_name_length) {
+				report << path << ": name too long, not packed\n";
+				continue;
+			}
+			names.set(item.m_name, true);
+			item.m_clip.m_offset = offset;
+			item.m_clip.m_size = (t_uint32)data.get_size();
+			item.m_clip.m_hash = amr_hash_add(amr_hash_basis, data.get_ptr(), data.get_size());
+			out->write(data.get_ptr(), data.get_size(), p_abort);
+			offset += data.get_size();
+			items.push_back(item);
+		}
+		if (items.empty()) throw exception_io_data("no AMR-NB files to pack");
+
+		std::sort(items.begin(), items.end(), [](const amr_pack_item & a, const amr_pack_item & b) {
+			return amr_pack_compare(a.m_name, a.m_name.length(), b.m_name, b.m_name.length()) < 0;
+		});
+		t_size names_size = 0;
+		for (size_t i = 0; i < items.size(); ++i) names_size += items[i].m_name.length();
+		pfc::array_t<t_uint8> directory;
+		directory.set_size(items.size() * amr_pack_entry_size + names_size + 8);
+		t_uint8 * names_out = directory.get_ptr() + items.size() * amr_pack_entry_size;
+		t_size name_offset = 0;
+		for (size_t i = 0; i < items.size(); ++i) {
+			const amr_pack_item & item = items[i];
+			t_uint8 * entry = directory.get_ptr() + i * amr_pack_entry_size;
+			amr_pack_put(entry, item.m_clip.m_offset, 8);
+			amr_pack_put(entry + 8, item.m_clip.m_size, 4);
+			amr_pack_put(entry + 12, item.m_clip.m_frames, 4);
+			amr_pack_put(entry + 16, item.m_clip.m_hash, 8);
+			amr_pack_put(entry + 24, name_offset, 4);
+			amr_pack_put(entry + 28, item.m_name.length(), 2);
+			entry[30] = (t_uint8)item.m_clip.m_header;
+			entry[31] = (t_uint8)item.m_clip.m_channels;
+			memcpy(names_out + name_offset, item.m_name.get_ptr(), item.m_name.length());
+			name_offset += item.m_name.length();
+		}
+		amr_pack_put(directory.get_ptr() + directory.get_size() - 8, amr_hash_add(amr_hash_basis, directory.get_ptr(), directory.get_size() - 8), 8);
+		out->write(directory.get_ptr(), directory.get_size(), p_abort);
+
+		/* header last, so a pack cut short is not taken for a whole one */
+		memcpy(header, g_pack_magic, sizeof(g_pack_magic) - 1);
+		amr_pack_put(header + 12, g_pack_version, 4);
+		amr_pack_put(header + 16, items.size(), 4);
+		amr_pack_put(header + 20, names_size, 4);
+		amr_pack_put(header + 24, offset, 8);
+		out->seek(0, p_abort);
+		out->write(header, amr_pack_header_size, p_abort);
+	} catch (...) {
+		/* half written pack is no use to anyone */
+		out.release();
+		try {
+			abort_callback_dummy abort;
+			filesystem::g_remove(p_path, abort);
+		} catch (exception_io const &) {}
+		throw;
+	}
+	report << p_path << ": " << (t_size)items.size() << " clips\n";
+	return report;
+}
+
+/**
+ * "Pack AMR files" item in the Utilities context menu: packs the selected AMR files into a new pack next
+ * to the first one, see amr_pack_archive. Files are copied as they are; report goes to the console.
+ *
+ * @since   1.2.0
+ */
+class amr_pack_item_menu : public contextmenu_item_simple {
+public:
+	GUID get_parent() { return contextmenu_groups::utilities; }
+	unsigned get_num_items() { return 1; }
+	void get_item_name(unsigned p_index, pfc::string_base & p_out) { p_out = "Pack AMR files"; }
+	bool get_item_description(unsigned p_index, pfc::string_base & p_out) {
+		p_out = "Packs the selected AMR files into one AMR pack next to the first one, each of them played from it as a file of its own.";
+		return true;
+	}
+	GUID get_item_guid(unsigned p_index) {
+		static const GUID guid = { 0x3e9b0d57, 0x81c4, 0x4a2f,{ 0x9d, 0x16, 0x7b, 0xe0, 0x42, 0xc8, 0x5a, 0x93 } };
+		return guid;
+	}
+	void context_command(unsigned p_index, metadb_handle_list_cref p_data, const GUID & p_caller) {
+		pfc::list_t<pfc::string8> paths;
+		for (t_size i = 0; i < p_data.get_count(); ++i) {
+			const char * path = p_data[i]->get_path();
+			if (stricmp_utf8(pfc::string_extension(path), "amr") != 0) continue;
+			/* tracks of a file split at pauses are all of it */
+			if (paths.get_count() > 0 && strcmp(paths[paths.get_count() - 1], path) == 0) continue;
+			paths.add_item(path);
+		}
+		if (paths.get_count() == 0) return;
+		std::shared_ptr<pfc::string8> report = std::make_shared<pfc::string8>();
+		threaded_process::g_run_modeless(threaded_process_callback_lambda::create(nullptr,
+			[paths, report](threaded_process_status & p_status, abort_callback & p_abort) {
+				pfc::string8 base = paths[0];
+				base.truncate(base.length() - pfc::string_extension(base).length() - 1);
+				pfc::string_formatter path;
+				for (unsigned i = 1;; ++i) {
+					path.reset();
+					path << base;
+					if (i > 1) path << " (" << i << ")";
+					path << "." << g_pack_extension;
+					if (!filesystem::g_exists(path, p_abort)) break;
+				}
+				try {
+					*report = amr_pack_write(path, paths, p_status, p_abort);
+				} catch (exception_aborted const &) {
+					throw;
+				} catch (std::exception const & e) {
+					*report = pfc::string_formatter() << path << ": " << e.what() << "\n";
+				}
+			},
+			[report](HWND p_wnd, bool p_was_aborted) {
+				if (p_was_aborted) return;
+				console::formatter() << "AMR packing: " << *report;
+			}),
+			threaded_process::flag_show_progress | threaded_process::flag_show_abort,
+			core_api::get_main_window(), "Packing AMR files");
+	}
+};
+
+static contextmenu_item_factory_t<amr_pack_item_menu> g_amr_pack_item_menu;
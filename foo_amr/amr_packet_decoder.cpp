@@ -0,0 +1,91 @@
+/**
+ * foo_input_amr - decoding of AMR tracks of MP4 and 3GP files
+*/
+#include "../foo_sdk/foobar2000/SDK/foobar2000.h"
+extern "C" {
+	#include "../3gpp/interf_dec.h"
+}
+#include "amr_decoder_pool.h"
+
+enum {
+	/* every frame decodes to 160 samples, 20ms at 8kHz */
+	amr_packet_frame_samples = 160,
+	amr_packet_sample_rate = 8000,
+	/* frames decoded and thrown away before seek target, as many as input_amr decodes by default */
+	amr_packet_frame_dependency = 16,
+};
+
+
+/**
+ * Decodes AMR-NB track of MP4 or 3GP file ("samr" sample entry; 3GPP TS 26.244), which foobar's own
+ * MP4 parser demultiplexes, so seeking there goes by its sample tables. Each sample is one or more
+ * frames in storage format, each with its header byte, as in .amr files, just without the magic string.
+ *
+ * @since   1.2.0
+ */
+class amr_packet_decoder : public packet_decoder {
+public:
+	/* MP4 parser hands out AMR-NB tracks as theirs; there is no setup data to check */
+	static bool g_is_our_setup(const GUID & p_owner, t_size p_param1, const void * p_param2, t_size p_param2size) {
+		return p_owner == owner_MP4_AMR;
+	}
+
+	void open(const GUID & p_owner, bool p_decode, t_size p_param1, const void * p_param2, t_size p_param2size, abort_callback & p_abort) {
+		/* info is all constant, decoder is needed only if there will be decoding */
+		if (p_decode) m_decoder.acquire();
+	}
+
+	t_size set_stream_property(const GUID & p_type, t_size p_param1, const void * p_param2, t_size p_param2size) { return 0; }
+
+	void get_info(file_info & p_info) {
+		p_info.info_set("codec", "AMR-NB");
+		p_info.info_set("encoding", "lossy");
+		p_info.info_set_int("samplerate", amr_packet_sample_rate);
+		p_info.info_set_int("channels", 1);
+	}
+
+	unsigned get_max_frame_dependency() { return amr_packet_frame_dependency; }
+	double get_max_frame_dependency_time() { return (double)amr_packet_frame_dependency * amr_packet_frame_samples / amr_packet_sample_rate; }
+
+	/* frames before seek target come in decode() calls again, so decoder can just start over */
+	void reset_after_seek() { m_decoder.acquire(); }
+
+	/**
+	 * Decodes all whole frames of one sample straight into the chunk; a frame cut off by the end
+	 * of the sample is dropped.
+	 *
+	 * @param p_buffer		the sample
+	 * @param p_bytes		its length
+	 * @param p_chunk		receives decoded audio, empty if there was no whole frame
+	 * @param p_abort		abort callback
+	 * @since				1.2.0
+	 */
+	void decode(const void * p_buffer, t_size p_bytes, audio_chunk & p_chunk, abort_callback & p_abort) {
+		const t_uint8 * data = static_cast<const t_uint8 *>(p_buffer);
+		/* count whole frames first, so the chunk is allocated once */
+		t_size frames = 0;
+		for (t_size pos = 0; pos < p_bytes; ++frames) {
+			const t_size size = 1 + Decoder_Interface_block_size[(data[pos] >> 3) & 0x0F];
+			if (p_bytes - pos < size) break;
+			pos += size;
+		}
+		if (frames == 0) {
+			p_chunk.set_sample_count(0);
+			return;
+		}
+		p_chunk.set_data_size(frames * amr_packet_frame_samples);
+		Decoder_Interface_DecodeN_float(m_decoder.get(), const_cast<t_uint8 *>(data), (int)p_bytes, p_chunk.get_data(), (int)frames, NULL);
+		p_chunk.set_srate(amr_packet_sample_rate);
+		p_chunk.set_channels(1, audio_chunk::channel_config_mono);
+		p_chunk.set_sample_count(frames * amr_packet_frame_samples);
+	}
+
+	bool analyze_first_frame_supported() { return false; }
+	void analyze_first_frame(const void * p_buffer, t_size p_bytes, abort_callback & p_abort) {}
+
+private:
+	/* 3gpp decoder, given back to the pool when the packet decoder is destroyed */
+	amr_decoder m_decoder;
+};
+
+static packet_decoder_factory_t<amr_packet_decoder> g_amr_packet_decoder_factory;
@@ -0,0 +1,180 @@
+/**
+ * foo_input_amr - decoding of long files on several threads
+*/
+#include "../foo_sdk/foobar2000/SDK/foobar2000.h"
+extern "C" {
+	#include "../3gpp/interf_dec.h"
+}
+#include "amr_parallel_decoder.h"
+#include "amr_thread_pool.h"
+#include "amr_tuning.h"
+
+static advconfig_checkbox_factory g_amr_parallel("AMR decoder: decode long files on several threads when converting",
+	{ 0x5e0c6a4b, 0x0f29, 0x4d8e,{ 0x9b, 0x3d, 0x61, 0xc2, 0x7a, 0x14, 0xe8, 0x53 } },
+	advconfig_branch::guid_branch_decoding, 1, false);
+
+bool amr_parallel_decoder::is_enabled() {
+	return amr_tuned<bool>(g_amr_parallel.get(), g_amr_parallel.get(), true, false);
+}
+
+bool amr_get_parallel() { return g_amr_parallel.get(); }
+void amr_set_parallel(bool p_parallel) { g_amr_parallel.set(p_parallel); }
+
+/**
+ * Frames of one segment, warm-up frames first, what they decode to, and the worker decoding them.
+ */
+struct amr_parallel_decoder::segment {
+	segment() : m_warmup(0), m_frames(0), m_read(0), m_ok(false), m_checked(false) {}
+	/* worker must not outlive the data it works on; segment dropped before it's decoded isn't decoded at all */
+	~segment() { m_task.cancel(); }
+
+	/* worker: decodes all frames with a fresh decoder, taking snapshot right after the warm-up */
+	void decode(const short * p_block_size) {
+		try {
+			m_decoder.acquire();
+		} catch (std::exception const &) {
+			return;
+		}
+		t_uint8 * frame = m_data.get_ptr();
+		for (unsigned i = 0; i < m_warmup; ++i) {
+			/* warm-up output is not needed, it's overwritten by the kept frames */
+			Decoder_Interface_Decode_float(m_decoder.get(), frame, m_output.get_ptr(), 0);
+			frame += 1 + p_block_size[(frame[0] >> 3) & 0x0F];
+		}
+		Decoder_Interface_snapshot(m_decoder.get(), m_entry.get_ptr());
+		const t_size left = m_data.get_size() - (frame - m_data.get_ptr());
+		Decoder_Interface_DecodeN_float(m_decoder.get(), frame, (int)left, m_output.get_ptr(), m_frames, NULL);
+		m_ok = true;
+	}
+
+	pfc::array_t<t_uint8> m_data;
+	/* frames of m_data decoded only to settle the decoder, and frames to keep */
+	unsigned m_warmup, m_frames;
+	/* frames of m_output handed out so far */
+	unsigned m_read;
+	pfc::array_t<audio_sample> m_output;
+	/* decoder snapshot after the warm-up */
+	pfc::array_t<t_uint8> m_entry;
+	amr_decoder m_decoder;
+	/* worker got to the end */
+	bool m_ok;
+	/* m_output is known to be what sequential decoder produces */
+	bool m_checked;
+	amr_task m_task;
+};
+
+amr_parallel_decoder::amr_parallel_decoder() : m_reader(NULL), m_decoder(NULL), m_block_size(NULL), m_threads(0), m_left(0), m_misses(0), m_tail_frames(0) {}
+
+amr_parallel_decoder::~amr_parallel_decoder() {
+	reset();
+}
+
+void amr_parallel_decoder::start(amr_frame_reader & p_reader, amr_decoder & p_decoder, const short * p_block_size, unsigned p_frames) {
+	reset();
+	m_reader = &p_reader;
+	m_decoder = &p_decoder;
+	m_block_size = p_block_size;
+	m_threads = pfc::max_t<t_size>(amr_thread_pool::get().get_workers(), 2);
+	m_left = p_frames;
+	m_misses = 0;
+}
+
+void amr_parallel_decoder::reset() {
+	/* segment destructors wait for their workers */
+	m_segments.clear();
+	m_left = 0;
+	m_tail.set_size(0);
+	m_tail_frames = 0;
+}
+
+void amr_parallel_decoder::launch(abort_callback & p_abort) {
+	std::unique_ptr<segment> s(new segment);
+	const unsigned count = pfc::min_t<unsigned>(m_left, amr_segment_frames);
+
+	/* offsets of all frames in m_data, so the tail can be cut off for the next segment */
+	pfc::array_t<t_size> offsets;
+	offsets.set_size(m_tail_frames + count);
+	t_size size = 0;
+	for (unsigned i = 0; i < m_tail_frames; ++i) {
+		offsets[i] = size;
+		size += 1 + m_block_size[(m_tail[size] >> 3) & 0x0F];
+	}
+
+	/* 32 bytes is the longest frame there is */
+	s->m_data.set_size(m_tail.get_size() + count * 32);
+	if (m_tail_frames > 0) memcpy(s->m_data.get_ptr(), m_tail.get_ptr(), m_tail.get_size());
+	unsigned frames = 0;
+	while (frames < count) {
+		t_size frame_size;
+		const t_uint8 * frame = m_reader->next(m_block_size, frame_size, p_abort);
+		/* file is shorter than expected; there is nothing more to read */
+		if (frame == NULL) {
+			m_left = frames;
+			break;
+		}
+		offsets[m_tail_frames + frames] = size;
+		memcpy(s->m_data.get_ptr() + size, frame, frame_size);
+		size += frame_size;
+		++frames;
+	}
+	m_left -= frames;
+	if (frames == 0) return;
+	s->m_data.set_size(size);
+	s->m_warmup = m_tail_frames;
+	s->m_frames = frames;
+	s->m_output.set_size(frames * amr_frame_samples);
+	s->m_entry.set_size(Decoder_Interface_snapshot_size());
+
+	/* warm-up of the next segment are the last frames of this one */
+	const unsigned total = m_tail_frames + frames;
+	const unsigned first = total > amr_warmup_frames ? total - amr_warmup_frames : 0;
+	m_tail_frames = total - first;
+	m_tail.set_data_fromptr(s->m_data.get_ptr() + offsets[first], size - offsets[first]);
+
+	segment * worker = s.get();
+	const short * block_size = m_block_size;
+	amr_thread_pool::get().submit(worker->m_task, [worker, block_size] { worker->decode(block_size); }, amr_priority_decoding);
+	m_segments.push_back(std::move(s));
+}
+
+void amr_parallel_decoder::check(segment & p_segment) {
+	p_segment.m_task.wait();
+	const t_size size = Decoder_Interface_snapshot_size();
+	m_snapshot.set_size(size);
+	Decoder_Interface_snapshot(m_decoder->get(), m_snapshot.get_ptr());
+	p_segment.m_checked = true;
+
+	if (p_segment.m_ok && memcmp(p_segment.m_entry.get_ptr(), m_snapshot.get_ptr(), size) == 0) {
+		/* worker's decoder is now where sequential one would be after this segment */
+		m_decoder->swap(p_segment.m_decoder);
+		m_misses = 0;
+		return;
+	}
+
+	/* states differ, so decode the segment again, continuing with sequential decoder */
+	t_uint8 * frame = p_segment.m_data.get_ptr();
+	for (unsigned i = 0; i < p_segment.m_warmup; ++i) frame += 1 + m_block_size[(frame[0] >> 3) & 0x0F];
+	const t_size left = p_segment.m_data.get_size() - (frame - p_segment.m_data.get_ptr());
+	Decoder_Interface_DecodeN_float(m_decoder->get(), frame, (int)left, p_segment.m_output.get_ptr(), p_segment.m_frames, NULL);
+	/* states of this file do not converge; stop reading ahead, caller decodes the rest */
+	if (++m_misses >= amr_parallel_max_misses) m_left = 0;
+}
+
+unsigned amr_parallel_decoder::run(audio_sample * p_out, unsigned p_max_frames, abort_callback & p_abort) {
+	unsigned done = 0;
+	while (done < p_max_frames) {
+		p_abort.check();
+		/* keep every worker busy */
+		while (m_left > 0 && m_segments.size() < m_threads) launch(p_abort);
+		if (m_segments.empty()) break;
+
+		segment & s = *m_segments.front();
+		if (!s.m_checked) check(s);
+		const unsigned n = pfc::min_t(p_max_frames - done, s.m_frames - s.m_read);
+		memcpy(p_out + done * amr_frame_samples, s.m_output.get_ptr() + s.m_read * amr_frame_samples, n * amr_frame_samples * sizeof(audio_sample));
+		s.m_read += n;
+		done += n;
+		if (s.m_read == s.m_frames) m_segments.pop_front();
+	}
+	return done;
+}
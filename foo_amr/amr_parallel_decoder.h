@@ -0,0 +1,100 @@
+/**
+ * foo_input_amr - decoding of long files on several threads
+*/
+#pragma once
+
+#include <deque>
+#include <memory>
+#include "amr_decoder_pool.h"
+#include "amr_frame_reader.h"
+
+enum {
+	/* frames per segment decoded by one worker, ~40 seconds; multiple of the 8 frame DTX history */
+	amr_segment_frames = 2048,
+	/* frames before a segment decoded only to bring fresh decoder to the state sequential one has */
+	amr_warmup_frames = 128,
+	/* files shorter than that are not worth the threads */
+	amr_parallel_min_frames = 4 * amr_segment_frames,
+	/* after this many segments in a row fail the state check, the rest of the file is decoded sequentially */
+	amr_parallel_max_misses = 2,
+	/* samples decoded from one frame */
+	amr_frame_samples = 160,
+};
+
+/**
+ * Decodes AMR frames ahead on worker threads, a segment of frames per task, and hands out decoded
+ * audio in order. Decoder state carries over from frame to frame, so every segment but the first one
+ * starts with a fresh decoder which first decodes amr_warmup_frames frames preceding the segment;
+ * in practice that brings it to the very state the sequential decoder would have. Whether it did is
+ * checked: decoder snapshot taken after the warm-up must equal snapshot of the decoder that decoded
+ * the previous segment, when it's done. If it does not, the segment is decoded once more, continuing
+ * with that decoder. Output is therefore always the same as of sequential decoding; files where states
+ * do not converge, usually ones with lost frames or comfort noise, are just decoded sequentially.
+ *
+ * Frames are read on the caller's thread, workers touch only memory. Workers are those of amr_thread_pool,
+ * shared with other inputs decoding at the same time.
+ *
+ * @since   1.2.0
+ */
+class amr_parallel_decoder {
+public:
+	/* both defined where segment is complete */
+	amr_parallel_decoder();
+	~amr_parallel_decoder();
+
+	/* "decode long files on several threads" preference */
+	static bool is_enabled();
+
+	/**
+	 * Starts decoding ahead.
+	 *
+	 * @param p_reader		reader positioned at the first frame to decode; used only by run()
+	 * @param p_decoder		decoder in the state the first frame is to be decoded with; receives state after last frame handed out
+	 * @param p_block_size	payload sizes indexed by frame type
+	 * @param p_frames		number of frames to decode
+	 * @since				1.2.0
+	 */
+	void start(amr_frame_reader & p_reader, amr_decoder & p_decoder, const short * p_block_size, unsigned p_frames);
+
+	/**
+	 * Gets next decoded frames.
+	 *
+	 * @param p_out			receives p_max_frames * 160 samples at most
+	 * @param p_max_frames	maximum number of frames to return
+	 * @param p_abort		abort callback
+	 * @return				number of frames stored; less than asked once decoding ahead is over, and the caller
+	 *						is to continue sequentially from the reader and decoder given to start()
+	 * @since				1.2.0
+	 */
+	unsigned run(audio_sample * p_out, unsigned p_max_frames, abort_callback & p_abort);
+
+	/* stops decoding ahead, waits for workers and drops what they decoded */
+	void reset();
+
+	/* there are decoded frames to hand out, or frames to decode ahead */
+	bool is_active() const { return !m_segments.empty() || m_left > 0; }
+
+private:
+	struct segment;
+
+	/* reads next segment and starts its worker */
+	void launch(abort_callback & p_abort);
+	/* makes sure first segment continues from *m_decoder, decoding it again if it does not */
+	void check(segment & p_segment);
+
+	amr_frame_reader * m_reader;
+	amr_decoder * m_decoder;
+	const short * m_block_size;
+	/* number of segments decoded, or waiting for a worker, at the same time */
+	t_size m_threads;
+	/* frames not read yet */
+	unsigned m_left;
+	/* segments in a row that failed the state check */
+	unsigned m_misses;
+	/* last amr_warmup_frames frames read, warm-up of the next segment, and their count */
+	pfc::array_t<t_uint8> m_tail;
+	unsigned m_tail_frames;
+	/* snapshot of *m_decoder, compared to those taken by workers */
+	pfc::array_t<t_uint8> m_snapshot;
+	std::deque<std::unique_ptr<segment> > m_segments;
+};
@@ -0,0 +1,148 @@
+/**
+ * foo_input_amr - scanning of very large files on several threads
+*/
+#include "../foo_sdk/foobar2000/SDK/foobar2000.h"
+#include "amr_parallel_scan.h"
+#include "amr_frame_reader.h"
+#include "amr_thread_pool.h"
+
+static advconfig_checkbox_factory g_amr_parallel_scan("AMR decoder: scan very large files on several threads, for SSD",
+	{ 0x2c7f4e91, 0x8a3d, 0x4b56,{ 0x9e, 0x12, 0x73, 0xd0, 0x5b, 0xa8, 0x4f, 0x6c } },
+	advconfig_branch::guid_branch_decoding, 40, false);
+
+bool amr_parallel_scan::is_enabled() {
+	return g_amr_parallel_scan.get();
+}
+
+/**
+ * One region, and the walk of its frames by a worker.
+ */
+struct amr_parallel_scan::region {
+	region() : m_begin(0), m_next(0), m_end(0), m_sync(0), m_stop(0), m_first(false), m_ok(false), m_whole(false), m_abort(NULL) {}
+	/* worker must not outlive the region it walks */
+	~region() { m_task.cancel(); }
+
+	/* worker: reads the region, finds where its frames start, and walks them up to the next region */
+	void walk(const char * p_path, const short * p_block_size) {
+		try {
+			const t_size length = (t_size)(m_next - m_begin);
+			const t_size size = (t_size)(pfc::min_t<t_filesize>(m_next + amr_scan_overlap, m_end) - m_begin);
+			pfc::array_t<t_uint8> data;
+			data.set_size(size);
+			file::ptr f;
+			filesystem::g_open_read(f, p_path, *m_abort);
+			f->seek(m_begin, *m_abort);
+			pfc::hires_timer timer;
+			timer.start();
+			f->read_object(data.get_ptr(), size, *m_abort);
+			amr_count(amr_counter_read_bytes, size);
+			amr_count(amr_counter_read_us, (t_int64)(timer.query() * 1000000));
+
+			const t_uint8 * const bytes = data.get_ptr();
+			t_size pos = m_first ? 0 : find_sync(bytes, length, size, p_block_size);
+			if (pos >= length) return;
+			m_sync = m_begin + pos;
+			/* a byte per frame at most */
+			m_headers.set_size(length - pos);
+			t_size frames = 0;
+			while (pos < length && amr_frame_reader::is_frame_header(bytes[pos])) {
+				const t_size frame = 1 + p_block_size[(bytes[pos] >> 3) & 0x0F];
+				/* frame cut off by the end of file */
+				if (pos + frame > size) break;
+				m_headers[frames++] = bytes[pos];
+				pos += frame;
+			}
+			m_headers.set_size(frames);
+			m_stop = m_begin + pos;
+			m_whole = pos >= length;
+			m_ok = true;
+		} catch (std::exception const &) {
+			/* region is walked sequentially, where the error comes up again if it's still there */
+		}
+	}
+
+	/* first offset before p_length with amr_scan_sync_frames frames in a row with valid headers, or p_length */
+	static t_size find_sync(const t_uint8 * p_data, t_size p_length, t_size p_size, const short * p_block_size) {
+		t_size pos = 0;
+		for (;;) {
+			pos += amr_frame_reader::find_run(p_data + pos, p_size - pos, p_block_size, true);
+			if (pos >= p_length) return p_length;
+			t_size at = pos;
+			unsigned frames = 0;
+			for (; frames < amr_scan_sync_frames && at < p_size && amr_frame_reader::is_frame_header(p_data[at]); ++frames) at += 1 + p_block_size[(p_data[at] >> 3) & 0x0F];
+			if (frames == amr_scan_sync_frames && at <= p_size) return pos;
+			++pos;
+		}
+	}
+
+	/* region is [m_begin, m_next); file data ends at m_end */
+	t_filesize m_begin, m_next, m_end;
+	/* offset of the first frame walked, and of the frame after the last one */
+	t_filesize m_sync, m_stop;
+	/* headers of frames walked */
+	pfc::array_t<t_uint8> m_headers;
+	/* region starts with the first frame of the file, so it's not searched */
+	bool m_first;
+	/* worker found frames and walked them */
+	bool m_ok;
+	/* walk got to the end of the region, rather than to a damaged header or the end of file */
+	bool m_whole;
+	abort_callback * m_abort;
+	amr_task m_task;
+};
+
+amr_parallel_scan::amr_parallel_scan(const char * p_path, const short * p_block_size) : m_path(p_path), m_block_size(p_block_size) {}
+
+amr_parallel_scan::~amr_parallel_scan() {
+	/* region destructors wait for their workers */
+	m_regions.clear();
+}
+
+void amr_parallel_scan::launch(t_filesize p_begin, t_filesize p_next, t_filesize p_end, bool p_first, abort_callback & p_abort) {
+	std::unique_ptr<region> r(new region);
+	r->m_begin = p_begin;
+	r->m_next = p_next;
+	r->m_end = p_end;
+	r->m_first = p_first;
+	r->m_abort = &p_abort;
+	region * worker = r.get();
+	const char * path = m_path;
+	const short * block_size = m_block_size;
+	/* scan ahead of need is done in the background, as the thread that asked for it */
+	const amr_task_priority priority = amr_io_throttle::is_background_thread() ? amr_priority_indexing : amr_priority_decoding;
+	amr_thread_pool::get().submit(worker->m_task, [worker, path, block_size] { worker->walk(path, block_size); }, priority);
+	m_regions.push_back(std::move(r));
+}
+
+bool amr_parallel_scan::find_offset(const region & p_region, t_filesize p_offset, t_size & p_skip) const {
+	t_filesize at = p_region.m_sync;
+	t_size skip = 0;
+	for (; at < p_offset && skip < p_region.m_headers.get_size(); ++skip) at += 1 + m_block_size[(p_region.m_headers[skip] >> 3) & 0x0F];
+	p_skip = skip;
+	return at == p_offset;
+}
+
+t_filesize amr_parallel_scan::run(t_filesize p_start, t_filesize p_end, std::function<void(const t_uint8 *, t_size, t_filesize)> p_frames, abort_callback & p_abort) {
+	const t_size threads = pfc::max_t<t_size>(amr_thread_pool::get().get_workers(), 2);
+	t_filesize verified = p_start, next = p_start;
+	while (next < p_end || !m_regions.empty()) {
+		p_abort.check();
+		/* keep every worker busy */
+		while (next < p_end && m_regions.size() < threads) {
+			const t_filesize end = pfc::min_t<t_filesize>(next + amr_scan_region_size, p_end);
+			launch(next, end, p_end, next == p_start, p_abort);
+			next = end;
+		}
+		region & r = *m_regions.front();
+		r.m_task.wait();
+		t_size skip;
+		/* regions don't join up here; the rest is walked sequentially */
+		if (!r.m_ok || !find_offset(r, verified, skip)) break;
+		if (skip < r.m_headers.get_size()) p_frames(r.m_headers.get_ptr() + skip, r.m_headers.get_size() - skip, verified);
+		verified = r.m_stop;
+		if (!r.m_whole) break;
+		m_regions.pop_front();
+	}
+	m_regions.clear();
+	return verified;
+}
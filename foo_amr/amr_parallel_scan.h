@@ -0,0 +1,72 @@
+/**
+ * foo_input_amr - scanning of very large files on several threads
+*/
+#pragma once
+
+#include <deque>
+#include <functional>
+#include <memory>
+
+enum {
+	/* bytes of a region walked by one worker, a few hours of audio */
+	amr_scan_region_size = 8 * 1024 * 1024,
+	/* files smaller than that are not worth the threads; they're loaded and walked in memory anyway, see amr_max_loaded_size */
+	amr_scan_min_size = 8 * amr_scan_region_size,
+	/* frames with valid headers in a row, a second of them, that a worker takes for where frames of its region start */
+	amr_scan_sync_frames = 50,
+	/* bytes read past the end of a region, so its last frame and a run of them starting right before its end are read whole */
+	amr_scan_overlap = amr_scan_sync_frames * 32,
+};
+
+/**
+ * Walks frames of a very large single channel file on several threads, so indexing of a recording gigabytes
+ * long goes as fast as the disk reads rather than as fast as one thread walks. File is split into regions of
+ * amr_scan_region_size bytes, and each is read and walked by a worker of amr_thread_pool on its own file
+ * handle. Frame boundaries are known only by walking from the first frame, so a worker takes for the start
+ * of its region the first amr_scan_sync_frames frames in a row with valid headers, see amr_frame_reader::find_run(),
+ * and walks frames from there past the end of the region.
+ *
+ * Regions are then joined in order: the walk of the region before has to end where the next one's starts,
+ * or lead to one of its frames, as a run found in the middle of a frame soon falls into step. Headers of
+ * frames are handed out only as far as regions join up so and have nothing but valid headers; beyond that,
+ * as at damaged data, the caller walks frames sequentially, so the result is always the same as if the whole
+ * file was walked one frame after another. Multichannel files aren't walked so, as frames of channels can't
+ * be told apart in the middle of a file.
+ *
+ * @since   1.2.0
+ */
+class amr_parallel_scan {
+public:
+	/* both defined where region is complete */
+	amr_parallel_scan(const char * p_path, const short * p_block_size);
+	~amr_parallel_scan();
+
+	/* "scan very large files on several threads" preference */
+	static bool is_enabled();
+
+	/**
+	 * Walks frames from p_start to p_end, see class description.
+	 *
+	 * @param p_start		offset of the first frame
+	 * @param p_end			offset frames end at
+	 * @param p_frames		gets headers of consecutive frames, a region at a time, with offset of the first one
+	 * @param p_abort		abort callback
+	 * @return				offset of the frame after the ones handed out, where the caller is to go on sequentially
+	 * @since				1.2.0
+	 */
+	t_filesize run(t_filesize p_start, t_filesize p_end, std::function<void(const t_uint8 *, t_size, t_filesize)> p_frames, abort_callback & p_abort);
+
+private:
+	struct region;
+
+	/* starts worker walking region from p_begin, the next one starting at p_next; first region starts with a frame */
+	void launch(t_filesize p_begin, t_filesize p_next, t_filesize p_end, bool p_first, abort_callback & p_abort);
+
+	/* walk of p_region has a frame at p_offset, after p_skip frames; false if it has none there */
+	bool find_offset(const region & p_region, t_filesize p_offset, t_size & p_skip) const;
+
+	pfc::string8 m_path;
+	const short * m_block_size;
+	/* regions being walked, in file order */
+	std::deque<std::unique_ptr<region>> m_regions;
+};
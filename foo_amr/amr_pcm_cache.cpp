@@ -0,0 +1,109 @@
+/**
+ * foo_input_amr - in-memory cache of decoded audio, for replaying and looping
+*/
+#include "../foo_sdk/foobar2000/SDK/foobar2000.h"
+#include "amr_pcm_cache.h"
+#include "amr_memory_budget.h"
+#include "amr_counters.h"
+#include "amr_tuning.h"
+
+/* an hour of mono audio is 110 MB decoded; more than a few of them is hardly replayed */
+static const t_uint64 amr_pcm_cache_max_megabytes = 1024;
+
+static advconfig_integer_factory g_amr_pcm_cache("AMR decoder: memory for decoded audio kept for replaying, in MB, 0 not to keep any",
+	{ 0x44834443, 0x1ac4, 0x46ce,{ 0x97, 0x51, 0x7a, 0x88, 0x8e, 0x32, 0xcf, 0x59 } },
+	advconfig_branch::guid_branch_decoding, 13, 32, 0, amr_pcm_cache_max_megabytes);
+
+/* cache size in megabytes, as set in preferences; converting and low memory profiles keep none, as nothing is replayed there */
+static t_uint64 amr_pcm_cache_megabytes() {
+	const t_uint64 custom = pfc::min_t<t_uint64>(g_amr_pcm_cache.get(), amr_pcm_cache_max_megabytes);
+	return amr_tuned<t_uint64>(custom, custom, 0, 0);
+}
+
+/* cache size in bytes */
+static t_size amr_pcm_cache_size() {
+	return (t_size)amr_pcm_cache_megabytes() << 20;
+}
+
+amr_pcm_cache & amr_pcm_cache::get() {
+	static amr_pcm_cache instance;
+	return instance;
+}
+
+bool amr_pcm_cache::is_enabled() {
+	return amr_pcm_cache_megabytes() > 0;
+}
+
+std::list<amr_pcm_cache::segment_ptr>::iterator amr_pcm_cache::find(const char * p_path, const t_filestats & p_stats, unsigned p_channels, unsigned p_frame) {
+	/* looked up once a chunk; the most recently used ones are most likely */
+	for (std::list<segment_ptr>::iterator walk = m_segments.end(); walk != m_segments.begin();) {
+		const segment & s = **--walk;
+		if (p_frame >= s.m_first && p_frame - s.m_first < s.m_frames && s.m_channels == p_channels && s.m_stats == p_stats && s.m_path == p_path) return walk;
+	}
+	return m_segments.end();
+}
+
+amr_pcm_cache::segment_ptr amr_pcm_cache::query(const char * p_path, const t_filestats & p_stats, unsigned p_channels, unsigned p_frame) {
+	amr_count(amr_counter_pcm_lookups);
+	insync(m_lock);
+	const std::list<segment_ptr>::iterator found = find(p_path, p_stats, p_channels, p_frame);
+	if (found == m_segments.end()) return segment_ptr();
+	amr_count(amr_counter_pcm_hits);
+	m_segments.splice(m_segments.end(), m_segments, found);
+	return *found;
+}
+
+void amr_pcm_cache::store(const char * p_path, const t_filestats & p_stats, unsigned p_channels, unsigned p_first, unsigned p_frames, const audio_sample * p_samples) {
+	if (p_stats.m_timestamp == filetimestamp_invalid || p_frames == 0) return;
+	const t_size size = amr_pcm_cache_size();
+	const t_size count = (t_size)p_frames * amr_pcm_frame_samples * p_channels;
+	if (count * sizeof(audio_sample) > size) return;
+	{
+		insync(m_lock);
+		/* frames already there, as their segment was served and its end decoded again, need not be twice */
+		for (unsigned frame = p_first; ; ) {
+			const std::list<segment_ptr>::iterator found = find(p_path, p_stats, p_channels, frame);
+			if (found == m_segments.end()) break;
+			frame = (*found)->m_first + (*found)->m_frames;
+			if (frame >= p_first + p_frames) return;
+		}
+	}
+
+	/* copied without holding the lock, others may be looking up meanwhile */
+	std::shared_ptr<segment> s = std::make_shared<segment>();
+	s->m_path = p_path;
+	s->m_stats = p_stats;
+	s->m_channels = p_channels;
+	s->m_first = p_first;
+	s->m_frames = p_frames;
+	s->m_samples.set_size(count);
+	memcpy(s->m_samples.get_ptr(), p_samples, count * sizeof(audio_sample));
+
+	{
+		insync(m_lock);
+		m_segments.push_back(s);
+		m_bytes += count * sizeof(audio_sample);
+		while (m_bytes > size) {
+			m_bytes -= m_segments.front()->m_samples.get_size() * sizeof(audio_sample);
+			m_segments.pop_front();
+		}
+	}
+	amr_memory_budget::get().enforce();
+}
+
+t_size amr_pcm_cache::get_memory() {
+	insync(m_lock);
+	return m_bytes;
+}
+
+t_size amr_pcm_cache::trim(t_size p_bytes) {
+	insync(m_lock);
+	t_size dropped = 0;
+	while (dropped < p_bytes && !m_segments.empty()) {
+		const t_size size = m_segments.front()->m_samples.get_size() * sizeof(audio_sample);
+		m_bytes -= size;
+		dropped += size;
+		m_segments.pop_front();
+	}
+	return dropped;
+}
@@ -0,0 +1,91 @@
+/**
+ * foo_input_amr - in-memory cache of decoded audio, for replaying and looping
+*/
+#pragma once
+
+#include <list>
+#include <memory>
+
+enum {
+	/* samples decoded from one frame */
+	amr_pcm_frame_samples = 160,
+};
+
+/**
+ * Keeps recently decoded audio of files, so playing a section again, as looping or seeking back
+ * does, copies it instead of decoding it once more. Audio is kept in segments of one chunk each, as
+ * decode_run() made them, at 8 kHz before any upsampling, and only if decoded exactly as from the
+ * start of the file, so it's the same as decoding it again would be. Segments are keyed by path and
+ * are valid only as long as file size and timestamp stay the same. The cache is shared by all inputs
+ * and holds as much as set in preferences; least recently used segments are dropped to stay below
+ * that, and below what amr_memory_budget leaves to it. All methods are thread-safe.
+ *
+ * @since   1.2.0
+ */
+class amr_pcm_cache {
+public:
+	/* decoded audio of consecutive frames of a file */
+	struct segment {
+		pfc::string8 m_path;
+		t_filestats m_stats;
+		unsigned m_channels;
+		/* number of the first frame, and number of frames */
+		unsigned m_first;
+		unsigned m_frames;
+		/* amr_pcm_frame_samples samples of each channel per frame, interleaved */
+		pfc::array_t<audio_sample> m_samples;
+	};
+	/* segment stays valid while held, even if the cache drops it meanwhile */
+	typedef std::shared_ptr<const segment> segment_ptr;
+
+	/* the one instance shared by all inputs */
+	static amr_pcm_cache & get();
+
+	/* "memory for decoded audio" preference is not 0 */
+	static bool is_enabled();
+
+	/**
+	 * Looks up decoded audio of given frame, and makes its segment the most recently used one.
+	 *
+	 * @param p_path		path to file
+	 * @param p_stats		current stats of the file
+	 * @param p_channels	number of channels of the file
+	 * @param p_frame		number of the frame
+	 * @return				segment holding the frame, or null if there is none
+	 * @since				1.2.0
+	 */
+	segment_ptr query(const char * p_path, const t_filestats & p_stats, unsigned p_channels, unsigned p_frame);
+
+	/**
+	 * Stores decoded audio of consecutive frames, unless segments already there hold all of them, and
+	 * drops least recently used segments if the cache grows over its size. Files without valid timestamp
+	 * can't be told apart from their modified versions, so they're not cached at all.
+	 *
+	 * @param p_path		path to file
+	 * @param p_stats		stats of the file at the time of decoding
+	 * @param p_channels	number of channels of the file
+	 * @param p_first		number of the first frame
+	 * @param p_frames		number of frames
+	 * @param p_samples		amr_pcm_frame_samples samples of each channel per frame, interleaved
+	 * @since				1.2.0
+	 */
+	void store(const char * p_path, const t_filestats & p_stats, unsigned p_channels, unsigned p_first, unsigned p_frames, const audio_sample * p_samples);
+
+	/* size of samples of all segments, for amr_memory_budget */
+	t_size get_memory();
+
+	/* drops least recently used segments until p_bytes of them are dropped or there are none left; returns bytes dropped */
+	t_size trim(t_size p_bytes);
+
+private:
+	amr_pcm_cache() : m_bytes(0) {}
+
+	/* segment of given file holding given frame, or end of m_segments; m_lock must be held */
+	std::list<segment_ptr>::iterator find(const char * p_path, const t_filestats & p_stats, unsigned p_channels, unsigned p_frame);
+
+	critical_section m_lock;
+	/* least recently used first */
+	std::list<segment_ptr> m_segments;
+	/* size of samples of all segments */
+	t_size m_bytes;
+};
@@ -0,0 +1,364 @@
+/**
+ * foo_input_amr - decoded audio of often played files, kept on disk
+*/
+#include "../foo_sdk/foobar2000/SDK/foobar2000.h"
+#include <algorithm>
+#include <vector>
+#include "amr_pcm_cache.h"
+#include "amr_pcm_disk_cache.h"
+#include "amr_counters.h"
+
+enum {
+	/* files are played this often at most before their audio is written */
+	amr_pcm_disk_max_plays = 100,
+	/* files whose plays are counted without their audio on disk; least recently played ones beyond that are forgotten */
+	amr_pcm_disk_max_counted = 4096,
+};
+
+/* an hour of mono audio is 110 MB decoded */
+static const t_uint64 amr_pcm_disk_max_megabytes = 64 * 1024;
+
+/* folder of audio files, and file of counts and entries, in profile directory; bump version, whenever layout of either changes */
+static const char g_disk_folder_name[] = "foo_input_amr.pcm";
+static const char g_disk_index_name[] = "foo_input_amr.plays";
+static const t_uint32 g_disk_index_magic = 0x44524d41; /* "AMRD" */
+static const t_uint32 g_disk_file_magic = 0x41524d41; /* "AMRA" */
+static const t_uint32 g_disk_version = 1;
+
+/* header of each audio file; samples follow */
+struct amr_pcm_disk_header {
+	t_uint32 m_magic, m_version, m_channels, m_frames;
+	t_uint64 m_size, m_timestamp;
+};
+static_assert(sizeof(amr_pcm_disk_header) % sizeof(audio_sample) == 0, "samples must be aligned");
+
+static advconfig_integer_factory g_amr_pcm_disk("AMR decoder: disk space for decoded audio of often played files, in MB, 0 not to keep any",
+	{ 0x5d0c7a3e, 0x91b4, 0x4e2f,{ 0xa8, 0x63, 0x1f, 0x07, 0xd5, 0x9c, 0x2b, 0x84 } },
+	advconfig_branch::guid_branch_decoding, 36, 0, 0, amr_pcm_disk_max_megabytes);
+
+static advconfig_integer_factory g_amr_pcm_disk_plays("AMR decoder: plays of a file before its decoded audio is kept on disk",
+	{ 0xe7462b19, 0x3c85, 0x4a0d,{ 0xb2, 0x5f, 0x94, 0x6e, 0x08, 0xc3, 0x71, 0xda } },
+	advconfig_branch::guid_branch_decoding, 37, 3, 1, amr_pcm_disk_max_plays);
+
+/* disk space in bytes, as set in preferences */
+static t_uint64 amr_pcm_disk_size() {
+	return pfc::min_t<t_uint64>(g_amr_pcm_disk.get(), amr_pcm_disk_max_megabytes) << 20;
+}
+
+/* native path of the folder of audio files */
+static pfc::string8 amr_pcm_disk_folder() {
+	pfc::string8 folder;
+	if (!filesystem::g_get_native_path(core_api::pathInProfile(g_disk_folder_name), folder)) folder.reset();
+	return folder;
+}
+
+/* native path of audio file of given number, with given extension: ".pcm", or ".tmp" while it's written */
+static pfc::stringcvt::string_os_from_utf8 amr_pcm_disk_path(t_uint32 p_id, const char * p_extension) {
+	pfc::string8 path = amr_pcm_disk_folder();
+	path << "\\" << pfc::format_hex(p_id, 8) << p_extension;
+	return pfc::stringcvt::string_os_from_utf8(path);
+}
+
+/* bytes of audio file of given file */
+static t_uint64 amr_pcm_disk_bytes(unsigned p_channels, unsigned p_frames) {
+	return sizeof(amr_pcm_disk_header) + (t_uint64)p_frames * amr_pcm_frame_samples * p_channels * sizeof(audio_sample);
+}
+
+amr_pcm_disk_cache::mapping::~mapping() {
+	if (m_view != NULL) UnmapViewOfFile(m_view);
+	if (m_map != NULL) CloseHandle(m_map);
+	if (m_file != INVALID_HANDLE_VALUE) CloseHandle(m_file);
+}
+
+const audio_sample * amr_pcm_disk_cache::mapping::get_samples() const {
+	return reinterpret_cast<const audio_sample *>(static_cast<const t_uint8 *>(m_view) + sizeof(amr_pcm_disk_header));
+}
+
+amr_pcm_disk_cache::writer::~writer() {
+	if (m_file != INVALID_HANDLE_VALUE) finish(false);
+}
+
+bool amr_pcm_disk_cache::writer::write(unsigned p_first, unsigned p_frames, const audio_sample * p_samples) {
+	if (m_file == INVALID_HANDLE_VALUE) return false;
+	if (p_first != m_written || p_frames > m_frames - m_written) {
+		finish(false);
+		return false;
+	}
+	const DWORD bytes = (DWORD)((t_size)p_frames * amr_pcm_frame_samples * m_channels * sizeof(audio_sample));
+	DWORD done;
+	if (!WriteFile(m_file, p_samples, bytes, &done, NULL) || done != bytes) {
+		finish(false);
+		return false;
+	}
+	m_written += p_frames;
+	if (m_written == m_frames) finish(true);
+	return true;
+}
+
+void amr_pcm_disk_cache::writer::finish(bool p_complete) {
+	CloseHandle(m_file);
+	m_file = INVALID_HANDLE_VALUE;
+	/* file is complete once it has its final name, so one cut short by a crash is never taken for audio */
+	const bool complete = p_complete && MoveFileEx(amr_pcm_disk_path(m_id, ".tmp"), amr_pcm_disk_path(m_id, ".pcm"), MOVEFILE_REPLACE_EXISTING);
+	if (!complete) DeleteFile(amr_pcm_disk_path(m_id, ".tmp"));
+	amr_pcm_disk_cache::get().on_written(*this, complete ? m_id : 0);
+}
+
+amr_pcm_disk_cache & amr_pcm_disk_cache::get() {
+	static amr_pcm_disk_cache instance;
+	return instance;
+}
+
+bool amr_pcm_disk_cache::is_enabled() {
+	return amr_pcm_disk_size() > 0;
+}
+
+amr_pcm_disk_cache::mapping_ptr amr_pcm_disk_cache::play(const char * p_path, const t_filestats & p_stats, unsigned p_channels, unsigned p_frames, std::unique_ptr<writer> & p_writer) {
+	p_writer.reset();
+	if (p_stats.m_timestamp == filetimestamp_invalid || p_frames == 0) return mapping_ptr();
+	const t_uint64 bytes = amr_pcm_disk_bytes(p_channels, p_frames);
+	pfc::list_t<t_uint32> dropped;
+	t_uint32 id = 0, written = 0;
+	{
+		insync(m_lock);
+		ensure_loaded();
+		if (!m_entries.have_item(p_path) && m_entries.get_count() >= amr_pcm_disk_max_counted) {
+			/* plays of the file not played for the longest time are forgotten */
+			const pfc::string8 * oldest = NULL;
+			t_uint64 used = ~(t_uint64)0;
+			m_entries.enumerate([&](const pfc::string8 & p_name, const entry & p_entry) {
+				if (p_entry.m_id == 0 && !p_entry.m_writing && p_entry.m_used < used) {
+					oldest = &p_name;
+					used = p_entry.m_used;
+				}
+			});
+			if (oldest != NULL) m_entries.remove(pfc::string8(*oldest));
+		}
+		entry & e = m_entries.find_or_add(p_path);
+		if (!(e.m_stats == p_stats) || e.m_channels != p_channels || e.m_frames != p_frames) {
+			/* file changed, so its plays count from now on; audio being written is of what it was */
+			drop_audio(e, dropped);
+			e.m_writing = false;
+			e.m_stats = p_stats;
+			e.m_channels = p_channels;
+			e.m_frames = p_frames;
+			e.m_plays = 0;
+		}
+		e.m_plays = pfc::min_t<t_uint32>(e.m_plays + 1, amr_pcm_disk_max_plays);
+		e.m_used = ++m_clock;
+		m_dirty = true;
+		if (e.m_id != 0) id = e.m_id;
+		else if (!e.m_writing && e.m_plays >= g_amr_pcm_disk_plays.get() && bytes <= amr_pcm_disk_size()) {
+			e.m_writing = true;
+			written = ++m_next_id;
+		}
+	}
+	for (t_size i = 0; i < dropped.get_count(); ++i) DeleteFile(amr_pcm_disk_path(dropped[i], ".pcm"));
+	dropped.remove_all();
+
+	amr_count(amr_counter_disk_lookups);
+	if (id != 0) {
+		mapping_ptr found = map(id, p_stats, p_channels, p_frames);
+		if (found) {
+			amr_count(amr_counter_disk_hits);
+			return found;
+		}
+		/* file is gone, damaged, or can't be mapped; it's written again on a later play */
+		{
+			insync(m_lock);
+			entry * e = m_entries.query_ptr(p_path);
+			if (e != NULL && e->m_id == id) drop_audio(*e, dropped);
+		}
+		for (t_size i = 0; i < dropped.get_count(); ++i) DeleteFile(amr_pcm_disk_path(dropped[i], ".pcm"));
+		return mapping_ptr();
+	}
+
+	if (written != 0) {
+		std::unique_ptr<writer> w(new writer());
+		w->m_path = p_path;
+		w->m_stats = p_stats;
+		w->m_channels = p_channels;
+		w->m_frames = p_frames;
+		w->m_written = 0;
+		w->m_id = written;
+		amr_pcm_disk_header header = { g_disk_file_magic, g_disk_version, p_channels, p_frames, p_stats.m_size, p_stats.m_timestamp };
+		CreateDirectory(pfc::stringcvt::string_os_from_utf8(amr_pcm_disk_folder()), NULL);
+		w->m_file = CreateFile(amr_pcm_disk_path(written, ".tmp"), GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+		DWORD done;
+		if (w->m_file != INVALID_HANDLE_VALUE && WriteFile(w->m_file, &header, sizeof(header), &done, NULL) && done == sizeof(header)) p_writer = std::move(w);
+		/* writer that could not start ends here, and the file is written again on a later play */
+		else if (w->m_file != INVALID_HANDLE_VALUE) w->finish(false);
+		else on_written(*w, 0);
+	}
+	return mapping_ptr();
+}
+
+void amr_pcm_disk_cache::on_written(const writer & p_writer, t_uint32 p_id) {
+	pfc::list_t<t_uint32> dropped;
+	{
+		insync(m_lock);
+		entry * e = m_entries.query_ptr(p_writer.m_path);
+		if (e != NULL && e->m_writing && e->m_stats == p_writer.m_stats && e->m_channels == p_writer.m_channels && e->m_frames == p_writer.m_frames) {
+			e->m_writing = false;
+			if (p_id != 0) {
+				e->m_id = p_id;
+				e->m_bytes = amr_pcm_disk_bytes(p_writer.m_channels, p_writer.m_frames);
+				m_bytes += e->m_bytes;
+				m_dirty = true;
+				trim(dropped);
+			}
+		}
+		/* file changed while it was written */
+		else if (p_id != 0) dropped.add_item(p_id);
+	}
+	for (t_size i = 0; i < dropped.get_count(); ++i) DeleteFile(amr_pcm_disk_path(dropped[i], ".pcm"));
+}
+
+amr_pcm_disk_cache::mapping_ptr amr_pcm_disk_cache::map(t_uint32 p_id, const t_filestats & p_stats, unsigned p_channels, unsigned p_frames) {
+	std::shared_ptr<mapping> m = std::make_shared<mapping>();
+	/* cache may delete the file while it's mapped; it goes once the mapping does */
+	m->m_file = CreateFile(amr_pcm_disk_path(p_id, ".pcm"), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (m->m_file == INVALID_HANDLE_VALUE) return mapping_ptr();
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(m->m_file, &size) || (t_uint64)size.QuadPart != amr_pcm_disk_bytes(p_channels, p_frames) || (t_uint64)size.QuadPart > (t_size)~0) return mapping_ptr();
+	m->m_map = CreateFileMapping(m->m_file, NULL, PAGE_READONLY, 0, 0, NULL);
+	if (m->m_map == NULL) return mapping_ptr();
+	/* address space of 32-bit foobar may have no room for a long file */
+	m->m_view = MapViewOfFile(m->m_map, FILE_MAP_READ, 0, 0, 0);
+	if (m->m_view == NULL) return mapping_ptr();
+	const amr_pcm_disk_header & header = *static_cast<const amr_pcm_disk_header *>(m->m_view);
+	if (header.m_magic != g_disk_file_magic || header.m_version != g_disk_version || header.m_channels != p_channels || header.m_frames != p_frames
+		|| header.m_size != p_stats.m_size || header.m_timestamp != p_stats.m_timestamp) return mapping_ptr();
+	return m;
+}
+
+void amr_pcm_disk_cache::drop_audio(entry & p_entry, pfc::list_t<t_uint32> & p_delete) {
+	if (p_entry.m_id == 0) return;
+	p_delete.add_item(p_entry.m_id);
+	m_bytes -= p_entry.m_bytes;
+	p_entry.m_id = 0;
+	p_entry.m_bytes = 0;
+	m_dirty = true;
+}
+
+void amr_pcm_disk_cache::trim(pfc::list_t<t_uint32> & p_delete) {
+	const t_uint64 size = amr_pcm_disk_size();
+	if (m_bytes <= size) return;
+	std::vector<entry *> held;
+	m_entries.enumerate([&](const pfc::string8 &, entry & p_entry) {
+		if (p_entry.m_id != 0) held.push_back(&p_entry);
+	});
+	std::sort(held.begin(), held.end(), [](const entry * a, const entry * b) { return a->m_used < b->m_used; });
+	for (size_t i = 0; i < held.size() && m_bytes > size; ++i) drop_audio(*held[i], p_delete);
+}
+
+void amr_pcm_disk_cache::ensure_loaded() {
+	if (m_loaded) return;
+	m_loaded = true;
+	try {
+		abort_callback_dummy abort;
+		const pfc::string8 path = core_api::pathInProfile(g_disk_index_name);
+		if (filesystem::g_exists(path, abort)) {
+			file::ptr f;
+			filesystem::g_open_read(f, path, abort);
+			t_uint32 magic, version, count;
+			f->read_lendian_t(magic, abort);
+			f->read_lendian_t(version, abort);
+			if (magic == g_disk_index_magic && version == g_disk_version) {
+				f->read_lendian_t(m_next_id, abort);
+				f->read_lendian_t(count, abort);
+				for (t_uint32 i = 0; i < count; ++i) {
+					pfc::string8 name;
+					entry e;
+					f->read_string(name, abort);
+					f->read_lendian_t(e.m_stats.m_size, abort);
+					f->read_lendian_t(e.m_stats.m_timestamp, abort);
+					f->read_lendian_t(e.m_channels, abort);
+					f->read_lendian_t(e.m_frames, abort);
+					f->read_lendian_t(e.m_plays, abort);
+					f->read_lendian_t(e.m_used, abort);
+					f->read_lendian_t(e.m_id, abort);
+					e.m_bytes = e.m_id != 0 ? amr_pcm_disk_bytes(e.m_channels, e.m_frames) : 0;
+					m_bytes += e.m_bytes;
+					m_clock = pfc::max_t(m_clock, e.m_used);
+					m_entries.set(name, e);
+				}
+			}
+		}
+	} catch (std::exception const &) {
+		/* damaged or unreadable counts are as good as none; files they held are deleted below */
+		m_entries.remove_all();
+		m_bytes = 0;
+	}
+
+	/* files of no entry are left from writes cut short, or from entries dropped when the counts couldn't be saved */
+	std::vector<t_uint32> held;
+	m_entries.enumerate([&](const pfc::string8 &, const entry & p_entry) {
+		if (p_entry.m_id != 0) held.push_back(p_entry.m_id);
+	});
+	std::sort(held.begin(), held.end());
+	pfc::string8 pattern = amr_pcm_disk_folder();
+	pattern << "\\*";
+	WIN32_FIND_DATA found;
+	const HANDLE find = FindFirstFile(pfc::stringcvt::string_os_from_utf8(pattern), &found);
+	if (find != INVALID_HANDLE_VALUE) {
+		do {
+			if (found.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) continue;
+			const pfc::string8 name = pfc::stringcvt::string_utf8_from_os(found.cFileName);
+			bool keep = false;
+			if (name.length() == 12 && stricmp_utf8(name.get_ptr() + 8, ".pcm") == 0) {
+				try {
+					keep = std::binary_search(held.begin(), held.end(), pfc::atohex<t_uint32>(name, 8));
+				} catch (std::exception const &) {}
+			}
+			if (keep) continue;
+			pfc::string8 path = amr_pcm_disk_folder();
+			path << "\\" << name;
+			DeleteFile(pfc::stringcvt::string_os_from_utf8(path));
+		} while (FindNextFile(find, &found));
+		FindClose(find);
+	}
+
+	/* preference may have been lowered since */
+	pfc::list_t<t_uint32> dropped;
+	trim(dropped);
+	for (t_size i = 0; i < dropped.get_count(); ++i) DeleteFile(amr_pcm_disk_path(dropped[i], ".pcm"));
+}
+
+void amr_pcm_disk_cache::save(abort_callback & p_abort) {
+	insync(m_lock);
+	if (!m_dirty) return;
+	file::ptr f;
+	filesystem::g_open_write_new(f, core_api::pathInProfile(g_disk_index_name), p_abort);
+	f->write_lendian_t(g_disk_index_magic, p_abort);
+	f->write_lendian_t(g_disk_version, p_abort);
+	f->write_lendian_t(m_next_id, p_abort);
+	f->write_lendian_t((t_uint32)m_entries.get_count(), p_abort);
+	m_entries.enumerate([&](const pfc::string8 & p_name, const entry & p_entry) {
+		f->write_string(p_name, p_abort);
+		f->write_lendian_t(p_entry.m_stats.m_size, p_abort);
+		f->write_lendian_t(p_entry.m_stats.m_timestamp, p_abort);
+		f->write_lendian_t(p_entry.m_channels, p_abort);
+		f->write_lendian_t(p_entry.m_frames, p_abort);
+		f->write_lendian_t(p_entry.m_plays, p_abort);
+		f->write_lendian_t(p_entry.m_used, p_abort);
+		f->write_lendian_t(p_entry.m_id, p_abort);
+	});
+	m_dirty = false;
+}
+
+/**
+ * Saves counts and entries when foobar shuts down. Failure to save is not worth bothering the user;
+ * files of entries not saved are deleted on next start.
+ */
+class amr_pcm_disk_cache_initquit : public initquit {
+public:
+	void on_quit() {
+		try {
+			abort_callback_dummy abort;
+			amr_pcm_disk_cache::get().save(abort);
+		} catch (std::exception const &) {}
+	}
+};
+
+static initquit_factory_t<amr_pcm_disk_cache_initquit> g_amr_pcm_disk_cache_initquit;
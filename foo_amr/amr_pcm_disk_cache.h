@@ -0,0 +1,146 @@
+/**
+ * foo_input_amr - decoded audio of often played files, kept on disk
+*/
+#pragma once
+
+#include <memory>
+
+/**
+ * Keeps decoded audio of files played again and again, as recordings many users go back to, in files
+ * in the profile directory, so playing them copies audio from a memory-mapped file rather than decoding
+ * it, and seeks anywhere at once. Plays of each file are counted; once a file was played as often as set
+ * in preferences, the next play that goes from the start to the end writes its audio out as it's decoded,
+ * see writer, so it costs no extra decoding. Audio is kept as amr_pcm_cache keeps it: 8 kHz, before any
+ * upsampling, decoded exactly as from the start of the file. Entries are keyed by path and are valid only
+ * as long as file size and timestamp stay the same. Least recently played files are deleted to keep all
+ * of them within the disk space set in preferences. Counts and entries are saved on shutdown. All methods
+ * are thread-safe.
+ *
+ * @since   1.2.0
+ */
+class amr_pcm_disk_cache {
+public:
+	/* audio of a file mapped into memory; stays valid while held, even if the cache deletes the file meanwhile */
+	class mapping {
+	public:
+		mapping() : m_file(INVALID_HANDLE_VALUE), m_map(NULL), m_view(NULL) {}
+		~mapping();
+
+		/* amr_pcm_frame_samples samples of each channel per frame, interleaved, for all frames of the file */
+		const audio_sample * get_samples() const;
+
+	private:
+		mapping(const mapping &);
+		mapping & operator=(const mapping &);
+		friend class amr_pcm_disk_cache;
+
+		HANDLE m_file, m_map;
+		const void * m_view;
+	};
+	typedef std::shared_ptr<const mapping> mapping_ptr;
+
+	/**
+	 * Writes audio of a file to disk as it's decoded, from the first frame to the last. Once the last one is
+	 * written, the file is handed over to the cache; file left unfinished, as after a seek, is deleted when the
+	 * writer is destroyed. Writes go straight to the operating system, which buffers them, so they neither
+	 * allocate nor wait for the disk.
+	 *
+	 * @since   1.2.0
+	 */
+	class writer {
+	public:
+		~writer();
+
+		/**
+		 * Appends decoded audio.
+		 *
+		 * @param p_first		number of the first frame; has to be the one after the last written
+		 * @param p_frames		number of frames
+		 * @param p_samples		amr_pcm_frame_samples samples of each channel per frame, interleaved
+		 * @return				<code>false</code> if frames don't follow the ones written, or can't be written; writer is done then
+		 * @since				1.2.0
+		 */
+		bool write(unsigned p_first, unsigned p_frames, const audio_sample * p_samples);
+
+	private:
+		writer(const writer &);
+		writer & operator=(const writer &);
+		friend class amr_pcm_disk_cache;
+		writer() : m_file(INVALID_HANDLE_VALUE) {}
+
+		/* closes the file, and hands it over to the cache if it's complete, or deletes it */
+		void finish(bool p_complete);
+
+		pfc::string8 m_path;
+		t_filestats m_stats;
+		unsigned m_channels, m_frames, m_written;
+		t_uint32 m_id;
+		HANDLE m_file;
+	};
+
+	/* the one instance shared by all inputs */
+	static amr_pcm_disk_cache & get();
+
+	/* "disk space for decoded audio" preference is not 0 */
+	static bool is_enabled();
+
+	/**
+	 * Counts a play of a file, and looks up its audio. File played often enough whose audio isn't there yet
+	 * gets a writer, unless another input writes it already.
+	 *
+	 * @param p_path		path to file
+	 * @param p_stats		current stats of the file
+	 * @param p_channels	number of channels of the file
+	 * @param p_frames		number of frames of the file
+	 * @param p_writer		receives writer to give audio of the whole file to, or is reset
+	 * @return				audio of the file, or empty pointer if there is none
+	 * @since				1.2.0
+	 */
+	mapping_ptr play(const char * p_path, const t_filestats & p_stats, unsigned p_channels, unsigned p_frames, std::unique_ptr<writer> & p_writer);
+
+	/* writes counts and entries to the profile directory, if anything has changed */
+	void save(abort_callback & p_abort);
+
+private:
+	amr_pcm_disk_cache() : m_loaded(false), m_dirty(false), m_bytes(0), m_clock(0), m_next_id(0) {}
+
+	struct entry {
+		entry() : m_channels(0), m_frames(0), m_plays(0), m_used(0), m_id(0), m_bytes(0), m_writing(false) {}
+		t_filestats m_stats;
+		unsigned m_channels, m_frames;
+		t_uint32 m_plays;
+		/* m_clock when the file was played last */
+		t_uint64 m_used;
+		/* number of the file holding its audio, 0 if there's none, and its size */
+		t_uint32 m_id;
+		t_uint64 m_bytes;
+		/* an input writes the file */
+		bool m_writing;
+	};
+
+	/* called by writer once it's done, with the id of its file if it's complete, 0 if it isn't */
+	void on_written(const writer & p_writer, t_uint32 p_id);
+
+	/* maps file of given entry into memory, checking it's of the file; empty pointer if it can't be */
+	static mapping_ptr map(t_uint32 p_id, const t_filestats & p_stats, unsigned p_channels, unsigned p_frames);
+
+	/* forgets audio of an entry, adding its file to p_delete; m_lock must be held */
+	void drop_audio(entry & p_entry, pfc::list_t<t_uint32> & p_delete);
+
+	/* drops audio of least recently played entries until all of it is within the preference; m_lock must be held */
+	void trim(pfc::list_t<t_uint32> & p_delete);
+
+	/* reads counts and entries, and deletes files no entry holds, unless it was already done; m_lock must be held */
+	void ensure_loaded();
+
+	critical_section m_lock;
+	pfc::map_t<pfc::string8, entry> m_entries;
+	bool m_loaded;
+	bool m_dirty;
+	/* size of all files */
+	t_uint64 m_bytes;
+	/* count of plays, which tells entries played lately */
+	t_uint64 m_clock;
+	/* number of the last file created */
+	t_uint32 m_next_id;
+};
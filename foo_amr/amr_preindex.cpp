@@ -0,0 +1,263 @@
+/**
+ * foo_input_amr - indexing files ahead of playing them, on several threads, and the next track while playing
+*/
+#include "../foo_sdk/foobar2000/SDK/foobar2000.h"
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include "../foo_sdk/foobar2000/helpers/metadb_io_hintlist.h"
+#include "amr_preindex.h"
+#include "amr_thread_pool.h"
+
+/* progress is updated this often while workers index, in seconds */
+static const double g_preindex_progress_period = 0.1;
+/* hints of this many tracks are applied to the database at once */
+static const t_size g_preindex_hint_batch = 1000;
+
+/**
+ * Files to index and what came of it, shared by workers; each takes the next file nobody took yet.
+ * Files are taken largest first, so the last ones to be taken are small, and workers run out of
+ * them at about the same time, rather than all but one waiting for a long recording taken last.
+ *
+ * @since   1.2.0
+ */
+struct amr_preindex_job {
+	amr_preindex_job(const pfc::list_t<pfc::string8> & p_paths, abort_callback & p_abort) : m_paths(p_paths), m_abort(p_abort), m_next(0), m_done(0), m_indexed(0) {}
+
+	/**
+	 * Orders files by cost of indexing them, largest first. Scan walks every byte, so cost is file size;
+	 * frame types that tell decoding cost are what indexing finds out. Files that can't be told size of
+	 * come last, and fail in work() anyway.
+	 */
+	void sort(abort_callback & p_abort) {
+		const t_size count = m_paths.get_count();
+		pfc::array_t<t_filesize> sizes;
+		sizes.set_size(count);
+		m_order.set_size(count);
+		for (t_size i = 0; i < count; ++i) {
+			m_order[i] = i;
+			sizes[i] = 0;
+			try {
+				t_filestats stats;
+				bool writable;
+				filesystem::g_get_stats(m_paths[i], stats, writable, p_abort);
+				if (stats.m_size != filesize_invalid) sizes[i] = stats.m_size;
+			} catch (exception_io const &) {}
+		}
+		std::stable_sort(m_order.get_ptr(), m_order.get_ptr() + count, [&sizes](t_size a, t_size b) { return sizes[a] > sizes[b]; });
+	}
+
+	/**
+	 * Task of a worker: indexes the next file, unless it's aborted. There's a task per file, so workers
+	 * are free for tasks of higher priority between files, see amr_thread_pool.
+	 */
+	void work() {
+		const t_size next = m_next++;
+		if (next >= m_paths.get_count() || m_abort.is_aborting()) return;
+		const t_size i = m_order[next];
+		try {
+			std::unique_ptr<amr_preindex_info> info(new amr_preindex_info);
+			if (amr_preindex_file(m_paths[i], m_abort, info.get())) {
+				++m_indexed;
+				insync(m_lock);
+				m_infos.push_back(std::move(info));
+			}
+		} catch (exception_aborted const &) {
+			return;
+		} catch (std::exception const & e) {
+			insync(m_lock);
+			m_errors << m_paths[i] << ": " << e.what() << "\n";
+		}
+		++m_done;
+	}
+
+	/**
+	 * Hands info of files indexed since the last call to foobar's database as hints, so adding them to the library
+	 * or a playlist opens none of them again for its info. Hints are applied a batch at a time, see
+	 * g_preindex_hint_batch; what's pending at the end is applied by the caller. Called by the thread running the
+	 * job, as p_hints is not to be shared.
+	 */
+	void hint(metadb_io_hintlist & p_hints) {
+		std::vector<std::unique_ptr<amr_preindex_info> > infos;
+		{
+			insync(m_lock);
+			infos.swap(m_infos);
+		}
+		if (infos.empty()) return;
+		auto db = metadb::get();
+		for (size_t i = 0; i < infos.size(); ++i) {
+			const amr_preindex_info & info = *infos[i];
+			for (t_size j = 0; j < info.m_tracks.get_size(); ++j) p_hints.add(db->handle_create(info.m_path, (t_uint32)j), info.m_tracks[j], info.m_stats, true);
+		}
+		if (p_hints.get_pending_count() >= g_preindex_hint_batch) p_hints.run();
+	}
+
+	const pfc::list_t<pfc::string8> & m_paths;
+	/* indexes of the paths in the order they're taken, see sort() */
+	pfc::array_t<t_size> m_order;
+	abort_callback & m_abort;
+	std::atomic<t_size> m_next;
+	/* files done, failed ones included, and files indexed */
+	std::atomic<t_size> m_done;
+	std::atomic<t_size> m_indexed;
+	/* a line per file that failed, and info of files indexed not yet hinted, see hint() */
+	critical_section m_lock;
+	pfc::string_formatter m_errors;
+	std::vector<std::unique_ptr<amr_preindex_info> > m_infos;
+};
+
+/**
+ * Indexes given files on workers of amr_thread_pool, as many at once as there are cores, largest first, see amr_preindex_file(),
+ * and hands info read of them to foobar's database as they're done, see amr_preindex_job::hint().
+ *
+ * @param p_paths		AMR files to index
+ * @param p_status		progress
+ * @param p_abort		abort callback
+ * @return				report: how many files were indexed, and why others were not
+ * @since				1.2.0
+ */
+static pfc::string8 amr_preindex_run(const pfc::list_t<pfc::string8> & p_paths, threaded_process_status & p_status, abort_callback & p_abort) {
+	pfc::hires_timer timer;
+	timer.start();
+	amr_preindex_job job(p_paths, p_abort);
+	job.sort(p_abort);
+	const t_size count = p_paths.get_count();
+	std::unique_ptr<amr_task[]> tasks(new amr_task[count]);
+	for (t_size i = 0; i < count; ++i) amr_thread_pool::get().submit(tasks[i], [&job] { job.work(); }, amr_priority_indexing);
+	/* workers don't touch the dialog nor the database; progress is shown, and info hinted, from here */
+	metadb_io_hintlist hints;
+	while (job.m_done < p_paths.get_count()) {
+		p_status.set_progress(job.m_done, p_paths.get_count());
+		job.hint(hints);
+		if (!p_abort.sleep_ex(g_preindex_progress_period)) break;
+	}
+	/* after abort, tasks no worker took yet are run here, and return right away; files indexed by then are hinted still */
+	for (t_size i = 0; i < count; ++i) tasks[i].wait();
+	job.hint(hints);
+	hints.run();
+	p_abort.check();
+
+	pfc::string_formatter report;
+	report << pfc::format_uint(job.m_indexed.load()) << " of " << pfc::format_uint(p_paths.get_count()) << " files indexed in " << pfc::format_float(timer.query(), 0, 1) << " s\n" << job.m_errors;
+	return report;
+}
+
+/**
+ * "Index AMR files" item in the Utilities context menu. Selected AMR files get indexed ahead, on a
+ * worker thread which spreads them over more, so once they're added to the library, its scan and
+ * playing them find the index cached, see amr_index_cache, rather than each scanning its file first.
+ * Their info, exact length and all, goes to the database as they're indexed, so it's not read again.
+ * Report goes to the console.
+ *
+ * @since   1.2.0
+ */
+class amr_preindex_item : public contextmenu_item_simple {
+public:
+	GUID get_parent() { return contextmenu_groups::utilities; }
+	unsigned get_num_items() { return 1; }
+	void get_item_name(unsigned p_index, pfc::string_base & p_out) { p_out = "Index AMR files"; }
+	bool get_item_description(unsigned p_index, pfc::string_base & p_out) {
+		p_out = "Scans the selected AMR files for length, frame types and seek index, and caches what's found, so opening them takes no scan.";
+		return true;
+	}
+	GUID get_item_guid(unsigned p_index) {
+		static const GUID guid_preindex = { 0x4e0a7d31, 0x96bc, 0x4f58,{ 0xa2, 0x1d, 0x7b, 0xe3, 0x05, 0xc9, 0x68, 0x4f } };
+		return guid_preindex;
+	}
+	void context_command(unsigned p_index, metadb_handle_list_cref p_data, const GUID & p_caller) {
+		pfc::list_t<pfc::string8> paths;
+		for (t_size i = 0; i < p_data.get_count(); ++i) {
+			const pfc::string8 path = p_data[i]->get_path();
+			if (stricmp_utf8(pfc::string_extension(path), "amr") != 0) continue;
+			if (!paths.have_item(path)) paths.add_item(path);
+		}
+		if (paths.get_count() == 0) return;
+		const char * title = "Indexing AMR files";
+		std::shared_ptr<pfc::string8> report = std::make_shared<pfc::string8>();
+		threaded_process::g_run_modeless(threaded_process_callback_lambda::create(nullptr,
+			[paths, report](threaded_process_status & p_status, abort_callback & p_abort) {
+				*report = amr_preindex_run(paths, p_status, p_abort);
+			},
+			[report](HWND p_wnd, bool p_was_aborted) {
+				if (p_was_aborted) return;
+				console::formatter() << "AMR indexing: " << *report;
+			}),
+			threaded_process::flag_show_progress | threaded_process::flag_show_abort,
+			core_api::get_main_window(), title);
+	}
+};
+
+static contextmenu_item_factory_t<amr_preindex_item> g_amr_preindex_item;
+
+static advconfig_checkbox_factory g_amr_index_next("AMR decoder: index the next track of the playlist while playing",
+	{ 0x2f84c6d0, 0x7b19, 0x4e3a,{ 0x95, 0xc2, 0x0e, 0x6d, 0x41, 0xa8, 0xf3, 0x57 } },
+	advconfig_branch::guid_branch_decoding, 21, true);
+
+/**
+ * Indexes the track played after the current one as soon as the current one starts, on a worker of
+ * amr_thread_pool, so that when foobar opens it for the gapless transition, a few seconds before the
+ * current one ends, its index is cached and it opens without a scan. The next track is the first one
+ * queued, or the one after the playing one in its playlist; which one shuffle picks is not known ahead.
+ * Indexing of a track that's no longer next is aborted.
+ *
+ * @since   1.2.0
+ */
+class amr_next_track_indexer : public play_callback_static {
+public:
+	unsigned get_flags() { return flag_on_playback_new_track | flag_on_playback_stop; }
+
+	void on_playback_new_track(metadb_handle_ptr p_track) {
+		stop();
+		if (!g_amr_index_next.get()) return;
+		metadb_handle_ptr next = find_next();
+		if (next.is_empty() || next == p_track) return;
+		m_path = next->get_path();
+		if (stricmp_utf8(pfc::string_extension(m_path), "amr") != 0) return;
+		m_abort.reset();
+		amr_thread_pool::get().submit(m_task, [this] {
+			try {
+				amr_preindex_file(m_path, m_abort);
+			} catch (std::exception const &) {
+				/* file that can't be indexed now fails the same way when it's played */
+			}
+		}, amr_priority_indexing);
+	}
+
+	/* shutdown comes by way of stop, so indexing does not hold it up */
+	void on_playback_stop(play_control::t_stop_reason p_reason) { stop(); }
+
+	void on_playback_starting(play_control::t_track_command p_command, bool p_paused) {}
+	void on_playback_seek(double p_time) {}
+	void on_playback_pause(bool p_state) {}
+	void on_playback_edited(metadb_handle_ptr p_track) {}
+	void on_playback_dynamic_info(const file_info & p_info) {}
+	void on_playback_dynamic_info_track(const file_info & p_info) {}
+	void on_playback_time(double p_time) {}
+	void on_volume_change(float p_new_val) {}
+
+private:
+	/* first queued track, or the one after the playing one */
+	static metadb_handle_ptr find_next() {
+		auto playlists = playlist_manager::get();
+		pfc::list_t<t_playback_queue_item> queue;
+		playlists->queue_get_contents(queue);
+		if (queue.get_count() > 0) return queue[0].m_handle;
+		t_size playlist, item;
+		if (!playlists->get_playing_item_location(&playlist, &item)) return metadb_handle_ptr();
+		if (item + 1 >= playlists->playlist_get_item_count(playlist)) return metadb_handle_ptr();
+		return playlists->playlist_get_item_handle(playlist, item + 1);
+	}
+
+	/* aborts indexing started before, and waits for it */
+	void stop() {
+		m_abort.abort();
+		m_task.cancel();
+	}
+
+	pfc::string8 m_path;
+	abort_callback_impl m_abort;
+	amr_task m_task;
+};
+
+static play_callback_static_factory_t<amr_next_track_indexer> g_amr_next_track_indexer;
@@ -0,0 +1,30 @@
+/**
+ * foo_input_amr - indexing files ahead of playing them, on several threads
+*/
+#pragma once
+
+/**
+ * What foobar's database would read of an indexed file: info of each of its tracks, as input_amr gives it, and
+ * stats of the file, so it's handed to the database with no second open, see amr_preindex_run().
+ *
+ * @since   1.2.0
+ */
+struct amr_preindex_info {
+	pfc::string8 m_path;
+	pfc::array_t<file_info_impl> m_tracks;
+	t_filestats m_stats;
+};
+
+/**
+ * Indexes given AMR file as opening it for playing would, unless its index is cached or in its sidecar
+ * already, and caches the index, and writes the sidecar if that's wanted. Files that are streamed
+ * rather than indexed, remote ones, are left alone. Defined by the input, which does the indexing.
+ *
+ * @param p_path		path to file
+ * @param p_abort		abort callback
+ * @param p_info		receives info of the file, if it's indexed, unless <code>NULL</code>
+ * @return				<code>true</code> if the file is indexed, now or before
+ * @throws				exception_io if the file can't be read, or it's not AMR-NB
+ * @since				1.2.0
+ */
+bool amr_preindex_file(const char * p_path, abort_callback & p_abort, amr_preindex_info * p_info = NULL);
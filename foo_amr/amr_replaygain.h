@@ -0,0 +1,175 @@
+/**
+ * foo_input_amr - ReplayGain of decoded audio, measured as it's played
+*/
+#pragma once
+
+#include <math.h>
+
+enum {
+	/* loudness is measured in 400ms blocks, 75% overlapping, so a block starts every 100ms, 5 frames */
+	amr_replaygain_hop_frames = 5,
+	amr_replaygain_block_hops = 4,
+	amr_replaygain_frame_samples = 160,
+	amr_replaygain_max_channels = 6,
+	/* blocks are counted by loudness in 0.1 LU steps from the absolute gate, -70 LUFS, up to +5 LUFS */
+	amr_replaygain_bins = 750,
+	/* track gain of a file whose gain was not measured, in hundredths of dB */
+	amr_gain_none = -32768,
+};
+
+/**
+ * Measures loudness of a track as in ITU-R BS.1770 and EBU R128, and its sample peak, from audio decoded from
+ * the first frame on, chunk after chunk, so a file played through gets ReplayGain without a scan of its own.
+ * Each channel is K-weighted at 8 kHz and counts with weight 1. Blocks are kept as a histogram of their
+ * loudness, each bin with the power of the blocks in it, so memory is the same for any length; relative
+ * gate is applied at bin precision. Gain brings the loudness to -18 LUFS, as the ReplayGain scanner does.
+ *
+ * @since   1.2.0
+ */
+class amr_replaygain {
+public:
+	amr_replaygain() { reset(); }
+
+	/* start over, with nothing measured */
+	void reset() {
+		memset(m_state, 0, sizeof(m_state));
+		memset(m_hop, 0, sizeof(m_hop));
+		memset(m_counts, 0, sizeof(m_counts));
+		memset(m_powers, 0, sizeof(m_powers));
+		m_hops = 0;
+		m_samples = 0;
+		m_peak = 0;
+	}
+
+	/**
+	 * Adds audio following what was added before.
+	 *
+	 * @param p_samples		interleaved samples
+	 * @param p_frames		number of frames they're of
+	 * @param p_channels	number of channels, amr_replaygain_max_channels at most
+	 * @since				1.2.0
+	 */
+	void add(const audio_sample * p_samples, unsigned p_frames, unsigned p_channels) {
+		const filter & k = get_filter();
+		const t_size count = (t_size)p_frames * amr_replaygain_frame_samples;
+		const t_size hop = (t_size)amr_replaygain_hop_frames * amr_replaygain_frame_samples;
+		for (t_size i = 0; i < count; ++i) {
+			double total = 0;
+			for (unsigned c = 0; c < p_channels; ++c) {
+				const audio_sample sample = p_samples[i * p_channels + c];
+				const audio_sample magnitude = sample < 0 ? -sample : sample;
+				if (magnitude > m_peak) m_peak = magnitude;
+				/* two biquads in a row, in direct form I */
+				double * s = m_state[c];
+				const double x = sample;
+				const double y = k.b1[0] * x + k.b1[1] * s[0] + k.b1[2] * s[1] - k.a1[0] * s[2] - k.a1[1] * s[3];
+				s[1] = s[0]; s[0] = x; s[3] = s[2]; s[2] = y;
+				const double z = y - 2 * s[4] + s[5] - k.a2[0] * s[6] - k.a2[1] * s[7];
+				s[5] = s[4]; s[4] = y; s[7] = s[6]; s[6] = z;
+				total += z * z;
+			}
+			m_hop[m_hops % amr_replaygain_block_hops] += total;
+			if (++m_samples == hop) end_hop();
+		}
+	}
+
+	/**
+	 * Gain and peak of the audio added.
+	 *
+	 * @param p_gain		receives track gain in hundredths of dB, amr_gain_none if all blocks were below the absolute gate
+	 * @param p_peak		receives sample peak in 1/65536ths of full scale
+	 * @since				1.2.0
+	 */
+	void finish(t_int32 & p_gain, t_uint32 & p_peak) const {
+		p_peak = (t_uint32)(m_peak * 65536 + 0.5f);
+		p_gain = amr_gain_none;
+		/* relative gate is 10 LU below the mean power of blocks above the absolute one */
+		double power = 0;
+		t_uint64 blocks = 0;
+		for (unsigned i = 0; i < amr_replaygain_bins; ++i) {
+			power += m_powers[i];
+			blocks += m_counts[i];
+		}
+		if (blocks == 0) return;
+		const double relative = loudness(power / blocks) - 10;
+		power = 0;
+		blocks = 0;
+		for (unsigned i = 0; i < amr_replaygain_bins; ++i) {
+			if (-70 + (i + 1) * 0.1 <= relative) continue;
+			power += m_powers[i];
+			blocks += m_counts[i];
+		}
+		if (blocks == 0) return;
+		const double gain = pfc::max_t<double>(pfc::min_t<double>(-18 - loudness(power / blocks), 64), -64);
+		p_gain = (t_int32)floor(gain * 100 + 0.5);
+	}
+
+private:
+	/* K-weighting: high shelf, then high pass, as BS.1770 has them, at 8 kHz */
+	struct filter {
+		double b1[3], a1[2], a2[2];
+	};
+
+	static const filter & get_filter() {
+		static const filter k = make_filter(8000);
+		return k;
+	}
+
+	/* coefficients of both stages for sample rate p_rate, from their analog prototypes */
+	static filter make_filter(double p_rate) {
+		filter f;
+		const double pi = 3.14159265358979323846;
+		double k = tan(pi * 1681.974450955533 / p_rate);
+		double q = 0.7071752369554196;
+		const double vh = pow(10.0, 3.999843853973347 / 20);
+		const double vb = pow(vh, 0.4996667741545416);
+		double a0 = 1 + k / q + k * k;
+		f.b1[0] = (vh + vb * k / q + k * k) / a0;
+		f.b1[1] = 2 * (k * k - vh) / a0;
+		f.b1[2] = (vh - vb * k / q + k * k) / a0;
+		f.a1[0] = 2 * (k * k - 1) / a0;
+		f.a1[1] = (1 - k / q + k * k) / a0;
+		k = tan(pi * 38.13547087602444 / p_rate);
+		q = 0.5003270373238773;
+		a0 = 1 + k / q + k * k;
+		f.a2[0] = 2 * (k * k - 1) / a0;
+		f.a2[1] = (1 - k / q + k * k) / a0;
+		return f;
+	}
+
+	/* loudness of mean square power of K-weighted audio, summed over channels */
+	static double loudness(double p_power) {
+		return -0.691 + 10 * log10(p_power);
+	}
+
+	/* a block ends with each hop, once there are enough of them; its first hop is dropped for the next */
+	void end_hop() {
+		m_samples = 0;
+		++m_hops;
+		if (m_hops >= amr_replaygain_block_hops) {
+			double sum = 0;
+			for (unsigned i = 0; i < amr_replaygain_block_hops; ++i) sum += m_hop[i];
+			const double power = sum / ((double)amr_replaygain_block_hops * amr_replaygain_hop_frames * amr_replaygain_frame_samples);
+			if (power > 0) {
+				const double bin = (loudness(power) + 70) * 10;
+				if (bin >= 0) {
+					const unsigned i = bin >= amr_replaygain_bins ? amr_replaygain_bins - 1 : (unsigned)bin;
+					++m_counts[i];
+					m_powers[i] += power;
+				}
+			}
+		}
+		m_hop[m_hops % amr_replaygain_block_hops] = 0;
+	}
+
+	/* filter memories of each channel, x1 x2 y1 y2 of both stages */
+	double m_state[amr_replaygain_max_channels][8];
+	/* power of the last hops, and of the one being added to, in a ring */
+	double m_hop[amr_replaygain_block_hops];
+	unsigned m_hops;
+	t_size m_samples;
+	/* blocks above the absolute gate, and their total power, by loudness */
+	t_uint64 m_counts[amr_replaygain_bins];
+	double m_powers[amr_replaygain_bins];
+	audio_sample m_peak;
+};
@@ -0,0 +1,287 @@
+/**
+ * foo_input_amr - AMR-NB RTP payloads (RFC 4867) of captured VoIP streams, in rtpdump files
+*/
+#include "../foo_sdk/foobar2000/SDK/foobar2000.h"
+#include "amr_decoder_pool.h"
+#include "amr_rtp_payload.h"
+#include "amr_tuning.h"
+
+enum {
+	/* rtpdump file: text line, then start time, source address and port, and padding */
+	amr_rtp_file_header_size = 16,
+	/* each packet is preceded by its record length, packet length, 0 for RTCP, and offset in milliseconds */
+	amr_rtp_record_header_size = 8,
+	/* timestamp gap up to a minute is filled with NO_DATA frames, as in storage format: DTX pause or lost packets;
+	   bigger one, or a jump back, is taken for a restart of the stream, with no gap */
+	amr_rtp_max_gap_frames = 50 * 60,
+	/* packets looked at to tell octet-aligned payloads from bandwidth-efficient ones */
+	amr_rtp_probe_packets = 16,
+	/* frames decoded and thrown away before seek target, as many as input_amr decodes by default */
+	amr_rtp_seek_warmup_frames = 16,
+	/* file is loaded whole; an hour of a call is about 10 MB */
+	amr_rtp_max_file_size = 256 * 1024 * 1024,
+};
+
+static const char g_rtpdump_magic[] = "#!rtpplay1.0 ";
+
+/**
+ * Plays AMR-NB RTP streams captured to rtpdump files (rtptools, Wireshark "RTP stream" save), in either
+ * payload format of RFC 4867, told apart by which one the first packets parse as. Frames are decoded
+ * right where they are in the packets, see Decoder_Interface_DecodeRTP_float(), so files need not be
+ * repacked to storage format first.
+ *
+ * Packets of the first RTP stream of the file are taken, in order of their timestamps: gap between them,
+ * DTX pause or lost packets, is decoded as NO_DATA frames, as storage format has them, and late or
+ * duplicated packets are dropped, as are packets that don't parse. File is small, so it's loaded whole,
+ * and packets are indexed on open.
+ *
+ * @since   1.2.0
+ */
+class input_amr_rtp : public input_stubs {
+public:
+	static const char * g_get_name() { return "foo_input_amr AMR RTP decoder"; }
+
+	static const GUID g_get_guid() {
+		static const GUID guid = { 0x5b2e8a17, 0xc4d9, 0x4f63,{ 0x8a, 0x05, 0x3e, 0x71, 0xb6, 0x9c, 0x24, 0xd8 } };
+		return guid;
+	}
+
+	/**
+	 * Loads the file and indexes packets of its RTP stream.
+	 *
+	 * @param p_filehint	file object, may be null untill opened.
+	 * @param p_path		path to file
+	 * @param p_reason		reason why the file was opened
+	 * @param p_abort		abort callback
+	 * @throws				exception_io_unsupported_format if it's not an rtpdump file with AMR-NB payloads
+	 * @since				1.2.0
+	 */
+	void open(service_ptr_t<file> p_filehint, const char * p_path, t_input_open_reason p_reason, abort_callback & p_abort) {
+		if (p_reason == input_open_info_write) throw exception_io_unsupported_format();
+		m_file = p_filehint;
+		input_open_file_helper(m_file, p_path, p_reason, p_abort);
+		/* magic first, so other files are not loaded */
+		const t_size magic = sizeof(g_rtpdump_magic) - 1;
+		char head[sizeof(g_rtpdump_magic)];
+		if (m_file->read(head, magic, p_abort) != magic || memcmp(head, g_rtpdump_magic, magic) != 0) throw exception_io_unsupported_format();
+		const t_filesize size = m_file->get_size(p_abort);
+		if (size == filesize_invalid || size > amr_rtp_max_file_size) throw exception_io_unsupported_format();
+		m_file->seek(0, p_abort);
+		m_data.set_size((t_size)size);
+		m_file->read_object(m_data.get_ptr(), m_data.get_size(), p_abort);
+
+		/* text line with source address and port ends the magic */
+		t_size pos = magic;
+		while (pos < m_data.get_size() && m_data[pos] != '\n') ++pos;
+		m_start = pos + 1 + amr_rtp_file_header_size;
+		if (m_start > m_data.get_size()) throw exception_io_unsupported_format();
+
+		index(p_abort);
+		if (m_packets.get_size() == 0) throw exception_io_unsupported_format("No AMR-NB RTP packets in the file");
+	}
+
+	void get_info(file_info & p_info, abort_callback & p_abort) {
+		const double length = (double)m_frames * amr_rtp_frame_samples / amr_rtp_sample_rate;
+		p_info.set_length(length);
+		if (length > 0) p_info.info_set_bitrate((t_int64)(m_payload_bytes * 8 / length + 500) / 1000);
+		p_info.info_set("codec", "AMR-NB");
+		p_info.info_set("encoding", "lossy");
+		p_info.info_set("amr_rtp_payload", m_bandwidth_efficient ? "bandwidth-efficient" : "octet-aligned");
+		p_info.info_set_int("amr_rtp_packets", m_packets.get_size());
+		p_info.info_set_int("samplerate", amr_rtp_sample_rate);
+		p_info.info_set_int("channels", 1);
+	}
+
+	t_filestats get_file_stats(abort_callback & p_abort) { return m_file->get_stats(p_abort); }
+
+	void decode_initialize(unsigned p_flags, abort_callback & p_abort) {
+		go_to(0);
+	}
+
+	bool decode_run(audio_chunk & p_chunk, abort_callback & p_abort) {
+		if (m_frame >= m_frames) return false;
+		/* as many frames a chunk as input_amr decodes, per the setting and profile */
+		const unsigned frames = pfc::min_t<unsigned>(amr_get_tuned_chunk_frames(), m_frames - m_frame);
+		p_chunk.set_data_size(frames * amr_rtp_frame_samples);
+		decode(p_chunk.get_data(), frames);
+		p_chunk.set_srate(amr_rtp_sample_rate);
+		p_chunk.set_channels(1, audio_chunk::channel_config_mono);
+		p_chunk.set_sample_count(frames * amr_rtp_frame_samples);
+		return true;
+	}
+
+	/* decoder starts over a few frames before the target, so it's settled when audio resumes */
+	void decode_seek(double p_seconds, abort_callback & p_abort) {
+		const unsigned target = (unsigned)pfc::min_t<double>(p_seconds * amr_rtp_sample_rate / amr_rtp_frame_samples, m_frames);
+		const unsigned start = target > amr_rtp_seek_warmup_frames ? target - amr_rtp_seek_warmup_frames : 0;
+		go_to(start);
+		m_scratch.set_size((target - start) * amr_rtp_frame_samples);
+		decode(m_scratch.get_ptr(), target - start);
+	}
+
+	bool decode_can_seek() { return true; }
+	bool decode_get_dynamic_info(file_info & p_out, double & p_timestamp_delta) { return false; }
+	bool decode_get_dynamic_info_track(file_info & p_out, double & p_timestamp_delta) { return false; }
+	void decode_on_idle(abort_callback & p_abort) { m_file->on_idle(p_abort); }
+	void retag(const file_info & p_info, abort_callback & p_abort) { throw exception_io_unsupported_format(); }
+
+	static bool g_is_our_content_type(const char * p_content_type) { return false; }
+	static bool g_is_our_path(const char * p_path, const char * p_extension) {
+		return stricmp_utf8(p_extension, "rtpdump") == 0 || stricmp_utf8(p_extension, "rtp") == 0;
+	}
+
+private:
+	/* payload of one packet, and number of its first frame; frames before it not in the packet before are NO_DATA */
+	struct packet {
+		t_size m_offset, m_size;
+		unsigned m_frame, m_frames;
+	};
+
+	/**
+	 * Walks rtpdump records: RTP packets of the first stream, with the same SSRC and payload type, are
+	 * checked, and placed in time by their timestamps, see amr_rtp_max_gap_frames.
+	 */
+	void index(abort_callback & p_abort) {
+		m_packets.set_size(0);
+		m_frames = 0;
+		m_payload_bytes = 0;
+		m_have_stream = false;
+
+		/* payload format is the one all of the first packets parse as; octet-aligned if they parse as both */
+		unsigned probed = 0, octet_aligned = 0, bandwidth_efficient = 0;
+		for (t_size pos = m_start; probed < amr_rtp_probe_packets; ) {
+			t_size offset, size;
+			if (!next_packet(pos, offset, size)) break;
+			if (size == 0) continue;
+			++probed;
+			if (m_frames_of_packet.parse_octet_aligned(m_data.get_ptr() + offset, size)) ++octet_aligned;
+			if (m_frames_of_packet.parse_bandwidth_efficient(m_data.get_ptr() + offset, size)) ++bandwidth_efficient;
+		}
+		m_bandwidth_efficient = bandwidth_efficient > octet_aligned;
+
+		t_uint32 timestamp = 0;
+		t_size count = 0;
+		for (t_size pos = m_start; ; ) {
+			t_size offset, size;
+			t_uint32 packet_timestamp;
+			if (!next_packet(pos, offset, size, &packet_timestamp)) break;
+			if (size == 0 || !m_frames_of_packet.parse(m_data.get_ptr() + offset, size, m_bandwidth_efficient)) continue;
+			p_abort.check();
+
+			unsigned frame = m_frames;
+			if (count > 0) {
+				const t_int32 gap = (t_int32)(packet_timestamp - timestamp);
+				/* late or duplicated packet; timestamp going far back is a restart */
+				if (gap < 0 && gap > -(t_int32)(amr_rtp_max_gap_frames * amr_rtp_frame_samples)) continue;
+				if (gap > 0 && gap <= (t_int32)(amr_rtp_max_gap_frames * amr_rtp_frame_samples)) frame += (unsigned)gap / amr_rtp_frame_samples;
+			}
+			if (count == m_packets.get_size()) m_packets.set_size(pfc::max_t<t_size>(count * 2, 1024));
+			packet & p = m_packets[count++];
+			p.m_offset = offset;
+			p.m_size = size;
+			p.m_frame = frame;
+			p.m_frames = m_frames_of_packet.m_count;
+			m_frames = frame + p.m_frames;
+			m_payload_bytes += size;
+			timestamp = packet_timestamp + p.m_frames * amr_rtp_frame_samples;
+		}
+		m_packets.set_size(count);
+	}
+
+	/**
+	 * Gets payload of next RTP packet of the stream, skipping RTCP and packets of other streams.
+	 *
+	 * @param p_pos			offset of the next record, moved past the packet
+	 * @param p_offset		receives offset of the payload
+	 * @param p_size		receives its length, 0 if the record has no packet of the stream
+	 * @param p_timestamp	receives RTP timestamp of the packet, if not <code>NULL</code>
+	 * @return				<code>false</code> if there are no more whole records
+	 */
+	bool next_packet(t_size & p_pos, t_size & p_offset, t_size & p_size, t_uint32 * p_timestamp = NULL) {
+		const t_uint8 * data = m_data.get_ptr();
+		const t_size end = m_data.get_size();
+		if (end - p_pos < amr_rtp_record_header_size) return false;
+		const t_size length = amr_rtp_get(data + p_pos, 2), packet_length = amr_rtp_get(data + p_pos + 2, 2);
+		if (length < amr_rtp_record_header_size || end - p_pos < length) return false;
+		const t_size start = p_pos + amr_rtp_record_header_size;
+		p_pos += length;
+		p_size = 0;
+		/* RTCP has no packet length; packet may be cut to fewer bytes than it had */
+		const t_size size = pfc::min_t<t_size>(packet_length, length - amr_rtp_record_header_size);
+		if (packet_length == 0 || size < amr_rtp_header_size) return true;
+
+		amr_rtp_header header;
+		if (!header.parse(data + start, size)) return true;
+		if (!m_have_stream) {
+			m_payload_type = header.m_payload_type;
+			m_ssrc = header.m_ssrc;
+			m_have_stream = true;
+		}
+		else if (header.m_payload_type != m_payload_type || header.m_ssrc != m_ssrc) return true;
+		p_offset = start + header.m_offset;
+		p_size = header.m_size;
+		if (p_timestamp != NULL) *p_timestamp = header.m_timestamp;
+		return true;
+	}
+
+	/* decoding goes on from p_frame, with decoder as it is at the start */
+	void go_to(unsigned p_frame) {
+		m_decoder.acquire();
+		m_frame = p_frame;
+		/* first packet not ending before the frame */
+		t_size lo = 0, hi = m_packets.get_size();
+		while (lo < hi) {
+			const t_size mid = (lo + hi) / 2;
+			if (m_packets[mid].m_frame + m_packets[mid].m_frames <= p_frame) lo = mid + 1;
+			else hi = mid;
+		}
+		m_packet = lo;
+		m_parsed = pfc::infinite_size;
+	}
+
+	/* decodes next p_frames frames to p_out, NO_DATA ones where packets are missing */
+	void decode(audio_sample * p_out, unsigned p_frames) {
+		t_uint8 no_data = 0;
+		for (unsigned i = 0; i < p_frames; ++i, ++m_frame) {
+			audio_sample * out = p_out + i * amr_rtp_frame_samples;
+			if (m_packet < m_packets.get_size() && m_frame >= m_packets[m_packet].m_frame + m_packets[m_packet].m_frames) ++m_packet;
+			if (m_packet == m_packets.get_size() || m_frame < m_packets[m_packet].m_frame) {
+				Decoder_Interface_DecodeRTP_float(m_decoder.get(), amr_rtp_no_data << 3 | 0x04, &no_data, 0, out);
+				continue;
+			}
+			const packet & p = m_packets[m_packet];
+			t_uint8 * payload = m_data.get_ptr() + p.m_offset;
+			if (m_parsed != m_packet) {
+				m_frames_of_packet.parse(payload, p.m_size, m_bandwidth_efficient);
+				m_parsed = m_packet;
+			}
+			const unsigned frame = m_frame - p.m_frame;
+			const t_size offset = m_frames_of_packet.m_offset[frame];
+			Decoder_Interface_DecodeRTP_float(m_decoder.get(), m_frames_of_packet.m_toc[frame], payload + offset / 8, (int)(offset % 8), out);
+		}
+	}
+
+	service_ptr_t<file> m_file;
+	/* the whole file, and where its first record is */
+	pfc::array_t<t_uint8> m_data;
+	t_size m_start;
+	/* stream packets are taken from: first RTP packet's */
+	bool m_have_stream;
+	t_uint8 m_payload_type;
+	t_uint32 m_ssrc;
+	bool m_bandwidth_efficient;
+	pfc::array_t<packet> m_packets;
+	unsigned m_frames;
+	t_uint64 m_payload_bytes;
+	/* frame to decode next, packet it's in or before, and that of m_frames_of_packet */
+	unsigned m_frame;
+	t_size m_packet, m_parsed;
+	amr_rtp_frames m_frames_of_packet;
+	/* frames decoded while seeking */
+	pfc::array_t<audio_sample> m_scratch;
+	/* 3gpp decoder, given back to the pool when input is destroyed */
+	amr_decoder m_decoder;
+};
+
+static input_singletrack_factory_t<input_amr_rtp> g_input_amr_rtp_factory;
+DECLARE_FILE_TYPE("AMR RTP captures","*.RTPDUMP;*.RTP");
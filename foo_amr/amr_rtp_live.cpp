@@ -0,0 +1,510 @@
+/**
+ * foo_input_amr - AMR-NB RTP streams (RFC 4867) received live over UDP, to listen to calls as they go on
+*/
+/* sockets before windows.h, which would bring in the old winsock.h */
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#include "../foo_sdk/foobar2000/SDK/foobar2000.h"
+#include <atomic>
+#include <cmath>
+#include "amr_decoder_pool.h"
+#include "amr_rtp_payload.h"
+
+enum {
+	/* every frame is 20ms long */
+	amr_live_frame_ms = 20,
+	/* frames a missing one is waited for past when it was due, before it's taken for lost; jitter moves it between these */
+	amr_live_min_delay_frames = 1,
+	amr_live_max_delay_frames = 8,
+	/* frames of the jitter buffer, a power of two; packet further ahead of playback, or behind it, is a restart of the stream */
+	amr_live_buffer_frames = 256,
+	/* bytes of the biggest frame, and one more for frames not starting at an octet */
+	amr_live_frame_bytes = 33,
+	/* most frames handed out at once, all of them due already */
+	amr_live_chunk_frames = 5,
+	/* largest UDP datagram */
+	amr_live_max_datagram = 65536,
+	/* receiving thread looks at whether it's to stop this often, in ms */
+	amr_live_poll_ms = 100,
+	/* delay is lowered by a frame at most this often, and playback clock follows the sender's, in ms */
+	amr_live_settle_ms = 5000,
+	/* statistics of the stream are updated this often, in ms */
+	amr_live_info_ms = 1000,
+	/* stream ends when no packet came for this long, once it started, in ms */
+	amr_live_timeout_ms = 10000,
+	/* packets of another source are taken once the one played sent none for this long, in ms */
+	amr_live_switch_ms = 1000,
+};
+
+/* missing frame is waited for this many times the jitter packets arrive with */
+static const double g_live_jitter_margin = 3.0;
+
+static const char g_live_scheme[] = "amr-rtp://";
+
+/**
+ * Frames of packets received, placed by their RTP timestamps, until playback takes them, so packets that
+ * come out of order or twice are sorted out. Frame that is there is taken right away; missing one is
+ * waited for till it's due, m_delay frames after the time it would have arrived without jitter, and taken
+ * for lost then. Arrival without jitter is that of the packet that came the soonest, relative to its
+ * timestamp, over the last amr_live_settle_ms, so playback follows the sender's clock.
+ *
+ * Delay adapts: it's raised when jitter, estimated as in RFC 3550 A.8, calls for more, or when a packet
+ * came too late, and lowered a frame at a time, no more often than every amr_live_settle_ms. Not locked;
+ * the input locks it for its receiving thread and playback.
+ *
+ * @since   1.2.0
+ */
+class amr_jitter_buffer {
+public:
+	/* frame taken by playback */
+	struct frame {
+		/* frame is lost: none of the rest is set */
+		bool m_lost;
+		/* table of contents entry, as Decoder_Interface_DecodeRTP_float() takes it */
+		t_uint8 m_toc;
+		/* bits of the frame, starting at bit m_offset of the first byte */
+		t_uint8 m_offset;
+		t_uint8 m_bits[amr_live_frame_bytes];
+	};
+
+	amr_jitter_buffer() : m_late(0), m_restarts(0) { reset(); }
+
+	/* drops frames, and starts over with the next packet; playback takes it for a restart of the stream */
+	void reset() {
+		for (unsigned i = 0; i < amr_live_buffer_frames; ++i) m_slots[i].m_frame = -1;
+		m_started = false;
+		m_next = 0;
+		m_samples = 0;
+		m_delay = amr_live_min_delay_frames;
+		m_jitter = 0;
+		++m_restarts;
+	}
+
+	/**
+	 * Places frames of a packet.
+	 *
+	 * @param p_timestamp	RTP timestamp of the packet
+	 * @param p_payload		its payload
+	 * @param p_frames		frames of the payload
+	 * @param p_now			time it arrived, in ms
+	 * @since				1.2.0
+	 */
+	void put(t_uint32 p_timestamp, const t_uint8 * p_payload, const amr_rtp_frames & p_frames, double p_now) {
+		if (m_started) {
+			/* timestamps wrap around; position in samples goes on from that of the packet before */
+			m_samples += (t_int32)(p_timestamp - m_timestamp);
+			m_timestamp = p_timestamp;
+			const t_int64 first = floor_frame(m_samples);
+			if (first + p_frames.m_count + amr_live_buffer_frames <= m_next || first >= m_next + amr_live_buffer_frames) reset();
+		}
+		if (!m_started) {
+			m_started = true;
+			m_timestamp = p_timestamp;
+			m_samples = 0;
+			m_next = 0;
+			m_anchor = m_window = m_transit = p_now;
+			m_window_start = m_changed = p_now;
+		}
+		const t_int64 first = floor_frame(m_samples);
+
+		/* transit time of the packet, up to what the clocks differ by */
+		const double transit = p_now - first * amr_live_frame_ms;
+		m_jitter += (fabs(transit - m_transit) - m_jitter) / 16;
+		m_transit = transit;
+		m_anchor = pfc::min_t(m_anchor, transit);
+		m_window = pfc::min_t(m_window, transit);
+		if (p_now - m_window_start >= amr_live_settle_ms) {
+			m_anchor = m_window;
+			m_window = transit;
+			m_window_start = p_now;
+		}
+		m_last = p_now;
+
+		bool late = false;
+		for (unsigned i = 0; i < p_frames.m_count; ++i) {
+			const t_int64 number = first + i;
+			if (number < m_next) {
+				late = true;
+				continue;
+			}
+			if (number >= m_next + amr_live_buffer_frames) break;
+			slot & s = m_slots[number & (amr_live_buffer_frames - 1)];
+			/* duplicated packet */
+			if (s.m_frame == number) continue;
+			const t_size offset = p_frames.m_offset[i];
+			s.m_frame = number;
+			s.m_toc = p_frames.m_toc[i];
+			s.m_offset = (t_uint8)(offset % 8);
+			memcpy(s.m_bits, p_payload + offset / 8, (s.m_offset + g_frame_bits[(s.m_toc >> 3) & 0x0F] + 7) / 8);
+		}
+
+		unsigned target = (unsigned)ceil(g_live_jitter_margin * m_jitter / amr_live_frame_ms);
+		target = pfc::min_t<unsigned>(pfc::max_t<unsigned>(target, amr_live_min_delay_frames), amr_live_max_delay_frames);
+		if (late) {
+			++m_late;
+			target = pfc::max_t<unsigned>(target, pfc::min_t<unsigned>(m_delay + 1, amr_live_max_delay_frames));
+		}
+		if (target > m_delay) {
+			m_delay = target;
+			m_changed = p_now;
+		}
+		else if (target < m_delay && p_now - m_changed >= amr_live_settle_ms) {
+			--m_delay;
+			m_changed = p_now;
+		}
+	}
+
+	/**
+	 * Takes frames in order, those that are there and those that are due but missing, up to the first one
+	 * that is neither.
+	 *
+	 * @param p_out			receives the frames
+	 * @param p_max			most frames to take
+	 * @param p_now			time now, in ms
+	 * @param p_wait		receives ms till the next frame is due, if it's not there, or -1 if no packet came yet
+	 * @return				number of frames taken
+	 * @since				1.2.0
+	 */
+	unsigned take(frame * p_out, unsigned p_max, double p_now, double & p_wait) {
+		p_wait = -1;
+		if (!m_started) return 0;
+		unsigned count = 0;
+		for (; count < p_max; ++count, ++m_next) {
+			frame & out = p_out[count];
+			slot & s = m_slots[m_next & (amr_live_buffer_frames - 1)];
+			if (s.m_frame == m_next) {
+				out.m_lost = false;
+				out.m_toc = s.m_toc;
+				out.m_offset = s.m_offset;
+				memcpy(out.m_bits, s.m_bits, amr_live_frame_bytes);
+				s.m_frame = -1;
+				continue;
+			}
+			const double due = m_anchor + (m_next + m_delay) * amr_live_frame_ms;
+			if (p_now < due) {
+				p_wait = due - p_now;
+				break;
+			}
+			out.m_lost = true;
+		}
+		return count;
+	}
+
+	bool is_started() const { return m_started; }
+	/* time the last packet arrived, in ms */
+	double get_last() const { return m_last; }
+	unsigned get_delay_ms() const { return m_delay * amr_live_frame_ms; }
+	double get_jitter_ms() const { return m_jitter; }
+	/* packets that came after some of their frames were taken for lost */
+	unsigned get_late() const { return m_late; }
+	/* number of resets, so playback tells when the stream started over */
+	unsigned get_restarts() const { return m_restarts; }
+
+private:
+	struct slot {
+		/* number of the frame in the slot, -1 for none */
+		t_int64 m_frame;
+		t_uint8 m_toc, m_offset;
+		t_uint8 m_bits[amr_live_frame_bytes];
+	};
+
+	/* number of the frame p_samples into the stream, which is negative before its first packet */
+	static t_int64 floor_frame(t_int64 p_samples) {
+		return (p_samples >= 0 ? p_samples : p_samples - (amr_rtp_frame_samples - 1)) / amr_rtp_frame_samples;
+	}
+
+	slot m_slots[amr_live_buffer_frames];
+	bool m_started;
+	/* timestamp of the last packet, and its position in samples from the first one */
+	t_uint32 m_timestamp;
+	t_int64 m_samples;
+	/* frame playback takes next */
+	t_int64 m_next;
+	unsigned m_delay;
+	/* mean deviation of transit times, transit time of the last packet, and the least of them, all in ms */
+	double m_jitter, m_transit, m_anchor;
+	/* least transit time since m_window_start */
+	double m_window, m_window_start;
+	/* time delay was last changed, and time the last packet arrived */
+	double m_changed, m_last;
+	unsigned m_late, m_restarts;
+};
+
+/**
+ * Plays AMR-NB RTP stream of a live call, received over UDP, so supervisors can listen in as it goes on.
+ * Path is amr-rtp://host:port, host being the address of the interface to listen on, empty for any, or
+ * a multicast group to join. Packets are received on a thread of their own and placed in amr_jitter_buffer;
+ * playback decodes frames as soon as they are there, right where they are in the payloads as the rtpdump
+ * input does, so buffering adds nothing to latency but the wait for a missing frame. Lost frame is decoded
+ * as a bad one of the mode of the frame before, so the decoder conceals it; in DTX pauses, as NO_DATA.
+ *
+ * Payload format is taken from packets, either one of RFC 4867; the first RTP source is played, and
+ * another one once it has sent nothing for amr_live_switch_ms. Stream has no length, and ends when no
+ * packet came for amr_live_timeout_ms. Latency is packetization, network, the delay of the jitter buffer,
+ * 20ms on a quiet network, and what the output buffer holds, which is to be kept short in preferences
+ * for it to stay under 60ms.
+ *
+ * @since   1.2.0
+ */
+class input_amr_rtp_live : public input_stubs {
+public:
+	input_amr_rtp_live() : m_socket(INVALID_SOCKET), m_winsock(false), m_stop(false), m_failed(false), m_restarts(0), m_speech(false), m_mode(0), m_lost(0), m_info_time(0) {}
+	~input_amr_rtp_live() { close(); }
+
+	static const char * g_get_name() { return "foo_input_amr AMR RTP live stream decoder"; }
+
+	static const GUID g_get_guid() {
+		static const GUID guid = { 0x8c4f1d62, 0x2a7b, 0x4e95,{ 0xb3, 0x18, 0x6d, 0xe0, 0x59, 0xa2, 0x7c, 0x41 } };
+		return guid;
+	}
+
+	/**
+	 * Takes the address from the path; nothing is received till decoding starts.
+	 *
+	 * @param p_filehint	not used, there's no file
+	 * @param p_path		amr-rtp://host:port
+	 * @param p_reason		reason why the stream was opened
+	 * @param p_abort		abort callback
+	 * @throws				exception_io_unsupported_format if the path is not such an address
+	 * @since				1.2.0
+	 */
+	void open(service_ptr_t<file> p_filehint, const char * p_path, t_input_open_reason p_reason, abort_callback & p_abort) {
+		if (p_reason == input_open_info_write) throw exception_io_unsupported_format();
+		const char * address = p_path + sizeof(g_live_scheme) - 1;
+		t_size length = strlen(address);
+		while (length > 0 && address[length - 1] == '/') --length;
+		const char * colon = NULL;
+		for (t_size i = 0; i < length; ++i) if (address[i] == ':') colon = address + i;
+		if (colon == NULL) throw exception_io_unsupported_format("AMR RTP stream address is to be amr-rtp://host:port");
+		m_host.set_string(address, colon - address);
+		m_port.set_string(colon + 1, address + length - colon - 1);
+		bool numeric = !m_port.is_empty() && m_port.length() <= 5;
+		for (t_size i = 0; i < m_port.length(); ++i) numeric = numeric && pfc::char_is_numeric(m_port[i]);
+		if (!numeric || pfc::atoui_ex(m_port, m_port.length()) == 0 || pfc::atoui_ex(m_port, m_port.length()) > 65535) throw exception_io_unsupported_format("AMR RTP stream address is to be amr-rtp://host:port");
+	}
+
+	void get_info(file_info & p_info, abort_callback & p_abort) {
+		p_info.info_set("codec", "AMR-NB");
+		p_info.info_set("encoding", "lossy");
+		p_info.info_set("amr_rtp_source", pfc::string_formatter() << (m_host.is_empty() ? "*" : m_host.get_ptr()) << ":" << m_port);
+		p_info.info_set_int("samplerate", amr_rtp_sample_rate);
+		p_info.info_set_int("channels", 1);
+	}
+
+	t_filestats get_file_stats(abort_callback & p_abort) { return filestats_invalid; }
+
+	/* binds the socket and starts receiving */
+	void decode_initialize(unsigned p_flags, abort_callback & p_abort) {
+		close();
+		m_decoder.acquire();
+		m_buffer.reset();
+		m_restarts = m_buffer.get_restarts();
+		m_speech = false;
+		m_lost = 0;
+		m_info_time = 0;
+		m_failed = false;
+		m_stop = false;
+		m_clock.start();
+		listen();
+		m_thread.startHere([this] { receive(); });
+	}
+
+	bool decode_run(audio_chunk & p_chunk, abort_callback & p_abort) {
+		amr_jitter_buffer::frame frames[amr_live_chunk_frames];
+		unsigned count = 0;
+		for (;;) {
+			double wait;
+			{
+				insync(m_lock);
+				if (m_failed) throw exception_io(m_error);
+				m_arrived.set_state(false);
+				const double now = m_clock.query() * 1000;
+				if (m_buffer.is_started() && now - m_buffer.get_last() > amr_live_timeout_ms) return false;
+				/* stream started over: decoder too */
+				if (m_buffer.get_restarts() != m_restarts) {
+					m_restarts = m_buffer.get_restarts();
+					m_decoder.acquire();
+					m_speech = false;
+				}
+				count = m_buffer.take(frames, amr_live_chunk_frames, now, wait);
+			}
+			if (count > 0) break;
+			p_abort.waitForEvent(m_arrived, wait < 0 ? -1 : wait / 1000);
+		}
+
+		p_chunk.set_data_size(count * amr_rtp_frame_samples);
+		audio_sample * out = p_chunk.get_data();
+		for (unsigned i = 0; i < count; ++i, out += amr_rtp_frame_samples) {
+			amr_jitter_buffer::frame & f = frames[i];
+			if (f.m_lost) {
+				/* bad frame of the mode that was on, Q bit clear; lost NO_DATA when there was no speech */
+				memset(f.m_bits, 0, sizeof(f.m_bits));
+				f.m_offset = 0;
+				if (m_speech) {
+					f.m_toc = (t_uint8)(m_mode << 3);
+					++m_lost;
+				}
+				else f.m_toc = (t_uint8)(amr_rtp_no_data << 3 | 0x04);
+			}
+			else {
+				const unsigned type = (f.m_toc >> 3) & 0x0F;
+				m_speech = type < 8;
+				if (m_speech) m_mode = type;
+			}
+			Decoder_Interface_DecodeRTP_float(m_decoder.get(), f.m_toc, f.m_bits, f.m_offset, out);
+		}
+		p_chunk.set_srate(amr_rtp_sample_rate);
+		p_chunk.set_channels(1, audio_chunk::channel_config_mono);
+		p_chunk.set_sample_count(count * amr_rtp_frame_samples);
+		return true;
+	}
+
+	void decode_seek(double p_seconds, abort_callback & p_abort) { throw exception_io_object_not_seekable(); }
+	bool decode_can_seek() { return false; }
+
+	/* delay of the jitter buffer, jitter and frames lost, every amr_live_info_ms */
+	bool decode_get_dynamic_info(file_info & p_out, double & p_timestamp_delta) {
+		const double now = m_clock.query() * 1000;
+		if (now - m_info_time < amr_live_info_ms) return false;
+		m_info_time = now;
+		insync(m_lock);
+		p_out.info_set_int("amr_rtp_delay", m_buffer.get_delay_ms());
+		p_out.info_set("amr_rtp_jitter", pfc::format_float(m_buffer.get_jitter_ms(), 0, 1));
+		p_out.info_set_int("amr_rtp_lost_frames", m_lost);
+		p_out.info_set_int("amr_rtp_late_packets", m_buffer.get_late());
+		p_timestamp_delta = 0;
+		return true;
+	}
+
+	bool decode_get_dynamic_info_track(file_info & p_out, double & p_timestamp_delta) { return false; }
+	void retag(const file_info & p_info, abort_callback & p_abort) { throw exception_io_unsupported_format(); }
+
+	static bool g_is_our_content_type(const char * p_content_type) { return false; }
+	static bool g_is_our_path(const char * p_path, const char * p_extension) {
+		return pfc::strcmp_partial(p_path, g_live_scheme) == 0;
+	}
+
+private:
+	/* opens the socket, bound to the port, and joined to the group if the host is a multicast one */
+	void listen() {
+		WSADATA data;
+		if (WSAStartup(MAKEWORD(2, 2), &data) != 0) throw exception_io("Could not start Windows sockets");
+		m_winsock = true;
+		addrinfo hints = {};
+		hints.ai_family = AF_INET;
+		hints.ai_socktype = SOCK_DGRAM;
+		hints.ai_protocol = IPPROTO_UDP;
+		hints.ai_flags = AI_PASSIVE;
+		addrinfo * found = NULL;
+		if (getaddrinfo(m_host.is_empty() ? NULL : m_host.get_ptr(), m_port, &hints, &found) != 0 || found == NULL) {
+			throw exception_io(pfc::string_formatter() << "Could not resolve AMR RTP stream address " << m_host);
+		}
+		sockaddr_in address = *(const sockaddr_in *)found->ai_addr;
+		freeaddrinfo(found);
+		const bool multicast = IN_MULTICAST(ntohl(address.sin_addr.s_addr));
+
+		m_socket = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+		if (m_socket == INVALID_SOCKET) throw exception_io("Could not create socket for AMR RTP stream");
+		/* receiving thread wakes up to see whether it's to stop */
+		const DWORD timeout = amr_live_poll_ms;
+		setsockopt(m_socket, SOL_SOCKET, SO_RCVTIMEO, (const char *)&timeout, sizeof(timeout));
+		sockaddr_in local = address;
+		if (multicast) {
+			/* others may listen to the group too */
+			const BOOL reuse = TRUE;
+			setsockopt(m_socket, SOL_SOCKET, SO_REUSEADDR, (const char *)&reuse, sizeof(reuse));
+			local.sin_addr.s_addr = htonl(INADDR_ANY);
+		}
+		if (bind(m_socket, (const sockaddr *)&local, sizeof(local)) != 0) {
+			throw exception_io(pfc::string_formatter() << "Could not listen for AMR RTP stream on port " << m_port << ", error " << WSAGetLastError());
+		}
+		if (multicast) {
+			ip_mreq group = {};
+			group.imr_multiaddr = address.sin_addr;
+			group.imr_interface.s_addr = htonl(INADDR_ANY);
+			if (setsockopt(m_socket, IPPROTO_IP, IP_ADD_MEMBERSHIP, (const char *)&group, sizeof(group)) != 0) {
+				throw exception_io(pfc::string_formatter() << "Could not join multicast group " << m_host << ", error " << WSAGetLastError());
+			}
+		}
+	}
+
+	/* stops the thread and closes the socket */
+	void close() {
+		m_stop = true;
+		if (m_thread.isActive()) m_thread.waitTillDone();
+		if (m_socket != INVALID_SOCKET) {
+			closesocket(m_socket);
+			m_socket = INVALID_SOCKET;
+		}
+		if (m_winsock) {
+			WSACleanup();
+			m_winsock = false;
+		}
+	}
+
+	/* the thread: places frames of packets of the source played in the jitter buffer, till it's stopped */
+	void receive() {
+		pfc::array_t<t_uint8> datagram;
+		datagram.set_size(amr_live_max_datagram);
+		amr_rtp_frames frames;
+		bool bandwidth_efficient = false, have_source = false;
+		t_uint32 ssrc = 0;
+		while (!m_stop) {
+			const int size = recv(m_socket, (char *)datagram.get_ptr(), amr_live_max_datagram, 0);
+			if (size == SOCKET_ERROR) {
+				const int error = WSAGetLastError();
+				/* timeout to look at m_stop, and ICMP port unreachable of something sent before */
+				if (error == WSAETIMEDOUT || error == WSAECONNRESET || error == WSAEMSGSIZE) continue;
+				insync(m_lock);
+				m_error = pfc::string_formatter() << "Receiving AMR RTP stream failed, error " << error;
+				m_failed = true;
+				m_arrived.set_state(true);
+				return;
+			}
+			amr_rtp_header header;
+			if (!header.parse(datagram.get_ptr(), size)) continue;
+			const t_uint8 * payload = datagram.get_ptr() + header.m_offset;
+			/* payload format is that of the packets; it's kept while they parse as it */
+			if (!frames.parse(payload, header.m_size, bandwidth_efficient)) {
+				if (!frames.parse(payload, header.m_size, !bandwidth_efficient)) continue;
+				bandwidth_efficient = !bandwidth_efficient;
+			}
+
+			insync(m_lock);
+			const double now = m_clock.query() * 1000;
+			if (have_source && header.m_ssrc != ssrc) {
+				if (now - m_buffer.get_last() < amr_live_switch_ms) continue;
+				m_buffer.reset();
+			}
+			ssrc = header.m_ssrc;
+			have_source = true;
+			m_buffer.put(header.m_timestamp, payload, frames, now);
+			m_arrived.set_state(true);
+		}
+	}
+
+	pfc::string8 m_host, m_port;
+	SOCKET m_socket;
+	bool m_winsock;
+	pfc::thread2 m_thread;
+	std::atomic<bool> m_stop;
+	/* buffer, and what the thread failed with, locked by m_lock; m_arrived is set when a packet was placed or the thread failed */
+	critical_section m_lock;
+	amr_jitter_buffer m_buffer;
+	bool m_failed;
+	pfc::string8 m_error;
+	pfc::event m_arrived;
+	/* time of both threads, from decode_initialize() */
+	pfc::hires_timer m_clock;
+	/* restarts of the stream the decoder was reset for */
+	unsigned m_restarts;
+	/* frame before was speech, of mode m_mode, so lost one is concealed as bad speech */
+	bool m_speech;
+	unsigned m_mode;
+	unsigned m_lost;
+	double m_info_time;
+	/* 3gpp decoder, given back to the pool when input is destroyed */
+	amr_decoder m_decoder;
+};
+
+static input_singletrack_factory_t<input_amr_rtp_live> g_input_amr_rtp_live_factory;
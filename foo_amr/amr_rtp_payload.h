@@ -0,0 +1,153 @@
+/**
+ * foo_input_amr - AMR-NB RTP payloads (RFC 4867), as inputs of captured and live streams take them apart
+*/
+#pragma once
+
+extern "C" {
+	#include "../3gpp/interf_dec.h"
+}
+
+enum {
+	/* every frame decodes to 160 samples, 20ms at 8kHz; RTP timestamps count samples */
+	amr_rtp_frame_samples = 160,
+	amr_rtp_sample_rate = 8000,
+	/* RTP header without CSRCs and extension */
+	amr_rtp_header_size = 12,
+	amr_rtp_version = 2,
+	/* frames one packet may have; anything more is garbage, packets are sent every 20 to 100ms or so */
+	amr_rtp_max_packet_frames = 64,
+	/* frame type of frames missing between packets */
+	amr_rtp_no_data = 15,
+};
+
+/* bits of frame in bandwidth-efficient payload, SID with its type bit and mode indicator */
+static const short g_frame_bits[16] = { 95, 103, 118, 134, 148, 159, 204, 244, 39, 0, 0, 0, 0, 0, 0, 0 };
+
+/* frame type of a mode, SID or NO_DATA, not a reserved one */
+static bool amr_rtp_is_frame_type(unsigned p_type) {
+	return p_type <= 8 || p_type == amr_rtp_no_data;
+}
+
+/* big endian value of p_bytes bytes */
+static t_uint32 amr_rtp_get(const t_uint8 * p_data, unsigned p_bytes) {
+	t_uint32 value = 0;
+	for (unsigned i = 0; i < p_bytes; ++i) value = (value << 8) | p_data[i];
+	return value;
+}
+
+/* p_count bits at bit p_offset of p_data, MSB first */
+static unsigned amr_rtp_get_bits(const t_uint8 * p_data, t_size p_offset, unsigned p_count) {
+	unsigned value = 0;
+	for (unsigned i = 0; i < p_count; ++i, ++p_offset) value = (value << 1) | ((p_data[p_offset >> 3] >> (7 - (p_offset & 7))) & 1);
+	return value;
+}
+
+/**
+ * Frames of one packet payload, as the decoder takes them: table of contents entry of each frame, frame
+ * type and Q bit where storage format header has them, and bit of the payload the frame starts at.
+ *
+ * @since   1.2.0
+ */
+struct amr_rtp_frames {
+	unsigned m_count;
+	t_uint8 m_toc[amr_rtp_max_packet_frames];
+	t_size m_offset[amr_rtp_max_packet_frames];
+
+	/**
+	 * Parses payload of octet-aligned mode: CMR octet, TOC octets, then frames, each starting at an octet.
+	 * No interleaving nor CRCs, which are off unless the session says otherwise.
+	 *
+	 * @param p_data		payload
+	 * @param p_size		its length
+	 * @return				<code>true</code> if the payload is just that, padding bits zero and lengths adding up
+	 * @since				1.2.0
+	 */
+	bool parse_octet_aligned(const t_uint8 * p_data, t_size p_size) {
+		m_count = 0;
+		if (p_size < 2 || (p_data[0] & 0x0F) != 0) return false;
+		t_size pos = 1;
+		for (bool more = true; more; ++pos) {
+			if (pos == p_size || m_count == amr_rtp_max_packet_frames) return false;
+			const t_uint8 toc = p_data[pos];
+			if ((toc & 0x03) != 0 || !amr_rtp_is_frame_type((toc >> 3) & 0x0F)) return false;
+			more = (toc & 0x80) != 0;
+			m_toc[m_count++] = toc & 0x7C;
+		}
+		for (unsigned i = 0; i < m_count; ++i) {
+			m_offset[i] = pos * 8;
+			pos += Decoder_Interface_block_size[(m_toc[i] >> 3) & 0x0F];
+		}
+		return pos == p_size;
+	}
+
+	/**
+	 * Parses payload of bandwidth-efficient mode: 4 bits of CMR, 6 bits of each TOC entry, then frames
+	 * right one after another, padded with zero bits to the octet at the end.
+	 *
+	 * @param p_data		payload
+	 * @param p_size		its length
+	 * @return				<code>true</code> if lengths add up
+	 * @since				1.2.0
+	 */
+	bool parse_bandwidth_efficient(const t_uint8 * p_data, t_size p_size) {
+		m_count = 0;
+		const t_size bits = p_size * 8;
+		t_size pos = 4;
+		for (bool more = true; more; pos += 6) {
+			if (pos + 6 > bits || m_count == amr_rtp_max_packet_frames) return false;
+			const unsigned toc = amr_rtp_get_bits(p_data, pos, 6);
+			if (!amr_rtp_is_frame_type((toc >> 1) & 0x0F)) return false;
+			more = (toc & 0x20) != 0;
+			m_toc[m_count++] = (t_uint8)((toc & 0x1F) << 2);
+		}
+		for (unsigned i = 0; i < m_count; ++i) {
+			m_offset[i] = pos;
+			pos += g_frame_bits[(m_toc[i] >> 3) & 0x0F];
+		}
+		return pos <= bits && bits - pos < 8;
+	}
+
+	bool parse(const t_uint8 * p_data, t_size p_size, bool p_bandwidth_efficient) {
+		return p_bandwidth_efficient ? parse_bandwidth_efficient(p_data, p_size) : parse_octet_aligned(p_data, p_size);
+	}
+};
+
+/**
+ * Fields of RTP header inputs look at, and where the payload is in the packet.
+ *
+ * @since   1.2.0
+ */
+struct amr_rtp_header {
+	t_uint8 m_payload_type;
+	t_uint16 m_sequence;
+	t_uint32 m_timestamp, m_ssrc;
+	/* payload, past CSRCs and extension, padding not included */
+	t_size m_offset, m_size;
+
+	/**
+	 * Parses header of a packet.
+	 *
+	 * @param p_rtp			the packet
+	 * @param p_size		its length, which may be less than it had if it was cut when captured
+	 * @return				<code>true</code> if it's RTP version 2, and header and padding fit in it
+	 * @since				1.2.0
+	 */
+	bool parse(const t_uint8 * p_rtp, t_size p_size) {
+		if (p_size < amr_rtp_header_size || (p_rtp[0] >> 6) != amr_rtp_version) return false;
+		m_payload_type = p_rtp[1] & 0x7F;
+		m_sequence = (t_uint16)amr_rtp_get(p_rtp + 2, 2);
+		m_timestamp = amr_rtp_get(p_rtp + 4, 4);
+		m_ssrc = amr_rtp_get(p_rtp + 8, 4);
+		t_size header = amr_rtp_header_size + 4 * (p_rtp[0] & 0x0F);
+		if ((p_rtp[0] & 0x10) != 0) {
+			if (p_size < header + 4) return false;
+			header += 4 + 4 * amr_rtp_get(p_rtp + header + 2, 2);
+		}
+		t_size padding = 0;
+		if ((p_rtp[0] & 0x20) != 0 && p_size > header) padding = p_rtp[p_size - 1];
+		if (p_size < header + padding) return false;
+		m_offset = header;
+		m_size = p_size - header - padding;
+		return true;
+	}
+};
@@ -0,0 +1,89 @@
+/**
+ * foo_input_amr - decoders carried over from one segment of a split recording to the next
+*/
+#include "../foo_sdk/foobar2000/SDK/foobar2000.h"
+#include "amr_segment_handoff.h"
+
+static advconfig_checkbox_factory g_amr_segment_handoff("AMR decoder: play numbered segments of a recording, as call_0001.amr and call_0002.amr, one after another without a seam",
+	{ 0x2f84c6d1, 0x7b3e, 0x4a50,{ 0x86, 0xd9, 0x13, 0xe7, 0x5c, 0xa0, 0x4b, 0x92 } },
+	advconfig_branch::guid_branch_decoding, 23, true);
+
+amr_segment_handoff & amr_segment_handoff::get() {
+	static amr_segment_handoff instance;
+	return instance;
+}
+
+bool amr_segment_handoff::is_enabled() {
+	return g_amr_segment_handoff.get();
+}
+
+bool amr_segment_handoff::next_path(const char * p_path, pfc::string_base & p_out) {
+	const t_size name = pfc::scan_filename(p_path);
+	const t_size length = strlen(p_path);
+	/* last digit of the name, before the extension */
+	t_size end = length;
+	while (end > name && p_path[end - 1] != '.') --end;
+	if (end == name) end = length;
+	while (end > name && !pfc::char_is_numeric(p_path[end - 1])) --end;
+	if (end == name) return false;
+	pfc::string8 next = p_path;
+	t_size pos = end;
+	for (;;) {
+		--pos;
+		if (next[pos] != '9') {
+			next.set_char(pos, (char)(next[pos] + 1));
+			break;
+		}
+		next.set_char(pos, '0');
+		/* all nines: one digit more */
+		if (pos == name || !pfc::char_is_numeric(next[pos - 1])) {
+			next.insert_chars(pos, "1");
+			break;
+		}
+	}
+	p_out = next;
+	return true;
+}
+
+void amr_segment_handoff::leave(const char * p_path, amr_decoder * p_decoders, unsigned p_channels, bool p_float_engine) {
+	pfc::string8 next;
+	if (!next_path(p_path, next)) return;
+	insync(m_lock);
+	m_next = next;
+	m_left.start();
+	m_decoders.set_size_discard(p_channels);
+	for (unsigned i = 0; i < p_channels; ++i) m_decoders[i].swap(p_decoders[i]);
+	m_channels = p_channels;
+	m_float_engine = p_float_engine;
+}
+
+bool amr_segment_handoff::take(const char * p_path, amr_decoder * p_decoders, unsigned p_channels, bool p_float_engine) {
+	insync(m_lock);
+	if (m_channels == 0) return false;
+	const bool taken = stricmp_utf8(p_path, m_next) == 0 && p_channels == m_channels && p_float_engine == m_float_engine && m_left.query() * 1000 < amr_segment_handoff_timeout_ms;
+	if (taken) {
+		for (unsigned i = 0; i < p_channels; ++i) p_decoders[i].swap(m_decoders[i]);
+	}
+	/* decoders left are for the track played next; whichever it is, they're of no use after */
+	m_decoders.set_size_discard(0);
+	m_channels = 0;
+	m_next.reset();
+	return taken;
+}
+
+void amr_segment_handoff::clear() {
+	insync(m_lock);
+	m_decoders.set_size_discard(0);
+	m_channels = 0;
+	m_next.reset();
+}
+
+/* gives decoders left back on shutdown, while amr_decoder_pool is still there */
+class amr_segment_handoff_initquit : public initquit {
+public:
+	void on_quit() {
+		amr_segment_handoff::get().clear();
+	}
+};
+
+static initquit_factory_t<amr_segment_handoff_initquit> g_amr_segment_handoff_initquit;
@@ -0,0 +1,80 @@
+/**
+ * foo_input_amr - decoders carried over from one segment of a split recording to the next
+*/
+#pragma once
+
+#include "amr_decoder_pool.h"
+
+enum {
+	/* decoders left for the next segment are taken within 10 seconds, or not at all */
+	amr_segment_handoff_timeout_ms = 10 * 1000,
+};
+
+/**
+ * Recorders that roll files every hour, as call_0001.amr, call_0002.amr and so on, cut one recording
+ * into segments, and the frames of each carry on from the last frame of the one before. Input that
+ * played a segment to its end leaves its decoders here, in the state its last frame left them in,
+ * for the segment named next, see next_path(); the input playing that one takes them instead of fresh
+ * decoders, so audio carries on across the boundary as if it was one file, and no decoder is reset.
+ * foobar opens the next track as soon as the one before ends, so decoders not taken soon, see
+ * amr_segment_handoff_timeout_ms, are of no use and are given back. All methods are thread-safe.
+ *
+ * @since   1.2.0
+ */
+class amr_segment_handoff {
+public:
+	/* the one instance shared by all inputs */
+	static amr_segment_handoff & get();
+
+	/* decoders are carried over, as preferences ask */
+	static bool is_enabled();
+
+	/**
+	 * Path of the segment after given one: the last number in its file name counted up, as many
+	 * digits kept, so "call_0009.amr" is followed by "call_0010.amr".
+	 *
+	 * @param p_path		path to file
+	 * @param p_out			receives the path
+	 * @return				<code>false</code> if the file name has no number
+	 * @since				1.2.0
+	 */
+	static bool next_path(const char * p_path, pfc::string_base & p_out);
+
+	/**
+	 * Leaves decoders of a segment played to its end for the segment after it, in place of any left before.
+	 *
+	 * @param p_path		path to file played
+	 * @param p_decoders	decoder of each channel, which are swapped for ones with no state
+	 * @param p_channels	number of channels
+	 * @param p_float_engine	decoders use floating point post filter, see amr_decoder::acquire()
+	 * @since				1.2.0
+	 */
+	void leave(const char * p_path, amr_decoder * p_decoders, unsigned p_channels, bool p_float_engine);
+
+	/**
+	 * Takes decoders left for given file, if the one played before it was the segment before it, with
+	 * the same channels and engine.
+	 *
+	 * @param p_path		path to file about to be played from its first frame
+	 * @param p_decoders	decoder of each channel, which are swapped for the ones left
+	 * @param p_channels	number of channels
+	 * @param p_float_engine	decoders are to use floating point post filter
+	 * @return				<code>true</code> if decoders were taken
+	 * @since				1.2.0
+	 */
+	bool take(const char * p_path, amr_decoder * p_decoders, unsigned p_channels, bool p_float_engine);
+
+	/* gives decoders left back to amr_decoder_pool */
+	void clear();
+
+private:
+	amr_segment_handoff() : m_channels(0), m_float_engine(false) {}
+
+	critical_section m_lock;
+	/* segment the decoders are left for, and when they were */
+	pfc::string8 m_next;
+	pfc::hires_timer m_left;
+	pfc::array_staticsize_t<amr_decoder> m_decoders;
+	unsigned m_channels;
+	bool m_float_engine;
+};
@@ -0,0 +1,117 @@
+/**
+ * foo_input_amr - decoding checked against the reference decoder as it goes on
+*/
+#include "../foo_sdk/foobar2000/SDK/foobar2000.h"
+#include <chrono>
+#include <cmath>
+extern "C" {
+	#include "../3gpp/interf_dec.h"
+}
+#include "amr_shadow_check.h"
+#include "amr_decoder_pool.h"
+
+enum {
+	/* every frame decodes to 160 samples */
+	amr_shadow_frame_samples = 160,
+	/* most that can be set, per mille; that is every frame */
+	amr_shadow_max_share = 1000,
+};
+
+/* floating point post filter may be off by this much, of full scale, about 32 steps of 16 bits */
+static const float g_shadow_float_tolerance = 1.0f / 1024;
+/* fixed point one is the same but for rounding of the gain */
+static const float g_shadow_exact_tolerance = 1.0f / (1 << 20);
+
+static advconfig_integer_factory g_amr_shadow_share("AMR decoder: decode this many per mille of frames again the reference way on a background thread, and report differences (0 not to)",
+	{ 0x6d2a9c54, 0x1e87, 0x4f3b,{ 0xa0, 0x6c, 0x93, 0x25, 0xe8, 0x7b, 0x41, 0xd6 } },
+	advconfig_branch::guid_branch_decoding, 41, 0, 0, amr_shadow_max_share);
+
+bool amr_shadow_check::is_enabled() {
+	return g_amr_shadow_share.get() > 0;
+}
+
+amr_shadow_check::amr_shadow_check() : m_active(false), m_float_engine(false), m_gain(1.0f), m_share(0), m_frames(0), m_first(0), m_offset(0), m_picked(false), m_busy(false) {
+	m_random.seed((unsigned)std::chrono::steady_clock::now().time_since_epoch().count());
+}
+
+void amr_shadow_check::start(const char * p_path, bool p_float_engine, float p_gain) {
+	reset();
+	m_path = p_path;
+	m_float_engine = p_float_engine;
+	m_gain = p_gain;
+	m_share = (double)g_amr_shadow_share.get() / amr_shadow_max_share;
+	m_active = m_share > 0;
+}
+
+void amr_shadow_check::reset() {
+	m_task.cancel();
+	m_busy = false;
+	m_picked = false;
+	m_active = false;
+}
+
+bool amr_shadow_check::pick(void * p_decoder, unsigned p_frames) {
+	m_picked = false;
+	if (!m_active || m_busy) return false;
+	if (std::uniform_real_distribution<double>(0, 1)(m_random) >= p_frames * m_share) return false;
+	/* previous run is checked; its task is done */
+	m_task.wait();
+	m_snapshot.set_size(Decoder_Interface_snapshot_size());
+	Decoder_Interface_snapshot(p_decoder, m_snapshot.get_ptr());
+	m_picked = true;
+	return true;
+}
+
+void amr_shadow_check::check(const t_uint8 * p_data, t_size p_size, unsigned p_frames, unsigned p_first, t_filesize p_offset, const audio_sample * p_out) {
+	if (!m_picked) return;
+	m_picked = false;
+	m_data.set_data_fromptr(p_data, p_size);
+	m_output.set_data_fromptr(p_out, p_frames * amr_shadow_frame_samples);
+	m_frames = p_frames;
+	m_first = p_first;
+	m_offset = p_offset;
+	m_busy = true;
+	amr_thread_pool::get().submit(m_task, [this] { compare(); }, amr_priority_indexing);
+}
+
+void amr_shadow_check::compare() {
+	try {
+		amr_decoder decoder;
+		decoder.acquire();
+		Decoder_Interface_restore(decoder.get(), m_snapshot.get_ptr());
+		pfc::array_t<t_int16> reference;
+		reference.set_size(amr_shadow_frame_samples);
+		const float tolerance = (m_float_engine ? g_shadow_float_tolerance : g_shadow_exact_tolerance) * m_gain;
+		const float scale = m_gain / 32768;
+		unsigned differing = 0, first = 0;
+		t_filesize first_offset = 0;
+		t_uint8 first_header = 0;
+		float worst = 0;
+		t_size pos = 0;
+		Decoder_Interface_reference_kernels(1);
+		for (unsigned i = 0; i < m_frames; ++i) {
+			t_uint8 * frame = m_data.get_ptr() + pos;
+			Decoder_Interface_Decode(decoder.get(), frame, reference.get_ptr(), 0);
+			const audio_sample * out = m_output.get_ptr() + i * amr_shadow_frame_samples;
+			float diff = 0;
+			for (unsigned s = 0; s < amr_shadow_frame_samples; ++s) diff = pfc::max_t<float>(diff, std::fabs((float)out[s] - reference[s] * scale));
+			if (diff > tolerance) {
+				if (differing++ == 0) {
+					first = i;
+					first_offset = m_offset + pos;
+					first_header = frame[0];
+				}
+				worst = pfc::max_t(worst, diff);
+			}
+			pos += 1 + Decoder_Interface_block_size[(frame[0] >> 3) & 0x0F];
+		}
+		Decoder_Interface_reference_kernels(0);
+		if (differing > 0) {
+			console::formatter() << "AMR shadow decoding: " << m_path << ": " << differing << " of " << m_frames << " frames differ from the reference decoder, first one "
+				<< (m_first + first) << " at offset " << first_offset << ", frame type " << ((first_header >> 3) & 0x0F) << ", by " << pfc::format_float(worst * 32768 / m_gain, 0, 1) << " of 16-bit steps at most";
+		}
+	} catch (std::exception const &) {
+		/* no decoder to check with; run is just not checked */
+	}
+	m_busy = false;
+}
@@ -0,0 +1,86 @@
+/**
+ * foo_input_amr - decoding checked against the reference decoder as it goes on
+*/
+#pragma once
+
+#include <atomic>
+#include <random>
+#include "amr_thread_pool.h"
+
+/**
+ * Decodes a small share of what inputs decode once more the reference way, so faster decoding paths can
+ * be used everywhere while whatever they get wrong still shows up. Before a run of frames is decoded,
+ * it's picked with probability that makes the share of frames checked what preferences ask for; decoder
+ * snapshot is taken then, and after the run is decoded, the frames and what they decoded to are copied.
+ * A background worker of amr_thread_pool restores a decoder of its own from the snapshot and decodes the
+ * frames one at a time to 16-bit samples, with fixed point post filter and plain C kernels, see
+ * Decoder_Interface_reference_kernels(), which is what the 3gpp reference decoder does, and compares.
+ *
+ * Frames that differ are reported to the console, with the file, number, offset and frame type of the first
+ * one. Output of floating point post filter is not bit-exact, so it may differ by g_shadow_float_tolerance.
+ * One run per input is checked at a time, runs decoded meanwhile are not picked, so checking never costs
+ * more than a worker at background priority.
+ *
+ * @since   1.2.0
+ */
+class amr_shadow_check {
+public:
+	amr_shadow_check();
+	/* worker must not outlive the run it checks */
+	~amr_shadow_check() { reset(); }
+
+	/* share of frames to check from preferences isn't 0 */
+	static bool is_enabled();
+
+	/**
+	 * Starts picking runs of a file to check.
+	 *
+	 * @param p_path		path to the file, for the report
+	 * @param p_float_engine	decoder of the input post filters in floating point
+	 * @param p_gain		gain decoder of the input applies to its output
+	 * @since				1.2.0
+	 */
+	void start(const char * p_path, bool p_float_engine, float p_gain);
+
+	/* waits for the run being checked, and stops picking */
+	void reset();
+
+	/* decides whether the run of p_frames frames p_decoder is about to decode is checked, and takes snapshot of the decoder if so */
+	bool pick(void * p_decoder, unsigned p_frames);
+
+	/**
+	 * Hands run picked by pick() over for checking, once it's decoded.
+	 *
+	 * @param p_data		frames of the run
+	 * @param p_size		bytes of them
+	 * @param p_frames		number of frames
+	 * @param p_first		number of the first frame in the file
+	 * @param p_offset		file offset of the first frame
+	 * @param p_out			samples the frames were decoded to, 160 per frame
+	 * @since				1.2.0
+	 */
+	void check(const t_uint8 * p_data, t_size p_size, unsigned p_frames, unsigned p_first, t_filesize p_offset, const audio_sample * p_out);
+
+private:
+	/* worker: decodes the run the reference way and reports frames that differ */
+	void compare();
+
+	pfc::string8 m_path;
+	bool m_active;
+	bool m_float_engine;
+	float m_gain;
+	/* probability of picking a run, per frame of it */
+	double m_share;
+	std::minstd_rand m_random;
+	/* run picked: decoder state before it, its frames and where they are, and their output */
+	pfc::array_t<t_uint8> m_snapshot;
+	pfc::array_t<t_uint8> m_data;
+	unsigned m_frames, m_first;
+	t_filesize m_offset;
+	pfc::array_t<audio_sample> m_output;
+	/* snapshot of the run picked is taken, and the run not handed over yet */
+	bool m_picked;
+	/* worker is checking a run */
+	std::atomic<bool> m_busy;
+	amr_task m_task;
+};
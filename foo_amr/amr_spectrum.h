@@ -0,0 +1,126 @@
+/**
+ * foo_input_amr - spectral envelope of decoded speech from its LPC filters, for visualisations
+*/
+#pragma once
+
+#include <math.h>
+
+enum {
+	/* bins of an envelope, from 0 to 4 kHz, 62.5 Hz each */
+	amr_spectrum_bins = 64,
+	/* envelope is one per subframe, 5ms */
+	amr_spectrum_subframe_samples = 40,
+	/* predictor coefficients of LP synthesis filter, a[0] included */
+	amr_spectrum_taps = 11,
+};
+
+/**
+ * Type of extended_param() query of the decoder for spectral envelopes of the subframes of the last
+ * chunk, so spectrum visualisations of low-end machines need not FFT the output: arg1 is the first
+ * subframe of the chunk wanted, arg2 buffer for envelopes, arg2size its size in bytes. Each envelope is
+ * amr_spectrum_bins floats, power of each bin in dB, bins adding up to mean square of the subframe, full
+ * scale 0 dB; of multichannel files, that of the first channel. Returns number of envelopes copied, or
+ * number of subframes the last chunk has envelopes of if arg2 is <code>NULL</code>. Envelope is |1/A(z)|
+ * of synthesis filter the decoder had in the subframe, see guid_amr_features, so it's the formants
+ * without the pitch harmonics. Frames are decoded one at a time to get them, as for guid_amr_features;
+ * first query turns that on.
+ *
+ * @since   1.2.0
+ */
+// {B8D35A02-6E17-4C94-A3F8-19C07E54D2B6}
+static const GUID guid_amr_spectrum = { 0xb8d35a02, 0x6e17, 0x4c94,{ 0xa3, 0xf8, 0x19, 0xc0, 0x7e, 0x54, 0xd2, 0xb6 } };
+
+/**
+ * Spectral envelopes from LSPs of subframes the decoder gives out, see Dec_features, and the level of
+ * the audio decoded from them. LSPs are turned into predictor coefficients as the decoder turns them,
+ * and |1/A| is evaluated at the middle of each bin, with cosines and sines taken from a table; that's
+ * some 1500 multiplications per subframe, far less than an FFT of the audio.
+ *
+ * @since   1.2.0
+ */
+class amr_spectrum {
+public:
+	/**
+	 * Envelope of one subframe.
+	 *
+	 * @param p_lsp			10 LSPs in cosine domain, Q15
+	 * @param p_power		mean square of the subframe, samples scaled to [-1, 1)
+	 * @param p_out			receives amr_spectrum_bins values in dB
+	 * @since				1.2.0
+	 */
+	static void envelope(const short * p_lsp, float p_power, float * p_out) {
+		/* sum and difference polynomials of LSPs, alternate ones each, then predictor coefficients, as Lsp_Az() */
+		double f1[6], f2[6], a[amr_spectrum_taps];
+		polynomial(p_lsp, f1);
+		polynomial(p_lsp + 1, f2);
+		for (int i = 5; i > 0; --i) {
+			f1[i] += f1[i - 1];
+			f2[i] -= f2[i - 1];
+		}
+		a[0] = 1;
+		for (int i = 1; i <= 5; ++i) {
+			a[i] = 0.5 * (f1[i] + f2[i]);
+			a[amr_spectrum_taps - i] = 0.5 * (f1[i] - f2[i]);
+		}
+
+		/* power of the filter in each bin, made to add up to that of the subframe */
+		const table & t = get_table();
+		double gain[amr_spectrum_bins], sum = 0;
+		for (int k = 0; k < amr_spectrum_bins; ++k) {
+			double re = 0, im = 0;
+			for (int i = 0; i < amr_spectrum_taps; ++i) {
+				re += a[i] * t.m_cos[k][i];
+				im += a[i] * t.m_sin[k][i];
+			}
+			gain[k] = 1.0 / (re * re + im * im + 1e-12);
+			sum += gain[k];
+		}
+		for (int k = 0; k < amr_spectrum_bins; ++k) p_out[k] = (float)(10.0 * log10(gain[k] / sum * p_power + 1e-12));
+	}
+
+	/**
+	 * Mean square of one channel of a subframe of decoded audio.
+	 *
+	 * @param p_samples		amr_spectrum_subframe_samples samples, p_stride apart
+	 * @param p_stride		distance of the samples, number of channels
+	 * @since				1.2.0
+	 */
+	static float power(const audio_sample * p_samples, unsigned p_stride) {
+		float sum = 0;
+		for (unsigned i = 0; i < amr_spectrum_subframe_samples; ++i) sum += p_samples[i * p_stride] * p_samples[i * p_stride];
+		return sum / amr_spectrum_subframe_samples;
+	}
+
+private:
+	/* cos(i * w) and sin(i * w) of the middle of each bin */
+	struct table {
+		table() {
+			for (int k = 0; k < amr_spectrum_bins; ++k) {
+				const double w = 3.14159265358979323846 * (k + 0.5) / amr_spectrum_bins;
+				for (int i = 0; i < amr_spectrum_taps; ++i) {
+					m_cos[k][i] = cos(i * w);
+					m_sin[k][i] = sin(i * w);
+				}
+			}
+		}
+		double m_cos[amr_spectrum_bins][amr_spectrum_taps];
+		double m_sin[amr_spectrum_bins][amr_spectrum_taps];
+	};
+
+	static const table & get_table() {
+		static const table instance;
+		return instance;
+	}
+
+	/* polynomial of every other LSP, from the first one given, as Get_lsp_pol() */
+	static void polynomial(const short * p_lsp, double * p_f) {
+		p_f[0] = 1;
+		p_f[1] = -2.0 * p_lsp[0] / 32768;
+		for (int i = 2; i <= 5; ++i) {
+			const double b = -2.0 * p_lsp[2 * i - 2] / 32768;
+			p_f[i] = b * p_f[i - 1] + 2 * p_f[i - 2];
+			for (int j = i - 1; j > 1; --j) p_f[j] += b * p_f[j - 1] + p_f[j - 2];
+			p_f[1] += b;
+		}
+	}
+};
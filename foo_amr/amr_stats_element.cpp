@@ -0,0 +1,229 @@
+/**
+ * foo_input_amr - live statistics of AMR decoding, as a UI element
+*/
+#include "../foo_sdk/foobar2000/SDK/foobar2000.h"
+#include "amr_counters.h"
+#include "amr_memory_budget.h"
+#include "amr_thread_pool.h"
+
+enum {
+	/* statistics are taken this often, in ms */
+	amr_stats_period_ms = 1000,
+	amr_stats_timer = 1,
+	/* AMR frame is 20ms long */
+	amr_stats_frame_ms = 20,
+	/* margin around the text, in pixels */
+	amr_stats_margin = 4,
+};
+
+/* decoding or reading takes more than this share of the time it could take, so it's what holds things up */
+static const double g_stats_busy = 0.8;
+static const double g_stats_io_bound = 0.5;
+/* caches are near their memory limit */
+static const double g_stats_memory_full = 0.95;
+
+// {5E0B2C17-93A4-4F6D-B81E-2C7D49F0A635}
+static const GUID guid_amr_stats_element = { 0x5e0b2c17, 0x93a4, 0x4f6d,{ 0xb8, 0x1e, 0x2c, 0x7d, 0x49, 0xf0, 0xa6, 0x35 } };
+
+static const TCHAR g_stats_class[] = TEXT("foo_input_amr statistics");
+
+/* counters at one moment */
+struct amr_stats_sample {
+	t_int64 m_counts[amr_counters];
+	/* seconds since the element started */
+	double m_time;
+
+	void take(pfc::hires_timer & p_clock) {
+		for (unsigned i = 0; i < amr_counters; ++i) m_counts[i] = amr_counter_get((amr_counter)i);
+		m_time = p_clock.query();
+	}
+
+	t_int64 operator[](amr_counter p_counter) const { return m_counts[p_counter]; }
+};
+
+/* share of lookups that found what they looked for, since foobar started */
+static pfc::string8 amr_stats_hits(const amr_stats_sample & p_now, amr_counter p_lookups, amr_counter p_hits) {
+	if (p_now[p_lookups] == 0) return "-";
+	pfc::string_formatter out;
+	out << pfc::format_float(100.0 * p_now[p_hits] / p_now[p_lookups], 0, 0) << "% of " << pfc::format_int(p_now[p_lookups]);
+	return out;
+}
+
+/**
+ * Text of the statistics, a line each, with rates of what happened between two samples: inputs decoding,
+ * frames decoded per second and realtime factor, time spent decoding and reading, cache hit rates, indexing
+ * waiting, memory of the caches, and what holds decoding up, if anything does.
+ *
+ * @param p_before		sample taken before
+ * @param p_now			sample taken now
+ * @return				the text
+ * @since				1.2.0
+ */
+static pfc::string8 amr_stats_text(const amr_stats_sample & p_before, const amr_stats_sample & p_now) {
+	const double seconds = pfc::max_t(p_now.m_time - p_before.m_time, 0.001);
+	const double frames = (double)(p_now[amr_counter_frames] - p_before[amr_counter_frames]);
+	/* time decode_run() took, reading in it included, and time all reads took */
+	const double decoding = (p_now[amr_counter_decode_us] - p_before[amr_counter_decode_us]) / 1000000.0;
+	const double reading = (p_now[amr_counter_read_us] - p_before[amr_counter_read_us]) / 1000000.0;
+	const double bytes = (double)(p_now[amr_counter_read_bytes] - p_before[amr_counter_read_bytes]);
+	const t_int64 decoders = p_now[amr_counter_decoders];
+	const t_size cores = amr_thread_pool::get().get_workers();
+	const t_size memory = amr_memory_budget::get().get_memory();
+	const t_size limit = amr_memory_budget::get_limit();
+
+	pfc::string_formatter out;
+	out << "Decoders: " << pfc::format_int(decoders) << " active, " << pfc::format_float(frames / seconds, 0, 0) << " frames/s";
+	if (decoding > 0) out << ", " << pfc::format_float(frames * amr_stats_frame_ms / 1000 / decoding, 0, 1) << "x realtime";
+	out << "\r\n";
+	out << "Decoding: " << pfc::format_float(100 * decoding / seconds, 0, 0) << "% of a core\r\n";
+	out << "Reading: " << pfc::format_file_size_short((t_uint64)(bytes / seconds)) << "/s, " << pfc::format_float(100 * reading / seconds, 0, 0) << "% of the time\r\n";
+	out << "Cache hits: index " << amr_stats_hits(p_now, amr_counter_index_lookups, amr_counter_index_hits);
+	out << ", decoded audio " << amr_stats_hits(p_now, amr_counter_pcm_lookups, amr_counter_pcm_hits);
+	out << ", on disk " << amr_stats_hits(p_now, amr_counter_disk_lookups, amr_counter_disk_hits) << "\r\n";
+	out << "Index queue: " << pfc::format_uint(amr_thread_pool::get().get_queued(amr_priority_indexing)) << " files waiting\r\n";
+	out << "Memory: " << pfc::format_file_size_short(memory);
+	if (limit == 0) out << ", no limit\r\n";
+	else out << " of " << pfc::format_file_size_short(limit) << " (" << pfc::format_float(100.0 * memory / limit, 0, 0) << "%)\r\n";
+
+	/* reads block decoding when they take most of its time; caches near their limit drop what would be served from them */
+	const char * bottleneck = "none";
+	if (decoders == 0 && frames == 0) bottleneck = "idle";
+	else if (decoding > 0 && reading / decoding > g_stats_io_bound) bottleneck = "I/O";
+	else if (decoding / seconds > g_stats_busy * cores) bottleneck = "decoding";
+	else if (limit > 0 && memory > g_stats_memory_full * limit) bottleneck = "caching, memory limit reached";
+	out << "Bottleneck: " << bottleneck;
+	return out;
+}
+
+/**
+ * Window showing the statistics, refreshed every amr_stats_period_ms, in font and colors of the layout.
+ *
+ * @since   1.2.0
+ */
+class amr_stats_instance : public ui_element_instance {
+public:
+	amr_stats_instance(HWND p_parent, ui_element_instance_callback_ptr p_callback) : m_callback(p_callback), m_wnd(NULL) {
+		m_clock.start();
+		m_before.take(m_clock);
+		register_class();
+		m_wnd = CreateWindowEx(0, g_stats_class, TEXT(""), WS_CHILD, 0, 0, 0, 0, p_parent, NULL, core_api::get_my_instance(), this);
+		if (m_wnd == NULL) throw pfc::exception("Could not create AMR statistics window");
+	}
+
+	~amr_stats_instance() {
+		if (m_wnd != NULL) DestroyWindow(m_wnd);
+	}
+
+	HWND get_wnd() { return m_wnd; }
+	void set_configuration(ui_element_config::ptr p_data) {}
+	ui_element_config::ptr get_configuration() { return ui_element_config::g_create_empty(guid_amr_stats_element); }
+	GUID get_guid() { return guid_amr_stats_element; }
+	GUID get_subclass() { return ui_element_subclass_utility; }
+
+	void notify(const GUID & p_what, t_size p_param1, const void * p_param2, t_size p_param2size) {
+		if (m_wnd != NULL && (p_what == ui_element_notify_colors_changed || p_what == ui_element_notify_font_changed)) InvalidateRect(m_wnd, NULL, TRUE);
+	}
+
+private:
+	static void register_class() {
+		static bool registered = false;
+		if (registered) return;
+		WNDCLASS wc = {};
+		wc.lpfnWndProc = window_proc;
+		wc.hInstance = core_api::get_my_instance();
+		wc.hCursor = LoadCursor(NULL, IDC_ARROW);
+		wc.lpszClassName = g_stats_class;
+		registered = RegisterClass(&wc) != 0;
+	}
+
+	static LRESULT CALLBACK window_proc(HWND p_wnd, UINT p_msg, WPARAM p_wp, LPARAM p_lp) {
+		amr_stats_instance * instance;
+		if (p_msg == WM_NCCREATE) {
+			instance = (amr_stats_instance *)((CREATESTRUCT *)p_lp)->lpCreateParams;
+			SetWindowLongPtr(p_wnd, GWLP_USERDATA, (LONG_PTR)instance);
+		}
+		else instance = (amr_stats_instance *)GetWindowLongPtr(p_wnd, GWLP_USERDATA);
+		if (instance == NULL) return DefWindowProc(p_wnd, p_msg, p_wp, p_lp);
+		switch (p_msg) {
+		case WM_CREATE:
+			SetTimer(p_wnd, amr_stats_timer, amr_stats_period_ms, NULL);
+			return 0;
+		case WM_TIMER:
+			instance->refresh();
+			return 0;
+		case WM_ERASEBKGND:
+			return 1;
+		case WM_PAINT:
+			instance->paint();
+			return 0;
+		case WM_DESTROY:
+			KillTimer(p_wnd, amr_stats_timer);
+			/* host may destroy the window before the instance */
+			instance->m_wnd = NULL;
+			SetWindowLongPtr(p_wnd, GWLP_USERDATA, 0);
+			return 0;
+		}
+		return DefWindowProc(p_wnd, p_msg, p_wp, p_lp);
+	}
+
+	/* takes a sample, and shows rates since the one before */
+	void refresh() {
+		amr_stats_sample now;
+		now.take(m_clock);
+		m_text = amr_stats_text(m_before, now);
+		m_before = now;
+		InvalidateRect(m_wnd, NULL, FALSE);
+	}
+
+	void paint() {
+		PAINTSTRUCT ps;
+		HDC dc = BeginPaint(m_wnd, &ps);
+		RECT rect;
+		GetClientRect(m_wnd, &rect);
+		HBRUSH background = CreateSolidBrush(m_callback->query_std_color(ui_color_background));
+		FillRect(dc, &rect, background);
+		DeleteObject(background);
+		const HGDIOBJ font = SelectObject(dc, m_callback->query_font_ex(ui_font_default));
+		SetTextColor(dc, m_callback->query_std_color(ui_color_text));
+		SetBkMode(dc, TRANSPARENT);
+		InflateRect(&rect, -amr_stats_margin, -amr_stats_margin);
+		const pfc::stringcvt::string_os_from_utf8 text(m_text.is_empty() ? "Collecting AMR statistics..." : m_text.get_ptr());
+		DrawText(dc, text, -1, &rect, DT_LEFT | DT_TOP | DT_NOPREFIX | DT_END_ELLIPSIS);
+		SelectObject(dc, font);
+		EndPaint(m_wnd, &ps);
+	}
+
+	const ui_element_instance_callback_ptr m_callback;
+	HWND m_wnd;
+	pfc::hires_timer m_clock;
+	amr_stats_sample m_before;
+	pfc::string8 m_text;
+};
+
+/**
+ * "AMR decoding statistics" UI element: inputs decoding, throughput and realtime factor, time spent
+ * decoding and reading, cache hit rates, indexing waiting and memory of the caches, from amr_counters,
+ * so whoever watches a busy machine sees whether decoding, I/O or caching holds playback up.
+ *
+ * @since   1.2.0
+ */
+class amr_stats_element : public ui_element {
+public:
+	GUID get_guid() { return guid_amr_stats_element; }
+	GUID get_subclass() { return ui_element_subclass_utility; }
+	void get_name(pfc::string_base & p_out) { p_out = "AMR decoding statistics"; }
+
+	ui_element_instance_ptr instantiate(HWND p_parent, ui_element_config::ptr p_cfg, ui_element_instance_callback_ptr p_callback) {
+		return fb2k::service_new<amr_stats_instance>(p_parent, p_callback);
+	}
+
+	ui_element_config::ptr get_default_configuration() { return ui_element_config::g_create_empty(guid_amr_stats_element); }
+	ui_element_children_enumerator_ptr enumerate_children(ui_element_config::ptr p_cfg) { return NULL; }
+
+	bool get_description(pfc::string_base & p_out) {
+		p_out = "Shows live statistics of AMR decoding: active decoders, frames per second, realtime factor, cache hit rates, indexing queue and memory use.";
+		return true;
+	}
+};
+
+static service_factory_single_t<amr_stats_element> g_amr_stats_element;
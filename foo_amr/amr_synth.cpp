@@ -0,0 +1,117 @@
+/**
+ * foo_input_amr - synthetic AMR streams, as inputs of benchmarks and stress tests
+*/
+#include "../foo_sdk/foobar2000/SDK/foobar2000.h"
+extern "C" {
+	#include "../3gpp/interf_dec.h"
+}
+#include "amr_synth.h"
+
+enum {
+	amr_synth_frame_types = 16,
+	amr_synth_modes = 8,
+	amr_synth_sid = 8,
+	amr_synth_no_data = 15,
+	/* first reserved frame type, and how many there are */
+	amr_synth_reserved = 12,
+	amr_synth_reserved_types = 3,
+	/* SID update comes once in every 8 frames of a DTX pause */
+	amr_synth_sid_period = 8,
+	/* DTX pauses are decided a second at a time */
+	amr_synth_run_frames = 50,
+	/* frames of each preset, 10 minutes of audio */
+	amr_synth_preset_frames = 30000,
+};
+
+/* bits of payload indexed by frame type; its octets are Decoder_Interface_block_size */
+static const short g_synth_bits[amr_synth_frame_types] = { 95, 103, 118, 134, 148, 159, 204, 244, 39, 0, 0, 0, 0, 0, 0, 0 };
+
+/* linear congruential generator from ANSI C, so streams are the same across machines and compilers */
+class amr_synth_random {
+public:
+	explicit amr_synth_random(t_uint32 p_seed) : m_seed(p_seed) {}
+	t_uint8 next() { m_seed = m_seed * 1103515245 + 12345; return (t_uint8)(m_seed >> 16); }
+	/* 16 bits, low byte drawn first */
+	unsigned next16() { const unsigned low = next(); return low | (unsigned)next() << 8; }
+	/* true with probability p_share */
+	bool chance(double p_share) { return p_share > 0 && next16() < p_share * 65536; }
+	/* 0 to p_count - 1 */
+	unsigned below(unsigned p_count) { return next16() % p_count; }
+private:
+	t_uint32 m_seed;
+};
+
+/* mode drawn from p_modes, other than p_current if there is another */
+static unsigned amr_synth_pick_mode(unsigned p_modes, unsigned p_current, amr_synth_random & p_random) {
+	unsigned modes[amr_synth_modes], count = 0;
+	for (unsigned m = 0; m < amr_synth_modes; ++m) {
+		if ((p_modes >> m & 1) && (m != p_current || p_modes == 1u << m)) modes[count++] = m;
+	}
+	return modes[p_random.below(count)];
+}
+
+void amr_synthesize(const amr_synth_params & p_params, unsigned p_frames, bool p_magic, pfc::array_t<t_uint8> & p_out) {
+	/* payload has a generator of its own, so choices don't change it, and stream of one mode is the same whatever else is set */
+	amr_synth_random payload(p_params.m_seed);
+	amr_synth_random choice(p_params.m_seed ^ 0x5bd1e995);
+	const unsigned modes = p_params.m_modes & ((1u << amr_synth_modes) - 1);
+	p_out.set_size(6 + (t_size)p_frames * (1 + Decoder_Interface_block_size[amr_synth_modes - 1]));
+	t_size size = 0;
+	if (p_magic) {
+		memcpy(p_out.get_ptr(), "#!AMR\x0a", 6);
+		size = 6;
+	}
+	unsigned mode = modes != 0 ? amr_synth_pick_mode(modes, amr_synth_modes, choice) : 0;
+	bool pause = modes == 0;
+	unsigned paused = 0;
+	for (unsigned i = 0; i < p_frames; ++i) {
+		if (modes != 0 && i % amr_synth_run_frames == 0) {
+			pause = choice.chance(p_params.m_dtx);
+			paused = 0;
+		}
+		if (!pause && p_params.m_switch_frames != 0 && i > 0 && i % p_params.m_switch_frames == 0) mode = amr_synth_pick_mode(modes, mode, choice);
+		const unsigned ft = !pause ? mode : paused++ % amr_synth_sid_period == 0 ? amr_synth_sid : amr_synth_no_data;
+		const bool bad = !pause && choice.chance(p_params.m_bad);
+		p_out[size++] = (t_uint8)(ft << 3 | (bad ? 0 : 0x04));
+		if (choice.chance(p_params.m_corrupt)) {
+			/* reserved type has no payload, so the payload after it is taken for headers */
+			p_out[size - 1] = (t_uint8)((amr_synth_reserved + choice.below(amr_synth_reserved_types)) << 3 | (choice.next() & 0x87));
+		}
+		const short bytes = Decoder_Interface_block_size[ft];
+		for (short j = 0; j < bytes; ++j) p_out[size++] = payload.next();
+		if (bytes > 0 && g_synth_bits[ft] % 8 != 0) p_out[size - 1] &= (t_uint8)(0xFF << (8 - g_synth_bits[ft] % 8));
+	}
+	p_out.set_size(size - pfc::min_t<t_size>(p_params.m_truncate, size - (p_magic ? 6 : 0)));
+}
+
+/* streams the benchmarks are run on: each mode's worst case, mixes as calls have them, and broken files */
+static const struct {
+	const char * m_name;
+	amr_synth_params m_params;
+} g_synth_presets[] = {
+	{ "all-MR122", { 0x80, 0, 0, 0, 0, 0, 1 } },
+	{ "all-MR475", { 0x01, 0, 0, 0, 0, 0, 2 } },
+	{ "dtx-only", { 0, 0, 0, 0, 0, 0, 3 } },
+	{ "mixed-call", { 0xFF, 250, 0.4, 0.01, 0, 0, 4 } },
+	{ "switch-every-frame", { 0xFF, 1, 0, 0, 0, 0, 5 } },
+	{ "switch-every-frame-dtx", { 0xFF, 1, 0.5, 0, 0, 0, 6 } },
+	{ "bad-quality-20pct", { 0xFF, 50, 0.2, 0.2, 0, 0, 7 } },
+	{ "corrupt-headers", { 0xFF, 50, 0.2, 0.01, 0.005, 0, 8 } },
+	{ "truncated", { 0x80, 0, 0, 0, 0, 17, 9 } },
+};
+
+pfc::string8 amr_synth_write_presets(const char * p_folder, abort_callback & p_abort) {
+	if (!filesystem::g_exists(p_folder, p_abort)) filesystem::g_create_directory(p_folder, p_abort);
+	pfc::string_formatter report;
+	pfc::array_t<t_uint8> stream;
+	for (t_size i = 0; i < PFC_TABSIZE(g_synth_presets); ++i) {
+		amr_synthesize(g_synth_presets[i].m_params, amr_synth_preset_frames, true, stream);
+		pfc::string8 path = p_folder;
+		path.add_filename(pfc::string_formatter() << g_synth_presets[i].m_name << ".amr");
+		service_ptr_t<file> out;
+		filesystem::g_open_write_new(out, path, p_abort);
+		out->write(stream.get_ptr(), stream.get_size(), p_abort);
+		report << path << ": " << stream.get_size() << " bytes\n";
+	}
+	return report;
+}
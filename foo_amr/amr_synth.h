@@ -0,0 +1,50 @@
+/**
+ * foo_input_amr - synthetic AMR streams, as inputs of benchmarks and stress tests
+*/
+#pragma once
+
+/**
+ * What a synthetic stream is made of. Speech is drawn from the modes in m_modes and changes mode every
+ * m_switch_frames frames; the stream is cut in runs of a second, each of which is a DTX pause with
+ * probability m_dtx: a SID frame and NO_DATA frames after it, SID again every 8 frames. Frames with their
+ * quality bit cleared and frames with garbage header, a reserved frame type the reader must resync
+ * after, come at given rates; the end may be cut off mid frame. Payload bits are random, but frames are
+ * the sizes their type says, and bits past the last one of a frame are zero. Same parameters give the
+ * same stream on every machine.
+ *
+ * @since   1.2.0
+ */
+struct amr_synth_params {
+	/* modes speech is drawn from, bit 0 for MR475 to bit 7 for MR122; none for DTX pause only */
+	unsigned m_modes;
+	/* frames between changes of mode, 0 for never */
+	unsigned m_switch_frames;
+	/* share of seconds that are DTX pauses, of speech frames with quality bit cleared, and of frames with garbage header */
+	double m_dtx, m_bad, m_corrupt;
+	/* bytes cut off the end */
+	unsigned m_truncate;
+	/* seed of the payload and of the choices */
+	t_uint32 m_seed;
+};
+
+/**
+ * Builds a synthetic stream.
+ *
+ * @param p_params		what it is made of
+ * @param p_frames		frames, 20ms each
+ * @param p_magic		starts it with "#!AMR\n", as a file; without, it's frames only
+ * @param p_out			receives the stream
+ * @since				1.2.0
+ */
+void amr_synthesize(const amr_synth_params & p_params, unsigned p_frames, bool p_magic, pfc::array_t<t_uint8> & p_out);
+
+/**
+ * Writes a file of each preset, the worst cases benchmarks are run on, to given folder, which is
+ * created if need be.
+ *
+ * @param p_folder		folder
+ * @param p_abort		abort callback
+ * @return				report, a line per file
+ * @since				1.2.0
+ */
+pfc::string8 amr_synth_write_presets(const char * p_folder, abort_callback & p_abort);
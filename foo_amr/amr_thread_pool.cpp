@@ -0,0 +1,132 @@
+/**
+ * foo_input_amr - worker threads shared by everything the component does in parallel
+*/
+#include "../foo_sdk/foobar2000/SDK/foobar2000.h"
+#include <algorithm>
+#include "amr_thread_pool.h"
+#include "amr_io_throttle.h"
+
+void amr_task::wait() {
+	if (!m_submitted) return;
+	if (amr_thread_pool::get().withdraw(*this)) run();
+	m_done.wait_for(-1);
+	m_submitted = false;
+}
+
+void amr_task::cancel() {
+	if (!m_submitted) return;
+	if (!amr_thread_pool::get().withdraw(*this)) m_done.wait_for(-1);
+	m_submitted = false;
+}
+
+void amr_task::run() {
+	try {
+		m_work();
+	} catch (...) {
+		/* tasks handle their own errors; one that did not must not take the worker down */
+	}
+	m_done.set_state(true);
+}
+
+amr_thread_pool & amr_thread_pool::get() {
+	static amr_thread_pool instance;
+	return instance;
+}
+
+amr_thread_pool::amr_thread_pool() : m_cores(pfc::max_t<t_size>(pfc::getOptimalWorkerThreadCount(), 1)), m_busy(0), m_stopping(false) {}
+
+void amr_thread_pool::submit(amr_task & p_task, std::function<void()> p_work, amr_task_priority p_priority) {
+	p_task.m_work = std::move(p_work);
+	p_task.m_priority = p_priority;
+	p_task.m_done.set_state(false);
+	p_task.m_submitted = true;
+	{
+		std::lock_guard<std::mutex> lock(m_lock);
+		if (!m_stopping) {
+			/* one worker per core, and the one kept for playback */
+			if (m_threads.get_size() == 0) {
+				m_threads.set_size(m_cores + 1);
+				for (t_size i = 0; i < m_threads.get_size(); ++i) m_threads[i].startHere([this] { work(); });
+			}
+			m_queues[p_priority].push_back(&p_task);
+			m_wake.notify_one();
+			return;
+		}
+	}
+	p_task.run();
+}
+
+t_size amr_thread_pool::get_queued(amr_task_priority p_priority) {
+	std::lock_guard<std::mutex> lock(m_lock);
+	return m_queues[p_priority].size();
+}
+
+bool amr_thread_pool::withdraw(amr_task & p_task) {
+	std::lock_guard<std::mutex> lock(m_lock);
+	std::deque<amr_task*> & queue = m_queues[p_task.m_priority];
+	const auto found = std::find(queue.begin(), queue.end(), &p_task);
+	if (found == queue.end()) return false;
+	queue.erase(found);
+	return true;
+}
+
+amr_task * amr_thread_pool::next() {
+	if (!m_queues[amr_priority_playback].empty()) {
+		amr_task * task = m_queues[amr_priority_playback].front();
+		m_queues[amr_priority_playback].pop_front();
+		return task;
+	}
+	if (m_busy >= m_cores) return NULL;
+	for (unsigned p = amr_priority_playback + 1; p < amr_priorities; ++p) {
+		if (m_queues[p].empty()) continue;
+		amr_task * task = m_queues[p].front();
+		m_queues[p].pop_front();
+		++m_busy;
+		return task;
+	}
+	return NULL;
+}
+
+void amr_thread_pool::work() {
+	std::unique_lock<std::mutex> lock(m_lock);
+	for (;;) {
+		amr_task * task = NULL;
+		m_wake.wait(lock, [this, &task] { return m_stopping || (task = next()) != NULL; });
+		if (task == NULL) return;
+		const bool playback = task->m_priority == amr_priority_playback;
+		lock.unlock();
+		/* task may be gone as soon as it's done; nothing of it is touched after */
+		if (task->m_priority == amr_priority_indexing) {
+			/* indexing ahead of need yields disk and cores to playback */
+			amr_io_throttle::background_scope background;
+			task->run();
+		}
+		else task->run();
+		lock.lock();
+		if (!playback) {
+			--m_busy;
+			/* a task held back for want of a core may go now */
+			m_wake.notify_one();
+		}
+	}
+}
+
+void amr_thread_pool::stop() {
+	{
+		std::lock_guard<std::mutex> lock(m_lock);
+		m_stopping = true;
+	}
+	m_wake.notify_all();
+	for (t_size i = 0; i < m_threads.get_size(); ++i) m_threads[i].waitTillDone();
+	m_threads.set_size(0);
+}
+
+/* ends the workers on shutdown, before the component is unloaded */
+class amr_thread_pool_initquit : public initquit {
+public:
+	void on_quit() {
+		amr_thread_pool::get().stop();
+	}
+};
+
+static initquit_factory_t<amr_thread_pool_initquit> g_amr_thread_pool_initquit;
@@ -0,0 +1,113 @@
+/**
+ * foo_input_amr - worker threads shared by everything the component does in parallel
+*/
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+
+/* what a task is done for; workers take tasks of a higher class first */
+enum amr_task_priority {
+	/* reading and decoding ahead of playback, which is heard if it's late */
+	amr_priority_playback,
+	/* decoding segments of a file being converted, which its input waits for */
+	amr_priority_decoding,
+	/* indexing files ahead of need; run at background priority, see amr_io_throttle */
+	amr_priority_indexing,
+	amr_priorities,
+};
+
+/**
+ * Work handed to amr_thread_pool, and the means to wait for it. Task that was not taken by a worker
+ * yet when it's waited for is taken back and run by the waiting thread, so waiting never depends on
+ * a free worker. Destroying a task cancels it.
+ *
+ * @since   1.2.0
+ */
+class amr_task {
+public:
+	amr_task() : m_priority(amr_priority_playback), m_submitted(false) {}
+	~amr_task() { cancel(); }
+
+	/* waits for the task to be done, running it here if no worker took it yet */
+	void wait();
+
+	/* waits for the task if a worker took it already; otherwise it's dropped without being run */
+	void cancel();
+
+private:
+	friend class amr_thread_pool;
+	amr_task(const amr_task &) = delete;
+	void operator=(const amr_task &) = delete;
+
+	/* runs the work, and tells the waiting thread it's done */
+	void run();
+
+	std::function<void()> m_work;
+	amr_task_priority m_priority;
+	pfc::event m_done;
+	/* given to the pool, and not waited for since */
+	bool m_submitted;
+};
+
+/**
+ * Worker threads shared by all inputs and all features, so decoding ahead, decoding segments of files
+ * being converted and indexing files ahead don't each start threads of their own, and several converter
+ * threads decoding at once don't have more workers than there are cores between them. Workers are
+ * started on first use. Tasks are taken in order of priority, then in order they came; tasks other than
+ * playback ones are run by as many workers as there are cores at most, and one more worker is there
+ * for playback, so playback never waits for a long file being indexed.
+ *
+ * Tasks are submitted by input and job threads, never by the workers themselves, so there's one queue
+ * per priority rather than one per worker to steal from; waiting thread takes back the task it waits
+ * for, which is what stealing would do. All methods are thread-safe.
+ *
+ * @since   1.2.0
+ */
+class amr_thread_pool {
+public:
+	/* the one instance shared by all inputs */
+	static amr_thread_pool & get();
+
+	/**
+	 * Queues work for the next free worker.
+	 *
+	 * @param p_task		task to wait for it with; not to be submitted again before it's waited for
+	 * @param p_work		the work; it's not to throw
+	 * @param p_priority	what it's done for
+	 * @since				1.2.0
+	 */
+	void submit(amr_task & p_task, std::function<void()> p_work, amr_task_priority p_priority);
+
+	/* tasks of given priority no worker took yet */
+	t_size get_queued(amr_task_priority p_priority);
+
+	/* tasks of other than playback priority done at the same time at most, the number of cores */
+	t_size get_workers() const { return m_cores; }
+
+	/* waits for the workers to finish what they run and ends them; tasks submitted after are run right away */
+	void stop();
+
+private:
+	amr_thread_pool();
+	~amr_thread_pool() { stop(); }
+
+	friend class amr_task;
+	/* takes task out of its queue if no worker took it yet */
+	bool withdraw(amr_task & p_task);
+	/* worker thread: runs tasks until stop() */
+	void work();
+	/* next task a worker may take, taken out of its queue, or NULL */
+	amr_task * next();
+
+	const t_size m_cores;
+	std::mutex m_lock;
+	std::condition_variable m_wake;
+	std::deque<amr_task*> m_queues[amr_priorities];
+	/* workers running tasks other than playback ones */
+	t_size m_busy;
+	bool m_stopping;
+	pfc::array_t<pfc::thread2> m_threads;
+};
@@ -0,0 +1,87 @@
+/**
+ * foo_input_amr - faster playback with pitch kept, using pitch lags the decoder got from the frames
+*/
+#include "../foo_sdk/foobar2000/SDK/foobar2000.h"
+#include "amr_time_scaler.h"
+
+static advconfig_integer_factory g_amr_speed("AMR decoder: playback speed in percent, pitch kept, up to 200; 100 for normal speed",
+	{ 0x8e3b7c15, 0x4fd2, 0x4a96,{ 0xb1, 0x07, 0x2c, 0xe4, 0x68, 0x9d, 0x53, 0xa0 } },
+	advconfig_branch::guid_branch_decoding, 18, 100, 100, amr_time_scaler_max_speed);
+
+unsigned amr_time_scaler::get_preferred_speed() {
+	return (unsigned)g_amr_speed.get();
+}
+
+void amr_time_scaler::setup(unsigned p_speed, unsigned p_channels, unsigned p_frame_samples) {
+	m_speed = pfc::min_t<unsigned>(p_speed, amr_time_scaler_max_speed);
+	m_channels = p_channels;
+	m_frame_samples = p_frame_samples;
+	reset();
+}
+
+void amr_time_scaler::reset() {
+	m_count = 0;
+	m_debt = 0;
+}
+
+const audio_sample * amr_time_scaler::run(const audio_sample * p_in, unsigned p_frames, const unsigned * p_lags, bool p_last, t_size & p_count) {
+	const unsigned channels = m_channels;
+	const t_size in_count = (t_size)p_frames * m_frame_samples;
+	m_in.set_size((m_count + in_count) * channels);
+	m_period.set_size(m_count + in_count);
+	memcpy(m_in.get_ptr() + m_count * channels, p_in, in_count * channels * sizeof(audio_sample));
+	/* periods at the rate of the audio; doubled short ones are still periods */
+	for (unsigned f = 0; f < p_frames; ++f) {
+		unsigned lag = p_lags[f] == 0 ? amr_time_scaler_noise_lag : p_lags[f];
+		if (lag < amr_time_scaler_min_lag) lag *= 2;
+		const t_uint16 period = (t_uint16)pfc::max_t<unsigned>(1, lag * m_frame_samples / amr_time_scaler_frame_samples);
+		t_uint16 * out = m_period.get_ptr() + m_count + (t_size)f * m_frame_samples;
+		for (unsigned i = 0; i < m_frame_samples; ++i) out[i] = period;
+	}
+	const t_size count = m_count + in_count;
+
+	/* every sample in adds this much to cut, so that what comes out is 100 / speed of what went in */
+	const double cut = 1.0 - 100.0 / m_speed;
+	/* cut can't be made without two periods of the longest lag ahead, unless nothing follows */
+	const t_size ahead = p_last ? 0 : 2 * (t_size)amr_time_scaler_max_lag * m_frame_samples / amr_time_scaler_frame_samples;
+	m_out.set_size(count * channels);
+	const audio_sample * in = m_in.get_ptr();
+	audio_sample * out = m_out.get_ptr();
+	t_size pos = 0, produced = 0;
+	while (pos < count && count - pos > ahead) {
+		const t_size period = m_period[pos];
+		if (m_debt >= period && count - pos >= 2 * period) {
+			/* period fades out as the one after it fades in; both go, one period of the two comes out */
+			const audio_sample * a = in + pos * channels;
+			const audio_sample * b = a + period * channels;
+			audio_sample * o = out + produced * channels;
+			for (t_size i = 0; i < period; ++i) {
+				const audio_sample w = (audio_sample)((i + 0.5) / period);
+				for (unsigned c = 0; c < channels; ++c) o[i * channels + c] = a[i * channels + c] + w * (b[i * channels + c] - a[i * channels + c]);
+			}
+			pos += 2 * period;
+			produced += period;
+			m_debt += 2 * period * cut - period;
+			continue;
+		}
+		memcpy(out + produced * channels, in + pos * channels, channels * sizeof(audio_sample));
+		++pos;
+		++produced;
+		m_debt += cut;
+	}
+
+	/* what's left is held back, at the front */
+	m_count = count - pos;
+	memmove(m_in.get_ptr(), in + pos * channels, m_count * channels * sizeof(audio_sample));
+	memmove(m_period.get_ptr(), m_period.get_ptr() + pos, m_count * sizeof(t_uint16));
+	p_count = produced;
+	return out;
+}
+
+void amr_time_scaler::reserve(unsigned p_frames) {
+	/* no more than two periods of the longest lag are held back */
+	const t_size count = (2 * (t_size)amr_time_scaler_max_lag + (t_size)p_frames * amr_time_scaler_frame_samples) * m_frame_samples / amr_time_scaler_frame_samples;
+	m_in.prealloc(count * m_channels);
+	m_period.prealloc(count);
+	m_out.prealloc(count * m_channels);
+}
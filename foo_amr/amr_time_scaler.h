@@ -0,0 +1,79 @@
+/**
+ * foo_input_amr - faster playback with pitch kept, using pitch lags the decoder got from the frames
+*/
+#pragma once
+
+enum {
+	/* samples of each decoded frame at 8 kHz */
+	amr_time_scaler_frame_samples = 160,
+	/* longest pitch lag there is, at 8 kHz */
+	amr_time_scaler_max_lag = 143,
+	/* lags shorter than this are doubled, so crossfades are long enough not to be heard as clicks */
+	amr_time_scaler_min_lag = 40,
+	/* period cut out of comfort noise, which has no pitch, 10ms at 8 kHz */
+	amr_time_scaler_noise_lag = 80,
+	/* playback speed, in percent, at most; cuts then follow one another */
+	amr_time_scaler_max_speed = 200,
+};
+
+/**
+ * Speeds playback up with pitch kept, by cutting whole pitch periods out of the audio: a period is
+ * crossfaded into the one following it, so 2 periods become 1, and the waveform stays continuous
+ * as speech is periodic over them. Cuts are made as often as needed for the speed, wherever they
+ * fall. Pitch period is taken from the lag decoder used for the frame, see Decoder_Interface_pitch_lag(),
+ * so there's no pitch detection, which is what makes time stretching of PCM expensive.
+ *
+ * Audio may be upsampled already; lags are scaled to its rate. Cut needs two periods of audio ahead,
+ * so that many samples are held back until the next frames come, or until the end.
+ *
+ * @since   1.2.0
+ */
+class amr_time_scaler {
+public:
+	amr_time_scaler() : m_speed(100), m_channels(0), m_frame_samples(0), m_count(0), m_debt(0) {}
+
+	/* playback speed asked for in preferences, in percent, 100 for none */
+	static unsigned get_preferred_speed();
+
+	/**
+	 * Gets ready to scale audio of given layout, nothing held back.
+	 *
+	 * @param p_speed		speed in percent; 100 or less disables scaling, more than amr_time_scaler_max_speed is limited to it
+	 * @param p_channels	number of interleaved channels
+	 * @param p_frame_samples	samples per channel that one frame is, at the rate of the audio
+	 * @since				1.2.0
+	 */
+	void setup(unsigned p_speed, unsigned p_channels, unsigned p_frame_samples);
+
+	/* drops audio held back, as after seek */
+	void reset();
+
+	/* setup() was given a speed up */
+	bool is_active() const { return m_speed > 100; }
+
+	/**
+	 * Scales frames following the ones before.
+	 *
+	 * @param p_in			interleaved samples of p_frames frames
+	 * @param p_frames		number of frames
+	 * @param p_lags		pitch lag of each frame, at 8 kHz, 0 for none
+	 * @param p_last		no frames follow, so nothing is held back
+	 * @param p_count		receives number of samples per channel returned
+	 * @return				interleaved samples, valid until the next call
+	 * @since				1.2.0
+	 */
+	const audio_sample * run(const audio_sample * p_in, unsigned p_frames, const unsigned * p_lags, bool p_last, t_size & p_count);
+
+	/* sizes buffers for runs of up to p_frames frames, so run() doesn't allocate; buffers only ever grow anyway */
+	void reserve(unsigned p_frames);
+
+private:
+	unsigned m_speed, m_channels, m_frame_samples;
+	/* samples held back, interleaved, and period to cut at each of them, at the rate of the audio */
+	pfc::array_t<audio_sample, pfc::alloc_fast_aggressive> m_in;
+	pfc::array_t<t_uint16, pfc::alloc_fast_aggressive> m_period;
+	t_size m_count;
+	/* samples to cut yet for the speed, from all that went in */
+	double m_debt;
+	pfc::array_t<audio_sample, pfc::alloc_fast_aggressive> m_out;
+};
@@ -0,0 +1,45 @@
+/**
+ * foo_input_amr - zone markers for timeline profilers
+*/
+#ifdef DEC_TRACE
+#include "../foo_sdk/foobar2000/SDK/foobar2000.h"
+#include <winmeta.h>
+#include <TraceLoggingProvider.h>
+extern "C" {
+	#include "../3gpp/sp_dec.h"
+}
+#include "amr_trace.h"
+
+/* provider foo_input_amr; GUID is the one tools derive from the name, so "wpr -start" with either enables it */
+// {6C07CEAD-B519-5DED-2EBC-69AFFB0F6E22}
+TRACELOGGING_DEFINE_PROVIDER(g_amr_trace_provider, "foo_input_amr", (0x6c07cead, 0xb519, 0x5ded, 0x2e, 0xbc, 0x69, 0xaf, 0xfb, 0x0f, 0x6e, 0x22));
+
+void amr_trace_begin(const char * p_zone) {
+	TraceLoggingWrite(g_amr_trace_provider, "Zone", TraceLoggingOpcode(WINEVENT_OPCODE_START), TraceLoggingString(p_zone, "Name"));
+}
+
+void amr_trace_end(const char * p_zone) {
+	TraceLoggingWrite(g_amr_trace_provider, "Zone", TraceLoggingOpcode(WINEVENT_OPCODE_STOP), TraceLoggingString(p_zone, "Name"));
+}
+
+/* zones of decoder stages, see DEC_TRACE_BEGIN in sp_dec.h */
+extern "C" void Dec_trace_begin(const char * zone) {
+	amr_trace_begin(zone);
+}
+
+extern "C" void Dec_trace_end(const char * zone) {
+	amr_trace_end(zone);
+}
+
+/**
+ * Registers the provider when foobar starts, and unregisters it on shutdown; zones before and after
+ * are not emitted.
+ */
+class amr_trace_initquit : public initquit {
+public:
+	void on_init() { TraceLoggingRegister(g_amr_trace_provider); }
+	void on_quit() { TraceLoggingUnregister(g_amr_trace_provider); }
+};
+
+static initquit_factory_t<amr_trace_initquit> g_amr_trace_initquit;
+#endif
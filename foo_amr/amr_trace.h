@@ -0,0 +1,34 @@
+/**
+ * foo_input_amr - zone markers for timeline profilers
+*/
+#pragma once
+
+#ifdef DEC_TRACE
+/**
+ * Emits begin and end of a zone, the time an input or decoder stage spent in it, to ETW, as Start and
+ * Stop events named "Zone" of provider foo_input_amr, with name of the zone as field "Name"; recorded with
+ * WPR and viewed in WPA next to foobar's own events, they show which zone a playback hiccup fell in.
+ * Nothing is emitted unless a session enables the provider. Zones are nested, on the thread that opened
+ * them. Another profiler is hooked in by changing these two functions, see amr_trace.cpp.
+ *
+ * @since   1.2.0
+ */
+void amr_trace_begin(const char * p_zone);
+void amr_trace_end(const char * p_zone);
+
+/* zone lasting as long as the object, so every return of a function ends it */
+class amr_trace_zone {
+public:
+	explicit amr_trace_zone(const char * p_zone) : m_zone(p_zone) { amr_trace_begin(p_zone); }
+	~amr_trace_zone() { amr_trace_end(m_zone); }
+private:
+	amr_trace_zone(const amr_trace_zone &);
+	amr_trace_zone & operator=(const amr_trace_zone &);
+	const char * m_zone;
+};
+
+/* marks the rest of the enclosing block as a zone of given literal name, in tracing build only, built with DEC_TRACE defined */
+#define AMR_TRACE_ZONE(zone) amr_trace_zone amr_trace_zone_(zone)
+#else
+#define AMR_TRACE_ZONE(zone) (void)0
+#endif
@@ -0,0 +1,31 @@
+/**
+ * foo_input_amr - tuning profiles, presets of the performance settings for a kind of machine or work
+*/
+#include "../foo_sdk/foobar2000/SDK/foobar2000.h"
+#include "amr_tuning.h"
+
+/* radio buttons of a group have a branch of their own */
+static const GUID guid_amr_profile_branch = { 0x2f6d8b13, 0xa74e, 0x4c05,{ 0x9d, 0x31, 0x58, 0xe2, 0x0b, 0xc6, 0x7f, 0x94 } };
+
+static advconfig_branch_factory g_amr_profile_branch("AMR decoder: tuning profile, presets of chunk size, decoding ahead, threads and memory for decoded audio",
+	guid_amr_profile_branch, advconfig_branch::guid_branch_decoding, 30);
+
+static advconfig_radio_factory g_amr_profile_custom("Custom, each setting as set",
+	{ 0x6b1e0f94, 0x3d27, 0x4a8c,{ 0xb5, 0x62, 0x0e, 0x9f, 0x14, 0xd3, 0x7a, 0x28 } },
+	guid_amr_profile_branch, 0, true);
+static advconfig_radio_factory g_amr_profile_playback("Playback",
+	{ 0xd84c2a57, 0x91b0, 0x4e3f,{ 0x87, 0x1d, 0x6c, 0x35, 0xf8, 0x02, 0xbe, 0x49 } },
+	guid_amr_profile_branch, 1, false);
+static advconfig_radio_factory g_amr_profile_transcode("Bulk transcoding and scanning",
+	{ 0x0a7f39c6, 0xe215, 0x4b98,{ 0x8c, 0x4e, 0x21, 0xd7, 0x96, 0x5b, 0x03, 0xfa } },
+	guid_amr_profile_branch, 2, false);
+static advconfig_radio_factory g_amr_profile_low_memory("Low memory, as many sessions on one server",
+	{ 0x5c93e8b2, 0x06fd, 0x47a1,{ 0x9e, 0x58, 0xb3, 0x2a, 0x7d, 0x10, 0xc4, 0x6e } },
+	guid_amr_profile_branch, 3, false);
+
+amr_profile amr_get_profile() {
+	if (g_amr_profile_playback.get()) return amr_profile_playback;
+	if (g_amr_profile_transcode.get()) return amr_profile_transcode;
+	if (g_amr_profile_low_memory.get()) return amr_profile_low_memory;
+	return amr_profile_custom;
+}
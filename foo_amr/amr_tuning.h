@@ -0,0 +1,55 @@
+/**
+ * foo_input_amr - tuning profiles, presets of the performance settings for a kind of machine or work
+*/
+#pragma once
+
+/* profiles to pick in advanced preferences */
+enum amr_profile {
+	/* each setting as set on its own */
+	amr_profile_custom,
+	/* a file at a time, listened to: short chunks, playback decoded ahead, audio kept for replaying */
+	amr_profile_playback,
+	/* many files converted or scanned: long chunks, files decoded on several threads, nothing kept for replaying */
+	amr_profile_transcode,
+	/* many sessions on one server: short chunks, little decoded ahead, nothing kept that can be decoded again, caches within 64 MB */
+	amr_profile_low_memory,
+	amr_profiles,
+};
+
+/* profile picked in advanced preferences */
+amr_profile amr_get_profile();
+
+/**
+ * Value of a setting under the profile picked, so that one choice sets a whole group of settings;
+ * under amr_profile_custom each has the value it was set to. Settings read this when they're used,
+ * so picking another profile takes effect with the next file decoded, without restart.
+ *
+ * @param p_custom		value the setting was set to
+ * @param p_playback	value under amr_profile_playback
+ * @param p_transcode	value under amr_profile_transcode
+ * @param p_low_memory	value under amr_profile_low_memory
+ * @since				1.2.0
+ */
+template<typename t_value> t_value amr_tuned(t_value p_custom, t_value p_playback, t_value p_transcode, t_value p_low_memory) {
+	switch (amr_get_profile()) {
+	case amr_profile_playback: return p_playback;
+	case amr_profile_transcode: return p_transcode;
+	case amr_profile_low_memory: return p_low_memory;
+	default: return p_custom;
+	}
+}
+
+/**
+ * Settings the autotuner picks for this machine, see "Autotune AMR decoder" in amr_benchmark.cpp,
+ * each defined next to the setting. Getters give the value as set, whatever the profile picked;
+ * setters are for the main thread.
+ */
+bool amr_get_scalar_kernels();
+void amr_set_scalar_kernels(bool p_scalar);
+unsigned amr_get_chunk_frames();
+void amr_set_chunk_frames(unsigned p_frames);
+bool amr_get_parallel();
+void amr_set_parallel(bool p_parallel);
+
+/* frames decoded per chunk under the profile picked, for every input that decodes several frames a call */
+unsigned amr_get_tuned_chunk_frames();
@@ -0,0 +1,105 @@
+/**
+ * foo_input_amr - polyphase upsampler of decoded audio, for devices running at higher rates
+*/
+#include "../foo_sdk/foobar2000/SDK/foobar2000.h"
+#include <math.h>
+#include "amr_upsampler.h"
+
+/* stopband attenuation of about 80 dB */
+static const double amr_upsampler_kaiser_beta = 8.0;
+/* cutoff, as fraction of input Nyquist frequency; AMR has little above 3.4 kHz anyway */
+static const double amr_upsampler_cutoff = 0.9;
+static const double amr_pi = 3.14159265358979323846;
+
+static advconfig_integer_factory g_amr_output_rate("AMR decoder: output sample rate, 16000, 44100 or 48000 to upsample, 8000 not to",
+	{ 0x4f81c6a2, 0x9e37, 0x4d50,{ 0xb3, 0x2a, 0x65, 0x0d, 0xc9, 0x7e, 0x14, 0x8b } },
+	advconfig_branch::guid_branch_decoding, 11, 8000, 8000, 48000);
+
+/* zeroth order modified Bessel function of the first kind, for the Kaiser window */
+static double amr_bessel_i0(double p_x) {
+	double sum = 1, term = 1;
+	for (unsigned k = 1; k < 32; ++k) {
+		const double half = p_x / (2 * k);
+		term *= half * half;
+		sum += term;
+	}
+	return sum;
+}
+
+unsigned amr_upsampler::get_preferred_rate() {
+	const unsigned rate = (unsigned)g_amr_output_rate.get();
+	return rate == 16000 || rate == 44100 || rate == 48000 ? rate : 0;
+}
+
+void amr_upsampler::setup(unsigned p_rate, unsigned p_channels) {
+	m_channels = p_channels;
+	switch (p_rate) {
+	case 16000: m_up = 2; m_down = 1; break;
+	case 44100: m_up = 441; m_down = 80; break;
+	case 48000: m_up = 6; m_down = 1; break;
+	default: m_rate = 0; m_up = 1; m_down = 1; return;
+	}
+	m_rate = p_rate;
+
+	/* prototype at the output rate; phase p has taps p, p + L, p + 2L, ... */
+	const unsigned length = amr_upsampler_taps * m_up;
+	/* whole number of output samples of delay, so every L-th output sample lines up with an input one */
+	const double center = length / 2;
+	const double cutoff = amr_upsampler_cutoff / m_up;
+	const double window = amr_bessel_i0(amr_upsampler_kaiser_beta);
+	m_phases.set_size(length);
+	for (unsigned p = 0; p < m_up; ++p) {
+		float * phase = m_phases.get_ptr() + p * amr_upsampler_taps;
+		double sum = 0;
+		for (unsigned k = 0; k < amr_upsampler_taps; ++k) {
+			const double t = p + (double)k * m_up - center;
+			const double ratio = t / center;
+			const double sinc = t == 0 ? 1 : sin(amr_pi * cutoff * t) / (amr_pi * cutoff * t);
+			const double tap = sinc * amr_bessel_i0(amr_upsampler_kaiser_beta * sqrt(pfc::max_t(0.0, 1 - ratio * ratio))) / window;
+			phase[amr_upsampler_taps - 1 - k] = (float)tap;
+			sum += tap;
+		}
+		/* every phase passes DC as is, so there's no ripple at the output rate */
+		for (unsigned k = 0; k < amr_upsampler_taps; ++k) phase[k] = (float)(phase[k] / sum);
+	}
+	reset();
+}
+
+void amr_upsampler::reset() {
+	m_history.set_size((amr_upsampler_taps - 1) * m_channels);
+	for (t_size i = 0; i < m_history.get_size(); ++i) m_history[i] = 0;
+}
+
+void amr_upsampler::run(const audio_sample * p_in, unsigned p_frames, audio_sample * p_out) {
+	const unsigned keep = amr_upsampler_taps - 1;
+	const unsigned in_count = p_frames * amr_upsampler_frame_samples;
+	const unsigned out_count = p_frames * get_frame_samples();
+	m_work.set_size(keep + in_count);
+	float * work = m_work.get_ptr();
+	for (unsigned c = 0; c < m_channels; ++c) {
+		/* history, then this channel's input, contiguous */
+		float * history = m_history.get_ptr() + c * keep;
+		memcpy(work, history, keep * sizeof(float));
+		for (unsigned i = 0; i < in_count; ++i) work[keep + i] = p_in[i * m_channels + c];
+
+		/* output sample n is at input position n * M / L; phase is what's left over */
+		unsigned position = 0, phase = 0;
+		for (unsigned n = 0; n < out_count; ++n) {
+			const float * taps = m_phases.get_ptr() + phase * amr_upsampler_taps;
+			const float * x = work + position;
+			float sum = 0;
+			for (unsigned k = 0; k < amr_upsampler_taps; ++k) sum += taps[k] * x[k];
+			p_out[n * m_channels + c] = sum;
+			phase += m_down;
+			while (phase >= m_up) {
+				phase -= m_up;
+				++position;
+			}
+		}
+		memcpy(history, work + in_count, keep * sizeof(float));
+	}
+}
+
+void amr_upsampler::reserve(unsigned p_frames) {
+	m_work.prealloc(amr_upsampler_taps - 1 + p_frames * amr_upsampler_frame_samples);
+}
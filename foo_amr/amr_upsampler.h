@@ -0,0 +1,71 @@
+/**
+ * foo_input_amr - polyphase upsampler of decoded audio, for devices running at higher rates
+*/
+#pragma once
+
+enum {
+	/* taps of each phase of the filter; a multiple of 8, so dot products vectorize well */
+	amr_upsampler_taps = 48,
+	/* samples of each decoded frame */
+	amr_upsampler_frame_samples = 160,
+};
+
+/**
+ * Upsamples decoded audio from 8 kHz to 16, 44.1 or 48 kHz, frame by frame, so foobar's resampler DSP
+ * is not needed after the input. Ratio L/M is 2/1, 441/80 or 6/1; 160 samples of a frame become
+ * 320, 882 or 960 samples, so output of whole frames needs no fractional carry over. Lowpass filter is
+ * a Kaiser windowed sinc, half down at 3.6 kHz and 80 dB down from 4 kHz on, split into L phases of
+ * amr_upsampler_taps taps, each stored reversed so a phase is a plain dot product with contiguous input.
+ * Filter is causal, so output lags by half its length, 3 ms of audio.
+ *
+ * @since   1.2.0
+ */
+class amr_upsampler {
+public:
+	amr_upsampler() : m_rate(0), m_up(1), m_down(1), m_channels(0) {}
+
+	/* output rate asked for in preferences, one setup() supports, or 0 for none */
+	static unsigned get_preferred_rate();
+
+	/**
+	 * Gets ready to upsample audio of given layout, history cleared.
+	 *
+	 * @param p_rate		output sample rate; anything setup() doesn't support disables upsampling
+	 * @param p_channels	number of interleaved channels
+	 * @since				1.2.0
+	 */
+	void setup(unsigned p_rate, unsigned p_channels);
+
+	/* forgets history, as after seek */
+	void reset();
+
+	/* setup() was given supported rate */
+	bool is_active() const { return m_rate != 0; }
+
+	/* output sample rate */
+	unsigned get_rate() const { return m_rate; }
+
+	/* samples per channel that one frame of 160 becomes */
+	unsigned get_frame_samples() const { return amr_upsampler_frame_samples * m_up / m_down; }
+
+	/**
+	 * Upsamples frames following the ones before.
+	 *
+	 * @param p_in			interleaved samples of p_frames frames
+	 * @param p_frames		number of frames
+	 * @param p_out			room for p_frames * get_frame_samples() interleaved samples
+	 * @since				1.2.0
+	 */
+	void run(const audio_sample * p_in, unsigned p_frames, audio_sample * p_out);
+
+	/* sizes buffers for runs of up to p_frames frames, so run() doesn't allocate; buffers only ever grow anyway */
+	void reserve(unsigned p_frames);
+
+private:
+	unsigned m_rate, m_up, m_down, m_channels;
+	/* phases, each amr_upsampler_taps taps in reverse order */
+	pfc::array_t<float> m_phases;
+	/* last amr_upsampler_taps - 1 input samples of each channel, then room for input of a channel */
+	pfc::array_t<float> m_history;
+	pfc::array_t<float, pfc::alloc_fast_aggressive> m_work;
+};
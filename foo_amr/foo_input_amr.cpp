@@ -2,29 +2,116 @@
  * foo_input_amr - amr-nb decoder for foobar2000
 */
 #include <cstdint>
+#include <math.h>
 
 /* include foobar sdk */
 #include "../foo_sdk/foobar2000/SDK/foobar2000.h"
 /* include 3gpp amr-nb decoder */
 extern "C" { 
 	#include "../3gpp/interf_dec.h" 
+#ifdef DEC_PROFILE
+	#include "../3gpp/sp_dec.h"
+#endif
 }
-/* enable logging only in debug mode */
+#include "amr_index_cache.h"
+#include "amr_index_sidecar.h"
+#include "amr_frame_reader.h"
+#include "amr_frame_scan.h"
+#include "amr_decoder_pool.h"
+#include "amr_parallel_decoder.h"
+#include "amr_parallel_scan.h"
+#include "amr_shadow_check.h"
+#include "amr_decode_ahead.h"
+#include "amr_envelope.h"
+#include "amr_replaygain.h"
+#include "amr_features.h"
+#include "amr_spectrum.h"
+#include "amr_loudness.h"
+#include "amr_upsampler.h"
+#include "amr_time_scaler.h"
+#include "amr_pcm_cache.h"
+#include "amr_pcm_disk_cache.h"
+#include "amr_preindex.h"
+#include "amr_edit.h"
+#include "amr_activity.h"
+#include "amr_analytics.h"
+#include "amr_segment_handoff.h"
+#include "amr_trace.h"
+#include "amr_alloc_track.h"
+#include "amr_tuning.h"
+#include "amr_checkpoints.h"
+#include "amr_counters.h"
+#include "../foo_sdk/foobar2000/helpers/dynamic_bitrate_helper.h"
+/* debug and trace logging is compiled in only in debug mode; release builds can log per-file summaries */
 #ifdef _DEBUG
 	#define SPDLOG_DEBUG_ON
 	#define SPDLOG_TRACE_ON
 #endif
 #include "spdlog\spdlog.h"
+/* summary of a file, one line each time it's scanned or played through; costs a pointer test when logging is off */
+#define AMR_LOG_SUMMARY(logger, ...) do { if (logger) logger->info(__VA_ARGS__); } while (0)
 
 enum {
 	/* AMR files have 8bit samples */
 	amr_bits_per_sample = 8,
-	/* AMR files are mono */
-	amr_channels = 1,
+	/* multichannel files have up to 6 channels; RFC 4867 defines channel order for no more */
+	amr_max_channels = 6,
 	/* AMR files are ~8000khz */
 	amr_sample_rate = 8000,
 	/* AMR frame is 20ms long */
 	amr_frame_sample_length = 20,
+	/* size of blocks read at once while scanning frame headers */
+	amr_scan_block_size = 64 * 1024,
+	/* by default decode_run() emits 50 frames, that is 1 second of audio, per chunk */
+	amr_default_chunk_frames = 50,
+	/* chunk frames preferences may ask for */
+	amr_min_chunk_frames = 10,
+	amr_max_chunk_frames = 500,
+	/* power saving playback emits 500 frames, 10 seconds, per chunk, so CPU sleeps in between */
+	amr_burst_chunk_frames = 500,
+	/* bytes sampled at each end of the file to estimate its length */
+	amr_estimate_sample_size = 4 * 1024,
+	/* longest frame there is, header included */
+	amr_max_frame_size = 32,
+	/* bytes searched for frames after inaccurate seek */
+	amr_resync_window = 4 * 1024,
+	/* streamed length estimate is reported again once it moves by this many frames, 10 seconds */
+	amr_stream_estimate_step = 500,
+	/* decoder state is saved every 250 frames, 5 seconds, decoded from the start; they're indexed frames too */
+	amr_checkpoint_interval = 5 * amr_index_interval,
+	/* upper limit of frames decoded and thrown away before seek target */
+	amr_max_seek_warmup_frames = 200,
+	/* last of them decoded in full, which settle post filter memories the others skip, see Decoder_Interface_Warmup() */
+	amr_seek_settle_frames = 2,
+	/* single channel files start with "#!AMR\n" */
+	amr_magic_size = 6,
+	/* multichannel ones with "#!AMR_MC1.0\n" and 4 bytes of channel description */
+	amr_mc_magic_size = 12,
+	amr_mc_header_size = amr_mc_magic_size + 4,
+	/* messages buffered by release logger; it writes them on its own thread, and drops them rather than wait if full */
+	amr_log_queue_size = 1024,
+	/* frames checked per chunk when verifying integrity, a minute; there is no decoding to keep chunks short for */
+	amr_verify_chunk_frames = 3000,
+	/* damaged frames listed in the error verifying integrity throws; console gets all of them */
+	amr_verify_max_listed = 8,
+	/* frames indexed per decode_on_idle() call while playing, 100 seconds */
+	amr_idle_index_frames = 5000,
+	/* shortest pause files are split into tracks at, 10 seconds */
+	amr_split_min_frames = 500,
+	/* file followed while it's being written is checked for new frames this often, one frame's time */
+	amr_follow_poll_ms = 20,
+	/* and taken as finished once nothing was written for this long */
+	amr_follow_timeout_ms = 5000,
+	/* frames of each end of a pause played when the rest is skipped, half a second; the ones before speech warm decoders up */
+	amr_skip_keep_frames = 25,
+	/* excerpt played of every interval when skimming, a second */
+	amr_skim_excerpt_frames = 50,
+	/* audio after a skipped part fades in over this many frames as audio before it fades out, 100ms */
+	amr_skip_fade_frames = 5,
+	/* decode_run() calls after start or seek that may still allocate, as buffers grow to the chunk size, in allocation tracking build */
+	amr_alloc_warmup_runs = 3,
+	/* most a quiet file is boosted by when normalizing loudness, in dB, so recordings of near silence don't become noise */
+	amr_normalize_max_boost = 20,
 
 	/**
 	 * helper contants derived from above
@@ -32,12 +119,19 @@ enum {
 	 */
 	amr_audio_frame_size = amr_frame_sample_length * amr_bits_per_sample,
 	amr_bytes_per_sample = amr_bits_per_sample / 8,
-	amr_total_sample_width = amr_bytes_per_sample * amr_channels,
 	/** 
 	 * @} 
 	 */
 };
 
+/* decoder writes its float output straight into audio_chunk, so both must agree on sample format */
+static_assert(sizeof(audio_sample) == sizeof(float), "audio_sample must be 32-bit float");
+static_assert(amr_pcm_frame_samples == amr_audio_frame_size, "cached frames must be decoded frames");
+/* track after a pause starts at a checkpoint within it */
+static_assert(amr_split_min_frames >= amr_checkpoint_interval, "pauses must span a checkpoint");
+/* pause skipped keeps its ends */
+static_assert(amr_pause_min_frames > 2 * amr_skip_keep_frames, "pauses must outlast their ends");
+
 enum rx_frame_type {
 	rx_ft_speech_good = 0,
 	rx_ft_speech_degraded,
@@ -60,13 +154,163 @@ enum amr_mode_type {
 	amr_102,
 	amr_122,
 	amr_dtx,
-	amr_n_modes
+	amr_n_modes,
+	/* frame types in between are reserved */
+	amr_no_data = 15
+};
+
+/* length of files opened only for info is estimated from few frames rather than counted by full scan */
+static advconfig_checkbox_factory g_amr_estimate_length("AMR decoder: estimate length of files not played yet",
+	{ 0x8d46f0b9, 0x21c7, 0x4a3f,{ 0xb5, 0x6e, 0x0c, 0x93, 0x4f, 0xd8, 0x27, 0x6a } },
+	advconfig_branch::guid_branch_decoding, 3, true);
+
+/* files of one mode, as most recorders write, are indexed from their size once frames checked at start, middle and end agree */
+static advconfig_checkbox_factory g_amr_constant_length("AMR decoder: take length of files of one mode from their size, checking frames at start, middle and end only",
+	{ 0x5a7c1e93, 0xd240, 0x4b86,{ 0x9f, 0x31, 0x6e, 0x08, 0xc5, 0xa2, 0x74, 0xdb } },
+	advconfig_branch::guid_branch_decoding, 22, true);
+
+/* frames decoded before seek target so the decoder is settled when audio resumes; 0 seeks without decoding */
+static advconfig_integer_factory g_amr_seek_warmup("AMR decoder: frames decoded before seek target",
+	{ 0x3b1f9d62, 0x7a4e, 0x4c05,{ 0xa8, 0x17, 0xd4, 0x5e, 0x90, 0x2b, 0x6c, 0xf1 } },
+	advconfig_branch::guid_branch_decoding, 2, 16, 0, amr_max_seek_warmup_frames);
+
+/* integrity is verified by checking every frame header and size, which is what damage breaks, rather than by decoding */
+static advconfig_checkbox_factory g_amr_fast_verify("AMR decoder: verify integrity by checking frame structure only, without decoding",
+	{ 0x1f5b8e27, 0xc4a0, 0x4d39,{ 0x96, 0x7e, 0x2b, 0x08, 0xd3, 0x51, 0xaf, 0x6c } },
+	advconfig_branch::guid_branch_decoding, 7, true);
+
+/* playing large file that's not indexed yet starts right away; it's indexed in idle time */
+static advconfig_checkbox_factory g_amr_idle_index("AMR decoder: index files not cached yet in idle time when playing, rather than before",
+	{ 0x5e92c1a7, 0x3b08, 0x4f6d,{ 0x81, 0xd4, 0x6a, 0x2f, 0xe0, 0x93, 0x57, 0xbc } },
+	advconfig_branch::guid_branch_decoding, 8, true);
+
+/* waveform seekbars can get the summary from the cached index, rather than decode the file on their own */
+static advconfig_checkbox_factory g_amr_envelope("AMR decoder: summarize peaks and RMS of files decoded through, for waveform seekbars",
+	{ 0x9b3e57d2, 0x64a1, 0x4c8f,{ 0xa5, 0x0e, 0x3d, 0x7b, 0x12, 0xc9, 0x86, 0x4f } },
+	advconfig_branch::guid_branch_decoding, 9, false);
+
+/* files played through get ReplayGain without a scan, from audio decoded anyway, see amr_replaygain */
+static advconfig_checkbox_factory g_amr_replaygain("AMR decoder: measure ReplayGain of files played through, for files without it in tags",
+	{ 0x6f1d83a4, 0xc27b, 0x4e59,{ 0x93, 0x0a, 0x5b, 0xe8, 0x41, 0x7c, 0xd2, 0x16 } },
+	advconfig_branch::guid_branch_decoding, 44, true);
+
+/* byte-identical copies of a file, as forwarded voicemails are, can be told by their hash, and reuse what's known of the original */
+static advconfig_checkbox_factory g_amr_content_hash("AMR decoder: hash frames when indexing, to recognize duplicate files",
+	{ 0x2d7c4e19, 0x9a53, 0x4b07,{ 0x8e, 0x61, 0xf4, 0x0b, 0x3c, 0xa2, 0x75, 0xd8 } },
+	advconfig_branch::guid_branch_decoding, 14, false);
+
+/* playing is the one use that doesn't need output identical to the reference decoder, and it gains most from faster decoding */
+static advconfig_checkbox_factory g_amr_float_engine("AMR decoder: post filter in floating point when playing, faster but not bit-exact",
+	{ 0x7e21b9d4, 0x3c56, 0x4a8e,{ 0x9f, 0x12, 0x65, 0xd0, 0xa7, 0x3b, 0xc8, 0x41 } },
+	advconfig_branch::guid_branch_decoding, 15, false);
+
+/* long recordings, as of meetings or dictation, are easier to find one's way in as one track per part, parts being what's between long pauses */
+static advconfig_integer_factory g_amr_split_pause("AMR decoder: split files into tracks at pauses at least this long, in seconds (10 or more, 0 not to split)",
+	{ 0x5b93c1e7, 0x2f08, 0x4d6a,{ 0x83, 0xc4, 0x1e, 0x7a, 0x59, 0xb2, 0x06, 0xdf } },
+	advconfig_branch::guid_branch_decoding, 16, 0, 0, 3600);
+
+/**
+ * playing on battery wakes CPU once per 10 seconds of audio rather than every second; files are in memory
+ * or read in blocks of most of a minute of audio already, so the disk is left alone either way
+ */
+static advconfig_checkbox_factory g_amr_burst("AMR decoder: decode 10 seconds at a time when playing, to save power on battery",
+	{ 0x4c8a1f63, 0xd952, 0x47b0,{ 0x9a, 0x3e, 0x61, 0x0f, 0xc7, 0x28, 0xb5, 0x94 } },
+	advconfig_branch::guid_branch_decoding, 17, false);
+
+/**
+ * buffers of a decoder grow to the largest chunk and stay that big; sized for it when decoding starts, so
+ * no chunk has to grow them, the first ones of 10 seconds included
+ */
+static advconfig_checkbox_factory g_amr_presize("AMR decoder: size buffers for the largest chunk when decoding starts, rather than as chunks come",
+	{ 0x9b4e2d71, 0x0c38, 0x4f5a,{ 0xb6, 0x83, 0x1d, 0x7f, 0xe2, 0x45, 0xa9, 0x0c } },
+	advconfig_branch::guid_branch_decoding, 29, false);
+
+/* fewer calls cost less, larger chunks take more memory and react to seek and stop later; burst playback overrides it */
+static advconfig_integer_factory g_amr_chunk_frames("AMR decoder: frames decoded per chunk, 50 to a second (10 to 500)",
+	{ 0x71c5e0a8, 0x2b94, 0x4d3f,{ 0x86, 0x1a, 0xf4, 0x0d, 0x37, 0xc9, 0x5e, 0x62 } },
+	advconfig_branch::guid_branch_decoding, 31, amr_default_chunk_frames, amr_min_chunk_frames, amr_max_chunk_frames);
+
+unsigned amr_get_chunk_frames() { return (unsigned)g_amr_chunk_frames.get(); }
+void amr_set_chunk_frames(unsigned p_frames) { g_amr_chunk_frames.set(p_frames); }
+
+/* converting goes faster with long chunks, low memory keeps them short */
+unsigned amr_get_tuned_chunk_frames() {
+	const unsigned custom = (unsigned)pfc::min_t<t_uint64>(pfc::max_t<t_uint64>(g_amr_chunk_frames.get(), amr_min_chunk_frames), amr_max_chunk_frames);
+	return amr_tuned<unsigned>(custom, amr_default_chunk_frames, amr_max_chunk_frames, amr_min_chunk_frames);
+}
+
+/**
+ * files recorded on different phones differ in level by 10 dB and more; gain from their estimated level is applied
+ * by the decoders as they write samples, so playback takes no gain pass over each chunk as ReplayGain in the DSP chain
+ * does. Files indexed without loudness estimate are played as they are
+ */
+static advconfig_checkbox_factory g_amr_normalize("AMR decoder: normalize loudness when playing, from level estimated when indexing (in place of ReplayGain)",
+	{ 0xccf8e2a6, 0xab58, 0x4ddb,{ 0x82, 0xc7, 0x02, 0x86, 0xd3, 0xac, 0x33, 0x7c } },
+	advconfig_branch::guid_branch_decoding, 34, false);
+
+static advconfig_integer_factory g_amr_normalize_level("AMR decoder: level loudness is normalized to, in dB below full scale",
+	{ 0x5a1ccb30, 0x6e1a, 0x4e81,{ 0x99, 0x93, 0x77, 0x2d, 0x47, 0x12, 0x26, 0x9a } },
+	advconfig_branch::guid_branch_decoding, 35, 20, 6, 40);
+
+/* voicemail and dictation are mostly waiting; playing jumps over long pauses, and length is reported without them */
+static advconfig_integer_factory g_amr_skip_pause("AMR decoder: skip pauses at least this long when playing, in seconds (2 or more, 0 not to skip)",
+	{ 0x1d6f48a2, 0xb37c, 0x4e15,{ 0x8c, 0x29, 0x5a, 0xe0, 0x71, 0xd3, 0x4b, 0x96 } },
+	advconfig_branch::guid_branch_decoding, 19, 0, 0, 3600);
+
+/* recordings are searched by ear, backwards too; a segment at a time is decoded from the checkpoint before it, and played from its end */
+static advconfig_checkbox_factory g_amr_reverse("AMR decoder: play backwards",
+	{ 0xc2e85b17, 0x6f49, 0x4d3a,{ 0x95, 0x0b, 0x7e, 0x14, 0xa3, 0xd6, 0x28, 0xf1 } },
+	advconfig_branch::guid_branch_decoding, 24, false);
+
+/* recordings are triaged by ear, a second of every few heard; the rest is skipped as pauses are, so only the excerpts are decoded */
+static advconfig_integer_factory g_amr_skim("AMR decoder: skim when playing, one second of every this many seconds (2 or more, 0 to play all)",
+	{ 0x7a19e4c3, 0x5db2, 0x4f86,{ 0x8e, 0x27, 0xc1, 0x0f, 0x93, 0x6b, 0xa4, 0x58 } },
+	advconfig_branch::guid_branch_decoding, 25, 0, 0, 3600);
+
+/* recordings are played while the recorder still writes them; playing them to the end waits for what's written next */
+static advconfig_checkbox_factory g_amr_follow("AMR decoder: follow files still being written when playing them to the end",
+	{ 0x93c5e071, 0x4a2d, 0x4b8f,{ 0xa6, 0x1e, 0x37, 0xd9, 0x02, 0xfb, 0x58, 0xc4 } },
+	advconfig_branch::guid_branch_decoding, 20, false);
+
+/* release builds log only if asked to, and only per-file summaries; debug builds always log everything */
+static advconfig_checkbox_factory g_amr_log("AMR decoder: log file summaries to foo_input_amr.txt in temp directory (restart required)",
+	{ 0x6a3d92c4, 0x8f17, 0x4e50,{ 0xb2, 0x0c, 0x7d, 0x45, 0xe9, 0x36, 0x1a, 0xf8 } },
+	advconfig_branch::guid_branch_decoding, 5, false);
+
+/* timings of files played, for telling slow shares from slow machines without a debug build; see input_amr::telemetry() */
+static advconfig_integer_factory g_amr_telemetry("AMR decoder: report timings of files played to the console, 0 not to, 1 per file, 2 per seek too",
+	{ 0x58e2b07d, 0xc41a, 0x4f93,{ 0x86, 0x3b, 0x0e, 0xd7, 0x25, 0x9c, 0xa1, 0x64 } },
+	advconfig_branch::guid_branch_decoding, 27, 0, 0, 2);
+
+/**
+ * Has foobar read info of a file again, on the main thread, as metadb_io_v2 wants it, so what input_amr learnt
+ * of it while playing, see input_amr::finish_replaygain(), gets into the database.
+ *
+ * @since   1.2.0
+ */
+class amr_info_reload : public main_thread_callback {
+public:
+	amr_info_reload(const pfc::string8 & p_path) : m_path(p_path) {}
+
+	void callback_run() {
+		metadb_handle_list items;
+		items.add_item(metadb::get()->handle_create(m_path, 0));
+		metadb_io_v2::get()->load_info_async(items, metadb_io::load_info_force, core_api::get_main_window(), metadb_io_v2::op_flag_background | metadb_io_v2::op_flag_no_errors, NULL);
+	}
+
+private:
+	const pfc::string8 m_path;
 };
 
 /**
  * AMR decoder's plugin class. No inheritance. Foobar uses advanced template magic to
  * call functions. Plugin API was the main change since foobar 0.9.5.5
  *
+ * Instances share no mutable state other than amr_decoder_pool, amr_index_cache, amr_pcm_cache and
+ * amr_pcm_disk_cache, which are all thread-safe, so any number of them can decode at the same time,
+ * each on its own thread, as converter and ReplayGain scanner do. Single instance is used by one
+ * thread at a time.
+ *
  * @author  Andrzej Lichnerowicz
  * @version 1.1.1
  * @since   1.1.0
@@ -74,71 +318,352 @@ enum amr_mode_type {
 class input_amr : public input_stubs {
 protected:
 	/**
-	 * Checks if loaded file is valid AMR audio record. The check is done based on magic string in header.
+	 * Reads header and checks if the file is valid AMR audio record, and how many channels it has.
+	 * Single channel AMR-NB files have just the magic string. Multichannel ones have their own magic
+	 * string, "#!AMR_MC1.0\n", followed by 32-bit channel description, channel count being its lowest
+	 * 4 bits; every frame of them is a block of frames, one per channel, in order. AMR-WB files
+	 * ("#!AMR-WB\n") start with "#!AMR" too, so the whole string is compared, and they're told apart,
+	 * to say why they are not played. Sets m_start and m_channels. Header is read through m_reader, which
+	 * is right after it when it returns, with the first block of the file buffered, see decode_initialize().
+	 *
+	 * Some recorders tag their files. Seekable files are checked for tags at the end first, with a seek
+	 * to the end and a small read by the SDK's tag_processor, and m_reader is made to end where they
+	 * start, see m_data_end; what they hold goes to m_tags. ID3v2 tag ahead of the header, found by its
+	 * first bytes, is skipped with one more small read, and the header is looked for after it; m_start
+	 * counts the tag in.
 	 * 
 	 * @param p_abort		abort callback provided by foobar.
-	 * @return				<code>true</code> if the file looks like AMR
-	 *						<code>false</code> in any other case, including errors
+	 * @throws				exception_io_unsupported_format if the file is not AMR-NB
 	 * @see					m_magic
-	 * @since				1.0.0
+	 * @see					m_magic_mc
+	 * @since				1.2.0
 	 */
-	bool is_amr(abort_callback & p_abort) {
-		/* static buffer to store magic string */
-		static char head[5];
-		
+	void check_magic(abort_callback & p_abort) {
+		/* buffer for the header; on stack, so concurrent opens don't share it */
+		t_uint8 head[amr_mc_header_size];
+
+		m_head_tag = 0;
+		m_data_end = filesize_invalid;
+		m_tags.reset();
+		if (m_file->can_seek()) {
+			try {
+				t_filesize offset;
+				tag_processor::read_trailing_ex(m_file, m_tags, offset, p_abort);
+				m_data_end = offset;
+				SPDLOG_DEBUG(log, "{}: tags at the end from offset {}", m_path.c_str(), offset);
+			} catch (exception_io_data const &) {
+				/* no tags there, or none the SDK knows */
+			}
+			m_reader.seek(0, p_abort);
+		}
+		m_reader.set_end(m_data_end);
+
 		/* read the magic string from the file */
-		int read = m_file->read(head, 5, p_abort);
-		/* seek back to the begining */
-		m_file->seek(0, p_abort);
-		
-		/* if read was successful and head matches amr magic string */
-		return read != 5 || memcmp(head,m_magic,5) ? false : true;
+		t_size read = m_reader.read(head, amr_magic_size, p_abort);
+		if (read == amr_magic_size && memcmp(head, "ID3", 3) == 0 && m_file->can_seek()) {
+			t_filesize skipped = 0;
+			tag_processor::skip_id3v2(m_file, skipped, p_abort);
+			if (skipped > 0) {
+				SPDLOG_DEBUG(log, "{}: ID3v2 tag of {} bytes ahead of the header", m_path.c_str(), skipped);
+				m_head_tag = (unsigned)skipped;
+				m_reader.seek(skipped, p_abort);
+				read = m_reader.read(head, amr_magic_size, p_abort);
+			}
+		}
+		if (read == amr_magic_size && memcmp(head, m_magic, amr_magic_size) == 0) {
+			m_start = m_head_tag + amr_magic_size;
+			m_channels = 1;
+			return;
+		}
+
+		SPDLOG_DEBUG(log, "{}: no AMR-NB magic string", m_path.c_str());
+		if (read == amr_magic_size && memcmp(head, "#!AMR-", amr_magic_size) == 0) throw exception_io_unsupported_format("AMR-WB (wideband) files are not supported");
+		if (read == amr_magic_size && memcmp(head, m_magic_mc, amr_magic_size) == 0) {
+			const t_size rest = m_reader.read(head + amr_magic_size, amr_mc_header_size - amr_magic_size, p_abort);
+			if (rest == amr_mc_header_size - amr_magic_size && memcmp(head, m_magic_mc, amr_mc_magic_size) == 0) {
+				const unsigned channels = head[amr_mc_header_size - 1] & 0x0F;
+				if (channels == 0 || channels > amr_max_channels) throw exception_io_unsupported_format("Unsupported number of channels in multichannel AMR file");
+				m_start = m_head_tag + amr_mc_header_size;
+				m_channels = channels;
+				return;
+			}
+		}
+		throw exception_io_unsupported_format();
 	}
 
 	/**
 	 * Retrives number of audio frames stored in AMR file. Each frame stores 20ms of audio. The total
 	 * number is not stored in the file. Frames start right after magic string. Each frame can be of 
 	 * different length, because each can be encoded at different rate (hence Adaptive Multirate).
-	 * To retrive total number of frames, we must scan through them in a whole file.
+	 * To retrive total number of frames, we must scan through them in a whole file. In multichannel
+	 * files a frame is m_channels frames in a row, each with its own header; those are what the
+	 * histogram counts.
+	 *
+	 * The file is read sequentially in blocks by amr_frame_reader and frame headers are walked in
+	 * memory, so the scan costs one read call per block instead of a read and a seek per frame.
+	 * If m_reader has the whole file loaded, it's scanned in place without any reads.
+	 * A frame truncated by the end of file is not counted, nor are frames of other channels before it.
+	 * Damaged data in single channel files is skipped up to where frames start again, as decoding
+	 * skips it, see amr_frame_reader::set_resync(), so neither count nor index lose sync there.
+	 * Offsets of every amr_index_interval-th frame and frame types are stored in p_index on the way, and
+	 * level estimated from frame parameters and frames hashed, if it's wanted, see amr_loudness and
+	 * amr_frame_index::m_hash. Summary p_index has is kept, file is the same.
+	 * Very large local single channel files, when neither level nor hash is wanted, are walked on
+	 * several threads as far as the regions they walk join up, see amr_parallel_scan.
 	 * 
+	 * @param p_index		receives the index
 	 * @param p_abort		abort callback provided by foobar.
 	 * @return				total nuber of 20ms frames
 	 * @see					m_start
 	 * @see					m_block_size
 	 * @since				1.0.0
 	 */
-	unsigned decode_length(abort_callback & p_abort) {
-		char id;
-		unsigned size, frames = 0;
-		foobar2000_io::t_filesize total_size = m_start, file_size = m_file->get_size(p_abort);
+	unsigned decode_length(amr_frame_index & p_index, abort_callback & p_abort) {
+		AMR_TRACE_ZONE("decode_length");
+		const bool loaded = m_reader.is_loaded();
+		/* loaded file is walked where it is; decode_initialize() seeks m_reader to the first frame anyway */
+		amr_frame_reader scanner;
+		if (!loaded) {
+			scanner.attach(m_file);
+			scanner.set_end(m_data_end);
+		}
+		amr_frame_reader & reader = loaded ? m_reader : scanner;
+		const t_filesize skipped = reader.get_skipped();
+		pfc::array_t<t_uint16> envelope;
+		envelope.move_from(p_index.m_envelope);
+		const t_int32 track_gain = p_index.m_track_gain;
+		const t_uint32 track_peak = p_index.m_track_peak;
+		p_index.reset();
+		p_index.m_envelope.move_from(envelope);
+		p_index.m_track_gain = track_gain;
+		p_index.m_track_peak = track_peak;
+		amr_loudness loudness;
+		if (amr_loudness::is_enabled()) loudness.start(m_channels);
+		if (g_amr_content_hash.get()) p_index.m_hash = amr_hash_start(m_channels);
+
 		/* seek at the begining of the first frame */
-		m_file->seek(m_start, p_abort);
-		/* while we can stil read, go through frames */
-		while (m_file->read(&id, sizeof(char), p_abort)) {
-			const uint8_t ft = (id >> 3) & 0x0F;
-			bool no_data = false;
-			if (ft == 15 || (ft > 8 && ft < 15)) {
-				SPDLOG_TRACE(log, "Found no-data frame, ft: {}. Skipping", ft);
-			}
-			else {
-				SPDLOG_TRACE(log, "Found data frame, ft: {}, frames: {}", ft, frames);
-				/* increase number of frames */
-				++frames;
+		reader.seek(m_start, p_abort);
+		/* channel frames can't be told apart after damaged data, so only single channel files resync */
+		reader.set_resync(m_channels == 1);
+		if (!loaded && is_parallel_scan(loudness, p_index, p_abort)) {
+			amr_parallel_scan scan(m_path, m_block_size);
+			const t_filesize next = scan.run(m_start, data_end(p_abort), [&](const t_uint8 * p_headers, t_size p_count, t_filesize p_offset) {
+				/* index_frame() of single channel frame without level or hash looks at its header only */
+				for (t_size i = 0; i < p_count; ++i) {
+					const t_size size = 1 + m_block_size[(p_headers[i] >> 3) & 0x0F];
+					index_frame(p_index, loudness, p_headers + i, size, p_offset);
+					p_offset += size;
+				}
+			}, p_abort);
+			SPDLOG_DEBUG(log, "{}: walked on several threads up to offset {}", m_path.c_str(), next);
+			reader.seek(next, p_abort);
+		}
+		/* read as long as there is data, and walk all frame headers found */
+		while (index_frames(reader, p_index, loudness, pfc::infinite32, p_abort));
+		loudness.finish(p_index);
+		/* last frame is cut off by the end of file, or lacks some channels; decoder would not get its whole payload */
+		if (reader.get_left() > 0) SPDLOG_DEBUG(log, "Last frame truncated, {} bytes of it found", reader.get_left());
+		if (reader.get_skipped() > skipped) SPDLOG_DEBUG(log, "Damaged data skipped: {} bytes", reader.get_skipped() - skipped);
+		/* go at the begining */
+		if (!loaded) m_file->seek(0,p_abort);
+
+		/* return number of frames found */
+		return p_index.m_frames;
+	}
+
+	/* decode_length() may walk the file with amr_parallel_scan: it's local, big enough, single channel, and only frame headers are needed */
+	bool is_parallel_scan(const amr_loudness & p_loudness, const amr_frame_index & p_index, abort_callback & p_abort) {
+		if (!amr_parallel_scan::is_enabled() || m_channels != 1 || p_loudness.is_active() || p_index.m_hash != 0 || m_file->is_remote()) return false;
+		const t_filesize end = data_end(p_abort);
+		return end != filesize_invalid && end >= m_start + amr_scan_min_size;
+	}
+
+	/**
+	 * Walks frames for decode_length(), or for index_on_idle() a slice at a time, adding them to the index.
+	 * Frames are taken from the reader one at a time only where a block ends or damaged data is skipped;
+	 * whole frames buffered after are walked in bulk by m_scanner.
+	 *
+	 * @param p_reader		reader positioned at the next frame to index
+	 * @param p_index		index of the frames before
+	 * @param p_loudness	estimate of the frames before, if it's active
+	 * @param p_max_frames	frames to walk at most
+	 * @param p_abort		abort callback
+	 * @return				<code>false</code> once the file ended
+	 * @since				1.2.0
+	 */
+	bool index_frames(amr_frame_reader & p_reader, amr_frame_index & p_index, amr_loudness & p_loudness, unsigned p_max_frames, abort_callback & p_abort) {
+		m_scanner.init(m_block_size);
+		unsigned i = 0;
+		while (i < p_max_frames) {
+			t_size size;
+			const t_uint8 * frame = p_reader.next_frames(m_block_size, m_channels, size, p_abort);
+			if (frame == NULL) return false;
+			index_frame(p_index, p_loudness, frame, size, p_reader.get_offset() - size);
+			++i;
+
+			t_size left;
+			const t_uint8 * data = p_reader.get_buffered(left);
+			const t_size bytes = m_scanner.scan(data, left, m_channels, p_max_frames - i, p_reader.get_resync());
+			if (bytes == 0) continue;
+			const unsigned frames = m_scanner.get_frames();
+			if (p_loudness.is_active()) {
+				const t_uint32 * offsets = m_scanner.get_offsets();
+				for (unsigned f = 0; f < frames; ++f) p_loudness.add(data + offsets[f], m_block_size);
 			}
+			/* frames lie one after another, so they're hashed at once */
+			if (p_index.m_hash != 0) p_index.m_hash = amr_hash_add(p_index.m_hash, data, bytes);
+			m_scanner.add_to(p_index, p_reader.get_offset());
+			p_reader.skip_buffered(bytes);
+			i += frames;
+		}
+		return true;
+	}
+
+	/**
+	 * Adds one 20ms frame, that is a frame of each channel, to the index, for index_frames() and index_run().
+	 *
+	 * @param p_index		index of the frames before
+	 * @param p_loudness	estimate of the frames before, if it's active
+	 * @param p_frame		the frame
+	 * @param p_size		bytes of it
+	 * @param p_offset		its file offset
+	 * @since				1.2.0
+	 */
+	void index_frame(amr_frame_index & p_index, amr_loudness & p_loudness, const t_uint8 * p_frame, t_size p_size, t_filesize p_offset) {
+		if (p_index.m_frames % amr_index_interval == 0) p_index.m_offsets.append(p_offset);
+		if (p_loudness.is_active()) p_loudness.add(p_frame, m_block_size);
+		if (p_index.m_hash != 0) p_index.m_hash = amr_hash_add(p_index.m_hash, p_frame, p_size);
+		bool pause = true, bad = false;
+		for (unsigned c = 0; c < m_channels; ++c) {
+			const t_uint8 header = p_frame[0];
+			const unsigned ft = (header >> 3) & 0x0F;
+			/* comfort noise and no data is what DTX sends when nobody speaks */
+			pause = pause && (ft == amr_dtx || ft == amr_no_data);
+			SPDLOG_TRACE(log, "Found frame, ft: {}, frames: {}", ft, p_index.m_frames);
+			++p_index.m_histogram[ft];
+			/* quality bit is clear in frames marked damaged */
+			p_index.m_bad += (header & 0x04) == 0;
+			bad = bad || (header & 0x04) == 0;
+			p_index.add_mode(c, header);
 			/* first byte is rate mode. each rate mode has frame of given length. look it up. */
-			size = m_block_size[ft];
+			p_frame += 1 + m_block_size[ft];
+		}
+		p_index.add_pause_frame(pause);
+		p_index.add_quality_frame(bad);
+		++p_index.m_frames;
+	}
+
+	/* offset frames end at: where tags at the end of file start, or its size; filesize_invalid if that's not known */
+	t_filesize data_end(abort_callback & p_abort) {
+		return m_data_end != filesize_invalid ? m_data_end : m_file->get_size(p_abort);
+	}
+
+	/**
+	 * Estimates number of frames without reading the whole file. Frames in first and last
+	 * amr_estimate_sample_size bytes are walked, and file size divided by their average size.
+	 * Frame boundaries at the end are not known, so the tail is walked from each of its first
+	 * amr_max_frame_size offsets until frames with valid headers lead exactly to the end of file.
+	 * Files of constant mode, which most are, get exact length. Frames of all channels are counted
+	 * alike, so the result is divided by their number.
+	 * 
+	 * @param p_abort		abort callback provided by foobar.
+	 * @return				estimated nuber of 20ms frames, or 0 if file is too small to bother or no frames were found
+	 * @see					decode_length()
+	 * @since				1.2.0
+	 */
+	unsigned estimate_length(abort_callback & p_abort) {
+		const t_filesize size = data_end(p_abort);
+		/* small files are scanned in no time anyway */
+		if (size == filesize_invalid || size < m_start + 4 * amr_estimate_sample_size) return 0;
+		pfc::array_t<t_uint8> block;
+		block.set_size(amr_estimate_sample_size);
+		t_filesize frames = 0, bytes = 0;
 
-			/* FIXME: there is something inherently broken with how I calculate frames here. Need to revise it. */
-			total_size += size + 1;
-			if (total_size > file_size) break;
-			/* we're not interested. just skip this frame, and go to another. */
-			m_file->seek_ex(size, file::seek_from_current, p_abort);
+		/* head: frames start right after magic string; check_magic() has read them already */
+		t_size read;
+		if (m_reader.seek_buffered(m_start)) read = m_reader.read(block.get_ptr(), amr_estimate_sample_size, p_abort);
+		else {
+			m_file->seek(m_start, p_abort);
+			read = m_file->read(block.get_ptr(), amr_estimate_sample_size, p_abort);
 		}
-		/* go at the begining */
-		m_file->seek(0,p_abort);
+		t_size pos = 0;
+		while (pos < read) {
+			const t_size length = 1 + m_block_size[(block[pos] >> 3) & 0x0F];
+			if (pos + length > read) break;
+			pos += length;
+			++frames;
+		}
+		bytes = pos;
 
-		/* return number of frames found */
-		return frames;
+		/* tail: padding bits of storage format header are zero, which rules out most wrong offsets */
+		m_file->seek(size - amr_estimate_sample_size, p_abort);
+		read = m_file->read(block.get_ptr(), amr_estimate_sample_size, p_abort);
+		for (t_size first = 0; first < amr_max_frame_size && first < read; ++first) {
+			t_size tail_frames = 0;
+			pos = first;
+			while (pos < read && amr_frame_reader::is_frame_header(block[pos])) {
+				pos += 1 + m_block_size[(block[pos] >> 3) & 0x0F];
+				++tail_frames;
+			}
+			if (pos == read) {
+				frames += tail_frames;
+				bytes += read - first;
+				break;
+			}
+		}
+		m_file->seek(0, p_abort);
+
+		if (frames == 0) return 0;
+		return (unsigned)pfc::min_t<t_filesize>((size - m_start) * frames / bytes / m_channels, pfc::infinite32);
+	}
+
+	/**
+	 * Indexes file of one mode without walking its frames. Frames in first, middle and last
+	 * amr_estimate_sample_size bytes are checked to have the very same header, the first one's, and
+	 * file size to be a whole number of frames of that size; if so, frame count is the size divided
+	 * by it, and the seek index is worked out from it. Frames in between are taken to be alike, so
+	 * it's done only if preferences trust that, and not if level or hash are wanted, which take every
+	 * frame. Such file has no pause followed by speech, so none is missed. Anything else, as another
+	 * mode, comfort noise or a damaged frame among the ones checked, is left to decode_length().
+	 *
+	 * @param p_index		receives the index
+	 * @param p_abort		abort callback
+	 * @return				<code>true</code> if the file is of one mode and was indexed
+	 * @see					decode_length()
+	 * @since				1.2.0
+	 */
+	bool index_constant(amr_frame_index & p_index, abort_callback & p_abort) {
+		if (!g_amr_constant_length.get() || amr_loudness::is_enabled() || g_amr_content_hash.get()) return false;
+		const t_filesize size = data_end(p_abort);
+		/* small files are scanned in no time anyway */
+		if (size == filesize_invalid || size < m_start + 4 * amr_estimate_sample_size) return false;
+		pfc::array_t<t_uint8> block;
+		block.set_size(amr_estimate_sample_size);
+		m_file->seek(m_start, p_abort);
+		bool constant = m_file->read(block.get_ptr(), 1, p_abort) == 1;
+		const t_uint8 header = block[0];
+		/* damaged frames are counted by walking them */
+		constant = constant && amr_frame_reader::is_frame_header(header) && (header & 0x04) != 0;
+		const unsigned ft = (header >> 3) & 0x0F;
+		const t_size frame_size = 1 + m_block_size[ft];
+		const t_filesize count = (size - m_start) / frame_size;
+		constant = constant && (size - m_start) % ((t_filesize)frame_size * m_channels) == 0 && count / m_channels <= pfc::infinite32;
+		/* channel frames are alike too, so samples need not start at a frame of the first channel */
+		const t_size sample = amr_estimate_sample_size / frame_size;
+		const t_filesize firsts[] = { 0, count / 2, count - sample };
+		for (unsigned i = 0; constant && i < PFC_TABSIZE(firsts); ++i) {
+			m_file->seek(m_start + firsts[i] * frame_size, p_abort);
+			const t_size bytes = sample * frame_size;
+			constant = m_file->read(block.get_ptr(), bytes, p_abort) == bytes;
+			for (t_size pos = 0; constant && pos < bytes; pos += frame_size) constant = block[pos] == header;
+		}
+		m_file->seek(0, p_abort);
+		if (!constant) return false;
+
+		p_index.m_frames = (unsigned)(count / m_channels);
+		p_index.m_histogram[ft] = (unsigned)count;
+		for (t_filesize frame = 0; frame < p_index.m_frames; frame += amr_index_interval) p_index.m_offsets.append(m_start + frame * frame_size * m_channels);
+		return true;
 	}
 
 
@@ -155,6 +680,13 @@ public:
 	/**
 	 * API function called by foobar to open a file. It's called on get info or playback start. It's safest place
 	 * to place total_frame_count extraction code.
+	 *
+	 * Remote and nonseekable files, unless their index is cached, are not scanned, since that would
+	 * mean downloading them whole before first audio. They are streamed: length is unknown at first
+	 * and estimated while decoding, see decode_get_dynamic_info(). Other files which are not cached
+	 * are indexed from their size if they are of one mode, see index_constant(), or get their length
+	 * estimated, see estimate_length(); they are scanned only when decoding needs the seek index,
+	 * see decode_initialize().
 	 * 
 	 * @param p_filehint	file object, may be null untill opened.
 	 * @param p_path		path to file
@@ -163,10 +695,13 @@ public:
 	 * @since				1.0.0
 	 */
 	void open(service_ptr_t<file> p_filehint,const char * p_path,t_input_open_reason p_reason,abort_callback & p_abort) {
+		AMR_TRACE_ZONE("open");
+		AMR_ALLOC_SCOPE("open");
+		pfc::hires_timer open_timer;
+		open_timer.start();
+		ensure_log_exists();
 		SPDLOG_DEBUG(log, "{}: attempt to open a file", p_path);
-		/* write access is called for retagging purposes. we do not support that, so throw an error */
-		if (p_reason == input_open_info_write) throw exception_io_unsupported_format();
-
+		/* write access is called for retagging, see retag_set_info(); file is opened writable then */
 		/* store file object */
 		m_file = p_filehint;
 
@@ -174,147 +709,912 @@ public:
 		input_open_file_helper(m_file,p_path,p_reason,p_abort);
 		SPDLOG_DEBUG(log, "{}: file opened", p_path);
 
-		/* ensure input stream can seek */
-		m_file->ensure_seekable();
-		SPDLOG_DEBUG(log, "{}: file seekable", p_path);
+		m_reader.attach(m_file);
+		m_path = p_path;
+		m_stats = m_file->get_stats(p_abort);
+		/* stream was just opened, so it's at the beginning; header is read with the first block, which decoding starts from */
+		if (m_file->can_seek()) m_file->seek(0, p_abort);
+		check_magic(p_abort);
+		m_streaming = false;
+		m_indexed = false;
+		m_frames = 0;
+		m_checkpoints.reset();
+		m_idle_indexing = false;
+		m_following = false;
+		m_stream_indexing = false;
+		m_features_wanted = false;
+		m_feature_count = 0;
+		m_retag = false;
+
+		/* reuse index of unchanged file scanned before, here or by another computer, or estimate the length, or scan the file and remember the result */
+		m_index = is_cacheable() ? amr_index_cache::get().query(p_path, m_stats) : amr_frame_index_ptr();
+		m_index_source = "none";
+		m_scan_seconds = 0;
+		if (m_index) {
+			SPDLOG_DEBUG(log, "{}: index found in cache", p_path);
+			m_index_source = "cache hit";
+			m_frames = m_index->m_frames;
+			m_indexed = true;
+			/* it was indexed before level or hash was wanted; walking it once more gets that */
+			if (!is_complete(*m_index) && is_indexable()) build_index(p_abort);
+		}
+		/* file a recorder appends to has just what was appended scanned */
+		else if (is_indexable() && extend_index(p_abort)) {
+			SPDLOG_DEBUG(log, "{}: index of the file before it grew found in cache, extended", p_path);
+		}
+		/* remote file is not scanned, as that downloads all of it; index made elsewhere has seek fetch just the block around the target */
+		else if (!is_indexable() && m_file->can_seek() && read_sidecar(p_abort)) {
+			SPDLOG_DEBUG(log, "{}: index of remote file found in sidecar", p_path);
+			m_index_source = "sidecar";
+		}
+		else if (!is_indexable()) {
+			SPDLOG_DEBUG(log, "{}: streaming", p_path);
+			m_index_source = "none, streamed";
+			m_index = std::make_shared<amr_frame_index>();
+			m_frames = estimate_stream_length(p_abort);
+		}
+		else if (read_sidecar(p_abort)) {
+			SPDLOG_DEBUG(log, "{}: index found in sidecar", p_path);
+			m_index_source = "sidecar";
+		}
+		/* exact, and as fast as estimating the length */
+		else if (adopt_constant_index(p_abort)) {
+			SPDLOG_DEBUG(log, "{}: one mode throughout, indexed from its size", p_path);
+			m_index_source = "one mode, from size";
+		}
+		/* pauses are found only by walking all frames; excerpts skimmed are placed by exact frame count */
+		else if ((p_reason == input_open_decode || g_amr_estimate_length.get()) && g_amr_split_pause.get() == 0 && g_amr_skip_pause.get() == 0 && g_amr_skim.get() == 0 && (m_frames = estimate_length(p_abort)) > 0) {
+			SPDLOG_DEBUG(log, "{}: length estimated", p_path);
+			m_index_source = "none, length estimated";
+			m_index = std::make_shared<amr_frame_index>();
+		}
+		else {
+			build_index(p_abort);
+		}
+
+		split_tracks();
+		find_skips();
+		/* files that can't be indexed were not read but for the header, so the block read with it is where the file is at */
+		m_prefetched = !is_indexable();
+		SPDLOG_DEBUG(log, "{}: frames count={}, tracks={}", p_path, m_frames, m_tracks.get_size());
+		m_open_seconds = open_timer.query();
+	}
+
+	/**
+	 * Opens the file for info, and scans it if that did not get the index, so it's cached, see amr_preindex_file().
+	 * Info of its tracks is then read as foobar would read it, while the file is open.
+	 *
+	 * @param p_path		path to file
+	 * @param p_abort		abort callback
+	 * @param p_info		receives info of the file, if it's indexed, unless <code>NULL</code>
+	 * @return				<code>true</code> if the file is indexed
+	 * @since				1.2.0
+	 */
+	bool preindex(const char * p_path, abort_callback & p_abort, amr_preindex_info * p_info = NULL) {
+		open(NULL, p_path, input_open_info_read, p_abort);
+		if (!m_indexed && is_indexable()) build_index(p_abort);
+		if (m_indexed && p_info != NULL) {
+			p_info->m_path = p_path;
+			p_info->m_tracks.set_size(get_subsong_count());
+			for (unsigned i = 0; i < get_subsong_count(); ++i) get_info(get_subsong(i), p_info->m_tracks[i], p_abort);
+			p_info->m_stats = get_file_stats(p_abort);
+		}
+		return m_indexed;
+	}
+
+	/**
+	 * Opens the file for info, indexing it if it's not yet, and finds where frames of a track lie in it,
+	 * see amr_find_frames().
+	 *
+	 * @param p_path		path to file
+	 * @param p_subsong		track, see split_tracks()
+	 * @param p_out			receives where the track lies
+	 * @param p_abort		abort callback
+	 * @throws				exception_io_object_not_seekable if the file can't be indexed, exception_io_bad_subsong_index if there is no such track
+	 * @since				1.2.0
+	 */
+	void find_frames(const char * p_path, t_uint32 p_subsong, amr_frame_range & p_out, abort_callback & p_abort) {
+		if (!preindex(p_path, p_abort) || !m_file->can_seek()) throw exception_io_object_not_seekable();
+		if (p_subsong >= m_tracks.get_size()) throw exception_io_bad_subsong_index();
+		const unsigned first = m_tracks[p_subsong];
+		const unsigned end = p_subsong + 1 < m_tracks.get_size() ? m_tracks[p_subsong + 1] : m_frames;
+		/* tag ahead of the header is left out */
+		p_out.m_header.set_size(m_start - m_head_tag);
+		m_reader.seek(m_head_tag, p_abort);
+		if (m_reader.read(p_out.m_header.get_ptr(), m_start - m_head_tag, p_abort) != m_start - m_head_tag) throw exception_io_data_truncation();
+		/* damaged data is walked past as decoding walks past it */
+		m_reader.set_resync(m_channels == 1);
+		p_out.m_begin = frame_offset(first, p_abort);
+		p_out.m_end = frame_offset(end, p_abort);
+		p_out.m_frames = end - first;
+		p_out.m_tracks = (unsigned)m_tracks.get_size();
+	}
 
-		/* store total frames count of amr file */
-		m_frames = decode_length(p_abort);
-		SPDLOG_DEBUG(log, "{}: frames count={}", p_path, m_frames);
+	/**
+	 * Opens the file for info, indexing it if it's not yet, and takes runs of speech from pauses of its
+	 * index, see amr_find_activity().
+	 *
+	 * @param p_path		path to file
+	 * @param p_out			receives runs of speech
+	 * @param p_abort		abort callback
+	 * @throws				exception_io_object_not_seekable if the file can't be indexed
+	 * @since				1.2.0
+	 */
+	void find_activity(const char * p_path, pfc::list_t<amr_activity_segment> & p_out, abort_callback & p_abort) {
+		if (!preindex(p_path, p_abort)) throw exception_io_object_not_seekable();
+		p_out.remove_all();
+		const pfc::array_t<t_uint32> & pauses = m_index->m_pauses;
+		amr_activity_segment segment;
+		segment.m_begin = 0;
+		for (t_size i = 0; i < pauses.get_size(); i += 2) {
+			segment.m_end = pauses[i];
+			if (segment.m_end > segment.m_begin) p_out.add_item(segment);
+			segment.m_begin = pauses[i] + pauses[i + 1];
+		}
+		segment.m_end = m_frames;
+		if (segment.m_end > segment.m_begin) p_out.add_item(segment);
+	}
+
+	/**
+	 * Opens the file for info, indexing it if it's not yet, and takes its statistics from the index,
+	 * see amr_find_stats(). Bitrate is the average of get_info().
+	 *
+	 * @param p_path		path to file
+	 * @param p_out			receives the statistics
+	 * @param p_abort		abort callback
+	 * @throws				exception_io_object_not_seekable if the file can't be indexed
+	 * @since				1.2.0
+	 */
+	void find_stats(const char * p_path, amr_file_stats & p_out, abort_callback & p_abort) {
+		if (!preindex(p_path, p_abort)) throw exception_io_object_not_seekable();
+		p_out.m_channels = m_channels;
+		p_out.m_frames = m_frames;
+		t_filesize bytes = 0;
+		for (unsigned i = 0; i < amr_frame_types; ++i) {
+			p_out.m_histogram[i] = m_index->m_histogram[i];
+			bytes += (t_filesize)m_index->m_histogram[i] * (1 + m_block_size[i]);
+		}
+		const double length = (double)m_frames * amr_audio_frame_size / amr_sample_rate;
+		p_out.m_bitrate = length > 0 ? (unsigned)(bytes * 8 / length + 0.5) : 0;
+		p_out.m_bad = m_index->m_bad;
+		unsigned paused = 0;
+		for (t_size i = 1; i < m_index->m_pauses.get_size(); i += 2) paused += m_index->m_pauses[i];
+		p_out.m_speech = m_frames - paused;
+		p_out.m_hash = m_index->m_hash;
 	}
 
+	/* file is one track, unless it's split at pauses, see split_tracks() */
+	unsigned get_subsong_count() { return (unsigned)m_tracks.get_size(); }
+	t_uint32 get_subsong(unsigned p_index) { return p_index; }
+
 
 	/**
 	 * API function called by foobar to get information of properties dialog. AMR is easy, 
-	 * since most of the info is pretty constant.
+	 * since most of the info is pretty constant. Bitrate is not: it depends on modes of the frames,
+	 * so it's the average from the index, or from file size if length is only estimated. Indexed
+	 * files also get share of each frame type and number of damaged frames, and estimated level and
+	 * share of silent frames, if level was estimated when indexing, and hash of frames, if they were
+	 * hashed; files with the same hash are duplicates. Tracks of a file split at pauses have their own
+	 * length and number; the rest is of the whole file. Length leaves out pauses skipped when playing,
+	 * see find_skips(). Metadata comes from tags at the end of file, see check_magic(); so does ReplayGain,
+	 * or it's the one measured when the file was played through, if tags have none, see finish_replaygain().
 	 * 
+	 * @param p_subsong		track, see split_tracks()
 	 * @param p_info		object to store the info in
 	 * @param p_abort		abort callback
+	 * @throws				exception_io_bad_subsong_index if there is no such track
 	 * @since				1.1.0
 	 */
-	void get_info(file_info & p_info,abort_callback & p_abort) {
-		SPDLOG_DEBUG(log, "Get info");
+	void get_info(t_uint32 p_subsong,file_info & p_info,abort_callback & p_abort) {
+		SPDLOG_DEBUG(log, "Get info {}", p_subsong);
+		if (p_subsong >= m_tracks.get_size()) throw exception_io_bad_subsong_index();
+
+		/* file opened for decoding has estimated length until decoded; it won't do if estimates are not wanted */
+		if (!m_indexed && !g_amr_estimate_length.get() && is_indexable()) build_index(p_abort);
+
+		const unsigned first = m_tracks[p_subsong];
+		const unsigned end = p_subsong + 1 < m_tracks.get_size() ? m_tracks[p_subsong + 1] : m_frames;
+		p_info.set_length((double)(end - first - skipped_frames(first, end))*amr_audio_frame_size/amr_sample_rate);
+		p_info.copy_meta(m_tags);
+		replaygain_info gain = m_tags.get_replaygain();
+		/* gain measured as the file was played goes where tags have none */
+		if (!gain.is_track_gain_present() && m_index && m_index->m_track_gain != amr_gain_none) {
+			gain.m_track_gain = m_index->m_track_gain / 100.0f;
+			gain.m_track_peak = m_index->m_track_peak / 65536.0f;
+		}
+		p_info.set_replaygain(gain);
+		if (m_tracks.get_size() > 1) {
+			p_info.meta_set("tracknumber", pfc::format_uint(p_subsong + 1));
+			p_info.meta_set("totaltracks", pfc::format_uint(m_tracks.get_size()));
+		}
+
+		const double length = (double)m_frames*amr_audio_frame_size/amr_sample_rate;
 
-		p_info.set_length((double)m_frames*amr_audio_frame_size/amr_sample_rate);
-		p_info.info_set_bitrate((amr_bits_per_sample * amr_channels * amr_sample_rate + 500 /* rounding for bps to kbps*/ ) / 1000 /* bps to kbps */);
-		p_info.info_set_int("samplerate",amr_sample_rate);
-		p_info.info_set_int("channels",amr_channels);
+		t_filesize bytes = 0;
+		if (m_indexed) {
+			for (unsigned i = 0; i < amr_frame_types; ++i) bytes += (t_filesize)m_index->m_histogram[i] * (1 + m_block_size[i]);
+		}
+		else {
+			const t_filesize size = data_end(p_abort);
+			if (size != filesize_invalid && size > m_start) bytes = size - m_start;
+		}
+		if (length > 0 && bytes > 0) p_info.info_set_bitrate((t_int64)(bytes * 8 / length + 500 /* rounding for bps to kbps*/ ) / 1000 /* bps to kbps */);
+		if (m_indexed && m_frames > 0) {
+			static const char * const names[amr_frame_types] = { "MR475", "MR515", "MR59", "MR67", "MR74", "MR795", "MR102", "MR122", "SID", "reserved", "reserved", "reserved", "reserved", "reserved", "reserved", "NO_DATA" };
+			pfc::string_formatter modes;
+			for (unsigned i = 0; i < amr_frame_types; ++i) {
+				if (m_index->m_histogram[i] == 0) continue;
+				if (!modes.is_empty()) modes << ", ";
+				modes << names[i] << " " << pfc::format_float(100.0 * m_index->m_histogram[i] / m_frames / m_channels, 0, 1) << "%";
+			}
+			p_info.info_set("amr_modes", modes);
+			p_info.info_set_int("amr_bad_frames", m_index->m_bad);
+			add_quality_info(p_info);
+			if (m_index->m_level_frames > 0) {
+				pfc::string_formatter level;
+				if (m_index->m_level == amr_level_silent) level << "silent";
+				else level << pfc::format_float(m_index->m_level / 100.0, 0, 1) << " dB";
+				p_info.info_set("amr_level", level);
+				p_info.info_set("amr_silence", pfc::string_formatter() << pfc::format_float(100.0 * m_index->m_silent / m_index->m_level_frames, 0, 1) << "%");
+			}
+			if (m_index->m_hash != 0) p_info.info_set("amr_content_hash", pfc::format_hex(m_index->m_hash, 16));
+		}
+		/* decoded audio may be upsampled, see amr_upsampler */
+		const unsigned rate = amr_upsampler::get_preferred_rate();
+		p_info.info_set_int("samplerate", rate != 0 ? rate : amr_sample_rate);
+		p_info.info_set_int("channels",m_channels);
 		p_info.info_set_int("bitspersample",amr_bits_per_sample);
 		p_info.info_set("encoding","Adaptive Multirate");		
 	}
 
+	/**
+	 * Reception quality the index learnt from quality bits and frame types, for get_info(): share of
+	 * damaged frames, longest loss, switches of speech mode, and losses of each minute that has any,
+	 * as "minute: share" from minute 0. Files indexed from their size, see index_constant(), have none.
+	 *
+	 * @param p_info		receives the fields
+	 * @since				1.2.0
+	 */
+	void add_quality_info(file_info & p_info) const {
+		p_info.info_set("amr_bad_ratio", pfc::string_formatter() << pfc::format_float(100.0 * m_index->m_bad / m_frames / m_channels, 0, 2) << "%");
+		p_info.info_set("amr_longest_loss", pfc::string_formatter() << (t_uint64)m_index->m_bad_burst * amr_frame_sample_length << " ms");
+		p_info.info_set_int("amr_mode_switches", m_index->m_mode_switches);
+		const pfc::array_t<t_uint32> & minutes = m_index->m_bad_minutes;
+		if (minutes.get_size() == 0) return;
+		pfc::string_formatter losses;
+		for (t_size i = 0; i < minutes.get_size(); i += 2) {
+			/* last minute may be short */
+			const unsigned frames = pfc::min_t<unsigned>(m_frames - minutes[i] * amr_index_minute_frames, amr_index_minute_frames);
+			if (i > 0) losses << ", ";
+			losses << minutes[i] << ": " << pfc::format_float(100.0 * minutes[i + 1] / frames, 0, 1) << "%";
+		}
+		p_info.info_set("amr_loss_by_minute", losses);
+	}
+
 	/**
 	 * API function called by foobar to initialize decoder. We relay that init to start 3gpp's AMR decoder
-	 * and reset internal counters.
+	 * and reset internal counters. Seek index is built here if it was not yet, unless caller said it
+	 * won't seek, as converter and ReplayGain scanner do, or that seeking may be inaccurate; file is
+	 * then just decoded until it ends, or seeks go to guessed offsets, see seek_estimated(). Playing
+	 * file that's not in memory doesn't wait for the index either; it's built in idle time, see index_on_idle().
+	 * Files that can't be scanned, as ones in archives, are indexed as they're decoded, see start_stream_index().
+	 * Track of a file split at pauses other than the first is seeked to right away, see decode_seek().
 	 * 
-	 * @param p_flags		unused
+	 * @param p_subsong		track, see split_tracks()
+	 * @param p_flags		decode flags; input_flag_no_seeking and input_flag_allow_inaccurate_seeking skip
+	 *						the index, long files not decoded for playback may be decoded on several threads, and
+	 *						input_flag_testing_integrity checks frames without decoding them, see verify_run()
 	 * @param p_abort		abort callback
+	 * @throws				exception_io_bad_subsong_index if there is no such track
 	 * @since				1.0.0
 	 */
-	void decode_initialize(unsigned p_flags,abort_callback & p_abort) {
-		SPDLOG_DEBUG(log, "Initialize decoder: {}", p_flags);
+	void decode_initialize(t_uint32 p_subsong,unsigned p_flags,abort_callback & p_abort) {
+		AMR_TRACE_ZONE("decode_initialize");
+		AMR_ALLOC_SCOPE("decode_initialize");
+		SPDLOG_DEBUG(log, "Initialize decoder: {}, track {}", p_flags, p_subsong);
+		if (p_subsong >= m_tracks.get_size()) throw exception_io_bad_subsong_index();
+		start_telemetry();
+		m_decoding.hold();
+		m_track_first = m_tracks[p_subsong];
+		m_track_end = p_subsong + 1 < m_tracks.get_size() ? m_tracks[p_subsong + 1] : pfc::infinite32;
+		/* file is read here from now on */
+		m_ahead.reset();
+		stop_indexing();
+		/* file that's still being written is read as it grows, rather than loaded as it is, see follow() */
+		const bool follow = (p_flags & input_flag_playback) && g_amr_follow.get() && m_tracks.get_size() == 1 && is_indexable();
+		/* playing backwards starts at the end, so it needs the index right away */
+		const bool reverse = (p_flags & input_flag_playback) && !(p_flags & input_flag_no_seeking) && g_amr_reverse.get() && !follow && is_indexable();
+
+		/**
+		 * stream decoded for the first time starts from the block open() read with the header, rather than
+		 * asks for the file again, which takes a round trip to a remote one. small local files are decoded
+		 * from memory. otherwise reopen, which is equivalent to seek to zero, except it also works on nonseekable streams
+		 */
+		const bool prefetched = m_prefetched && m_reader.seek_buffered(m_start);
+		m_prefetched = false;
+		if (!prefetched && (follow || !m_reader.load(p_abort))) m_file->reopen(p_abort);
+		/**
+		 * decode through unindexed files if there won't be any exact seeking; files that can't be indexed have to be.
+		 * inaccurate seeking can't tell which channel a frame is of, so multichannel files need the index for any seeking
+		 */
+		const unsigned no_index = m_channels == 1 ? input_flag_no_seeking | input_flag_allow_inaccurate_seeking : input_flag_no_seeking;
+		if (!m_indexed && is_indexable()) {
+			/* reading the whole file first would hold playback back; file in memory is indexed in no time */
+			if ((p_flags & input_flag_playback) && !(p_flags & input_flag_no_seeking) && !m_reader.is_loaded() && !follow && !reverse && g_amr_idle_index.get()) start_indexing(p_abort);
+			else if (!(p_flags & no_index)) build_index(p_abort);
+		}
+		m_streaming = !m_indexed;
+		m_inaccurate_seek = (p_flags & input_flag_allow_inaccurate_seeking) != 0;
+		m_playback = (p_flags & input_flag_playback) != 0;
+		m_following = follow && m_indexed;
+		/* length reported leaves out pauses skipped when playing forwards, so files with any are played forwards still */
+		m_reverse = reverse && m_indexed && m_skips.get_size() == 0;
+		m_reverse_left = 0;
+		if (m_following) start_following(p_abort);
+		/* frame structure is checked through the whole file, so tracks of a split one are decoded instead */
+		m_verify = (p_flags & input_flag_testing_integrity) != 0 && g_amr_fast_verify.get() && m_tracks.get_size() == 1;
+		m_verify_offset = m_start;
+		m_verify_count = 0;
+		m_verify_report.reset();
+		/* converting and scanning are bound by disk as much as by decoding, so blocks are read while frames are decoded */
+		m_reader.set_read_ahead(!m_playback && !m_streaming);
+		/* damaged data is skipped as decode_length() skipped it; verifying reports it instead */
+		m_reader.set_resync(m_channels == 1 && !m_verify);
+		m_upsampler.setup(amr_upsampler::get_preferred_rate(), m_channels);
+		/* faster playback is for listening; converting and scanning get audio as it is, and pitch lags are no use backwards */
+		m_time_scaler.setup(m_playback && !m_reverse ? amr_time_scaler::get_preferred_speed() : 100, m_channels,
+			m_upsampler.is_active() ? m_upsampler.get_frame_samples() : amr_audio_frame_size);
 
-		/* equivalent to seek to zero, except it also works on nonseekable streams */
-		m_file->reopen(p_abort);
+		/* get 3gpp's amr decoder for each channel in initial state, reusing ones if possible; next segment of a recording carries on with the decoders of the one before */
+		m_float_engine = m_playback && g_amr_float_engine.get();
+		/* scanning and converting get audio as it is, ReplayGain scanner measuring it especially */
+		m_gain = m_playback ? normalize_gain() : 1.0f;
+		m_raw = NULL;
+		m_raw_mode = false;
+		m_continued = m_playback && !m_reverse && m_track_first == 0 && amr_segment_handoff::is_enabled() && amr_segment_handoff::get().take(m_path, m_decoders, m_channels, m_float_engine);
+		if (m_continued) {
+			SPDLOG_DEBUG(log, "{}: decoders carried over from the segment before", m_path.c_str());
+			for (unsigned i = 0; i < m_channels; ++i) Decoder_Interface_set_gain(m_decoders[i].get(), m_gain);
+		}
+		else for (unsigned i = 0; i < m_channels; ++i) m_decoders[i].acquire(m_float_engine, m_gain);
+		/* seek to the first frame; stream may not seek, so its magic string is read past, and checked */
+		if (prefetched) SPDLOG_DEBUG(log, "{}: decoding from the block read on open", m_path.c_str());
+		else if (m_file->can_seek() || m_reader.is_loaded()) m_reader.seek(m_start, p_abort);
+		else {
+			m_reader.attach(m_file);
+			check_magic(p_abort);
+		}
+		m_stream_end = false;
+		m_stream_bytes = 0;
+		m_stream_frames = 0;
+		m_reported_frames = m_frames;
 
-		/* initialize 3gpp's amr decoder */
-		m_state = reinterpret_cast<int*>(Decoder_Interface_init());
-		/* seek to the first frame */
-		m_file->seek(m_start, p_abort);
+		m_chunk_frames = m_playback && g_amr_burst.get() ? amr_burst_chunk_frames : amr_get_tuned_chunk_frames();
+		m_lags.set_size(m_chunk_frames);
+		m_features.set_size(m_chunk_frames);
+		m_feature_power.set_size(m_chunk_frames * DEC_SUBFRAMES);
+		m_feature_count = 0;
+		if (g_amr_presize.get()) presize_buffers();
+		/* we start at first frame, or past the last one when playing backwards */
+		m_frame = m_reverse ? end_frame() : 0;
+		m_skip = next_skip();
+		m_fade_frames = 0;
+		m_exact = true;
+		m_bitrate.reset();
+#ifdef DEC_ALLOC_TRACK
+		m_alloc_runs = 0;
+#endif
+		/* summary is made once, rather than each time file is decoded */
+		m_envelope.reset();
+		m_envelope_frame = g_amr_envelope.get() && !m_verify && !m_reverse && !is_skipping() && !m_following && m_tracks.get_size() == 1 && m_index->m_envelope.get_size() == 0 ? 0 : pfc::infinite32;
+		/* so is ReplayGain, of audio as it is, when it's played and tags have none */
+		m_replaygain.reset();
+		m_replaygain_frame = g_amr_replaygain.get() && m_playback && m_gain == 1.0f && !m_verify && !m_reverse && !is_skipping() && !m_following && !m_streaming
+			&& m_tracks.get_size() == 1 && m_index->m_track_gain == amr_gain_none && !m_tags.get_replaygain().is_track_gain_present() ? 0 : pfc::infinite32;
+#ifdef DEC_PROFILE
+		/* count from here on */
+		struct Dec_profile dropped;
+		for (unsigned i = 0; i < m_channels; ++i) Decoder_Interface_profile(m_decoders[i].get(), &dropped);
+		m_io_cycles = 0;
+#endif
 
-		/* reserve buffer for decoded audio */
-		m_data.set_size(amr_audio_frame_size);
-		/* we start at first frame */
-		m_frame = 0;
+		/* playback needs no more than real time; converting and scanning gain from decoding ahead, single channel files that is */
+		m_parallel.reset();
+		if (amr_parallel_decoder::is_enabled() && !(p_flags & input_flag_playback) && !m_verify && m_channels == 1 && m_track_first == 0 && end_frame() >= amr_parallel_min_frames) {
+			m_parallel.start(m_reader, m_decoders[0], m_block_size, m_streaming ? pfc::infinite32 : end_frame());
+			/* frames decoded ahead get no checkpoints, so the ones after them can't be taken either */
+			m_exact = false;
+		}
+		/* faster paths are checked against the reference decoder as they go, if asked to; there are frames to check in what's decoded here */
+		if (amr_shadow_check::is_enabled() && !m_verify && m_channels == 1) m_shadow.start(m_path, m_float_engine, m_gain);
+		else m_shadow.reset();
+		start_stream_index();
+		/* audio of a file played often comes from disk; file played often enough has it written there as it's decoded */
+		m_disk.reset();
+		m_disk_writer.reset();
+		if (is_pcm_replaying() && m_tracks.get_size() == 1 && amr_pcm_disk_cache::is_enabled()) m_disk = amr_pcm_disk_cache::get().play(m_path, m_stats, m_channels, end_frame(), m_disk_writer);
+		/* audio decoded before is replayed from the cache as long as it's there; decoders are at the first frame meanwhile */
+		m_pcm_serving = is_pcm_caching() || m_disk;
+		m_pcm_behind = false;
+		if (m_track_first > 0) decode_seek(0, p_abort);
+		else start_ahead();
 	}
 
 	/**
-	 * API function called by foobar to get next chunk of audio. 
+	 * API function called by foobar to get next chunk of audio. Up to m_chunk_frames frames are decoded
+	 * straight into the chunk's own buffer as floating point samples, so there's neither intermediate
+	 * 16-bit buffer nor conversion pass over it. Streams are decoded until they end, whatever
+	 * their estimated length is. Multichannel files are decoded a frame at a time, each channel with
+	 * its own decoder, and channels interleaved, see decode_channels(). Indexed files decoded from the
+	 * first frame get a checkpoint every amr_checkpoint_interval frames, see save_checkpoint(). When
+	 * frames are read and decoded ahead on another thread, see start_ahead(), a chunk is one block of them.
+	 * If output is to be upsampled, frames are decoded to m_upsample_scratch instead, and upsampled from
+	 * there into the chunk, see amr_upsampler. When playing, audio still in amr_pcm_cache is copied from
+	 * there rather than decoded, see serve_cached(), and audio decoded exactly is put there. The chunk's
+	 * buffer, and the ones audio goes through here, are only grown, so once the largest chunk went by no
+	 * chunk allocates, see presize_buffers(). Pauses skipped
+	 * when playing are jumped over, see find_skips(). Track played backwards goes through reverse_run().
 	 * 
 	 * @param p_chunk		buffer in which we store decoded audio
 	 * @param p_abort		abort callback
 	 * @see					m_block_size
+	 * @see					m_chunk_frames
 	 * @since				1.1.0
 	 */
 	bool decode_run(audio_chunk & p_chunk,abort_callback & p_abort) {
-		/* return false if we've reached total frames count */
-		if(m_frame>=m_frames) return 0;
-		
-		/* read mode type */
-		m_file->read(m_buffer, sizeof(char), p_abort);
-		/* get frame size for this frame's amr mode */
-		unsigned read_size = m_block_size[(m_buffer[0]>>3)&0x000F];
-
-		/* read the buffer */
-		m_file->read(&m_buffer[1], sizeof(char)*read_size, p_abort);
-		/* decode next portion of audio */
-		Decoder_Interface_Decode(m_state, m_buffer, m_data.get_ptr(), 0);
+		AMR_TRACE_ZONE("decode_run");
+		AMR_ALLOC_SCOPE_STEADY("decode_run", ++m_alloc_runs > amr_alloc_warmup_runs);
+		pfc::hires_timer timer;
+		timer.start();
+		const bool more = decode_chunk(p_chunk, p_abort);
+		const double seconds = timer.query();
+		const double audio = more ? p_chunk.get_duration() : 0;
+		amr_count(amr_counter_frames, (t_int64)(audio * 1000 / amr_frame_sample_length + 0.5));
+		amr_count(amr_counter_decode_us, (t_int64)(seconds * 1000000));
+		if (!more) m_decoding.release();
+		if (m_telemetry != 0) telemetry_chunk(seconds, audio, more);
+		return more;
+	}
+
+	/**
+	 * Sizes buffers output goes through for chunks of m_chunk_frames frames, and the segment played
+	 * backwards, up front. They only ever grow, and keep what they grew to for the next chunk, so
+	 * this just saves the first chunks growing them.
+	 */
+	void presize_buffers() {
+		const t_size samples = amr_audio_frame_size * m_channels;
+		if (m_upsampler.is_active()) {
+			m_upsample_scratch.prealloc(m_chunk_frames * samples);
+			m_upsampler.reserve(m_chunk_frames);
+		}
+		if (m_time_scaler.is_active()) m_time_scaler.reserve(m_chunk_frames);
+		if (m_reverse) m_reverse_pcm.prealloc(amr_checkpoint_interval * samples);
+	}
+
+	/* decodes the next chunk for decode_run() */
+	bool decode_chunk(audio_chunk & p_chunk, abort_callback & p_abort) {
+		if (m_verify) return verify_run(p_chunk, p_abort);
+		if (m_reverse) return reverse_run(p_chunk, p_abort);
+		/* return false if we've reached total frames count, unless the file is followed and grows */
+		if ((m_streaming ? m_stream_end : m_frame >= end_frame()) && !(m_following && follow(p_abort))) {
+			/* thread decoding ahead is done, but may not have ended yet */
+			m_ahead.reset();
+			finish_envelope();
+			finish_replaygain();
+			leave_decoders();
+#ifdef DEC_PROFILE
+			print_profile();
+#endif
+			return 0;
+		}
+
+		/* parameters of frames are taken as they're decoded here, so audio from elsewhere is dropped once they're wanted */
+		if (m_features_wanted) decode_here(p_abort);
+
+		const unsigned first = m_frame;
+		/* make room for the whole chunk; decoder writes into it directly, unless it's upsampled from 8 kHz after */
+		audio_sample * out;
+		if (m_upsampler.is_active()) {
+			m_upsample_scratch.set_size(m_chunk_frames * amr_audio_frame_size * m_channels);
+			out = m_upsample_scratch.get_ptr();
+		}
+		else {
+			p_chunk.grow_data_size(m_chunk_frames * amr_audio_frame_size * m_channels);
+			out = p_chunk.get_data();
+		}
+
+		/* cached audio comes first; once it runs out, decoders are brought to where it ended */
+		unsigned decoded = m_pcm_serving ? serve_cached(out, p_abort) : 0;
+		const unsigned cached = decoded;
+		/* frames decoded ahead come next; once they run out, decoding goes on right here */
+		if (m_parallel.is_active()) {
+			decoded = m_parallel.run(out, m_streaming ? m_chunk_frames : pfc::min_t(m_chunk_frames, end_frame() - m_frame), p_abort);
+			m_frame += decoded;
+		}
+		if (m_ahead.is_active() && decoded == 0) {
+			const amr_decode_ahead::block * block = m_ahead.front(p_abort);
+			if (block == NULL) {
+				/* file turned out to be shorter than expected */
+				m_ahead.reset();
+				m_frame = end_frame();
+			}
+			else {
+				decoded = block->m_frames;
+				memcpy(out, block->m_samples.get_ptr(), decoded * amr_audio_frame_size * sizeof(audio_sample));
+				m_stream_bytes += block->m_bytes;
+				m_stream_frames += decoded;
+				m_bitrate.on_frame((double)decoded * amr_audio_frame_size / amr_sample_rate, block->m_bytes * 8);
+				m_frame += decoded;
+				for (unsigned i = 0; i < block->m_checkpoints; ++i) save_checkpoint(block->m_snapshot.get_ptr() + i * Decoder_Interface_snapshot_size());
+				m_ahead.pop();
+			}
+		}
+		/* frames handed out raw go one to a chunk */
+		const unsigned chunk_frames = m_raw != NULL ? 1 : m_chunk_frames;
+		const unsigned decoded_elsewhere = decoded;
+		while (!m_ahead.is_active() && decoded < chunk_frames && (m_streaming || m_frame < end_frame())) {
+			/* skipped part of a pause is never decoded; decoders are warmed up before its end, as after seek */
+			if (m_skip < m_skips.get_size() && m_frame >= m_skips[m_skip]) {
+				const unsigned target = m_skips[m_skip] + m_skips[m_skip + 1];
+				m_skip += 2;
+				if (target >= end_frame()) {
+					m_frame = end_frame();
+					break;
+				}
+				decode_fade(p_abort);
+				seek_frames(target, p_abort, false);
+				continue;
+			}
+			/* get next frames from read-ahead buffer; stop if the file turns out to be shorter than expected */
+			unsigned wanted = m_time_scaler.is_active() || m_features_wanted ? 1 : chunk_frames - decoded;
+			/* run ends where the next checkpoint is to be taken, and where a pause is skipped */
+			if (is_checkpointing()) wanted = pfc::min_t(wanted, (m_checkpoints.get_count() + 1) * amr_checkpoint_interval - m_frame);
+			if (m_skip < m_skips.get_size()) wanted = pfc::min_t(wanted, m_skips[m_skip] - m_frame);
+			unsigned frames = 1;
+			t_size size;
+#ifdef DEC_PROFILE
+			const t_uint64 io_start = Decoder_Interface_cycles();
+#endif
+			const t_uint8 * run = m_channels == 1
+				? m_reader.next_run(m_block_size, m_streaming ? wanted : pfc::min_t(wanted, end_frame() - m_frame), frames, size, p_abort)
+				: m_reader.next_frames(m_block_size, m_channels, size, p_abort);
+#ifdef DEC_PROFILE
+			m_io_cycles += Decoder_Interface_cycles() - io_start;
+#endif
+			if (run == NULL) {
+				if (m_streaming) {
+					m_stream_end = true;
+					AMR_LOG_SUMMARY(log, "{}: streamed to the end, {} frames", m_path.c_str(), m_frame);
+					if (m_stream_indexing) adopt_stream_index();
+				}
+				else m_frame = end_frame();
+				break;
+			}
+			m_stream_bytes += size;
+			m_stream_frames += frames;
+			if (m_stream_indexing) index_run(run, size, frames);
+			m_bitrate.on_frame((double)frames * amr_audio_frame_size / amr_sample_rate, size * 8);
+			if (m_raw != NULL) m_raw->set(run, size);
+			/* decode next portion of audio; storage format unpacking only reads the frames, so they're decoded in place */
+			if (m_channels == 1) {
+				const bool shadow = m_shadow.pick(m_decoders[0].get(), frames);
+				Decoder_Interface_DecodeN_float(m_decoders[0].get(), const_cast<t_uint8*>(run), (int)size, out + decoded * amr_audio_frame_size, (int)frames, NULL);
+				if (shadow) m_shadow.check(run, size, frames, m_frame, m_reader.get_offset() - size, out + decoded * amr_audio_frame_size);
+			}
+			else decode_channels(run, out + decoded * amr_audio_frame_size * m_channels);
+			if (m_fade_frame < m_fade_frames) crossfade(out + decoded * amr_audio_frame_size * m_channels, frames);
+
+			/* time scaling follows pitch lag of each frame; frames are decoded one at a time for it, as multichannel ones are anyway */
+			if (m_time_scaler.is_active()) m_lags[decoded] = Decoder_Interface_pitch_lag(m_decoders[0].get());
+			if (m_features_wanted) {
+				Decoder_Interface_features(m_decoders[0].get(), &m_features[decoded]);
+				const audio_sample * samples = out + decoded * amr_audio_frame_size * m_channels;
+				for (unsigned s = 0; s < DEC_SUBFRAMES; ++s) m_feature_power[decoded * DEC_SUBFRAMES + s] = amr_spectrum::power(samples + s * amr_spectrum_subframe_samples * m_channels, m_channels);
+			}
+
+			/* "move" past the frames */
+			m_frame += frames;
+			decoded += frames;
+			if (is_checkpointing() && m_frame == (m_checkpoints.get_count() + 1) * amr_checkpoint_interval) save_checkpoint();
+		}
+
+		if (m_streaming) update_stream_length(p_abort);
+		m_feature_count = m_features_wanted && decoded_elsewhere == 0 ? decoded : 0;
+		if (decoded == 0) {
+			finish_envelope();
+			finish_replaygain();
+			leave_decoders();
+#ifdef DEC_PROFILE
+			print_profile();
+#endif
+			return 0;
+		}
+		/* summary is of audio decoded from the start, chunk after chunk; seek elsewhere breaks it off */
+		if (m_envelope_frame == first) {
+			m_envelope.add(out, decoded, m_channels);
+			m_envelope_frame = first + decoded;
+		}
+		else m_envelope_frame = pfc::infinite32;
+		/**
+		 * ReplayGain goes on from the first frame not measured yet, wherever the chunk has it: seeking back plays
+		 * frames measured already, seeking ahead waits for playback to get back to it. Audio counts only if it's
+		 * what decoding from the start gives, as after seek to a checkpoint
+		 */
+		if (m_replaygain_frame >= first && m_replaygain_frame < first + decoded && m_exact) {
+			const unsigned from = m_replaygain_frame - first;
+			m_replaygain.add(out + (t_size)from * amr_audio_frame_size * m_channels, decoded - from, m_channels);
+			m_replaygain_frame = first + decoded;
+		}
+		/* audio decoded as from the start is the same each time, so it's kept for playing it again */
+		if (decoded > cached && m_exact && is_pcm_caching()) {
+			amr_pcm_cache::get().store(m_path, m_stats, m_channels, first + cached, decoded - cached, out + cached * amr_audio_frame_size * m_channels);
+		}
+		/* disk gets the whole file in order, or nothing; writer is done once frames don't follow, as after seek */
+		if (m_disk_writer && ((decoded > cached && !m_exact) || !m_disk_writer->write(first, decoded, out))) m_disk_writer.reset();
 
 		/* feed foobar with what we got */
-		p_chunk.set_data_fixedpoint(m_data.get_ptr(),
-									amr_audio_frame_size*2, /* foobar seems to convert what we gave to 16bps */
-									amr_sample_rate,
-									amr_channels,
-									16, /* foobar seems to convert what we gave to 16bps */
-									audio_chunk::g_guess_channel_config(amr_channels)
-		);
-		/* "move" to the next frame */
-		++m_frame;
+		if (m_upsampler.is_active()) {
+			p_chunk.grow_data_size(decoded * m_upsampler.get_frame_samples() * m_channels);
+			m_upsampler.run(out, decoded, p_chunk.get_data());
+			p_chunk.set_srate(m_upsampler.get_rate());
+			p_chunk.set_sample_count(decoded * m_upsampler.get_frame_samples());
+		}
+		else {
+			p_chunk.set_srate(amr_sample_rate);
+			p_chunk.set_sample_count(decoded * amr_audio_frame_size);
+		}
+		p_chunk.set_channels(m_channels, m_layouts[m_channels].m_config);
+		/* sped up audio is held back by two pitch periods at most, until the end */
+		if (m_time_scaler.is_active()) {
+			t_size count;
+			const audio_sample * scaled = m_time_scaler.run(p_chunk.get_data(), decoded, m_lags.get_ptr(), m_streaming ? m_stream_end : m_frame >= end_frame() && !m_following, count);
+			p_chunk.grow_data_size(count * m_channels);
+			memcpy(p_chunk.get_data(), scaled, count * m_channels * sizeof(audio_sample));
+			p_chunk.set_sample_count(count);
+		}
 
 		/* we're ready for more processing */
 		return 1;
 	}
 
 	/**
-	 * API function called by foobar when user touches seeking bar. 
+	 * API function called by foobar to get next chunk of audio together with the frame it was decoded
+	 * from, so converters can remux AMR into other containers without decoding and encoding again. Each
+	 * chunk is one frame, and p_raw gets its bytes as they're stored in the file: header byte and speech
+	 * bits, channel after channel in multichannel files. Cached audio and audio decoded ahead on other
+	 * threads have no frames at hand, so on the first call those are dropped, and decoders brought back
+	 * to the current frame, see seek_frames(); from then on everything is read and decoded right here.
+	 *
+	 * @param p_chunk		buffer in which we store decoded audio
+	 * @param p_raw			receives the frame
+	 * @param p_abort		abort callback
+	 * @throws				pfc::exception_not_implemented if a stream is decoded ahead already
+	 * @see					decode_run()
+	 * @since				1.2.0
+	 */
+	bool decode_run_raw(audio_chunk & p_chunk, mem_block_container & p_raw, abort_callback & p_abort) {
+		if (!m_raw_mode) {
+			/* stream read ahead can't be read again */
+			if (m_streaming && (m_parallel.is_active() || m_ahead.is_active() || m_pcm_serving)) throw pfc::exception_not_implemented();
+			/* frames played backwards are no stream to remux */
+			if (m_reverse) throw pfc::exception_not_implemented();
+			decode_here(p_abort);
+			/* raw frames go out one to a chunk, as they are */
+			m_time_scaler.setup(100, m_channels, amr_audio_frame_size);
+			m_raw_mode = true;
+		}
+		p_raw.set_size(0);
+		pfc::vartoggle_t<mem_block_container *> raw(m_raw, &p_raw);
+		return decode_run(p_chunk, p_abort);
+	}
+
+	/**
+	 * API function called by foobar when user touches seeking bar. Decoder is brought to the state
+	 * saved at the closest checkpoint before the target, if there is one, and decodes the frames
+	 * up to the target into m_seek_scratch, so output is exactly the same as if it decoded the file
+	 * from the start. Otherwise decoder starts over from its initial state and first decodes up
+	 * to g_amr_seek_warmup frames preceding the target, so predictor and gain histories are settled
+	 * rather than reset when audio resumes. Files without index can seek only if inaccurate seeking
+	 * was allowed, see seek_estimated(). Target still in amr_pcm_cache is played from there, and
+	 * decoders are brought to it only once the cached audio runs out, see serve_cached(). Position is
+	 * within the track being decoded, and leaves out pauses skipped when playing, see find_skips(); played
+	 * backwards, it's from the end of the track, and the segment at it is decoded by reverse_run().
 	 * 
 	 * @param p_seconds		position on seeking bar that user have choosen
 	 * @param p_abort		abort callback
 	 * @see					m_block_size
+	 * @see					m_index
 	 * @since				1.1.0
 	 */
 	void decode_seek(double p_seconds, abort_callback & p_abort) {
-		char id;
-		unsigned size;
-
+		AMR_TRACE_ZONE("decode_seek");
+		AMR_ALLOC_SCOPE("decode_seek");
 		SPDLOG_DEBUG(log, "Seek {} seconds", p_seconds);
+		if (m_telemetry > 1) {
+			m_telemetry_timer.start();
+			m_telemetry_seek = p_seconds;
+		}
 
 		/* throw exceptions if someone called decode_seek() despite of our input having reported itself as nonseekable. */
+		if (!decode_can_seek()) throw exception_io_object_not_seekable();
 		m_file->ensure_seekable();
+		/* offsets of frames checked are not known after seek, so the rest is decoded */
+		m_verify = false;
+		/* decoding ahead assumes frames are read in order; after seek everything is decoded here, or ahead again once at the target */
+		m_parallel.reset();
+		m_ahead.reset();
+		m_bitrate.reset();
+		m_fade_frames = 0;
+#ifdef DEC_ALLOC_TRACK
+		m_alloc_runs = 0;
+#endif
+		/* stream is indexed only as it's decoded from the start to the end */
+		m_stream_indexing = false;
+		m_stream_loudness.stop();
+		/* audio before the target is no history of audio after it */
+		m_upsampler.reset();
+		m_time_scaler.reset();
+		/* index built in idle time is needed right now, unless seek may go to a guessed offset; once there is one, seek is exact */
+		if (m_idle_indexing && !(m_inaccurate_seek && m_channels == 1)) {
+			while (index_frames(m_idle_reader, m_idle_index, m_idle_loudness, pfc::infinite32, p_abort));
+			adopt_index();
+		}
+		if (m_indexed) m_streaming = false;
+		/* position runs from the end of the track back when playing backwards; segment decoded is dropped */
+		if (m_reverse) {
+			const unsigned back = (unsigned)pfc::min_t<t_uint64>(audio_math::time_to_samples(p_seconds, amr_sample_rate) / amr_audio_frame_size, end_frame() - m_track_first);
+			m_frame = end_frame() - back;
+			m_reverse_left = 0;
+			return;
+		}
 		/* calculate target frame from given time */
-		t_filesize target = audio_math::time_to_samples(p_seconds, amr_sample_rate) / amr_audio_frame_size;
+		t_filesize target = m_track_first + audio_math::time_to_samples(p_seconds, amr_sample_rate) / amr_audio_frame_size;
+		if (is_skipping()) target = unskip_frame(target);
 
 		SPDLOG_DEBUG(log, "Target frame calculated at: {} ({}s at {}khz / {}b per frame", target, p_seconds, amr_sample_rate, amr_audio_frame_size);
 
-		/**
-		 * since there is no way to tell the position of given frame in the file stream 
-		 * we need to go through all of them untill we find the frame we're looking for.
-		 * @{
-		 */
-		m_file->seek(m_start,p_abort);
-		m_frame = 0;
-		while(m_file->read(&id, sizeof(char), p_abort) && m_frame < target) {
-			size = m_block_size[(id >> 3) & 0x000F];
-			m_file->seek_ex(size, file::seek_from_current, p_abort);
-			++m_frame;
+		/* seeking past the end just ends decoding; length of unindexed file is not known for sure */
+		if (!m_streaming && target >= end_frame()) {
+			m_frame = end_frame();
+			return;
 		}
-		/**
-		 * @}
-		 */
+
+		/* audio decoded before is replayed from the cache, or from disk; decoders are brought to the target only once it runs out */
+		if ((m_disk && is_pcm_replaying()) || (is_pcm_caching() && amr_pcm_cache::get().query(m_path, m_stats, m_channels, (unsigned)target))) {
+			m_frame = (unsigned)target;
+			m_pcm_serving = true;
+			m_pcm_behind = true;
+			return;
+		}
+		m_pcm_serving = false;
+		m_pcm_behind = false;
+		seek_frames((unsigned)target, p_abort);
+		m_skip = next_skip();
+		start_ahead();
 	}
 
-	/* we're able to seek */
-	bool decode_can_seek() {return true; }
-	/* no fancy stuff */
-	bool decode_get_dynamic_info(file_info & p_out, double & p_timestamp_delta) { return false; }
+	/* we're able to seek, except in streams, which have no index, and files that can't seek, which have one from the cache, unless it's being built or inaccurate seeking is fine and they have one channel */
+	bool decode_can_seek() {return (!m_streaming && m_file->can_seek()) || m_idle_indexing || (m_inaccurate_seek && m_channels == 1 && m_file->can_seek()); }
+
+	/**
+	 * API function called by foobar to get info that changed while decoding. Bitrate of recently
+	 * decoded frames is reported as often as set in preferences. Length of a stream is reported
+	 * as its estimate changes, and once it's known exactly at the end.
+	 * 
+	 * @param p_out			object to store the info in
+	 * @param p_timestamp_delta	receives time offset of the info; it applies right away
+	 * @return				<code>true</code> if p_out was changed
+	 * @see					update_stream_length()
+	 * @since				1.2.0
+	 */
+	bool decode_get_dynamic_info(file_info & p_out, double & p_timestamp_delta) {
+		const bool bitrate = m_bitrate.on_update(p_out, p_timestamp_delta);
+		/* length of indexed file changes only once, when index built in idle time replaces the estimate */
+		if (m_frames == m_reported_frames) return bitrate;
+		const unsigned moved = m_frames > m_reported_frames ? m_frames - m_reported_frames : m_reported_frames - m_frames;
+		if (m_streaming && !m_indexed && !m_stream_end && moved < amr_stream_estimate_step) return bitrate;
+		m_reported_frames = m_frames;
+		p_out.set_length((double)(m_frames - skipped_frames(0, m_frames))*amr_audio_frame_size/amr_sample_rate);
+		if (!bitrate) p_timestamp_delta = 0;
+		return true;
+	}
 	/* no fancy stuff */
 	bool decode_get_dynamic_info_track(file_info & p_out, double & p_timestamp_delta) { return false; }
-	/* simple relay */
-	void decode_on_idle(abort_callback & p_abort) {m_file->on_idle(p_abort);}
-	/* simple relay */
-	t_filestats get_file_stats(abort_callback & p_abort) {return m_file->get_stats(p_abort);}
-	/* no fancy stuff */
-	void retag(const file_info & p_info,abort_callback & p_abort) {throw exception_io_unsupported_format();}
+
+	/**
+	 * API function for queries specific to a component. Peak and RMS summary of the file is given to
+	 * waveform seekbars, so they need not decode the file, see guid_amr_envelope. Parameters of frames
+	 * of the last chunk are given to speech analysis, so it need not analyse the audio, see guid_amr_features,
+	 * and spectral envelopes made of them to visualisations, so they need not FFT it, see guid_amr_spectrum.
+	 *
+	 * @param p_type		query type
+	 * @param p_arg1		first entry of the summary, or frame or subframe of the chunk, wanted
+	 * @param p_arg2		buffer for entries, or <code>NULL</code> to get their number
+	 * @param p_arg2size	size of the buffer in bytes
+	 * @return				number of entries copied, or there are; 0 if there is no summary or query is not ours
+	 * @since				1.2.0
+	 */
+	size_t extended_param(const GUID & p_type, size_t p_arg1, void * p_arg2, size_t p_arg2size) {
+		if (p_type == guid_amr_features) {
+			/* frames are decoded one at a time from the next chunk on, so each one's parameters are taken */
+			m_features_wanted = true;
+			if (p_arg2 == NULL) return m_feature_count;
+			if (p_arg1 >= m_feature_count) return 0;
+			const t_size count = pfc::min_t<t_size>(m_feature_count - p_arg1, p_arg2size / sizeof(Dec_features));
+			memcpy(p_arg2, m_features.get_ptr() + p_arg1, count * sizeof(Dec_features));
+			return count;
+		}
+		if (p_type == guid_amr_spectrum) {
+			/* envelopes are made only of the subframes asked for */
+			m_features_wanted = true;
+			const t_size subframes = (t_size)m_feature_count * DEC_SUBFRAMES;
+			if (p_arg2 == NULL) return subframes;
+			if (p_arg1 >= subframes) return 0;
+			const t_size count = pfc::min_t<t_size>(subframes - p_arg1, p_arg2size / (amr_spectrum_bins * sizeof(float)));
+			float * out = (float*)p_arg2;
+			for (t_size i = p_arg1; i < p_arg1 + count; ++i, out += amr_spectrum_bins) {
+				amr_spectrum::envelope(m_features[i / DEC_SUBFRAMES].lsp[i % DEC_SUBFRAMES], m_feature_power[i], out);
+			}
+			return count;
+		}
+		if (p_type != guid_amr_envelope) return 0;
+		const pfc::array_t<t_uint16> & envelope = m_index->m_envelope;
+		const t_size entries = envelope.get_size() / 2;
+		if (p_arg2 == NULL) return entries;
+		if (p_arg1 >= entries) return 0;
+		const t_size count = pfc::min_t<t_size>(entries - p_arg1, p_arg2size / (2 * sizeof(t_uint16)));
+		memcpy(p_arg2, envelope.get_ptr() + p_arg1 * 2, count * 2 * sizeof(t_uint16));
+		return count;
+	}
+	/* logger of the decode, telemetry goes to it; foobar gives it after open(), and not at all for some decodes */
+	void set_logger(event_logger::ptr ptr) { m_logger = ptr; }
+	/* index is built here while it's not complete; file is relayed to, unless it's being read on another thread */
+	void decode_on_idle(abort_callback & p_abort) {
+		if (m_idle_indexing) index_on_idle(p_abort);
+		if (!m_ahead.is_active()) {m_reader.wait(); m_file->on_idle(p_abort);}
+	}
+	/* simple relay; file is not to be touched while it's being read on another thread, and stats taken on open will do */
+	t_filestats get_file_stats(abort_callback & p_abort) {if (m_ahead.is_active()) return m_stats; m_reader.wait(); return m_file->get_stats(p_abort);}
+	/**
+	 * Takes metadata to write on retag_commit(). Tags are of the whole file, so every track of a file
+	 * split at pauses sets the same ones; track number and count, which get_info() makes up for them,
+	 * are left out.
+	 *
+	 * @param p_subsong		track, see split_tracks()
+	 * @param p_info		metadata to write
+	 * @param p_abort		abort callback
+	 * @since				1.2.0
+	 */
+	void retag_set_info(t_uint32 p_subsong,const file_info & p_info,abort_callback & p_abort) {
+		m_tags.reset();
+		m_tags.copy_meta(p_info);
+		m_tags.set_replaygain(p_info.get_replaygain());
+		if (m_tracks.get_size() > 1) {
+			m_tags.meta_remove_field("tracknumber");
+			m_tags.meta_remove_field("totaltracks");
+		}
+		m_retag = true;
+	}
+
+	/**
+	 * Writes metadata set by retag_set_info() as APEv2 tag at the end of file, in place of tags that
+	 * were there; ID3v2 tag ahead of the header, if any, is left as it is. Only the tail is written,
+	 * frames are not touched, so the index still holds and is cached, and written to the sidecar if
+	 * that's on, under the new size and timestamp of the file; opening it next time does not walk the
+	 * frames again.
+	 *
+	 * @param p_abort		abort callback
+	 * @since				1.2.0
+	 */
+	void retag_commit(abort_callback & p_abort) {
+		if (!m_retag) return;
+		m_retag = false;
+		tag_processor_trailing::get()->write_apev2(m_file, m_tags, p_abort);
+		m_stats = m_file->get_stats(p_abort);
+		if (!m_indexed) return;
+		if (is_cacheable()) amr_index_cache::get().store(m_path, m_stats, m_index);
+		write_sidecar(p_abort);
+	}
 	
 	/* identify amr by content type */
 	static bool g_is_our_content_type(const char * p_content_type) {
@@ -333,30 +1633,1326 @@ public:
 
 public:
 	service_ptr_t<file> m_file;
-	pfc::array_t<t_int16> m_data;
-	int* m_state;
+	/* 3gpp decoder of each channel, given back to the pool when input is destroyed */
+	amr_decoder m_decoders[amr_max_channels];
 	static const char* m_magic;
-	static const unsigned m_start;
-	static short m_block_size[16];
-	unsigned char m_buffer[32];
+	static const char* m_magic_mc;
+	/* offset of the first frame, right after the header, and number of channels, see check_magic() */
+	unsigned m_start;
+	unsigned m_channels;
+	/* bytes of ID3v2 tag ahead of the header, 0 if there is none */
+	unsigned m_head_tag;
+	/* offset of tags at the end of file, where frames end; filesize_invalid if there are none, see data_end() */
+	t_filesize m_data_end;
+	/* metadata of those tags, or to write in their place, see retag_commit() */
+	file_info_impl m_tags;
+	/* retag_set_info() was called since the last commit */
+	bool m_retag;
+	static const short * const m_block_size;
+	/* foobar channel config of multichannel files, and where each of their channels goes in it, by channel count */
+	struct channel_layout {
+		unsigned m_config;
+		t_uint8 m_position[amr_max_channels];
+	};
+	static const channel_layout m_layouts[amr_max_channels + 1];
 	unsigned m_frames;
 	unsigned m_frame;
+	/* first frame of each track, see split_tracks(); first frame of the one being decoded, and of the next, pfc::infinite32 if it's the last */
+	pfc::array_t<unsigned> m_tracks;
+	unsigned m_track_first;
+	unsigned m_track_end;
+	/* parameters of frames of the last chunk, m_feature_count of them, once extended_param() asked for them, see guid_amr_features */
+	pfc::array_t<Dec_features> m_features;
+	/* mean square of each of their subframes, of the first channel, for guid_amr_spectrum */
+	pfc::array_t<float> m_feature_power;
+	unsigned m_feature_count;
+	bool m_features_wanted;
+	/* first frame and number of frames of each part of a pause, or of what's skimmed over, skipped when playing, see find_skips(); next one ahead of m_frame */
+	pfc::array_t<unsigned> m_skips;
+	t_size m_skip;
+	/* start of the part skipped last, its frames, and how many of them audio after the part faded in over, see crossfade() */
+	pfc::array_t<audio_sample> m_fade;
+	unsigned m_fade_frames;
+	unsigned m_fade_frame;
+	/* number of frames decoded into one chunk by decode_run() */
+	unsigned m_chunk_frames;
+	/* frame count, frame types and seek index, made by decode_length() or taken from the cache; shared, so never changed, see amr_frame_index_ptr */
+	amr_frame_index_ptr m_index;
+	/* index being built by index_on_idle(), and reader of a file handle of its own it walks frames with */
+	amr_frame_index m_idle_index;
+	amr_frame_reader m_idle_reader;
+	/* level estimated along, if it's wanted */
+	amr_loudness m_idle_loudness;
+	bool m_idle_indexing;
+	/* index built as the stream is decoded from the start, see index_run(), and level estimated along */
+	amr_frame_index m_stream_index;
+	amr_loudness m_stream_loudness;
+	bool m_stream_indexing;
+	/* file is followed as it's being written, see follow(), and reader of a file handle of its own it's indexed with meanwhile */
+	bool m_following;
+	amr_frame_reader m_follow_reader;
+	/* m_index while following, which is not shared, so follow() adds to it */
+	std::shared_ptr<amr_frame_index> m_follow_index;
+	/* walks buffered frames in bulk for index_frames() */
+	amr_frame_scanner m_scanner;
+	/* read-ahead buffer or whole loaded file, which frames are decoded from */
+	amr_frame_reader m_reader;
+	/* m_reader has the block open() read the header with, and file was not touched since */
+	bool m_prefetched;
+	/* decodes long files ahead on worker threads, when not playing */
+	amr_parallel_decoder m_parallel;
+	/* runs decoded here, checked against the reference decoder */
+	amr_shadow_check m_shadow;
+	/* reads and decodes ahead on a worker thread, when playing; it owns m_reader and m_decoders[0] while active */
+	amr_decode_ahead m_ahead;
+	/* output of frames decoded only to warm decoder up after seek */
+	pfc::array_t<audio_sample> m_seek_scratch;
+	/**
+	 * decoder snapshots, one per channel, at every amr_checkpoint_interval-th frame decoded from the
+	 * start, the first frame excluded, and room for them to be taken or restored in
+	 */
+	amr_checkpoint_store m_checkpoints;
+	pfc::array_t<t_uint8> m_checkpoint_scratch;
+	/* decoders are in the very state decoding from the first frame leaves them in, so checkpoints can be taken */
+	bool m_exact;
+	/* peak and RMS summary being made, and number of frames in it, all from the first one; pfc::infinite32 if none is */
+	amr_envelope m_envelope;
+	unsigned m_envelope_frame;
+	/* ReplayGain being measured, and the first frame not in it yet; pfc::infinite32 if none is */
+	amr_replaygain m_replaygain;
+	unsigned m_replaygain_frame;
+	/* upsamples output to the rate asked for in preferences, if any, from frames decoded into m_upsample_scratch */
+	amr_upsampler m_upsampler;
+	pfc::array_t<audio_sample, pfc::alloc_fast_aggressive> m_upsample_scratch;
+	/* speeds playback up, if asked to in preferences, after upsampling; pitch lag of each frame of the chunk goes to m_lags */
+	amr_time_scaler m_time_scaler;
+	pfc::array_t<unsigned> m_lags;
+	/* bitrate of frames decoded here lately, for decode_get_dynamic_info() */
+	dynamic_bitrate_helper m_bitrate;
+	/* decode_run() looks for the next frames in amr_pcm_cache, and decoders are still where they were when it started */
+	bool m_pcm_serving;
+	bool m_pcm_behind;
+	/* audio of the whole file on disk, served in place of amr_pcm_cache, or writer of it, for a file played often, see amr_pcm_disk_cache */
+	amr_pcm_disk_cache::mapping_ptr m_disk;
+	std::unique_ptr<amr_pcm_disk_cache::writer> m_disk_writer;
 
-private:
-	static void ensure_log_exists() {
-#ifdef _DEBUG
-		if (!log) {
-			pfc::string8 tempPath;
-			if (!uGetTempPath(tempPath)) uBugCheck();
-			tempPath.add_filename("foo_input_amr.txt");
-			log = spdlog::basic_logger_mt("amr", tempPath.c_str());
-			log->set_level(spdlog::level::trace);
+	/* path and stats of the file, which its index is cached under */
+	pfc::string8 m_path;
+	t_filestats m_stats;
+	/* m_index and m_frames are exact; otherwise m_frames is an estimate, or 0 if unknown */
+	bool m_indexed;
+	/* file is decoded as it comes, without index or seeking; m_frames is an estimate until m_stream_end */
+	bool m_streaming;
+	/* decode_initialize() was given input_flag_allow_inaccurate_seeking */
+	bool m_inaccurate_seek;
+	/* decode_initialize() was given input_flag_playback */
+	bool m_playback;
+	/* decoders post filter in floating point, see g_amr_float_engine */
+	bool m_float_engine;
+	/* decoders multiply their output by this, see g_amr_normalize; 1 if they don't */
+	float m_gain;
+	/* decoders were carried over from the segment played before, see amr_segment_handoff, so audio is not as decoded from the start */
+	bool m_continued;
+	/**
+	 * played backwards, see reverse_run(); m_frame is then past the next frame to play. Audio of the segment being played,
+	 * frames decoded one after another from m_reverse_first on, and number of them not played yet, from the first one
+	 */
+	bool m_reverse;
+	pfc::array_t<audio_sample, pfc::alloc_fast_aggressive> m_reverse_pcm;
+	unsigned m_reverse_first;
+	unsigned m_reverse_left;
+	/* decode_run_raw() was called, so frames are read and decoded only by decode_run(); frame of the current call goes to m_raw */
+	bool m_raw_mode;
+	mem_block_container * m_raw;
+	/* integrity is being verified by verify_run(); file offset of the next frame, damaged frames found, and their list */
+	bool m_verify;
+	t_filesize m_verify_offset;
+	unsigned m_verify_count;
+	pfc::string_formatter m_verify_report;
+	/* streamed file ended; m_frames is exact */
+	bool m_stream_end;
+	/* bytes and number of frames decoded from the stream here, not counting those decoded ahead */
+	t_filesize m_stream_bytes;
+	unsigned m_stream_frames;
+	/* stream length given to foobar by decode_get_dynamic_info() */
+	unsigned m_reported_frames;
+#ifdef DEC_PROFILE
+	/* instrumentation build: cycles decode_run() spent getting frames from m_reader */
+	t_uint64 m_io_cycles;
+#endif
+#ifdef DEC_ALLOC_TRACK
+	/* allocation tracking build: decode_run() calls since decode_initialize() or decode_seek() */
+	unsigned m_alloc_runs;
+#endif
+	/* where the index came from, and how long open() and scanning the file took, in seconds, for telemetry */
+	const char * m_index_source;
+	double m_open_seconds;
+	double m_scan_seconds;
+	/* g_amr_telemetry as decoding started, and logger foobar gave for it, if any */
+	unsigned m_telemetry;
+	event_logger::ptr m_logger;
+	/* since decode_initialize(), or decode_seek() if m_telemetry_seek is not negative, until the first chunk after */
+	pfc::hires_timer m_telemetry_timer;
+	bool m_telemetry_first;
+	double m_telemetry_seek;
+	/* time decode_run() took, and audio it gave, since decode_initialize() */
+	double m_telemetry_seconds;
+	double m_telemetry_audio;
+	/* counted among inputs decoding, see amr_counters, from decode_initialize() until the last chunk */
+	amr_counter_hold<amr_counter_decoders> m_decoding;
+
+private:
+#ifdef DEC_PROFILE
+	/**
+	 * Prints cycles per frame of every decoder stage to the console, by mode and frame type, for
+	 * frames decoded since decode_initialize() or the previous call. Frames decoded ahead on other
+	 * threads by m_parallel are not counted.
+	 *
+	 * @since				1.2.0
+	 */
+	void print_profile() {
+		/* frames without a mode, as NO_DATA ones, are counted with MRDTX */
+		static const char * const modes[N_MODES] = { "MR475", "MR515", "MR59", "MR67", "MR74", "MR795", "MR102", "MR122", "MRDTX/none" };
+		static const char * const types[RX_N_FRAMETYPES] = { "speech good", "speech degraded", "onset", "speech bad", "SID first", "SID update", "SID bad", "no data" };
+		static const char * const stages[N_STAGES] = { "unpack", "Decoder_amr", "Post_Filter", "Post_Process" };
+		/* all channels are counted together */
+		struct Dec_profile profile, channel;
+		Decoder_Interface_profile(m_decoders[0].get(), &profile);
+		for (unsigned i = 1; i < m_channels; ++i) {
+			Decoder_Interface_profile(m_decoders[i].get(), &channel);
+			for (unsigned mode = 0; mode < N_MODES; ++mode) {
+				for (unsigned type = 0; type < RX_N_FRAMETYPES; ++type) {
+					profile.frames[mode][type] += channel.frames[mode][type];
+					for (unsigned stage = 0; stage < N_STAGES; ++stage) profile.cycles[mode][type][stage] += channel.cycles[mode][type][stage];
+				}
+			}
+		}
+		t_uint64 total = 0;
+		for (unsigned mode = 0; mode < N_MODES; ++mode) {
+			for (unsigned type = 0; type < RX_N_FRAMETYPES; ++type) total += profile.frames[mode][type];
+		}
+		if (total == 0) return;
+
+		console::formatter out;
+		out << "AMR decoder profile of " << m_path << ", cycles per frame:";
+		for (unsigned mode = 0; mode < N_MODES; ++mode) {
+			for (unsigned type = 0; type < RX_N_FRAMETYPES; ++type) {
+				const t_uint64 frames = profile.frames[mode][type];
+				if (frames == 0) continue;
+				out << "\n  " << modes[mode] << " " << types[type] << ": " << frames << " frames";
+				for (unsigned stage = 0; stage < N_STAGES; ++stage) out << ", " << stages[stage] << " " << profile.cycles[mode][type][stage] / frames;
+			}
 		}
+		out << "\n  reading: " << m_io_cycles / total;
+		m_io_cycles = 0;
+	}
 #endif
+
+	/**
+	 * Writes a line of telemetry, if g_amr_telemetry asks for its level, to the logger foobar gave, or to
+	 * the console if it gave none.
+	 *
+	 * @param p_level		1 for lines once per file, 2 for lines per seek
+	 * @param p_line		the line, without the path
+	 * @since				1.2.0
+	 */
+	void telemetry(unsigned p_level, const char * p_line) {
+		if (m_telemetry < p_level) return;
+		if (m_logger.is_empty()) m_logger = fb2k::service_new<event_logger_fallback>();
+		m_logger->log_status(pfc::string_formatter() << "AMR telemetry: " << m_path << ": " << p_line);
+	}
+
+	/* starts timing of the decode begun by decode_initialize(), and reports how the file was opened */
+	void start_telemetry() {
+		m_telemetry = (unsigned)g_amr_telemetry.get();
+		if (m_telemetry == 0) return;
+		m_telemetry_timer.start();
+		m_telemetry_first = true;
+		m_telemetry_seek = -1;
+		m_telemetry_seconds = 0;
+		m_telemetry_audio = 0;
+		pfc::string_formatter line;
+		line << "opened in " << pfc::format_float(m_open_seconds * 1000, 0, 1) << " ms, index: " << m_index_source;
+		if (m_scan_seconds > 0) line << " in " << pfc::format_float(m_scan_seconds * 1000, 0, 1) << " ms";
+		telemetry(1, line);
+	}
+
+	/**
+	 * Counts a chunk of the decode in the telemetry: time to the first chunk of the decode or after a
+	 * seek, and at the end, speed of decoding against realtime and frames lost.
+	 *
+	 * @param p_seconds		time decode_run() took
+	 * @param p_audio		seconds of audio it gave
+	 * @param p_more		false if the track ended
+	 * @since				1.2.0
+	 */
+	void telemetry_chunk(double p_seconds, double p_audio, bool p_more) {
+		m_telemetry_seconds += p_seconds;
+		m_telemetry_audio += p_audio;
+		if (m_telemetry_first) {
+			m_telemetry_first = false;
+			telemetry(1, pfc::string_formatter() << "first chunk in " << pfc::format_float(m_telemetry_timer.query() * 1000, 0, 1) << " ms");
+		}
+		if (m_telemetry_seek >= 0) {
+			telemetry(2, pfc::string_formatter() << "seek to " << pfc::format_time_ex(m_telemetry_seek, 3) << " took " << pfc::format_float(m_telemetry_timer.query() * 1000, 0, 1) << " ms to the first chunk");
+			m_telemetry_seek = -1;
+		}
+		if (p_more) return;
+		pfc::string_formatter line;
+		line << "decoded " << pfc::format_float(m_telemetry_audio, 0, 1) << " s in " << pfc::format_float(m_telemetry_seconds * 1000, 0, 1) << " ms";
+		if (m_telemetry_seconds > 0) line << ", " << pfc::format_float(m_telemetry_audio / m_telemetry_seconds, 0, 0) << "x realtime";
+		if (m_index) line << ", " << m_index->m_bad << " bad frames";
+		telemetry(1, line);
+	}
+
+	/**
+	 * Decodes a frame of every channel, m_channels frames lying one after another, each with decoder of
+	 * its channel. Each decoder writes every m_channels-th sample of p_out, so channels come out interleaved
+	 * in foobar's order without a pass of their own. Decoders of all channels go in one call, which filters
+	 * the channels side by side where it can.
+	 *
+	 * @param p_data		the frames, as from amr_frame_reader::next_frames()
+	 * @param p_out			receives amr_audio_frame_size samples of each channel
+	 * @since				1.2.0
+	 */
+	void decode_channels(const t_uint8 * p_data, audio_sample * p_out) {
+		if (m_channels == 1) {
+			Decoder_Interface_Decode_float(m_decoders[0].get(), const_cast<t_uint8*>(p_data), p_out, 0);
+			return;
+		}
+		const channel_layout & layout = m_layouts[m_channels];
+		void * decoders[amr_max_channels];
+		t_uint8 * frames[amr_max_channels];
+		audio_sample * out[amr_max_channels];
+		for (unsigned c = 0; c < m_channels; ++c) {
+			decoders[c] = m_decoders[c].get();
+			frames[c] = const_cast<t_uint8*>(p_data);
+			out[c] = p_out + layout.m_position[c];
+			p_data += 1 + m_block_size[(p_data[0] >> 3) & 0x0F];
+		}
+		Decoder_Interface_Decode_group_float(decoders, m_channels, frames, out, m_channels, 0);
+	}
+
+	/* decodes frame of each channel for the state it leaves decoders in, with no output */
+	void warmup_channels(const t_uint8 * p_data) {
+		for (unsigned c = 0; c < m_channels; ++c) {
+			Decoder_Interface_Warmup(m_decoders[c].get(), const_cast<t_uint8*>(p_data), 0);
+			p_data += 1 + m_block_size[(p_data[0] >> 3) & 0x0F];
+		}
+	}
+
+	/**
+	 * Verifies integrity without decoding, in place of decode_run(): frames are walked in the read-ahead
+	 * buffer, and every frame header must have zero padding bits and a frame type that is not reserved,
+	 * and the last frame must not be cut off by the end of file. Chunks are silence, as long as the frames.
+	 * Offset of each damaged frame goes to the console; once the end is reached, exception_io_data lists
+	 * the first amr_verify_max_listed of them, if there are any.
+	 *
+	 * @param p_chunk		receives silence of the length of the frames checked
+	 * @param p_abort		abort callback
+	 * @return				<code>false</code> at the end of the file
+	 * @throws				exception_io_data at the end of the file, if any frame was damaged
+	 * @since				1.2.0
+	 */
+	bool verify_run(audio_chunk & p_chunk, abort_callback & p_abort) {
+		unsigned frames = 0;
+		bool end = false;
+		while (frames < amr_verify_chunk_frames) {
+			t_size size;
+			const t_uint8 * frame = m_reader.next_frames(m_block_size, m_channels, size, p_abort);
+			if (frame == NULL) {
+				if (m_reader.get_left() > 0) verify_problem(m_verify_offset, "frame cut off by the end of file");
+				end = true;
+				break;
+			}
+			for (unsigned c = 0; c < m_channels; ++c) {
+				const unsigned ft = (frame[0] >> 3) & 0x0F;
+				if (ft >= amr_n_modes && ft != amr_no_data) verify_problem(m_verify_offset, "reserved frame type");
+				else if (!amr_frame_reader::is_frame_header(frame[0])) verify_problem(m_verify_offset, "padding bits of frame header set");
+				const t_size length = 1 + m_block_size[ft];
+				m_verify_offset += length;
+				frame += length;
+			}
+			++frames;
+		}
+
+		if (end && m_verify_count > 0) {
+			AMR_LOG_SUMMARY(log, "{}: integrity verified, {} damaged frames", m_path.c_str(), m_verify_count);
+			pfc::string_formatter message;
+			message << m_verify_count << " damaged frame(s): " << m_verify_report;
+			if (m_verify_count > amr_verify_max_listed) message << ", ...";
+			throw exception_io_data(message);
+		}
+		if (frames == 0) return false;
+
+		p_chunk.set_srate(m_upsampler.is_active() ? m_upsampler.get_rate() : amr_sample_rate);
+		p_chunk.set_channels(m_channels, m_layouts[m_channels].m_config);
+		p_chunk.set_silence(frames * (m_upsampler.is_active() ? m_upsampler.get_frame_samples() : amr_audio_frame_size));
+		return true;
+	}
+
+	/* records damaged frame at given offset for verify_run() */
+	void verify_problem(t_filesize p_offset, const char * p_what) {
+		console::formatter() << "AMR integrity: " << m_path << ": " << p_what << " at offset " << p_offset;
+		if (++m_verify_count > amr_verify_max_listed) return;
+		if (m_verify_count > 1) m_verify_report << ", ";
+		m_verify_report << p_what << " at offset " << p_offset;
+	}
+
+	/**
+	 * Plays the track backwards, in place of decode_run(). Track is decoded a segment at a time, from the
+	 * checkpoint frame before m_frame up to it, see seek_frames(), and the segment is then given out chunk
+	 * by chunk from its end, samples in reverse order. Each segment costs decoding amr_checkpoint_interval
+	 * frames at most, and the warm-up before it, wherever in the file it is; restored checkpoint makes it
+	 * exact, otherwise it starts with fresh decoders as any seek does.
+	 *
+	 * @param p_chunk		receives audio of up to m_chunk_frames frames, last one first
+	 * @param p_abort		abort callback
+	 * @return				<code>false</code> once the first frame of the track was played
+	 * @since				1.2.0
+	 */
+	bool reverse_run(audio_chunk & p_chunk, abort_callback & p_abort) {
+		const t_size samples = amr_audio_frame_size * m_channels;
+		if (m_reverse_left == 0) {
+			if (m_frame <= m_track_first) return false;
+			const unsigned end = m_frame;
+			m_reverse_first = pfc::max_t(m_track_first, (end - 1) / amr_checkpoint_interval * amr_checkpoint_interval);
+			seek_frames(m_reverse_first, p_abort);
+			m_reverse_pcm.set_size((end - m_reverse_first) * samples);
+			/* file turned out to be shorter than indexed, if the segment or frames before it are not all there; what's there is played */
+			t_size size;
+			const t_uint8 * frame;
+			while (m_frame == m_reverse_first + m_reverse_left && m_frame < end && (frame = m_reader.next_frames(m_block_size, m_channels, size, p_abort)) != NULL) {
+				decode_channels(frame, m_reverse_pcm.get_ptr() + m_reverse_left * samples);
+				++m_reverse_left;
+				++m_frame;
+			}
+			if (m_reverse_left == 0) return false;
+		}
+		const unsigned frames = pfc::min_t(m_chunk_frames, m_reverse_left);
+		m_reverse_left -= frames;
+		m_frame = m_reverse_first + m_reverse_left;
+		m_feature_count = 0;
+
+		/* last sample of the segment not played yet comes first; channels of each sample stay in order */
+		audio_sample * out;
+		if (m_upsampler.is_active()) {
+			m_upsample_scratch.set_size(frames * samples);
+			out = m_upsample_scratch.get_ptr();
+		}
+		else {
+			p_chunk.grow_data_size(frames * samples);
+			out = p_chunk.get_data();
+		}
+		const audio_sample * in = m_reverse_pcm.get_ptr() + (m_reverse_left + frames) * samples;
+		for (t_size i = 0; i < frames * amr_audio_frame_size; ++i) {
+			in -= m_channels;
+			for (unsigned c = 0; c < m_channels; ++c) out[i * m_channels + c] = in[c];
+		}
+		if (m_upsampler.is_active()) {
+			p_chunk.grow_data_size(frames * m_upsampler.get_frame_samples() * m_channels);
+			m_upsampler.run(out, frames, p_chunk.get_data());
+			p_chunk.set_srate(m_upsampler.get_rate());
+			p_chunk.set_sample_count(frames * m_upsampler.get_frame_samples());
+		}
+		else {
+			p_chunk.set_srate(amr_sample_rate);
+			p_chunk.set_sample_count(frames * amr_audio_frame_size);
+		}
+		p_chunk.set_channels(m_channels, m_layouts[m_channels].m_config);
+		return true;
+	}
+
+	/* decoded audio is replayed when playing indexed files, whose frames are numbered exactly; caches hold it without gain */
+	bool is_pcm_replaying() const {
+		return m_playback && m_gain == 1.0f && !m_continued && !m_reverse && m_indexed && !m_streaming && !m_raw_mode && !m_features_wanted && !m_following && !m_time_scaler.is_active() && !is_skipping();
+	}
+
+	/* decoded audio is kept in amr_pcm_cache when replayed */
+	bool is_pcm_caching() const {
+		return is_pcm_replaying() && amr_pcm_cache::is_enabled();
+	}
+
+	/**
+	 * Gain that brings the level estimated when indexing, see amr_loudness, to the one g_amr_normalize_level
+	 * asks for, boosting by amr_normalize_max_boost dB at most.
+	 *
+	 * @return				linear gain; 1 if normalizing is off, or the index has no level or the file is silent
+	 * @since				1.2.0
+	 */
+	float normalize_gain() const {
+		if (!g_amr_normalize.get() || m_index->m_level_frames == 0 || m_index->m_level == amr_level_silent) return 1.0f;
+		/* level is mean power of the speech, in hundredths of a dB */
+		const double db = pfc::min_t<double>(-(double)g_amr_normalize_level.get() - m_index->m_level / 100.0, amr_normalize_max_boost);
+		return (float)pow(10.0, db / 20);
+	}
+
+	/**
+	 * Copies audio of the next frames from amr_pcm_cache, segment after segment, for decode_run(), or
+	 * from the file on disk mapped, which has all of them. Once the cache holds no more of them, decoders
+	 * are brought to the frame after the last one copied, see seek_frames(), and the rest is decoded.
+	 *
+	 * @param p_out			receives up to m_chunk_frames frames of audio
+	 * @param p_abort		abort callback
+	 * @return				number of frames copied
+	 * @since				1.2.0
+	 */
+	unsigned serve_cached(audio_sample * p_out, abort_callback & p_abort) {
+		unsigned copied = 0;
+		while (copied < m_chunk_frames && m_frame < end_frame()) {
+			const t_size samples = amr_audio_frame_size * m_channels;
+			unsigned frames = pfc::min_t(m_chunk_frames - copied, end_frame() - m_frame);
+			const audio_sample * from;
+			amr_pcm_cache::segment_ptr s;
+			if (m_disk) from = m_disk->get_samples() + (t_size)m_frame * samples;
+			else {
+				s = amr_pcm_cache::get().query(m_path, m_stats, m_channels, m_frame);
+				if (!s) break;
+				const unsigned offset = m_frame - s->m_first;
+				frames = pfc::min_t(frames, s->m_frames - offset);
+				from = s->m_samples.get_ptr() + offset * samples;
+			}
+			memcpy(p_out + copied * samples, from, frames * samples * sizeof(audio_sample));
+			m_frame += frames;
+			copied += frames;
+			m_pcm_behind = true;
+		}
+		if (copied == m_chunk_frames || m_frame >= end_frame()) return copied;
+
+		m_pcm_serving = false;
+		if (m_pcm_behind) {
+			SPDLOG_DEBUG(log, "Cached audio ends at frame {}", m_frame);
+			m_ahead.reset();
+			seek_frames(m_frame, p_abort);
+			m_pcm_behind = false;
+			start_ahead();
+		}
+		return copied;
+	}
+
+	/* decode_run() takes checkpoints as it goes; seek to a checkpoint needs index entry of its frame, which may come later */
+	bool is_checkpointing() const {
+		return m_exact && (m_indexed ? !m_streaming : m_idle_indexing);
+	}
+
+	/**
+	 * Saves decoder states at current frame, the next checkpoint in order. Snapshots of 3gpp decoder
+	 * are a few KB, kept in less than half of that, see amr_checkpoint_store, so an hour long file gets
+	 * ~1.4MB per channel of them.
+	 *
+	 * @param p_snapshots	snapshots already taken at that frame, one per channel, as decoding ahead does;
+	 *						<code>NULL</code> to take them of m_decoders now
+	 * @since				1.2.0
+	 */
+	void save_checkpoint(const t_uint8 * p_snapshots = NULL) {
+		/* size is a multiple of the alignment snapshot contents need, so they can lie one after another */
+		const t_size size = Decoder_Interface_snapshot_size();
+		if (p_snapshots == NULL) {
+			m_checkpoint_scratch.set_size(size * m_channels);
+			for (unsigned i = 0; i < m_channels; ++i) Decoder_Interface_snapshot(m_decoders[i].get(), m_checkpoint_scratch.get_ptr() + i * size);
+			p_snapshots = m_checkpoint_scratch.get_ptr();
+		}
+		m_checkpoints.append(p_snapshots, size * m_channels);
+	}
+
+	/**
+	 * Starts reading and decoding ahead on another thread, see amr_decode_ahead, if it's turned on in
+	 * preferences and worth it: frames of single channel indexed files played back from the current
+	 * one on, unless they're in memory already. Checkpoints are then taken on that thread.
+	 *
+	 * @since				1.2.0
+	 */
+	void start_ahead() {
+		if (m_pcm_behind || m_raw_mode || m_reverse || m_features_wanted || m_following || !m_playback || m_time_scaler.is_active() || is_skipping() || !amr_decode_ahead::is_enabled() || m_channels != 1 || m_streaming || m_reader.is_loaded() || m_frame >= end_frame()) return;
+		const unsigned checkpoint = is_checkpointing() ? (m_checkpoints.get_count() + 1) * amr_checkpoint_interval : 0;
+		m_ahead.start(m_reader, m_decoders[0], m_block_size, m_frame, end_frame() - m_frame, m_chunk_frames, checkpoint, amr_checkpoint_interval);
+	}
+
+	/**
+	 * Drops audio decoded ahead on other threads, or still to be copied from amr_pcm_cache, and brings decoders
+	 * to the current frame, see seek_frames(), so everything from then on is read and decoded in decode_run()
+	 * itself. Streams can't be read again, so they're left as they are.
+	 *
+	 * @param p_abort		abort callback
+	 * @since				1.2.0
+	 */
+	void decode_here(abort_callback & p_abort) {
+		if (m_streaming || !(m_parallel.is_active() || m_ahead.is_active() || m_pcm_serving)) return;
+		m_parallel.reset();
+		m_ahead.reset();
+		m_pcm_serving = false;
+		m_pcm_behind = false;
+		seek_frames(m_frame, p_abort);
+	}
+
+	/**
+	 * Brings reader and decoders to given frame for decode_seek(): to the closest checkpoint before it,
+	 * or to g_amr_seek_warmup frames before it with fresh decoders, and decodes the frames in between
+	 * into m_seek_scratch. Fresh decoders past the first frame aren't exact anyway, so their frames skip
+	 * output but for the last amr_seek_settle_frames, see warmup_channels(); restored ones decode every
+	 * frame in full, as checkpoints are taken from them later.
+	 *
+	 * @param p_target		frame to decode next
+	 * @param p_abort		abort callback
+	 * @param p_exact		checkpoint is restored however far before the target it is; otherwise only if
+	 *						it's within the warm-up, as skipped pause is not to be decoded after all
+	 * @since				1.2.0
+	 */
+	void seek_frames(unsigned p_target, abort_callback & p_abort, bool p_exact = true) {
+		t_size size;
+		/* first frame to decode; there is nothing to warm up with before the first frame of the file */
+		const unsigned warmup = (unsigned)pfc::min_t<t_uint64>(g_amr_seek_warmup.get(), amr_max_seek_warmup_frames);
+		const unsigned start = p_target > warmup ? p_target - warmup : 0;
+		unsigned checkpoint = m_streaming ? 0 : pfc::min_t<unsigned>(p_target / amr_checkpoint_interval, (unsigned)m_checkpoints.get_count());
+		if (!p_exact && checkpoint * amr_checkpoint_interval < start) checkpoint = 0;
+
+		/**
+		 * there is no way to tell the position of given frame in the file stream, so start
+		 * from the closest indexed frame before the first frame to decode and walk the remaining frames.
+		 * @{
+		 */
+		if (checkpoint > 0) {
+			m_frame = checkpoint * amr_checkpoint_interval;
+			m_reader.seek(m_index->m_offsets[m_frame / amr_index_interval], p_abort);
+			restore_checkpoint(checkpoint);
+			SPDLOG_DEBUG(log, "Restored checkpoint at frame {}", m_frame);
+		}
+		else if (m_streaming) seek_estimated(start, p_abort);
+		else {
+			const t_size entry = start / amr_index_interval;
+			m_reader.seek(m_index->m_offsets[entry], p_abort);
+			m_frame = (unsigned) entry * amr_index_interval;
+			while(m_frame < start && m_reader.next_frames(m_block_size, m_channels, size, p_abort) != NULL) {
+				++m_frame;
+			}
+		}
+		/**
+		 * @}
+		 */
+
+		/* decode frames up to the target with fresh decoders, unless restored ones; only the state they leave matters */
+		if (checkpoint == 0) {
+			for (unsigned i = 0; i < m_channels; ++i) m_decoders[i].acquire(m_float_engine, m_gain);
+			m_exact = start == 0;
+		}
+		m_seek_scratch.set_size(amr_audio_frame_size * m_channels);
+		while (m_frame < p_target) {
+			const t_uint8 * frame = m_reader.next_frames(m_block_size, m_channels, size, p_abort);
+			if (frame == NULL) {
+				if (m_streaming) m_stream_end = true;
+				else m_frame = m_frames;
+				break;
+			}
+			if (!m_exact && p_target - m_frame > amr_seek_settle_frames) warmup_channels(frame);
+			else decode_channels(frame, m_seek_scratch.get_ptr());
+			++m_frame;
+		}
+	}
+
+	/**
+	 * Brings decoders to the states saved by save_checkpoint().
+	 *
+	 * @param p_checkpoint	number of checkpoint, from 1 up to the number taken
+	 * @since				1.2.0
+	 */
+	void restore_checkpoint(unsigned p_checkpoint) {
+		const t_size size = Decoder_Interface_snapshot_size();
+		m_checkpoint_scratch.set_size(size * m_channels);
+		m_checkpoints.get(p_checkpoint - 1, m_checkpoint_scratch.get_ptr());
+		for (unsigned i = 0; i < m_channels; ++i) Decoder_Interface_restore(m_decoders[i].get(), m_checkpoint_scratch.get_ptr() + i * size);
+		m_exact = true;
+	}
+
+	/* file offset of given frame, or right after the last whole frame for m_frames; indexed frame before it is walked from */
+	t_filesize frame_offset(unsigned p_frame, abort_callback & p_abort) {
+		if (m_frames == 0) return m_start;
+		const t_size entry = pfc::min_t(p_frame, m_frames - 1) / amr_index_interval;
+		m_reader.seek(m_index->m_offsets[entry], p_abort);
+		t_size size;
+		for (unsigned f = (unsigned)entry * amr_index_interval; f < p_frame; ++f) {
+			if (m_reader.next_frames(m_block_size, m_channels, size, p_abort) == NULL) break;
+		}
+		return m_reader.get_offset();
+	}
+
+	/* frame decoding of the current track ends at, end of file unless it's followed by another track */
+	unsigned end_frame() const { return pfc::min_t(m_frames, m_track_end); }
+
+	/**
+	 * Splits indexed file into tracks at pauses of at least g_amr_split_pause seconds, if that's wanted,
+	 * see amr_frame_index::m_pauses. Track after a pause starts at its last checkpoint frame, so it's seeked
+	 * to exactly once the file was decoded past it, with less than amr_checkpoint_interval frames of the pause
+	 * before the speech. Pause at
+	 * the start of the file is left in the first track; one at its end is never recorded.
+	 *
+	 * @since				1.2.0
+	 */
+	void split_tracks() {
+		m_tracks.set_size(1);
+		m_tracks[0] = 0;
+		m_track_first = 0;
+		m_track_end = pfc::infinite32;
+		const t_uint64 seconds = g_amr_split_pause.get();
+		if (!m_indexed || seconds == 0) return;
+		const t_uint64 min_frames = pfc::max_t<t_uint64>(seconds * amr_sample_rate / amr_audio_frame_size, amr_split_min_frames);
+		const pfc::array_t<t_uint32> & pauses = m_index->m_pauses;
+		for (t_size i = 0; i < pauses.get_size(); i += 2) {
+			if (pauses[i] == 0 || pauses[i + 1] < min_frames) continue;
+			m_tracks.append_single((pauses[i] + pauses[i + 1]) / amr_checkpoint_interval * amr_checkpoint_interval);
+		}
+	}
+
+	/**
+	 * Picks parts of pauses of at least g_amr_skip_pause seconds to skip when playing, if that's wanted,
+	 * see amr_frame_index::m_pauses. Half a second at each end of the pause is kept, so it's still heard
+	 * as one, and decoders warm up on comfort noise before speech resumes. Pauses are known only once the
+	 * file is indexed, so one indexed in idle time gets them then. When skimming, see g_amr_skim, all but
+	 * amr_skim_excerpt_frames of every interval is skipped instead, pauses or not; each excerpt costs its
+	 * frames and a seek's warm-up, see seek_frames(), so skimming takes time of the excerpts only.
+	 *
+	 * @since				1.2.0
+	 */
+	void find_skips() {
+		m_skips.set_size(0);
+		m_skip = 0;
+		if (!m_indexed) return;
+		const t_uint64 skim = g_amr_skim.get();
+		if (skim >= 2) {
+			const unsigned interval = (unsigned)skim * amr_sample_rate / amr_audio_frame_size;
+			for (unsigned first = amr_skim_excerpt_frames; first < m_frames; first += interval) {
+				m_skips.append_single(first);
+				m_skips.append_single(pfc::min_t<unsigned>(interval - amr_skim_excerpt_frames, m_frames - first));
+			}
+			return;
+		}
+		const t_uint64 seconds = g_amr_skip_pause.get();
+		if (seconds == 0) return;
+		const t_uint64 min_frames = pfc::max_t<t_uint64>(seconds * amr_sample_rate / amr_audio_frame_size, amr_pause_min_frames);
+		const pfc::array_t<t_uint32> & pauses = m_index->m_pauses;
+		for (t_size i = 0; i < pauses.get_size(); i += 2) {
+			if (pauses[i + 1] < min_frames) continue;
+			m_skips.append_single(pauses[i] + amr_skip_keep_frames);
+			m_skips.append_single(pauses[i + 1] - 2 * amr_skip_keep_frames);
+		}
+	}
+
+	/* pauses are skipped as this decoder plays */
+	bool is_skipping() const { return m_playback && m_skips.get_size() > 0; }
+
+	/**
+	 * Decodes the first amr_skip_fade_frames frames of a part about to be skipped into m_fade, for audio
+	 * after the part to fade in over, see crossfade(), so jumps are heard as no clicks. Decoders are
+	 * brought past the part right after, so the state this leaves them in does not matter.
+	 *
+	 * @param p_abort		abort callback
+	 * @since				1.2.0
+	 */
+	void decode_fade(abort_callback & p_abort) {
+		const t_size samples = amr_audio_frame_size * m_channels;
+		m_fade.set_size(amr_skip_fade_frames * samples);
+		m_fade_frames = 0;
+		m_fade_frame = 0;
+		t_size size;
+		const t_uint8 * frame;
+		while (m_fade_frames < amr_skip_fade_frames && (frame = m_reader.next_frames(m_block_size, m_channels, size, p_abort)) != NULL) {
+			decode_channels(frame, m_fade.get_ptr() + m_fade_frames * samples);
+			++m_fade_frames;
+		}
+	}
+
+	/* mixes frames just decoded after a skipped part with what decode_fade() got of its start, fading from that to them */
+	void crossfade(audio_sample * p_out, unsigned p_frames) {
+		const unsigned frames = pfc::min_t(p_frames, m_fade_frames - m_fade_frame);
+		const double total = (double)m_fade_frames * amr_audio_frame_size;
+		const audio_sample * fade = m_fade.get_ptr() + (t_size)m_fade_frame * amr_audio_frame_size * m_channels;
+		t_size pos = (t_size)m_fade_frame * amr_audio_frame_size;
+		for (t_size i = 0; i < (t_size)frames * amr_audio_frame_size; ++i, ++pos) {
+			const audio_sample w = (audio_sample)((pos + 0.5) / total);
+			for (unsigned c = 0; c < m_channels; ++c) {
+				const t_size n = i * m_channels + c;
+				p_out[n] = fade[n] + w * (p_out[n] - fade[n]);
+			}
+		}
+		m_fade_frame += frames;
+	}
+
+	/* first of m_skips not behind m_frame, for decode_run() to skip next; none unless playing */
+	t_size next_skip() const {
+		if (!is_skipping()) return m_skips.get_size();
+		t_size i = 0;
+		while (i < m_skips.get_size() && m_skips[i] + m_skips[i + 1] <= m_frame) i += 2;
+		return i;
+	}
+
+	/* frames of m_skips between p_first and p_end */
+	unsigned skipped_frames(unsigned p_first, unsigned p_end) const {
+		unsigned skipped = 0;
+		for (t_size i = 0; i < m_skips.get_size(); i += 2) {
+			const unsigned first = pfc::max_t(m_skips[i], p_first), end = pfc::min_t(m_skips[i] + m_skips[i + 1], p_end);
+			if (first < end) skipped += end - first;
+		}
+		return skipped;
+	}
+
+	/* frame of the current track that's p_frame - m_track_first frames into it, as played with pauses skipped */
+	t_filesize unskip_frame(t_filesize p_frame) const {
+		for (t_size i = 0; i < m_skips.get_size(); i += 2) {
+			const t_filesize first = pfc::max_t<t_filesize>(m_skips[i], m_track_first), end = (t_filesize)m_skips[i] + m_skips[i + 1];
+			if (first < end && first <= p_frame) p_frame += end - first;
+		}
+		return p_frame;
+	}
+
+	/* local seekable files get seek index; remote seekable ones only if it's cached or in a sidecar, others are always streamed */
+	bool is_indexable() {
+		return m_file->can_seek() && !m_file->is_remote();
+	}
+
+	/**
+	 * Scans the whole file for exact length and seek index, and caches them. Input that's scanning the
+	 * file already, as the info reader is when foobar opens the file for decoding too, is waited for,
+	 * and the index it cached is taken, so the file is scanned once.
+	 *
+	 * @param p_abort		abort callback
+	 * @since				1.2.0
+	 */
+	void build_index(abort_callback & p_abort) {
+		amr_index_cache & cache = amr_index_cache::get();
+		cache.begin_scan(m_path, p_abort);
+		try {
+			const amr_frame_index_ptr cached = cache.query(m_path, m_stats);
+			if (cached && is_complete(*cached)) {
+				m_index = cached;
+				m_index_source = "cache hit, scanned by another input";
+				SPDLOG_DEBUG(log, "{}: index found in cache once scanned by another input", m_path.c_str());
+			}
+			else scan_index(p_abort);
+		} catch (...) {
+			cache.end_scan(m_path);
+			throw;
+		}
+		cache.end_scan(m_path);
+		m_frames = m_index->m_frames;
+		m_indexed = true;
+	}
+
+	/* indexes file of one mode from its size, see index_constant(), and caches the index; there's no sidecar, as it takes no scan */
+	bool adopt_constant_index(abort_callback & p_abort) {
+		std::shared_ptr<amr_frame_index> index = std::make_shared<amr_frame_index>();
+		if (!index_constant(*index, p_abort)) return false;
+		m_index = index;
+		amr_index_cache::get().store(m_path, m_stats, m_index);
+		m_frames = m_index->m_frames;
+		m_indexed = true;
+		return true;
+	}
+
+	/* scans the file for build_index() */
+	void scan_index(abort_callback & p_abort) {
+		pfc::hires_timer timer;
+		timer.start();
+		/* whole file is going to be read anyway; small local one may as well stay in memory */
+		m_reader.load(p_abort);
+		std::shared_ptr<amr_frame_index> index = std::make_shared<amr_frame_index>();
+		/* summary and ReplayGain of the index cached before are kept, file is the same */
+		if (m_index) {
+			index->m_envelope = m_index->m_envelope;
+			index->m_track_gain = m_index->m_track_gain;
+			index->m_track_peak = m_index->m_track_peak;
+		}
+		decode_length(*index, p_abort);
+		adopt_duplicate(*index);
+		m_index = index;
+		amr_index_cache::get().store(m_path, m_stats, m_index);
+		write_sidecar(p_abort);
+		m_index_source = "cache miss, scanned";
+		m_scan_seconds = timer.query();
+		AMR_LOG_SUMMARY(log, "{}: scanned in {:.1f} ms, {} frames, {} bad", m_path.c_str(), timer.query() * 1000, m_index->m_frames, m_index->m_bad);
+	}
+
+	/**
+	 * Extends index cached for the file as it was before it grew, as a recorder appending to it all day leaves
+	 * it, rather than scanning all of it again: frames from the last indexed offset on are walked up to where
+	 * the index ends, which has to be the end of valid frames within the size the file had, and only frames
+	 * after are scanned, see index_frames(). Level is kept as estimated from the frames before, as when a file
+	 * is followed, see follow(); summary is dropped, as it's of the shorter file. Pause or run of damaged frames
+	 * going on where the file grew counts from there. Index is cached for the file as it is now, and shared
+	 * in its sidecar. Checkpoints are not part of the index; they're taken as the file is decoded.
+	 *
+	 * @param p_abort		abort callback
+	 * @return				<code>true</code> if index was extended
+	 * @since				1.2.0
+	 */
+	bool extend_index(abort_callback & p_abort) {
+		/* tags at the end of what the file was are in the middle of it now */
+		if (m_data_end != filesize_invalid) return false;
+		t_filestats before;
+		const amr_frame_index_ptr cached = amr_index_cache::get().query_grown(m_path, m_stats, before);
+		if (!cached || cached->m_frames == 0 || !is_complete(*cached)) return false;
+		pfc::hires_timer timer;
+		timer.start();
+		std::shared_ptr<amr_frame_index> index = std::make_shared<amr_frame_index>(*cached);
+		index->m_envelope.set_size(0);
+		index->m_track_gain = amr_gain_none;
+		index->m_track_peak = 0;
+
+		amr_frame_reader reader;
+		reader.attach(m_file);
+		reader.set_resync(m_channels == 1);
+		const t_size entry = (index->m_frames - 1) / amr_index_interval;
+		reader.seek(index->m_offsets[entry], p_abort);
+		for (unsigned frame = (unsigned)entry * amr_index_interval; frame < index->m_frames; ++frame) {
+			t_size size;
+			const t_uint8 * frames = reader.next_frames(m_block_size, m_channels, size, p_abort);
+			if (frames == NULL || !are_frames(frames, size)) return false;
+		}
+		if (reader.get_offset() > before.m_size) return false;
+		const unsigned frames = index->m_frames;
+		amr_loudness none;
+		while (index_frames(reader, *index, none, pfc::infinite32, p_abort));
+		m_file->seek(0, p_abort);
+
+		m_index = index;
+		amr_index_cache::get().store(m_path, m_stats, m_index);
+		write_sidecar(p_abort);
+		m_frames = m_index->m_frames;
+		m_indexed = true;
+		m_index_source = "cache hit, grown file, tail scanned";
+		m_scan_seconds = timer.query();
+		AMR_LOG_SUMMARY(log, "{}: grown by {} frames, tail scanned in {:.1f} ms", m_path.c_str(), m_frames - frames, m_scan_seconds * 1000);
+		return true;
+	}
+
+	/* p_size bytes at p_data are frames with valid headers, one right after another */
+	bool are_frames(const t_uint8 * p_data, t_size p_size) const {
+		t_size pos = 0;
+		while (pos < p_size) {
+			if (!amr_frame_reader::is_frame_header(p_data[pos])) return false;
+			pos += 1 + m_block_size[(p_data[pos] >> 3) & 0x0F];
+		}
+		return pos == p_size;
+	}
+
+	/**
+	 * Takes index of the file from its sidecar, written by whichever computer scanned it first, and caches it.
+	 * Sidecar without level or hash won't do if they're wanted, as with index in the cache.
+	 *
+	 * @param p_abort		abort callback
+	 * @return				<code>true</code> if index was taken
+	 * @since				1.2.0
+	 */
+	bool read_sidecar(abort_callback & p_abort) {
+		std::shared_ptr<amr_frame_index> index = std::make_shared<amr_frame_index>();
+		if (!amr_index_sidecar::read(m_path, m_stats, *index, p_abort)) return false;
+		if (!is_complete(*index)) return false;
+		m_index = index;
+		amr_index_cache::get().store(m_path, m_stats, m_index);
+		m_frames = m_index->m_frames;
+		m_indexed = true;
+		return true;
+	}
+
+	/* shares the index just built with other computers; sidecar that can't be written, as on read-only share, is no error */
+	void write_sidecar(abort_callback & p_abort) {
+		try {
+			amr_index_sidecar::write(m_path, m_stats, *m_index, p_abort);
+		} catch (const exception_io & e) {
+			SPDLOG_DEBUG(log, "{}: sidecar not written, {}", m_path.c_str(), e.what());
+		}
+	}
+
+	/**
+	 * Starts building the index in idle time, see index_on_idle(); file is decoded as a stream meanwhile,
+	 * or just as it is if it can't be opened once more.
+	 *
+	 * @param p_abort		abort callback
+	 * @since				1.2.0
+	 */
+	void start_indexing(abort_callback & p_abort) {
+		service_ptr_t<file> file;
+		try {
+			filesystem::g_open_read(file, m_path, p_abort);
+		} catch (const exception_io & e) {
+			SPDLOG_DEBUG(log, "{}: not indexed in idle time, {}", m_path.c_str(), e.what());
+			return;
+		}
+		m_idle_reader.attach(file);
+		m_idle_reader.set_end(m_data_end);
+		m_idle_reader.seek(m_start, p_abort);
+		m_idle_reader.set_resync(m_channels == 1);
+		m_idle_reader.set_background(true);
+		m_idle_index.reset();
+		if (amr_loudness::is_enabled()) m_idle_loudness.start(m_channels);
+		if (g_amr_content_hash.get()) m_idle_index.m_hash = amr_hash_start(m_channels);
+		m_idle_indexing = true;
+	}
+
+	/**
+	 * Gets ready to follow a file still being written, see follow(): index is extended on a file handle of
+	 * its own, so decoding does not lose its place, and that handle is brought right after the last frame
+	 * indexed, walking from the last indexed offset. Index grows, so it's a copy of the shared one, kept
+	 * to this input. Following is off if the file can't be opened again.
+	 *
+	 * @param p_abort		abort callback
+	 * @since				1.2.0
+	 */
+	void start_following(abort_callback & p_abort) {
+		service_ptr_t<file> file;
+		try {
+			filesystem::g_open_read(file, m_path, p_abort);
+		} catch (const exception_io & e) {
+			SPDLOG_DEBUG(log, "{}: not followed, {}", m_path.c_str(), e.what());
+			m_following = false;
+			return;
+		}
+		m_follow_reader.attach(file);
+		m_follow_reader.set_end(m_data_end);
+		m_follow_reader.set_resync(m_channels == 1);
+		m_follow_index = std::make_shared<amr_frame_index>(*m_index);
+		m_index = m_follow_index;
+		unsigned frame = 0;
+		t_filesize offset = m_start;
+		if (m_index->m_frames > 0) {
+			const t_size entry = (m_index->m_frames - 1) / amr_index_interval;
+			offset = m_index->m_offsets[entry];
+			frame = (unsigned)entry * amr_index_interval;
+		}
+		m_follow_reader.seek(offset, p_abort);
+		t_size size;
+		while (frame < m_index->m_frames && m_follow_reader.next_frames(m_block_size, m_channels, size, p_abort) != NULL) ++frame;
+	}
+
+	/**
+	 * Waits at the end of a file still being written for the frames written next, for decode_run(). Every
+	 * amr_follow_poll_ms the frames that appeared are added to the index, see index_frames(), and once
+	 * there are any, length grows by them, so they're decoded right away. Frame cut off by the end of file
+	 * is taken once it's written whole. File is taken as finished, and no longer followed, once nothing was
+	 * written for amr_follow_timeout_ms.
+	 *
+	 * @param p_abort		abort callback
+	 * @return				<code>true</code> if there are new frames to decode
+	 * @since				1.2.0
+	 */
+	bool follow(abort_callback & p_abort) {
+		/* level is estimated only when indexing from the start */
+		amr_loudness none;
+		pfc::hires_timer timer;
+		timer.start();
+		for (;;) {
+			index_frames(m_follow_reader, *m_follow_index, none, pfc::infinite32, p_abort);
+			if (m_index->m_frames > m_frames) {
+				m_frames = m_index->m_frames;
+				return true;
+			}
+			if (timer.query() * 1000 >= amr_follow_timeout_ms) break;
+			p_abort.sleep(amr_follow_poll_ms / 1000.0);
+		}
+		AMR_LOG_SUMMARY(log, "{}: followed to the end, {} frames", m_path.c_str(), m_frames);
+		m_follow_reader.attach(service_ptr_t<file>());
+		m_follow_index.reset();
+		m_following = false;
+		return false;
+	}
+
+	/**
+	 * Leaves decoders of a file played to its end for the file after it, if it's the next segment of a
+	 * recording, see amr_segment_handoff. They have to be in the state the last frame left them in, so
+	 * not behind, as when audio came from amr_pcm_cache, nor on another thread; last track of a file split
+	 * at pauses ends where the file does.
+	 *
+	 * @since				1.2.0
+	 */
+	void leave_decoders() {
+		if (!m_playback || m_decoders[0].get() == NULL || m_track_end != pfc::infinite32 || m_raw_mode || m_reverse || m_pcm_behind || m_parallel.is_active() || m_ahead.is_active() || !amr_segment_handoff::is_enabled()) return;
+		amr_segment_handoff::get().leave(m_path, m_decoders, m_channels, m_float_engine);
+	}
+
+	/* drops index being built in idle time, and its file handle */
+	void stop_indexing() {
+		m_idle_reader.attach(service_ptr_t<file>());
+		m_idle_index.reset();
+		m_idle_loudness.stop();
+		m_idle_indexing = false;
+	}
+
+	/**
+	 * Indexes next amr_idle_index_frames frames while playing, on its own file handle, so decoding does not
+	 * lose its place; once the index is complete it replaces the estimated length, see adopt_index().
+	 * Checkpoints are taken meanwhile, as long as decoding goes on from the first frame. No slice is indexed
+	 * while playback reads are slow, see amr_io_throttle.
+	 *
+	 * @param p_abort		abort callback
+	 * @since				1.2.0
+	 */
+	void index_on_idle(abort_callback & p_abort) {
+		/* playback reads are slow; the slice waits for another chunk rather than hold up this one */
+		if (amr_io_throttle::get().is_congested()) return;
+		try {
+			if (index_frames(m_idle_reader, m_idle_index, m_idle_loudness, amr_idle_index_frames, p_abort)) return;
+		} catch (const exception_io & e) {
+			/* decoding goes on as a stream; file that can't be read is going to fail there */
+			SPDLOG_DEBUG(log, "{}: indexing in idle time failed, {}", m_path.c_str(), e.what());
+			stop_indexing();
+			return;
+		}
+		adopt_index();
+		/* position is exact unless seek went to a guessed offset; then it's exact after the next seek */
+		if (m_exact) {
+			m_streaming = false;
+			start_ahead();
+		}
+	}
+
+	/* once the file was decoded through, puts the summary in the index, and caches it with the rest */
+	void finish_envelope() {
+		if (m_envelope_frame == pfc::infinite32 || m_envelope_frame == 0) return;
+		m_envelope.finish();
+		std::shared_ptr<amr_frame_index> index = std::make_shared<amr_frame_index>(*m_index);
+		index->m_envelope = m_envelope.get();
+		m_index = index;
+		m_envelope.reset();
+		m_envelope_frame = pfc::infinite32;
+		if (m_indexed) amr_index_cache::get().store(m_path, m_stats, m_index);
+		SPDLOG_DEBUG(log, "{}: summary of {} entries", m_path.c_str(), m_index->m_envelope.get_size() / 2);
+	}
+
+	/**
+	 * Once all frames were measured, puts ReplayGain in the index, caches it with the rest, and has foobar read
+	 * info of the file again, so it's in the database for the ReplayGain of playback and for title formatting.
+	 */
+	void finish_replaygain() {
+		if (m_replaygain_frame == pfc::infinite32 || m_replaygain_frame < end_frame()) return;
+		m_replaygain_frame = pfc::infinite32;
+		/* length of a file not indexed yet is an estimate, and so is where it ends */
+		if (!m_indexed) return;
+		std::shared_ptr<amr_frame_index> index = std::make_shared<amr_frame_index>(*m_index);
+		m_replaygain.finish(index->m_track_gain, index->m_track_peak);
+		m_replaygain.reset();
+		if (index->m_track_gain == amr_gain_none) return;
+		m_index = index;
+		amr_index_cache::get().store(m_path, m_stats, m_index);
+		main_thread_callback_spawn<amr_info_reload>(m_path);
+		AMR_LOG_SUMMARY(log, "{}: track gain {:.2f} dB, peak {:.6f}, measured when played", m_path.c_str(), m_index->m_track_gain / 100.0, m_index->m_track_peak / 65536.0);
+	}
+
+	/* index has everything preferences ask for; one made before they did lacks level or hash of a file that has frames */
+	bool is_complete(const amr_frame_index & p_index) const {
+		if (p_index.m_frames == 0) return true;
+		if (amr_loudness::is_enabled() && p_index.m_level_frames == 0) return false;
+		return !g_amr_content_hash.get() || p_index.m_hash != 0;
 	}
+
+	/**
+	 * Takes what index just built lacks from the index of a duplicate of the file, if one is cached; so far
+	 * that's the summary, which is made only by decoding the file through, see amr_index_cache::query_content().
+	 *
+	 * @param p_index		index just built, not shared yet
+	 * @since				1.2.0
+	 */
+	void adopt_duplicate(amr_frame_index & p_index) {
+		if (p_index.m_hash == 0) return;
+		pfc::string8 path;
+		const amr_frame_index_ptr found = amr_index_cache::get().query_content(p_index.m_hash, p_index.m_frames, path);
+		if (!found || path == m_path) return;
+		AMR_LOG_SUMMARY(log, "{}: same frames as {}", m_path.c_str(), path.c_str());
+		if (p_index.m_envelope.get_size() == 0) p_index.m_envelope = found->m_envelope;
+		if (p_index.m_track_gain == amr_gain_none) {
+			p_index.m_track_gain = found->m_track_gain;
+			p_index.m_track_peak = found->m_track_peak;
+		}
+	}
+
+	/* takes index built in idle time for the file's own, and caches it */
+	void adopt_index() {
+		m_idle_loudness.finish(m_idle_index);
+		std::shared_ptr<amr_frame_index> index = std::make_shared<amr_frame_index>(std::move(m_idle_index));
+		stop_indexing();
+		adopt_duplicate(*index);
+		m_index = index;
+		amr_index_cache::get().store(m_path, m_stats, m_index);
+		abort_callback_dummy abort;
+		write_sidecar(abort);
+		m_frames = m_index->m_frames;
+		m_indexed = true;
+		/* pauses of a file played from the start are skipped from here on */
+		find_skips();
+		m_skip = next_skip();
+		AMR_LOG_SUMMARY(log, "{}: indexed in idle time, {} frames, {} bad", m_path.c_str(), m_frames, m_index->m_bad);
+	}
+
+	/* index of files that can't seek is cached too, as long as their stats tell when they change; live streams have none */
+	bool is_cacheable() const {
+		return m_file->can_seek() || (m_stats.m_size != filesize_invalid && m_stats.m_timestamp != filetimestamp_invalid);
+	}
+
+	/**
+	 * Estimates length of a stream from the block open() read with the header: file size divided by average
+	 * size of the frames in it. Nothing more is read, so it's done for files that can't seek, as ones in
+	 * archives are; update_stream_length() improves on it as the stream is decoded.
+	 *
+	 * @param p_abort		abort callback
+	 * @return				estimated number of 20ms frames, or 0 if file size is not known or there are no whole frames
+	 * @since				1.2.0
+	 */
+	unsigned estimate_stream_length(abort_callback & p_abort) {
+		const t_filesize size = data_end(p_abort);
+		if (size == filesize_invalid || size <= m_start) return 0;
+		t_size left;
+		const t_uint8 * data = m_reader.get_buffered(left);
+		m_scanner.init(m_block_size);
+		const t_size bytes = m_scanner.scan(data, left, m_channels, amr_scan_max_frames, false);
+		if (bytes == 0) return 0;
+		return (unsigned)pfc::min_t<t_uint64>((size - m_start) * m_scanner.get_frames() / bytes, pfc::infinite32);
+	}
+
+	/**
+	 * Starts building the index of a stream from the frames decode_run() reads, so a file that can't be
+	 * scanned, as one in an archive or a remote one, is indexed once it's decoded through, see index_run().
+	 * Frames decoded on other threads are not seen here, nor are ones of a stream seeked in, so it's built
+	 * only if neither happens, and only if it can be cached; local file indexed in idle time needs none.
+	 *
+	 * @since				1.2.0
+	 */
+	void start_stream_index() {
+		m_stream_loudness.stop();
+		m_stream_indexing = m_streaming && !m_indexed && !m_idle_indexing && !m_verify && !m_parallel.is_active() && m_track_first == 0 && is_cacheable();
+		if (!m_stream_indexing) return;
+		m_stream_index.reset();
+		if (amr_loudness::is_enabled()) m_stream_loudness.start(m_channels);
+		if (g_amr_content_hash.get()) m_stream_index.m_hash = amr_hash_start(m_channels);
+	}
+
+	/**
+	 * Adds frames decode_run() just read to the index of the stream; run of single channel frames
+	 * is walked frame by frame, multichannel files are read a 20ms frame at a time anyway.
+	 *
+	 * @param p_run			frames, which end where the reader is
+	 * @param p_size		bytes of them
+	 * @param p_frames		number of 20ms frames
+	 * @since				1.2.0
+	 */
+	void index_run(const t_uint8 * p_run, t_size p_size, unsigned p_frames) {
+		t_filesize offset = m_reader.get_offset() - p_size;
+		for (unsigned f = 0; f < p_frames; ++f) {
+			const t_size size = p_frames == 1 ? p_size : 1 + m_block_size[(p_run[0] >> 3) & 0x0F];
+			index_frame(m_stream_index, m_stream_loudness, p_run, size, offset);
+			p_run += size;
+			offset += size;
+		}
+	}
+
+	/* takes index of the stream decoded through for the file's own, and caches it; there's no sidecar next to a file in an archive */
+	void adopt_stream_index() {
+		m_stream_loudness.finish(m_stream_index);
+		std::shared_ptr<amr_frame_index> index = std::make_shared<amr_frame_index>(std::move(m_stream_index));
+		m_stream_index.reset();
+		m_stream_indexing = false;
+		adopt_duplicate(*index);
+		m_index = index;
+		amr_index_cache::get().store(m_path, m_stats, m_index);
+		m_frames = m_index->m_frames;
+		m_indexed = true;
+		AMR_LOG_SUMMARY(log, "{}: indexed as streamed, {} frames, {} bad", m_path.c_str(), m_frames, m_index->m_bad);
+	}
+
+	/**
+	 * Moves to a frame near p_frame in file with no index. Its offset is guessed from average frame
+	 * size, and the first frame boundary after that is where amr_resync_frames frames with valid headers
+	 * in a row start, see amr_frame_reader::find_run(). m_frame is set to p_frame, but the frame actually found may be a few off.
+	 * 
+	 * @param p_frame		frame to move to
+	 * @param p_abort		abort callback
+	 * @throws				exception_io_object_not_seekable if file size is not known
+	 * @since				1.2.0
+	 */
+	void seek_estimated(unsigned p_frame, abort_callback & p_abort) {
+		const t_filesize size = data_end(p_abort);
+		if (size == filesize_invalid) throw exception_io_object_not_seekable();
+		/* frames decoded so far tell average size best, estimated length is the next best thing */
+		double average = amr_max_frame_size * m_channels;
+		if (m_stream_frames > 0) average = (double)m_stream_bytes / m_stream_frames;
+		else if (m_frames > 0) average = (double)(size - m_start) / m_frames;
+		const t_filesize offset = pfc::min_t<t_filesize>(m_start + (t_filesize)(p_frame * average), size);
+
+		pfc::array_t<t_uint8> block;
+		block.set_size(amr_resync_window);
+		m_file->seek(offset, p_abort);
+		const t_size read = m_file->read(block.get_ptr(), amr_resync_window, p_abort);
+		const t_size first = amr_frame_reader::find_run(block.get_ptr(), read, m_block_size, true);
+		SPDLOG_DEBUG(log, "Estimated offset of frame {}: {}, frames found {} bytes further", p_frame, offset, first);
+
+		/* nothing that looks like frames there is taken for the end of file */
+		m_reader.seek(first < read ? offset + first : size, p_abort);
+		m_frame = p_frame;
+		m_stream_end = false;
+	}
+
+	/**
+	 * Estimates stream length from its size and average size of frames decoded so far, or
+	 * sets the exact one once the stream ended, or once its index was built. Size of live streams is unknown, and so is their length.
+	 * 
+	 * @param p_abort		abort callback
+	 * @since				1.2.0
+	 */
+	void update_stream_length(abort_callback & p_abort) {
+		/* index built in idle time has it exact, or soon will; estimate taken on open will do until then */
+		if (m_indexed) return;
+		if (m_stream_end) {
+			m_frames = m_frame;
+			return;
+		}
+		if (m_idle_indexing) return;
+		if (m_stream_frames == 0) return;
+		const t_filesize size = data_end(p_abort);
+		if (size == filesize_invalid || size <= m_start) return;
+		const t_uint64 estimate = (size - m_start) * m_stream_frames / m_stream_bytes;
+		m_frames = (unsigned)pfc::min_t<t_uint64>(pfc::max_t<t_uint64>(estimate, m_frame), pfc::infinite32);
+	}
+
+	/**
+	 * Creates the logger on first use. Debug builds log everything, synchronously. Release builds
+	 * get one only if g_amr_log is on; it takes summaries only and writes them on its own thread,
+	 * so decoding never waits for the disk.
+	 *
+	 * @since				1.1.0
+	 */
+	static void ensure_log_exists() {
+		/* local static is initialized once even if several threads get here at the same time */
+		static const bool created = [] {
+#ifndef _DEBUG
+			if (!g_amr_log.get()) return false;
+#endif
+			pfc::string8 tempPath;
+			if (!uGetTempPath(tempPath)) return false;
+			tempPath.add_filename("foo_input_amr.txt");
+			try {
 #ifdef _DEBUG
-	static std::shared_ptr<spdlog::logger> log;
+				log = spdlog::basic_logger_mt("amr", tempPath.c_str());
+				log->set_level(spdlog::level::trace);
+#else
+				spdlog::set_async_mode(amr_log_queue_size, spdlog::async_overflow_policy::discard_log_msg);
+				log = spdlog::basic_logger_mt("amr", tempPath.c_str());
+				log->set_level(spdlog::level::info);
 #endif
+			} catch (std::exception const &) {
+				/* no log is better than no decoder */
+				return false;
+			}
+			return true;
+		}();
+		(void)created;
+	}
+
+public:
+	/* flushes and closes the log, while its thread can still be joined */
+	static void close_log() {
+		log.reset();
+		spdlog::drop_all();
+	}
+
+private:
+	/* null if not logging */
+	static std::shared_ptr<spdlog::logger> log;
 };
 
 /**
@@ -364,22 +2960,66 @@ private:
  * (codec mode request), values 0-7 are valid for AMR. Each mode have different frame size. 
  * This table reflects that fact.
 */
-short input_amr::m_block_size[] =  { 12, 13, 15, 17, 19, 20, 26, 31, 5, 0, 0, 0, 0, 0, 0, 0 };
+const short * const input_amr::m_block_size = Decoder_Interface_block_size;
 /* each AMR-NB file consists of following 6-byte header */
 const char* input_amr::m_magic = "#!AMR\x0a";
-/* AMR frames start at 7-th byte */
-const unsigned input_amr::m_start = 7;
-#ifdef _DEBUG
+/* or this one, if it's multichannel */
+const char* input_amr::m_magic_mc = "#!AMR_MC1.0\x0a";
+/**
+ * Channel order of multichannel files is that of RFC 3551: left, right and center for 3 channels,
+ * left, center, right and surround for 4, front left, front right, front center, surround left and
+ * surround right for 5, and left, left center, center, right, right center and surround for 6.
+ */
+const input_amr::channel_layout input_amr::m_layouts[] = {
+	{ 0, { 0 } },
+	{ audio_chunk::channel_config_mono, { 0 } },
+	{ audio_chunk::channel_config_stereo, { 0, 1 } },
+	{ audio_chunk::channel_front_left | audio_chunk::channel_front_right | audio_chunk::channel_front_center, { 0, 1, 2 } },
+	{ audio_chunk::channel_front_left | audio_chunk::channel_front_right | audio_chunk::channel_front_center | audio_chunk::channel_back_center, { 0, 2, 1, 3 } },
+	{ audio_chunk::channel_front_left | audio_chunk::channel_front_right | audio_chunk::channel_front_center | audio_chunk::channel_back_left | audio_chunk::channel_back_right, { 0, 1, 2, 3, 4 } },
+	{ audio_chunk::channel_front_left | audio_chunk::channel_front_right | audio_chunk::channel_front_center | audio_chunk::channel_front_center_left | audio_chunk::channel_front_center_right | audio_chunk::channel_back_center, { 0, 3, 2, 1, 4, 5 } },
+};
 std::shared_ptr<spdlog::logger> input_amr::log;
-#endif
+
+bool amr_preindex_file(const char * p_path, abort_callback & p_abort, amr_preindex_info * p_info) {
+	input_amr input;
+	return input.preindex(p_path, p_abort, p_info);
+}
+
+void amr_find_frames(const char * p_path, t_uint32 p_subsong, amr_frame_range & p_out, abort_callback & p_abort) {
+	input_amr input;
+	input.find_frames(p_path, p_subsong, p_out, p_abort);
+}
+
+void amr_find_activity(const char * p_path, pfc::list_t<amr_activity_segment> & p_out, abort_callback & p_abort) {
+	input_amr input;
+	input.find_activity(p_path, p_out, p_abort);
+}
+
+void amr_find_stats(const char * p_path, amr_file_stats & p_out, abort_callback & p_abort) {
+	input_amr input;
+	input.find_stats(p_path, p_out, p_abort);
+}
+
+/* release logger writes on a thread of its own, which has to end before the component is unloaded */
+class input_amr_initquit : public initquit {
+public:
+	void on_quit() { input_amr::close_log(); }
+};
+
+static initquit_factory_t<input_amr_initquit> g_input_amr_initquit;
 
 /**
  * plugin factory 
  * @{
  */
-static input_singletrack_factory_t<input_amr> g_input_amr_factory;
+static input_factory_t<input_amr> g_input_amr_factory;
 DECLARE_COMPONENT_VERSION("AMR input","1.1.3","https://github.com/unjello/foo_input_amr/; 2003-2018: Andrzej Lichnerowicz, Quang Nguyen\nPowered GSM AMR-NB speech codec\n(c) 2001, 3gpp");
 DECLARE_FILE_TYPE("Adaptive Multirate files","*.AMR");
 /**
  * @}
- */
\ No newline at end of file
+ */
+
+void amr_open_decoder(service_ptr_t<input_decoder> & p_out, const char * p_path, abort_callback & p_abort) {
+	g_input_amr_factory.get_static_instance().open_for_decoding(p_out, NULL, p_path, p_abort);
+}
\ No newline at end of file
@@ -55,7 +55,7 @@ namespace {
 	class tfhook_sort : public titleformat_hook {
 	public:
 		tfhook_sort() {
-			m_API->seed((unsigned)__rdtsc());
+			m_API->seed((unsigned)pfc::fileTimeNow());
 		}
 		bool process_field(titleformat_text_out * p_out,const char * p_name,t_size p_name_length,bool & p_found_flag) {
 			return false;
@@ -86,7 +86,7 @@ namespace pfc {
 
 #ifdef _MSC_VER
 
-#if defined(_M_IX86) || defined(_M_X64) || defined(_M_ARM)
+#if defined(_M_IX86) || defined(_M_X64) || defined(_M_ARM) || defined(_M_ARM64)
 #define PFC_BYTE_ORDER_IS_BIG_ENDIAN 0
 #endif
 
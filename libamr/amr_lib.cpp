@@ -0,0 +1,814 @@
+/**
+ * libamr - AMR-NB decoding without foobar2000, for servers and other players
+*/
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <vector>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+extern "C" {
+	#include "../3gpp/interf_dec.h"
+}
+#include "amr_lib.h"
+
+enum {
+	/* as in input_amr */
+	amr_lib_magic_size = 6,
+	amr_lib_mc_magic_size = 12,
+	amr_lib_mc_header_size = amr_lib_mc_magic_size + 4,
+	/* frames with valid headers in a row that damaged data is taken to end at, as in amr_frame_reader */
+	amr_lib_resync_frames = 8,
+	/* frames decoded without output before seek target, as input_amr does by default */
+	amr_lib_seek_warmup_frames = 16,
+	/* bytes read from a file or source at a time */
+	amr_lib_read_block = 64 * 1024,
+	/* largest storage format frame, header and MR122 data */
+	amr_lib_max_frame = 32,
+	/* frames a scheduler worker decodes side by side at most, as Decoder_Interface_Decode_group_float unpacks them */
+	amr_lib_max_batch = 16,
+	/* bytes asked of an async source at a time, and frames of a stream queued and not decoded, a second, below which it's asked for more */
+	amr_lib_async_block = 4 * 1024,
+	amr_lib_async_ahead_frames = 50,
+};
+
+static const char g_magic[] = "#!AMR\x0a";
+static const char g_magic_mc[] = "#!AMR_MC1.0\x0a";
+
+
+struct amr_lib_file {
+	/* the file, in m_owned unless it was opened from memory */
+	std::vector<unsigned char> m_owned;
+	const unsigned char * m_data;
+	size_t m_size;
+	unsigned m_channels;
+	/* offset of each frame, of its first channel in multichannel files */
+	std::vector<size_t> m_frames;
+	void * m_decoders[AMR_LIB_MAX_CHANNELS];
+	/* frame decoded next, and samples of it left out, those before seek target */
+	size_t m_next;
+	unsigned m_skip;
+	/* a frame of one channel, for interleaving and for frames partly left out */
+	short m_channel[AMR_LIB_FRAME_SAMPLES];
+	float m_channel_float[AMR_LIB_FRAME_SAMPLES];
+	unsigned char m_channel_g711[AMR_LIB_FRAME_SAMPLES];
+	/* 16-bit output of amr_lib_decode_tee, written to its outputs */
+	std::vector<short> m_tee;
+};
+
+/* feature flags for Decoder_Interface_select_kernels, as detected on this CPU, as in amr2wav */
+static int amr_lib_cpu_features() {
+#if defined(__SSE2__) || defined(_M_X64)
+	return DEC_CPU_SSE2;
+#elif defined(_MSC_VER) && defined(_M_IX86)
+	int info[4];
+	__cpuid(info, 1);
+	return (info[3] & (1 << 26)) != 0 ? DEC_CPU_SSE2 : 0;
+#elif defined(__aarch64__) || defined(_M_ARM64)
+	return DEC_CPU_NEON;
+#else
+	return 0;
+#endif
+}
+
+/* kernels are chosen once for all decoders of the process, before the first one is created */
+static void amr_lib_select_kernels() {
+	static const bool selected = (Decoder_Interface_select_kernels(amr_lib_cpu_features()), true);
+	(void)selected;
+}
+
+/* valid storage format frame header, see amr_frame_reader::is_frame_header() */
+static bool amr_lib_is_header(unsigned char p_byte) {
+	const unsigned ft = (p_byte >> 3) & 0x0F;
+	return (p_byte & 0x83) == 0 && (ft < 9 || ft == 15);
+}
+
+/* p_data starts with amr_lib_resync_frames frames with valid headers, or frames up to its very end */
+static bool amr_lib_is_run(const unsigned char * p_data, size_t p_size) {
+	size_t pos = 0;
+	unsigned frames = 0;
+	for (; frames < amr_lib_resync_frames && pos < p_size; ++frames) {
+		if (!amr_lib_is_header(p_data[pos])) return false;
+		pos += 1 + Decoder_Interface_block_size[(p_data[pos] >> 3) & 0x0F];
+	}
+	return frames == amr_lib_resync_frames ? pos <= p_size : pos == p_size;
+}
+
+/* where frames start again in damaged data, see amr_frame_reader::find_run(); p_size if they don't */
+static size_t amr_lib_find_run(const unsigned char * p_data, size_t p_size) {
+	for (size_t i = 0; i < p_size; ++i) {
+		if ((p_data[i] & 0x87) == 0x04 && amr_lib_is_run(p_data + i, p_size - i)) return i;
+	}
+	return p_size;
+}
+
+/**
+ * Checks the header and indexes the frames of p_file, whose data is set, and creates its decoders.
+ * Frames of a multichannel file are one frame of each channel in a row, and the last one not all
+ * of whose channels are there is left out, as input_amr does.
+ */
+static int amr_lib_index(amr_lib_file * p_file) {
+	const unsigned char * data = p_file->m_data;
+	const size_t size = p_file->m_size;
+	size_t pos;
+	if (size >= amr_lib_magic_size && memcmp(data, g_magic, amr_lib_magic_size) == 0) {
+		p_file->m_channels = 1;
+		pos = amr_lib_magic_size;
+	}
+	else if (size >= amr_lib_mc_header_size && memcmp(data, g_magic_mc, amr_lib_mc_magic_size) == 0) {
+		p_file->m_channels = data[amr_lib_mc_header_size - 1] & 0x0F;
+		pos = amr_lib_mc_header_size;
+		if (p_file->m_channels == 0 || p_file->m_channels > AMR_LIB_MAX_CHANNELS) return AMR_LIB_ERROR_FORMAT;
+	}
+	else return AMR_LIB_ERROR_FORMAT;
+
+	while (pos < size) {
+		if (p_file->m_channels == 1 && !amr_lib_is_header(data[pos])) {
+			pos += 1 + amr_lib_find_run(data + pos + 1, size - pos - 1);
+			continue;
+		}
+		size_t end = pos;
+		unsigned c = 0;
+		for (; c < p_file->m_channels && end < size; ++c) end += 1 + Decoder_Interface_block_size[(data[end] >> 3) & 0x0F];
+		if (c < p_file->m_channels || end > size) break;
+		p_file->m_frames.push_back(pos);
+		pos = end;
+	}
+
+	amr_lib_select_kernels();
+	for (unsigned c = 0; c < p_file->m_channels; ++c) {
+		p_file->m_decoders[c] = Decoder_Interface_init();
+		if (p_file->m_decoders[c] == NULL) return AMR_LIB_ERROR_MEMORY;
+	}
+	return AMR_LIB_OK;
+}
+
+/* handle of given data, or error; frees the handle if it fails */
+static int amr_lib_open(amr_lib_file * p_file, amr_lib_file ** p_out) {
+	int result;
+	try {
+		result = amr_lib_index(p_file);
+	} catch (std::bad_alloc const &) {
+		result = AMR_LIB_ERROR_MEMORY;
+	}
+	if (result != AMR_LIB_OK) {
+		amr_lib_close(p_file);
+		p_file = NULL;
+	}
+	*p_out = p_file;
+	return result;
+}
+
+static amr_lib_file * amr_lib_new() {
+	amr_lib_file * file = new (std::nothrow) amr_lib_file;
+	if (file == NULL) return NULL;
+	file->m_data = NULL;
+	file->m_size = 0;
+	file->m_channels = 0;
+	for (unsigned c = 0; c < AMR_LIB_MAX_CHANNELS; ++c) file->m_decoders[c] = NULL;
+	file->m_next = 0;
+	file->m_skip = 0;
+	return file;
+}
+
+int amr_lib_open_memory(const void * data, size_t size, amr_lib_file ** out) {
+	if (out == NULL) return AMR_LIB_ERROR_ARGUMENT;
+	*out = NULL;
+	if (data == NULL && size > 0) return AMR_LIB_ERROR_ARGUMENT;
+	amr_lib_file * file = amr_lib_new();
+	if (file == NULL) return AMR_LIB_ERROR_MEMORY;
+	file->m_data = static_cast<const unsigned char *>(data);
+	file->m_size = size;
+	return amr_lib_open(file, out);
+}
+
+int amr_lib_open_file(const char * path, amr_lib_file ** out) {
+	if (out == NULL) return AMR_LIB_ERROR_ARGUMENT;
+	*out = NULL;
+	if (path == NULL) return AMR_LIB_ERROR_ARGUMENT;
+	FILE * in = fopen(path, "rb");
+	if (in == NULL) return AMR_LIB_ERROR_IO;
+	amr_lib_file * file = amr_lib_new();
+	if (file == NULL) {
+		fclose(in);
+		return AMR_LIB_ERROR_MEMORY;
+	}
+	bool ok = true;
+	try {
+		size_t got;
+		do {
+			const size_t size = file->m_owned.size();
+			file->m_owned.resize(size + amr_lib_read_block);
+			got = fread(file->m_owned.data() + size, 1, amr_lib_read_block, in);
+			file->m_owned.resize(size + got);
+		} while (got == amr_lib_read_block);
+		ok = ferror(in) == 0;
+	} catch (std::bad_alloc const &) {
+		fclose(in);
+		amr_lib_close(file);
+		return AMR_LIB_ERROR_MEMORY;
+	}
+	fclose(in);
+	if (!ok) {
+		amr_lib_close(file);
+		return AMR_LIB_ERROR_IO;
+	}
+	file->m_data = file->m_owned.data();
+	file->m_size = file->m_owned.size();
+	return amr_lib_open(file, out);
+}
+
+int amr_lib_open_source(const amr_lib_source * source, amr_lib_file ** out) {
+	if (out == NULL) return AMR_LIB_ERROR_ARGUMENT;
+	*out = NULL;
+	if (source == NULL || source->read == NULL) return AMR_LIB_ERROR_ARGUMENT;
+	amr_lib_file * file = amr_lib_new();
+	if (file == NULL) return AMR_LIB_ERROR_MEMORY;
+	try {
+		for (;;) {
+			const size_t size = file->m_owned.size();
+			file->m_owned.resize(size + amr_lib_read_block);
+			const long got = source->read(source->user, size, file->m_owned.data() + size, amr_lib_read_block);
+			if (got < 0 || got > amr_lib_read_block) {
+				amr_lib_close(file);
+				return AMR_LIB_ERROR_IO;
+			}
+			file->m_owned.resize(size + got);
+			if (got == 0) break;
+		}
+	} catch (std::bad_alloc const &) {
+		amr_lib_close(file);
+		return AMR_LIB_ERROR_MEMORY;
+	}
+	file->m_data = file->m_owned.data();
+	file->m_size = file->m_owned.size();
+	return amr_lib_open(file, out);
+}
+
+void amr_lib_close(amr_lib_file * file) {
+	if (file == NULL) return;
+	for (unsigned c = 0; c < AMR_LIB_MAX_CHANNELS; ++c) if (file->m_decoders[c] != NULL) Decoder_Interface_exit(file->m_decoders[c]);
+	delete file;
+}
+
+unsigned amr_lib_channels(const amr_lib_file * file) {
+	return file != NULL ? file->m_channels : 0;
+}
+
+unsigned long long amr_lib_length(const amr_lib_file * file) {
+	return file != NULL ? (unsigned long long)file->m_frames.size() * AMR_LIB_FRAME_SAMPLES : 0;
+}
+
+/* brings p_decoders, reset, to the state they'd be in by decoding up to frame p_target, without output */
+static void amr_lib_warm_up(const amr_lib_file * p_file, void * const * p_decoders, size_t p_target) {
+	const size_t start = p_target > amr_lib_seek_warmup_frames ? p_target - amr_lib_seek_warmup_frames : 0;
+	for (size_t f = start; f < p_target; ++f) {
+		size_t pos = p_file->m_frames[f];
+		for (unsigned c = 0; c < p_file->m_channels; ++c) {
+			Decoder_Interface_Warmup(p_decoders[c], const_cast<unsigned char *>(p_file->m_data + pos), 0);
+			pos += 1 + Decoder_Interface_block_size[(p_file->m_data[pos] >> 3) & 0x0F];
+		}
+	}
+}
+
+int amr_lib_seek(amr_lib_file * file, unsigned long long sample) {
+	if (file == NULL || sample > amr_lib_length(file)) return AMR_LIB_ERROR_ARGUMENT;
+	const size_t target = (size_t)(sample / AMR_LIB_FRAME_SAMPLES);
+	for (unsigned c = 0; c < file->m_channels; ++c) Decoder_Interface_reset(file->m_decoders[c]);
+	amr_lib_warm_up(file, file->m_decoders, target);
+	file->m_next = target;
+	file->m_skip = (unsigned)(sample % AMR_LIB_FRAME_SAMPLES);
+	return AMR_LIB_OK;
+}
+
+int amr_lib_decode_range(const amr_lib_file * file, unsigned long long start, unsigned long long end, short * out, unsigned long long * samples) {
+	if (file == NULL || samples == NULL || start > end || end > amr_lib_length(file) || (out == NULL && end > start)) return AMR_LIB_ERROR_ARGUMENT;
+	*samples = 0;
+	const unsigned channels = file->m_channels;
+	void * decoders[AMR_LIB_MAX_CHANNELS] = {};
+	int result = AMR_LIB_OK;
+	for (unsigned c = 0; c < channels && result == AMR_LIB_OK; ++c) {
+		decoders[c] = Decoder_Interface_init();
+		if (decoders[c] == NULL) result = AMR_LIB_ERROR_MEMORY;
+	}
+	if (result == AMR_LIB_OK) {
+		const size_t first = (size_t)(start / AMR_LIB_FRAME_SAMPLES);
+		const size_t last = (size_t)((end + AMR_LIB_FRAME_SAMPLES - 1) / AMR_LIB_FRAME_SAMPLES);
+		amr_lib_warm_up(file, decoders, first);
+		short channel[AMR_LIB_FRAME_SAMPLES];
+		unsigned long long written = 0;
+		for (size_t f = first; f < last; ++f) {
+			/* samples of the frame within the range */
+			const unsigned long long at = (unsigned long long)f * AMR_LIB_FRAME_SAMPLES;
+			const unsigned from = start > at ? (unsigned)(start - at) : 0;
+			const unsigned to = end < at + AMR_LIB_FRAME_SAMPLES ? (unsigned)(end - at) : (unsigned)AMR_LIB_FRAME_SAMPLES;
+			size_t pos = file->m_frames[f];
+			for (unsigned c = 0; c < channels; ++c) {
+				unsigned char * frame = const_cast<unsigned char *>(file->m_data + pos);
+				pos += 1 + Decoder_Interface_block_size[(frame[0] >> 3) & 0x0F];
+				Decoder_Interface_Decode(decoders[c], frame, channel, 0);
+				short * dst = out + written * channels + c;
+				for (unsigned j = from; j < to; ++j) dst[(size_t)(j - from) * channels] = channel[j];
+			}
+			written += to - from;
+		}
+		*samples = written;
+	}
+	for (unsigned c = 0; c < channels; ++c) if (decoders[c] != NULL) Decoder_Interface_exit(decoders[c]);
+	return result;
+}
+
+/* decodes up to p_frames frames to p_out, interleaved; t_sample is short, float, or unsigned char of G.711 */
+template<typename t_sample>
+static int amr_lib_decode_t(amr_lib_file * p_file, unsigned p_frames, t_sample * p_out, unsigned * p_samples,
+		void (*p_decode)(void *, unsigned char *, t_sample *, int), t_sample * p_channel) {
+	if (p_file == NULL || p_samples == NULL || (p_out == NULL && p_frames > 0)) return AMR_LIB_ERROR_ARGUMENT;
+	const unsigned channels = p_file->m_channels;
+	unsigned samples = 0;
+	for (unsigned i = 0; i < p_frames && p_file->m_next < p_file->m_frames.size(); ++i, ++p_file->m_next) {
+		size_t pos = p_file->m_frames[p_file->m_next];
+		const unsigned skip = p_file->m_skip;
+		const unsigned count = AMR_LIB_FRAME_SAMPLES - skip;
+		for (unsigned c = 0; c < channels; ++c) {
+			unsigned char * frame = const_cast<unsigned char *>(p_file->m_data + pos);
+			pos += 1 + Decoder_Interface_block_size[(frame[0] >> 3) & 0x0F];
+			/* whole frames of a single channel go right to the output */
+			if (channels == 1 && skip == 0) {
+				p_decode(p_file->m_decoders[0], frame, p_out + samples, 0);
+				continue;
+			}
+			p_decode(p_file->m_decoders[c], frame, p_channel, 0);
+			t_sample * out = p_out + (size_t)samples * channels + c;
+			for (unsigned j = 0; j < count; ++j) out[(size_t)j * channels] = p_channel[skip + j];
+		}
+		p_file->m_skip = 0;
+		samples += count;
+	}
+	*p_samples = samples;
+	return AMR_LIB_OK;
+}
+
+int amr_lib_decode(amr_lib_file * file, unsigned frames, short * out, unsigned * samples) {
+	return amr_lib_decode_t<short>(file, frames, out, samples, Decoder_Interface_Decode, file != NULL ? file->m_channel : NULL);
+}
+
+int amr_lib_decode_float(amr_lib_file * file, unsigned frames, float * out, unsigned * samples) {
+	return amr_lib_decode_t<float>(file, frames, out, samples, Decoder_Interface_Decode_float, file != NULL ? file->m_channel_float : NULL);
+}
+
+/* decoding to G.711 of each law, as amr_lib_decode_t calls it */
+static void amr_lib_decode_alaw(void * p_decoder, unsigned char * p_bits, unsigned char * p_out, int p_bfi) {
+	Decoder_Interface_Decode_g711(p_decoder, p_bits, p_out, DEC_G711_ALAW, p_bfi);
+}
+
+static void amr_lib_decode_ulaw(void * p_decoder, unsigned char * p_bits, unsigned char * p_out, int p_bfi) {
+	Decoder_Interface_Decode_g711(p_decoder, p_bits, p_out, DEC_G711_ULAW, p_bfi);
+}
+
+int amr_lib_decode_g711(amr_lib_file * file, unsigned frames, int law, unsigned char * out, unsigned * samples) {
+	if (law != AMR_LIB_G711_ALAW && law != AMR_LIB_G711_ULAW) return AMR_LIB_ERROR_ARGUMENT;
+	return amr_lib_decode_t<unsigned char>(file, frames, out, samples, law == AMR_LIB_G711_ALAW ? amr_lib_decode_alaw : amr_lib_decode_ulaw,
+		file != NULL ? file->m_channel_g711 : NULL);
+}
+
+int amr_lib_decode_tee(amr_lib_file * file, unsigned frames, const amr_lib_output * outputs, unsigned count, unsigned * samples) {
+	if (file == NULL || samples == NULL || (outputs == NULL && count > 0)) return AMR_LIB_ERROR_ARGUMENT;
+	/* 16-bit output, if there's one, is decoded to right away */
+	short * pcm = NULL;
+	for (unsigned i = 0; i < count; ++i) {
+		if (outputs[i].format < AMR_LIB_OUTPUT_PCM16 || outputs[i].format > AMR_LIB_OUTPUT_ULAW || (outputs[i].out == NULL && frames > 0)) return AMR_LIB_ERROR_ARGUMENT;
+		if (outputs[i].format == AMR_LIB_OUTPUT_PCM16 && pcm == NULL) pcm = static_cast<short *>(outputs[i].out);
+	}
+	if (pcm == NULL) {
+		try {
+			file->m_tee.resize((size_t)frames * AMR_LIB_FRAME_SAMPLES * file->m_channels);
+		} catch (std::bad_alloc const &) {
+			return AMR_LIB_ERROR_MEMORY;
+		}
+		pcm = file->m_tee.data();
+	}
+	const int result = amr_lib_decode_t<short>(file, frames, pcm, samples, Decoder_Interface_Decode, file->m_channel);
+	if (result != AMR_LIB_OK) return result;
+
+	const size_t total = (size_t)*samples * file->m_channels;
+	for (unsigned i = 0; i < count; ++i) {
+		void * out = outputs[i].out;
+		switch (outputs[i].format) {
+		case AMR_LIB_OUTPUT_PCM16:
+			if (out != pcm) memcpy(out, pcm, total * sizeof(short));
+			break;
+		case AMR_LIB_OUTPUT_FLOAT:
+			for (size_t j = 0; j < total; ++j) static_cast<float *>(out)[j] = pcm[j] * (1.0f / 32768);
+			break;
+		default:
+			Decoder_Interface_Code_g711(pcm, static_cast<unsigned char *>(out), (int)total, outputs[i].format == AMR_LIB_OUTPUT_ALAW ? DEC_G711_ALAW : DEC_G711_ULAW);
+			break;
+		}
+	}
+	return AMR_LIB_OK;
+}
+
+
+/* frame of a live stream waiting to be decoded */
+struct amr_lib_pending {
+	unsigned long long m_deadline;
+	unsigned char m_frame[amr_lib_max_frame];
+};
+
+struct amr_lib_stream {
+	amr_lib_scheduler * m_scheduler;
+	amr_lib_frame_ready m_ready;
+	void * m_user;
+	void * m_decoder;
+	/* frames queued, by the scheduler's lock */
+	std::deque<amr_lib_pending> m_frames;
+	/* taken by a worker, which decodes its first frame */
+	bool m_busy;
+	bool m_closing;
+};
+
+/**
+ * Streams with frames queued and not taken by a worker are kept in m_ready, a heap by the deadline of their
+ * first frame; that frame stays first until a worker takes the stream out, so its place in the heap holds.
+ */
+struct amr_lib_scheduler {
+	std::mutex m_lock;
+	/* workers wait for frames, closing streams for workers done with them */
+	std::condition_variable m_wake;
+	std::condition_variable m_idle;
+	std::vector<amr_lib_stream *> m_ready;
+	std::vector<std::thread> m_threads;
+	unsigned long long m_window;
+	bool m_stopping;
+	amr_lib_scheduler_stats m_stats;
+};
+
+/* order of m_ready: stream whose first frame is due first on top */
+static bool amr_lib_due_later(const amr_lib_stream * p_a, const amr_lib_stream * p_b) {
+	return p_a->m_frames.front().m_deadline > p_b->m_frames.front().m_deadline;
+}
+
+unsigned long long amr_lib_clock(void) {
+	return (unsigned long long)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * Worker: takes the stream due first and those due within the batch window after it, decodes a frame of each
+ * side by side, hands them out, and puts streams with more frames back.
+ */
+static void amr_lib_schedule(amr_lib_scheduler * p_scheduler) {
+	amr_lib_stream * streams[amr_lib_max_batch];
+	void * decoders[amr_lib_max_batch];
+	amr_lib_pending frames[amr_lib_max_batch];
+	unsigned char * bits[amr_lib_max_batch];
+	float synth[amr_lib_max_batch][AMR_LIB_FRAME_SAMPLES];
+	float * out[amr_lib_max_batch];
+	for (unsigned i = 0; i < amr_lib_max_batch; ++i) {
+		bits[i] = frames[i].m_frame;
+		out[i] = synth[i];
+	}
+	std::unique_lock<std::mutex> lock(p_scheduler->m_lock);
+	std::vector<amr_lib_stream *> & ready = p_scheduler->m_ready;
+	for (;;) {
+		while (!p_scheduler->m_stopping && ready.empty()) p_scheduler->m_wake.wait(lock);
+		if (p_scheduler->m_stopping) return;
+
+		unsigned count = 0;
+		const unsigned long long limit = ready.front()->m_frames.front().m_deadline + p_scheduler->m_window;
+		while (count < amr_lib_max_batch && !ready.empty() && ready.front()->m_frames.front().m_deadline <= limit) {
+			std::pop_heap(ready.begin(), ready.end(), amr_lib_due_later);
+			amr_lib_stream * stream = ready.back();
+			ready.pop_back();
+			stream->m_busy = true;
+			frames[count] = stream->m_frames.front();
+			stream->m_frames.pop_front();
+			decoders[count] = stream->m_decoder;
+			streams[count++] = stream;
+		}
+		lock.unlock();
+
+		Decoder_Interface_Decode_group_float(decoders, (int)count, bits, out, 1, 0);
+		const unsigned long long now = amr_lib_clock();
+		unsigned missed = 0;
+		unsigned long long worst = 0;
+		for (unsigned i = 0; i < count; ++i) {
+			const unsigned long long late = now > frames[i].m_deadline ? now - frames[i].m_deadline : 0;
+			if (late > 0) ++missed;
+			if (late > worst) worst = late;
+			streams[i]->m_ready(streams[i]->m_user, synth[i], late);
+		}
+
+		lock.lock();
+		amr_lib_scheduler_stats & stats = p_scheduler->m_stats;
+		stats.frames += count;
+		++stats.batches;
+		stats.missed += missed;
+		if (worst > stats.worst_late) stats.worst_late = worst;
+		bool closed = false;
+		for (unsigned i = 0; i < count; ++i) {
+			amr_lib_stream * stream = streams[i];
+			stream->m_busy = false;
+			if (stream->m_closing) closed = true;
+			else if (!stream->m_frames.empty()) {
+				ready.push_back(stream);
+				std::push_heap(ready.begin(), ready.end(), amr_lib_due_later);
+			}
+		}
+		if (closed) p_scheduler->m_idle.notify_all();
+		if (ready.size() > 1) p_scheduler->m_wake.notify_one();
+	}
+}
+
+int amr_lib_scheduler_create(unsigned threads, unsigned long long batch_window, amr_lib_scheduler ** out) {
+	if (out == NULL) return AMR_LIB_ERROR_ARGUMENT;
+	*out = NULL;
+	amr_lib_scheduler * scheduler = new (std::nothrow) amr_lib_scheduler;
+	if (scheduler == NULL) return AMR_LIB_ERROR_MEMORY;
+	scheduler->m_window = batch_window;
+	scheduler->m_stopping = false;
+	memset(&scheduler->m_stats, 0, sizeof(scheduler->m_stats));
+	if (threads == 0) threads = std::thread::hardware_concurrency();
+	if (threads == 0) threads = 1;
+	amr_lib_select_kernels();
+	try {
+		for (unsigned i = 0; i < threads; ++i) scheduler->m_threads.push_back(std::thread(amr_lib_schedule, scheduler));
+	} catch (...) {
+		amr_lib_scheduler_destroy(scheduler);
+		return AMR_LIB_ERROR_MEMORY;
+	}
+	*out = scheduler;
+	return AMR_LIB_OK;
+}
+
+void amr_lib_scheduler_destroy(amr_lib_scheduler * scheduler) {
+	if (scheduler == NULL) return;
+	{
+		std::lock_guard<std::mutex> lock(scheduler->m_lock);
+		scheduler->m_stopping = true;
+	}
+	scheduler->m_wake.notify_all();
+	for (size_t i = 0; i < scheduler->m_threads.size(); ++i) scheduler->m_threads[i].join();
+	delete scheduler;
+}
+
+void amr_lib_scheduler_get_stats(amr_lib_scheduler * scheduler, amr_lib_scheduler_stats * out) {
+	if (scheduler == NULL || out == NULL) return;
+	std::lock_guard<std::mutex> lock(scheduler->m_lock);
+	*out = scheduler->m_stats;
+}
+
+int amr_lib_stream_open(amr_lib_scheduler * scheduler, amr_lib_frame_ready ready, void * user, amr_lib_stream ** out) {
+	if (out == NULL) return AMR_LIB_ERROR_ARGUMENT;
+	*out = NULL;
+	if (scheduler == NULL || ready == NULL) return AMR_LIB_ERROR_ARGUMENT;
+	amr_lib_stream * stream = new (std::nothrow) amr_lib_stream;
+	if (stream == NULL) return AMR_LIB_ERROR_MEMORY;
+	stream->m_scheduler = scheduler;
+	stream->m_ready = ready;
+	stream->m_user = user;
+	stream->m_busy = false;
+	stream->m_closing = false;
+	stream->m_decoder = Decoder_Interface_init();
+	if (stream->m_decoder == NULL) {
+		delete stream;
+		return AMR_LIB_ERROR_MEMORY;
+	}
+	*out = stream;
+	return AMR_LIB_OK;
+}
+
+int amr_lib_stream_queue(amr_lib_stream * stream, const void * frame, size_t size, unsigned long long deadline) {
+	if (stream == NULL || frame == NULL || size == 0) return AMR_LIB_ERROR_ARGUMENT;
+	const unsigned char * data = static_cast<const unsigned char *>(frame);
+	if (!amr_lib_is_header(data[0]) || size != 1 + (size_t)Decoder_Interface_block_size[(data[0] >> 3) & 0x0F]) return AMR_LIB_ERROR_FORMAT;
+	amr_lib_pending pending;
+	pending.m_deadline = deadline;
+	memset(pending.m_frame, 0, sizeof(pending.m_frame));
+	memcpy(pending.m_frame, data, size);
+
+	amr_lib_scheduler * scheduler = stream->m_scheduler;
+	bool wake = false;
+	{
+		std::lock_guard<std::mutex> lock(scheduler->m_lock);
+		try {
+			stream->m_frames.push_back(pending);
+		} catch (std::bad_alloc const &) {
+			return AMR_LIB_ERROR_MEMORY;
+		}
+		/* stream not in the heap nor taken goes in with this frame first */
+		if (stream->m_frames.size() == 1 && !stream->m_busy) {
+			scheduler->m_ready.push_back(stream);
+			std::push_heap(scheduler->m_ready.begin(), scheduler->m_ready.end(), amr_lib_due_later);
+			wake = true;
+		}
+	}
+	if (wake) scheduler->m_wake.notify_one();
+	return AMR_LIB_OK;
+}
+
+void amr_lib_stream_close(amr_lib_stream * stream) {
+	if (stream == NULL) return;
+	amr_lib_scheduler * scheduler = stream->m_scheduler;
+	{
+		std::unique_lock<std::mutex> lock(scheduler->m_lock);
+		stream->m_closing = true;
+		std::vector<amr_lib_stream *> & ready = scheduler->m_ready;
+		std::vector<amr_lib_stream *>::iterator it = std::find(ready.begin(), ready.end(), stream);
+		if (it != ready.end()) {
+			ready.erase(it);
+			std::make_heap(ready.begin(), ready.end(), amr_lib_due_later);
+		}
+		while (stream->m_busy) scheduler->m_idle.wait(lock);
+	}
+	Decoder_Interface_exit(stream->m_decoder);
+	delete stream;
+}
+
+
+/**
+ * Async stream: a live stream of the scheduler, fed with frames of blocks its source reads. Reads are started by
+ * amr_lib_async_pump, on whichever thread sees there's room for more frames: the one completing a read, or a
+ * worker handing out a frame. Source may complete a read from within read, which would start the next one from
+ * within it too, so reads are started in a loop by one thread at a time, told to go on by others.
+ */
+struct amr_lib_async {
+	amr_lib_async_source m_source;
+	amr_lib_frame_ready m_ready;
+	amr_lib_async_done m_done;
+	void * m_user;
+	amr_lib_stream * m_stream;
+	std::mutex m_lock;
+	/* close waits for the read, the loop starting reads, and completions still calling back, to be over */
+	std::condition_variable m_idle;
+	/* bytes read and not queued: a frame cut off by the end of a block, or the header, until it's whole */
+	std::vector<unsigned char> m_left;
+	unsigned char m_block[amr_lib_async_block];
+	/* frames queued, and handed out */
+	unsigned long long m_queued;
+	unsigned long long m_decoded;
+	/* amr_lib_async_complete calls past the read they end: done may hand the stream to a thread closing it */
+	unsigned m_completing;
+	bool m_started;
+	bool m_reading;
+	bool m_pumping;
+	bool m_again;
+	bool m_ended;
+	bool m_closing;
+	bool m_done_called;
+	int m_result;
+};
+
+/* whether the stream is over and done is to be called now; by the stream's lock */
+static bool amr_lib_async_take_done(amr_lib_async * p_stream) {
+	if (!p_stream->m_ended || p_stream->m_done_called || p_stream->m_closing || p_stream->m_decoded != p_stream->m_queued) return false;
+	p_stream->m_done_called = true;
+	return true;
+}
+
+/* queues whole frames of bytes read, after the header if there's one; by the stream's lock */
+static void amr_lib_async_parse(amr_lib_async * p_stream) {
+	std::vector<unsigned char> & data = p_stream->m_left;
+	size_t pos = 0;
+	if (!p_stream->m_started) {
+		if (data.empty() && !p_stream->m_ended) return;
+		const size_t head = std::min<size_t>(data.size(), amr_lib_magic_size);
+		if (memcmp(data.data(), g_magic, head) == 0) {
+			if (head < amr_lib_magic_size && !p_stream->m_ended) return;
+			pos = head;
+		}
+		p_stream->m_started = true;
+	}
+	const unsigned long long deadline = amr_lib_clock();
+	while (pos < data.size()) {
+		if (!amr_lib_is_header(data[pos])) {
+			p_stream->m_ended = true;
+			p_stream->m_result = AMR_LIB_ERROR_FORMAT;
+			break;
+		}
+		const size_t length = 1 + (size_t)Decoder_Interface_block_size[(data[pos] >> 3) & 0x0F];
+		if (data.size() - pos < length) break;
+		const int result = amr_lib_stream_queue(p_stream->m_stream, data.data() + pos, length, deadline);
+		if (result != AMR_LIB_OK) {
+			p_stream->m_ended = true;
+			p_stream->m_result = result;
+			break;
+		}
+		++p_stream->m_queued;
+		pos += length;
+	}
+	data.erase(data.begin(), data.begin() + pos);
+}
+
+/* starts reads while the stream has room for more frames and none is outstanding, see amr_lib_async */
+static void amr_lib_async_pump(amr_lib_async * p_stream) {
+	std::unique_lock<std::mutex> lock(p_stream->m_lock);
+	if (p_stream->m_pumping) {
+		p_stream->m_again = true;
+		return;
+	}
+	p_stream->m_pumping = true;
+	do {
+		p_stream->m_again = false;
+		if (p_stream->m_reading || p_stream->m_ended || p_stream->m_closing || p_stream->m_queued - p_stream->m_decoded >= amr_lib_async_ahead_frames) break;
+		p_stream->m_reading = true;
+		lock.unlock();
+		p_stream->m_source.read(p_stream->m_source.user, p_stream, p_stream->m_block, amr_lib_async_block);
+		lock.lock();
+	} while (p_stream->m_again);
+	p_stream->m_pumping = false;
+	p_stream->m_idle.notify_all();
+}
+
+/* hands a frame decoded by a worker to the stream's callback, and reads on if that made room */
+static void amr_lib_async_frame(void * p_user, const float * p_samples, unsigned long long p_late) {
+	amr_lib_async * stream = static_cast<amr_lib_async *>(p_user);
+	stream->m_ready(stream->m_user, p_samples, p_late);
+	bool done;
+	{
+		std::lock_guard<std::mutex> lock(stream->m_lock);
+		++stream->m_decoded;
+		done = amr_lib_async_take_done(stream);
+	}
+	if (done) stream->m_done(stream->m_user, stream->m_result);
+	amr_lib_async_pump(stream);
+}
+
+int amr_lib_async_open(amr_lib_scheduler * scheduler, const amr_lib_async_source * source, amr_lib_frame_ready ready, amr_lib_async_done done, void * user, amr_lib_async ** out) {
+	if (out == NULL) return AMR_LIB_ERROR_ARGUMENT;
+	*out = NULL;
+	if (scheduler == NULL || source == NULL || source->read == NULL || ready == NULL || done == NULL) return AMR_LIB_ERROR_ARGUMENT;
+	amr_lib_async * stream = new (std::nothrow) amr_lib_async;
+	if (stream == NULL) return AMR_LIB_ERROR_MEMORY;
+	stream->m_source = *source;
+	stream->m_ready = ready;
+	stream->m_done = done;
+	stream->m_user = user;
+	stream->m_queued = 0;
+	stream->m_decoded = 0;
+	stream->m_completing = 0;
+	stream->m_started = false;
+	stream->m_reading = false;
+	stream->m_pumping = false;
+	stream->m_again = false;
+	stream->m_ended = false;
+	stream->m_closing = false;
+	stream->m_done_called = false;
+	stream->m_result = AMR_LIB_OK;
+	const int result = amr_lib_stream_open(scheduler, amr_lib_async_frame, stream, &stream->m_stream);
+	if (result != AMR_LIB_OK) {
+		delete stream;
+		return result;
+	}
+	*out = stream;
+	amr_lib_async_pump(stream);
+	return AMR_LIB_OK;
+}
+
+void amr_lib_async_complete(amr_lib_async * stream, long got) {
+	if (stream == NULL) return;
+	bool done;
+	{
+		std::lock_guard<std::mutex> lock(stream->m_lock);
+		if (got > 0) {
+			const size_t size = std::min<size_t>((size_t)got, amr_lib_async_block);
+			try {
+				stream->m_left.insert(stream->m_left.end(), stream->m_block, stream->m_block + size);
+			} catch (std::bad_alloc const &) {
+				stream->m_ended = true;
+				stream->m_result = AMR_LIB_ERROR_MEMORY;
+			}
+		}
+		else {
+			/* what's left of a frame cut off by the end is dropped */
+			stream->m_ended = true;
+			if (got < 0) stream->m_result = AMR_LIB_ERROR_IO;
+		}
+		if (stream->m_result == AMR_LIB_OK) amr_lib_async_parse(stream);
+		stream->m_reading = false;
+		++stream->m_completing;
+		done = amr_lib_async_take_done(stream);
+	}
+	if (done) stream->m_done(stream->m_user, stream->m_result);
+	amr_lib_async_pump(stream);
+	std::lock_guard<std::mutex> lock(stream->m_lock);
+	--stream->m_completing;
+	stream->m_idle.notify_all();
+}
+
+void amr_lib_async_close(amr_lib_async * stream) {
+	if (stream == NULL) return;
+	{
+		std::unique_lock<std::mutex> lock(stream->m_lock);
+		stream->m_closing = true;
+		while (stream->m_reading || stream->m_pumping || stream->m_completing != 0) stream->m_idle.wait(lock);
+	}
+	amr_lib_stream_close(stream->m_stream);
+	delete stream;
+}
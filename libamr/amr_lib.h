@@ -0,0 +1,227 @@
+/**
+ * libamr - AMR-NB decoding without foobar2000, for servers and other players
+ *
+ * Storage format files, "#!AMR\n" and "#!AMR_MC1.0\n", are read from memory, a file or callbacks,
+ * indexed once on open, and decoded a frame at a time, seeking to the sample, by the same 3gpp engine
+ * and kernels as foo_input_amr. Output is 8 kHz, channels interleaved in file order. Each handle is
+ * used by one thread at a time; handles share no state, so as many threads as there are cores can
+ * decode a handle each. Live streams are decoded by deadline on a pool of threads, see amr_lib_scheduler, as
+ * are streams read by async reads, see amr_lib_async.
+*/
+#ifndef AMR_LIB_H
+#define AMR_LIB_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+enum {
+	AMR_LIB_OK = 0,
+	/* source could not be read, or the file could not be opened */
+	AMR_LIB_ERROR_IO = -1,
+	/* not an AMR-NB storage format file, or one with unsupported number of channels */
+	AMR_LIB_ERROR_FORMAT = -2,
+	AMR_LIB_ERROR_MEMORY = -3,
+	/* null pointer, or seek past the end */
+	AMR_LIB_ERROR_ARGUMENT = -4,
+
+	AMR_LIB_SAMPLE_RATE = 8000,
+	/* samples of each channel in a frame */
+	AMR_LIB_FRAME_SAMPLES = 160,
+	AMR_LIB_MAX_CHANNELS = 6,
+
+	/* laws of amr_lib_decode_g711 */
+	AMR_LIB_G711_ALAW = 0,
+	AMR_LIB_G711_ULAW = 1,
+
+	/* formats of amr_lib_output */
+	AMR_LIB_OUTPUT_PCM16 = 0,
+	AMR_LIB_OUTPUT_FLOAT = 1,
+	AMR_LIB_OUTPUT_ALAW = 2,
+	AMR_LIB_OUTPUT_ULAW = 3
+};
+
+/* file being decoded */
+typedef struct amr_lib_file amr_lib_file;
+
+/* one output of amr_lib_decode_tee: format, AMR_LIB_OUTPUT_*, and buffer of samples of that format */
+typedef struct amr_lib_output {
+	int format;
+	void *out;
+} amr_lib_output;
+
+/*
+ * Source read by callback, as a socket or archive. read gets up to size bytes at offset into buffer
+ * and returns how many it got, 0 at the end, or negative on error; it's called from
+ * amr_lib_open_source only, which reads all of it, so the source can be released once that returns
+ */
+typedef struct amr_lib_source {
+	void *user;
+	long (*read)(void *user, unsigned long long offset, void *buffer, unsigned long size);
+} amr_lib_source;
+
+/*
+ * Opens a file held in memory; data is not copied and must outlive the handle. Frames are indexed,
+ * with damaged data of single channel files skipped up to where frames start again, as foo_input_amr
+ * does. Returns AMR_LIB_OK and the handle in *out, or an error and NULL
+ */
+int amr_lib_open_memory(const void *data, size_t size, amr_lib_file **out);
+
+/* same, with the file at path read into memory first */
+int amr_lib_open_file(const char *path, amr_lib_file **out);
+
+/* same, with what the source gives read into memory first */
+int amr_lib_open_source(const amr_lib_source *source, amr_lib_file **out);
+
+/* frees the handle and its decoders; NULL is ignored */
+void amr_lib_close(amr_lib_file *file);
+
+/* number of channels */
+unsigned amr_lib_channels(const amr_lib_file *file);
+
+/* length in samples of each channel, exact, as frames were indexed on open */
+unsigned long long amr_lib_length(const amr_lib_file *file);
+
+/*
+ * Seeks to given sample of each channel; decoding goes on from there. Decoders are brought to the
+ * state they'd be in by decoding up to 16 frames before the target, without output
+ */
+int amr_lib_seek(amr_lib_file *file, unsigned long long sample);
+
+/*
+ * Decodes samples from start up to end of each channel to out, channels interleaved, which takes (end - start)
+ * * channels samples, as a transcription tool asks for snippets of a file by time. Decoders are the call's own,
+ * warmed up as amr_lib_seek does from up to 16 frames before start, and the handle is only read, so ranges of
+ * one handle can be decoded on several threads at once, alongside amr_lib_decode on another one. Returns
+ * AMR_LIB_OK and samples of each channel written in *samples, end - start, or AMR_LIB_ERROR_ARGUMENT if the
+ * range is not within the file
+ */
+int amr_lib_decode_range(const amr_lib_file *file, unsigned long long start, unsigned long long end, short *out, unsigned long long *samples);
+
+/*
+ * Decodes up to frames frames of each channel to out, channels interleaved, which takes frames *
+ * AMR_LIB_FRAME_SAMPLES * channels samples; first frame after seek gives the samples from the target on.
+ * Returns AMR_LIB_OK and samples of each channel written in *samples, 0 at the end
+ */
+int amr_lib_decode(amr_lib_file *file, unsigned frames, short *out, unsigned *samples);
+
+/* same, but output is floating point, scaled to [-1, 1) */
+int amr_lib_decode_float(amr_lib_file *file, unsigned frames, float *out, unsigned *samples);
+
+/*
+ * Same, but output is G.711 of given law, AMR_LIB_G711_ALAW or AMR_LIB_G711_ULAW, a byte per sample,
+ * as telephone systems take it; it's coded by table from the decoder's 16-bit output, frame by frame
+ */
+int amr_lib_decode_g711(amr_lib_file *file, unsigned frames, int law, unsigned char *out, unsigned *samples);
+
+/*
+ * Same, but frames are decoded once, to 16-bit, and written to each of count outputs in its format, so a
+ * file converted to several formats at once is decoded just once. Each buffer takes frames *
+ * AMR_LIB_FRAME_SAMPLES * channels samples; floating point output is the 16-bit one scaled, not that of
+ * amr_lib_decode_float, and G.711 is coded from it by the same table as amr_lib_decode_g711 codes
+ */
+int amr_lib_decode_tee(amr_lib_file *file, unsigned frames, const amr_lib_output *outputs, unsigned count, unsigned *samples);
+
+/*
+ * Live streams, whose frames come one at a time, each with a deadline by which it's to be decoded, as a
+ * monitoring server has them. A scheduler decodes frames of all its streams on a pool of threads, the one
+ * due first first; frames of other streams due within the batch window of it are decoded along with it,
+ * side by side, by the cross-stream kernels. Frames of one stream are decoded in the order they were queued,
+ * one at a time. Functions of the scheduler and its streams may be called from any thread
+ */
+typedef struct amr_lib_scheduler amr_lib_scheduler;
+typedef struct amr_lib_stream amr_lib_stream;
+
+/*
+ * Called on a worker thread with each frame of a stream decoded: AMR_LIB_FRAME_SAMPLES samples scaled to
+ * [-1, 1), and by how many microseconds it missed its deadline, 0 if it did not. Calls for one stream don't
+ * overlap; the callback is not to call functions of its scheduler
+ */
+typedef void (*amr_lib_frame_ready)(void *user, const float *samples, unsigned long long late);
+
+/* counters of a scheduler since it was created */
+typedef struct amr_lib_scheduler_stats {
+	unsigned long long frames;
+	/* decodes of frames side by side, a frame or more each */
+	unsigned long long batches;
+	/* frames decoded past their deadline, and the most any was late by, in microseconds */
+	unsigned long long missed;
+	unsigned long long worst_late;
+} amr_lib_scheduler_stats;
+
+/* current time in microseconds, on the clock deadlines are given on */
+unsigned long long amr_lib_clock(void);
+
+/*
+ * Starts a scheduler with given number of worker threads, 0 for one per core. Frames due no more than
+ * batch_window microseconds after the one due first are decoded with it. Returns AMR_LIB_OK and the scheduler
+ * in *out, or an error and NULL
+ */
+int amr_lib_scheduler_create(unsigned threads, unsigned long long batch_window, amr_lib_scheduler **out);
+
+/* ends the worker threads, once frames they decode are done; its streams are to be closed first. NULL is ignored */
+void amr_lib_scheduler_destroy(amr_lib_scheduler *scheduler);
+
+/* counters so far */
+void amr_lib_scheduler_get_stats(amr_lib_scheduler *scheduler, amr_lib_scheduler_stats *out);
+
+/* adds a stream, decoded by a decoder of its own, whose frames are handed to ready with user */
+int amr_lib_stream_open(amr_lib_scheduler *scheduler, amr_lib_frame_ready ready, void *user, amr_lib_stream **out);
+
+/*
+ * Queues next frame of the stream: a storage format frame, header byte and its data, copied, to be decoded
+ * by deadline, on amr_lib_clock(). Returns AMR_LIB_ERROR_FORMAT if size is not that of the frame type
+ */
+int amr_lib_stream_queue(amr_lib_stream *stream, const void *frame, size_t size, unsigned long long deadline);
+
+/* drops frames of the stream not decoded yet, waits for one being decoded, and frees it; NULL is ignored */
+void amr_lib_stream_close(amr_lib_stream *stream);
+
+/*
+ * Streams whose data comes from async reads, network or storage, so a server decodes thousands of them on the
+ * threads of one scheduler: data is asked of the source a block at a time, and while a read is outstanding the
+ * stream waits holding no thread. Frames of a block read are queued to the scheduler as they'd be by
+ * amr_lib_stream_queue, due right away, decoded side by side with frames of its other streams, and handed to
+ * ready; next block is asked for as soon as fewer than a second of frames wait to be decoded, so reading and
+ * decoding overlap, and memory of a stream stays the same however fast its source is
+ */
+typedef struct amr_lib_async amr_lib_async;
+
+/*
+ * Source of an async stream: read starts a read of up to size bytes of storage format data, following what was
+ * read before, into buffer, and returns without waiting for it; the source calls amr_lib_async_complete once it's
+ * done, from any thread, or from within read. A stream has one read outstanding at a time. Data is single channel
+ * frames, with the "#!AMR\n" header in front or without it
+ */
+typedef struct amr_lib_async_source {
+	void *user;
+	void (*read)(void *user, amr_lib_async *stream, void *buffer, unsigned long size);
+} amr_lib_async_source;
+
+/*
+ * Called once after the last frame of an async stream is handed to ready, on whichever thread got there: with
+ * AMR_LIB_OK at the end of data, AMR_LIB_ERROR_IO if a read failed, AMR_LIB_ERROR_FORMAT if data is not AMR-NB
+ * frames. As ready, it's not to call functions of the scheduler, nor of the stream
+ */
+typedef void (*amr_lib_async_done)(void *user, int result);
+
+/* adds an async stream to the scheduler, and starts the first read; frames are handed to ready, and the end to done, with user */
+int amr_lib_async_open(amr_lib_scheduler *scheduler, const amr_lib_async_source *source, amr_lib_frame_ready ready, amr_lib_async_done done, void *user, amr_lib_async **out);
+
+/* ends the read outstanding: got bytes were read to its buffer, 0 at the end of data, negative on error */
+void amr_lib_async_complete(amr_lib_async *stream, long got);
+
+/*
+ * Waits for the read outstanding, if any, which the source is to complete, and for amr_lib_async_complete of it to
+ * return, drops frames not decoded yet, waits for one being decoded, and frees the stream; not to be called from
+ * callbacks of it, though done may hand the stream to a thread that closes it. NULL is ignored
+ */
+void amr_lib_async_close(amr_lib_async *stream);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,179 @@
+/**
+ * libamr_test - checks of libamr async streams, outside foobar2000: streams are read by an I/O thread, and each
+ * is closed by another thread as soon as its done callback hands it over, as a server frees a stream once it's
+ * over. Exits with 0 if all streams ended with what was read, 1 if not; run under a memory checker, it also
+ * catches a stream freed while its last read is still being completed
+*/
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "../libamr/amr_lib.h"
+
+enum {
+	/* streams open at once, and how many times they're opened over */
+	libamr_test_streams = 64,
+	libamr_test_rounds = 200,
+	/* 12.2 kbit/s frame: header byte and 31 bytes of data, which decode as silence when zero */
+	libamr_test_frame_header = 0x3C,
+	libamr_test_frame_size = 32,
+	/* bytes a read completes with at most, so frames are cut off by the end of a read */
+	libamr_test_read_size = 47,
+};
+
+static const char g_magic[] = "#!AMR\n";
+
+/* an async stream, with data of frames frames, read to pos */
+struct libamr_test_stream {
+	std::vector<unsigned char> m_data;
+	size_t m_pos;
+	unsigned m_frames;
+	unsigned m_decoded;
+	int m_result;
+	bool m_done;
+	amr_lib_async * m_async;
+};
+
+/* read not completed yet */
+struct libamr_test_read {
+	libamr_test_stream * m_stream;
+	amr_lib_async * m_async;
+	void * m_buffer;
+	unsigned long m_size;
+};
+
+/* reads for the I/O thread, and streams for the closing thread; both by g_lock */
+static std::mutex g_lock;
+static std::condition_variable g_wake;
+static std::deque<libamr_test_read> g_reads;
+static std::deque<libamr_test_stream *> g_over;
+static unsigned g_closed;
+static bool g_stop;
+
+static void libamr_test_read_start(void * p_user, amr_lib_async * p_async, void * p_buffer, unsigned long p_size) {
+	libamr_test_read read = { static_cast<libamr_test_stream *>(p_user), p_async, p_buffer, p_size };
+	std::lock_guard<std::mutex> lock(g_lock);
+	g_reads.push_back(read);
+	g_wake.notify_all();
+}
+
+static void libamr_test_ready(void * p_user, const float * p_samples, unsigned long long p_late) {
+	(void)p_late;
+	libamr_test_stream * stream = static_cast<libamr_test_stream *>(p_user);
+	for (unsigned n = 0; n < AMR_LIB_FRAME_SAMPLES; ++n) {
+		if (p_samples[n] != 0) stream->m_result = AMR_LIB_ERROR_FORMAT;
+	}
+	++stream->m_decoded;
+}
+
+/* hands the stream over to the closing thread, which may free it before this returns */
+static void libamr_test_done(void * p_user, int p_result) {
+	libamr_test_stream * stream = static_cast<libamr_test_stream *>(p_user);
+	std::lock_guard<std::mutex> lock(g_lock);
+	if (stream->m_result == AMR_LIB_OK) stream->m_result = p_result;
+	stream->m_done = true;
+	g_over.push_back(stream);
+	g_wake.notify_all();
+}
+
+/* completes reads in the order they were started, a few bytes at a time, then 0 at the end */
+static void libamr_test_io() {
+	std::unique_lock<std::mutex> lock(g_lock);
+	for (;;) {
+		while (g_reads.empty() && !g_stop) g_wake.wait(lock);
+		if (g_reads.empty()) return;
+		const libamr_test_read read = g_reads.front();
+		g_reads.pop_front();
+		lock.unlock();
+		libamr_test_stream * stream = read.m_stream;
+		size_t size = stream->m_data.size() - stream->m_pos;
+		if (size > libamr_test_read_size) size = libamr_test_read_size;
+		if (size > read.m_size) size = read.m_size;
+		memcpy(read.m_buffer, stream->m_data.data() + stream->m_pos, size);
+		stream->m_pos += size;
+		amr_lib_async_complete(read.m_async, (long)size);
+		lock.lock();
+	}
+}
+
+/* closes streams as soon as they're handed over */
+static void libamr_test_close() {
+	std::unique_lock<std::mutex> lock(g_lock);
+	for (;;) {
+		while (g_over.empty() && !g_stop) g_wake.wait(lock);
+		if (g_over.empty()) return;
+		libamr_test_stream * stream = g_over.front();
+		g_over.pop_front();
+		lock.unlock();
+		amr_lib_async_close(stream->m_async);
+		lock.lock();
+		++g_closed;
+		g_wake.notify_all();
+	}
+}
+
+int main() {
+	amr_lib_scheduler * scheduler;
+	if (amr_lib_scheduler_create(0, 0, &scheduler) != AMR_LIB_OK) {
+		fprintf(stderr, "Could not start the scheduler\n");
+		return 1;
+	}
+	std::thread io(libamr_test_io);
+	std::thread closer(libamr_test_close);
+
+	std::vector<libamr_test_stream> streams(libamr_test_streams);
+	unsigned failed = 0;
+	for (unsigned round = 0; round < libamr_test_rounds; ++round) {
+		{
+			std::lock_guard<std::mutex> lock(g_lock);
+			g_closed = 0;
+		}
+		for (unsigned n = 0; n < libamr_test_streams; ++n) {
+			libamr_test_stream & stream = streams[n];
+			/* streams of no frames are over when their last read completes, with done called by the thread completing it */
+			stream.m_frames = (round + n) % 4;
+			stream.m_data.assign(g_magic, g_magic + strlen(g_magic));
+			for (unsigned f = 0; f < stream.m_frames; ++f) {
+				stream.m_data.push_back(libamr_test_frame_header);
+				stream.m_data.insert(stream.m_data.end(), libamr_test_frame_size - 1, 0);
+			}
+			stream.m_pos = 0;
+			stream.m_decoded = 0;
+			stream.m_result = AMR_LIB_OK;
+			stream.m_done = false;
+			const amr_lib_async_source source = { &stream, libamr_test_read_start };
+			if (amr_lib_async_open(scheduler, &source, libamr_test_ready, libamr_test_done, &stream, &stream.m_async) != AMR_LIB_OK) {
+				fprintf(stderr, "Could not open stream %u\n", n);
+				return 1;
+			}
+		}
+		{
+			std::unique_lock<std::mutex> lock(g_lock);
+			while (g_closed < libamr_test_streams) g_wake.wait(lock);
+		}
+		for (unsigned n = 0; n < libamr_test_streams; ++n) {
+			const libamr_test_stream & stream = streams[n];
+			if (!stream.m_done || stream.m_result != AMR_LIB_OK || stream.m_decoded != stream.m_frames) {
+				if (failed++ < 10) fprintf(stderr, "Round %u, stream %u: result %d, %u of %u frames\n", round, n, stream.m_result, stream.m_decoded, stream.m_frames);
+			}
+		}
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(g_lock);
+		g_stop = true;
+		g_wake.notify_all();
+	}
+	io.join();
+	closer.join();
+	amr_lib_scheduler_destroy(scheduler);
+	if (failed != 0) {
+		fprintf(stderr, "%u streams failed\n", failed);
+		return 1;
+	}
+	printf("%u streams ok\n", libamr_test_streams * libamr_test_rounds);
+	return 0;
+}